@@ -0,0 +1,263 @@
+#!/usr/bin/env python3
+"""Generate the tables behind --normalize nfkc,casefold,unicode-space.
+
+Writes src/unicode_tables.c and src/include/unicode_tables.h from the
+Unicode character database bundled with this Python (unicodedata), so the
+tables follow the Unicode version of the interpreter that ran it:
+
+    python3 scripts/gen_unicode_tables.py
+
+Per code point the tables hold the canonical combining class, the
+White_Space property, whether it can be the second half of a canonical
+composition, its canonical decomposition, and what it maps to under NFKC,
+full case folding, and both (NFKC, case folding, NFKC again). Mappings are
+stored composed; the normalizer decomposes a character again only when a
+combining mark follows it. Hangul syllables compose algorithmically and
+have no entries.
+
+A handful of compatibility characters expand to more than MAX_GROWTH times
+their UTF-8 length (the Arabic ligatures U+FDFA and U+FDFB, squared
+katakana words and the like). They are left as they are, so that
+normalized text is at most MAX_GROWTH times its input.
+"""
+
+import os
+import unicodedata
+
+MAX_GROWTH = 3
+BLOCK_SHIFT = 5
+WHITE_SPACE = [
+    *range(0x09, 0x0E), 0x20, 0x85, 0xA0, 0x1680, *range(0x2000, 0x200B),
+    0x2028, 0x2029, 0x202F, 0x205F, 0x3000,
+]
+FLAG_WHITE_SPACE = 1
+FLAG_COMPOSES_BACK = 2
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def utf8_len(text):
+    return len(text.encode("utf-8", "surrogatepass"))
+
+
+def nfkc(text):
+    return unicodedata.normalize("NFKC", text)
+
+
+def nfkc_casefold(text):
+    return nfkc(nfkc(text).casefold())
+
+
+def is_hangul_syllable(cp):
+    return 0xAC00 <= cp <= 0xD7A3
+
+
+def code_points():
+    for cp in range(0x110000):
+        if not 0xD800 <= cp <= 0xDFFF:
+            yield cp
+
+
+def compositions():
+    """Primary composites: canonical pairs that NFC keeps composed."""
+    pairs = {}
+    for cp in code_points():
+        decomposition = unicodedata.decomposition(chr(cp))
+        if not decomposition or decomposition.startswith("<"):
+            continue
+        parts = [int(part, 16) for part in decomposition.split()]
+        # Composition exclusions and singletons do not survive NFC.
+        if (len(parts) == 2 and
+                unicodedata.normalize("NFC", chr(cp)) == chr(cp)):
+            pairs[(parts[0], parts[1])] = cp
+    return pairs
+
+
+def main():
+    pairs = compositions()
+    seconds = {second for _, second in pairs}
+    seconds.update(range(0x1161, 0x1176))  # Hangul vowels
+    seconds.update(range(0x11A8, 0x11C3))  # Hangul trailing consonants
+    white_space = set(WHITE_SPACE)
+
+    sequences = [0]  # index 0 means "unchanged"
+    sequence_index = {}
+
+    def intern(text):
+        key = tuple(ord(ch) for ch in text)
+        if key not in sequence_index:
+            sequence_index[key] = len(sequences)
+            sequences.append(len(key))
+            sequences.extend(key)
+        return sequence_index[key]
+
+    # Marks that NFKC case folding turns into starters (U+0345 into iota).
+    # NFKC case folding maps the canonical decomposition, so characters
+    # holding one map to that decomposition with the mark left as it is;
+    # the normalizer maps it once it is in canonical order.
+    deferred = {cp for cp in code_points()
+                if unicodedata.combining(chr(cp)) and
+                unicodedata.combining(nfkc_casefold(chr(cp))[0]) == 0}
+
+    def both_mapping(ch):
+        parts = unicodedata.normalize("NFD", ch)
+        if not any(ord(part) in deferred for part in parts) or \
+                ord(ch) in deferred:
+            return nfkc_casefold(ch)
+        return "".join(part if ord(part) in deferred else nfkc_casefold(part)
+                       for part in parts)
+
+    records = [(0, 0, 0, 0, 0, 0)]
+    record_index = {records[0]: 0}
+    per_cp = {}
+    for cp in code_points():
+        ch = chr(cp)
+        maps = [0, 0, 0]
+        if not is_hangul_syllable(cp):
+            compat = nfkc(ch)
+            folded = ch.casefold()
+            both = both_mapping(ch)
+            if utf8_len(compat) > MAX_GROWTH * utf8_len(ch):
+                compat = both = ch
+            if utf8_len(both) > MAX_GROWTH * utf8_len(ch):
+                both = ch
+            for slot, mapped in enumerate((compat, folded, both)):
+                if mapped != ch:
+                    maps[slot] = intern(mapped)
+        decomp = 0
+        nfd = unicodedata.normalize("NFD", ch)
+        if (not is_hangul_syllable(cp) and nfd != ch and
+                any(unicodedata.combining(c) for c in nfd)):
+            # The normalizer swaps a starter for this: a starter, then
+            # marks in canonical order.
+            classes = [unicodedata.combining(c) for c in nfd]
+            if classes[0] == 0 and all(classes[1:]) and \
+                    classes[1:] == sorted(classes[1:]):
+                decomp = intern(nfd)
+        flags = (FLAG_WHITE_SPACE if cp in white_space else 0) | (
+            FLAG_COMPOSES_BACK if cp in seconds else 0)
+        record = (unicodedata.combining(ch), flags, *maps, decomp)
+        if record == records[0]:
+            continue
+        if record not in record_index:
+            record_index[record] = len(records)
+            records.append(record)
+        per_cp[cp] = record_index[record]
+
+    assert len(records) < 1 << 16 and len(sequences) < 1 << 16
+    block_size = 1 << BLOCK_SHIFT
+    limit = (max(per_cp) >> BLOCK_SHIFT) + 1 << BLOCK_SHIFT
+    blocks = []
+    block_index = {}
+    stage1 = []
+    for start in range(0, limit, block_size):
+        block = tuple(per_cp.get(cp, 0)
+                      for cp in range(start, start + block_size))
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_index[block])
+    stage2 = [value for block in blocks for value in block]
+    composition_keys = sorted(pairs)
+
+    version = unicodedata.unidata_version
+    banner = (f"// Generated by scripts/gen_unicode_tables.py from Unicode "
+              f"{version}; do not edit.\n")
+    header = f"""{banner}#ifndef UNICODE_TABLES_H
+#define UNICODE_TABLES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Properties of one code point. map holds its NFKC, case folding and NFKC
+ * case folding mappings and decomp its canonical decomposition, as indices
+ * into unicode_sequences (a length, then the code points); 0 is none.
+ */
+typedef struct {{
+  uint8_t ccc; // canonical combining class
+  uint8_t flags;
+  uint16_t map[3];
+  uint16_t decomp;
+}} UnicodeRecord;
+
+enum {{
+  UNICODE_WHITE_SPACE = {FLAG_WHITE_SPACE},
+  UNICODE_COMPOSES_BACK = {FLAG_COMPOSES_BACK}, // second half of a composition
+}};
+
+/** Code points from here on have the all-zero record. */
+static constexpr uint32_t UNICODE_TABLE_LIMIT = 0x{limit:X};
+static constexpr unsigned UNICODE_BLOCK_SHIFT = {BLOCK_SHIFT};
+/** Mappings grow text at most this many times, in UTF-8 bytes. */
+static constexpr size_t UNICODE_MAX_GROWTH = {MAX_GROWTH};
+static constexpr size_t UNICODE_COMPOSITION_COUNT = {len(composition_keys)};
+
+/** Record block of each 2^UNICODE_BLOCK_SHIFT code points. */
+extern const uint16_t unicode_blocks[];
+/** Record index of each code point, block by block. */
+extern const uint16_t unicode_block_records[];
+extern const UnicodeRecord unicode_records[];
+extern const uint32_t unicode_sequences[];
+/** Sorted first << 21 | second keys of the primary composites. */
+extern const uint64_t unicode_composition_keys[];
+extern const uint32_t unicode_composites[];
+
+#endif
+"""
+
+    def wrap(cells):
+        lines = []
+        line = "   "
+        for cell in cells:
+            if len(line) + len(cell) + 2 > 80:
+                lines.append(line)
+                line = "   "
+            line += " " + cell + ","
+        lines.append(line)
+        return "\n".join(lines)
+
+    def array(values, fmt):
+        return wrap([fmt.format(value) for value in values])
+
+    record_lines = wrap(["{{{}, {}, {{{}, {}, {}}}, {}}}".format(*record)
+                         for record in records])
+    source = f"""{banner}#include "unicode_tables.h"
+
+const uint16_t unicode_blocks[] = {{
+{array(stage1, "{}")}
+}};
+
+const uint16_t unicode_block_records[] = {{
+{array(stage2, "{}")}
+}};
+
+const UnicodeRecord unicode_records[] = {{
+{record_lines}
+}};
+
+const uint32_t unicode_sequences[] = {{
+{array(sequences, "0x{:X}")}
+}};
+
+const uint64_t unicode_composition_keys[] = {{
+{array([first << 21 | second for first, second in composition_keys],
+       "0x{:X}")}
+}};
+
+const uint32_t unicode_composites[] = {{
+{array([pairs[key] for key in composition_keys], "0x{:X}")}
+}};
+"""
+    with open(os.path.join(ROOT, "src", "include", "unicode_tables.h"),
+              "w") as f:
+        f.write(header)
+    with open(os.path.join(ROOT, "src", "unicode_tables.c"), "w") as f:
+        f.write(source)
+    print(f"{len(records)} records, {len(blocks)} blocks, "
+          f"{len(sequences)} sequence words, {len(composition_keys)} "
+          f"compositions, Unicode {version}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,353 @@
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench_kernels.h"
+#include "config.h"
+#include "hash_utils.h"
+#include "progress.h"
+#include "text_utils.h"
+#include "utf8.h"
+
+static constexpr size_t BENCH_DEFAULT_MIB = 64;
+static constexpr size_t BENCH_DEFAULT_ROUNDS = 5;
+static constexpr size_t BENCH_MIN_UNIT = 16;
+static constexpr size_t BENCH_MAX_UNIT = 256;
+static constexpr size_t BENCH_DECODE_CHUNK = 64 * 1024;
+
+// Synthetic corpus cut into dedup-sized units.
+typedef struct {
+  char8_t *text;
+  size_t len;
+  size_t *offsets; // unit i is text[offsets[i], offsets[i + 1])
+  size_t unit_count;
+} BenchInput;
+
+static void print_bench_help(const char *prog) {
+  printf("Usage:\n"
+         "  %s --bench-kernels [--size MiB] [--rounds N]\n"
+         "  Prints the throughput of every SIMD kernel this CPU runs and of "
+         "its scalar version on --size MiB of synthetic text (default %zu), "
+         "best of --rounds (default %zu); ctest checks that they agree\n"
+         "  Author: %s\n"
+         "  License: %s\n"
+         "  Copyright: %s\n",
+         prog, BENCH_DEFAULT_MIB, BENCH_DEFAULT_ROUNDS, PROGRAM_AUTHOR,
+         PROGRAM_LICENSE_NAME, PROGRAM_COPYRIGHT);
+}
+
+static uint64_t next_random(uint64_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+// Words of Latin and Cyrillic letters separated mostly by single spaces,
+// with the occasional run of mixed whitespace and line break.
+static void fill_text(char8_t *text, size_t len, uint64_t *rng) {
+  static const char *const separators[] = {" ",  " ",  " ",    " ",  " ",
+                                           " ",  " ",  "  ",   "\n", "\t ",
+                                           ". ", ", ", "\r\n", " \n\n "};
+  constexpr size_t separator_count =
+      sizeof(separators) / sizeof(separators[0]);
+  size_t pos = 0;
+  while (pos < len) {
+    uint64_t r = next_random(rng);
+    size_t letters = 1 + r % 10;
+    bool cyrillic = (r >> 8) % 5 == 0;
+    for (size_t i = 0; i < letters && pos < len; ++i) {
+      if (cyrillic && pos + 1 < len) {
+        text[pos++] = (char8_t)0xD0;
+        text[pos++] = (char8_t)(0xB0 + (r >> (16 + i)) % 16);
+      } else {
+        text[pos++] = (char8_t)('a' + (r >> (16 + i)) % 26);
+      }
+    }
+    const char *sep = separators[(r >> 40) % separator_count];
+    for (; *sep && pos < len; ++sep) {
+      text[pos++] = (char8_t)*sep;
+    }
+  }
+}
+
+static bool make_input(size_t bytes, BenchInput *input) {
+  *input = (BenchInput){0};
+  size_t max_units = bytes / BENCH_MIN_UNIT + 2;
+  input->text = (char8_t *)malloc(bytes ? bytes : 1);
+  input->offsets = (size_t *)malloc(max_units * sizeof(size_t));
+  if (!input->text || !input->offsets) {
+    free(input->text);
+    free(input->offsets);
+    return false;
+  }
+  uint64_t rng = 0x9E3779B97F4A7C15ull;
+  fill_text(input->text, bytes, &rng);
+  input->len = bytes;
+  size_t count = 0;
+  input->offsets[0] = 0;
+  for (size_t pos = 0; pos < bytes; count++) {
+    size_t unit = BENCH_MIN_UNIT +
+                  next_random(&rng) % (BENCH_MAX_UNIT - BENCH_MIN_UNIT + 1);
+    pos = unit < bytes - pos ? pos + unit : bytes;
+    input->offsets[count + 1] = pos;
+  }
+  input->unit_count = count;
+  return true;
+}
+
+static void free_input(BenchInput *input) {
+  free(input->text);
+  free(input->offsets);
+  *input = (BenchInput){0};
+}
+
+// The per-unit work of emit_unit before the fused kernels: normalize, then
+// hash the output with FNV-1a.
+static size_t normalize_then_fnv1a(const NormalizeKernel *scalar,
+                                   const char8_t *unit, size_t len,
+                                   char8_t *out) {
+  size_t out_len = scalar->normalize(unit, len, out, len);
+  return out_len + (size_t)hash_bytes_fnv1a(out, out_len);
+}
+
+// Best-of-rounds throughput of one kernel over all units, in GB/s; with
+// hashed set it times normalize_hash, or the FNV-1a baseline when kernel
+// is nullptr.
+static double time_normalize(const NormalizeKernel *scalar,
+                             const NormalizeKernel *kernel, bool hashed,
+                             const BenchInput *input, char8_t *out,
+                             size_t rounds, size_t *checksum) {
+  double best = 0.0;
+  for (size_t round = 0; round < rounds; ++round) {
+    size_t total = 0;
+    double start = now_seconds();
+    for (size_t i = 0; i < input->unit_count; ++i) {
+      const char8_t *unit = input->text + input->offsets[i];
+      size_t len = input->offsets[i + 1] - input->offsets[i];
+      if (!kernel) {
+        total += normalize_then_fnv1a(scalar, unit, len, out);
+      } else if (hashed) {
+        Hash128 hash = {0};
+        total += kernel->normalize_hash(unit, len, out, len, &hash);
+        total += (size_t)hash.lo;
+      } else {
+        total += kernel->normalize(unit, len, out, len);
+      }
+    }
+    double elapsed = now_seconds() - start;
+    *checksum += total;
+    if (elapsed > 0.0 && (best == 0.0 || elapsed < best))
+      best = elapsed;
+  }
+  return best > 0.0 ? (double)input->len / best / 1e9 : 0.0;
+}
+
+static bool bench_normalize(const BenchInput *input, size_t rounds,
+                            bool hashed) {
+  const NormalizeKernel *kernels = nullptr;
+  size_t count = normalize_kernels(&kernels);
+  auto got = (char8_t *)malloc(BENCH_MAX_UNIT);
+  if (!got) {
+    fprintf(stderr, "Failed to allocate benchmark buffers.\n");
+    return false;
+  }
+
+  if (hashed)
+    printf("normalize_sentence_hashed (%s)", unit_hash_active()->name);
+  else
+    printf("normalize_sentence");
+  if (normalize_selected() != 0) {
+    char steps[64];
+    printf(" --normalize %s",
+           normalize_describe(normalize_selected(), steps, sizeof(steps)));
+  }
+  printf(": %zu units, %.1f MiB, best of %zu rounds\n", input->unit_count,
+         (double)input->len / (1024.0 * 1024.0), rounds);
+  size_t checksum = 0;
+  // Speedups are against the scalar kernel, or for the hashed variant
+  // against the separate FNV-1a pass emit_unit used to make.
+  double base_rate = 0.0;
+  if (hashed) {
+    base_rate = time_normalize(&kernels[0], nullptr, true, input, got, rounds,
+                               &checksum);
+    printf("  %-8s %7.2f GB/s\n", "fnv1a", base_rate);
+  }
+  for (size_t k = 0; k < count; ++k) {
+    double rate = time_normalize(&kernels[0], &kernels[k], hashed, input, got,
+                                 rounds, &checksum);
+    if (k == 0 && !hashed)
+      base_rate = rate;
+    printf("  %-8s %7.2f GB/s", kernels[k].name, rate);
+    if ((k > 0 || hashed) && base_rate > 0.0)
+      printf("  %5.2fx", rate / base_rate);
+    printf("%s\n", k + 1 == count ? "  (dispatched)" : "");
+  }
+  // Keeps the timed calls from being optimized away.
+  if (checksum == 1)
+    printf("\n");
+  free(got);
+  return true;
+}
+
+// Best-of-rounds throughput of hashing every unit, in GB/s; impl nullptr
+// times FNV-1a.
+static double time_unit_hash(const UnitHash *impl, const BenchInput *input,
+                             size_t rounds, size_t *checksum) {
+  double best = 0.0;
+  for (size_t round = 0; round < rounds; ++round) {
+    uint64_t total = 0;
+    double start = now_seconds();
+    for (size_t i = 0; i < input->unit_count; ++i) {
+      const unsigned char *unit = input->text + input->offsets[i];
+      size_t len = input->offsets[i + 1] - input->offsets[i];
+      total += impl ? impl->hash(unit, len).hi : hash_bytes_fnv1a(unit, len);
+    }
+    double elapsed = now_seconds() - start;
+    *checksum += (size_t)total;
+    if (elapsed > 0.0 && (best == 0.0 || elapsed < best))
+      best = elapsed;
+  }
+  return best > 0.0 ? (double)input->len / best / 1e9 : 0.0;
+}
+
+static void bench_unit_hashes(const BenchInput *input, size_t rounds) {
+  const UnitHash *impls = nullptr;
+  size_t count = unit_hash_impls(&impls);
+  printf("unit hashes: %zu units, %.1f MiB, best of %zu rounds\n",
+         input->unit_count, (double)input->len / (1024.0 * 1024.0), rounds);
+  size_t checksum = 0;
+  // Speedups are against FNV-1a, the unit hash before the families.
+  double base_rate = time_unit_hash(nullptr, input, rounds, &checksum);
+  printf("  %-15s %7.2f GB/s\n", "fnv1a", base_rate);
+  for (size_t k = 0; k < count; ++k) {
+    double rate = time_unit_hash(&impls[k], input, rounds, &checksum);
+    char label[32];
+    snprintf(label, sizeof(label), "%s/%s", impls[k].name, impls[k].impl);
+    printf("  %-15s %7.2f GB/s", label, rate);
+    if (base_rate > 0.0)
+      printf("  %5.2fx", rate / base_rate);
+    if (&impls[k] == unit_hash_auto(false, false))
+      printf("  (auto)");
+    if (&impls[k] == unit_hash_auto(true, false))
+      printf("  (auto, documents)");
+    printf("\n");
+  }
+  // Keeps the timed calls from being optimized away.
+  if (checksum == 1)
+    printf("\n");
+}
+
+// Best-of-rounds throughput of decoding the whole input in
+// BENCH_DECODE_CHUNK slices, document-sized, in GB/s.
+static double time_decode(const Utf8DecodeKernel *kernel,
+                          const BenchInput *input, uint32_t *out,
+                          size_t rounds, size_t *checksum) {
+  double best = 0.0;
+  for (size_t round = 0; round < rounds; ++round) {
+    size_t total = 0;
+    double start = now_seconds();
+    for (size_t pos = 0; pos < input->len; pos += BENCH_DECODE_CHUNK) {
+      size_t len = input->len - pos < BENCH_DECODE_CHUNK ? input->len - pos
+                                                         : BENCH_DECODE_CHUNK;
+      size_t invalid = 0;
+      total += kernel->decode(input->text + pos, len, out, &invalid);
+      total += invalid + out[0];
+    }
+    double elapsed = now_seconds() - start;
+    *checksum += total;
+    if (elapsed > 0.0 && (best == 0.0 || elapsed < best))
+      best = elapsed;
+  }
+  return best > 0.0 ? (double)input->len / best / 1e9 : 0.0;
+}
+
+static bool bench_decode(const BenchInput *input, size_t rounds) {
+  const Utf8DecodeKernel *kernels = nullptr;
+  size_t count = utf8_decode_kernels(&kernels);
+  auto got = (uint32_t *)malloc(BENCH_DECODE_CHUNK * sizeof(uint32_t));
+  if (!got) {
+    fprintf(stderr, "Failed to allocate benchmark buffers.\n");
+    return false;
+  }
+
+  printf("utf8_decode_buffer: %.1f MiB in %zu KiB documents, best of %zu "
+         "rounds\n",
+         (double)input->len / (1024.0 * 1024.0), BENCH_DECODE_CHUNK / 1024,
+         rounds);
+  size_t checksum = 0;
+  double base_rate = 0.0;
+  for (size_t k = 0; k < count; ++k) {
+    double rate = time_decode(&kernels[k], input, got, rounds, &checksum);
+    if (k == 0)
+      base_rate = rate;
+    printf("  %-8s %7.2f GB/s", kernels[k].name, rate);
+    if (k > 0 && base_rate > 0.0)
+      printf("  %5.2fx", rate / base_rate);
+    printf("%s\n", k + 1 == count ? "  (dispatched)" : "");
+  }
+  // Keeps the timed calls from being optimized away.
+  if (checksum == 1)
+    printf("\n");
+  free(got);
+  return true;
+}
+
+static bool parse_count(const char *value, size_t *out) {
+  if (!value)
+    return false;
+  errno = 0;
+  char *end = nullptr;
+  unsigned long long parsed = strtoull(value, &end, 10);
+  if (errno != 0 || end == value || *end != '\0' || parsed == 0 ||
+      parsed > SIZE_MAX)
+    return false;
+  *out = (size_t)parsed;
+  return true;
+}
+
+int run_bench_kernels(const char *prog, int argc, char **argv) {
+  size_t mib = BENCH_DEFAULT_MIB;
+  size_t rounds = BENCH_DEFAULT_ROUNDS;
+  for (int i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+      print_bench_help(prog);
+      return 0;
+    }
+    if (strcmp(arg, "--size") == 0 || strcmp(arg, "--rounds") == 0) {
+      size_t *target = arg[2] == 's' ? &mib : &rounds;
+      if (i + 1 >= argc || !parse_count(argv[++i], target)) {
+        fprintf(stderr, "%s expects a positive integer\n", arg);
+        return 1;
+      }
+      continue;
+    }
+    fprintf(stderr, "Unknown option: %s\n", arg);
+    print_bench_help(prog);
+    return 1;
+  }
+  if (mib > SIZE_MAX >> 20) {
+    fprintf(stderr, "--size is too large\n");
+    return 1;
+  }
+
+  BenchInput input;
+  if (!make_input(mib << 20, &input)) {
+    fprintf(stderr, "Failed to allocate %zu MiB of benchmark text.\n", mib);
+    return 1;
+  }
+  bool ok = bench_normalize(&input, rounds, false);
+  bench_unit_hashes(&input, rounds);
+  unit_hash_select(unit_hash_auto(false, false));
+  ok = bench_normalize(&input, rounds, true) && ok;
+  ok = bench_decode(&input, rounds) && ok;
+  normalize_select(NORMALIZE_NFKC | NORMALIZE_CASEFOLD |
+                   NORMALIZE_UNICODE_SPACE);
+  ok = bench_normalize(&input, rounds, false) && ok;
+  normalize_select(0);
+  free_input(&input);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+#include <stdlib.h>
+
+#include "bloom.h"
+#include "config.h"
+
+static constexpr uint64_t BLOOM_BIT_SEED = 0x9E3779B97F4A7C15ULL;
+
+static inline uint64_t mix64(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33;
+  x *= 0xC4CEB9FE1A85EC53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+bool bloom_init(BloomFilter *filter, size_t byte_len) {
+  if (!filter)
+    return false;
+  *filter = (BloomFilter){0};
+  size_t words = 1;
+  while (words <= byte_len / sizeof(uint64_t) / 2)
+    words *= 2;
+  filter->words = (_Atomic uint64_t *)calloc(words, sizeof(uint64_t));
+  if (!filter->words)
+    return false;
+  filter->word_mask = words - 1;
+  return true;
+}
+
+void bloom_destroy(BloomFilter *filter) {
+  if (!filter)
+    return;
+  free((void *)filter->words);
+  *filter = (BloomFilter){0};
+}
+
+size_t bloom_bytes(const BloomFilter *filter) {
+  return filter && filter->words ? (filter->word_mask + 1) * sizeof(uint64_t)
+                                 : 0;
+}
+
+bool bloom_add(BloomFilter *filter, uint64_t key) {
+  // Zero keys are stored as 1 by the set and index; do the same so seeding
+  // from a saved index matches runtime keys.
+  uint64_t mixed = mix64(key ? key : 1);
+  _Atomic uint64_t *word = &filter->words[mixed & filter->word_mask];
+  // The word index uses the low bits; take bit positions from a second mix.
+  uint64_t bits_source = mix64(mixed ^ BLOOM_BIT_SEED);
+  uint64_t pattern = 0;
+  for (size_t i = 0; i < BLOOM_HASHES; ++i) {
+    pattern |= 1ULL << (bits_source & 63);
+    bits_source >>= 6;
+  }
+  // A plain load answers the common "already set" case without a write.
+  if ((atomic_load_explicit(word, memory_order_relaxed) & pattern) == pattern)
+    return true;
+  uint64_t previous =
+      atomic_fetch_or_explicit(word, pattern, memory_order_relaxed);
+  return (previous & pattern) == pattern;
+}
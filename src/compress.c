@@ -0,0 +1,337 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#ifndef HAVE_ZLIB
+#define HAVE_ZLIB 0
+#endif
+#ifndef HAVE_ZSTD
+#define HAVE_ZSTD 0
+#endif
+
+#if HAVE_ZLIB
+#include <zlib.h>
+#endif
+#if HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "compress.h"
+#include "config.h"
+#include "io_utils.h"
+
+// Compressor state of one thread, kept across its output files.
+typedef struct {
+  unsigned char *chunk; // COMPRESS_OUTPUT_CHUNK bytes of compressed output
+#if HAVE_ZLIB
+  z_stream zs;
+  bool zs_init;
+  int zs_level;
+#endif
+#if HAVE_ZSTD
+  ZSTD_CCtx *zstd;
+#endif
+} Compressor;
+
+struct OutputWriter {
+  FILE *fp;
+  char *path;
+  CompressionKind kind;
+  Compressor *compressor; // nullptr when uncompressed
+  size_t raw_bytes;
+  size_t stored_bytes;
+  bool failed;
+};
+
+static once_flag compressor_once = ONCE_FLAG_INIT;
+static tss_t compressor_key;
+static bool compressor_key_ok;
+
+bool compression_from_string(const char *text, CompressionKind *out) {
+  if (strcmp(text, "none") == 0)
+    *out = COMPRESSION_NONE;
+  else if (strcmp(text, "gzip") == 0)
+    *out = COMPRESSION_GZIP;
+  else if (strcmp(text, "zstd") == 0)
+    *out = COMPRESSION_ZSTD;
+  else
+    return false;
+  return true;
+}
+
+const char *compression_name(CompressionKind kind) {
+  switch (kind) {
+  case COMPRESSION_GZIP:
+    return "gzip";
+  case COMPRESSION_ZSTD:
+    return "zstd";
+  case COMPRESSION_NONE:
+    break;
+  }
+  return "none";
+}
+
+const char *compression_suffix(CompressionKind kind) {
+  switch (kind) {
+  case COMPRESSION_GZIP:
+    return ".gz";
+  case COMPRESSION_ZSTD:
+    return ".zst";
+  case COMPRESSION_NONE:
+    break;
+  }
+  return "";
+}
+
+int compression_default_level(CompressionKind kind) {
+  switch (kind) {
+  case COMPRESSION_GZIP:
+    return OUTPUT_GZIP_DEFAULT_LEVEL;
+  case COMPRESSION_ZSTD:
+    return OUTPUT_ZSTD_DEFAULT_LEVEL;
+  case COMPRESSION_NONE:
+    break;
+  }
+  return 0;
+}
+
+int compression_max_level(CompressionKind kind) {
+  switch (kind) {
+  case COMPRESSION_GZIP:
+    return 9;
+  case COMPRESSION_ZSTD:
+#if HAVE_ZSTD
+    return ZSTD_maxCLevel();
+#else
+    return 22;
+#endif
+  case COMPRESSION_NONE:
+    break;
+  }
+  return 0;
+}
+
+static void free_compressor(void *ptr) {
+  auto compressor = (Compressor *)ptr;
+  if (!compressor)
+    return;
+#if HAVE_ZLIB
+  if (compressor->zs_init)
+    deflateEnd(&compressor->zs);
+#endif
+#if HAVE_ZSTD
+  ZSTD_freeCCtx(compressor->zstd);
+#endif
+  free(compressor->chunk);
+  free(compressor);
+}
+
+static void create_compressor_key() {
+  compressor_key_ok =
+      tss_create(&compressor_key, free_compressor) == thrd_success;
+}
+
+static Compressor *thread_compressor() {
+  call_once(&compressor_once, create_compressor_key);
+  if (!compressor_key_ok)
+    return nullptr;
+  auto compressor = (Compressor *)tss_get(compressor_key);
+  if (compressor)
+    return compressor;
+  compressor = (Compressor *)calloc(1, sizeof(Compressor));
+  if (!compressor)
+    return nullptr;
+  compressor->chunk = (unsigned char *)malloc(COMPRESS_OUTPUT_CHUNK);
+  if (!compressor->chunk ||
+      tss_set(compressor_key, compressor) != thrd_success) {
+    free_compressor(compressor);
+    return nullptr;
+  }
+  return compressor;
+}
+
+// Ready the thread's codec for a new file at level.
+static bool start_stream(Compressor *compressor, CompressionKind kind,
+                         int level) {
+#if HAVE_ZLIB
+  if (kind == COMPRESSION_GZIP) {
+    if (compressor->zs_init && compressor->zs_level == level)
+      return deflateReset(&compressor->zs) == Z_OK;
+    if (compressor->zs_init)
+      deflateEnd(&compressor->zs);
+    // 15 + 16: full window with a gzip header.
+    compressor->zs_init = deflateInit2(&compressor->zs, level, Z_DEFLATED,
+                                       15 + 16, 8,
+                                       Z_DEFAULT_STRATEGY) == Z_OK;
+    compressor->zs_level = level;
+    return compressor->zs_init;
+  }
+#endif
+#if HAVE_ZSTD
+  if (kind == COMPRESSION_ZSTD) {
+    if (!compressor->zstd)
+      compressor->zstd = ZSTD_createCCtx();
+    return compressor->zstd &&
+           !ZSTD_isError(
+               ZSTD_CCtx_reset(compressor->zstd, ZSTD_reset_session_only)) &&
+           !ZSTD_isError(ZSTD_CCtx_setParameter(
+               compressor->zstd, ZSTD_c_compressionLevel, level));
+  }
+#endif
+  (void)compressor;
+  (void)kind;
+  (void)level;
+  return false;
+}
+
+static bool put_stored(OutputWriter *writer, const void *data, size_t len) {
+  if (len > 0 && fwrite(data, 1, len, writer->fp) != len) {
+    fprintf(stderr, "Failed to write full output file: %s\n", writer->path);
+    writer->failed = true;
+    return false;
+  }
+  writer->stored_bytes += len;
+  return true;
+}
+
+// Feed len bytes to the codec (finishing the stream when finish is set) and
+// write out every chunk it produces.
+static bool compress_bytes(OutputWriter *writer, const unsigned char *data,
+                           size_t len, bool finish) {
+  Compressor *compressor = writer->compressor;
+#if HAVE_ZLIB
+  if (writer->kind == COMPRESSION_GZIP) {
+    z_stream *zs = &compressor->zs;
+    do {
+      uInt in_chunk = len > UINT32_MAX ? UINT32_MAX : (uInt)len;
+      bool last = finish && in_chunk == len;
+      zs->next_in = (unsigned char *)data;
+      zs->avail_in = in_chunk;
+      int rc = Z_OK;
+      do {
+        zs->next_out = compressor->chunk;
+        zs->avail_out = (uInt)COMPRESS_OUTPUT_CHUNK;
+        rc = deflate(zs, last ? Z_FINISH : Z_NO_FLUSH);
+        if (rc == Z_STREAM_ERROR)
+          return false;
+        if (!put_stored(writer, compressor->chunk,
+                        COMPRESS_OUTPUT_CHUNK - zs->avail_out)) {
+          return false;
+        }
+      } while (zs->avail_out == 0 || (last && rc != Z_STREAM_END));
+      data += in_chunk;
+      len -= in_chunk;
+    } while (len > 0);
+    return true;
+  }
+#endif
+#if HAVE_ZSTD
+  if (writer->kind == COMPRESSION_ZSTD) {
+    ZSTD_inBuffer in = {.src = data, .size = len};
+    for (;;) {
+      ZSTD_outBuffer out = {.dst = compressor->chunk,
+                            .size = COMPRESS_OUTPUT_CHUNK};
+      size_t remaining = ZSTD_compressStream2(
+          compressor->zstd, &out, &in, finish ? ZSTD_e_end : ZSTD_e_continue);
+      if (ZSTD_isError(remaining))
+        return false;
+      if (!put_stored(writer, compressor->chunk, out.pos))
+        return false;
+      if (finish ? remaining == 0 : in.pos == in.size)
+        return true;
+    }
+  }
+#endif
+  (void)compressor;
+  (void)data;
+  (void)len;
+  (void)finish;
+  return false;
+}
+
+OutputWriter *output_writer_open(const char *path,
+                                 const OutputCompression *compression) {
+  CompressionKind kind = compression ? compression->kind : COMPRESSION_NONE;
+  auto writer = (OutputWriter *)calloc(1, sizeof(OutputWriter));
+  char *path_copy = dup_string(path);
+  if (!writer || !path_copy) {
+    fprintf(stderr, "Failed to allocate output writer for: %s\n", path);
+    free(writer);
+    free(path_copy);
+    return nullptr;
+  }
+  *writer = (OutputWriter){.path = path_copy, .kind = kind};
+  if (kind != COMPRESSION_NONE) {
+    writer->compressor = thread_compressor();
+    if (!writer->compressor ||
+        !start_stream(writer->compressor, kind, compression->level)) {
+      fprintf(stderr, "Failed to start %s compressor for: %s\n",
+              compression_name(kind), path);
+      free(writer->path);
+      free(writer);
+      return nullptr;
+    }
+  }
+  writer->fp = fopen(path, "wb");
+  if (!writer->fp) {
+    fprintf(stderr, "Failed to open output file: %s\n", path);
+    free(writer->path);
+    free(writer);
+    return nullptr;
+  }
+  return writer;
+}
+
+bool output_writer_write(OutputWriter *writer, const void *data, size_t len) {
+  if (writer->failed)
+    return false;
+  writer->raw_bytes += len;
+  if (!writer->compressor)
+    return put_stored(writer, data, len);
+  if (len == 0)
+    return true;
+  if (!compress_bytes(writer, (const unsigned char *)data, len, false)) {
+    if (!writer->failed)
+      fprintf(stderr, "Failed to compress output file: %s\n", writer->path);
+    writer->failed = true;
+    return false;
+  }
+  return true;
+}
+
+bool output_writer_close(OutputWriter *writer, size_t *raw_bytes,
+                         size_t *stored_bytes) {
+  if (!writer)
+    return false;
+  bool ok = !writer->failed;
+  if (ok && writer->compressor &&
+      !compress_bytes(writer, (const unsigned char *)"", 0, true)) {
+    if (!writer->failed)
+      fprintf(stderr, "Failed to compress output file: %s\n", writer->path);
+    ok = false;
+  }
+  if (fclose(writer->fp) != 0 && ok) {
+    fprintf(stderr, "Failed to close output file: %s\n", writer->path);
+    ok = false;
+  }
+  if (ok) {
+    if (raw_bytes)
+      *raw_bytes += writer->raw_bytes;
+    if (stored_bytes)
+      *stored_bytes += writer->stored_bytes;
+  }
+  free(writer->path);
+  free(writer);
+  return ok;
+}
+
+bool write_output_file(const char *path, const OutputCompression *compression,
+                       const char8_t *data, size_t len, size_t *raw_bytes,
+                       size_t *stored_bytes) {
+  OutputWriter *writer = output_writer_open(path, compression);
+  if (!writer)
+    return false;
+  bool ok = output_writer_write(writer, data, len);
+  return output_writer_close(writer, raw_bytes, stored_bytes) && ok;
+}
@@ -1,7 +1,12 @@
 #include "config.h"
 
 const char *DUPLICATES_FILENAME = "duplicates.txt";
+const char *SPILL_DIRNAME = ".spill";
 const char *DEFAULT_MASK = "*.txt";
+const char *JSONL_DEFAULT_MASK = "*.jsonl";
+const char *JSONL_DEFAULT_TEXT_FIELD = "text";
+const char *SHARD_FILE_PREFIX = "shard-";
+const char *SHARD_INDEX_FILENAME = "shards.idx";
 const char PROGRAM_AUTHOR[] = "Yehor Smoliakov";
 const char PROGRAM_COPYRIGHT[] = "Copyright (c) 2026 Yehor Smoliakov";
 const char PROGRAM_LICENSE_NAME[] = "MIT License";
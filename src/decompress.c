@@ -0,0 +1,307 @@
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#ifndef HAVE_ZLIB
+#define HAVE_ZLIB 0
+#endif
+#ifndef HAVE_ZSTD
+#define HAVE_ZSTD 0
+#endif
+
+#if HAVE_ZLIB
+#include <zlib.h>
+#endif
+#if HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "ckdint_compat.h"
+#include "config.h"
+#include "decompress.h"
+
+struct DecompressStream {
+  FILE *fp;
+  CompressionKind kind;
+  const char *label;
+  unsigned char *in; // DECOMPRESS_INPUT_CHUNK bytes read ahead from fp
+  size_t in_pos;
+  size_t in_len;
+  bool in_eof;
+  bool done; // the current gzip member or zstd frame is complete
+#if HAVE_ZLIB
+  z_stream zs;
+  bool zs_init;
+#endif
+#if HAVE_ZSTD
+  ZSTD_DStream *zstd;
+#endif
+};
+
+// Per-thread output buffer of decompress_file, kept across calls.
+typedef struct {
+  char8_t *data;
+  size_t cap;
+} ThreadBuffer;
+
+static once_flag buffer_once = ONCE_FLAG_INIT;
+static tss_t buffer_key;
+static bool buffer_key_ok;
+
+static bool has_suffix(const char *name, const char *suffix) {
+  size_t name_len = strlen(name);
+  size_t suffix_len = strlen(suffix);
+  return name_len > suffix_len &&
+         memcmp(name + name_len - suffix_len, suffix, suffix_len) == 0;
+}
+
+CompressionKind compression_from_name(const char *name) {
+  if (!name)
+    return COMPRESSION_NONE;
+  if (has_suffix(name, ".gz"))
+    return COMPRESSION_GZIP;
+  if (has_suffix(name, ".zst"))
+    return COMPRESSION_ZSTD;
+  return COMPRESSION_NONE;
+}
+
+size_t compression_suffix_len(const char *name) {
+  switch (compression_from_name(name)) {
+  case COMPRESSION_GZIP:
+    return sizeof(".gz") - 1;
+  case COMPRESSION_ZSTD:
+    return sizeof(".zst") - 1;
+  case COMPRESSION_NONE:
+    break;
+  }
+  return 0;
+}
+
+bool compression_supported(CompressionKind kind) {
+  switch (kind) {
+  case COMPRESSION_NONE:
+    return true;
+  case COMPRESSION_GZIP:
+    return HAVE_ZLIB;
+  case COMPRESSION_ZSTD:
+    return HAVE_ZSTD;
+  }
+  return false;
+}
+
+DecompressStream *decompress_open(FILE *fp, CompressionKind kind,
+                                  const char *label) {
+  if (!compression_supported(kind) || kind == COMPRESSION_NONE) {
+    fprintf(stderr, "Built without %s support: %s\n",
+            kind == COMPRESSION_ZSTD ? "zstd" : "gzip", label);
+    return nullptr;
+  }
+  auto stream = (DecompressStream *)calloc(1, sizeof(DecompressStream));
+  if (!stream)
+    return nullptr;
+  *stream = (DecompressStream){.fp = fp,
+                               .kind = kind,
+                               .label = label,
+                               .done = true};
+  stream->in = (unsigned char *)malloc(DECOMPRESS_INPUT_CHUNK);
+  bool ok = stream->in != nullptr;
+#if HAVE_ZLIB
+  if (ok && kind == COMPRESSION_GZIP) {
+    // 15 + 32: full window, detect gzip or zlib headers.
+    ok = inflateInit2(&stream->zs, 15 + 32) == Z_OK;
+    stream->zs_init = ok;
+  }
+#endif
+#if HAVE_ZSTD
+  if (ok && kind == COMPRESSION_ZSTD) {
+    stream->zstd = ZSTD_createDStream();
+    ok = stream->zstd && !ZSTD_isError(ZSTD_initDStream(stream->zstd));
+  }
+#endif
+  if (!ok) {
+    fprintf(stderr, "Failed to start decompressing: %s\n", label);
+    decompress_close(stream);
+    return nullptr;
+  }
+  return stream;
+}
+
+static bool refill(DecompressStream *stream) {
+  if (stream->in_pos < stream->in_len || stream->in_eof)
+    return true;
+  stream->in_pos = 0;
+  stream->in_len = fread(stream->in, 1, DECOMPRESS_INPUT_CHUNK, stream->fp);
+  if (stream->in_len < DECOMPRESS_INPUT_CHUNK) {
+    if (ferror(stream->fp))
+      return false;
+    stream->in_eof = true;
+  }
+  return true;
+}
+
+// Run the codec once over the buffered input; returns bytes produced or
+// SIZE_MAX on corrupt input.
+static size_t decode_step(DecompressStream *stream, unsigned char *out,
+                          size_t cap) {
+  size_t avail = stream->in_len - stream->in_pos;
+#if HAVE_ZLIB
+  if (stream->kind == COMPRESSION_GZIP) {
+    // Concatenated members: start the next one where the last ended.
+    if (stream->done && avail > 0) {
+      if (inflateReset(&stream->zs) != Z_OK)
+        return SIZE_MAX;
+      stream->done = false;
+    }
+    if (stream->done)
+      return 0;
+    uInt in_chunk = avail > UINT32_MAX ? UINT32_MAX : (uInt)avail;
+    uInt out_chunk = cap > UINT32_MAX ? UINT32_MAX : (uInt)cap;
+    stream->zs.next_in = stream->in + stream->in_pos;
+    stream->zs.avail_in = in_chunk;
+    stream->zs.next_out = out;
+    stream->zs.avail_out = out_chunk;
+    int rc = inflate(&stream->zs, Z_NO_FLUSH);
+    stream->in_pos += in_chunk - stream->zs.avail_in;
+    if (rc == Z_STREAM_END)
+      stream->done = true;
+    else if (rc != Z_OK && rc != Z_BUF_ERROR)
+      return SIZE_MAX;
+    return out_chunk - stream->zs.avail_out;
+  }
+#endif
+#if HAVE_ZSTD
+  if (stream->kind == COMPRESSION_ZSTD) {
+    ZSTD_inBuffer in = {.src = stream->in + stream->in_pos, .size = avail};
+    ZSTD_outBuffer out_buf = {.dst = out, .size = cap};
+    size_t rc = ZSTD_decompressStream(stream->zstd, &out_buf, &in);
+    if (ZSTD_isError(rc))
+      return SIZE_MAX;
+    stream->in_pos += in.pos;
+    stream->done = rc == 0;
+    return out_buf.pos;
+  }
+#endif
+  (void)avail;
+  (void)out;
+  (void)cap;
+  return SIZE_MAX;
+}
+
+size_t decompress_read(DecompressStream *stream, void *buf, size_t cap,
+                       bool *failed) {
+  auto out = (unsigned char *)buf;
+  size_t produced = 0;
+  while (produced < cap) {
+    if (!refill(stream)) {
+      fprintf(stderr, "Failed to read compressed input: %s\n", stream->label);
+      *failed = true;
+      return 0;
+    }
+    bool exhausted = stream->in_pos == stream->in_len && stream->in_eof;
+    if (exhausted && stream->done)
+      break;
+    size_t got = decode_step(stream, out + produced, cap - produced);
+    if (got == SIZE_MAX) {
+      fprintf(stderr, "Corrupt compressed input: %s\n", stream->label);
+      *failed = true;
+      return 0;
+    }
+    if (exhausted && got == 0 && !stream->done) {
+      fprintf(stderr, "Truncated compressed input: %s\n", stream->label);
+      *failed = true;
+      return 0;
+    }
+    produced += got;
+  }
+  return produced;
+}
+
+void decompress_close(DecompressStream *stream) {
+  if (!stream)
+    return;
+#if HAVE_ZLIB
+  if (stream->zs_init)
+    inflateEnd(&stream->zs);
+#endif
+#if HAVE_ZSTD
+  ZSTD_freeDStream(stream->zstd);
+#endif
+  free(stream->in);
+  free(stream);
+}
+
+static void free_thread_buffer(void *ptr) {
+  auto buffer = (ThreadBuffer *)ptr;
+  if (buffer) {
+    free(buffer->data);
+    free(buffer);
+  }
+}
+
+static void create_buffer_key() {
+  buffer_key_ok = tss_create(&buffer_key, free_thread_buffer) == thrd_success;
+}
+
+static ThreadBuffer *thread_buffer() {
+  call_once(&buffer_once, create_buffer_key);
+  if (!buffer_key_ok)
+    return nullptr;
+  auto buffer = (ThreadBuffer *)tss_get(buffer_key);
+  if (buffer)
+    return buffer;
+  buffer = (ThreadBuffer *)calloc(1, sizeof(ThreadBuffer));
+  if (buffer && tss_set(buffer_key, buffer) != thrd_success) {
+    free(buffer);
+    buffer = nullptr;
+  }
+  return buffer;
+}
+
+bool decompress_file(FILE *fp, CompressionKind kind, const char *label,
+                     size_t size_hint, const char8_t **out,
+                     size_t *out_len) {
+  ThreadBuffer *buffer = thread_buffer();
+  DecompressStream *stream =
+      buffer ? decompress_open(fp, kind, label) : nullptr;
+  if (!stream)
+    return false;
+
+  size_t len = 0;
+  bool failed = false;
+  for (;;) {
+    if (buffer->cap - len < DECOMPRESS_INPUT_CHUNK) {
+      size_t next_cap = buffer->cap;
+      if (next_cap == 0 &&
+          ckd_mul(&next_cap, size_hint, DECOMPRESS_SIZE_GUESS_RATIO))
+        next_cap = SIZE_MAX;
+      if (next_cap < DECOMPRESS_MIN_BUFFER)
+        next_cap = DECOMPRESS_MIN_BUFFER;
+      while (next_cap - len < DECOMPRESS_INPUT_CHUNK) {
+        if (ckd_mul(&next_cap, next_cap, (size_t)2)) {
+          failed = true;
+          break;
+        }
+      }
+      auto next = failed ? nullptr : (char8_t *)realloc(buffer->data, next_cap);
+      if (!next) {
+        fprintf(stderr, "Failed to allocate decompression buffer for: %s\n",
+                label);
+        failed = true;
+        break;
+      }
+      buffer->data = next;
+      buffer->cap = next_cap;
+    }
+    size_t got =
+        decompress_read(stream, buffer->data + len, buffer->cap - len, &failed);
+    if (got == 0)
+      break;
+    len += got;
+  }
+  decompress_close(stream);
+  if (failed)
+    return false;
+  *out = buffer->data;
+  *out_len = len;
+  return true;
+}
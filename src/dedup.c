@@ -1,40 +1,90 @@
-#include <dirent.h>
 #include <errno.h>
-#include <fnmatch.h>
 #include <inttypes.h>
+#include <math.h>
 #include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/resource.h>
+#include <sys/stat.h>
 #include <threads.h>
 #include <unistd.h>
 
 #include "arena.h"
 #include "block_tree.h"
+#include "bloom.h"
 #include "ckdint_compat.h"
+#include "compress.h"
 #include "config.h"
+#include "decompress.h"
 #include "dedup.h"
+#include "dedup_index.h"
+#include "dir_scan.h"
 #include "hash_utils.h"
 #include "io_utils.h"
+#include "jsonl.h"
+#include "manifest.h"
+#include "minhash.h"
+#include "partition.h"
 #include "progress.h"
 #include "sentence_set.h"
 #include "sentence_splitter.h"
+#include "shard_writer.h"
+#include "spill_runs.h"
+#include "substring_dedup.h"
 #include "text_utils.h"
+#include "unicode_tables.h"
+#include "uring_io.h"
 #include "utf8.h"
 
+// name and input_path point into the string pool of the scan batch that
+// listed the file, which outlives the item.
 typedef struct {
-  char *name;
-  char *input_path;
-  char8_t *raw_text;
-  size_t byte_len;
+  const char *name;
+  const char *input_path;
+  FileView text;   // open while a worker processes the file
+  size_t byte_len; // kept after the view closes
+  uint64_t size_hint; // size column of --files-from, 0 when unknown
+  bool failed; // external mode: unreadable in the key pass, skipped later
 } FileItem;
 
+// Normalized unit awaiting winner resolution in deterministic mode.
+typedef struct {
+  size_t offset; // into OrderedFile.norm_text
+  size_t len;
+  uint64_t order; // (global file index << 32) | unit index
+  uint64_t hash;
+  Hash128 fingerprint;
+  bool in_base; // already in the --load-index index, never claimed
+} PendingUnit;
+
+typedef struct {
+  char8_t *norm_text;
+  PendingUnit *units;
+  size_t unit_count;
+  Hash128 *band_keys; // near-document mode: LSH keys of the single unit
+  char8_t *dup_text; // duplicates, flushed in file order after the batch
+  size_t dup_len;
+  UnitPositionList winners; // --partition: owned units of this file
+  bool failed;
+} OrderedFile;
+
 typedef struct {
   char8_t *dedup_buffer;
   size_t dedup_cap;
   char8_t *norm_buffer;
   size_t norm_cap;
+  uint64_t *signature; // MinHash signature in near-document mode
+  size_t bloom_new;    // --bloom-filter tallies, flushed per worker
+  size_t bloom_maybe;
+  size_t bloom_false_positives;
+  ShardSlot *shard; // --output-format shards: taken on the first write
+  char8_t *dup_log; // --write-duplicates records not yet flushed
+  size_t dup_log_len;
+  size_t dup_log_cap;
+  const char *dup_source;  // --duplicates-metadata: name of the input
+  const char8_t *dup_text; // its text, for unit offsets
+  size_t dup_record;       // JSONL line of the record, 0 for plain files
 } DedupScratch;
 
 constexpr size_t SPAN_INIT_CAP = 16;
@@ -43,9 +93,21 @@ typedef enum {
   DEDUP_MODE_SENTENCE = 0,
   DEDUP_MODE_LINE = 1,
   DEDUP_MODE_PARAGRAPH = 2,
-  DEDUP_MODE_DOCUMENT = 3
+  DEDUP_MODE_DOCUMENT = 3,
+  DEDUP_MODE_NEAR_DOCUMENT = 4,
+  DEDUP_MODE_SUBSTRING = 5
 } DedupMode;
 
+// Shared sort buffer of the external-memory key pass; full buffers are sorted
+// and spilled as runs.
+typedef struct {
+  SpillStore *store;
+  SpillRecord *records;
+  size_t count;
+  size_t cap;
+  mtx_t lock;
+} SpillBuffer;
+
 typedef struct {
   atomic_size_t files_written;
   atomic_size_t files_empty;
@@ -54,22 +116,116 @@ typedef struct {
   atomic_size_t errors;
   atomic_size_t processed;
   atomic_size_t bytes_processed;
+  atomic_size_t bloom_new;
+  atomic_size_t bloom_maybe;
+  atomic_size_t bloom_false_positives;
+  atomic_size_t bytes_removed; // substring mode
+  atomic_size_t records;       // --input-format jsonl
+  atomic_size_t records_emptied;
+  atomic_size_t records_passed;
+  atomic_size_t records_malformed;
+  atomic_size_t output_raw_bytes; // bytes handed to the output writers
+  atomic_size_t output_stored_bytes;
 } BatchStats;
 
+// Substring mode state shared by its passes over the sorted file list.
+typedef struct {
+  SpanHasher hasher;
+  uint64_t *offsets;   // per file start in the concatenated normalized text
+  uint64_t *histogram; // windows per bin, summed by the counting pass
+  mtx_t histogram_lock;
+  SpanPass *pass;          // bins being collected, null while counting
+  _Atomic uint64_t *starts; // bit per position: a repeated window starts here
+  atomic_bool failed;       // a collect pass lost windows
+} SubstringState;
+
 static void print_dedup_help(const char *prog) {
   printf("Usage:\n"
          "  %s <input_dir> <output_dir> [mask] [--dedup-mode "
-         "<sentence|line|paragraph|document>] "
-         "[--write-duplicates] [--build-block-tree] [--max-length N]\n"
+         "<sentence|line|paragraph|document|near-document|substring>] "
+         "[--write-duplicates] [--duplicates-metadata] [--build-block-tree] "
+         "[--max-length N] "
+         "[--fingerprint-only] [--deterministic] [--shingle N] "
+         "[--permutations N] [--bands N] [--save-index PATH] "
+         "[--load-index PATH] [--memory-limit SIZE] [--spill-dir PATH] "
+         "[--partition i/N] [--merge-partitions N] [--bloom-filter SIZE] "
+         "[--min-span N] [--input-format <files|jsonl>] [--text-field NAME] "
+         "[--output-compression <none|gzip|zstd>] [--level N] "
+         "[--output-format <files|shards>] [--shard-size SIZE] "
+         "[--recursive] [--files-from MANIFEST] [--io-engine <sync|uring>] "
+         "[--hash <auto|murmur3|xxh|crc32c>] [--normalize LIST]\n"
          "  --max-length defaults to %zu symbols (0 is unlimited)\n"
+         "  near-document: MinHash over --shingle word shingles (default %zu), "
+         "--permutations hashes (default %zu) in --bands LSH bands "
+         "(default %zu)\n"
+         "  --load-index seeds the run with an index saved by --save-index; "
+         "only units new to it are kept\n"
+         "  --memory-limit bounds memory, worker scratch included, by "
+         "spilling sorted key runs to --spill-dir (default <output_dir>/%s) "
+         "and merging them once the keys outgrow it; SIZE takes a K/M/G/T "
+         "suffix, first occurrence in sorted file order wins\n"
+         "  --partition i/N keeps only keys of hash partition i and writes its "
+         "winners to <output_dir>; --merge-partitions N then writes the "
+         "output from all N winner lists\n"
+         "  --bloom-filter puts a SIZE-byte blocked Bloom filter in front of "
+         "the index; definitely-new units skip the per-file and base probes\n"
+         "  substring: drops every repeat of at least --min-span normalized "
+         "bytes (default %zu) after its first occurrence in sorted file "
+         "order; --memory-limit bounds each pass (default %zuM)\n"
+         "  --input-format jsonl streams JSONL shards (mask default %s) and "
+         "dedups the --text-field string of each record (default %s), "
+         "keeping its other fields\n"
+         "  .gz and .zst inputs are decompressed on the fly; the mask also "
+         "matches their names without the suffix, which outputs drop\n"
+         "  --output-compression writes each output as .gz or .zst, "
+         "compressed by the worker that produced it; --level defaults to "
+         "%d for gzip and %d for zstd\n"
+         "  --output-format shards appends outputs to per-thread %sNNNNN.bin "
+         "files of up to --shard-size bytes (default %zuM) indexed by %s\n"
+         "  --recursive scans subdirectories in parallel and mirrors them "
+         "under <output_dir>, which must not lie inside <input_dir>\n"
+         "  --files-from reads the files from MANIFEST instead of scanning: "
+         "paths relative to <input_dir>, one per line (or NUL-separated), "
+         "each optionally followed by a tab and its size; the largest run "
+         "first unless the mode is ordered\n"
+         "  --io-engine uring batches the opens, reads, writes and closes of "
+         "%zu files at a time through a per-thread io_uring (free-running "
+         "file mode; falls back to sync where io_uring is unavailable)\n"
+         "  --duplicates-metadata prefixes each line of %s with the input, "
+         "the unit's byte offset in it (line:offset into the text field for "
+         "JSONL) and the input that first held the unit (- for --load-index), "
+         "tab-separated\n"
+         "  --fingerprint-only keys the index on 128-bit hashes and keeps no "
+         "unit text\n"
+         "  --hash picks the unit hash family; auto (default) follows "
+         "--load-index, or else takes the fastest on this CPU: crc32c with "
+         "SSE4.2 (else murmur3), and for document units xxh on x86-64; "
+         "murmur3 instead of crc32c when the hash is the only key "
+         "(--fingerprint-only, --memory-limit, --partition, "
+         "--merge-partitions). Saved indexes and winner lists record it\n"
+         "  --normalize applies Unicode steps before whitespace runs "
+         "collapse: a comma list of nfkc (compatibility "
+         "composition), casefold (full case folding) and unicode-space "
+         "(every White_Space code point is a space), or none (default); a "
+         "unit may grow up to %zux, and the few longer compatibility "
+         "expansions are left as they are. Saved indexes and winner lists "
+         "record it\n"
+         "  --deterministic lets the first occurrence in sorted file order "
+         "win, independent of thread count\n"
          "  ASM: WAVESORT_USE_ASM=%d HASH_WORKER_USE_ASM=%d "
          "RADIX_SORT_USE_ASM=%d\n"
          "  Author: %s\n"
          "  License: %s\n"
          "  Copyright: %s\n",
-         prog, DEFAULT_MAX_COMPARE_LENGTH, WAVESORT_USE_ASM, HASH_WORKER_USE_ASM,
-         RADIX_SORT_USE_ASM, PROGRAM_AUTHOR, PROGRAM_LICENSE_NAME,
-         PROGRAM_COPYRIGHT);
+         prog, DEFAULT_MAX_COMPARE_LENGTH, MINHASH_DEFAULT_SHINGLE_WORDS,
+         MINHASH_DEFAULT_PERMUTATIONS, MINHASH_DEFAULT_BANDS, SPILL_DIRNAME,
+         SUBSTRING_DEFAULT_MIN_SPAN, SUBSTRING_DEFAULT_MEMORY >> 20,
+         JSONL_DEFAULT_MASK, JSONL_DEFAULT_TEXT_FIELD,
+         OUTPUT_GZIP_DEFAULT_LEVEL, OUTPUT_ZSTD_DEFAULT_LEVEL,
+         SHARD_FILE_PREFIX, SHARD_DEFAULT_SIZE >> 20, SHARD_INDEX_FILENAME,
+         URING_IO_BATCH, DUPLICATES_FILENAME, UNICODE_MAX_GROWTH,
+         WAVESORT_USE_ASM, HASH_WORKER_USE_ASM, RADIX_SORT_USE_ASM,
+         PROGRAM_AUTHOR, PROGRAM_LICENSE_NAME, PROGRAM_COPYRIGHT);
 }
 
 static const char *dedup_mode_name(DedupMode mode) {
@@ -82,6 +238,10 @@ static const char *dedup_mode_name(DedupMode mode) {
     return "paragraph";
   case DEDUP_MODE_DOCUMENT:
     return "document";
+  case DEDUP_MODE_NEAR_DOCUMENT:
+    return "near-document";
+  case DEDUP_MODE_SUBSTRING:
+    return "substring";
   }
   return "sentence";
 }
@@ -95,7 +255,10 @@ static const char *dedup_unit_plural(DedupMode mode) {
   case DEDUP_MODE_PARAGRAPH:
     return "paragraphs";
   case DEDUP_MODE_DOCUMENT:
+  case DEDUP_MODE_NEAR_DOCUMENT:
     return "documents";
+  case DEDUP_MODE_SUBSTRING:
+    return "spans";
   }
   return "sentences";
 }
@@ -119,6 +282,14 @@ static bool parse_dedup_mode(const char *arg, DedupMode *mode) {
     *mode = DEDUP_MODE_DOCUMENT;
     return true;
   }
+  if (strcmp(arg, "near-document") == 0) {
+    *mode = DEDUP_MODE_NEAR_DOCUMENT;
+    return true;
+  }
+  if (strcmp(arg, "substring") == 0) {
+    *mode = DEDUP_MODE_SUBSTRING;
+    return true;
+  }
   return false;
 }
 
@@ -136,12 +307,55 @@ static bool parse_size_arg(const char *value, size_t *out) {
   return true;
 }
 
+// Parse a byte count with an optional K, M, G or T (binary) suffix.
+static bool parse_byte_size_arg(const char *value, size_t *out) {
+  if (!value || !out)
+    return false;
+  errno = 0;
+  char *end = nullptr;
+  unsigned long long parsed = strtoull(value, &end, 10);
+  if (errno != 0 || end == value)
+    return false;
+  unsigned shift = 0;
+  switch (*end) {
+  case '\0':
+    break;
+  case 'K':
+  case 'k':
+    shift = 10;
+    break;
+  case 'M':
+  case 'm':
+    shift = 20;
+    break;
+  case 'G':
+  case 'g':
+    shift = 30;
+    break;
+  case 'T':
+  case 't':
+    shift = 40;
+    break;
+  default:
+    return false;
+  }
+  if (*end != '\0' && end[1] != '\0')
+    return false;
+  if (parsed > (SIZE_MAX >> shift))
+    return false;
+  *out = (size_t)parsed << shift;
+  return true;
+}
+
 static bool ensure_scratch(DedupScratch *scratch, size_t input_len) {
   if (!scratch)
     return false;
 
+  // --normalize steps may grow the text; size both buffers for the bound.
+  size_t norm_len = 0;
   size_t needed_out = 0;
-  if (ckd_mul(&needed_out, input_len, (size_t)2) ||
+  if (!normalize_bound(input_len, &norm_len) ||
+      ckd_mul(&needed_out, norm_len, (size_t)2) ||
       ckd_add(&needed_out, needed_out, (size_t)1)) {
     return false;
   }
@@ -156,20 +370,53 @@ static bool ensure_scratch(DedupScratch *scratch, size_t input_len) {
     scratch->dedup_cap = needed_out;
   }
 
-  if (scratch->norm_cap < input_len) {
+  if (scratch->norm_cap < norm_len) {
     size_t alloc_size = 0;
-    if (ckd_mul(&alloc_size, input_len, sizeof(char8_t)))
+    if (ckd_mul(&alloc_size, norm_len, sizeof(char8_t)))
       return false;
     auto next = (char8_t *)realloc(scratch->norm_buffer, alloc_size);
     if (!next)
       return false;
     scratch->norm_buffer = next;
-    scratch->norm_cap = input_len;
+    scratch->norm_cap = norm_len;
   }
 
   return true;
 }
 
+static bool ensure_signature(DedupScratch *scratch, size_t permutations) {
+  if (scratch->signature)
+    return true;
+  scratch->signature = (uint64_t *)calloc(permutations, sizeof(uint64_t));
+  return scratch->signature != nullptr;
+}
+
+static void free_scratch(DedupScratch *scratch) {
+  free(scratch->dedup_buffer);
+  free(scratch->norm_buffer);
+  free(scratch->signature);
+  free(scratch->dup_log);
+  *scratch = (DedupScratch){0};
+}
+
+// Grow a reusable buffer; buffers only ever grow, so records allocate
+// nothing once the largest one so far fits.
+static bool ensure_bytes(char8_t **buf, size_t *cap, size_t needed) {
+  if (*cap >= needed)
+    return true;
+  size_t next_cap = *cap ? *cap : 4'096;
+  while (next_cap < needed) {
+    if (ckd_mul(&next_cap, next_cap, (size_t)2))
+      return false;
+  }
+  auto next = (char8_t *)realloc(*buf, next_cap);
+  if (!next)
+    return false;
+  *buf = next;
+  *cap = next_cap;
+  return true;
+}
+
 static inline bool is_ascii_space(unsigned char c) { return c <= 0x20; }
 
 static bool has_non_space(const char8_t *data, size_t start, size_t end) {
@@ -234,10 +481,12 @@ static bool split_text_to_paragraphs(const char8_t *text, size_t len,
       pos++;
     }
     size_t line_end = pos;
-    while (pos < len &&
-           (text[pos] == (char8_t)'\n' || text[pos] == (char8_t)'\r')) {
+    // One terminator per line (\r\n counts once), so an empty line between
+    // paragraphs is seen as a blank line.
+    if (pos < len && text[pos] == (char8_t)'\r')
+      pos++;
+    if (pos < len && text[pos] == (char8_t)'\n')
       pos++;
-    }
     bool line_blank = !has_non_space(text, line_start, line_end);
     if (line_blank) {
       if (paragraph_start < line_start &&
@@ -294,49 +543,166 @@ static bool split_text_to_lines(const char8_t *text, size_t len,
   return true;
 }
 
-static bool emit_unit(const char8_t *data, size_t len, SentenceSet *seen,
-                      SentenceSet *local_seen, char8_t *norm_buf,
-                      size_t norm_cap, char8_t *out_buf, size_t *out_pos,
-                      size_t out_cap, size_t *out_unique,
-                      size_t *out_duplicates, FILE *duplicates_fp,
-                      mtx_t *duplicates_lock, size_t max_compare_len) {
-  size_t norm_len = normalize_sentence(data, len, norm_buf, norm_cap);
-  if (max_compare_len != 0 && norm_len > max_compare_len) {
-    norm_len = max_compare_len;
+// Insert-or-find a unit key. Tagged sets store tag with a new key and
+// report the tag of an existing one in *first_tag.
+static bool insert_unit(SentenceSet *set, const char8_t *data, size_t len,
+                        uint64_t hash, Hash128 fingerprint, uint64_t tag,
+                        uint64_t *first_tag, bool *inserted) {
+  if (set->tagged && set->fingerprint_only) {
+    return sentence_set_insert_fingerprint_tagged(set, fingerprint, tag,
+                                                  inserted, first_tag);
   }
-  if (norm_len == 0)
+  if (set->tagged) {
+    return sentence_set_insert_hashed_tagged(set, hash, data, len, tag,
+                                             inserted, first_tag);
+  }
+  if (set->fingerprint_only)
+    return sentence_set_insert_fingerprint(set, fingerprint, inserted);
+  return sentence_set_insert_hashed(set, hash, data, len, inserted);
+}
+
+// Hand the worker's gathered duplicates to the shared file in one write.
+static bool flush_duplicates(FILE *duplicates_fp, mtx_t *duplicates_lock,
+                             DedupScratch *scratch) {
+  if (scratch->dup_log_len == 0)
+    return true;
+  if (duplicates_lock)
+    mtx_lock(duplicates_lock);
+  bool ok = fwrite(scratch->dup_log, 1, scratch->dup_log_len,
+                   duplicates_fp) == scratch->dup_log_len;
+  if (duplicates_lock)
+    mtx_unlock(duplicates_lock);
+  scratch->dup_log_len = 0;
+  return ok;
+}
+
+// Append a duplicate unit to the worker's log, flushed once it holds
+// DUPLICATES_LOG_FLUSH bytes. With --duplicates-metadata the unit follows
+// its input, the offset of span in it and the input that first held the
+// unit (first_tag, a name pointer; 0 for a --load-index hit), tab-separated.
+static bool write_duplicate(FILE *duplicates_fp, mtx_t *duplicates_lock,
+                            DedupScratch *scratch, const char8_t *data,
+                            size_t len, const char8_t *span,
+                            uint64_t first_tag) {
+  if (!duplicates_fp)
+    return true;
+  const char *first = first_tag ? (const char *)(uintptr_t)first_tag : "-";
+  char offset[48];
+  int offset_len = 0;
+  size_t source_len = 0;
+  size_t first_len = 0;
+  size_t needed = scratch->dup_log_len;
+  if (scratch->dup_source) {
+    size_t unit_offset = (size_t)(span - scratch->dup_text);
+    offset_len =
+        scratch->dup_record
+            ? snprintf(offset, sizeof(offset), "%zu:%zu", scratch->dup_record,
+                       unit_offset)
+            : snprintf(offset, sizeof(offset), "%zu", unit_offset);
+    source_len = strlen(scratch->dup_source);
+    first_len = strlen(first);
+    if (ckd_add(&needed, needed, source_len + first_len + 3) ||
+        ckd_add(&needed, needed, (size_t)offset_len))
+      return false;
+  }
+  if (ckd_add(&needed, needed, len + 1) ||
+      !ensure_bytes(&scratch->dup_log, &scratch->dup_log_cap, needed))
+    return false;
+
+  char8_t *out = scratch->dup_log + scratch->dup_log_len;
+  if (scratch->dup_source) {
+    memcpy(out, scratch->dup_source, source_len);
+    out += source_len;
+    *out++ = (char8_t)'\t';
+    memcpy(out, offset, (size_t)offset_len);
+    out += offset_len;
+    *out++ = (char8_t)'\t';
+    memcpy(out, first, first_len);
+    out += first_len;
+    *out++ = (char8_t)'\t';
+  }
+  memcpy(out, data, len);
+  out[len] = (char8_t)'\n';
+  scratch->dup_log_len = needed;
+  if (scratch->dup_log_len < DUPLICATES_LOG_FLUSH)
     return true;
+  return flush_duplicates(duplicates_fp, duplicates_lock, scratch);
+}
+
+// True when a saved index from an earlier run already holds the unit.
+static bool in_base_index(const DedupIndex *base, const SentenceSet *seen,
+                          const char8_t *data, size_t len, uint64_t hash,
+                          Hash128 fingerprint) {
+  if (!base)
+    return false;
+  if (seen->fingerprint_only)
+    return dedup_index_contains_fingerprint(base, fingerprint);
+  return dedup_index_contains_hashed(base, hash, data, len);
+}
+
+// Probe-and-add a unit key in the prefilter, tallying the outcome; true when
+// the key may have been seen before.
+static bool bloom_check(BloomFilter *bloom, DedupScratch *scratch,
+                        const SentenceSet *seen, uint64_t hash,
+                        Hash128 fingerprint) {
+  bool maybe_seen =
+      bloom_add(bloom, seen->fingerprint_only ? fingerprint.hi : hash);
+  if (maybe_seen)
+    scratch->bloom_maybe++;
+  else
+    scratch->bloom_new++;
+  return maybe_seen;
+}
+
+// Look up the normalized unit norm_buf (from data) by its key: appended to
+// scratch->dedup_buffer when new, logged as a duplicate otherwise.
+static bool admit_unit(const char8_t *data, const char8_t *norm_buf,
+                       size_t norm_len, Hash128 key, SentenceSet *seen,
+                       const DedupIndex *base, SentenceSet *local_seen,
+                       BloomFilter *bloom, DedupScratch *scratch,
+                       size_t *out_pos, size_t *out_unique,
+                       size_t *out_duplicates, FILE *duplicates_fp,
+                       mtx_t *duplicates_lock) {
+  char8_t *out_buf = scratch->dedup_buffer;
+  size_t out_cap = scratch->dedup_cap;
+  uint64_t hash = 0;
+  Hash128 fingerprint = {0};
+  if (seen->fingerprint_only) {
+    fingerprint = key;
+  } else {
+    hash = key.hi;
+  }
 
-  uint64_t hash = hash_bytes_fnv1a(norm_buf, norm_len);
+  // Keys the prefilter has definitely never seen are in neither the per-file
+  // set nor the base index, so both probes are skipped.
+  bool maybe_seen =
+      !bloom || bloom_check(bloom, scratch, seen, hash, fingerprint);
 
-  if (local_seen) {
+  // Tag keys with the input's name for --duplicates-metadata.
+  uint64_t tag = (uint64_t)(uintptr_t)scratch->dup_source;
+  if (local_seen && maybe_seen) {
     bool local_inserted = false;
-    if (!sentence_set_insert_hashed(local_seen, hash, norm_buf, norm_len,
-                                    &local_inserted)) {
+    if (!insert_unit(local_seen, norm_buf, norm_len, hash, fingerprint, 0,
+                     nullptr, &local_inserted)) {
       return false;
     }
     if (!local_inserted) {
       (*out_duplicates)++;
-      if (duplicates_fp) {
-        if (duplicates_lock)
-          mtx_lock(duplicates_lock);
-        bool ok = fwrite(norm_buf, 1, norm_len, duplicates_fp) == norm_len &&
-                  fputc('\n', duplicates_fp) != EOF;
-        if (duplicates_lock)
-          mtx_unlock(duplicates_lock);
-        if (!ok)
-          return false;
-      }
-      return true;
+      return write_duplicate(duplicates_fp, duplicates_lock, scratch,
+                             norm_buf, norm_len, data, tag);
     }
   }
 
   bool inserted = false;
-  bool inserted_ok =
-      sentence_set_insert_hashed(seen, hash, norm_buf, norm_len, &inserted);
-  if (!inserted_ok) {
+  uint64_t first_tag = 0;
+  if (!(maybe_seen &&
+        in_base_index(base, seen, norm_buf, norm_len, hash, fingerprint)) &&
+      !insert_unit(seen, norm_buf, norm_len, hash, fingerprint, tag,
+                   &first_tag, &inserted)) {
     return false;
   }
+  if (bloom && maybe_seen && inserted)
+    scratch->bloom_false_positives++;
 
   if (inserted) {
     (*out_unique)++;
@@ -351,23 +717,38 @@ static bool emit_unit(const char8_t *data, size_t len, SentenceSet *seen,
     *out_pos += norm_len;
   } else {
     (*out_duplicates)++;
-    if (duplicates_fp) {
-      if (duplicates_lock)
-        mtx_lock(duplicates_lock);
-      bool ok = fwrite(norm_buf, 1, norm_len, duplicates_fp) == norm_len &&
-                fputc('\n', duplicates_fp) != EOF;
-      if (duplicates_lock)
-        mtx_unlock(duplicates_lock);
-      if (!ok)
-        return false;
-    }
+    return write_duplicate(duplicates_fp, duplicates_lock, scratch, norm_buf,
+                           norm_len, data, first_tag);
   }
   return true;
 }
 
+static bool emit_unit(const char8_t *data, size_t len, SentenceSet *seen,
+                      const DedupIndex *base, SentenceSet *local_seen,
+                      BloomFilter *bloom, DedupScratch *scratch,
+                      size_t *out_pos, size_t *out_unique,
+                      size_t *out_duplicates, FILE *duplicates_fp,
+                      mtx_t *duplicates_lock, size_t max_compare_len) {
+  char8_t *norm_buf = scratch->norm_buffer;
+  size_t norm_cap = scratch->norm_cap;
+  // Normalizing into at most max_compare_len bytes truncates the unit; the
+  // key is hashed in the same pass.
+  if (max_compare_len != 0 && norm_cap > max_compare_len)
+    norm_cap = max_compare_len;
+  Hash128 key = {0};
+  size_t norm_len =
+      normalize_sentence_hashed(data, len, norm_buf, norm_cap, &key);
+  if (norm_len == 0)
+    return true;
+  return admit_unit(data, norm_buf, norm_len, key, seen, base, local_seen,
+                    bloom, scratch, out_pos, out_unique, out_duplicates,
+                    duplicates_fp, duplicates_lock);
+}
+
 static bool deduplicate_spans(const char8_t *input, size_t input_len,
                               const SentenceSpan *spans, size_t span_count,
                               SentenceSet *local_seen, SentenceSet *seen,
+                              const DedupIndex *base, BloomFilter *bloom,
                               DedupScratch *scratch, size_t max_compare_len,
                               char8_t **out, size_t *out_len,
                               size_t *out_unique, size_t *out_duplicates,
@@ -393,9 +774,8 @@ static bool deduplicate_spans(const char8_t *input, size_t input_len,
   for (size_t i = 0; i < span_count; ++i) {
     const char8_t *segment = spans[i].start;
     size_t segment_len = spans[i].len;
-    if (!emit_unit(segment, segment_len, seen, local_seen, scratch->norm_buffer,
-                   scratch->norm_cap, scratch->dedup_buffer, &out_pos,
-                   scratch->dedup_cap, out_unique, out_duplicates,
+    if (!emit_unit(segment, segment_len, seen, base, local_seen, bloom,
+                   scratch, &out_pos, out_unique, out_duplicates,
                    duplicates_fp, duplicates_lock, max_compare_len)) {
       return false;
     }
@@ -409,101 +789,435 @@ static bool deduplicate_spans(const char8_t *input, size_t input_len,
   return true;
 }
 
-static bool deduplicate_sentences(const char8_t *input, size_t len,
-                                  SentenceSet *local_seen, SentenceSet *seen,
-                                  DedupScratch *scratch, char8_t **out,
-                                  size_t *out_len, size_t *out_unique,
-                                  size_t *out_duplicates, FILE *duplicates_fp,
-                                  mtx_t *duplicates_lock,
-                                  size_t max_compare_len) {
-  SentenceList sentences = split_text_to_sentences(input, len);
-  bool ok = deduplicate_spans(input, len, sentences.sentences, sentences.count,
-                              local_seen, seen, scratch, max_compare_len, out,
-                              out_len, out_unique, out_duplicates,
-                              duplicates_fp, duplicates_lock);
-  free_sentence_list(&sentences);
-  return ok;
+// Split input into dedup units for the selected mode. Spans point into input.
+static bool split_units(DedupMode mode, const char8_t *input, size_t len,
+                        SpanList *out) {
+  switch (mode) {
+  case DEDUP_MODE_DOCUMENT:
+  case DEDUP_MODE_NEAR_DOCUMENT:
+  case DEDUP_MODE_SUBSTRING:
+    *out = (SpanList){0};
+    return append_span(out, input, len);
+  case DEDUP_MODE_LINE:
+    return split_text_to_lines(input, len, out);
+  case DEDUP_MODE_PARAGRAPH:
+    return split_text_to_paragraphs(input, len, out);
+  case DEDUP_MODE_SENTENCE:
+  default: {
+    SentenceList sentences = split_text_to_sentences(input, len);
+    *out = (SpanList){.items = sentences.sentences,
+                      .count = sentences.count,
+                      .capacity = sentences.capacity};
+    return true;
+  }
+  }
 }
 
-static bool deduplicate_paragraphs(const char8_t *input, size_t len,
-                                   SentenceSet *local_seen, SentenceSet *seen,
-                                   DedupScratch *scratch, char8_t **out,
-                                   size_t *out_len, size_t *out_unique,
-                                   size_t *out_duplicates, FILE *duplicates_fp,
-                                   mtx_t *duplicates_lock,
-                                   size_t max_compare_len) {
-  SpanList paragraphs = {0};
-  if (!split_text_to_paragraphs(input, len, &paragraphs)) {
+// Near-duplicate document check: the normalized document is a duplicate when
+// any of its LSH band keys is already in the index. All new bands are
+// inserted either way, so a document's near-duplicates also match each other.
+static bool deduplicate_near_document(
+    const char8_t *input, size_t len, size_t max_compare_len,
+    const MinHasher *minhash, SentenceSet *seen, const DedupIndex *base,
+    DedupScratch *scratch,
+    char8_t **out, size_t *out_len, size_t *out_unique, size_t *out_duplicates,
+    FILE *duplicates_fp, mtx_t *duplicates_lock) {
+  *out = nullptr;
+  *out_len = 0;
+  *out_unique = 0;
+  *out_duplicates = 0;
+  if (!input || len == 0)
+    return true;
+  if (!ensure_scratch(scratch, len) ||
+      !ensure_signature(scratch, minhash->permutations)) {
     return false;
   }
 
-  bool ok = deduplicate_spans(input, len, paragraphs.items, paragraphs.count,
-                              local_seen, seen, scratch, max_compare_len, out,
-                              out_len, out_unique, out_duplicates,
-                              duplicates_fp, duplicates_lock);
-  free_span_list(&paragraphs);
-  return ok;
+  size_t norm_len =
+      normalize_sentence(input, len, scratch->norm_buffer, scratch->norm_cap);
+  if (max_compare_len != 0 && norm_len > max_compare_len)
+    norm_len = max_compare_len;
+  if (norm_len == 0)
+    return true;
+
+  minhash_signature(minhash, scratch->norm_buffer, norm_len,
+                    scratch->signature);
+  uint64_t tag = (uint64_t)(uintptr_t)scratch->dup_source;
+  bool duplicate = false;
+  uint64_t first_tag = 0; // input of the first band found, 0 for the base
+  for (size_t band = 0; band < minhash->bands; ++band) {
+    Hash128 key = minhash_band_key(minhash, scratch->signature, band);
+    bool inserted = false;
+    if (base && dedup_index_contains_fingerprint(base, key)) {
+      duplicate = true;
+      continue;
+    }
+    uint64_t band_tag = 0;
+    if (!insert_unit(seen, nullptr, 0, 0, key, tag, &band_tag, &inserted))
+      return false;
+    if (!inserted && !duplicate)
+      first_tag = band_tag;
+    duplicate |= !inserted;
+  }
+
+  if (duplicate) {
+    *out_duplicates = 1;
+    return write_duplicate(duplicates_fp, duplicates_lock, scratch,
+                           scratch->norm_buffer, norm_len, input, first_tag);
+  }
+  *out_unique = 1;
+  memcpy(scratch->dedup_buffer, scratch->norm_buffer, norm_len);
+  *out = scratch->dedup_buffer;
+  *out_len = norm_len;
+  return true;
+}
+
+static size_t parse_thread_env() {
+  constexpr char ENV_NAME[] = "DEDUP_THREADS";
+  const char *env = getenv(ENV_NAME);
+  if (!env || !*env)
+    return 0;
+  char *end = nullptr;
+  long val = strtol(env, &end, 10);
+  if (end == env || val <= 0 || val > 1024)
+    return 0;
+  return (size_t)val;
+}
+
+static size_t detect_thread_count() {
+  static size_t cached = 0;
+  if (cached != 0)
+    return cached;
+  size_t env_threads = parse_thread_env();
+  if (env_threads > 0) {
+    cached = env_threads;
+    return cached;
+  }
+#if defined(_SC_NPROCESSORS_ONLN)
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  if (n > 0) {
+    cached = (size_t)n;
+    return cached;
+  }
+#endif
+  cached = THREAD_COUNT_FALLBACK;
+  if (cached == 0)
+    cached = 1;
+  return cached;
+}
+
+// A unit of a large document, normalized and keyed by a split helper.
+typedef struct {
+  const char8_t *data; // the unit in the document
+  size_t offset;       // into DocumentChunk.norm
+  size_t len;
+  Hash128 key;
+} ChunkUnit;
+
+// Ring slot holding one chunk's units until the owning worker admits them.
+typedef struct {
+  char8_t *norm;
+  size_t norm_cap;
+  ChunkUnit *units;
+  size_t unit_count;
+  size_t unit_cap;
+  size_t ready; // index + 1 of the chunk in place, 0 before the first
+} DocumentChunk;
+
+// A sentence-mode document of at least SPLIT_DOCUMENT_MIN_BYTES, cut at
+// find_sentence_cut positions into chunks that helper threads split,
+// normalize and key ahead of the worker that owns the document. The worker
+// admits the units in document order, so the output, the duplicates and
+// the index are those of the serial path.
+typedef struct {
+  const char8_t *text;
+  size_t *cuts; // chunk i is text[cuts[i], cuts[i + 1])
+  size_t chunk_count;
+  size_t max_compare_len;
+  DocumentChunk *slots; // chunk i goes to slots[i % slot_count]
+  size_t slot_count;
+  size_t next_chunk; // the next one a helper takes
+  size_t admitted;   // chunks the worker is done with
+  bool failed;
+  mtx_t lock;
+  cnd_t chunk_ready;
+  cnd_t slot_free;
+  thrd_t *helpers;
+  size_t helper_count;
+  size_t helpers_taken; // from split_helpers_busy, returned by split_stop
+} DocumentSplit;
+
+// Helpers running for all splits at once. Workers that split documents at
+// the same time share detect_thread_count() helpers, so helper threads and
+// their chunk slots stay linear in the thread count.
+static atomic_size_t split_helpers_busy;
+
+// Take up to wanted helpers from the shared cap; 0 when none is free.
+static size_t split_take_helpers(size_t wanted) {
+  size_t cap = detect_thread_count();
+  size_t busy = atomic_load_explicit(&split_helpers_busy, memory_order_relaxed);
+  size_t take = 0;
+  do {
+    take = busy < cap ? cap - busy : 0;
+    if (take > wanted)
+      take = wanted;
+    if (take == 0)
+      return 0;
+  } while (!atomic_compare_exchange_weak_explicit(
+      &split_helpers_busy, &busy, busy + take, memory_order_relaxed,
+      memory_order_relaxed));
+  return take;
+}
+
+// Split, normalize and key one chunk into its slot.
+static bool split_chunk(const DocumentSplit *split, size_t index,
+                        DocumentChunk *chunk) {
+  const char8_t *start = split->text + split->cuts[index];
+  size_t len = split->cuts[index + 1] - split->cuts[index];
+  SpanList spans = {0};
+  size_t bound = 0;
+  if (!split_units(DEDUP_MODE_SENTENCE, start, len, &spans) ||
+      !normalize_bound(len, &bound) ||
+      !ensure_bytes(&chunk->norm, &chunk->norm_cap, bound)) {
+    free_span_list(&spans);
+    return false;
+  }
+  if (chunk->unit_cap < spans.count) {
+    auto units =
+        (ChunkUnit *)realloc(chunk->units, spans.count * sizeof(ChunkUnit));
+    if (!units) {
+      free_span_list(&spans);
+      return false;
+    }
+    chunk->units = units;
+    chunk->unit_cap = spans.count;
+  }
+
+  // As in the ordered claim pass, the units fit in the bound of the chunk
+  // and are truncated to max_compare_len the way emit_unit does.
+  size_t norm_pos = 0;
+  chunk->unit_count = 0;
+  for (size_t i = 0; i < spans.count; ++i) {
+    size_t norm_cap = bound - norm_pos;
+    if (split->max_compare_len != 0 && norm_cap > split->max_compare_len)
+      norm_cap = split->max_compare_len;
+    Hash128 key = {0};
+    size_t norm_len =
+        normalize_sentence_hashed(spans.items[i].start, spans.items[i].len,
+                                  chunk->norm + norm_pos, norm_cap, &key);
+    if (norm_len == 0)
+      continue;
+    chunk->units[chunk->unit_count++] = (ChunkUnit){
+        .data = spans.items[i].start,
+        .offset = norm_pos,
+        .len = norm_len,
+        .key = key};
+    norm_pos += norm_len;
+  }
+  free_span_list(&spans);
+  return true;
+}
+
+// Helper thread: take chunks in order while their slot is free.
+static int split_helper(void *arg) {
+  auto split = (DocumentSplit *)arg;
+  mtx_lock(&split->lock);
+  for (;;) {
+    while (!split->failed && split->next_chunk < split->chunk_count &&
+           split->next_chunk >= split->admitted + split->slot_count) {
+      cnd_wait(&split->slot_free, &split->lock);
+    }
+    if (split->failed || split->next_chunk >= split->chunk_count)
+      break;
+    size_t index = split->next_chunk++;
+    DocumentChunk *chunk = &split->slots[index % split->slot_count];
+    mtx_unlock(&split->lock);
+    bool ok = split_chunk(split, index, chunk);
+    mtx_lock(&split->lock);
+    if (ok)
+      chunk->ready = index + 1;
+    else
+      split->failed = true;
+    cnd_broadcast(&split->chunk_ready);
+  }
+  mtx_unlock(&split->lock);
+  return 0;
+}
+
+static void split_stop(DocumentSplit *split) {
+  if (split->helper_count > 0) {
+    mtx_lock(&split->lock);
+    split->failed = true;
+    cnd_broadcast(&split->slot_free);
+    mtx_unlock(&split->lock);
+    for (size_t i = 0; i < split->helper_count; ++i) {
+      thrd_join(split->helpers[i], nullptr);
+    }
+    cnd_destroy(&split->slot_free);
+    cnd_destroy(&split->chunk_ready);
+    mtx_destroy(&split->lock);
+  }
+  for (size_t i = 0; split->slots && i < split->slot_count; ++i) {
+    free(split->slots[i].norm);
+    free(split->slots[i].units);
+  }
+  free(split->slots);
+  free(split->helpers);
+  free(split->cuts);
+  atomic_fetch_sub_explicit(&split_helpers_busy, split->helpers_taken,
+                            memory_order_relaxed);
+  *split = (DocumentSplit){0};
+}
+
+// Cut the document and start its helpers; false (with nothing left to
+// stop) when it stays on the serial path: too small, a single chunk, one
+// thread, no free helper under the shared cap, or none could be started.
+static bool split_start(DocumentSplit *split, const char8_t *text,
+                        size_t len, size_t max_compare_len) {
+  *split = (DocumentSplit){.text = text, .max_compare_len = max_compare_len};
+  size_t threads = detect_thread_count();
+  if (len < SPLIT_DOCUMENT_MIN_BYTES || threads < 2)
+    return false;
+
+  // Every chunk but the last spans at least SPLIT_DOCUMENT_CHUNK bytes.
+  size_t max_chunks = len / SPLIT_DOCUMENT_CHUNK + 1;
+  split->cuts = (size_t *)malloc((max_chunks + 1) * sizeof(size_t));
+  if (!split->cuts)
+    return false;
+  split->cuts[0] = 0;
+  size_t count = 0;
+  for (size_t from = SPLIT_DOCUMENT_CHUNK; from < len;) {
+    size_t cut = find_sentence_cut(text, len, from);
+    if (cut >= len)
+      break;
+    split->cuts[++count] = cut;
+    from = cut + SPLIT_DOCUMENT_CHUNK;
+  }
+  split->cuts[++count] = len;
+  split->chunk_count = count;
+
+  // One thread stays with the owning worker, which admits the units.
+  size_t helpers = count < 2 ? 0
+                   : split_take_helpers(threads - 1 < count ? threads - 1
+                                                            : count);
+  split->helpers_taken = helpers;
+  split->slot_count = 2 * helpers;
+  split->slots = helpers ? (DocumentChunk *)calloc(split->slot_count,
+                                                   sizeof(DocumentChunk))
+                         : nullptr;
+  split->helpers = helpers ? (thrd_t *)calloc(helpers, sizeof(thrd_t))
+                           : nullptr;
+  if (helpers == 0 || !split->slots || !split->helpers ||
+      mtx_init(&split->lock, mtx_plain) != thrd_success) {
+    split_stop(split);
+    return false;
+  }
+  if (cnd_init(&split->chunk_ready) != thrd_success) {
+    mtx_destroy(&split->lock);
+    split_stop(split);
+    return false;
+  }
+  if (cnd_init(&split->slot_free) != thrd_success) {
+    cnd_destroy(&split->chunk_ready);
+    mtx_destroy(&split->lock);
+    split_stop(split);
+    return false;
+  }
+  for (; split->helper_count < helpers; ++split->helper_count) {
+    if (thrd_create(&split->helpers[split->helper_count], split_helper,
+                    split) != thrd_success)
+      break;
+  }
+  if (split->helper_count == 0) {
+    cnd_destroy(&split->slot_free);
+    cnd_destroy(&split->chunk_ready);
+    mtx_destroy(&split->lock);
+    split_stop(split);
+    return false;
+  }
+  return true;
 }
 
-static bool deduplicate_lines(const char8_t *input, size_t len,
+// deduplicate_spans over a started split: admit each chunk's units as soon
+// as a helper has them in place.
+static bool deduplicate_split(DocumentSplit *split, size_t input_len,
                               SentenceSet *local_seen, SentenceSet *seen,
+                              const DedupIndex *base, BloomFilter *bloom,
                               DedupScratch *scratch, char8_t **out,
                               size_t *out_len, size_t *out_unique,
                               size_t *out_duplicates, FILE *duplicates_fp,
-                              mtx_t *duplicates_lock, size_t max_compare_len) {
-  SpanList lines = {0};
-  if (!split_text_to_lines(input, len, &lines)) {
+                              mtx_t *duplicates_lock) {
+  *out = nullptr;
+  *out_len = 0;
+  *out_unique = 0;
+  *out_duplicates = 0;
+  if (!ensure_scratch(scratch, input_len))
     return false;
-  }
-
-  bool ok =
-      deduplicate_spans(input, len, lines.items, lines.count, local_seen, seen,
-                        scratch, max_compare_len, out, out_len, out_unique,
-                        out_duplicates, duplicates_fp, duplicates_lock);
-  free_span_list(&lines);
-  return ok;
-}
 
-static bool deduplicate_document(const char8_t *input, size_t len,
-                                 SentenceSet *local_seen, SentenceSet *seen,
-                                 DedupScratch *scratch, char8_t **out,
-                                 size_t *out_len, size_t *out_unique,
-                                 size_t *out_duplicates, FILE *duplicates_fp,
-                                 mtx_t *duplicates_lock,
-                                 size_t max_compare_len) {
-  SentenceSpan single = {.start = input, .len = len};
-  size_t span_count = input && len > 0 ? 1 : 0;
-  return deduplicate_spans(input, len, &single, span_count, local_seen, seen,
-                           scratch, max_compare_len, out, out_len, out_unique,
-                           out_duplicates, duplicates_fp, duplicates_lock);
+  size_t out_pos = 0;
+  bool ok = true;
+  for (size_t i = 0; ok && i < split->chunk_count; ++i) {
+    DocumentChunk *chunk = &split->slots[i % split->slot_count];
+    mtx_lock(&split->lock);
+    while (!split->failed && chunk->ready != i + 1) {
+      cnd_wait(&split->chunk_ready, &split->lock);
+    }
+    ok = chunk->ready == i + 1;
+    mtx_unlock(&split->lock);
+    for (size_t k = 0; ok && k < chunk->unit_count; ++k) {
+      const ChunkUnit *unit = &chunk->units[k];
+      ok = admit_unit(unit->data, chunk->norm + unit->offset, unit->len,
+                      unit->key, seen, base, local_seen, bloom, scratch,
+                      &out_pos, out_unique, out_duplicates, duplicates_fp,
+                      duplicates_lock);
+    }
+    mtx_lock(&split->lock);
+    split->admitted = i + 1;
+    cnd_broadcast(&split->slot_free);
+    mtx_unlock(&split->lock);
+  }
+  if (!ok || out_pos == 0)
+    return ok;
+  *out = scratch->dedup_buffer;
+  *out_len = out_pos;
+  return true;
 }
 
 static bool deduplicate_with_mode(DedupMode mode, const char8_t *input,
                                   size_t len, size_t max_compare_len,
+                                  const MinHasher *minhash,
                                   SentenceSet *local_seen, SentenceSet *seen,
+                                  const DedupIndex *base, BloomFilter *bloom,
                                   DedupScratch *scratch, char8_t **out,
                                   size_t *out_len, size_t *out_unique,
                                   size_t *out_duplicates, FILE *duplicates_fp,
                                   mtx_t *duplicates_lock) {
-  switch (mode) {
-  case DEDUP_MODE_DOCUMENT:
-    return deduplicate_document(
-        input, len, local_seen, seen, scratch, out, out_len, out_unique,
-        out_duplicates, duplicates_fp, duplicates_lock, max_compare_len);
-  case DEDUP_MODE_LINE:
-    return deduplicate_lines(input, len, local_seen, seen, scratch, out,
-                             out_len, out_unique, out_duplicates, duplicates_fp,
-                             duplicates_lock, max_compare_len);
-  case DEDUP_MODE_PARAGRAPH:
-    return deduplicate_paragraphs(
-        input, len, local_seen, seen, scratch, out, out_len, out_unique,
-        out_duplicates, duplicates_fp, duplicates_lock, max_compare_len);
-  case DEDUP_MODE_SENTENCE:
-  default:
-    return deduplicate_sentences(
-        input, len, local_seen, seen, scratch, out, out_len, out_unique,
-        out_duplicates, duplicates_fp, duplicates_lock, max_compare_len);
+  if (mode == DEDUP_MODE_NEAR_DOCUMENT) {
+    return deduplicate_near_document(input, len, max_compare_len, minhash,
+                                     seen, base, scratch, out, out_len,
+                                     out_unique, out_duplicates, duplicates_fp,
+                                     duplicates_lock);
+  }
+  DocumentSplit split;
+  if (mode == DEDUP_MODE_SENTENCE &&
+      split_start(&split, input, len, max_compare_len)) {
+    bool ok = deduplicate_split(&split, len, local_seen, seen, base, bloom,
+                                scratch, out, out_len, out_unique,
+                                out_duplicates, duplicates_fp,
+                                duplicates_lock);
+    split_stop(&split);
+    return ok;
   }
+  SpanList spans = {0};
+  if (!split_units(mode, input, len, &spans)) {
+    return false;
+  }
+  bool ok = deduplicate_spans(input, len, spans.items, spans.count, local_seen,
+                              seen, base, bloom, scratch, max_compare_len, out,
+                              out_len, out_unique, out_duplicates,
+                              duplicates_fp, duplicates_lock);
+  free_span_list(&spans);
+  return ok;
 }
 
 static bool process_text(const char *label, const char8_t *raw_text,
@@ -555,49 +1269,15 @@ static bool process_text(const char *label, const char8_t *raw_text,
   return errors == 0;
 }
 
-static size_t parse_thread_env() {
-  constexpr char ENV_NAME[] = "DEDUP_THREADS";
-  const char *env = getenv(ENV_NAME);
-  if (!env || !*env)
-    return 0;
-  char *end = nullptr;
-  long val = strtol(env, &end, 10);
-  if (end == env || val <= 0 || val > 1024)
+static size_t peak_rss_bytes() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
     return 0;
-  return (size_t)val;
-}
-
-static size_t detect_thread_count() {
-  static size_t cached = 0;
-  if (cached != 0)
-    return cached;
-  size_t env_threads = parse_thread_env();
-  if (env_threads > 0) {
-    cached = env_threads;
-    return cached;
-  }
-#if defined(_SC_NPROCESSORS_ONLN)
-  long n = sysconf(_SC_NPROCESSORS_ONLN);
-  if (n > 0) {
-    cached = (size_t)n;
-    return cached;
-  }
-#endif
-  cached = THREAD_COUNT_FALLBACK;
-  if (cached == 0)
-    cached = 1;
-  return cached;
-}
-
-static size_t peak_rss_bytes() {
-  struct rusage usage;
-  if (getrusage(RUSAGE_SELF, &usage) != 0)
-    return 0;
-#if defined(__APPLE__)
-  return (size_t)usage.ru_maxrss;
-#else
-  return (size_t)usage.ru_maxrss * 1024u;
-#endif
+#if defined(__APPLE__)
+  return (size_t)usage.ru_maxrss;
+#else
+  return (size_t)usage.ru_maxrss * 1024u;
+#endif
 }
 
 typedef struct {
@@ -605,12 +1285,28 @@ typedef struct {
   size_t batch_count;
   const char *output_dir;
   SentenceSet *seen;
+  const DedupIndex *base_index; // loaded with --load-index, may be nullptr
+  BloomFilter *bloom;           // --bloom-filter prefilter, may be nullptr
   FILE *duplicates_fp;
   mtx_t *duplicates_lock;
   bool build_tree;
   DedupMode dedup_mode;
   size_t max_compare_len;
+  const MinHasher *minhash; // non-null in near-document mode
   atomic_size_t next_index;
+  OrderedFile *ordered;           // non-null in deterministic mode
+  size_t batch_base;              // global index of batch[0]
+  SpillBuffer *spill;             // external mode key pass
+  const UnitPosition *marks;      // sorted, see marked_emit_worker
+  size_t mark_count;              // entries in marks
+  bool marks_keep;                // marks are winners rather than losers
+  const PartitionSpec *partition; // --partition: keys this process owns
+  UnitPositionList *winners;      // --partition: owned winners so far
+  SubstringState *substring;      // substring mode passes
+  const char *text_field;         // --input-format jsonl: field to dedup
+  const OutputCompression *compression; // --output-compression
+  ShardSet *shards;                     // --output-format shards
+  bool io_uring;                        // --io-engine uring
   BatchStats *stats;
   size_t total_files;
   double start_time;
@@ -618,12 +1314,1039 @@ typedef struct {
   mtx_t *tree_lock;
 } WorkerContext;
 
-static int batch_worker(void *arg) {
+static void report_file_done(WorkerContext *ctx, size_t processed_bytes) {
+  if (processed_bytes > 0) {
+    atomic_fetch_add_explicit(&ctx->stats->bytes_processed, processed_bytes,
+                              memory_order_relaxed);
+  }
+  size_t processed =
+      atomic_fetch_add_explicit(&ctx->stats->processed, 1,
+                                memory_order_relaxed) +
+      1;
+  if (ctx->progress_lock) {
+    mtx_lock(ctx->progress_lock);
+    size_t current_bytes = atomic_load_explicit(&ctx->stats->bytes_processed,
+                                                memory_order_relaxed);
+    render_progress(processed, ctx->total_files, current_bytes,
+                    ctx->start_time);
+    mtx_unlock(ctx->progress_lock);
+  }
+}
+
+// Output path of name, with the suffix of the output compression.
+static char *output_path_for(const WorkerContext *ctx, const char *name) {
+  char *path = join_path(ctx->output_dir, name);
+  const char *suffix = compression_suffix(
+      ctx->compression ? ctx->compression->kind : COMPRESSION_NONE);
+  if (!path || suffix[0] == '\0')
+    return path;
+  size_t path_len = strlen(path);
+  size_t suffix_len = strlen(suffix);
+  auto with_suffix = (char *)realloc(path, path_len + suffix_len + 1);
+  if (!with_suffix) {
+    free(path);
+    return nullptr;
+  }
+  memcpy(with_suffix + path_len, suffix, suffix_len + 1);
+  return with_suffix;
+}
+
+static void add_output_bytes(WorkerContext *ctx, size_t raw_bytes,
+                             size_t stored_bytes) {
+  atomic_fetch_add_explicit(&ctx->stats->output_raw_bytes, raw_bytes,
+                            memory_order_relaxed);
+  atomic_fetch_add_explicit(&ctx->stats->output_stored_bytes, stored_bytes,
+                            memory_order_relaxed);
+}
+
+// Write one output document: a file of its own, compressed in the calling
+// worker, or an append to the worker's shard.
+static bool write_output(WorkerContext *ctx, DedupScratch *scratch,
+                         const char *name, const char8_t *text, size_t len) {
+  if (ctx->shards) {
+    if (!scratch->shard)
+      scratch->shard = shard_set_acquire(ctx->shards);
+    if (!scratch->shard ||
+        !shard_slot_append(ctx->shards, scratch->shard, name, text, len)) {
+      return false;
+    }
+    add_output_bytes(ctx, len, len);
+    return true;
+  }
+  char *output_path = output_path_for(ctx, name);
+  if (!output_path) {
+    fprintf(stderr, "Failed to allocate output path for: %s\n", name);
+    return false;
+  }
+  size_t raw_bytes = 0;
+  size_t stored_bytes = 0;
+  bool ok = write_output_file(output_path, ctx->compression, text, len,
+                              &raw_bytes, &stored_bytes);
+  if (ok)
+    add_output_bytes(ctx, raw_bytes, stored_bytes);
+  free(output_path);
+  return ok;
+}
+
+static void release_shard(WorkerContext *ctx, DedupScratch *scratch) {
+  if (ctx->shards)
+    shard_set_release(ctx->shards, scratch->shard);
+  scratch->shard = nullptr;
+}
+
+static void flush_bloom_tallies(WorkerContext *ctx, DedupScratch *scratch) {
+  atomic_fetch_add_explicit(&ctx->stats->bloom_new, scratch->bloom_new,
+                            memory_order_relaxed);
+  atomic_fetch_add_explicit(&ctx->stats->bloom_maybe, scratch->bloom_maybe,
+                            memory_order_relaxed);
+  atomic_fetch_add_explicit(&ctx->stats->bloom_false_positives,
+                            scratch->bloom_false_positives,
+                            memory_order_relaxed);
+}
+
+// Write out what is left of the worker's duplicates log.
+static void finish_duplicates(WorkerContext *ctx, DedupScratch *scratch) {
+  if (ctx->duplicates_fp &&
+      !flush_duplicates(ctx->duplicates_fp, ctx->duplicates_lock, scratch)) {
+    fprintf(stderr, "Failed to write duplicates file.\n");
+    atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+  }
+}
+
+// Dedup the open item->text; *deduped_len is 0 when nothing is
+// left to write. Failures are counted as errors.
+static bool dedup_item(WorkerContext *ctx, DedupScratch *scratch,
+                       SentenceSet *local_seen, const FileItem *item,
+                       char8_t **deduped, size_t *deduped_len) {
+  sentence_set_reserve_for_bytes(ctx->seen, item->byte_len);
+
+  size_t file_unique = 0;
+  size_t file_duplicates = 0;
+  *deduped = nullptr;
+  *deduped_len = 0;
+  // A tagged index means --duplicates-metadata.
+  if (ctx->seen->tagged) {
+    scratch->dup_source = item->name;
+    scratch->dup_text = item->text.data;
+  }
+  if (!deduplicate_with_mode(
+          ctx->dedup_mode, item->text.data, item->byte_len,
+          ctx->max_compare_len, ctx->minhash, local_seen, ctx->seen,
+          ctx->base_index, ctx->bloom, scratch, deduped, deduped_len,
+          &file_unique, &file_duplicates, ctx->duplicates_fp,
+          ctx->duplicates_lock)) {
+    fprintf(stderr, "Failed to deduplicate content for: %s\n", item->name);
+    atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+    return false;
+  }
+
+  atomic_fetch_add_explicit(&ctx->stats->unique_units, file_unique,
+                            memory_order_relaxed);
+  atomic_fetch_add_explicit(&ctx->stats->duplicate_units, file_duplicates,
+                            memory_order_relaxed);
+  if (*deduped_len == 0) {
+    atomic_fetch_add_explicit(&ctx->stats->files_empty, 1,
+                              memory_order_relaxed);
+  }
+  return true;
+}
+
+// Count a written output and feed it to the block tree.
+static void output_written(WorkerContext *ctx, const FileItem *item,
+                           const char8_t *text, size_t len) {
+  atomic_fetch_add_explicit(&ctx->stats->files_written, 1,
+                            memory_order_relaxed);
+
+  if (ctx->build_tree) {
+    if (ctx->tree_lock)
+      mtx_lock(ctx->tree_lock);
+    bool ok = process_text(item->name, text, len, false);
+    if (ctx->tree_lock)
+      mtx_unlock(ctx->tree_lock);
+    if (!ok) {
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+    }
+  }
+}
+
+// --io-engine uring: read a chunk of files in one go, dedup them in order
+// and write their plain outputs together. Each output is copied out of the
+// scratch buffers, which the next file reuses, until the chunk is written.
+static void process_chunk_uring(WorkerContext *ctx, UringIo *io,
+                                DedupScratch *scratch,
+                                SentenceSet *local_seen, FileItem *items,
+                                size_t count, char8_t **outputs,
+                                size_t *outputs_cap) {
+  UringFile reads[URING_IO_BATCH];
+  UringFile writes[URING_IO_BATCH];
+  const FileItem *written[URING_IO_BATCH];
+  size_t offsets[URING_IO_BATCH];
+  size_t write_count = 0;
+  size_t outputs_len = 0;
+  bool direct = !ctx->shards && (!ctx->compression ||
+                                 ctx->compression->kind == COMPRESSION_NONE);
+
+  for (size_t i = 0; i < count; ++i) {
+    reads[i] = (UringFile){.path = items[i].input_path};
+  }
+  uring_io_read(io, reads, count);
+
+  for (size_t i = 0; i < count; ++i) {
+    FileItem *item = &items[i];
+    item->text = (FileView){.data = reads[i].data, .len = reads[i].len};
+    item->byte_len = reads[i].len;
+    if (!reads[i].ok) {
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+      continue;
+    }
+
+    char8_t *deduped = nullptr;
+    size_t deduped_len = 0;
+    if (dedup_item(ctx, scratch, local_seen, item, &deduped, &deduped_len) &&
+        deduped_len > 0) {
+      char *output_path = direct ? output_path_for(ctx, item->name) : nullptr;
+      size_t outputs_end = 0;
+      if (!direct) {
+        if (write_output(ctx, scratch, item->name, deduped, deduped_len)) {
+          output_written(ctx, item, deduped, deduped_len);
+        } else {
+          atomic_fetch_add_explicit(&ctx->stats->errors, 1,
+                                    memory_order_relaxed);
+        }
+      } else if (!output_path ||
+                 ckd_add(&outputs_end, outputs_len, deduped_len) ||
+                 !ensure_bytes(outputs, outputs_cap, outputs_end)) {
+        fprintf(stderr, "Failed to allocate output for: %s\n", item->name);
+        free(output_path);
+        atomic_fetch_add_explicit(&ctx->stats->errors, 1,
+                                  memory_order_relaxed);
+      } else {
+        memcpy(*outputs + outputs_len, deduped, deduped_len);
+        writes[write_count] =
+            (UringFile){.path = output_path, .len = deduped_len};
+        offsets[write_count] = outputs_len;
+        written[write_count++] = item;
+        outputs_len = outputs_end;
+      }
+    }
+
+    file_view_close(&item->text);
+    if (local_seen) {
+      sentence_set_clear(local_seen);
+    }
+  }
+
+  // The buffer may have moved while it grew.
+  for (size_t i = 0; i < write_count; ++i) {
+    writes[i].data = *outputs + offsets[i];
+  }
+  uring_io_write(io, writes, write_count);
+  for (size_t i = 0; i < write_count; ++i) {
+    if (writes[i].ok) {
+      add_output_bytes(ctx, writes[i].len, writes[i].len);
+      output_written(ctx, written[i], writes[i].data, writes[i].len);
+    } else {
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+    }
+    free((char *)writes[i].path);
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    report_file_done(ctx, reads[i].ok ? reads[i].len : 0);
+  }
+}
+
+static int batch_worker(void *arg) {
+  auto ctx = (WorkerContext *)arg;
+  DedupScratch scratch = {0};
+  SentenceSet local_seen = {0};
+  bool local_seen_init = false;
+  if (!ctx->minhash) {
+    local_seen_init = ctx->seen->fingerprint_only
+                          ? sentence_set_init_fingerprint(&local_seen, 512)
+                          : sentence_set_init(&local_seen, 512);
+  }
+  SentenceSet *local = local_seen_init ? &local_seen : nullptr;
+  // A ring that cannot be set up leaves this worker on the synchronous path.
+  UringIo *io = ctx->io_uring ? uring_io_create() : nullptr;
+  char8_t *outputs = nullptr;
+  size_t outputs_cap = 0;
+
+  for (;;) {
+    if (io) {
+      size_t first = atomic_fetch_add_explicit(
+          &ctx->next_index, URING_IO_BATCH, memory_order_relaxed);
+      if (first >= ctx->batch_count)
+        break;
+      size_t count = ctx->batch_count - first;
+      if (count > URING_IO_BATCH)
+        count = URING_IO_BATCH;
+      process_chunk_uring(ctx, io, &scratch, local, ctx->batch + first,
+                          count, &outputs, &outputs_cap);
+      continue;
+    }
+
+    size_t idx =
+        atomic_fetch_add_explicit(&ctx->next_index, 1, memory_order_relaxed);
+    if (idx >= ctx->batch_count)
+      break;
+
+    FileItem *item = &ctx->batch[idx];
+    size_t processed_bytes = 0;
+
+    item->byte_len = 0;
+    if (!file_view_open(item->input_path, &item->text)) {
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+    } else {
+      item->byte_len = item->text.len;
+      processed_bytes = item->byte_len;
+      char8_t *deduped = nullptr;
+      size_t deduped_len = 0;
+      if (dedup_item(ctx, &scratch, local, item, &deduped, &deduped_len) &&
+          deduped_len > 0) {
+        if (write_output(ctx, &scratch, item->name, deduped, deduped_len)) {
+          output_written(ctx, item, deduped, deduped_len);
+        } else {
+          atomic_fetch_add_explicit(&ctx->stats->errors, 1,
+                                    memory_order_relaxed);
+        }
+      }
+      file_view_close(&item->text);
+    }
+
+    if (local_seen_init) {
+      sentence_set_clear(&local_seen);
+    }
+    report_file_done(ctx, processed_bytes);
+  }
+
+  uring_io_destroy(io);
+  free(outputs);
+  flush_bloom_tallies(ctx, &scratch);
+  finish_duplicates(ctx, &scratch);
+  release_shard(ctx, &scratch);
+  free_scratch(&scratch);
+  if (local_seen_init) {
+    sentence_set_destroy(&local_seen);
+  }
+  return 0;
+}
+
+static void free_file_item(FileItem *item) { file_view_close(&item->text); }
+
+// Write a record with [value_start, value_end) replaced by value.
+static bool write_record(OutputWriter *out, const char *line, size_t len,
+                         size_t value_start, size_t value_end,
+                         const char *value, size_t value_len) {
+  return output_writer_write(out, line, value_start) &&
+         output_writer_write(out, value, value_len) &&
+         output_writer_write(out, line + value_end, len - value_end) &&
+         output_writer_write(out, "\n", 1);
+}
+
+// --input-format jsonl: stream each shard record by record, dedup the text
+// field and write the record back with its other fields untouched. Records
+// whose text dedups away are dropped; records without a string text field
+// pass through unchanged.
+static int jsonl_worker(void *arg) {
+  auto ctx = (WorkerContext *)arg;
+  DedupScratch scratch = {0};
+  SentenceSet local_seen = {0};
+  bool local_seen_init = false;
+  if (!ctx->minhash) {
+    local_seen_init = ctx->seen->fingerprint_only
+                          ? sentence_set_init_fingerprint(&local_seen, 512)
+                          : sentence_set_init(&local_seen, 512);
+  }
+  char8_t *text = nullptr;
+  size_t text_cap = 0;
+  char8_t *encoded = nullptr;
+  size_t encoded_cap = 0;
+
+  for (;;) {
+    size_t idx =
+        atomic_fetch_add_explicit(&ctx->next_index, 1, memory_order_relaxed);
+    if (idx >= ctx->batch_count)
+      break;
+
+    FileItem *item = &ctx->batch[idx];
+    JsonlReader reader;
+    if (!jsonl_reader_open(&reader, item->input_path)) {
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+      report_file_done(ctx, 0);
+      free_file_item(item);
+      continue;
+    }
+    char *output_path = output_path_for(ctx, item->name);
+    OutputWriter *out =
+        output_path ? output_writer_open(output_path, ctx->compression)
+                    : nullptr;
+    if (!out) {
+      if (!output_path) {
+        fprintf(stderr, "Failed to allocate output path for: %s\n",
+                item->name);
+      }
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+      jsonl_reader_close(&reader);
+      free(output_path);
+      report_file_done(ctx, 0);
+      free_file_item(item);
+      continue;
+    }
+    sentence_set_reserve_for_bytes(ctx->seen, reader.size);
+
+    size_t records = 0;
+    size_t written = 0;
+    size_t emptied = 0;
+    size_t passed = 0;
+    size_t malformed = 0;
+    size_t shard_unique = 0;
+    size_t shard_duplicates = 0;
+    size_t line_number = 0;
+    bool ok = true;
+    const char *line = nullptr;
+    size_t len = 0;
+    while (ok && jsonl_reader_next(&reader, &line, &len)) {
+      line_number++;
+      if (len == 0)
+        continue;
+      records++;
+      size_t value_start = 0;
+      size_t value_end = 0;
+      size_t text_len = 0;
+      JsonlFieldStatus status = jsonl_find_string_field(
+          line, len, ctx->text_field, &value_start, &value_end);
+      if (status == JSONL_FIELD_FOUND) {
+        ok = ensure_bytes(&text, &text_cap, value_end - value_start + 1);
+        if (ok && !jsonl_decode_string(line + value_start,
+                                       value_end - value_start, text,
+                                       &text_len)) {
+          status = JSONL_FIELD_MALFORMED;
+        }
+      }
+      if (ok && status != JSONL_FIELD_FOUND) {
+        passed += status == JSONL_FIELD_MISSING;
+        malformed += status == JSONL_FIELD_MALFORMED;
+        ok = write_record(out, line, len, len, len, "", 0);
+        continue;
+      }
+
+      char8_t *deduped = nullptr;
+      size_t deduped_len = 0;
+      size_t record_unique = 0;
+      size_t record_duplicates = 0;
+      if (ctx->seen->tagged) {
+        scratch.dup_source = item->name;
+        scratch.dup_text = text;
+        scratch.dup_record = line_number;
+      }
+      ok = ok && deduplicate_with_mode(
+                     ctx->dedup_mode, text, text_len, ctx->max_compare_len,
+                     ctx->minhash, local_seen_init ? &local_seen : nullptr,
+                     ctx->seen, ctx->base_index, ctx->bloom, &scratch,
+                     &deduped, &deduped_len, &record_unique,
+                     &record_duplicates, ctx->duplicates_fp,
+                     ctx->duplicates_lock);
+      if (local_seen_init)
+        sentence_set_clear(&local_seen);
+      shard_unique += record_unique;
+      shard_duplicates += record_duplicates;
+      if (!ok || deduped_len == 0) {
+        emptied += ok;
+        continue;
+      }
+
+      size_t encoded_needed = 0;
+      ok = !ckd_mul(&encoded_needed, deduped_len, (size_t)6) &&
+           ensure_bytes(&encoded, &encoded_cap, encoded_needed);
+      if (!ok)
+        break;
+      size_t encoded_len =
+          jsonl_encode_string(deduped, deduped_len, (char *)encoded);
+      ok = write_record(out, line, len, value_start, value_end,
+                        (const char *)encoded, encoded_len);
+      written++;
+      if (ok && ctx->build_tree) {
+        if (ctx->tree_lock)
+          mtx_lock(ctx->tree_lock);
+        bool tree_ok = process_text(item->name, deduped, deduped_len, false);
+        if (ctx->tree_lock)
+          mtx_unlock(ctx->tree_lock);
+        if (!tree_ok) {
+          atomic_fetch_add_explicit(&ctx->stats->errors, 1,
+                                    memory_order_relaxed);
+        }
+      }
+    }
+    ok = ok && !reader.failed;
+    size_t raw_bytes = 0;
+    size_t stored_bytes = 0;
+    if (!output_writer_close(out, &raw_bytes, &stored_bytes))
+      ok = false;
+    if (!ok) {
+      fprintf(stderr, "Failed to deduplicate shard: %s\n", item->name);
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+    } else if (written + passed + malformed == 0) {
+      remove(output_path);
+      atomic_fetch_add_explicit(&ctx->stats->files_empty, 1,
+                                memory_order_relaxed);
+    } else {
+      atomic_fetch_add_explicit(&ctx->stats->files_written, 1,
+                                memory_order_relaxed);
+      add_output_bytes(ctx, raw_bytes, stored_bytes);
+    }
+    atomic_fetch_add_explicit(&ctx->stats->unique_units, shard_unique,
+                              memory_order_relaxed);
+    atomic_fetch_add_explicit(&ctx->stats->duplicate_units, shard_duplicates,
+                              memory_order_relaxed);
+    atomic_fetch_add_explicit(&ctx->stats->records, records,
+                              memory_order_relaxed);
+    atomic_fetch_add_explicit(&ctx->stats->records_emptied, emptied,
+                              memory_order_relaxed);
+    atomic_fetch_add_explicit(&ctx->stats->records_passed, passed,
+                              memory_order_relaxed);
+    atomic_fetch_add_explicit(&ctx->stats->records_malformed, malformed,
+                              memory_order_relaxed);
+    report_file_done(ctx, reader.size);
+    jsonl_reader_close(&reader);
+    free(output_path);
+    free_file_item(item);
+  }
+
+  flush_bloom_tallies(ctx, &scratch);
+  finish_duplicates(ctx, &scratch);
+  free_scratch(&scratch);
+  free(text);
+  free(encoded);
+  if (local_seen_init) {
+    sentence_set_destroy(&local_seen);
+  }
+  return 0;
+}
+
+// Claim every LSH band of a near-document unit with the unit's order. Bands
+// found in the base index mark the unit as a duplicate and are not claimed.
+static bool claim_bands(WorkerContext *ctx, OrderedFile *file,
+                        DedupScratch *scratch, const char8_t *norm,
+                        size_t norm_len, PendingUnit *unit) {
+  const MinHasher *minhash = ctx->minhash;
+  if (!ensure_signature(scratch, minhash->permutations))
+    return false;
+  file->band_keys = (Hash128 *)calloc(minhash->bands, sizeof(Hash128));
+  if (!file->band_keys)
+    return false;
+  minhash_signature(minhash, norm, norm_len, scratch->signature);
+  for (size_t band = 0; band < minhash->bands; ++band) {
+    file->band_keys[band] =
+        minhash_band_key(minhash, scratch->signature, band);
+    if (ctx->base_index &&
+        dedup_index_contains_fingerprint(ctx->base_index,
+                                         file->band_keys[band])) {
+      unit->in_base = true;
+      continue;
+    }
+    if (!sentence_set_claim_fingerprint(ctx->seen, file->band_keys[band],
+                                        unit->order)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Deterministic phase 1: read, split, normalize and hash every file of the
+// batch, claiming each unit with its (file, unit) order. The set keeps the
+// smallest order per key, so the winner does not depend on thread timing.
+static int ordered_claim_worker(void *arg) {
+  auto ctx = (WorkerContext *)arg;
+  DedupScratch scratch = {0};
+  for (;;) {
+    size_t idx =
+        atomic_fetch_add_explicit(&ctx->next_index, 1, memory_order_relaxed);
+    if (idx >= ctx->batch_count)
+      break;
+
+    FileItem *item = &ctx->batch[idx];
+    OrderedFile *file = &ctx->ordered[idx];
+    *file = (OrderedFile){.failed = true};
+    uint64_t file_order = (uint64_t)(ctx->batch_base + idx) << 32;
+
+    item->byte_len = 0;
+    if (!file_view_open(item->input_path, &item->text)) {
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+      report_file_done(ctx, 0);
+      continue;
+    }
+    item->byte_len = item->text.len;
+    sentence_set_reserve_for_bytes(ctx->seen, item->byte_len);
+
+    SpanList spans = {0};
+    bool ok = split_units(ctx->dedup_mode, item->text.data, item->byte_len,
+                          &spans) &&
+              spans.count <= UINT32_MAX;
+    size_t norm_bound = 0;
+    ok = ok && normalize_bound(item->byte_len, &norm_bound);
+    if (ok && spans.count > 0) {
+      file->norm_text = (char8_t *)malloc(norm_bound);
+      file->units = (PendingUnit *)calloc(spans.count, sizeof(PendingUnit));
+      ok = file->norm_text && file->units;
+    }
+
+    size_t norm_pos = 0;
+    for (size_t i = 0; ok && i < spans.count; ++i) {
+      // Normalized units never outgrow normalize_bound of their span, and
+      // spans are disjoint, so the whole file fits in norm_bound.
+      char8_t *norm = file->norm_text + norm_pos;
+      size_t norm_cap = norm_bound - norm_pos;
+      if (ctx->max_compare_len != 0 && norm_cap > ctx->max_compare_len)
+        norm_cap = ctx->max_compare_len;
+      Hash128 key = {0};
+      size_t norm_len = normalize_sentence_hashed(
+          spans.items[i].start, spans.items[i].len, norm, norm_cap, &key);
+      if (norm_len == 0)
+        continue;
+
+      PendingUnit *unit = &file->units[file->unit_count++];
+      *unit = (PendingUnit){.offset = norm_pos,
+                            .len = norm_len,
+                            .order = file_order | i};
+      norm_pos += norm_len;
+      if (ctx->minhash) {
+        ok = claim_bands(ctx, file, &scratch, norm, norm_len, unit);
+        continue;
+      }
+      if (ctx->seen->fingerprint_only) {
+        unit->fingerprint = key;
+      } else {
+        unit->hash = key.hi;
+      }
+      if (ctx->partition &&
+          !partition_owns(ctx->partition, ctx->seen->fingerprint_only
+                                              ? unit->fingerprint.hi
+                                              : unit->hash)) {
+        // Another partition decides this key.
+        file->unit_count--;
+        norm_pos -= norm_len;
+        continue;
+      }
+      bool maybe_seen = !ctx->bloom || bloom_check(ctx->bloom, &scratch,
+                                                   ctx->seen, unit->hash,
+                                                   unit->fingerprint);
+      unit->in_base =
+          maybe_seen && in_base_index(ctx->base_index, ctx->seen, norm,
+                                      norm_len, unit->hash, unit->fingerprint);
+      if (unit->in_base)
+        continue;
+      ok = ctx->seen->fingerprint_only
+               ? sentence_set_claim_fingerprint(ctx->seen, unit->fingerprint,
+                                                unit->order)
+               : sentence_set_claim_hashed(ctx->seen, unit->hash, norm,
+                                           norm_len, unit->order);
+    }
+    free_span_list(&spans);
+
+    if (!ok) {
+      fprintf(stderr, "Failed to deduplicate content for: %s\n", item->name);
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+      free(file->norm_text);
+      free(file->units);
+      free(file->band_keys);
+      *file = (OrderedFile){.failed = true};
+      report_file_done(ctx, item->byte_len);
+      free_file_item(item);
+      continue;
+    }
+    file->failed = false;
+    free_file_item(item);
+  }
+  flush_bloom_tallies(ctx, &scratch);
+  free_scratch(&scratch);
+  return 0;
+}
+
+static bool append_unit(char8_t **buf, size_t *len, const char8_t *data,
+                        size_t data_len) {
+  size_t needed = 0;
+  if (ckd_add(&needed, *len, data_len) || ckd_add(&needed, needed, (size_t)1))
+    return false;
+  auto next = (char8_t *)realloc(*buf, needed);
+  if (!next)
+    return false;
+  memcpy(next + *len, data, data_len);
+  next[needed - 1] = (char8_t)'\n';
+  *buf = next;
+  *len = needed;
+  return true;
+}
+
+// A unit owns its key when no earlier unit claimed it and no earlier run
+// saved it; near-document units must own every band.
+static bool unit_owned(WorkerContext *ctx, const OrderedFile *file,
+                       const PendingUnit *unit, bool *owned) {
+  uint64_t owner = 0;
+  if (unit->in_base) {
+    *owned = false;
+    return true;
+  }
+  if (ctx->minhash) {
+    *owned = true;
+    for (size_t band = 0; band < ctx->minhash->bands; ++band) {
+      if (!sentence_set_owner_fingerprint(ctx->seen, file->band_keys[band],
+                                          &owner)) {
+        return false;
+      }
+      *owned &= owner == unit->order;
+    }
+    return true;
+  }
+  bool found =
+      ctx->seen->fingerprint_only
+          ? sentence_set_owner_fingerprint(ctx->seen, unit->fingerprint,
+                                           &owner)
+          : sentence_set_owner_hashed(ctx->seen, unit->hash,
+                                      file->norm_text + unit->offset,
+                                      unit->len, &owner);
+  *owned = owner == unit->order;
+  return found;
+}
+
+// Write a file's surviving units (or count it as empty) and feed the block
+// tree; shared by the deterministic and external emit passes.
+static void write_ordered_output(WorkerContext *ctx, DedupScratch *scratch,
+                                 const FileItem *item, const char8_t *text,
+                                 size_t len) {
+  if (len == 0) {
+    atomic_fetch_add_explicit(&ctx->stats->files_empty, 1,
+                              memory_order_relaxed);
+    return;
+  }
+  if (!write_output(ctx, scratch, item->name, text, len)) {
+    atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+  } else {
+    atomic_fetch_add_explicit(&ctx->stats->files_written, 1,
+                              memory_order_relaxed);
+    if (ctx->build_tree) {
+      if (ctx->tree_lock)
+        mtx_lock(ctx->tree_lock);
+      bool tree_ok = process_text(item->name, text, len, false);
+      if (ctx->tree_lock)
+        mtx_unlock(ctx->tree_lock);
+      if (!tree_ok) {
+        atomic_fetch_add_explicit(&ctx->stats->errors, 1,
+                                  memory_order_relaxed);
+      }
+    }
+  }
+}
+
+// Deterministic phase 2: a unit survives only if it owns its key.
+static int ordered_emit_worker(void *arg) {
+  auto ctx = (WorkerContext *)arg;
+  DedupScratch scratch = {0};
+  for (;;) {
+    size_t idx =
+        atomic_fetch_add_explicit(&ctx->next_index, 1, memory_order_relaxed);
+    if (idx >= ctx->batch_count)
+      break;
+
+    FileItem *item = &ctx->batch[idx];
+    OrderedFile *file = &ctx->ordered[idx];
+    if (file->failed)
+      continue;
+
+    size_t norm_total = 0;
+    for (size_t i = 0; i < file->unit_count; ++i) {
+      norm_total += file->units[i].len;
+    }
+    bool ok = ensure_scratch(&scratch, norm_total);
+    size_t out_pos = 0;
+    size_t file_unique = 0;
+    size_t file_duplicates = 0;
+    for (size_t i = 0; ok && i < file->unit_count; ++i) {
+      const PendingUnit *unit = &file->units[i];
+      const char8_t *norm = file->norm_text + unit->offset;
+      bool owned = false;
+      ok = unit_owned(ctx, file, unit, &owned);
+      if (!ok)
+        break;
+      if (owned && ctx->partition) {
+        file_unique++;
+        ok = unit_positions_append(
+            &file->winners,
+            (UnitPosition){.file = (uint32_t)(unit->order >> 32),
+                           .span = (uint32_t)unit->order});
+      } else if (owned) {
+        file_unique++;
+        if (out_pos > 0)
+          scratch.dedup_buffer[out_pos++] = (char8_t)'\n';
+        memcpy(scratch.dedup_buffer + out_pos, norm, unit->len);
+        out_pos += unit->len;
+      } else {
+        file_duplicates++;
+        if (ctx->duplicates_fp)
+          ok = append_unit(&file->dup_text, &file->dup_len, norm, unit->len);
+      }
+    }
+    free(file->norm_text);
+    free(file->units);
+    free(file->band_keys);
+    file->norm_text = nullptr;
+    file->units = nullptr;
+    file->band_keys = nullptr;
+
+    if (!ok) {
+      fprintf(stderr, "Failed to deduplicate content for: %s\n", item->name);
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+    } else {
+      atomic_fetch_add_explicit(&ctx->stats->unique_units, file_unique,
+                                memory_order_relaxed);
+      atomic_fetch_add_explicit(&ctx->stats->duplicate_units, file_duplicates,
+                                memory_order_relaxed);
+    }
+
+    // Partition runs only record winners; --merge-partitions writes files.
+    if (ok && !ctx->partition)
+      write_ordered_output(ctx, &scratch, item, scratch.dedup_buffer,
+                           out_pos);
+
+    report_file_done(ctx, item->byte_len);
+    free_file_item(item);
+  }
+  release_shard(ctx, &scratch);
+  free_scratch(&scratch);
+  return 0;
+}
+
+// Run worker over the batch on up to worker_count threads, falling back to
+// the calling thread when none can be started.
+static bool run_batch_workers(WorkerContext *ctx, thrd_start_t worker,
+                              size_t worker_count) {
+  atomic_store_explicit(&ctx->next_index, 0, memory_order_relaxed);
+  auto threads = (thrd_t *)calloc(worker_count, sizeof(thrd_t));
+  if (!threads) {
+    return worker(ctx) == 0;
+  }
+
+  size_t launched = 0;
+  for (; launched < worker_count; ++launched) {
+    if (thrd_create(&threads[launched], worker, ctx) != thrd_success) {
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+      break;
+    }
+  }
+
+  if (launched == 0) {
+    free(threads);
+    return worker(ctx) == 0;
+  }
+
+  for (size_t i = 0; i < launched; ++i) {
+    thrd_join(threads[i], nullptr);
+  }
+
+  free(threads);
+  return launched > 0;
+}
+
+// Two-phase batch for deterministic mode: claim every unit of the batch, then
+// emit once all claims have settled. Duplicates are flushed in file order.
+static bool process_batch_ordered(WorkerContext *ctx, size_t worker_count) {
+  if (ctx->batch_base + ctx->batch_count > UINT32_MAX) {
+    fprintf(stderr, "Too many input files for deterministic mode.\n");
+    return false;
+  }
+  ctx->ordered = (OrderedFile *)calloc(ctx->batch_count, sizeof(OrderedFile));
+  if (!ctx->ordered) {
+    fprintf(stderr, "Failed to allocate deterministic batch state.\n");
+    return false;
+  }
+
+  bool ok = run_batch_workers(ctx, ordered_claim_worker, worker_count) &&
+            run_batch_workers(ctx, ordered_emit_worker, worker_count);
+
+  for (size_t i = 0; i < ctx->batch_count; ++i) {
+    OrderedFile *file = &ctx->ordered[i];
+    if (ok && ctx->duplicates_fp && file->dup_len > 0 &&
+        fwrite(file->dup_text, 1, file->dup_len, ctx->duplicates_fp) !=
+            file->dup_len) {
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+    }
+    // Files are visited in order, so the winner list stays sorted.
+    for (size_t j = 0; ok && ctx->winners && j < file->winners.count; ++j) {
+      ok = unit_positions_append(ctx->winners, file->winners.items[j]);
+    }
+    free(file->dup_text);
+    free(file->norm_text);
+    free(file->units);
+    free(file->band_keys);
+    unit_positions_free(&file->winners);
+  }
+  free(ctx->ordered);
+  ctx->ordered = nullptr;
+  return ok;
+}
+
+static bool process_batch(FileItem *batch, size_t batch_count,
+                          size_t batch_base, const char *output_dir,
+                          SentenceSet *seen, const DedupIndex *base_index,
+                          BloomFilter *bloom, FILE *duplicates_fp,
+                          mtx_t *duplicates_lock,
+                          bool build_tree, DedupMode dedup_mode,
+                          size_t max_compare_len, const MinHasher *minhash,
+                          const char *text_field,
+                          const OutputCompression *compression,
+                          ShardSet *shards, bool io_uring,
+                          const PartitionSpec *partition,
+                          UnitPositionList *winners, BatchStats *stats,
+                          size_t total_files, double start_time,
+                          mtx_t *progress_lock, mtx_t *tree_lock) {
+  if (!batch || batch_count == 0)
+    return true;
+
+  size_t worker_count = detect_thread_count();
+  if (worker_count == 0)
+    worker_count = 1;
+  if (worker_count > batch_count)
+    worker_count = batch_count;
+
+  WorkerContext ctx = {.batch = batch,
+                       .batch_count = batch_count,
+                       .output_dir = output_dir,
+                       .seen = seen,
+                       .base_index = base_index,
+                       .bloom = bloom,
+                       .duplicates_fp = duplicates_fp,
+                       .duplicates_lock = duplicates_lock,
+                       .build_tree = build_tree,
+                       .dedup_mode = dedup_mode,
+                       .max_compare_len = max_compare_len,
+                       .minhash = minhash,
+                       .text_field = text_field,
+                       .compression = compression,
+                       .shards = shards,
+                       .io_uring = io_uring,
+                       .batch_base = batch_base,
+                       .partition = partition,
+                       .winners = winners,
+                       .stats = stats,
+                       .total_files = total_files,
+                       .start_time = start_time,
+                       .progress_lock = progress_lock,
+                       .tree_lock = tree_lock};
+  atomic_init(&ctx.next_index, 0);
+
+  if (seen->ordered)
+    return process_batch_ordered(&ctx, worker_count);
+  return run_batch_workers(&ctx, text_field ? jsonl_worker : batch_worker,
+                           worker_count);
+}
+
+static void seed_bloom(void *ctx, uint64_t hash) {
+  (void)bloom_add((BloomFilter *)ctx, hash);
+}
+
+static int compare_items_by_name(const void *a, const void *b) {
+  return strcmp(((const FileItem *)a)->name, ((const FileItem *)b)->name);
+}
+
+// Largest first, so the longest files start early instead of trailing a
+// batch; ties keep name order.
+static int compare_items_by_size(const void *a, const void *b) {
+  const FileItem *fa = (const FileItem *)a;
+  const FileItem *fb = (const FileItem *)b;
+  if (fa->size_hint != fb->size_hint)
+    return fa->size_hint < fb->size_hint ? 1 : -1;
+  return strcmp(fa->name, fb->name);
+}
+
+static bool spill_buffer_append(SpillBuffer *spill, const SpillRecord *records,
+                                size_t count) {
+  bool ok = true;
+  mtx_lock(&spill->lock);
+  while (ok && count > 0) {
+    if (spill->count == spill->cap) {
+      ok = spill_store_write_run(spill->store, spill->records, spill->count);
+      spill->count = 0;
+      continue;
+    }
+    size_t take = spill->cap - spill->count;
+    if (take > count)
+      take = count;
+    memcpy(spill->records + spill->count, records, take * sizeof(SpillRecord));
+    spill->count += take;
+    records += take;
+    count -= take;
+  }
+  mtx_unlock(&spill->lock);
+  return ok;
+}
+
+// External pass 1: fingerprint every unit and spill (key, file, span)
+// records. Nothing is kept per key in memory; records reach the shared sort
+// buffer in chunks of SPILL_APPEND_RECORDS.
+static int external_key_worker(void *arg) {
+  auto ctx = (WorkerContext *)arg;
+  DedupScratch scratch = {0};
+  auto records =
+      (SpillRecord *)malloc(SPILL_APPEND_RECORDS * sizeof(SpillRecord));
+  for (;;) {
+    size_t idx =
+        atomic_fetch_add_explicit(&ctx->next_index, 1, memory_order_relaxed);
+    if (idx >= ctx->batch_count)
+      break;
+
+    FileItem *item = &ctx->batch[idx];
+    uint32_t file_index = (uint32_t)(ctx->batch_base + idx);
+    FileView view;
+    if (!file_view_open(item->input_path, &view)) {
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+      item->failed = true;
+      report_file_done(ctx, 0);
+      continue;
+    }
+
+    SpanList spans = {0};
+    bool ok = records &&
+              split_units(ctx->dedup_mode, view.data, view.len, &spans) &&
+              spans.count <= UINT32_MAX && ensure_scratch(&scratch, view.len);
+    size_t record_count = 0;
+    for (size_t i = 0; ok && i < spans.count; ++i) {
+      size_t norm_len =
+          normalize_sentence(spans.items[i].start, spans.items[i].len,
+                             scratch.norm_buffer, scratch.norm_cap);
+      if (ctx->max_compare_len != 0 && norm_len > ctx->max_compare_len)
+        norm_len = ctx->max_compare_len;
+      if (norm_len == 0)
+        continue;
+      Hash128 key = unit_fingerprint(scratch.norm_buffer, norm_len);
+      records[record_count++] = (SpillRecord){
+          .hi = key.hi, .lo = key.lo, .file = file_index, .span = (uint32_t)i};
+      if (record_count == SPILL_APPEND_RECORDS) {
+        ok = spill_buffer_append(ctx->spill, records, record_count);
+        record_count = 0;
+      }
+    }
+    free_span_list(&spans);
+    ok = ok && spill_buffer_append(ctx->spill, records, record_count);
+    if (!ok) {
+      fprintf(stderr, "Failed to spill keys for: %s\n", item->name);
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+      item->failed = true;
+    }
+    report_file_done(ctx, view.len);
+    file_view_close(&view);
+  }
+  free(records);
+  free_scratch(&scratch);
+  return 0;
+}
+
+// Rewrite each file of the batch against ctx->marks, the batch's marked
+// positions sorted by (file, span). Marked units are the only ones kept when
+// marks_keep is set (partition merge) and the ones dropped otherwise
+// (external-memory losers).
+static int marked_emit_worker(void *arg) {
   auto ctx = (WorkerContext *)arg;
   DedupScratch scratch = {0};
-  SentenceSet local_seen = {0};
-  bool local_seen_init = sentence_set_init(&local_seen, 512);
-
   for (;;) {
     size_t idx =
         atomic_fetch_add_explicit(&ctx->next_index, 1, memory_order_relaxed);
@@ -631,175 +2354,871 @@ static int batch_worker(void *arg) {
       break;
 
     FileItem *item = &ctx->batch[idx];
-    size_t processed_bytes = 0;
-
-    item->raw_text = nullptr;
-    item->byte_len = 0;
-    if (!read_file_bytes(item->input_path, &item->raw_text, &item->byte_len)) {
+    OrderedFile *file = &ctx->ordered[idx];
+    uint32_t file_index = (uint32_t)(ctx->batch_base + idx);
+    if (item->failed) {
+      report_file_done(ctx, 0);
+      continue;
+    }
+    FileView view;
+    if (!file_view_open(item->input_path, &view)) {
       atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
-      free(item->name);
-      free(item->input_path);
-      goto finish_file;
+      report_file_done(ctx, 0);
+      continue;
     }
-    processed_bytes = item->byte_len;
 
-    sentence_set_reserve_for_bytes(ctx->seen, item->byte_len);
+    // Find this file's slice of the marks.
+    size_t lo = 0;
+    size_t hi = ctx->mark_count;
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      if (ctx->marks[mid].file < file_index)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    const UnitPosition *mark = ctx->marks + lo;
+    const UnitPosition *marks_end = mark;
+    while (marks_end < ctx->marks + ctx->mark_count &&
+           marks_end->file == file_index) {
+      marks_end++;
+    }
 
-    char8_t *deduped = nullptr;
-    size_t deduped_len = 0;
+    SpanList spans = {0};
+    bool ok = split_units(ctx->dedup_mode, view.data, view.len, &spans) &&
+              ensure_scratch(&scratch, view.len);
+    size_t out_pos = 0;
     size_t file_unique = 0;
     size_t file_duplicates = 0;
+    for (size_t i = 0; ok && i < spans.count; ++i) {
+      size_t norm_len =
+          normalize_sentence(spans.items[i].start, spans.items[i].len,
+                             scratch.norm_buffer, scratch.norm_cap);
+      if (ctx->max_compare_len != 0 && norm_len > ctx->max_compare_len)
+        norm_len = ctx->max_compare_len;
+      if (norm_len == 0)
+        continue;
+      while (mark < marks_end && mark->span < i)
+        mark++;
+      bool marked = mark < marks_end && mark->span == i;
+      if (marked != ctx->marks_keep) {
+        file_duplicates++;
+        if (ctx->duplicates_fp) {
+          ok = append_unit(&file->dup_text, &file->dup_len,
+                           scratch.norm_buffer, norm_len);
+        }
+        continue;
+      }
+      file_unique++;
+      if (out_pos > 0)
+        scratch.dedup_buffer[out_pos++] = (char8_t)'\n';
+      memcpy(scratch.dedup_buffer + out_pos, scratch.norm_buffer, norm_len);
+      out_pos += norm_len;
+    }
+    free_span_list(&spans);
 
-    if (!deduplicate_with_mode(
-            ctx->dedup_mode, item->raw_text, item->byte_len,
-            ctx->max_compare_len, local_seen_init ? &local_seen : nullptr,
-            ctx->seen, &scratch, &deduped, &deduped_len, &file_unique,
-            &file_duplicates, ctx->duplicates_fp, ctx->duplicates_lock)) {
+    if (!ok) {
       fprintf(stderr, "Failed to deduplicate content for: %s\n", item->name);
       atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
-      free(item->raw_text);
-      free(item->name);
-      free(item->input_path);
-      goto finish_file;
-    }
-
-    atomic_fetch_add_explicit(&ctx->stats->unique_units, file_unique,
-                              memory_order_relaxed);
-    atomic_fetch_add_explicit(&ctx->stats->duplicate_units, file_duplicates,
-                              memory_order_relaxed);
-
-    if (deduped_len == 0) {
-      atomic_fetch_add_explicit(&ctx->stats->files_empty, 1,
+    } else {
+      atomic_fetch_add_explicit(&ctx->stats->unique_units, file_unique,
                                 memory_order_relaxed);
-      free(item->raw_text);
-      free(item->name);
-      free(item->input_path);
-      goto finish_file;
+      atomic_fetch_add_explicit(&ctx->stats->duplicate_units, file_duplicates,
+                                memory_order_relaxed);
+      write_ordered_output(ctx, &scratch, item, scratch.dedup_buffer,
+                           out_pos);
     }
+    report_file_done(ctx, view.len);
+    file_view_close(&view);
+  }
+  release_shard(ctx, &scratch);
+  free_scratch(&scratch);
+  return 0;
+}
 
-    char *output_path = join_path(ctx->output_dir, item->name);
-    if (!output_path) {
-      fprintf(stderr, "Failed to allocate output path for: %s\n", item->name);
+// Run an emit worker over ctx's batch and flush duplicates in file order.
+static bool emit_batch_in_order(WorkerContext *ctx, thrd_start_t worker,
+                                size_t worker_count) {
+  ctx->ordered = (OrderedFile *)calloc(ctx->batch_count, sizeof(OrderedFile));
+  if (!ctx->ordered) {
+    fprintf(stderr, "Failed to allocate batch state.\n");
+    return false;
+  }
+  size_t threads =
+      worker_count < ctx->batch_count ? worker_count : ctx->batch_count;
+  bool ok = run_batch_workers(ctx, worker, threads);
+  for (size_t i = 0; i < ctx->batch_count; ++i) {
+    OrderedFile *file = &ctx->ordered[i];
+    if (ok && ctx->duplicates_fp && file->dup_len > 0 &&
+        fwrite(file->dup_text, 1, file->dup_len, ctx->duplicates_fp) !=
+            file->dup_len) {
       atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
-      free(item->raw_text);
-      free(item->name);
-      free(item->input_path);
-      goto finish_file;
     }
+    free(file->dup_text);
+  }
+  free(ctx->ordered);
+  ctx->ordered = nullptr;
+  return ok;
+}
 
-    if (!write_file_bytes(output_path, deduped, deduped_len)) {
-      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
-      free(output_path);
-      free(item->raw_text);
-      free(item->name);
-      free(item->input_path);
-      goto finish_file;
+// Partition merge: keep exactly the units some partition recorded as its
+// winner, in batches of the sorted file list.
+static bool run_partition_merge(WorkerContext *base_ctx, FileItem *items,
+                                size_t items_count,
+                                const UnitPositionList *winners) {
+  if (items_count > UINT32_MAX) {
+    fprintf(stderr, "Too many input files for --merge-partitions.\n");
+    return false;
+  }
+  size_t worker_count = detect_thread_count();
+  if (worker_count == 0)
+    worker_count = 1;
+
+  WorkerContext ctx = *base_ctx;
+  ctx.marks = winners->items;
+  ctx.mark_count = winners->count;
+  ctx.marks_keep = true;
+  render_progress(0, items_count, 0, ctx.start_time);
+  bool ok = true;
+  for (size_t i = 0; ok && i < items_count; i += FILE_BATCH_SIZE) {
+    ctx.batch = items + i;
+    ctx.batch_base = i;
+    ctx.batch_count = items_count - i < FILE_BATCH_SIZE ? items_count - i
+                                                        : FILE_BATCH_SIZE;
+    ok = emit_batch_in_order(&ctx, marked_emit_worker, worker_count);
+  }
+  fprintf(stderr, "\n");
+  return ok;
+}
+
+typedef struct {
+  size_t key_runs;
+  size_t loser_runs;
+  size_t spilled_bytes;
+  size_t workers;
+} ExternalStats;
+
+// How run_external_dedup splits --memory-limit. Pass 1 holds the sort buffer
+// and every worker's file state, pass 2 the sort buffer (reused for losers)
+// and the merge readers, pass 3 the merge readers, the file state and one
+// batch's loser positions.
+typedef struct {
+  size_t workers;
+  size_t sort_records;
+  size_t batch_positions; // loser positions one pass 3 batch may hold
+  size_t file_units;      // unit bound of the largest file
+} ExternalPlan;
+
+// Bytes a worker holds while it splits and normalizes item (SIZE_MAX when
+// that overflows), and the most units item can have. Every unit takes at
+// least two bytes (text and delimiter, or a multi-byte terminator), so a file
+// has at most len / 2 + 1 units and its span list at most twice that
+// capacity. Compressed inputs are decompressed into memory; their size is
+// guessed from the usual ratio. Inputs that fail to stat are charged nothing
+// here and reported by the pass that opens them.
+static void external_file_bytes(const FileItem *item, DedupMode mode,
+                                size_t *bytes, size_t *units) {
+  struct stat st;
+  size_t len = (size_t)item->size_hint;
+  if (len == 0 && stat(item->input_path, &st) == 0)
+    len = (size_t)st.st_size;
+  bool copied = compression_from_name(item->input_path) != COMPRESSION_NONE;
+  size_t norm = 0;
+  size_t spans = 0;
+  size_t total = 0;
+  bool overflow = copied && ckd_mul(&len, len, DECOMPRESS_SIZE_GUESS_RATIO);
+  *units = mode == DEDUP_MODE_DOCUMENT ? 1 : len / 2 + 1;
+  if (overflow || !normalize_bound(len, &norm) ||
+      ckd_mul(&spans, len / 2 + 1, 2 * sizeof(SentenceSpan)) ||
+      ckd_mul(&total, norm, (size_t)3) ||
+      ckd_add(&total, total, spans + 1) ||
+      ckd_add(&total, total, copied ? len : 0) ||
+      ckd_add(&total, total, SPILL_APPEND_RECORDS * sizeof(SpillRecord)))
+    total = SIZE_MAX;
+  *bytes = total;
+}
+
+// Run as many workers as the budget allows next to a sort buffer of at least
+// one reader's worth of records, the merge readers and the largest file's
+// loser positions.
+static bool external_plan(const FileItem *items, size_t items_count,
+                          DedupMode mode, size_t memory_limit,
+                          ExternalPlan *plan) {
+  size_t file_bytes = 0;
+  size_t file_units = 0;
+  for (size_t i = 0; i < items_count; ++i) {
+    size_t bytes = 0;
+    size_t units = 0;
+    external_file_bytes(&items[i], mode, &bytes, &units);
+    file_bytes = bytes > file_bytes ? bytes : file_bytes;
+    file_units = units > file_units ? units : file_units;
+  }
+  size_t threads = detect_thread_count();
+  if (threads == 0)
+    threads = 1;
+  if (threads > items_count)
+    threads = items_count;
+
+  // Positions grow by doubling, so a list may hold twice its count.
+  constexpr size_t position_bytes = 2 * sizeof(UnitPosition);
+  size_t readers = SPILL_MERGE_FANIN * SPILL_READ_RECORDS * sizeof(SpillRecord);
+  size_t min_sort = SPILL_READ_RECORDS * sizeof(SpillRecord);
+  size_t file_positions = 0;
+  if (ckd_mul(&file_positions, file_units, position_bytes))
+    file_positions = SIZE_MAX;
+  for (size_t workers = threads; workers > 0; --workers) {
+    size_t work = 0;
+    size_t pass3 = 0;
+    if (ckd_mul(&work, workers, file_bytes) ||
+        ckd_add(&pass3, readers, work) ||
+        ckd_add(&pass3, pass3, file_positions) || pass3 > memory_limit)
+      continue;
+    size_t shared = work > readers ? work : readers;
+    if (memory_limit - shared < min_sort)
+      continue;
+    *plan = (ExternalPlan){
+        .workers = workers,
+        .sort_records = (memory_limit - shared) / sizeof(SpillRecord),
+        .batch_positions = (memory_limit - readers - work) / position_bytes,
+        .file_units = file_units};
+    return true;
+  }
+  fprintf(stderr,
+          "Memory budget of %.2f MiB cannot hold one worker's %.2f MiB for "
+          "the largest input next to the %.2f MiB merge readers; raise "
+          "--memory-limit\n",
+          (double)memory_limit / (1024.0 * 1024.0),
+          (double)file_bytes / (1024.0 * 1024.0),
+          (double)readers / (1024.0 * 1024.0));
+  return false;
+}
+
+// Pass 3 over batches of files whose loser positions fit the plan: a batch
+// closes early once the next file's losers might overflow it.
+static bool emit_external_losers(WorkerContext *ctx, FileItem *items,
+                                 size_t items_count, SpillMerger *merger,
+                                 const ExternalPlan *plan) {
+  SpillRecord next = {0};
+  bool has_next = false;
+  bool ok = spill_merge_next(merger, &next, &has_next);
+  UnitPositionList batch_losers = {0};
+  for (size_t i = 0; ok && i < items_count; i += ctx->batch_count) {
+    size_t end = i;
+    batch_losers.count = 0;
+    while (ok && end < items_count && end - i < FILE_BATCH_SIZE &&
+           (end == i ||
+            batch_losers.count + plan->file_units <= plan->batch_positions)) {
+      while (ok && has_next && next.file == end) {
+        ok = unit_positions_append(&batch_losers,
+                                   (UnitPosition){.file = next.file,
+                                                  .span = next.span}) &&
+             spill_merge_next(merger, &next, &has_next);
+      }
+      end++;
     }
+    ctx->batch = items + i;
+    ctx->batch_base = i;
+    ctx->batch_count = end - i;
+    ctx->marks = batch_losers.items;
+    ctx->mark_count = batch_losers.count;
+    ok = ok && emit_batch_in_order(ctx, marked_emit_worker, plan->workers);
+  }
+  unit_positions_free(&batch_losers);
+  return ok;
+}
 
-    atomic_fetch_add_explicit(&ctx->stats->files_written, 1,
-                              memory_order_relaxed);
+// Dedup under a memory budget (--memory-limit). Pass 1 fills the sort buffer
+// with (key, file, span) records. When the whole corpus fits, the buffer is
+// resolved in place: sorted by key, every record after the first of its key
+// kept as a loser, the losers sorted by position and compacted to the marks
+// of pass 3. Otherwise every full buffer is spilled as a sorted run, pass 2
+// k-way merges the runs so that the first position of every key wins and
+// spills the losers sorted by position, and pass 3 rewrites each batch of
+// files against the merged loser stream. Winners are the first occurrence
+// in sorted file order, as with --deterministic.
+static bool run_external_dedup(WorkerContext *base_ctx, FileItem *items,
+                               size_t items_count, const char *spill_dir,
+                               size_t memory_limit, ExternalStats *external) {
+  if (items_count > UINT32_MAX) {
+    fprintf(stderr, "Too many input files for --memory-limit.\n");
+    return false;
+  }
+  ExternalPlan plan;
+  if (!external_plan(items, items_count, base_ctx->dedup_mode, memory_limit,
+                     &plan))
+    return false;
+  external->workers = plan.workers;
 
-    if (ctx->build_tree) {
-      if (ctx->tree_lock)
-        mtx_lock(ctx->tree_lock);
-      bool ok = process_text(item->name, deduped, deduped_len, false);
-      if (ctx->tree_lock)
-        mtx_unlock(ctx->tree_lock);
-      if (!ok) {
-        atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+  SpillStore keys = {0};
+  SpillStore losers = {0};
+  SpillBuffer spill = {.store = &keys, .cap = plan.sort_records};
+  spill.records = (SpillRecord *)malloc(spill.cap * sizeof(SpillRecord));
+  bool lock_init = mtx_init(&spill.lock, mtx_plain) == thrd_success;
+  bool ok = spill.records && lock_init &&
+            spill_store_init(&keys, spill_dir, "keys", SPILL_ORDER_KEY) &&
+            spill_store_init(&losers, spill_dir, "losers",
+                             SPILL_ORDER_POSITION);
+  if (!ok)
+    fprintf(stderr, "Failed to set up spill buffers in: %s\n", spill_dir);
+
+  // Pass 1: collect (key, file, span) records of every batch.
+  WorkerContext ctx = *base_ctx;
+  ctx.spill = &spill;
+  for (size_t i = 0; ok && i < items_count; i += FILE_BATCH_SIZE) {
+    ctx.batch = items + i;
+    ctx.batch_base = i;
+    ctx.batch_count = items_count - i < FILE_BATCH_SIZE ? items_count - i
+                                                        : FILE_BATCH_SIZE;
+    size_t threads = plan.workers < ctx.batch_count ? plan.workers
+                                                    : ctx.batch_count;
+    ok = run_batch_workers(&ctx, external_key_worker, threads);
+  }
+  fprintf(stderr, "\n");
+  atomic_store(&ctx.stats->processed, 0);
+  atomic_store(&ctx.stats->bytes_processed, 0);
+
+  if (ok && keys.run_count == 0) {
+    // Nothing spilled. The first record never loses, so each loser lands
+    // below the pair still to be compared; the positions then shrink in
+    // place the same way.
+    spill_records_sort(spill.records, spill.count, SPILL_ORDER_KEY);
+    size_t loser_count = 0;
+    for (size_t i = 1; i < spill.count; ++i) {
+      if (spill.records[i].hi == spill.records[i - 1].hi &&
+          spill.records[i].lo == spill.records[i - 1].lo)
+        spill.records[loser_count++] = spill.records[i];
+    }
+    spill_records_sort(spill.records, loser_count, SPILL_ORDER_POSITION);
+    auto positions = (UnitPosition *)spill.records;
+    for (size_t i = 0; i < loser_count; ++i) {
+      SpillRecord rec = spill.records[i];
+      positions[i] = (UnitPosition){.file = rec.file, .span = rec.span};
+    }
+    render_progress(0, items_count, 0, ctx.start_time);
+    ctx.marks = positions;
+    ctx.mark_count = loser_count;
+    for (size_t i = 0; ok && i < items_count; i += FILE_BATCH_SIZE) {
+      ctx.batch = items + i;
+      ctx.batch_base = i;
+      ctx.batch_count = items_count - i < FILE_BATCH_SIZE ? items_count - i
+                                                          : FILE_BATCH_SIZE;
+      ok = emit_batch_in_order(&ctx, marked_emit_worker, plan.workers);
+    }
+    free(spill.records);
+    spill_store_destroy(&keys);
+    spill_store_destroy(&losers);
+    mtx_destroy(&spill.lock);
+    return ok;
+  }
+
+  // Pass 2: every key after the first in (key, file, span) order loses.
+  ok = ok && spill_store_write_run(&keys, spill.records, spill.count);
+  spill.count = 0;
+  external->key_runs = keys.run_count;
+  SpillMerger *merger = ok ? spill_merge_open(&keys) : nullptr;
+  ok = ok && merger;
+  SpillRecord prev = {0};
+  bool have_prev = false;
+  for (bool has = true; ok && has;) {
+    SpillRecord rec;
+    ok = spill_merge_next(merger, &rec, &has);
+    if (!ok || !has)
+      break;
+    if (have_prev && rec.hi == prev.hi && rec.lo == prev.lo) {
+      if (spill.count == spill.cap) {
+        ok = spill_store_write_run(&losers, spill.records, spill.count);
+        spill.count = 0;
       }
+      spill.records[spill.count++] = rec;
     }
+    prev = rec;
+    have_prev = true;
+  }
+  spill_merge_close(merger);
+  ok = ok && spill_store_write_run(&losers, spill.records, spill.count);
+  spill.count = 0;
+  external->loser_runs = losers.run_count;
+  external->spilled_bytes = keys.bytes_written + losers.bytes_written;
+  spill_store_destroy(&keys);
 
-    free(output_path);
-    free(item->raw_text);
-    free(item->name);
-    free(item->input_path);
+  // Pass 3: pull each batch's losers off the merged stream and rewrite.
+  render_progress(0, items_count, 0, ctx.start_time);
+  free(spill.records);
+  spill.records = nullptr;
+  merger = ok ? spill_merge_open(&losers) : nullptr;
+  ok = ok && merger &&
+       emit_external_losers(&ctx, items, items_count, merger, &plan);
+  spill_merge_close(merger);
+  spill_store_destroy(&losers);
+  if (lock_init)
+    mtx_destroy(&spill.lock);
+  return ok;
+}
 
-  finish_file:
-    if (local_seen_init) {
-      sentence_set_clear(&local_seen);
+// Read a file and normalize the whole document into scratch->norm_buffer.
+static bool read_normalized(const FileItem *item, DedupScratch *scratch,
+                            size_t *raw_len, size_t *norm_len) {
+  FileView view;
+  *raw_len = 0;
+  *norm_len = 0;
+  if (!file_view_open(item->input_path, &view))
+    return false;
+  *raw_len = view.len;
+  bool ok = ensure_scratch(scratch, *raw_len);
+  if (ok) {
+    *norm_len = normalize_sentence(view.data, *raw_len, scratch->norm_buffer,
+                                   scratch->norm_cap);
+  }
+  file_view_close(&view);
+  return ok;
+}
+
+// Substring pass 1: record each file's normalized length and count its
+// windows per bin.
+static int substring_count_worker(void *arg) {
+  auto ctx = (WorkerContext *)arg;
+  SubstringState *state = ctx->substring;
+  DedupScratch scratch = {0};
+  auto histogram =
+      (uint64_t *)calloc((size_t)1 << SUBSTRING_BIN_BITS, sizeof(uint64_t));
+  for (;;) {
+    size_t idx =
+        atomic_fetch_add_explicit(&ctx->next_index, 1, memory_order_relaxed);
+    if (idx >= ctx->batch_count)
+      break;
+
+    FileItem *item = &ctx->batch[idx];
+    size_t raw_len = 0;
+    size_t norm_len = 0;
+    if (!histogram || !read_normalized(item, &scratch, &raw_len, &norm_len)) {
+      fprintf(stderr, "Failed to normalize: %s\n", item->name);
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+      item->failed = true;
+      report_file_done(ctx, 0);
+      continue;
     }
-    if (processed_bytes > 0) {
-      atomic_fetch_add_explicit(&ctx->stats->bytes_processed, processed_bytes,
-                                memory_order_relaxed);
+    state->offsets[ctx->batch_base + idx + 1] = norm_len;
+    span_hash_windows(&state->hasher, scratch.norm_buffer, norm_len, 0,
+                      histogram, 0, 0, nullptr);
+    report_file_done(ctx, raw_len);
+  }
+  if (histogram) {
+    mtx_lock(&state->histogram_lock);
+    for (size_t bin = 0; bin < (size_t)1 << SUBSTRING_BIN_BITS; ++bin) {
+      state->histogram[bin] += histogram[bin];
+    }
+    mtx_unlock(&state->histogram_lock);
+  }
+  free(histogram);
+  free_scratch(&scratch);
+  return 0;
+}
+
+// Substring collect pass: hash each file again and hand the windows of the
+// current pass's bins over a chunk at a time.
+static int substring_collect_worker(void *arg) {
+  auto ctx = (WorkerContext *)arg;
+  SubstringState *state = ctx->substring;
+  SpanPass *pass = state->pass;
+  size_t span = state->hasher.min_span;
+  DedupScratch scratch = {0};
+  auto windows =
+      (SpanWindow *)malloc(2 * SUBSTRING_WINDOW_CHUNK * sizeof(SpanWindow));
+  for (;;) {
+    size_t idx =
+        atomic_fetch_add_explicit(&ctx->next_index, 1, memory_order_relaxed);
+    if (idx >= ctx->batch_count)
+      break;
+
+    FileItem *item = &ctx->batch[idx];
+    if (item->failed) {
+      report_file_done(ctx, 0);
+      continue;
     }
-    size_t processed = atomic_fetch_add_explicit(&ctx->stats->processed, 1,
-                                                 memory_order_relaxed) +
-                       1;
-    if (ctx->progress_lock) {
-      mtx_lock(ctx->progress_lock);
-      size_t current_bytes = atomic_load_explicit(&ctx->stats->bytes_processed,
-                                                  memory_order_relaxed);
-      render_progress(processed, ctx->total_files, current_bytes,
-                      ctx->start_time);
-      mtx_unlock(ctx->progress_lock);
+    uint64_t base = state->offsets[ctx->batch_base + idx];
+    uint64_t expected = state->offsets[ctx->batch_base + idx + 1] - base;
+    size_t raw_len = 0;
+    size_t norm_len = 0;
+    bool ok = windows &&
+              read_normalized(item, &scratch, &raw_len, &norm_len) &&
+              norm_len == expected;
+    for (size_t at = 0; ok && at + span <= norm_len;
+         at += SUBSTRING_WINDOW_CHUNK) {
+      size_t chunk_len = norm_len - at;
+      if (chunk_len > SUBSTRING_WINDOW_CHUNK + span - 1)
+        chunk_len = SUBSTRING_WINDOW_CHUNK + span - 1;
+      size_t count = span_hash_windows(
+          &state->hasher, scratch.norm_buffer + at, chunk_len, base + at,
+          nullptr, pass->bin_lo, pass->bin_hi, windows);
+      ok = span_pass_add(pass, windows, count,
+                         windows + SUBSTRING_WINDOW_CHUNK);
     }
+    if (!ok) {
+      fprintf(stderr, "Failed to collect windows for: %s\n", item->name);
+      atomic_store_explicit(&state->failed, true, memory_order_relaxed);
+    }
+    report_file_done(ctx, raw_len);
   }
+  free(windows);
+  free_scratch(&scratch);
+  return 0;
+}
 
-  free(scratch.dedup_buffer);
-  free(scratch.norm_buffer);
-  if (local_seen_init) {
-    sentence_set_destroy(&local_seen);
+// First position in [from, limit) of the file at base whose window repeats
+// an earlier one, or limit.
+static size_t next_repeat(const _Atomic uint64_t *starts, uint64_t base,
+                          size_t from, size_t limit) {
+  while (from < limit) {
+    uint64_t pos = base + from;
+    uint64_t word =
+        atomic_load_explicit(&starts[pos / 64], memory_order_relaxed) >>
+        (pos % 64);
+    if (word != 0) {
+      size_t at = from + (size_t)__builtin_ctzll(word);
+      return at < limit ? at : limit;
+    }
+    from += 64 - pos % 64;
+  }
+  return limit;
+}
+
+static inline bool is_utf8_continuation(char8_t c) {
+  return (c & 0xC0) == 0x80;
+}
+
+// Trim text[start, end) of spaces; returns false when nothing is left.
+static bool trim_fragment(const char8_t *text, size_t *start, size_t *end) {
+  while (*start < *end && is_ascii_space((unsigned char)text[*start]))
+    (*start)++;
+  while (*end > *start && is_ascii_space((unsigned char)text[*end - 1]))
+    (*end)--;
+  return *end > *start;
+}
+
+// Substring emit pass: drop every byte covered by a repeated window and keep
+// the rest of the normalized document as newline-separated fragments.
+static int substring_emit_worker(void *arg) {
+  auto ctx = (WorkerContext *)arg;
+  SubstringState *state = ctx->substring;
+  size_t span = state->hasher.min_span;
+  DedupScratch scratch = {0};
+  for (;;) {
+    size_t idx =
+        atomic_fetch_add_explicit(&ctx->next_index, 1, memory_order_relaxed);
+    if (idx >= ctx->batch_count)
+      break;
+
+    FileItem *item = &ctx->batch[idx];
+    OrderedFile *file = &ctx->ordered[idx];
+    if (item->failed) {
+      report_file_done(ctx, 0);
+      continue;
+    }
+    uint64_t base = state->offsets[ctx->batch_base + idx];
+    uint64_t expected = state->offsets[ctx->batch_base + idx + 1] - base;
+    size_t raw_len = 0;
+    size_t norm_len = 0;
+    bool ok = read_normalized(item, &scratch, &raw_len, &norm_len) &&
+              norm_len == expected;
+    const char8_t *norm = scratch.norm_buffer;
+    size_t window_count = norm_len >= span ? norm_len - span + 1 : 0;
+    size_t out_pos = 0;
+    size_t file_unique = 0;
+    size_t file_duplicates = 0;
+    size_t removed = 0;
+    size_t kept_from = 0;
+    size_t at = ok ? next_repeat(state->starts, base, 0, window_count) : 0;
+    while (ok && kept_from <= norm_len) {
+      // Grow the removed range while repeated windows overlap or touch it.
+      size_t rm_start = at < window_count ? at : norm_len;
+      size_t rm_end = at < window_count ? at + span : norm_len;
+      while (at < window_count) {
+        size_t limit = rm_end + 1 < window_count ? rm_end + 1 : window_count;
+        at = next_repeat(state->starts, base, at + 1, limit);
+        if (at == limit)
+          break;
+        rm_end = at + span;
+      }
+      // Keep both edges on UTF-8 boundaries.
+      while (rm_start < rm_end && is_utf8_continuation(norm[rm_start]))
+        rm_start++;
+      while (rm_end > rm_start && rm_end < norm_len &&
+             is_utf8_continuation(norm[rm_end]))
+        rm_end--;
+
+      size_t keep_start = kept_from;
+      size_t keep_end = rm_start;
+      if (trim_fragment(norm, &keep_start, &keep_end)) {
+        file_unique++;
+        if (out_pos > 0)
+          scratch.dedup_buffer[out_pos++] = (char8_t)'\n';
+        memcpy(scratch.dedup_buffer + out_pos, norm + keep_start,
+               keep_end - keep_start);
+        out_pos += keep_end - keep_start;
+      }
+      if (rm_start >= norm_len)
+        break;
+      removed += rm_end - rm_start;
+      size_t dup_start = rm_start;
+      size_t dup_end = rm_end;
+      if (trim_fragment(norm, &dup_start, &dup_end)) {
+        file_duplicates++;
+        if (ctx->duplicates_fp) {
+          ok = append_unit(&file->dup_text, &file->dup_len, norm + dup_start,
+                           dup_end - dup_start);
+        }
+      }
+      kept_from = rm_end;
+      at = next_repeat(state->starts, base, rm_end, window_count);
+    }
+
+    if (!ok) {
+      fprintf(stderr, "Failed to deduplicate content for: %s\n", item->name);
+      atomic_fetch_add_explicit(&ctx->stats->errors, 1, memory_order_relaxed);
+    } else {
+      atomic_fetch_add_explicit(&ctx->stats->unique_units, file_unique,
+                                memory_order_relaxed);
+      atomic_fetch_add_explicit(&ctx->stats->duplicate_units, file_duplicates,
+                                memory_order_relaxed);
+      atomic_fetch_add_explicit(&ctx->stats->bytes_removed, removed,
+                                memory_order_relaxed);
+      write_ordered_output(ctx, &scratch, item, scratch.dedup_buffer,
+                           out_pos);
+    }
+    report_file_done(ctx, raw_len);
   }
+  release_shard(ctx, &scratch);
+  free_scratch(&scratch);
   return 0;
 }
 
-static bool process_batch(FileItem *batch, size_t batch_count,
-                          const char *output_dir, SentenceSet *seen,
-                          FILE *duplicates_fp, mtx_t *duplicates_lock,
-                          bool build_tree, DedupMode dedup_mode,
-                          size_t max_compare_len, BatchStats *stats,
-                          size_t total_files, double start_time,
-                          mtx_t *progress_lock, mtx_t *tree_lock) {
-  if (!batch || batch_count == 0)
-    return true;
+typedef struct {
+  size_t passes;
+  uint64_t normalized_bytes;
+  size_t repeated_windows;
+} SubstringStats;
 
+// Exact substring dedup (--dedup-mode substring). The normalized documents,
+// concatenated in sorted file order, are cut into min_span-byte windows.
+// Pass 1 counts windows per hash bin; each collect pass then gathers the
+// windows of as many bins as fit the memory budget and sorts them per bin,
+// marking every window whose bytes already occurred earlier. This orders
+// suffixes on their first min_span bytes only, which is all a repeat of at
+// least min_span bytes needs, without materializing the corpus or a full
+// suffix array. The emit pass drops the union of the marked windows.
+static bool run_substring_dedup(WorkerContext *base_ctx, FileItem *items,
+                                size_t items_count, size_t min_span,
+                                size_t memory_budget,
+                                SubstringStats *substring) {
   size_t worker_count = detect_thread_count();
   if (worker_count == 0)
     worker_count = 1;
-  if (worker_count > batch_count)
-    worker_count = batch_count;
+  size_t threads = worker_count < items_count ? worker_count : items_count;
+  size_t bins = (size_t)1 << SUBSTRING_BIN_BITS;
 
-  WorkerContext ctx = {.batch = batch,
-                       .batch_count = batch_count,
-                       .output_dir = output_dir,
-                       .seen = seen,
-                       .duplicates_fp = duplicates_fp,
-                       .duplicates_lock = duplicates_lock,
-                       .build_tree = build_tree,
-                       .dedup_mode = dedup_mode,
-                       .max_compare_len = max_compare_len,
-                       .stats = stats,
-                       .total_files = total_files,
-                       .start_time = start_time,
-                       .progress_lock = progress_lock,
-                       .tree_lock = tree_lock};
-  atomic_init(&ctx.next_index, 0);
+  SubstringState state = {0};
+  span_hasher_init(&state.hasher, min_span);
+  atomic_init(&state.failed, false);
+  state.offsets = (uint64_t *)calloc(items_count + 1, sizeof(uint64_t));
+  state.histogram = (uint64_t *)calloc(bins, sizeof(uint64_t));
+  auto bounds = (size_t *)calloc(bins + 1, sizeof(size_t));
+  bool lock_init = mtx_init(&state.histogram_lock, mtx_plain) == thrd_success;
+  bool ok = state.offsets && state.histogram && bounds && lock_init;
+  if (!ok)
+    fprintf(stderr, "Failed to allocate substring dedup state.\n");
 
-  auto threads = (thrd_t *)calloc(worker_count, sizeof(thrd_t));
-  if (!threads) {
-    return batch_worker(&ctx) == 0;
+  WorkerContext ctx = *base_ctx;
+  ctx.substring = &state;
+  ctx.batch = items;
+  ctx.batch_count = items_count;
+  ctx.batch_base = 0;
+  if (ok) {
+    render_progress(0, items_count, 0, ctx.start_time);
+    ok = run_batch_workers(&ctx, substring_count_worker, threads);
+    fprintf(stderr, "\n");
   }
+  for (size_t i = 0; ok && i < items_count; ++i) {
+    state.offsets[i + 1] += state.offsets[i];
+  }
+  uint64_t total = ok ? state.offsets[items_count] : 0;
+  substring->normalized_bytes = total;
 
-  size_t launched = 0;
-  for (; launched < worker_count; ++launched) {
-    if (thrd_create(&threads[launched], batch_worker, &ctx) != thrd_success) {
-      atomic_fetch_add_explicit(&stats->errors, 1, memory_order_relaxed);
+  // The position bitmap stays resident; the rest of the budget bounds the
+  // windows of one pass.
+  uint64_t bitmap_bytes = (total / 64 + 1) * sizeof(uint64_t);
+  if (ok && bitmap_bytes >= memory_budget) {
+    fprintf(stderr,
+            "Memory budget of %.2f MiB cannot hold the %.2f MiB position "
+            "bitmap; raise --memory-limit\n",
+            (double)memory_budget / (1024.0 * 1024.0),
+            (double)bitmap_bytes / (1024.0 * 1024.0));
+    ok = false;
+  }
+  if (ok) {
+    state.starts = (_Atomic uint64_t *)calloc((size_t)(total / 64 + 1),
+                                              sizeof(uint64_t));
+    ok = state.starts != nullptr;
+    if (!ok)
+      fprintf(stderr, "Failed to allocate the position bitmap.\n");
+  }
+  size_t passes = 0;
+  if (ok) {
+    size_t max_windows =
+        (memory_budget - (size_t)bitmap_bytes) / sizeof(SpanWindow);
+    passes = span_plan_passes(state.histogram, max_windows, bounds);
+  }
+  substring->passes = passes;
+
+  for (size_t p = 0; ok && p < passes; ++p) {
+    SpanPass pass;
+    if (!span_pass_init(&pass, state.histogram, bounds[p], bounds[p + 1])) {
+      fprintf(stderr, "Failed to allocate substring pass %zu.\n", p + 1);
+      ok = false;
       break;
     }
+    state.pass = &pass;
+    atomic_store(&ctx.stats->processed, 0);
+    atomic_store(&ctx.stats->bytes_processed, 0);
+    render_progress(0, items_count, 0, ctx.start_time);
+    ok = run_batch_workers(&ctx, substring_collect_worker, threads);
+    fprintf(stderr, "\n");
+    if (ok && (atomic_load(&state.failed) || !span_pass_filled(&pass))) {
+      fprintf(stderr, "Substring windows changed between passes; inputs "
+                      "must not change during the run\n");
+      ok = false;
+    }
+    if (ok)
+      substring->repeated_windows +=
+          span_pass_mark(&pass, state.starts, worker_count);
+    span_pass_destroy(&pass);
+    state.pass = nullptr;
   }
 
-  if (launched == 0) {
-    free(threads);
-    return batch_worker(&ctx) == 0;
+  if (ok) {
+    atomic_store(&ctx.stats->processed, 0);
+    atomic_store(&ctx.stats->bytes_processed, 0);
+    render_progress(0, items_count, 0, ctx.start_time);
   }
+  for (size_t i = 0; ok && i < items_count; i += FILE_BATCH_SIZE) {
+    ctx.batch = items + i;
+    ctx.batch_base = i;
+    ctx.batch_count = items_count - i < FILE_BATCH_SIZE ? items_count - i
+                                                        : FILE_BATCH_SIZE;
+    ok = emit_batch_in_order(&ctx, substring_emit_worker, worker_count);
+  }
+  if (ok)
+    fprintf(stderr, "\n");
 
-  for (size_t i = 0; i < launched; ++i) {
-    thrd_join(threads[i], nullptr);
+  free((void *)state.starts);
+  free(state.offsets);
+  free(state.histogram);
+  free(bounds);
+  if (lock_init)
+    mtx_destroy(&state.histogram_lock);
+  return ok;
+}
+
+// Output root for the per-directory hook of a recursive scan.
+typedef struct {
+  const char *output_dir;
+} OutputMirror;
+
+// Create the output counterpart of an input subdirectory before any of its
+// files are handed out, so workers can write into it.
+static bool mirror_output_dir(void *ctx, const char *rel_dir) {
+  const OutputMirror *mirror = (const OutputMirror *)ctx;
+  char *path = join_path(mirror->output_dir, rel_dir);
+  if (!path) {
+    fprintf(stderr, "Failed to allocate output path for: %s\n", rel_dir);
+    return false;
   }
+  bool ok = mkdir(path, 0755) == 0 ||
+            (errno == EEXIST && ensure_directory(path, false));
+  if (!ok)
+    fprintf(stderr, "Failed to create directory: %s\n", path);
+  free(path);
+  return ok;
+}
 
-  free(threads);
-  return launched > 0;
+// Fill items from a scanned batch, named as their outputs will be. Names
+// and paths stay in the batch pool, so the batch must outlive the items.
+static void items_from_batch(ScanBatch *scanned, FileItem *items) {
+  for (size_t i = 0; i < scanned->count; ++i) {
+    const char *name = scanned->entries[i].name;
+    // Outputs are written decompressed, under the name without .gz/.zst.
+    size_t suffix_len = compression_suffix_len(name);
+    if (suffix_len > 0) {
+      size_t len = strlen(name) - suffix_len;
+      auto stripped = (char *)arena_alloc(scanned->pool, len + 1);
+      memcpy(stripped, name, len);
+      stripped[len] = '\0';
+      name = stripped;
+    }
+    items[i] = (FileItem){.name = name,
+                          .input_path = scanned->entries[i].path,
+                          .byte_len = 0};
+  }
+}
+
+// Keep a scanned batch alive for the items of an ordered run; takes
+// ownership of batch either way.
+static bool keep_batch(ScanBatch ***batches, size_t *count, size_t *cap,
+                       ScanBatch *batch) {
+  if (*count == *cap) {
+    size_t next_cap = *cap ? *cap * 2 : 64;
+    auto next = (ScanBatch **)realloc(*batches, next_cap * sizeof(**batches));
+    if (!next) {
+      scan_batch_free(batch);
+      return false;
+    }
+    *batches = next;
+    *cap = next_cap;
+  }
+  (*batches)[(*count)++] = batch;
+  return true;
+}
+
+// Create the output directories of every nested name, in list order so a
+// run of names from one directory costs a single check.
+static bool mirror_parents(OutputMirror *mirror, const FileItem *items,
+                           size_t count) {
+  const char *last = nullptr;
+  size_t last_len = 0;
+  char *rel = nullptr;
+  size_t rel_cap = 0;
+  bool ok = true;
+  for (size_t i = 0; ok && i < count; ++i) {
+    const char *name = items[i].name;
+    const char *slash = strrchr(name, '/');
+    size_t len = slash ? (size_t)(slash - name) : 0;
+    if (len == 0 || (len == last_len && memcmp(name, last, len) == 0))
+      continue;
+    if (len + 1 > rel_cap) {
+      auto next = (char *)realloc(rel, len + 1);
+      if (!next) {
+        fprintf(stderr, "Failed to allocate output path for: %s\n", name);
+        ok = false;
+        break;
+      }
+      rel = next;
+      rel_cap = len + 1;
+    }
+    memcpy(rel, name, len);
+    rel[len] = '\0';
+    // Make each ancestor in turn; existing ones are accepted.
+    for (size_t j = 1; ok && j <= len; ++j) {
+      if (j < len && rel[j] != '/')
+        continue;
+      rel[j] = '\0';
+      ok = mirror_output_dir(mirror, rel);
+      if (j < len)
+        rel[j] = '/';
+    }
+    last = name;
+    last_len = len;
+  }
+  free(rel);
+  return ok;
 }
 
 int run_dedup(const char *prog, int argc, char **argv) {
@@ -809,9 +3228,34 @@ int run_dedup(const char *prog, int argc, char **argv) {
   const char *mask = DEFAULT_MASK;
   bool mask_set = false;
   bool write_duplicates = false;
+  bool duplicates_metadata = false;
   bool build_block_tree_flag = false;
+  bool fingerprint_only = false;
+  bool deterministic = false;
+  bool recursive = false;
+  const char *files_from = nullptr;
+  bool io_uring = false;
+  const UnitHash *unit_hash = nullptr; // --hash; nullptr is auto
+  uint32_t normalize_steps = 0;        // --normalize
   DedupMode dedup_mode = DEDUP_MODE_SENTENCE;
   size_t max_compare_len = DEFAULT_MAX_COMPARE_LENGTH;
+  size_t shingle_words = MINHASH_DEFAULT_SHINGLE_WORDS;
+  size_t permutations = MINHASH_DEFAULT_PERMUTATIONS;
+  size_t bands = MINHASH_DEFAULT_BANDS;
+  const char *save_index_path = nullptr;
+  const char *load_index_path = nullptr;
+  size_t memory_limit = 0;
+  const char *spill_dir_arg = nullptr;
+  PartitionSpec partition = {0};
+  uint32_t merge_count = 0;
+  size_t bloom_bytes_arg = 0;
+  size_t min_span = SUBSTRING_DEFAULT_MIN_SPAN;
+  bool jsonl = false;
+  const char *text_field = JSONL_DEFAULT_TEXT_FIELD;
+  OutputCompression compression = {.kind = COMPRESSION_NONE};
+  bool level_set = false;
+  bool shard_output = false;
+  size_t shard_size = SHARD_DEFAULT_SIZE;
 
   for (int i = 1; i < argc; ++i) {
     const char *arg = argv[i];
@@ -819,8 +3263,78 @@ int run_dedup(const char *prog, int argc, char **argv) {
       write_duplicates = true;
       continue;
     }
-    if (strcmp(arg, "--build-block-tree") == 0) {
-      build_block_tree_flag = true;
+    if (strcmp(arg, "--duplicates-metadata") == 0) {
+      duplicates_metadata = true;
+      continue;
+    }
+    if (strcmp(arg, "--build-block-tree") == 0) {
+      build_block_tree_flag = true;
+      continue;
+    }
+    if (strcmp(arg, "--fingerprint-only") == 0) {
+      fingerprint_only = true;
+      continue;
+    }
+    if (strcmp(arg, "--deterministic") == 0) {
+      deterministic = true;
+      continue;
+    }
+    if (strcmp(arg, "--recursive") == 0) {
+      recursive = true;
+      continue;
+    }
+    if (strcmp(arg, "--files-from") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing path for --files-from\n");
+        return 1;
+      }
+      files_from = argv[++i];
+      continue;
+    }
+    if (strcmp(arg, "--io-engine") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "--io-engine requires one of: sync, uring\n");
+        return 1;
+      }
+      const char *engine = argv[++i];
+      if (strcmp(engine, "uring") != 0 && strcmp(engine, "sync") != 0) {
+        fprintf(stderr,
+                "Invalid --io-engine value: %s (expected sync or uring)\n",
+                engine);
+        return 1;
+      }
+      io_uring = strcmp(engine, "uring") == 0;
+      continue;
+    }
+    if (strcmp(arg, "--hash") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr,
+                "--hash requires one of: auto, murmur3, xxh, crc32c\n");
+        return 1;
+      }
+      const char *name = argv[++i];
+      unit_hash = strcmp(name, "auto") == 0 ? nullptr : unit_hash_by_name(name);
+      if (!unit_hash && strcmp(name, "auto") != 0) {
+        fprintf(stderr,
+                "Invalid --hash value: %s (expected auto, murmur3, xxh or "
+                "crc32c)\n",
+                name);
+        return 1;
+      }
+      continue;
+    }
+    if (strcmp(arg, "--normalize") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing value for --normalize\n");
+        return 1;
+      }
+      if (!normalize_parse(argv[++i], &normalize_steps)) {
+        fprintf(stderr,
+                "Invalid --normalize value: %s (expected none or a comma "
+                "list of nfkc, casefold, unicode-space)\n",
+                argv[i]);
+        return 1;
+      }
       continue;
     }
     if (strcmp(arg, "--max-length") == 0) {
@@ -845,17 +3359,212 @@ int run_dedup(const char *prog, int argc, char **argv) {
       max_compare_len = parsed;
       continue;
     }
+    if (strcmp(arg, "--memory-limit") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing value for --memory-limit\n");
+        return 1;
+      }
+      if (!parse_byte_size_arg(argv[++i], &memory_limit) ||
+          memory_limit < SPILL_MIN_MEMORY_LIMIT) {
+        fprintf(stderr,
+                "Invalid --memory-limit value: %s (expected at least %zuM)\n",
+                argv[i], SPILL_MIN_MEMORY_LIMIT >> 20);
+        return 1;
+      }
+      continue;
+    }
+    if (strcmp(arg, "--bloom-filter") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing value for --bloom-filter\n");
+        return 1;
+      }
+      if (!parse_byte_size_arg(argv[++i], &bloom_bytes_arg) ||
+          bloom_bytes_arg < BLOOM_MIN_BYTES) {
+        fprintf(stderr,
+                "Invalid --bloom-filter value: %s (expected at least %zuK)\n",
+                argv[i], BLOOM_MIN_BYTES >> 10);
+        return 1;
+      }
+      continue;
+    }
+    if (strcmp(arg, "--input-format") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "--input-format requires one of: files, jsonl\n");
+        return 1;
+      }
+      const char *format = argv[++i];
+      if (strcmp(format, "jsonl") != 0 && strcmp(format, "files") != 0) {
+        fprintf(stderr,
+                "Invalid --input-format value: %s (expected files or "
+                "jsonl)\n",
+                format);
+        return 1;
+      }
+      jsonl = strcmp(format, "jsonl") == 0;
+      continue;
+    }
+    if (strcmp(arg, "--output-compression") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr,
+                "--output-compression requires one of: none, gzip, zstd\n");
+        return 1;
+      }
+      if (!compression_from_string(argv[++i], &compression.kind)) {
+        fprintf(stderr,
+                "Invalid --output-compression value: %s (expected none, "
+                "gzip or zstd)\n",
+                argv[i]);
+        return 1;
+      }
+      if (!compression_supported(compression.kind)) {
+        fprintf(stderr, "--output-compression %s: built without %s support\n",
+                argv[i], argv[i]);
+        return 1;
+      }
+      continue;
+    }
+    if (strcmp(arg, "--output-format") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "--output-format requires one of: files, shards\n");
+        return 1;
+      }
+      const char *format = argv[++i];
+      if (strcmp(format, "shards") != 0 && strcmp(format, "files") != 0) {
+        fprintf(stderr,
+                "Invalid --output-format value: %s (expected files or "
+                "shards)\n",
+                format);
+        return 1;
+      }
+      shard_output = strcmp(format, "shards") == 0;
+      continue;
+    }
+    if (strcmp(arg, "--shard-size") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing value for --shard-size\n");
+        return 1;
+      }
+      if (!parse_byte_size_arg(argv[++i], &shard_size) || shard_size == 0) {
+        fprintf(stderr, "Invalid --shard-size value: %s\n", argv[i]);
+        return 1;
+      }
+      continue;
+    }
+    if (strcmp(arg, "--level") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing value for --level\n");
+        return 1;
+      }
+      size_t parsed = 0;
+      if (!parse_size_arg(argv[++i], &parsed) || parsed == 0 ||
+          parsed > INT32_MAX) {
+        fprintf(stderr, "Invalid --level value: %s\n", argv[i]);
+        return 1;
+      }
+      compression.level = (int)parsed;
+      level_set = true;
+      continue;
+    }
+    if (strcmp(arg, "--text-field") == 0) {
+      if (i + 1 >= argc || argv[i + 1][0] == '\0') {
+        fprintf(stderr, "Missing name for --text-field\n");
+        return 1;
+      }
+      text_field = argv[++i];
+      continue;
+    }
+    if (strcmp(arg, "--min-span") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing value for --min-span\n");
+        return 1;
+      }
+      if (!parse_size_arg(argv[++i], &min_span) ||
+          min_span < SUBSTRING_MIN_SPAN) {
+        fprintf(stderr,
+                "Invalid --min-span value: %s (expected at least %zu)\n",
+                argv[i], SUBSTRING_MIN_SPAN);
+        return 1;
+      }
+      continue;
+    }
+    if (strcmp(arg, "--spill-dir") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing path for --spill-dir\n");
+        return 1;
+      }
+      spill_dir_arg = argv[++i];
+      continue;
+    }
+    if (strcmp(arg, "--partition") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing value for --partition\n");
+        return 1;
+      }
+      if (!partition_parse(argv[++i], &partition)) {
+        fprintf(stderr, "Invalid --partition value: %s (expected i/N)\n",
+                argv[i]);
+        return 1;
+      }
+      continue;
+    }
+    if (strcmp(arg, "--merge-partitions") == 0) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing value for --merge-partitions\n");
+        return 1;
+      }
+      size_t parsed = 0;
+      if (!parse_size_arg(argv[++i], &parsed) || parsed == 0 ||
+          parsed > UINT32_MAX) {
+        fprintf(stderr, "Invalid --merge-partitions value: %s\n", argv[i]);
+        return 1;
+      }
+      merge_count = (uint32_t)parsed;
+      continue;
+    }
+    const char **index_path = nullptr;
+    if (strcmp(arg, "--save-index") == 0) {
+      index_path = &save_index_path;
+    } else if (strcmp(arg, "--load-index") == 0) {
+      index_path = &load_index_path;
+    }
+    if (index_path) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing path for %s\n", arg);
+        return 1;
+      }
+      *index_path = argv[++i];
+      continue;
+    }
+    size_t *minhash_param = nullptr;
+    if (strcmp(arg, "--shingle") == 0) {
+      minhash_param = &shingle_words;
+    } else if (strcmp(arg, "--permutations") == 0) {
+      minhash_param = &permutations;
+    } else if (strcmp(arg, "--bands") == 0) {
+      minhash_param = &bands;
+    }
+    if (minhash_param) {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "Missing value for %s\n", arg);
+        return 1;
+      }
+      if (!parse_size_arg(argv[++i], minhash_param)) {
+        fprintf(stderr, "Invalid %s value: %s\n", arg, argv[i]);
+        return 1;
+      }
+      continue;
+    }
     if (strcmp(arg, "--dedup-mode") == 0) {
       if (i + 1 >= argc) {
         fprintf(stderr, "--dedup-mode requires one of: sentence, line, "
-                        "paragraph, document\n");
+                        "paragraph, document, near-document, substring\n");
         return 1;
       }
       const char *mode_arg = argv[++i];
       if (!parse_dedup_mode(mode_arg, &dedup_mode)) {
         fprintf(stderr,
                 "Invalid --dedup-mode value: %s (expected sentence, "
-                "line, paragraph, or document)\n",
+                "line, paragraph, document, near-document, or substring)\n",
                 mode_arg);
         return 1;
       }
@@ -888,6 +3597,124 @@ int run_dedup(const char *prog, int argc, char **argv) {
     return 1;
   }
 
+  bool near_document = dedup_mode == DEDUP_MODE_NEAR_DOCUMENT;
+  MinHasher minhash = {0};
+  if (near_document &&
+      !minhash_init(&minhash, shingle_words, permutations, bands)) {
+    fprintf(stderr,
+            "Invalid MinHash parameters: --shingle must be 1-%zu, "
+            "--permutations 1-%zu and a multiple of --bands\n",
+            MINHASH_MAX_SHINGLE_WORDS, MINHASH_MAX_PERMUTATIONS);
+    return 1;
+  }
+
+  // Substring mode keys windows rather than units, and --memory-limit is
+  // its per-pass budget.
+  bool substring = dedup_mode == DEDUP_MODE_SUBSTRING;
+  if (substring && (load_index_path || save_index_path || partition.count ||
+                    merge_count || bloom_bytes_arg || spill_dir_arg)) {
+    fprintf(stderr, "--dedup-mode substring cannot be combined with "
+                    "--load-index, --save-index, --partition, "
+                    "--merge-partitions, --bloom-filter or --spill-dir\n");
+    return 1;
+  }
+
+  // External mode keeps no index in memory, so it cannot consult or produce
+  // one, and near-document keys are per band rather than per unit.
+  bool external = memory_limit != 0 && !substring;
+  if (external && (near_document || load_index_path || save_index_path)) {
+    fprintf(stderr, "--memory-limit cannot be combined with near-document "
+                    "mode, --load-index or --save-index\n");
+    return 1;
+  }
+  if (!external && spill_dir_arg) {
+    fprintf(stderr, "--spill-dir requires --memory-limit\n");
+    return 1;
+  }
+  // Partitions agree on winners through sorted file positions, so partition
+  // runs are always deterministic.
+  bool partitioned = partition.count != 0;
+  bool merging = merge_count != 0;
+  if ((partitioned || merging) &&
+      (near_document || external || load_index_path || save_index_path)) {
+    fprintf(stderr, "--partition and --merge-partitions cannot be combined "
+                    "with near-document mode, --memory-limit, --load-index or "
+                    "--save-index\n");
+    return 1;
+  }
+  if (partitioned && merging) {
+    fprintf(stderr, "--partition and --merge-partitions are separate runs\n");
+    return 1;
+  }
+  if (partitioned && (write_duplicates || build_block_tree_flag)) {
+    fprintf(stderr, "--write-duplicates and --build-block-tree apply to the "
+                    "--merge-partitions run\n");
+    return 1;
+  }
+  if (partitioned)
+    deterministic = true;
+  // JSONL records are deduped as they stream past, so only the free-running
+  // in-memory index applies.
+  if (jsonl && (deterministic || external || merging || substring)) {
+    fprintf(stderr, "--input-format jsonl cannot be combined with "
+                    "--deterministic, --partition, --merge-partitions, "
+                    "--memory-limit or --dedup-mode substring\n");
+    return 1;
+  }
+  // First-seen inputs come from the free-running index; ordered modes
+  // resolve winners without one.
+  if (duplicates_metadata &&
+      (!write_duplicates || deterministic || external || merging ||
+       substring)) {
+    fprintf(stderr, "--duplicates-metadata requires --write-duplicates and "
+                    "cannot be combined with --deterministic, --partition, "
+                    "--merge-partitions, --memory-limit or --dedup-mode "
+                    "substring\n");
+    return 1;
+  }
+  if (files_from && recursive) {
+    fprintf(stderr, "--files-from lists the files itself; it cannot be "
+                    "combined with --recursive\n");
+    return 1;
+  }
+  // A manifest names its files; only an explicit mask filters it.
+  const char *manifest_mask = mask_set ? mask : nullptr;
+  if (jsonl && !mask_set)
+    mask = JSONL_DEFAULT_MASK;
+  // Shards hold raw documents at known offsets; JSONL already writes one
+  // output shard per input shard, and partition runs write no documents.
+  if (shard_output && (jsonl || partitioned ||
+                       compression.kind != COMPRESSION_NONE)) {
+    fprintf(stderr, "--output-format shards cannot be combined with "
+                    "--input-format jsonl, --partition or "
+                    "--output-compression\n");
+    return 1;
+  }
+  if (level_set && compression.kind == COMPRESSION_NONE) {
+    fprintf(stderr, "--level needs --output-compression gzip or zstd\n");
+    return 1;
+  }
+  if (!level_set) {
+    compression.level = compression_default_level(compression.kind);
+  } else if (compression.level > compression_max_level(compression.kind)) {
+    fprintf(stderr, "Invalid --level value: %d (%s accepts 1 to %d)\n",
+            compression.level, compression_name(compression.kind),
+            compression_max_level(compression.kind));
+    return 1;
+  }
+  if (bloom_bytes_arg != 0 && (near_document || external || merging)) {
+    fprintf(stderr, "--bloom-filter needs the in-memory unit index; it cannot "
+                    "be combined with near-document mode, --memory-limit or "
+                    "--merge-partitions\n");
+    return 1;
+  }
+
+  if (io_uring && !uring_io_available()) {
+    fprintf(stderr, "io_uring is not available here; falling back to "
+                    "--io-engine sync\n");
+    io_uring = false;
+  }
+
   if (!ensure_directory(input_dir, false)) {
     return 1;
   }
@@ -896,9 +3723,11 @@ int run_dedup(const char *prog, int argc, char **argv) {
     return 1;
   }
 
-  DIR *dir = opendir(input_dir);
-  if (!dir) {
-    fprintf(stderr, "Failed to open input directory: %s\n", input_dir);
+  // A recursive scan would pick up its own outputs.
+  if (recursive && path_within(output_dir, input_dir)) {
+    fprintf(stderr, "--recursive needs an output directory outside the "
+                    "input tree: %s\n",
+            output_dir);
     return 1;
   }
 
@@ -912,10 +3741,26 @@ int run_dedup(const char *prog, int argc, char **argv) {
   size_t items_count = 0;
   size_t items_cap = 0;
 
+  // LSH band keys are fingerprints, so near-document always uses that index.
+  bool fingerprint_index = fingerprint_only || near_document;
   SentenceSet seen = {0};
-  if (!sentence_set_init(&seen, 1024)) {
+  bool seen_ok = false;
+  if (external || merging || substring) {
+    seen_ok = true; // spill runs, winner lists or windows replace the index
+  } else if (deterministic) {
+    seen_ok = sentence_set_init_ordered(&seen, SENTENCE_SET_INIT_BUCKETS,
+                                        fingerprint_index);
+  } else if (duplicates_metadata) {
+    seen_ok = sentence_set_init_tagged(&seen, SENTENCE_SET_INIT_BUCKETS,
+                                       fingerprint_index);
+  } else {
+    seen_ok =
+        fingerprint_index
+            ? sentence_set_init_fingerprint(&seen, SENTENCE_SET_INIT_BUCKETS)
+            : sentence_set_init(&seen, SENTENCE_SET_INIT_BUCKETS);
+  }
+  if (!seen_ok) {
     fprintf(stderr, "Failed to allocate dedup index.\n");
-    closedir(dir);
     return 1;
   }
 
@@ -927,7 +3772,6 @@ int run_dedup(const char *prog, int argc, char **argv) {
     if (!duplicates_path) {
       fprintf(stderr, "Failed to allocate duplicates output path.\n");
       sentence_set_destroy(&seen);
-      closedir(dir);
       return 1;
     }
     duplicates_fp = fopen(duplicates_path, "wb");
@@ -935,7 +3779,6 @@ int run_dedup(const char *prog, int argc, char **argv) {
       fprintf(stderr, "Failed to open duplicates file: %s\n", duplicates_path);
       free(duplicates_path);
       sentence_set_destroy(&seen);
-      closedir(dir);
       return 1;
     }
     if (mtx_init(&duplicates_lock, mtx_plain) != thrd_success) {
@@ -943,77 +3786,103 @@ int run_dedup(const char *prog, int argc, char **argv) {
       fclose(duplicates_fp);
       free(duplicates_path);
       sentence_set_destroy(&seen);
-      closedir(dir);
       return 1;
     }
     duplicates_lock_init = true;
   }
 
-  struct dirent *entry;
-  while ((entry = readdir(dir)) != nullptr) {
-    const char *name = entry->d_name;
-    if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
-      continue;
-    }
-    if (fnmatch(mask, name, 0) != 0) {
-      continue;
-    }
-
-    char *input_path = join_path(input_dir, name);
-    if (!input_path) {
-      fprintf(stderr, "Failed to allocate input path for: %s\n", name);
-      errors++;
-      continue;
+  // Free-running modes take batches straight off the scan's bounded queue,
+  // so work starts at once and the file list never exceeds a few batches.
+  // Ordered modes need every name first and keep the batches' string pools;
+  // so does a manifest, to schedule by size.
+  bool ordered = deterministic || external || merging || substring;
+  bool streaming = !files_from && !ordered;
+  OutputMirror mirror = {.output_dir = output_dir};
+  ScanBatch **scan_batches = nullptr;
+  size_t scan_batch_count = 0;
+  size_t scan_batch_cap = 0;
+  DirScan *scan = nullptr;
+  if (files_from) {
+    Manifest manifest;
+    if (!manifest_load(files_from, input_dir, manifest_mask, &manifest)) {
+      abort_scan = true;
+    } else {
+      size_t count = manifest.files->count;
+      items = calloc(count ? count : 1, sizeof(*items));
+      if (!items) {
+        fprintf(stderr, "Failed to allocate file list.\n");
+        abort_scan = true;
+      } else {
+        items_from_batch(manifest.files, items);
+        for (size_t i = 0; i < count; ++i) {
+          items[i].size_hint = manifest.sizes[i];
+        }
+        items_count = count;
+        matched = count;
+      }
+      if (!keep_batch(&scan_batches, &scan_batch_count, &scan_batch_cap,
+                      manifest.files)) {
+        fprintf(stderr, "Failed to allocate file list.\n");
+        abort_scan = true;
+      }
+      free(manifest.sizes);
     }
-    if (!is_regular_file(input_path)) {
-      free(input_path);
-      continue;
+    if (!abort_scan && !shard_output &&
+        !mirror_parents(&mirror, items, items_count)) {
+      abort_scan = true;
     }
-    char *name_copy = dup_string(name);
-    if (!name_copy) {
-      fprintf(stderr, "Failed to allocate file name for: %s\n", name);
-      errors++;
-      free(input_path);
-      continue;
+  } else {
+    scan = dir_scan_start(input_dir, mask, recursive, detect_thread_count(),
+                          FILE_BATCH_SIZE,
+                          shard_output ? nullptr : mirror_output_dir, &mirror);
+    if (!scan) {
+      fprintf(stderr, "Failed to start scanning input directory: %s\n",
+              input_dir);
+      abort_scan = true;
     }
-
-    if (items_count == items_cap) {
-      size_t next_cap = 256;
-      if (items_cap != 0 && ckd_mul(&next_cap, items_cap, (size_t)2)) {
-        fprintf(stderr, "Failed to grow file list.\n");
-        free(name_copy);
-        free(input_path);
-        errors++;
-        break;
-      }
+  }
+  while (!abort_scan && scan && !streaming) {
+    ScanBatch *scanned = dir_scan_next(scan);
+    if (!scanned)
+      break;
+    size_t needed = items_count + scanned->count;
+    if (needed > items_cap) {
+      size_t next_cap = 0;
       size_t alloc_size = 0;
-      if (ckd_mul(&alloc_size, next_cap, sizeof(*items))) {
-        fprintf(stderr, "Failed to grow file list.\n");
-        free(name_copy);
-        free(input_path);
-        errors++;
-        break;
+      FileItem *next = nullptr;
+      if (!ckd_mul(&next_cap, needed, (size_t)2) &&
+          !ckd_mul(&alloc_size, next_cap, sizeof(*items))) {
+        next = realloc(items, alloc_size);
       }
-      FileItem *next = realloc(items, alloc_size);
       if (!next) {
         fprintf(stderr, "Failed to grow file list.\n");
-        free(name_copy);
-        free(input_path);
+        scan_batch_free(scanned);
         errors++;
         break;
       }
       items = next;
       items_cap = next_cap;
     }
-
-    items[items_count++] = (FileItem){.name = name_copy,
-                                      .input_path = input_path,
-                                      .raw_text = nullptr,
-                                      .byte_len = 0};
-    matched++;
+    if (!keep_batch(&scan_batches, &scan_batch_count, &scan_batch_cap,
+                    scanned)) {
+      fprintf(stderr, "Failed to grow file list.\n");
+      errors++;
+      break;
+    }
+    items_from_batch(scanned, items + items_count);
+    items_count = needed;
+    matched = needed;
+  }
+  if (!streaming) {
+    errors += dir_scan_finish(scan);
+    scan = nullptr;
   }
 
-  closedir(dir);
+  if (ordered && items_count > 1) {
+    qsort(items, items_count, sizeof(*items), compare_items_by_name);
+  } else if (files_from && items_count > 1) {
+    qsort(items, items_count, sizeof(*items), compare_items_by_size);
+  }
 
   BatchStats stats = {0};
   atomic_init(&stats.files_written, 0);
@@ -1023,6 +3892,16 @@ int run_dedup(const char *prog, int argc, char **argv) {
   atomic_init(&stats.errors, 0);
   atomic_init(&stats.processed, 0);
   atomic_init(&stats.bytes_processed, 0);
+  atomic_init(&stats.bloom_new, 0);
+  atomic_init(&stats.bloom_maybe, 0);
+  atomic_init(&stats.bloom_false_positives, 0);
+  atomic_init(&stats.bytes_removed, 0);
+  atomic_init(&stats.records, 0);
+  atomic_init(&stats.records_emptied, 0);
+  atomic_init(&stats.records_passed, 0);
+  atomic_init(&stats.records_malformed, 0);
+  atomic_init(&stats.output_raw_bytes, 0);
+  atomic_init(&stats.output_stored_bytes, 0);
 
   mtx_t progress_lock;
   bool progress_lock_init = false;
@@ -1042,50 +3921,247 @@ int run_dedup(const char *prog, int argc, char **argv) {
     tree_lock_init = true;
   }
 
-  if (!abort_scan && items_count > 0) {
+  // --hash auto follows a loaded index, and otherwise takes the family this
+  // CPU hashes fastest at the unit size. Where the fingerprint is the only
+  // equality test (no unit bytes in the index, spill runs or winner lists)
+  // it must be collision resistant as well.
+  bool hash_auto = unit_hash == nullptr;
+  bool fingerprint_keys = fingerprint_only || external || partitioned ||
+                          merging;
+  if (hash_auto)
+    unit_hash =
+        unit_hash_auto(dedup_mode == DEDUP_MODE_DOCUMENT, fingerprint_keys);
+  DedupIndexParams index_params = {
+      .fingerprint_only = fingerprint_index,
+      .dedup_mode = (uint32_t)dedup_mode,
+      .shingle_words = (uint32_t)minhash.shingle_words,
+      .permutations = (uint32_t)minhash.permutations,
+      .bands = (uint32_t)minhash.bands,
+      .unit_hash = unit_hash->id,
+      .max_compare_len = max_compare_len,
+      .normalize = normalize_steps};
+  PartitionLayout layout = {.params = index_params,
+                            .file_count = items_count};
+  for (size_t i = 0; (partitioned || merging) && i < items_count; ++i) {
+    layout.names_hash =
+        hash_bytes_fnv1a((const unsigned char *)items[i].name,
+                         strlen(items[i].name) + 1) ^
+        (layout.names_hash * 0x100000001B3ULL);
+  }
+  DedupIndex base_index = {0};
+  bool base_loaded = false;
+  if (!abort_scan && load_index_path) {
+    base_loaded = dedup_index_load(&base_index, load_index_path);
+    if (base_loaded && hash_auto) {
+      unit_hash = unit_hash_by_id(base_index.header.params.unit_hash);
+      index_params.unit_hash = unit_hash->id;
+    }
+    if (!base_loaded ||
+        !dedup_index_compatible(&base_index, &index_params, load_index_path)) {
+      abort_scan = true;
+    }
+  }
+  unit_hash_select(unit_hash);
+  normalize_select(normalize_steps);
+  BloomFilter bloom = {0};
+  bool bloom_loaded = false;
+  if (!abort_scan && bloom_bytes_arg != 0) {
+    bloom_loaded = bloom_init(&bloom, bloom_bytes_arg);
+    if (!bloom_loaded) {
+      fprintf(stderr, "Failed to allocate Bloom filter.\n");
+      abort_scan = true;
+    } else if (base_loaded) {
+      // Seed with the base keys so that "definitely new" also rules out the
+      // base index.
+      dedup_index_for_each_hash(&base_index, seed_bloom, &bloom);
+    }
+  }
+
+  ShardSet shards = {0};
+  bool shards_init = false;
+  if (!abort_scan && shard_output) {
+    shards_init = shard_set_init(&shards, output_dir, shard_size);
+    if (!shards_init) {
+      fprintf(stderr, "Failed to start shard output.\n");
+      abort_scan = true;
+    }
+  }
+
+  char *spill_dir = nullptr;
+  bool spill_dir_owned = false;
+  ExternalStats external_stats = {0};
+  SubstringStats substring_stats = {0};
+  UnitPositionList winners = {0};
+  if (!abort_scan && (external || merging || substring) && items_count > 0) {
+    double start_time = now_seconds();
+    WorkerContext ctx = {
+        .output_dir = output_dir,
+        .duplicates_fp = duplicates_fp,
+        .duplicates_lock = duplicates_lock_init ? &duplicates_lock : nullptr,
+        .build_tree = build_block_tree_flag,
+        .dedup_mode = dedup_mode,
+        .max_compare_len = max_compare_len,
+        .compression = &compression,
+        .shards = shards_init ? &shards : nullptr,
+        .stats = &stats,
+        .total_files = items_count,
+        .start_time = start_time,
+        .progress_lock = progress_lock_init ? &progress_lock : nullptr,
+        .tree_lock = tree_lock_init ? &tree_lock : nullptr};
+    atomic_init(&ctx.next_index, 0);
+    if (merging) {
+      if (!partition_merge(output_dir, merge_count, &layout, &winners) ||
+          !run_partition_merge(&ctx, items, items_count, &winners)) {
+        abort_scan = true;
+      }
+    } else if (substring) {
+      size_t budget = memory_limit ? memory_limit : SUBSTRING_DEFAULT_MEMORY;
+      if (!run_substring_dedup(&ctx, items, items_count, min_span, budget,
+                               &substring_stats)) {
+        abort_scan = true;
+      }
+    } else {
+      spill_dir_owned = !spill_dir_arg;
+      spill_dir = spill_dir_arg ? dup_string(spill_dir_arg)
+                                : join_path(output_dir, SPILL_DIRNAME);
+      if (!spill_dir || !ensure_directory(spill_dir, true)) {
+        spill_dir_owned = false;
+        abort_scan = true;
+      } else {
+        render_progress(0, items_count, 0, start_time);
+        if (!run_external_dedup(&ctx, items, items_count, spill_dir,
+                                memory_limit, &external_stats)) {
+          abort_scan = true;
+        }
+        fprintf(stderr, "\n");
+      }
+      if (spill_dir_owned && rmdir(spill_dir) != 0) {
+        fprintf(stderr, "Failed to remove spill directory: %s\n", spill_dir);
+        errors++;
+      }
+      free(spill_dir);
+    }
+    // Items stay in place across the passes; release them here.
+    for (size_t i = 0; i < items_count; ++i) {
+      free_file_item(&items[i]);
+    }
+  } else if (!abort_scan && (streaming || items_count > 0)) {
     FileItem *batch = calloc(FILE_BATCH_SIZE, sizeof(*batch));
     if (!batch) {
       fprintf(stderr, "Failed to allocate file batch.\n");
       abort_scan = true;
     } else {
       double start_time = now_seconds();
-      render_progress(0, items_count, 0, start_time);
-
-      for (size_t i = 0; i < items_count; i += FILE_BATCH_SIZE) {
-        size_t batch_count = items_count - i;
-        if (batch_count > FILE_BATCH_SIZE)
-          batch_count = FILE_BATCH_SIZE;
+      if (!streaming)
+        render_progress(0, items_count, 0, start_time);
 
-        for (size_t j = 0; j < batch_count; ++j) {
-          batch[j] = items[i + j];
-          items[i + j].name = nullptr;
-          items[i + j].input_path = nullptr;
+      size_t batch_count = 0;
+      for (size_t i = 0;; i += batch_count) {
+        ScanBatch *scanned = nullptr;
+        if (streaming) {
+          scanned = dir_scan_next(scan);
+          if (!scanned)
+            break;
+          batch_count = scanned->count;
+          items_from_batch(scanned, batch);
+          // The total grows as the scan finds more files.
+          matched += batch_count;
+          if (i == 0)
+            render_progress(0, matched, 0, start_time);
+        } else {
+          if (i >= items_count)
+            break;
+          batch_count = items_count - i;
+          if (batch_count > FILE_BATCH_SIZE)
+            batch_count = FILE_BATCH_SIZE;
+          memcpy(batch, items + i, batch_count * sizeof(*batch));
         }
 
-        if (!process_batch(batch, batch_count, output_dir, &seen, duplicates_fp,
+        if (!process_batch(batch, batch_count, i, output_dir, &seen,
+                           base_loaded ? &base_index : nullptr,
+                           bloom_loaded ? &bloom : nullptr, duplicates_fp,
                            duplicates_lock_init ? &duplicates_lock : nullptr,
                            build_block_tree_flag, dedup_mode, max_compare_len,
-                           &stats, items_count, start_time,
+                           near_document ? &minhash : nullptr,
+                           jsonl ? text_field : nullptr, &compression,
+                           shards_init ? &shards : nullptr, io_uring,
+                           partitioned ? &partition : nullptr,
+                           partitioned ? &winners : nullptr, &stats,
+                           streaming ? matched : items_count, start_time,
                            progress_lock_init ? &progress_lock : nullptr,
                            tree_lock_init ? &tree_lock : nullptr)) {
+          scan_batch_free(scanned);
           abort_scan = true;
           break;
         }
+        // Index tags of --duplicates-metadata point at the batch's names.
+        if (scanned && duplicates_metadata) {
+          if (!keep_batch(&scan_batches, &scan_batch_count, &scan_batch_cap,
+                          scanned)) {
+            fprintf(stderr, "Failed to grow file list.\n");
+            abort_scan = true;
+            break;
+          }
+        } else {
+          scan_batch_free(scanned);
+        }
       }
 
-      fprintf(stderr, "\n");
+      if (matched > 0)
+        fprintf(stderr, "\n");
       free(batch);
     }
   }
+  errors += dir_scan_finish(scan);
+
+  size_t shard_files = 0;
+  size_t shard_documents = 0;
+  char *shard_index_path = nullptr;
+  if (!abort_scan && shards_init) {
+    shard_index_path = join_path(output_dir, SHARD_INDEX_FILENAME);
+    if (!shard_index_path ||
+        !shard_set_finish(&shards, shard_index_path, &shard_files,
+                          &shard_documents)) {
+      errors++;
+    }
+  }
+  shard_set_destroy(&shards);
+
+  char *winners_path = nullptr;
+  if (!abort_scan && partitioned) {
+    winners_path =
+        partition_path(output_dir, partition.index, partition.count);
+    if (!winners_path ||
+        !partition_write(winners_path, &layout, &partition, &winners)) {
+      errors++;
+    }
+  }
+  size_t winner_count = winners.count;
+  unit_positions_free(&winners);
+
+  size_t index_saved = 0;
+  if (!abort_scan && save_index_path &&
+      !dedup_index_save(save_index_path, &seen,
+                        base_loaded ? &base_index : nullptr, &index_params,
+                        &index_saved)) {
+    errors++;
+    save_index_path = nullptr;
+  }
+  size_t index_loaded = dedup_index_size(&base_index);
+  dedup_index_close(&base_index);
+  size_t bloom_size = bloom_bytes(&bloom);
+  bloom_destroy(&bloom);
 
   if (abort_scan && items_count > 0) {
     for (size_t i = 0; i < items_count; ++i) {
-      free(items[i].raw_text);
-      free(items[i].name);
-      free(items[i].input_path);
+      free_file_item(&items[i]);
     }
   }
   free(items);
+  for (size_t i = 0; i < scan_batch_count; ++i) {
+    scan_batch_free(scan_batches[i]);
+  }
+  free(scan_batches);
   sentence_set_destroy(&seen);
   if (duplicates_lock_init) {
     mtx_destroy(&duplicates_lock);
@@ -1139,5 +4215,123 @@ int run_dedup(const char *prog, int argc, char **argv) {
          dedup_mode_name(dedup_mode), matched, files_written, files_empty,
          unit_label, unique_units, unit_label, duplicate_units, duplicate_pct,
          total_errors, elapsed_min, peak_mib);
+  if (near_document) {
+    printf("Near-duplicate index: %zu-word shingles, %zu permutations in %zu "
+           "bands of %zu rows, similarity threshold ~%.2f\n",
+           minhash.shingle_words, minhash.permutations, minhash.bands,
+           minhash.rows, minhash_threshold(&minhash));
+  }
+  if (bloom_loaded) {
+    size_t bloom_new =
+        atomic_load_explicit(&stats.bloom_new, memory_order_relaxed);
+    size_t bloom_maybe =
+        atomic_load_explicit(&stats.bloom_maybe, memory_order_relaxed);
+    size_t bloom_probes = bloom_new + bloom_maybe;
+    printf("Bloom prefilter: %.2f MiB, %zu definitely new (%.2f%%, per-file "
+           "and base probes skipped), %zu maybe seen",
+           (double)bloom_size / (1024.0 * 1024.0), bloom_new,
+           bloom_probes == 0 ? 0.0
+                             : (double)bloom_new * 100.0 / (double)bloom_probes,
+           bloom_maybe);
+    // Under --deterministic a maybe-seen unit can still win on order, so
+    // false positives are only measured in the free-running path.
+    if (!deterministic) {
+      size_t false_positives = atomic_load_explicit(
+          &stats.bloom_false_positives, memory_order_relaxed);
+      printf(" (%zu false positive(s))", false_positives);
+    }
+    printf("\n");
+  }
+  if (partitioned) {
+    printf("Partition %" PRIu32 "/%" PRIu32 ": %zu winner(s) written to %s\n",
+           partition.index, partition.count, winner_count,
+           winners_path ? winners_path : "(unknown)");
+  }
+  if (merging) {
+    printf("Merged %" PRIu32 " partition(s): %zu winner(s)\n", merge_count,
+           winner_count);
+  }
+  free(winners_path);
+  if (external) {
+    printf("External memory: budget %.2f MiB, %zu worker(s), %zu key "
+           "run(s), %zu loser run(s), %.2f MiB spilled\n",
+           (double)memory_limit / (1024.0 * 1024.0), external_stats.workers,
+           external_stats.key_runs, external_stats.loser_runs,
+           (double)external_stats.spilled_bytes / (1024.0 * 1024.0));
+  }
+  if (jsonl) {
+    printf("JSONL: %zu record(s), %zu dropped after dedup emptied \"%s\", "
+           "%zu passed through without it, %zu malformed passed through\n",
+           atomic_load_explicit(&stats.records, memory_order_relaxed),
+           atomic_load_explicit(&stats.records_emptied, memory_order_relaxed),
+           text_field,
+           atomic_load_explicit(&stats.records_passed, memory_order_relaxed),
+           atomic_load_explicit(&stats.records_malformed,
+                                memory_order_relaxed));
+  }
+  if (shard_output) {
+    printf("Shards: %zu document(s) in %zu shard file(s) of up to %.2f MiB, "
+           "%.2f MiB total, index %s\n",
+           shard_documents, shard_files,
+           (double)shard_size / (1024.0 * 1024.0),
+           (double)atomic_load_explicit(&stats.output_raw_bytes,
+                                        memory_order_relaxed) /
+               (1024.0 * 1024.0),
+           shard_index_path ? shard_index_path : "(unknown)");
+  }
+  free(shard_index_path);
+  if (compression.kind != COMPRESSION_NONE) {
+    size_t raw_bytes =
+        atomic_load_explicit(&stats.output_raw_bytes, memory_order_relaxed);
+    size_t stored_bytes =
+        atomic_load_explicit(&stats.output_stored_bytes, memory_order_relaxed);
+    printf("Output compression: %s level %d, %.2f MiB raw, %.2f MiB stored "
+           "(%.2f%%)\n",
+           compression_name(compression.kind), compression.level,
+           (double)raw_bytes / (1024.0 * 1024.0),
+           (double)stored_bytes / (1024.0 * 1024.0),
+           raw_bytes == 0 ? 0.0
+                          : (double)stored_bytes * 100.0 / (double)raw_bytes);
+  }
+  if (substring) {
+    size_t bytes_removed =
+        atomic_load_explicit(&stats.bytes_removed, memory_order_relaxed);
+    double normalized = (double)substring_stats.normalized_bytes;
+    printf("Substring dedup: min span %zu bytes, %zu pass(es), %zu repeated "
+           "window(s), removed %.2f of %.2f MiB (%.2f%%)\n",
+           min_span, substring_stats.passes, substring_stats.repeated_windows,
+           (double)bytes_removed / (1024.0 * 1024.0),
+           normalized / (1024.0 * 1024.0),
+           normalized == 0.0 ? 0.0
+                             : (double)bytes_removed * 100.0 / normalized);
+  }
+  if (load_index_path) {
+    printf("Index: seeded with %zu key(s) from %s\n", index_loaded,
+           load_index_path);
+  }
+  if (save_index_path) {
+    printf("Index: saved %zu key(s) to %s\n", index_saved, save_index_path);
+  }
+  if (!near_document && !substring && !merging)
+    printf("Unit hash: %s (%s)\n", unit_hash->name, unit_hash->impl);
+  if (normalize_steps != 0) {
+    char steps[64];
+    printf("Normalize: %s\n",
+           normalize_describe(normalize_steps, steps, sizeof(steps)));
+  }
+  if (!near_document && !substring && (fingerprint_only || external) &&
+      !unit_hash_collision_resistant(unit_hash)) {
+    printf("Fingerprint index: 128-bit %s keys are not collision resistant; "
+           "no collision estimate\n",
+           unit_hash->name);
+  } else if (!near_document && !substring && (fingerprint_only || external)) {
+    // Birthday bound: n distinct keys in a 2^128 space collide in roughly
+    // n^2 / 2^129 pairs; each collision would drop one unique unit.
+    double n = (double)unique_units;
+    double expected_collisions = ldexp(n * n, -129);
+    printf("Fingerprint index: 128-bit keys, expected collisions %.3g "
+           "(probability of any collision %.3g)\n",
+           expected_collisions, -expm1(-expected_collisions));
+  }
   return total_errors == 0 ? 0 : 1;
 }
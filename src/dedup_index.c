@@ -0,0 +1,366 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ckdint_compat.h"
+#include "dedup_index.h"
+
+static constexpr char INDEX_MAGIC[8] = {'C', 'D', 'D', 'X', 'I', 'N', 'D', 'X'};
+// Version 3 records --normalize; version 2 keys text units by hash_unit;
+// version 1 used FNV-1a, so only its fingerprint indexes still load.
+static constexpr uint32_t INDEX_VERSION = 3;
+static constexpr uint32_t INDEX_VERSION_UNIT = 2;
+static constexpr uint32_t INDEX_VERSION_FNV = 1;
+static constexpr size_t INDEX_MIN_SLOTS = 16;
+
+static_assert(sizeof(DedupIndexHeader) % 8 == 0,
+              "index slots must stay 8-byte aligned");
+
+// Versions 1 and 2 end the params at max_compare_len; everything after them
+// is laid out the same.
+static constexpr size_t LEGACY_PARAMS_SIZE =
+    offsetof(DedupIndexParams, normalize);
+static constexpr size_t LEGACY_HEADER_SIZE =
+    sizeof(DedupIndexHeader) - sizeof(DedupIndexParams) + LEGACY_PARAMS_SIZE;
+
+// Copy the header at the start of map into *header, widening older layouts
+// (which imply no normalization). False when it cannot be an index header.
+static bool read_header(const uint8_t *map, size_t map_len,
+                        DedupIndexHeader *header) {
+  constexpr size_t prefix = offsetof(DedupIndexHeader, params);
+  *header = (DedupIndexHeader){0};
+  memcpy(header, map, prefix);
+  if (memcmp(header->magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0)
+    return false;
+  if (header->version == INDEX_VERSION) {
+    if (header->header_size != sizeof(DedupIndexHeader) ||
+        map_len < sizeof(DedupIndexHeader))
+      return false;
+    memcpy(header, map, sizeof(DedupIndexHeader));
+    return true;
+  }
+  if ((header->version != INDEX_VERSION_UNIT &&
+       header->version != INDEX_VERSION_FNV) ||
+      header->header_size != LEGACY_HEADER_SIZE)
+    return false;
+  memcpy(&header->params, map + prefix, LEGACY_PARAMS_SIZE);
+  memcpy(&header->slot_count, map + prefix + LEGACY_PARAMS_SIZE,
+         LEGACY_HEADER_SIZE - prefix - LEGACY_PARAMS_SIZE);
+  return true;
+}
+
+// Same zero remapping as the in-memory set, so saved slot words line up with
+// freshly computed keys.
+static inline uint64_t key_hash(uint64_t hash) { return hash ? hash : 1; }
+static inline uint64_t key_fingerprint(uint64_t lo) { return lo ? lo : 1; }
+
+bool dedup_index_load(DedupIndex *index, const char *path) {
+  if (!index || !path)
+    return false;
+  *index = (DedupIndex){0};
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    fprintf(stderr, "Failed to open index: %s\n", path);
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) ||
+      (uintmax_t)st.st_size > SIZE_MAX ||
+      (size_t)st.st_size < LEGACY_HEADER_SIZE) {
+    fprintf(stderr, "Not a dedup index: %s\n", path);
+    close(fd);
+    return false;
+  }
+  size_t map_len = (size_t)st.st_size;
+  void *map = mmap(nullptr, map_len, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    fprintf(stderr, "Failed to map index: %s\n", path);
+    return false;
+  }
+#if defined(MADV_RANDOM)
+  madvise(map, map_len, MADV_RANDOM);
+#endif
+
+  DedupIndexHeader header;
+  bool known = read_header(map, map_len, &header);
+  if (known && header.version == INDEX_VERSION_FNV &&
+      !header.params.fingerprint_only) {
+    fprintf(stderr,
+            "Dedup index %s keys text units by an older hash; save it again "
+            "with this build\n",
+            path);
+    munmap(map, map_len);
+    return false;
+  }
+  size_t table_bytes = 0;
+  size_t expected = 0;
+  bool valid =
+      known && unit_hash_by_id(header.params.unit_hash) &&
+      header.slot_count >= INDEX_MIN_SLOTS &&
+      (header.slot_count & (header.slot_count - 1)) == 0 &&
+      !ckd_mul(&table_bytes, (size_t)header.slot_count,
+               2 * sizeof(uint64_t)) &&
+      !ckd_add(&expected, (size_t)header.header_size, table_bytes) &&
+      !ckd_add(&expected, expected, (size_t)header.blob_bytes) &&
+      expected == map_len;
+  if (!valid) {
+    fprintf(stderr, "Corrupt or unsupported dedup index: %s\n", path);
+    munmap(map, map_len);
+    return false;
+  }
+
+  index->map = map;
+  index->map_len = map_len;
+  index->header = header;
+  index->slots = (const uint64_t *)((const uint8_t *)map + header.header_size);
+  index->blob = (const uint8_t *)map + header.header_size + table_bytes;
+  index->slot_mask = (size_t)header.slot_count - 1;
+  return true;
+}
+
+void dedup_index_close(DedupIndex *index) {
+  if (!index)
+    return;
+  if (index->map)
+    munmap(index->map, index->map_len);
+  *index = (DedupIndex){0};
+}
+
+bool dedup_index_compatible(const DedupIndex *index,
+                            const DedupIndexParams *params, const char *path) {
+  const DedupIndexParams *saved = &index->header.params;
+  const char *what = nullptr;
+  if (saved->fingerprint_only != params->fingerprint_only) {
+    what = "key type (--fingerprint-only)";
+  } else if (saved->dedup_mode != params->dedup_mode) {
+    what = "--dedup-mode";
+  } else if (saved->unit_hash != params->unit_hash) {
+    what = "--hash";
+  } else if (saved->max_compare_len != params->max_compare_len) {
+    what = "--max-length";
+  } else if (saved->normalize != params->normalize) {
+    what = "--normalize";
+  } else if (saved->shingle_words != params->shingle_words ||
+             saved->permutations != params->permutations ||
+             saved->bands != params->bands) {
+    what = "MinHash parameters";
+  }
+  if (what) {
+    fprintf(stderr, "Index %s was built with a different %s\n", path, what);
+    return false;
+  }
+  return true;
+}
+
+size_t dedup_index_size(const DedupIndex *index) {
+  return index && index->map ? (size_t)index->header.entry_count : 0;
+}
+
+void dedup_index_for_each_hash(const DedupIndex *index,
+                               void (*visit)(void *ctx, uint64_t hash),
+                               void *ctx) {
+  if (!index || !index->map || !visit)
+    return;
+  for (size_t idx = 0; idx <= index->slot_mask; ++idx) {
+    uint64_t hash = index->slots[2 * idx];
+    if (hash != 0)
+      visit(ctx, hash);
+  }
+}
+
+// Bounds-checked view of one text entry in the blob.
+static bool blob_entry(const DedupIndex *index, uint64_t offset,
+                       const uint8_t **data, uint64_t *len) {
+  uint64_t blob_bytes = index->header.blob_bytes;
+  if (offset > blob_bytes || blob_bytes - offset < sizeof(uint64_t))
+    return false;
+  memcpy(len, index->blob + offset, sizeof(uint64_t));
+  if (*len > blob_bytes - offset - sizeof(uint64_t))
+    return false;
+  *data = index->blob + offset + sizeof(uint64_t);
+  return true;
+}
+
+bool dedup_index_contains_hashed(const DedupIndex *index, uint64_t hash,
+                                 const char8_t *data, size_t len) {
+  if (!index || !index->map || index->header.params.fingerprint_only)
+    return false;
+  uint64_t key = key_hash(hash);
+  size_t idx = key & index->slot_mask;
+  for (size_t probes = 0; probes <= index->slot_mask; ++probes) {
+    uint64_t slot = index->slots[2 * idx];
+    if (slot == 0)
+      return false;
+    const uint8_t *entry = nullptr;
+    uint64_t entry_len = 0;
+    if (slot == key &&
+        blob_entry(index, index->slots[2 * idx + 1], &entry, &entry_len) &&
+        entry_len == len && memcmp(entry, data, len) == 0) {
+      return true;
+    }
+    idx = (idx + 1) & index->slot_mask;
+  }
+  return false;
+}
+
+bool dedup_index_contains_fingerprint(const DedupIndex *index,
+                                      Hash128 fingerprint) {
+  if (!index || !index->map || !index->header.params.fingerprint_only)
+    return false;
+  uint64_t key = key_hash(fingerprint.hi);
+  uint64_t lo = key_fingerprint(fingerprint.lo);
+  size_t idx = key & index->slot_mask;
+  for (size_t probes = 0; probes <= index->slot_mask; ++probes) {
+    uint64_t slot = index->slots[2 * idx];
+    if (slot == 0)
+      return false;
+    if (slot == key && index->slots[2 * idx + 1] == lo)
+      return true;
+    idx = (idx + 1) & index->slot_mask;
+  }
+  return false;
+}
+
+typedef struct {
+  FILE *fp;
+  uint64_t *slots;
+  size_t slot_mask;
+  uint64_t blob_pos;
+  size_t entries;
+  bool fingerprint_only;
+} IndexWriter;
+
+static void writer_place(IndexWriter *writer, uint64_t hash,
+                         uint64_t payload) {
+  size_t idx = hash & writer->slot_mask;
+  while (writer->slots[2 * idx] != 0) {
+    idx = (idx + 1) & writer->slot_mask;
+  }
+  writer->slots[2 * idx] = hash;
+  writer->slots[2 * idx + 1] = payload;
+  writer->entries++;
+}
+
+static bool writer_add(void *ctx, uint64_t hash, uint64_t fingerprint,
+                       const char8_t *data, size_t len) {
+  auto writer = (IndexWriter *)ctx;
+  if (writer->fingerprint_only) {
+    writer_place(writer, hash, fingerprint);
+    return true;
+  }
+  // Pad entries to 8 bytes so every length word stays aligned.
+  static constexpr uint8_t padding[sizeof(uint64_t)] = {0};
+  uint64_t entry_len = len;
+  size_t pad = (sizeof(uint64_t) - len % sizeof(uint64_t)) % sizeof(uint64_t);
+  if (fwrite(&entry_len, sizeof(entry_len), 1, writer->fp) != 1 ||
+      fwrite(data, 1, len, writer->fp) != len ||
+      fwrite(padding, 1, pad, writer->fp) != pad) {
+    return false;
+  }
+  writer_place(writer, hash, writer->blob_pos);
+  writer->blob_pos += sizeof(entry_len) + len + pad;
+  return true;
+}
+
+static bool writer_add_base(IndexWriter *writer, const DedupIndex *base) {
+  for (size_t idx = 0; idx <= base->slot_mask; ++idx) {
+    uint64_t hash = base->slots[2 * idx];
+    if (hash == 0)
+      continue;
+    uint64_t payload = base->slots[2 * idx + 1];
+    if (writer->fingerprint_only) {
+      writer_place(writer, hash, payload);
+      continue;
+    }
+    const uint8_t *data = nullptr;
+    uint64_t len = 0;
+    if (!blob_entry(base, payload, &data, &len) ||
+        !writer_add(writer, hash, 0, data, (size_t)len)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool dedup_index_save(const char *path, const SentenceSet *set,
+                      const DedupIndex *base, const DedupIndexParams *params,
+                      size_t *out_entries) {
+  if (!path || !set || !params)
+    return false;
+
+  size_t total = sentence_set_size(set);
+  if (base && ckd_add(&total, total, dedup_index_size(base))) {
+    return false;
+  }
+  // Keep the table at most half full so misses stay short.
+  size_t slot_count = INDEX_MIN_SLOTS;
+  while (slot_count / 2 < total) {
+    if (ckd_mul(&slot_count, slot_count, (size_t)2))
+      return false;
+  }
+  size_t table_bytes = 0;
+  if (ckd_mul(&table_bytes, slot_count, 2 * sizeof(uint64_t)))
+    return false;
+
+  size_t path_len = strlen(path);
+  auto tmp_path = (char *)malloc(path_len + sizeof(".tmp"));
+  auto slots = (uint64_t *)calloc(slot_count, 2 * sizeof(uint64_t));
+  if (!tmp_path || !slots) {
+    fprintf(stderr, "Failed to allocate index table for: %s\n", path);
+    free(tmp_path);
+    free(slots);
+    return false;
+  }
+  memcpy(tmp_path, path, path_len);
+  memcpy(tmp_path + path_len, ".tmp", sizeof(".tmp"));
+
+  IndexWriter writer = {.fp = fopen(tmp_path, "wb"),
+                        .slots = slots,
+                        .slot_mask = slot_count - 1,
+                        .fingerprint_only = params->fingerprint_only != 0};
+  bool ok = writer.fp != nullptr;
+  if (!ok) {
+    fprintf(stderr, "Failed to open index for writing: %s\n", tmp_path);
+  }
+
+  // Stream the blob past the table, then fill the table in behind it.
+  ok = ok && fseeko(writer.fp, (off_t)(sizeof(DedupIndexHeader) + table_bytes),
+                    SEEK_SET) == 0;
+  ok = ok && (!base || writer_add_base(&writer, base));
+  ok = ok && sentence_set_for_each(set, writer_add, &writer);
+
+  DedupIndexHeader header = {.version = INDEX_VERSION,
+                             .header_size = sizeof(DedupIndexHeader),
+                             .params = *params,
+                             .slot_count = slot_count,
+                             .entry_count = writer.entries,
+                             .blob_bytes = writer.blob_pos};
+  memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+  ok = ok && fseeko(writer.fp, 0, SEEK_SET) == 0 &&
+       fwrite(&header, sizeof(header), 1, writer.fp) == 1 &&
+       fwrite(slots, sizeof(uint64_t), 2 * slot_count, writer.fp) ==
+           2 * slot_count;
+  if (writer.fp && fclose(writer.fp) != 0)
+    ok = false;
+  if (writer.fp && !ok)
+    fprintf(stderr, "Failed to write index: %s\n", tmp_path);
+  if (ok && rename(tmp_path, path) != 0) {
+    fprintf(stderr, "Failed to replace index: %s\n", path);
+    ok = false;
+  }
+  if (!ok && writer.fp)
+    remove(tmp_path);
+  free(tmp_path);
+  free(slots);
+  if (ok && out_entries)
+    *out_entries = writer.entries;
+  return ok;
+}
@@ -0,0 +1,551 @@
+#define _GNU_SOURCE
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <threads.h>
+#include <unistd.h>
+
+#include "ckdint_compat.h"
+#include "config.h"
+#include "dir_scan.h"
+#include "io_utils.h"
+
+struct DirScan {
+  char *root;
+  size_t root_len;
+  bool root_sep; // root needs a '/' before relative names
+  char *mask;
+  bool recursive;
+  size_t batch_size;
+  ScanDirHook on_dir;
+  void *hook_ctx;
+  mtx_t lock;
+  cnd_t work_ready;  // a directory was queued or the scan is over
+  cnd_t batch_ready; // a batch was queued or the last scanner exited
+  cnd_t space_ready; // the queue has room or the scan is stopping
+  bool sync_init;
+  char **dirs; // stack of directories to list, relative to root
+  size_t dir_count;
+  size_t dir_cap;
+  size_t active;  // directories queued or being listed
+  size_t running; // scanner threads that may still publish
+  ScanBatch *queue[DIR_SCAN_QUEUE_DEPTH]; // ring of published batches
+  size_t queue_head;
+  size_t queue_count;
+  atomic_bool stopping;
+  atomic_size_t errors;
+  thrd_t *threads;
+  size_t thread_count;
+};
+
+// State of one scanner thread: its getdents buffer and the batch it is
+// filling, published when full or before the thread goes idle.
+typedef struct {
+  DirScan *scan;
+  char *buffer;
+  ScanBatch *batch;
+} ScanWorker;
+
+#if defined(SYS_getdents64)
+// Record layout of getdents64(2).
+typedef struct {
+  uint64_t d_ino;
+  int64_t d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[];
+} DirEntry64;
+#endif
+
+static void count_error(DirScan *scan) {
+  atomic_fetch_add_explicit(&scan->errors, 1, memory_order_relaxed);
+}
+
+static char *join_rel(const char *rel, const char *name) {
+  return rel[0] == '\0' ? dup_string(name) : join_path(rel, name);
+}
+
+// d_type of name in dir_fd from fstatat, for file systems that do not
+// report it.
+static unsigned char stat_type(int dir_fd, const char *name, int flags) {
+  struct stat st;
+  if (fstatat(dir_fd, name, &st, flags) != 0)
+    return DT_UNKNOWN;
+  if (S_ISREG(st.st_mode))
+    return DT_REG;
+  if (S_ISDIR(st.st_mode))
+    return DT_DIR;
+  if (S_ISLNK(st.st_mode))
+    return DT_LNK;
+  return DT_UNKNOWN;
+}
+
+static ScanBatch *new_batch(size_t batch_size) {
+  auto batch = (ScanBatch *)calloc(1, sizeof(ScanBatch));
+  if (!batch)
+    return nullptr;
+  batch->entries = (ScanEntry *)malloc(batch_size * sizeof(ScanEntry));
+  batch->pool = arena_create(DIR_SCAN_POOL_BLOCK);
+  if (!batch->entries || !batch->pool) {
+    scan_batch_free(batch);
+    return nullptr;
+  }
+  return batch;
+}
+
+void scan_batch_free(ScanBatch *batch) {
+  if (!batch)
+    return;
+  free(batch->entries);
+  arena_destroy(batch->pool);
+  free(batch);
+}
+
+// Hand the worker's batch to the consumer, waiting while the queue is full.
+static void publish_batch(ScanWorker *worker) {
+  DirScan *scan = worker->scan;
+  ScanBatch *batch = worker->batch;
+  worker->batch = nullptr;
+  if (!batch)
+    return;
+  if (batch->count == 0) {
+    scan_batch_free(batch);
+    return;
+  }
+  mtx_lock(&scan->lock);
+  while (scan->queue_count == DIR_SCAN_QUEUE_DEPTH &&
+         !atomic_load_explicit(&scan->stopping, memory_order_relaxed)) {
+    cnd_wait(&scan->space_ready, &scan->lock);
+  }
+  if (atomic_load_explicit(&scan->stopping, memory_order_relaxed)) {
+    mtx_unlock(&scan->lock);
+    scan_batch_free(batch);
+    return;
+  }
+  size_t tail = (scan->queue_head + scan->queue_count) % DIR_SCAN_QUEUE_DEPTH;
+  scan->queue[tail] = batch;
+  scan->queue_count++;
+  cnd_signal(&scan->batch_ready);
+  mtx_unlock(&scan->lock);
+}
+
+static bool grow_dirs(DirScan *scan) {
+  if (scan->dir_count < scan->dir_cap)
+    return true;
+  size_t next_cap = scan->dir_cap ? scan->dir_cap : 32;
+  size_t bytes = 0;
+  if (ckd_mul(&next_cap, next_cap, (size_t)2) ||
+      ckd_mul(&bytes, next_cap, sizeof(char *)))
+    return false;
+  auto dirs = (char **)realloc(scan->dirs, bytes);
+  if (!dirs)
+    return false;
+  scan->dirs = dirs;
+  scan->dir_cap = next_cap;
+  return true;
+}
+
+static void push_dir(DirScan *scan, char *rel) {
+  mtx_lock(&scan->lock);
+  if (!grow_dirs(scan)) {
+    mtx_unlock(&scan->lock);
+    fprintf(stderr, "Failed to queue directory: %s\n", rel);
+    count_error(scan);
+    free(rel);
+    return;
+  }
+  scan->dirs[scan->dir_count++] = rel;
+  scan->active++;
+  cnd_signal(&scan->work_ready);
+  mtx_unlock(&scan->lock);
+}
+
+// Append rel/name to the worker's batch, with its path built straight in
+// the batch pool.
+static void add_entry(ScanWorker *worker, const char *rel, const char *name) {
+  DirScan *scan = worker->scan;
+  if (!worker->batch) {
+    worker->batch = new_batch(scan->batch_size);
+    if (!worker->batch) {
+      fprintf(stderr, "Failed to allocate file batch.\n");
+      count_error(scan);
+      return;
+    }
+  }
+  size_t rel_len = strlen(rel);
+  size_t name_len = strlen(name);
+  size_t prefix_len = scan->root_len + (scan->root_sep ? 1 : 0);
+  size_t len = prefix_len + rel_len + (rel_len ? 1 : 0) + name_len;
+  ScanBatch *batch = worker->batch;
+  auto path = (char *)arena_alloc(batch->pool, len + 1);
+  char *at = path;
+  memcpy(at, scan->root, scan->root_len);
+  at += scan->root_len;
+  if (scan->root_sep)
+    *at++ = '/';
+  if (rel_len) {
+    memcpy(at, rel, rel_len);
+    at += rel_len;
+    *at++ = '/';
+  }
+  memcpy(at, name, name_len + 1);
+  batch->entries[batch->count++] =
+      (ScanEntry){.name = path + prefix_len, .path = path};
+  if (batch->count == scan->batch_size)
+    publish_batch(worker);
+}
+
+static void visit_entry(ScanWorker *worker, int dir_fd, const char *rel,
+                        const char *name, unsigned char type) {
+  DirScan *scan = worker->scan;
+  if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0)
+    return;
+  if (type == DT_UNKNOWN)
+    type = stat_type(dir_fd, name, AT_SYMLINK_NOFOLLOW);
+  if (type == DT_LNK) {
+    // Files behind links are read as before; linked directories are not
+    // followed, so the tree cannot loop.
+    type = stat_type(dir_fd, name, 0);
+    if (type != DT_REG)
+      return;
+  }
+  if (type == DT_DIR && scan->recursive) {
+    char *child = join_rel(rel, name);
+    if (!child) {
+      count_error(scan);
+      return;
+    }
+    if (scan->on_dir && !scan->on_dir(scan->hook_ctx, child)) {
+      count_error(scan);
+      free(child);
+      return;
+    }
+    push_dir(scan, child);
+    return;
+  }
+  if (type == DT_REG && name_matches_mask(scan->mask, name))
+    add_entry(worker, rel, name);
+}
+
+static void list_directory(ScanWorker *worker, const char *rel) {
+  DirScan *scan = worker->scan;
+  char *dir_path =
+      rel[0] == '\0' ? dup_string(scan->root) : join_path(scan->root, rel);
+  int fd = dir_path ? open(dir_path, O_RDONLY | O_DIRECTORY | O_CLOEXEC) : -1;
+  if (fd < 0) {
+    fprintf(stderr, "Failed to open input directory: %s\n",
+            dir_path ? dir_path : rel);
+    count_error(scan);
+    free(dir_path);
+    return;
+  }
+#if defined(SYS_getdents64)
+  // getdents64 hands back d_type with each name, so files are classified
+  // without a stat, and one large buffer covers many entries per call.
+  for (;;) {
+    if (atomic_load_explicit(&scan->stopping, memory_order_relaxed))
+      break;
+    long got = syscall(SYS_getdents64, fd, worker->buffer, DIR_SCAN_BUFFER);
+    if (got < 0) {
+      fprintf(stderr, "Failed to read input directory: %s\n", dir_path);
+      count_error(scan);
+      break;
+    }
+    if (got == 0)
+      break;
+    for (long at = 0; at < got;) {
+      const DirEntry64 *entry = (const DirEntry64 *)(worker->buffer + at);
+      visit_entry(worker, fd, rel, entry->d_name, entry->d_type);
+      at += entry->d_reclen;
+    }
+  }
+  close(fd);
+#else
+  DIR *dir = fdopendir(fd);
+  if (!dir) {
+    fprintf(stderr, "Failed to open input directory: %s\n", dir_path);
+    count_error(scan);
+    close(fd);
+    free(dir_path);
+    return;
+  }
+  struct dirent *entry;
+  while (!atomic_load_explicit(&scan->stopping, memory_order_relaxed) &&
+         (entry = readdir(dir)) != nullptr) {
+    visit_entry(worker, dirfd(dir), rel, entry->d_name, entry->d_type);
+  }
+  closedir(dir);
+#endif
+  free(dir_path);
+}
+
+static int scan_worker(void *arg) {
+  ScanWorker worker = {.scan = (DirScan *)arg};
+  DirScan *scan = worker.scan;
+#if defined(SYS_getdents64)
+  worker.buffer = (char *)malloc(DIR_SCAN_BUFFER);
+  if (!worker.buffer) {
+    fprintf(stderr, "Failed to allocate directory buffer.\n");
+    count_error(scan);
+  }
+  bool can_list = worker.buffer != nullptr;
+#else
+  bool can_list = true;
+#endif
+  for (;;) {
+    mtx_lock(&scan->lock);
+    while (scan->dir_count == 0 && scan->active > 0 &&
+           !atomic_load_explicit(&scan->stopping, memory_order_relaxed)) {
+      // Never sit on a partial batch while other threads finish the tree.
+      if (worker.batch) {
+        mtx_unlock(&scan->lock);
+        publish_batch(&worker);
+        mtx_lock(&scan->lock);
+        continue;
+      }
+      cnd_wait(&scan->work_ready, &scan->lock);
+    }
+    if (!can_list || scan->dir_count == 0 ||
+        atomic_load_explicit(&scan->stopping, memory_order_relaxed)) {
+      mtx_unlock(&scan->lock);
+      break;
+    }
+    char *rel = scan->dirs[--scan->dir_count];
+    mtx_unlock(&scan->lock);
+
+    list_directory(&worker, rel);
+    free(rel);
+
+    mtx_lock(&scan->lock);
+    if (--scan->active == 0)
+      cnd_broadcast(&scan->work_ready);
+    mtx_unlock(&scan->lock);
+  }
+  publish_batch(&worker);
+  free(worker.buffer);
+
+  mtx_lock(&scan->lock);
+  if (--scan->running == 0) {
+    // The last scanner out ends the scan, even with directories left over
+    // after a failure.
+    cnd_broadcast(&scan->batch_ready);
+  }
+  mtx_unlock(&scan->lock);
+  return 0;
+}
+
+static void destroy_scan(DirScan *scan) {
+  for (size_t i = 0; i < scan->queue_count; ++i) {
+    scan_batch_free(
+        scan->queue[(scan->queue_head + i) % DIR_SCAN_QUEUE_DEPTH]);
+  }
+  for (size_t i = 0; i < scan->dir_count; ++i) {
+    free(scan->dirs[i]);
+  }
+  if (scan->sync_init) {
+    cnd_destroy(&scan->space_ready);
+    cnd_destroy(&scan->batch_ready);
+    cnd_destroy(&scan->work_ready);
+    mtx_destroy(&scan->lock);
+  }
+  free(scan->dirs);
+  free(scan->threads);
+  free(scan->root);
+  free(scan->mask);
+  free(scan);
+}
+
+static bool init_sync(DirScan *scan) {
+  if (mtx_init(&scan->lock, mtx_plain) != thrd_success)
+    return false;
+  if (cnd_init(&scan->work_ready) != thrd_success)
+    goto fail_lock;
+  if (cnd_init(&scan->batch_ready) != thrd_success)
+    goto fail_work;
+  if (cnd_init(&scan->space_ready) != thrd_success)
+    goto fail_batch;
+  scan->sync_init = true;
+  return true;
+fail_batch:
+  cnd_destroy(&scan->batch_ready);
+fail_work:
+  cnd_destroy(&scan->work_ready);
+fail_lock:
+  mtx_destroy(&scan->lock);
+  return false;
+}
+
+DirScan *dir_scan_start(const char *root, const char *mask, bool recursive,
+                        size_t thread_count, size_t batch_size,
+                        ScanDirHook on_dir, void *hook_ctx) {
+  if (batch_size == 0)
+    return nullptr;
+  if (thread_count == 0) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    thread_count = cpus > 0 ? (size_t)cpus : THREAD_COUNT_FALLBACK;
+  }
+  if (thread_count > DIR_SCAN_MAX_THREADS)
+    thread_count = DIR_SCAN_MAX_THREADS;
+  // A flat scan lists a single directory.
+  if (!recursive)
+    thread_count = 1;
+
+  auto scan = (DirScan *)calloc(1, sizeof(DirScan));
+  if (!scan)
+    return nullptr;
+  scan->recursive = recursive;
+  scan->batch_size = batch_size;
+  scan->on_dir = on_dir;
+  scan->hook_ctx = hook_ctx;
+  atomic_init(&scan->stopping, false);
+  atomic_init(&scan->errors, 0);
+  scan->root = dup_string(root);
+  scan->mask = dup_string(mask);
+  scan->threads = (thrd_t *)calloc(thread_count, sizeof(thrd_t));
+  char *top = dup_string("");
+  if (!scan->root || !scan->mask || !scan->threads || !top ||
+      !grow_dirs(scan) || !init_sync(scan)) {
+    free(top);
+    destroy_scan(scan);
+    return nullptr;
+  }
+  scan->root_len = strlen(scan->root);
+  scan->root_sep = scan->root_len > 0 && scan->root[scan->root_len - 1] != '/';
+  scan->dirs[scan->dir_count++] = top;
+  scan->active = 1;
+  for (; scan->thread_count < thread_count; ++scan->thread_count) {
+    mtx_lock(&scan->lock);
+    scan->running++;
+    mtx_unlock(&scan->lock);
+    if (thrd_create(&scan->threads[scan->thread_count], scan_worker, scan) !=
+        thrd_success) {
+      mtx_lock(&scan->lock);
+      scan->running--;
+      mtx_unlock(&scan->lock);
+      break;
+    }
+  }
+  if (scan->thread_count == 0) {
+    fprintf(stderr, "Failed to start directory scan threads.\n");
+    destroy_scan(scan);
+    return nullptr;
+  }
+  return scan;
+}
+
+ScanBatch *dir_scan_next(DirScan *scan) {
+  mtx_lock(&scan->lock);
+  while (scan->queue_count == 0 && scan->running > 0) {
+    cnd_wait(&scan->batch_ready, &scan->lock);
+  }
+  ScanBatch *batch = nullptr;
+  if (scan->queue_count > 0) {
+    batch = scan->queue[scan->queue_head];
+    scan->queue_head = (scan->queue_head + 1) % DIR_SCAN_QUEUE_DEPTH;
+    scan->queue_count--;
+    cnd_signal(&scan->space_ready);
+  }
+  mtx_unlock(&scan->lock);
+  return batch;
+}
+
+size_t dir_scan_finish(DirScan *scan) {
+  if (!scan)
+    return 0;
+  mtx_lock(&scan->lock);
+  atomic_store_explicit(&scan->stopping, true, memory_order_relaxed);
+  cnd_broadcast(&scan->work_ready);
+  cnd_broadcast(&scan->space_ready);
+  mtx_unlock(&scan->lock);
+  for (size_t i = 0; i < scan->thread_count; ++i) {
+    thrd_join(scan->threads[i], nullptr);
+  }
+  size_t errors = atomic_load_explicit(&scan->errors, memory_order_relaxed);
+  destroy_scan(scan);
+  return errors;
+}
+
+static int compare_entries(const void *a, const void *b) {
+  return strcmp(((const ScanEntry *)a)->name, ((const ScanEntry *)b)->name);
+}
+
+// Take ownership of batch and add its entries to the listing.
+static bool append_batch(ScanListing *listing, size_t *batch_cap,
+                         size_t *entry_cap, ScanBatch *batch) {
+  if (listing->batch_count == *batch_cap) {
+    size_t next_cap = *batch_cap ? *batch_cap * 2 : 16;
+    auto batches = (ScanBatch **)realloc(listing->batches,
+                                         next_cap * sizeof(ScanBatch *));
+    if (!batches) {
+      scan_batch_free(batch);
+      return false;
+    }
+    listing->batches = batches;
+    *batch_cap = next_cap;
+  }
+  listing->batches[listing->batch_count++] = batch;
+  size_t needed = 0;
+  if (ckd_add(&needed, listing->count, batch->count))
+    return false;
+  if (needed > *entry_cap) {
+    size_t next_cap = 0;
+    size_t bytes = 0;
+    if (ckd_mul(&next_cap, needed, (size_t)2) ||
+        ckd_mul(&bytes, next_cap, sizeof(ScanEntry)))
+      return false;
+    auto entries = (ScanEntry *)realloc(listing->entries, bytes);
+    if (!entries)
+      return false;
+    listing->entries = entries;
+    *entry_cap = next_cap;
+  }
+  memcpy(listing->entries + listing->count, batch->entries,
+         batch->count * sizeof(ScanEntry));
+  listing->count = needed;
+  return true;
+}
+
+bool dir_scan_collect(const char *root, const char *mask, bool recursive,
+                      ScanListing *listing, size_t *errors) {
+  *listing = (ScanListing){0};
+  DirScan *scan = dir_scan_start(root, mask, recursive, 0,
+                                 DIR_SCAN_COLLECT_BATCH, nullptr, nullptr);
+  if (!scan)
+    return false;
+  size_t batch_cap = 0;
+  size_t entry_cap = 0;
+  bool ok = true;
+  ScanBatch *batch;
+  while ((batch = dir_scan_next(scan)) != nullptr) {
+    if (!append_batch(listing, &batch_cap, &entry_cap, batch)) {
+      fprintf(stderr, "Failed to grow file list.\n");
+      ok = false;
+      break;
+    }
+  }
+  *errors += dir_scan_finish(scan);
+  if (!ok) {
+    scan_listing_free(listing);
+    return false;
+  }
+  if (listing->count > 1)
+    qsort(listing->entries, listing->count, sizeof(ScanEntry),
+          compare_entries);
+  return true;
+}
+
+void scan_listing_free(ScanListing *listing) {
+  for (size_t i = 0; i < listing->batch_count; ++i) {
+    scan_batch_free(listing->batches[i]);
+  }
+  free(listing->batches);
+  free(listing->entries);
+  *listing = (ScanListing){0};
+}
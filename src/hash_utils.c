@@ -1,3 +1,11 @@
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define HASH_UTILS_X86 1
+#include <immintrin.h>
+#endif
+
+#include <string.h>
+#include <threads.h>
+
 #include "hash_utils.h"
 
 uint64_t hash_bytes_fnv1a(const unsigned char *data, size_t len) {
@@ -8,3 +16,620 @@ uint64_t hash_bytes_fnv1a(const unsigned char *data, size_t len) {
   }
   return hash;
 }
+
+static inline uint64_t rotl64(uint64_t x, unsigned int r) {
+  return (x << r) | (x >> (64u - r));
+}
+
+static inline uint64_t load64(const unsigned char *p) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  return v;
+}
+
+static inline uint64_t fmix64(uint64_t k) {
+  k ^= k >> 33;
+  k *= 0xFF51AFD7ED558CCDULL;
+  k ^= k >> 33;
+  k *= 0xC4CEB9FE1A85EC53ULL;
+  k ^= k >> 33;
+  return k;
+}
+
+static inline uint64_t load32(const unsigned char *p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap32(v);
+#endif
+  return v;
+}
+
+// The words of the last len % 16 bytes at tail zero-padded to a block,
+// read with overlapping loads that stay inside the tail.
+static inline void load_tail(const unsigned char *tail, size_t len,
+                             uint64_t *w0, uint64_t *w1) {
+  size_t rem = len & 15;
+  *w1 = 0;
+  if (rem >= 8) {
+    *w0 = load64(tail);
+    if (rem > 8)
+      *w1 = load64(tail + rem - 8) >> (8 * (16 - rem));
+  } else if (rem >= 4) {
+    *w0 = load32(tail) | (load32(tail + rem - 4) >> (8 * (8 - rem)) << 32);
+  } else if (rem > 0) {
+    *w0 = (uint64_t)tail[0] | (uint64_t)tail[rem / 2] << (8 * (rem / 2)) |
+          (uint64_t)tail[rem - 1] << (8 * (rem - 1));
+  } else {
+    *w0 = 0;
+  }
+}
+
+// MurmurHash3 x64-128; lane 0 and 1 are h1 and h2.
+static constexpr uint64_t MURMUR_C1 = 0x87C37B91114253D5ULL;
+static constexpr uint64_t MURMUR_C2 = 0x4CF5AD432745937FULL;
+static constexpr uint64_t MURMUR_SEED = 0x9E3779B97F4A7C15ULL;
+
+static inline void murmur_start(UnitHashState *state) {
+  *state = (UnitHashState){.lane = {MURMUR_SEED, MURMUR_SEED}};
+}
+
+static inline void murmur_blocks(UnitHashState *state,
+                                 const unsigned char *data, size_t count) {
+  uint64_t h1 = state->lane[0];
+  uint64_t h2 = state->lane[1];
+  for (size_t i = 0; i < count; ++i, data += 16) {
+    uint64_t k1 = load64(data);
+    uint64_t k2 = load64(data + 8);
+
+    k1 *= MURMUR_C1;
+    k1 = rotl64(k1, 31);
+    k1 *= MURMUR_C2;
+    h1 ^= k1;
+    h1 = rotl64(h1, 27);
+    h1 += h2;
+    h1 = h1 * 5 + 0x52DCE729;
+
+    k2 *= MURMUR_C2;
+    k2 = rotl64(k2, 33);
+    k2 *= MURMUR_C1;
+    h2 ^= k2;
+    h2 = rotl64(h2, 31);
+    h2 += h1;
+    h2 = h2 * 5 + 0x38495AB5;
+  }
+  state->lane[0] = h1;
+  state->lane[1] = h2;
+  state->blocks += count;
+}
+
+static inline Hash128 murmur_finish(const UnitHashState *state,
+                                    const unsigned char *tail, size_t len) {
+  uint64_t h1 = state->lane[0];
+  uint64_t h2 = state->lane[1];
+  uint64_t k1 = 0;
+  uint64_t k2 = 0;
+  // Zero padding leaves the words as the byte-wise tail loop builds them.
+  load_tail(tail, len, &k1, &k2);
+  if ((len & 15) > 8) {
+    k2 *= MURMUR_C2;
+    k2 = rotl64(k2, 33);
+    k2 *= MURMUR_C1;
+    h2 ^= k2;
+  }
+  if ((len & 15) > 0) {
+    k1 *= MURMUR_C1;
+    k1 = rotl64(k1, 31);
+    k1 *= MURMUR_C2;
+    h1 ^= k1;
+  }
+
+  h1 ^= (uint64_t)len;
+  h2 ^= (uint64_t)len;
+  h1 += h2;
+  h2 += h1;
+  h1 = fmix64(h1);
+  h2 = fmix64(h2);
+  h1 += h2;
+  h2 += h1;
+  return (Hash128){.hi = h1, .lo = h2};
+}
+
+static Hash128 murmur_hash(const unsigned char *data, size_t len) {
+  UnitHashState state;
+  murmur_start(&state);
+  murmur_blocks(&state, data, len / 16);
+  return murmur_finish(&state, data + len / 16 * 16, len);
+}
+
+Hash128 hash_bytes_128(const unsigned char *data, size_t len) {
+  return murmur_hash(data, len);
+}
+
+// xxh: XXH3-style accumulation. Even blocks feed lanes 0-1 and odd blocks
+// lanes 2-3; each 64-bit word adds the product of the halves of itself
+// xor a secret word to its lane and itself to the other lane of the pair.
+// The lanes are scrambled every XXH_SCRAMBLE_BLOCKS blocks and folded with
+// 128-bit multiplies at the end. Not bit-compatible with XXH3.
+static constexpr uint64_t XXH_SECRET[8] = {
+    0xBE4BA423396CFEB8ULL, 0x1CAD21F72C81017CULL, 0xDB979083E96DD4DEULL,
+    0x1F67B3B7A4A44072ULL, 0x78E5C0CC4EE679CBULL, 0x2172FFCC7DD05A82ULL,
+    0x8E2443F7744608B8ULL, 0x4C263A81E69035E0ULL};
+static constexpr uint64_t XXH_PRIME32 = 0x9E3779B1ULL;
+static constexpr uint64_t XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static constexpr uint64_t XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static constexpr uint64_t XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+static constexpr uint64_t XXH_SCRAMBLE_BLOCKS = 64;
+
+static inline void xxh_start(UnitHashState *state) {
+  *state = (UnitHashState){
+      .lane = {0xC2B2AE3DULL, XXH_PRIME64_1, XXH_PRIME64_2, XXH_PRIME64_3}};
+}
+
+static inline void xxh_scramble(uint64_t *lane) {
+  for (size_t i = 0; i < 4; ++i) {
+    uint64_t acc = lane[i];
+    acc ^= acc >> 47;
+    acc ^= XXH_SECRET[4 + i];
+    lane[i] = acc * XXH_PRIME32;
+  }
+}
+
+static inline void xxh_blocks_scalar(UnitHashState *state,
+                                     const unsigned char *data,
+                                     size_t count) {
+  for (size_t i = 0; i < count; ++i, data += 16) {
+    uint64_t block = state->blocks++;
+    uint64_t *pair = state->lane + 2 * (block & 1);
+    const uint64_t *secret = XXH_SECRET + 2 * (block & 3);
+    uint64_t w0 = load64(data);
+    uint64_t w1 = load64(data + 8);
+    uint64_t k0 = w0 ^ secret[0];
+    uint64_t k1 = w1 ^ secret[1];
+    pair[0] += (k0 & 0xFFFFFFFFULL) * (k0 >> 32) + w1;
+    pair[1] += (k1 & 0xFFFFFFFFULL) * (k1 >> 32) + w0;
+    if (state->blocks % XXH_SCRAMBLE_BLOCKS == 0)
+      xxh_scramble(state->lane);
+  }
+}
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 uint128_t;
+
+// Fold the 128-bit product of a and b to 64 bits.
+static inline uint64_t mul_fold64(uint64_t a, uint64_t b) {
+  uint128_t product = (uint128_t)a * b;
+  return (uint64_t)product ^ (uint64_t)(product >> 64);
+}
+#else
+static inline uint64_t mul_fold64(uint64_t a, uint64_t b) {
+  uint64_t a_lo = a & 0xFFFFFFFFULL;
+  uint64_t a_hi = a >> 32;
+  uint64_t b_lo = b & 0xFFFFFFFFULL;
+  uint64_t b_hi = b >> 32;
+  uint64_t lo_lo = a_lo * b_lo;
+  uint64_t hi_lo = a_hi * b_lo;
+  uint64_t lo_hi = a_lo * b_hi;
+  uint64_t hi_hi = a_hi * b_hi;
+  uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+  uint64_t upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+  uint64_t lower = (cross << 32) | (lo_lo & 0xFFFFFFFFULL);
+  return lower ^ upper;
+}
+#endif
+
+static inline uint64_t xxh_avalanche(uint64_t h) {
+  h ^= h >> 37;
+  h *= 0x165667919E3779F9ULL;
+  h ^= h >> 32;
+  return h;
+}
+
+static inline Hash128 xxh_finish(const UnitHashState *state,
+                                 const unsigned char *tail, size_t len) {
+  const uint64_t *acc = state->lane;
+  uint64_t t0 = 0;
+  uint64_t t1 = 0;
+  load_tail(tail, len, &t0, &t1);
+  uint64_t n = (uint64_t)len * XXH_PRIME64_1;
+  // Each word of the tail reaches both halves through different products,
+  // so one zero product cannot erase it.
+  uint64_t h1 =
+      mul_fold64(acc[0] ^ XXH_SECRET[0] ^ t0, acc[1] ^ XXH_SECRET[1] ^ t1) +
+      mul_fold64(acc[2] ^ XXH_SECRET[2], acc[3] ^ XXH_SECRET[3]) + n;
+  uint64_t h2 =
+      (mul_fold64(acc[2] ^ XXH_SECRET[4] ^ t1, acc[3] ^ XXH_SECRET[5] ^ t0) +
+       mul_fold64(acc[0] ^ XXH_SECRET[6], acc[1] ^ XXH_SECRET[7])) ^
+      rotl64(n, 32);
+  uint64_t hi = xxh_avalanche(h1 + h2);
+  return (Hash128){.hi = hi, .lo = xxh_avalanche(h2 ^ rotl64(hi, 29))};
+}
+
+static Hash128 xxh_hash_scalar(const unsigned char *data, size_t len) {
+  UnitHashState state;
+  xxh_start(&state);
+  xxh_blocks_scalar(&state, data, len / 16);
+  return xxh_finish(&state, data + len / 16 * 16, len);
+}
+
+// CRC32C: four CRC lanes over each block, two on its words and two on their
+// sum and difference so the state is not linear in the input, finished
+// with the Murmur3 mixer. Bytes enter the CRCs in little-endian order.
+static uint32_t crc32c_table[256];
+
+static void build_crc32c_table(void) {
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+    }
+    crc32c_table[i] = crc;
+  }
+}
+
+static inline uint64_t crc32c_word(uint64_t crc, uint64_t word) {
+  auto c = (uint32_t)crc;
+  for (int i = 0; i < 8; ++i, word >>= 8) {
+    c = crc32c_table[(c ^ (uint32_t)word) & 0xFFu] ^ (c >> 8);
+  }
+  return c;
+}
+
+static inline void crc32c_start(UnitHashState *state) {
+  *state = (UnitHashState){
+      .lane = {0x9E3779B9ULL, 0x3C6EF372ULL, 0xDAA66D2BULL, 0x78DDE6E4ULL}};
+}
+
+static inline void crc32c_block_scalar(uint64_t *c, uint64_t w0,
+                                       uint64_t w1) {
+  c[0] = crc32c_word(c[0], w0);
+  c[1] = crc32c_word(c[1], w1);
+  c[2] = crc32c_word(c[2], w0 + w1);
+  c[3] = crc32c_word(c[3], w0 - rotl64(w1, 32));
+}
+
+static inline void crc32c_blocks_scalar(UnitHashState *state,
+                                        const unsigned char *data,
+                                        size_t count) {
+  uint64_t c[4] = {state->lane[0], state->lane[1], state->lane[2],
+                   state->lane[3]};
+  for (size_t i = 0; i < count; ++i, data += 16) {
+    crc32c_block_scalar(c, load64(data), load64(data + 8));
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    state->lane[i] = c[i];
+  }
+  state->blocks += count;
+}
+
+static inline Hash128 crc32c_mix(const uint64_t *c, size_t len) {
+  uint64_t a = ((c[0] << 32) | c[1]) ^ ((uint64_t)len * XXH_PRIME64_1);
+  uint64_t b = (c[2] << 32) | c[3];
+  uint64_t hi = fmix64(a ^ rotl64(b, 32));
+  return (Hash128){.hi = hi, .lo = fmix64(b ^ hi)};
+}
+
+static inline Hash128 crc32c_finish_scalar(const UnitHashState *state,
+                                           const unsigned char *tail,
+                                           size_t len) {
+  uint64_t c[4] = {state->lane[0], state->lane[1], state->lane[2],
+                   state->lane[3]};
+  if (len & 15) {
+    uint64_t w0 = 0;
+    uint64_t w1 = 0;
+    load_tail(tail, len, &w0, &w1);
+    crc32c_block_scalar(c, w0, w1);
+  }
+  return crc32c_mix(c, len);
+}
+
+static Hash128 crc32c_hash_scalar(const unsigned char *data, size_t len) {
+  UnitHashState state;
+  crc32c_start(&state);
+  crc32c_blocks_scalar(&state, data, len / 16);
+  return crc32c_finish_scalar(&state, data + len / 16 * 16, len);
+}
+
+#if defined(HASH_UTILS_X86)
+// The xxh accumulation on one pair of lanes.
+static inline __m128i xxh_accumulate128(__m128i acc, __m128i data,
+                                        __m128i secret) {
+  __m128i key = _mm_xor_si128(data, secret);
+  __m128i key_hi = _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1));
+  __m128i product = _mm_mul_epu32(key, key_hi);
+  __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+  return _mm_add_epi64(acc, _mm_add_epi64(product, swapped));
+}
+
+static inline __m128i xxh_scramble128(__m128i acc, __m128i secret) {
+  const __m128i prime = _mm_set1_epi32((int)XXH_PRIME32);
+  acc = _mm_xor_si128(acc, _mm_srli_epi64(acc, 47));
+  acc = _mm_xor_si128(acc, secret);
+  __m128i lo = _mm_mul_epu32(acc, prime);
+  __m128i hi = _mm_mul_epu32(_mm_srli_epi64(acc, 32), prime);
+  return _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
+}
+
+// One block on its pair of lanes. The vector paths take single blocks here
+// rather than in xxh_blocks_scalar, so no call leaves them with the upper
+// AVX state dirty.
+static inline void xxh_block128(UnitHashState *state,
+                                const unsigned char *data) {
+  uint64_t block = state->blocks++;
+  uint64_t *pair = state->lane + 2 * (block & 1);
+  __m128i acc = xxh_accumulate128(
+      _mm_loadu_si128((const __m128i *)pair),
+      _mm_loadu_si128((const __m128i *)data),
+      _mm_loadu_si128((const __m128i *)(XXH_SECRET + 2 * (block & 3))));
+  _mm_storeu_si128((__m128i *)pair, acc);
+  if (state->blocks % XXH_SCRAMBLE_BLOCKS == 0)
+    xxh_scramble(state->lane);
+}
+
+static inline void xxh_blocks_sse2(UnitHashState *state,
+                                   const unsigned char *data, size_t count) {
+  if (count > 0 && (state->blocks & 1)) {
+    xxh_block128(state, data);
+    data += 16;
+    count--;
+  }
+  __m128i even = _mm_loadu_si128((const __m128i *)state->lane);
+  __m128i odd = _mm_loadu_si128((const __m128i *)(state->lane + 2));
+  const __m128i *secret = (const __m128i *)XXH_SECRET;
+  for (; count >= 2; count -= 2, data += 32) {
+    size_t half = (state->blocks & 2) ? 2 : 0;
+    even = xxh_accumulate128(even, _mm_loadu_si128((const __m128i *)data),
+                             _mm_loadu_si128(secret + half));
+    odd = xxh_accumulate128(odd, _mm_loadu_si128((const __m128i *)(data + 16)),
+                            _mm_loadu_si128(secret + half + 1));
+    state->blocks += 2;
+    if (state->blocks % XXH_SCRAMBLE_BLOCKS == 0) {
+      even = xxh_scramble128(even, _mm_loadu_si128(secret + 2));
+      odd = xxh_scramble128(odd, _mm_loadu_si128(secret + 3));
+    }
+  }
+  _mm_storeu_si128((__m128i *)state->lane, even);
+  _mm_storeu_si128((__m128i *)(state->lane + 2), odd);
+  if (count > 0)
+    xxh_block128(state, data);
+}
+
+static Hash128 xxh_hash_sse2(const unsigned char *data, size_t len) {
+  UnitHashState state;
+  xxh_start(&state);
+  xxh_blocks_sse2(&state, data, len / 16);
+  return xxh_finish(&state, data + len / 16 * 16, len);
+}
+
+// Both pairs of lanes in one register, two blocks per step.
+__attribute__((target("avx2"))) static inline void
+xxh_blocks_avx2(UnitHashState *state, const unsigned char *data,
+                size_t count) {
+  if (count > 0 && (state->blocks & 1)) {
+    xxh_block128(state, data);
+    data += 16;
+    count--;
+  }
+  const __m256i prime = _mm256_set1_epi32((int)XXH_PRIME32);
+  const __m256i *secret = (const __m256i *)XXH_SECRET;
+  __m256i acc = _mm256_loadu_si256((const __m256i *)state->lane);
+  for (; count >= 2; count -= 2, data += 32) {
+    __m256i block = _mm256_loadu_si256((const __m256i *)data);
+    __m256i key = _mm256_xor_si256(
+        block, _mm256_loadu_si256(secret + ((state->blocks & 2) ? 1 : 0)));
+    __m256i key_hi = _mm256_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1));
+    __m256i product = _mm256_mul_epu32(key, key_hi);
+    __m256i swapped = _mm256_shuffle_epi32(block, _MM_SHUFFLE(1, 0, 3, 2));
+    acc = _mm256_add_epi64(acc, _mm256_add_epi64(product, swapped));
+    state->blocks += 2;
+    if (state->blocks % XXH_SCRAMBLE_BLOCKS == 0) {
+      acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+      acc = _mm256_xor_si256(acc, _mm256_loadu_si256(secret + 1));
+      __m256i lo = _mm256_mul_epu32(acc, prime);
+      __m256i hi = _mm256_mul_epu32(_mm256_srli_epi64(acc, 32), prime);
+      acc = _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32));
+    }
+  }
+  _mm256_storeu_si256((__m256i *)state->lane, acc);
+  if (count > 0)
+    xxh_block128(state, data);
+}
+
+__attribute__((target("avx2"))) static Hash128
+xxh_hash_avx2(const unsigned char *data, size_t len) {
+  UnitHashState state;
+  xxh_start(&state);
+  xxh_blocks_avx2(&state, data, len / 16);
+  return xxh_finish(&state, data + len / 16 * 16, len);
+}
+
+__attribute__((target("sse4.2"))) static inline void
+crc32c_block_sse42(uint64_t *c, uint64_t w0, uint64_t w1) {
+  c[0] = _mm_crc32_u64(c[0], w0);
+  c[1] = _mm_crc32_u64(c[1], w1);
+  c[2] = _mm_crc32_u64(c[2], w0 + w1);
+  c[3] = _mm_crc32_u64(c[3], w0 - rotl64(w1, 32));
+}
+
+__attribute__((target("sse4.2"))) static inline void
+crc32c_blocks_sse42(UnitHashState *state, const unsigned char *data,
+                    size_t count) {
+  uint64_t c[4] = {state->lane[0], state->lane[1], state->lane[2],
+                   state->lane[3]};
+  for (size_t i = 0; i < count; ++i, data += 16) {
+    crc32c_block_sse42(c, load64(data), load64(data + 8));
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    state->lane[i] = c[i];
+  }
+  state->blocks += count;
+}
+
+__attribute__((target("sse4.2"))) static inline Hash128
+crc32c_finish_sse42(const UnitHashState *state, const unsigned char *tail,
+                    size_t len) {
+  uint64_t c[4] = {state->lane[0], state->lane[1], state->lane[2],
+                   state->lane[3]};
+  if (len & 15) {
+    uint64_t w0 = 0;
+    uint64_t w1 = 0;
+    load_tail(tail, len, &w0, &w1);
+    crc32c_block_sse42(c, w0, w1);
+  }
+  return crc32c_mix(c, len);
+}
+
+__attribute__((target("sse4.2"))) static Hash128
+crc32c_hash_sse42(const unsigned char *data, size_t len) {
+  UnitHashState state;
+  crc32c_start(&state);
+  crc32c_blocks_sse42(&state, data, len / 16);
+  return crc32c_finish_sse42(&state, data + len / 16 * 16, len);
+}
+#endif
+
+static UnitHash unit_hash_available[6];
+static size_t unit_hash_available_count;
+static const UnitHash *unit_hash_fastest[2]; // short units, long units
+static const UnitHash *unit_hash_fastest_strong[2]; // without crc32c
+static once_flag unit_hash_once = ONCE_FLAG_INIT;
+static const UnitHash *unit_hash_current;
+
+// Runtime dispatch: list what the CPU runs, each family's widest last.
+static void select_unit_hashes(void) {
+  build_crc32c_table();
+  size_t count = 0;
+  UnitHash *impls = unit_hash_available;
+  impls[count++] = (UnitHash){.id = UNIT_HASH_MURMUR3,
+                              .name = "murmur3",
+                              .impl = "scalar",
+                              .hash = murmur_hash,
+                              .start = murmur_start,
+                              .blocks = murmur_blocks,
+                              .finish = murmur_finish};
+  impls[count++] = (UnitHash){.id = UNIT_HASH_XXH,
+                              .name = "xxh",
+                              .impl = "scalar",
+                              .hash = xxh_hash_scalar,
+                              .start = xxh_start,
+                              .blocks = xxh_blocks_scalar,
+                              .finish = xxh_finish};
+  bool xxh_vector = false;
+  bool crc_hardware = false;
+#if defined(HASH_UTILS_X86)
+  __builtin_cpu_init();
+  impls[count++] = (UnitHash){.id = UNIT_HASH_XXH,
+                              .name = "xxh",
+                              .impl = "sse2",
+                              .hash = xxh_hash_sse2,
+                              .start = xxh_start,
+                              .blocks = xxh_blocks_sse2,
+                              .finish = xxh_finish};
+  xxh_vector = true; // SSE2 is part of x86-64
+  if (__builtin_cpu_supports("avx2")) {
+    impls[count++] = (UnitHash){.id = UNIT_HASH_XXH,
+                                .name = "xxh",
+                                .impl = "avx2",
+                                .hash = xxh_hash_avx2,
+                                .start = xxh_start,
+                                .blocks = xxh_blocks_avx2,
+                                .finish = xxh_finish};
+  }
+#endif
+  impls[count++] = (UnitHash){.id = UNIT_HASH_CRC32C,
+                              .name = "crc32c",
+                              .impl = "scalar",
+                              .hash = crc32c_hash_scalar,
+                              .start = crc32c_start,
+                              .blocks = crc32c_blocks_scalar,
+                              .finish = crc32c_finish_scalar};
+#if defined(HASH_UTILS_X86)
+  if (__builtin_cpu_supports("sse4.2")) {
+    impls[count++] = (UnitHash){.id = UNIT_HASH_CRC32C,
+                                .name = "crc32c",
+                                .impl = "sse4.2",
+                                .hash = crc32c_hash_sse42,
+                                .start = crc32c_start,
+                                .blocks = crc32c_blocks_sse42,
+                                .finish = crc32c_finish_sse42};
+    crc_hardware = true;
+  }
+#endif
+  unit_hash_available_count = count;
+  // CRC32C has the least setup per unit, so it wins on sentences and lines;
+  // the vector xxh lanes pull ahead from about a kilobyte on. Murmur3 beats
+  // the table CRC and the scalar xxh lanes on any length.
+  // The CRC lanes are linear over GF(2) up to the final mix, so keys that
+  // are the only equality test take the fastest of the other families.
+  uint32_t fastest = crc_hardware ? UNIT_HASH_CRC32C : UNIT_HASH_MURMUR3;
+  uint32_t fastest_long = xxh_vector ? UNIT_HASH_XXH : fastest;
+  uint32_t strong = UNIT_HASH_MURMUR3;
+  uint32_t strong_long = xxh_vector ? UNIT_HASH_XXH : strong;
+  for (size_t i = 0; i < count; ++i) {
+    if (impls[i].id == fastest)
+      unit_hash_fastest[0] = &impls[i];
+    if (impls[i].id == fastest_long)
+      unit_hash_fastest[1] = &impls[i];
+    if (impls[i].id == strong)
+      unit_hash_fastest_strong[0] = &impls[i];
+    if (impls[i].id == strong_long)
+      unit_hash_fastest_strong[1] = &impls[i];
+  }
+}
+
+size_t unit_hash_impls(const UnitHash **impls) {
+  call_once(&unit_hash_once, select_unit_hashes);
+  *impls = unit_hash_available;
+  return unit_hash_available_count;
+}
+
+const UnitHash *unit_hash_by_id(uint32_t id) {
+  call_once(&unit_hash_once, select_unit_hashes);
+  const UnitHash *best = nullptr;
+  for (size_t i = 0; i < unit_hash_available_count; ++i) {
+    if (unit_hash_available[i].id == id)
+      best = &unit_hash_available[i];
+  }
+  return best;
+}
+
+const UnitHash *unit_hash_by_name(const char *name) {
+  call_once(&unit_hash_once, select_unit_hashes);
+  const UnitHash *best = nullptr;
+  for (size_t i = 0; i < unit_hash_available_count; ++i) {
+    if (strcmp(unit_hash_available[i].name, name) == 0)
+      best = &unit_hash_available[i];
+  }
+  return best;
+}
+
+const UnitHash *unit_hash_auto(bool long_units, bool fingerprint_keys) {
+  call_once(&unit_hash_once, select_unit_hashes);
+  if (fingerprint_keys)
+    return unit_hash_fastest_strong[long_units ? 1 : 0];
+  return unit_hash_fastest[long_units ? 1 : 0];
+}
+
+bool unit_hash_collision_resistant(const UnitHash *hash) {
+  return hash->id != UNIT_HASH_CRC32C;
+}
+
+void unit_hash_select(const UnitHash *hash) { unit_hash_current = hash; }
+
+const UnitHash *unit_hash_active(void) {
+  if (unit_hash_current)
+    return unit_hash_current;
+  call_once(&unit_hash_once, select_unit_hashes);
+  return &unit_hash_available[0]; // murmur3
+}
+
+Hash128 unit_fingerprint(const unsigned char *data, size_t len) {
+  return unit_hash_active()->hash(data, len);
+}
+
+uint64_t hash_unit(const unsigned char *data, size_t len) {
+  return unit_fingerprint(data, len).hi;
+}
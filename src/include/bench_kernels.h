@@ -0,0 +1,11 @@
+#ifndef BENCH_KERNELS_H
+#define BENCH_KERNELS_H
+
+/**
+ * Entry point for --bench-kernels: reports the throughput of the SIMD
+ * kernels and their scalar versions. tests/kernel_test.c checks that they
+ * agree.
+ */
+int run_bench_kernels(const char *prog, int argc, char **argv);
+
+#endif
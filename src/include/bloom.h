@@ -0,0 +1,38 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Register-blocked Bloom filter: every key sets BLOOM_HASHES bits inside a
+ * single 64-bit word, so a probe is one load and an insert one atomic OR.
+ * Lock-free and safe to share between threads.
+ */
+typedef struct {
+  _Atomic uint64_t *words;
+  size_t word_mask;
+} BloomFilter;
+
+/**
+ * Allocate a filter of at most byte_len bytes (rounded down to a power of
+ * two words).
+ */
+[[nodiscard]] bool bloom_init(BloomFilter *filter, size_t byte_len);
+/**
+ * Release the filter.
+ */
+void bloom_destroy(BloomFilter *filter);
+/**
+ * Size of the bit array in bytes.
+ */
+size_t bloom_bytes(const BloomFilter *filter);
+/**
+ * Add a key hash; returns true when it may have been present already and
+ * false when it was definitely new. Of several threads adding the same new
+ * key, exactly one sees false.
+ */
+bool bloom_add(BloomFilter *filter, uint64_t key);
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef COMPRESS_H
+#define COMPRESS_H
+
+#include <stddef.h>
+
+#include "decompress.h"
+#include "utf8.h"
+
+/**
+ * Codec and level of the files written to the output directory.
+ */
+typedef struct {
+  CompressionKind kind;
+  int level;
+} OutputCompression;
+
+/**
+ * Output file being written through an optional compressor.
+ */
+typedef struct OutputWriter OutputWriter;
+
+/**
+ * Parse "none", "gzip" or "zstd".
+ */
+[[nodiscard]] bool compression_from_string(const char *text,
+                                           CompressionKind *out);
+/**
+ * Name of kind as accepted by compression_from_string.
+ */
+const char *compression_name(CompressionKind kind);
+/**
+ * File name suffix of kind ("" when uncompressed).
+ */
+const char *compression_suffix(CompressionKind kind);
+/**
+ * Default and highest accepted level of kind (1 is the lowest).
+ */
+int compression_default_level(CompressionKind kind);
+int compression_max_level(CompressionKind kind);
+/**
+ * Create path and start writing it. The compressor state is cached per
+ * thread and reused by the next file, so a thread may have only one writer
+ * open at a time. Returns nullptr on failure.
+ */
+[[nodiscard]] OutputWriter *output_writer_open(
+    const char *path, const OutputCompression *compression);
+/**
+ * Append len bytes of uncompressed data.
+ */
+[[nodiscard]] bool output_writer_write(OutputWriter *writer, const void *data,
+                                       size_t len);
+/**
+ * Finish the stream, close the file and free the writer. The uncompressed
+ * and on-disk sizes are added to *raw_bytes and *stored_bytes on success.
+ */
+bool output_writer_close(OutputWriter *writer, size_t *raw_bytes,
+                         size_t *stored_bytes);
+/**
+ * Write data as one whole output file; see output_writer_close.
+ */
+bool write_output_file(const char *path, const OutputCompression *compression,
+                       const char8_t *data, size_t len, size_t *raw_bytes,
+                       size_t *stored_bytes);
+
+#endif
@@ -11,15 +11,53 @@ constexpr size_t ARENA_BLOCK_SIZE = 64 * 1'024 * 1'024; // 64 MiB
 constexpr size_t FILE_BATCH_SIZE = 4'096;
 constexpr size_t DEFAULT_MAX_COMPARE_LENGTH = 0; // symbols; 0 = unlimited
 extern const char *DUPLICATES_FILENAME;
+extern const char *SPILL_DIRNAME;
 extern const char *DEFAULT_MASK;
+extern const char *JSONL_DEFAULT_MASK;
+extern const char *JSONL_DEFAULT_TEXT_FIELD;
+extern const char *SHARD_FILE_PREFIX;
+extern const char *SHARD_INDEX_FILENAME;
 extern const char PROGRAM_AUTHOR[];
 extern const char PROGRAM_COPYRIGHT[];
 extern const char PROGRAM_LICENSE_NAME[];
 constexpr size_t SENTENCE_ARENA_BLOCK_SIZE = 64 * 1'024;
+constexpr size_t SENTENCE_SET_INIT_BUCKETS = 64 * 1'024;
 constexpr size_t HASH_PARALLEL_BASE = 64;
 constexpr size_t RADIX_SORT_MIN_COUNT = 64;
 constexpr size_t SEARCH_ARENA_BLOCK_SIZE = 1'024 * 1'024;
 constexpr uint64_t SEARCH_HASH_MULT = 1'315'423'911ULL;
+constexpr size_t MINHASH_DEFAULT_SHINGLE_WORDS = 5;
+constexpr size_t MINHASH_DEFAULT_PERMUTATIONS = 128;
+constexpr size_t MINHASH_DEFAULT_BANDS = 16;
+constexpr size_t MINHASH_MAX_SHINGLE_WORDS = 64;
+constexpr size_t MINHASH_MAX_PERMUTATIONS = 1'024;
+constexpr size_t SPILL_READ_RECORDS = 2'048; // per run reader, 48 KiB
+constexpr size_t SPILL_MERGE_FANIN = 256;
+constexpr size_t SPILL_APPEND_RECORDS = 2'048; // per key worker flush, 48 KiB
+constexpr size_t SPILL_MIN_MEMORY_LIMIT = 16 * 1'024 * 1'024;
+constexpr size_t BLOOM_HASHES = 6; // bits set per key, at most 10
+constexpr size_t BLOOM_MIN_BYTES = 64 * 1'024;
+constexpr size_t SUBSTRING_BIN_BITS = 12; // window hash bins, sorted per bin
+constexpr size_t SUBSTRING_DEFAULT_MIN_SPAN = 100; // bytes
+constexpr size_t SUBSTRING_MIN_SPAN = 8;
+constexpr size_t SUBSTRING_DEFAULT_MEMORY = 1'024 * 1'024 * 1'024; // per pass
+constexpr size_t SUBSTRING_WINDOW_CHUNK = 64 * 1'024; // windows per flush
+constexpr size_t DECOMPRESS_INPUT_CHUNK = 256 * 1'024; // compressed read size
+constexpr size_t DECOMPRESS_MIN_BUFFER = 1'024 * 1'024;
+constexpr size_t DECOMPRESS_SIZE_GUESS_RATIO = 4; // initial output / input
+constexpr size_t COMPRESS_OUTPUT_CHUNK = 256 * 1'024; // per-thread out buffer
+constexpr int OUTPUT_GZIP_DEFAULT_LEVEL = 6;
+constexpr int OUTPUT_ZSTD_DEFAULT_LEVEL = 3;
+constexpr size_t SHARD_DEFAULT_SIZE = 1'024 * 1'024 * 1'024; // 1 GiB
+constexpr size_t DIR_SCAN_BUFFER = 128 * 1'024; // getdents64 bytes per call
+constexpr size_t DIR_SCAN_MAX_THREADS = 16;
+constexpr size_t DIR_SCAN_COLLECT_BATCH = 1'024; // entries per batch
+constexpr size_t DIR_SCAN_QUEUE_DEPTH = 4; // batches waiting for the consumer
+constexpr size_t DIR_SCAN_POOL_BLOCK = 256 * 1'024; // path bytes per block
+constexpr size_t URING_IO_BATCH = 16; // files per io_uring round trip
+constexpr size_t DUPLICATES_LOG_FLUSH = 1'024 * 1'024; // per-worker log
+constexpr size_t SPLIT_DOCUMENT_MIN_BYTES = 64 * 1'024 * 1'024; // sentences
+constexpr size_t SPLIT_DOCUMENT_CHUNK = 4 * 1'024 * 1'024; // bytes per helper
 
 static_assert(HASH_MOD == 4'294'967'296ULL, "HASH_MOD must remain 2^32");
 static_assert(HASH_MULT != 0, "HASH_MULT must be non-zero");
@@ -28,11 +66,45 @@ static_assert(ARENA_BLOCK_SIZE >= 1'024, "ARENA_BLOCK_SIZE too small");
 static_assert(FILE_BATCH_SIZE > 0, "FILE_BATCH_SIZE must be positive");
 static_assert(SENTENCE_ARENA_BLOCK_SIZE >= 1'024,
               "SENTENCE_ARENA_BLOCK_SIZE too small");
+static_assert(SENTENCE_SET_INIT_BUCKETS >= 1'024,
+              "SENTENCE_SET_INIT_BUCKETS too small");
 static_assert(HASH_PARALLEL_BASE > 0, "HASH_PARALLEL_BASE must be positive");
 static_assert(RADIX_SORT_MIN_COUNT > 0,
               "RADIX_SORT_MIN_COUNT must be positive");
+static_assert(SPLIT_DOCUMENT_CHUNK > 0 &&
+                  SPLIT_DOCUMENT_MIN_BYTES >= 2 * SPLIT_DOCUMENT_CHUNK,
+              "SPLIT_DOCUMENT_MIN_BYTES must span several chunks");
 static_assert(SEARCH_ARENA_BLOCK_SIZE >= 1'024,
               "SEARCH_ARENA_BLOCK_SIZE too small");
 static_assert(SEARCH_HASH_MULT != 0, "SEARCH_HASH_MULT must be non-zero");
+static_assert(MINHASH_DEFAULT_SHINGLE_WORDS > 0 &&
+                  MINHASH_DEFAULT_SHINGLE_WORDS <= MINHASH_MAX_SHINGLE_WORDS,
+              "MINHASH_DEFAULT_SHINGLE_WORDS out of range");
+static_assert(MINHASH_DEFAULT_PERMUTATIONS <= MINHASH_MAX_PERMUTATIONS &&
+                  MINHASH_DEFAULT_PERMUTATIONS % MINHASH_DEFAULT_BANDS == 0,
+              "MinHash bands must divide permutations");
+static_assert(SPILL_READ_RECORDS > 0, "SPILL_READ_RECORDS must be positive");
+static_assert(SPILL_APPEND_RECORDS > 0,
+              "SPILL_APPEND_RECORDS must be positive");
+static_assert(SPILL_MERGE_FANIN >= 2, "SPILL_MERGE_FANIN must be at least 2");
+static_assert(BLOOM_HASHES > 0 && BLOOM_HASHES <= 10,
+              "BLOOM_HASHES must fit in one 64-bit mix");
+static_assert(SUBSTRING_BIN_BITS > 0 && SUBSTRING_BIN_BITS <= 20,
+              "SUBSTRING_BIN_BITS out of range");
+static_assert(SUBSTRING_DEFAULT_MIN_SPAN >= SUBSTRING_MIN_SPAN,
+              "SUBSTRING_DEFAULT_MIN_SPAN below SUBSTRING_MIN_SPAN");
+static_assert(SUBSTRING_WINDOW_CHUNK > 0,
+              "SUBSTRING_WINDOW_CHUNK must be positive");
+static_assert(DECOMPRESS_MIN_BUFFER >= DECOMPRESS_INPUT_CHUNK,
+              "DECOMPRESS_MIN_BUFFER must hold one input chunk");
+static_assert(COMPRESS_OUTPUT_CHUNK > 0 && COMPRESS_OUTPUT_CHUNK <= UINT32_MAX,
+              "COMPRESS_OUTPUT_CHUNK must fit a zlib buffer");
+static_assert(DIR_SCAN_BUFFER >= 4'096 && DIR_SCAN_BUFFER <= UINT32_MAX,
+              "DIR_SCAN_BUFFER must hold a directory entry");
+static_assert(DIR_SCAN_MAX_THREADS > 0, "DIR_SCAN_MAX_THREADS must be set");
+static_assert(DIR_SCAN_QUEUE_DEPTH > 0, "DIR_SCAN_QUEUE_DEPTH must be set");
+static_assert(URING_IO_BATCH > 0 && URING_IO_BATCH <= 2'048,
+              "URING_IO_BATCH must fit an io_uring submission queue");
+static_assert(DUPLICATES_LOG_FLUSH > 0, "DUPLICATES_LOG_FLUSH must be set");
 
 #endif
@@ -0,0 +1,60 @@
+#ifndef DECOMPRESS_H
+#define DECOMPRESS_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "utf8.h"
+
+/**
+ * Compression of an input file, chosen by its name suffix.
+ */
+typedef enum {
+  COMPRESSION_NONE = 0,
+  COMPRESSION_GZIP = 1, // .gz, any number of concatenated members
+  COMPRESSION_ZSTD = 2, // .zst, any number of frames
+} CompressionKind;
+
+/**
+ * Streaming decompressor over an open file.
+ */
+typedef struct DecompressStream DecompressStream;
+
+/**
+ * Compression implied by name's suffix.
+ */
+CompressionKind compression_from_name(const char *name);
+/**
+ * Length of the compression suffix of name (0 when uncompressed).
+ */
+size_t compression_suffix_len(const char *name);
+/**
+ * Whether this build can read kind.
+ */
+bool compression_supported(CompressionKind kind);
+/**
+ * Start decompressing fp, which stays owned by the caller. label names the
+ * file in error messages. Returns nullptr on failure.
+ */
+[[nodiscard]] DecompressStream *decompress_open(FILE *fp, CompressionKind kind,
+                                                const char *label);
+/**
+ * Read up to cap decompressed bytes into buf; returns 0 at the end of the
+ * data. Corrupt or truncated input sets *failed and returns 0.
+ */
+size_t decompress_read(DecompressStream *stream, void *buf, size_t cap,
+                       bool *failed);
+/**
+ * Release the stream (not the file).
+ */
+void decompress_close(DecompressStream *stream);
+/**
+ * Decompress all of fp into the calling thread's reusable buffer, which
+ * holds the result until the thread's next call and is freed when the
+ * thread exits. size_hint (e.g. the compressed size) seeds its capacity.
+ */
+[[nodiscard]] bool decompress_file(FILE *fp, CompressionKind kind,
+                                   const char *label, size_t size_hint,
+                                   const char8_t **out, size_t *out_len);
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef DEDUP_INDEX_H
+#define DEDUP_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hash_utils.h"
+#include "sentence_set.h"
+#include "utf8.h"
+
+/**
+ * Settings that decide what an index key means. A saved index can only seed
+ * a run whose settings match exactly.
+ */
+typedef struct {
+  uint32_t fingerprint_only; // 1 when keys are 128-bit fingerprints
+  uint32_t dedup_mode;
+  uint32_t shingle_words; // near-document only, otherwise 0
+  uint32_t permutations;
+  uint32_t bands;
+  uint32_t unit_hash; // UnitHashId of the keys
+  uint64_t max_compare_len;
+  uint32_t normalize; // NormalizeFlags applied to the units
+  uint32_t reserved;
+} DedupIndexParams;
+
+/**
+ * On-disk header. The file is the header, then slot_count 16-byte slots
+ * (hash, payload) of a linear-probing table, then the unit blob. Text slots
+ * hold the blob offset of an 8-byte length followed by the unit bytes;
+ * fingerprint slots hold the low fingerprint word. A zero hash marks an
+ * empty slot.
+ */
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t header_size;
+  DedupIndexParams params;
+  uint64_t slot_count;
+  uint64_t entry_count;
+  uint64_t blob_bytes;
+} DedupIndexHeader;
+
+/**
+ * Read-only view of a mapped index file.
+ */
+typedef struct {
+  void *map;
+  size_t map_len;
+  DedupIndexHeader header; // copied out, older versions are widened
+  const uint64_t *slots; // slot_count pairs of (hash, payload)
+  const uint8_t *blob;
+  size_t slot_mask;
+} DedupIndex;
+
+/**
+ * Map an index file; no parsing beyond header validation.
+ */
+[[nodiscard]] bool dedup_index_load(DedupIndex *index, const char *path);
+/**
+ * Unmap the index.
+ */
+void dedup_index_close(DedupIndex *index);
+/**
+ * Check that the index was built with the given settings; prints the first
+ * mismatch.
+ */
+bool dedup_index_compatible(const DedupIndex *index,
+                            const DedupIndexParams *params, const char *path);
+/**
+ * Number of keys stored in the index.
+ */
+size_t dedup_index_size(const DedupIndex *index);
+/**
+ * Look up a text unit by its hash_unit key and bytes; the unit hash must be
+ * the index's.
+ */
+bool dedup_index_contains_hashed(const DedupIndex *index, uint64_t hash,
+                                 const char8_t *data, size_t len);
+/**
+ * Look up a 128-bit fingerprint.
+ */
+bool dedup_index_contains_fingerprint(const DedupIndex *index,
+                                      Hash128 fingerprint);
+/**
+ * Call visit with the slot hash of every key (the hash_unit key, or the
+ * high fingerprint word), e.g. to seed a prefilter.
+ */
+void dedup_index_for_each_hash(const DedupIndex *index,
+                               void (*visit)(void *ctx, uint64_t hash),
+                               void *ctx);
+/**
+ * Write base (may be nullptr) plus every key of set to path. Keys present in
+ * base must not also be in set. The file is written next to path and renamed
+ * over it, so path may be the index that base maps.
+ */
+[[nodiscard]] bool dedup_index_save(const char *path, const SentenceSet *set,
+                                    const DedupIndex *base,
+                                    const DedupIndexParams *params,
+                                    size_t *out_entries);
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef DIR_SCAN_H
+#define DIR_SCAN_H
+
+#include <stddef.h>
+
+#include "arena.h"
+
+/**
+ * Regular file found by a scan. Both strings live in the pool of the batch
+ * that carries the entry.
+ */
+typedef struct {
+  const char *name; // relative to the scanned root, '/'-separated
+  const char *path; // root joined with name; name points into it
+} ScanEntry;
+
+/**
+ * Entries handed over together, with the string pool they point into. The
+ * consumer owns the batch and may allocate from its pool.
+ */
+typedef struct {
+  ScanEntry *entries;
+  size_t count;
+  Arena *pool;
+} ScanBatch;
+
+/**
+ * Complete, name-sorted listing; entries point into the batches.
+ */
+typedef struct {
+  ScanEntry *entries;
+  size_t count;
+  ScanBatch **batches;
+  size_t batch_count;
+} ScanListing;
+
+/**
+ * Called from a scanner thread for every subdirectory (relative to the
+ * root) before any of its entries are reported. Returning false skips the
+ * subtree and counts an error.
+ */
+typedef bool (*ScanDirHook)(void *ctx, const char *rel_dir);
+
+/**
+ * Background scan of a directory (tree).
+ */
+typedef struct DirScan DirScan;
+
+/**
+ * Start listing the regular files under root whose names match mask in
+ * batches of up to batch_size entries. With recursive set, subdirectories
+ * are scanned too, fanned out across thread_count threads (0 picks one per
+ * CPU). Returns nullptr on failure.
+ */
+[[nodiscard]] DirScan *dir_scan_start(const char *root, const char *mask,
+                                      bool recursive, size_t thread_count,
+                                      size_t batch_size, ScanDirHook on_dir,
+                                      void *hook_ctx);
+/**
+ * Wait for the next batch; nullptr once the scan is complete and drained.
+ * Only DIR_SCAN_QUEUE_DEPTH batches wait at a time, so a slow consumer
+ * stalls the scan instead of growing the file list.
+ */
+[[nodiscard]] ScanBatch *dir_scan_next(DirScan *scan);
+/**
+ * Stop the scan, drop any batches not yet taken and return the number of
+ * directories or entries that could not be read.
+ */
+size_t dir_scan_finish(DirScan *scan);
+/**
+ * Release a batch and its string pool.
+ */
+void scan_batch_free(ScanBatch *batch);
+/**
+ * Scan to completion into listing, sorted by name. Returns false on
+ * allocation failure; read errors are added to *errors.
+ */
+[[nodiscard]] bool dir_scan_collect(const char *root, const char *mask,
+                                    bool recursive, ScanListing *listing,
+                                    size_t *errors);
+/**
+ * Free a listing filled by dir_scan_collect.
+ */
+void scan_listing_free(ScanListing *listing);
+
+#endif
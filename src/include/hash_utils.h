@@ -4,9 +4,102 @@
 #include <stddef.h>
 #include <stdint.h>
 
+/**
+ * 128-bit fingerprint split into two 64-bit words.
+ */
+typedef struct {
+  uint64_t hi;
+  uint64_t lo;
+} Hash128;
+
 /**
  * Compute the 64-bit FNV-1a hash for a byte buffer.
  */
 uint64_t hash_bytes_fnv1a(const unsigned char *data, size_t len);
+/**
+ * Compute a 128-bit MurmurHash3 (x64 variant) fingerprint for a byte buffer.
+ */
+Hash128 hash_bytes_128(const unsigned char *data, size_t len);
+/**
+ * Unit hash families. The value is saved in dedup indexes and winner lists,
+ * so existing values never change; 0 is what files written before the
+ * choice existed hold.
+ */
+typedef enum {
+  UNIT_HASH_MURMUR3 = 0,
+  UNIT_HASH_XXH = 1,
+  UNIT_HASH_CRC32C = 2,
+} UnitHashId;
+
+/**
+ * State of a unit hash between 16-byte blocks, for hashing bytes as they
+ * are produced.
+ */
+typedef struct {
+  uint64_t lane[4];
+  uint64_t blocks;
+} UnitHashState;
+
+/**
+ * One implementation of a unit hash family. Every implementation of a
+ * family returns the same 128-bit value; hash is start, blocks and finish
+ * over a whole buffer.
+ */
+typedef struct {
+  UnitHashId id;
+  const char *name;
+  const char *impl; // instruction set, e.g. "scalar" or "avx2"
+  Hash128 (*hash)(const unsigned char *data, size_t len);
+  void (*start)(UnitHashState *state);
+  void (*blocks)(UnitHashState *state, const unsigned char *data,
+                 size_t count);
+  Hash128 (*finish)(const UnitHashState *state, const unsigned char *tail,
+                    size_t len);
+} UnitHash;
+
+/**
+ * The unit hash implementations this CPU runs, grouped by family with the
+ * portable one first.
+ */
+size_t unit_hash_impls(const UnitHash **impls);
+/**
+ * The fastest implementation of a family; nullptr for an unknown id.
+ */
+const UnitHash *unit_hash_by_id(uint32_t id);
+/**
+ * The fastest implementation of the family called name; nullptr if unknown.
+ */
+const UnitHash *unit_hash_by_name(const char *name);
+/**
+ * The family this CPU hashes fastest, judged by its instruction sets: on
+ * units of up to a few hundred bytes, or with long_units set on whole
+ * documents. With fingerprint_keys set, where the 128-bit hash is the only
+ * equality test, only collision-resistant families are considered.
+ */
+const UnitHash *unit_hash_auto(bool long_units, bool fingerprint_keys);
+/**
+ * Whether distinct units collide under hash about as rarely as under a
+ * random 128-bit function. CRC32C keys are linear before the final mix, so
+ * structured input can collide far more often.
+ */
+bool unit_hash_collision_resistant(const UnitHash *hash);
+/**
+ * Make hash the unit hash of the process; call before any thread hashes
+ * units. Murmur3 until then.
+ */
+void unit_hash_select(const UnitHash *hash);
+/**
+ * The unit hash of the process.
+ */
+const UnitHash *unit_hash_active(void);
+/**
+ * 128-bit fingerprint of a normalized dedup unit under the active family.
+ */
+Hash128 unit_fingerprint(const unsigned char *data, size_t len);
+/**
+ * 64-bit key of a normalized dedup unit: the high word of its
+ * unit_fingerprint, so both index kinds hash units alike.
+ */
+uint64_t hash_unit(const unsigned char *data, size_t len);
 
 #endif
@@ -5,9 +5,25 @@
 #include <stddef.h>
 
 /**
- * Read an entire file into a newly allocated buffer.
+ * Read-only bytes of an input file, line breaks and all.
  */
-bool read_file_bytes(const char *path, char8_t **out, size_t *out_len);
+typedef struct {
+  const char8_t *data; // never nullptr; "" for an empty file
+  size_t len;
+  void *map;       // mapping behind data, or nullptr
+  char8_t *owned;  // heap copy behind data, or nullptr
+} FileView;
+
+/**
+ * Open the contents of path without copying them: plain files are mapped,
+ * .gz and .zst files are decompressed into the calling thread's reusable
+ * buffer, so such a view lasts until the thread's next decompression.
+ */
+[[nodiscard]] bool file_view_open(const char *path, FileView *view);
+/**
+ * Release a view from file_view_open; safe on a closed view.
+ */
+void file_view_close(FileView *view);
 /**
  * Write len bytes from data into path atomically when possible.
  */
@@ -20,6 +36,15 @@ bool write_file_bytes(const char *path, const char8_t *data, size_t len);
  * Join directory and filename into a newly allocated path.
  */
 [[nodiscard]] char *join_path(const char *dir, const char *name);
+/**
+ * Whether name matches the fnmatch mask, with or without its compression
+ * suffix (so "*.txt" also selects "a.txt.gz").
+ */
+bool name_matches_mask(const char *mask, const char *name);
+/**
+ * Copy of name without its .gz/.zst suffix; caller owns the result.
+ */
+[[nodiscard]] char *strip_compression_suffix(const char *name);
 /**
  * Check whether path refers to a regular file.
  */
@@ -28,5 +53,10 @@ bool is_regular_file(const char *path);
  * Ensure the directory exists; create when requested.
  */
 bool ensure_directory(const char *path, bool create);
+/**
+ * Whether the existing path is dir or lies beneath it, after resolving
+ * links. False when either cannot be resolved.
+ */
+bool path_within(const char *path, const char *dir);
 
 #endif
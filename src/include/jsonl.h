@@ -0,0 +1,71 @@
+#ifndef JSONL_H
+#define JSONL_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "decompress.h"
+#include "utf8.h"
+
+/**
+ * Line reader over a JSONL shard, decompressing .gz/.zst shards as it goes.
+ * The read buffer is reused for every record, so reading allocates only
+ * when a record outgrows it.
+ */
+typedef struct {
+  FILE *fp;
+  DecompressStream *stream; // nullptr for uncompressed shards
+  char *buf;
+  size_t cap;
+  size_t start; // first unread byte
+  size_t scan;  // bytes before this hold no newline past start
+  size_t end;   // end of the buffered data
+  size_t size;  // shard size in bytes, as stored on disk
+  bool eof;
+  bool failed; // a read error, as opposed to the end of the shard
+} JsonlReader;
+
+/**
+ * Outcome of looking up a top-level field of one record.
+ */
+typedef enum {
+  JSONL_FIELD_FOUND = 0,
+  JSONL_FIELD_MISSING = 1,   // no such key, or its value is not a string
+  JSONL_FIELD_MALFORMED = 2, // the record is not a JSON object
+} JsonlFieldStatus;
+
+/**
+ * Open a shard for reading.
+ */
+[[nodiscard]] bool jsonl_reader_open(JsonlReader *reader, const char *path);
+/**
+ * Next record without its line terminator; false at the end of the shard or
+ * on a read error (see failed). The record stays valid until the next call.
+ */
+bool jsonl_reader_next(JsonlReader *reader, const char **line, size_t *len);
+/**
+ * Close the shard and release the line buffer.
+ */
+void jsonl_reader_close(JsonlReader *reader);
+/**
+ * Find the string value of the top-level key field in a record. On success
+ * [*value_start, *value_end) are the raw string contents between the quotes.
+ * Escaped keys longer than 256 bytes never match.
+ */
+JsonlFieldStatus jsonl_find_string_field(const char *line, size_t len,
+                                         const char *field,
+                                         size_t *value_start,
+                                         size_t *value_end);
+/**
+ * Decode raw JSON string contents to UTF-8; out must hold len bytes. Lone
+ * surrogates become U+FFFD. Fails on invalid escapes.
+ */
+[[nodiscard]] bool jsonl_decode_string(const char *src, size_t len,
+                                       char8_t *out, size_t *out_len);
+/**
+ * Escape UTF-8 text as JSON string contents (no quotes); out must hold
+ * 6 * len bytes. Returns the encoded length.
+ */
+size_t jsonl_encode_string(const char8_t *src, size_t len, char *out);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef MANIFEST_H
+#define MANIFEST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dir_scan.h"
+
+/**
+ * Files listed by a manifest, in manifest order, with the size column of
+ * each (0 where the record has none).
+ */
+typedef struct {
+  ScanBatch *files; // names relative to the root, paths under it
+  uint64_t *sizes;
+} Manifest;
+
+/**
+ * Read the manifest at path: one file per record, newline- or (when the
+ * manifest holds any NUL byte) NUL-delimited, each a path relative to root,
+ * optionally followed by a tab and its size in bytes. A leading "./" is
+ * dropped; absolute paths and ".." components are rejected. With mask set,
+ * only files whose base name matches are kept.
+ */
+[[nodiscard]] bool manifest_load(const char *path, const char *root,
+                                 const char *mask, Manifest *out);
+/**
+ * Release a manifest filled by manifest_load.
+ */
+void manifest_free(Manifest *manifest);
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef MINHASH_H
+#define MINHASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hash_utils.h"
+#include "utf8.h"
+
+/**
+ * MinHash parameters. Signatures use one-permutation hashing: each shingle is
+ * hashed once into one of `permutations` bins, and empty bins are filled by
+ * optimal densification, so the cost per shingle does not grow with the
+ * signature length.
+ */
+typedef struct {
+  size_t shingle_words;
+  size_t permutations;
+  size_t bands;
+  size_t rows; // permutations / bands
+} MinHasher;
+
+/**
+ * Validate parameters; bands must divide permutations.
+ */
+[[nodiscard]] bool minhash_init(MinHasher *hasher, size_t shingle_words,
+                                size_t permutations, size_t bands);
+/**
+ * Compute the signature of normalized text (words separated by single
+ * spaces) over word shingles; signature must hold permutations entries.
+ */
+void minhash_signature(const MinHasher *hasher, const char8_t *text,
+                       size_t len, uint64_t *signature);
+/**
+ * LSH bucket key of one band of a signature; keys of different bands never
+ * compare equal in practice.
+ */
+Hash128 minhash_band_key(const MinHasher *hasher, const uint64_t *signature,
+                         size_t band);
+/**
+ * Jaccard similarity at which two documents share a band with probability
+ * one half, approximated as (1/bands)^(1/rows).
+ */
+double minhash_threshold(const MinHasher *hasher);
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef PARTITION_H
+#define PARTITION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dedup_index.h"
+
+/**
+ * Position of a unit: global index of its file in sorted order and the
+ * unit's index among the file's split spans.
+ */
+typedef struct {
+  uint32_t file;
+  uint32_t span;
+} UnitPosition;
+
+/**
+ * Growable list of unit positions.
+ */
+typedef struct {
+  UnitPosition *items;
+  size_t count;
+  size_t cap;
+} UnitPositionList;
+
+/**
+ * This process owns the keys whose hash maps to index out of count
+ * partitions; count == 0 disables partitioning.
+ */
+typedef struct {
+  uint32_t index;
+  uint32_t count;
+} PartitionSpec;
+
+/**
+ * What every partition of one corpus must agree on: the key settings and
+ * the sorted file list the positions refer to.
+ */
+typedef struct {
+  DedupIndexParams params;
+  uint64_t file_count;
+  uint64_t names_hash;
+} PartitionLayout;
+
+/**
+ * On-disk header of a winner list; winner_count UnitPosition records sorted
+ * by position follow it.
+ */
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t header_size;
+  PartitionLayout layout;
+  uint32_t partition_index;
+  uint32_t partition_count;
+  uint64_t winner_count;
+} PartitionHeader;
+
+/**
+ * Parse "i/N" with 0 <= i < N.
+ */
+[[nodiscard]] bool partition_parse(const char *arg, PartitionSpec *spec);
+/**
+ * Whether the partition owns a key hash. Hashes are remixed first, so keys
+ * whose low bits pick set buckets still spread evenly.
+ */
+bool partition_owns(const PartitionSpec *spec, uint64_t key);
+/**
+ * Path of partition index's winner list in dir; caller frees.
+ */
+[[nodiscard]] char *partition_path(const char *dir, uint32_t index,
+                                   uint32_t count);
+/**
+ * Append one position, growing the list as needed.
+ */
+[[nodiscard]] bool unit_positions_append(UnitPositionList *list,
+                                         UnitPosition position);
+/**
+ * Release the list storage.
+ */
+void unit_positions_free(UnitPositionList *list);
+/**
+ * Write the winners of one partition; positions must already be sorted.
+ */
+[[nodiscard]] bool partition_write(const char *path,
+                                   const PartitionLayout *layout,
+                                   const PartitionSpec *spec,
+                                   const UnitPositionList *winners);
+/**
+ * Load the winner lists of all count partitions from dir, check them against
+ * layout and return their union sorted by position.
+ */
+[[nodiscard]] bool partition_merge(const char *dir, uint32_t count,
+                                   const PartitionLayout *layout,
+                                   UnitPositionList *out);
+
+#endif
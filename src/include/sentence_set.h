@@ -1,51 +1,143 @@
 #ifndef SENTENCE_SET_H
 #define SENTENCE_SET_H
 
+#include <stdatomic.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include "hash_utils.h"
 #include "utf8.h"
 
 typedef struct SentenceArenaBlock SentenceArenaBlock;
 typedef struct SentenceSetShard SentenceSetShard;
 
 typedef struct {
-  SentenceArenaBlock *head;
+  _Atomic(SentenceArenaBlock *) head;
   size_t block_size;
 } SentenceArena;
 
+/**
+ * Visitor for sentence_set_for_each. Text sets pass the slot hash and the
+ * unit bytes; fingerprint sets pass the slot hash and fingerprint word with
+ * data == nullptr. Return false to stop the walk.
+ */
+typedef bool (*SentenceSetVisitor)(void *ctx, uint64_t hash,
+                                   uint64_t fingerprint, const char8_t *data,
+                                   size_t len);
+
 typedef struct {
   SentenceSetShard *shards;
   size_t shard_count;
   size_t shard_mask;
+  bool fingerprint_only; // keys are 128-bit fingerprints, no unit bytes
+  bool ordered;          // each key remembers its smallest claim order
+  bool tagged;           // each key remembers the tag it was added with
 } SentenceSet;
 
 /**
  * Initialize a sentence set with the requested bucket count.
  */
 [[nodiscard]] bool sentence_set_init(SentenceSet *set, size_t bucket_count);
+/**
+ * Initialize a set keyed only on 128-bit fingerprints; unit bytes are not
+ * stored, so equality is decided by the fingerprint alone.
+ */
+[[nodiscard]] bool sentence_set_init_fingerprint(SentenceSet *set,
+                                                 size_t bucket_count);
+/**
+ * Initialize an ordered set: every key records the smallest order value it
+ * was claimed with, so the winner among concurrent claimants is independent
+ * of thread scheduling.
+ */
+[[nodiscard]] bool sentence_set_init_ordered(SentenceSet *set,
+                                             size_t bucket_count,
+                                             bool fingerprint_only);
+/**
+ * Initialize a tagged set: every key keeps the tag of the insertion that
+ * added it, for sentence_set_insert_*_tagged to report on later hits.
+ */
+[[nodiscard]] bool sentence_set_init_tagged(SentenceSet *set,
+                                            size_t bucket_count,
+                                            bool fingerprint_only);
 /**
  * Release all memory associated with the set.
  */
 void sentence_set_destroy(SentenceSet *set);
 /**
- * Remove all entries while keeping allocated storage.
+ * Remove all entries while keeping allocated storage. Not thread-safe.
  */
 void sentence_set_clear(SentenceSet *set);
+/**
+ * Number of keys currently stored across all shards.
+ */
+size_t sentence_set_size(const SentenceSet *set);
+/**
+ * Visit every key in the set. Not thread-safe; returns false if the visitor
+ * stopped the walk.
+ */
+bool sentence_set_for_each(const SentenceSet *set, SentenceSetVisitor visit,
+                           void *ctx);
 /**
  * Reserve space for an upcoming insertion batch measured in bytes.
  */
 void sentence_set_reserve_for_bytes(SentenceSet *set, size_t byte_len);
 /**
- * Insert a sentence with a precomputed hash; sets inserted to true on new key.
+ * Insert-or-find a sentence with a precomputed hash; sets inserted to true on
+ * new key. Safe to call concurrently: slots are claimed with CAS and shards
+ * grow independently without a set-wide lock.
  */
 [[nodiscard]] bool sentence_set_insert_hashed(SentenceSet *set, uint64_t hash,
                                               const char8_t *data, size_t len,
                                               bool *inserted);
 /**
- * Insert a sentence and compute its hash internally.
+ * Insert a fingerprint into a set created by sentence_set_init_fingerprint.
+ */
+[[nodiscard]] bool sentence_set_insert_fingerprint(SentenceSet *set,
+                                                   Hash128 fingerprint,
+                                                   bool *inserted);
+/**
+ * Insert-or-find in a tagged set: a new key keeps tag, a found key reports
+ * the tag it was added with in first_tag. Thread-safe.
+ */
+[[nodiscard]] bool sentence_set_insert_hashed_tagged(
+    SentenceSet *set, uint64_t hash, const char8_t *data, size_t len,
+    uint64_t tag, bool *inserted, uint64_t *first_tag);
+/**
+ * Fingerprint counterpart of sentence_set_insert_hashed_tagged.
+ */
+[[nodiscard]] bool sentence_set_insert_fingerprint_tagged(SentenceSet *set,
+                                                          Hash128 fingerprint,
+                                                          uint64_t tag,
+                                                          bool *inserted,
+                                                          uint64_t *first_tag);
+/**
+ * Insert a sentence and compute its hash (or fingerprint) internally.
  */
 [[nodiscard]] bool sentence_set_insert(SentenceSet *set, const char8_t *data,
                                        size_t len, bool *inserted);
+/**
+ * Insert-or-find a key in an ordered set and lower its owner to order.
+ * Thread-safe; returns false only on allocation failure or misuse.
+ */
+[[nodiscard]] bool sentence_set_claim_hashed(SentenceSet *set, uint64_t hash,
+                                             const char8_t *data, size_t len,
+                                             uint64_t order);
+/**
+ * Fingerprint counterpart of sentence_set_claim_hashed.
+ */
+[[nodiscard]] bool sentence_set_claim_fingerprint(SentenceSet *set,
+                                                  Hash128 fingerprint,
+                                                  uint64_t order);
+/**
+ * Look up the owner order of a claimed key; returns false when absent.
+ */
+bool sentence_set_owner_hashed(SentenceSet *set, uint64_t hash,
+                               const char8_t *data, size_t len,
+                               uint64_t *owner);
+/**
+ * Fingerprint counterpart of sentence_set_owner_hashed.
+ */
+bool sentence_set_owner_fingerprint(SentenceSet *set, Hash128 fingerprint,
+                                    uint64_t *owner);
 
 #endif
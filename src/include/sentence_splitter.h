@@ -30,6 +30,16 @@ typedef struct {
  */
 SentenceList split_text_to_sentences(const char8_t *restrict text, size_t len);
 
+/**
+ * @brief Finds a position where splitting can restart independently.
+ * Splitting text[0, cut) and text[cut, len) separately gives exactly the
+ * sentences of splitting the whole text. The cut is the start of the
+ * sentence after the first unambiguous terminator (? or !, or . after four
+ * ASCII letters, followed by whitespace) at or after from.
+ * @return The cut, or len when there is none.
+ */
+size_t find_sentence_cut(const char8_t *text, size_t len, size_t from);
+
 /**
  * @brief Frees all memory associated with the sentence list.
  */
@@ -0,0 +1,97 @@
+#ifndef SHARD_WRITER_H
+#define SHARD_WRITER_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <threads.h>
+
+#include "utf8.h"
+
+/**
+ * On-disk header of the shard index. entry_count ShardIndexEntry records
+ * sorted by name follow it, then the names_bytes name blob. Document i of
+ * the output is bytes [offset, offset + len) of shard-<shard>.bin.
+ */
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t header_size;
+  uint32_t shard_count;
+  uint32_t reserved;
+  uint64_t entry_count;
+  uint64_t names_bytes;
+} ShardIndexHeader;
+
+/**
+ * One output document in the shard index.
+ */
+typedef struct {
+  uint64_t name_offset; // into the name blob; names are not terminated
+  uint64_t offset;      // into the shard file
+  uint64_t len;
+  uint32_t name_len;
+  uint32_t shard;
+} ShardIndexEntry;
+
+/**
+ * Append-only writer of one thread: its current shard file and the index
+ * entries of everything it has written.
+ */
+typedef struct ShardSlot ShardSlot;
+
+/**
+ * Shard files of one run. Each worker holds its own slot while it writes,
+ * so appends take no lock; slots outlive the worker and are handed to the
+ * next one, keeping the shard count near the thread count.
+ */
+typedef struct {
+  char *dir;
+  size_t shard_size;
+  mtx_t lock; // guards the slot lists, taken once per worker
+  ShardSlot **slots;
+  size_t slot_count;
+  size_t slot_cap;
+  ShardSlot **idle;
+  size_t idle_count;
+  _Atomic uint32_t next_shard;
+  bool lock_init;
+} ShardSet;
+
+/**
+ * Start a shard set writing into dir; shards roll over past shard_size
+ * bytes.
+ */
+[[nodiscard]] bool shard_set_init(ShardSet *set, const char *dir,
+                                  size_t shard_size);
+/**
+ * Take an idle slot (or create one) for the calling worker.
+ */
+[[nodiscard]] ShardSlot *shard_set_acquire(ShardSet *set);
+/**
+ * Hand a slot back once the worker is done with it.
+ */
+void shard_set_release(ShardSet *set, ShardSlot *slot);
+/**
+ * Append one document named name to the slot's current shard.
+ */
+[[nodiscard]] bool shard_slot_append(ShardSet *set, ShardSlot *slot,
+                                     const char *name, const char8_t *data,
+                                     size_t len);
+/**
+ * Close every shard and write the index to index_path. Reports the number
+ * of shard files and indexed documents.
+ */
+[[nodiscard]] bool shard_set_finish(ShardSet *set, const char *index_path,
+                                    size_t *shard_count, size_t *entry_count);
+/**
+ * Release the set; unfinished shards are closed but not indexed.
+ */
+void shard_set_destroy(ShardSet *set);
+/**
+ * Path of shard index in dir; caller owns the result.
+ */
+[[nodiscard]] char *shard_path(const char *dir, uint32_t index);
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef SPILL_RUNS_H
+#define SPILL_RUNS_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * One unit occurrence: its 128-bit key and where it was seen.
+ */
+typedef struct {
+  uint64_t hi;
+  uint64_t lo;
+  uint32_t file;
+  uint32_t span;
+} SpillRecord;
+
+/**
+ * Sort order of a run: by key then position, or by position only.
+ */
+typedef enum { SPILL_ORDER_KEY = 0, SPILL_ORDER_POSITION = 1 } SpillOrder;
+
+/**
+ * Set of sorted run files sharing a directory and name prefix.
+ */
+typedef struct {
+  char *dir;
+  char *prefix;
+  SpillOrder order;
+  atomic_size_t next_id;
+  size_t *run_ids; // ids of live runs
+  size_t run_count;
+  size_t run_cap;
+  size_t bytes_written;
+} SpillStore;
+
+typedef struct SpillMerger SpillMerger;
+
+/**
+ * Sort records in place in the given order.
+ */
+void spill_records_sort(SpillRecord *records, size_t count, SpillOrder order);
+/**
+ * Prepare a store; dir must exist.
+ */
+[[nodiscard]] bool spill_store_init(SpillStore *store, const char *dir,
+                                    const char *prefix, SpillOrder order);
+/**
+ * Sort records in the store's order and write them as a new run. Not
+ * thread-safe.
+ */
+[[nodiscard]] bool spill_store_write_run(SpillStore *store,
+                                         SpillRecord *records, size_t count);
+/**
+ * Delete all run files and release the store.
+ */
+void spill_store_destroy(SpillStore *store);
+/**
+ * Open a k-way merge over every run. Stores with more runs than the fan-in
+ * are first merged in rounds into fewer, larger runs.
+ */
+[[nodiscard]] SpillMerger *spill_merge_open(SpillStore *store);
+/**
+ * Produce the next record in order; *has is false at the end.
+ */
+[[nodiscard]] bool spill_merge_next(SpillMerger *merger, SpillRecord *out,
+                                    bool *has);
+/**
+ * Close all run readers.
+ */
+void spill_merge_close(SpillMerger *merger);
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef SUBSTRING_DEDUP_H
+#define SUBSTRING_DEDUP_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utf8.h"
+
+/**
+ * One min_span-byte window: two independent rolling hashes of its bytes and
+ * its global position in the concatenated normalized corpus.
+ */
+typedef struct {
+  uint64_t h1;
+  uint64_t h2;
+  uint64_t pos;
+} SpanWindow;
+
+/**
+ * Rolling-hash parameters for a window length.
+ */
+typedef struct {
+  size_t min_span;
+  uint64_t drop1; // B1^(min_span-1) mod 2^64
+  uint64_t drop2; // B2^(min_span-1) mod (2^31-1)
+  uint64_t drop3; // B3^(min_span-1) mod (2^31-1)
+} SpanHasher;
+
+/**
+ * Windows of bins [bin_lo, bin_hi), grouped by bin in a single array. Bins
+ * are fixed by the top SUBSTRING_BIN_BITS of the mixed hashes, so a pass
+ * holds every occurrence of the windows it covers.
+ */
+typedef struct {
+  SpanWindow *windows;
+  size_t count;
+  size_t bin_lo;
+  size_t bin_hi;
+  size_t *bin_offsets;       // bin_hi - bin_lo + 1 prefix offsets
+  atomic_size_t *bin_cursors; // next free slot per bin while filling
+} SpanPass;
+
+/**
+ * Prepare the rolling hashes for windows of min_span bytes.
+ */
+void span_hasher_init(SpanHasher *hasher, size_t min_span);
+/**
+ * Hash every min_span-byte window of text. A non-null histogram (one entry
+ * per bin) counts windows per bin; a non-null out receives the windows of
+ * bins [bin_lo, bin_hi) at positions base_pos + offset. Returns how many
+ * windows were written to out; out must hold len entries.
+ */
+size_t span_hash_windows(const SpanHasher *hasher, const char8_t *text,
+                         size_t len, uint64_t base_pos, uint64_t *histogram,
+                         size_t bin_lo, size_t bin_hi, SpanWindow *out);
+/**
+ * Split the bins into consecutive ranges of at most max_windows windows (a
+ * single bin may exceed it). bounds receives count + 1 bin indices; returns
+ * the number of passes.
+ */
+size_t span_plan_passes(const uint64_t *histogram, size_t max_windows,
+                        size_t *bounds);
+/**
+ * Allocate a pass for bins [bin_lo, bin_hi) sized from the histogram.
+ */
+[[nodiscard]] bool span_pass_init(SpanPass *pass, const uint64_t *histogram,
+                                  size_t bin_lo, size_t bin_hi);
+/**
+ * Scatter windows (all inside the pass's bins) into their bins. Thread-safe;
+ * scratch must hold count entries. Fails, dropping the windows, when a bin
+ * would outgrow its histogram count (the input changed between passes).
+ */
+[[nodiscard]] bool span_pass_add(SpanPass *pass, const SpanWindow *windows,
+                                 size_t count, SpanWindow *scratch);
+/**
+ * Whether every bin received exactly its histogram count.
+ */
+bool span_pass_filled(const SpanPass *pass);
+/**
+ * Sort every bin on up to thread_count threads and set, in starts, the bit
+ * of every window position whose bytes already occur at a smaller position.
+ * Returns the number of such windows.
+ */
+size_t span_pass_mark(SpanPass *pass, _Atomic uint64_t *starts,
+                      size_t thread_count);
+/**
+ * Release the pass.
+ */
+void span_pass_destroy(SpanPass *pass);
+
+#endif
@@ -1,14 +1,71 @@
 #ifndef TEXT_UTILS_H
 #define TEXT_UTILS_H
 
+#include "hash_utils.h"
 #include "utf8.h"
 #include <stddef.h>
 
 /**
- * Normalize a sentence into out buffer; returns bytes written.
+ * Normalize a sentence into out buffer; returns bytes written. Runs of ASCII
+ * whitespace and control bytes, line breaks included, become one space.
+ * The steps picked by normalize_select apply first.
  */
 size_t normalize_sentence(const char8_t *data, size_t len, char8_t *out,
                           size_t out_cap);
+/**
+ * normalize_sentence that also sets *hash to unit_fingerprint of the output,
+ * computed in the same pass; hash->hi is its hash_unit key.
+ */
+size_t normalize_sentence_hashed(const char8_t *data, size_t len,
+                                 char8_t *out, size_t out_cap,
+                                 Hash128 *hash);
+/**
+ * One implementation of normalize_sentence and its hashed variant.
+ */
+typedef struct {
+  const char *name;
+  size_t (*normalize)(const char8_t *data, size_t len, char8_t *out,
+                      size_t out_cap);
+  size_t (*normalize_hash)(const char8_t *data, size_t len, char8_t *out,
+                           size_t out_cap, Hash128 *hash);
+} NormalizeKernel;
+/**
+ * The normalize_sentence kernels this CPU runs for the selected steps,
+ * scalar first; the last one is the one normalize_sentence dispatches to.
+ */
+size_t normalize_kernels(const NormalizeKernel **kernels);
+/**
+ * Unicode steps of --normalize. Text is mapped code point by code point
+ * (invalid UTF-8 is kept as it is) and then collapsed as above.
+ */
+typedef enum {
+  NORMALIZE_NFKC = 1u << 0,          // compatibility normalization, NFKC
+  NORMALIZE_CASEFOLD = 1u << 1,      // full Unicode case folding
+  NORMALIZE_UNICODE_SPACE = 1u << 2, // White_Space collapses like ASCII
+} NormalizeFlags;
+/**
+ * Parse a comma-separated --normalize list of nfkc, casefold and
+ * unicode-space, or none, into NormalizeFlags.
+ */
+[[nodiscard]] bool normalize_parse(const char *list, uint32_t *flags);
+/**
+ * Write flags as a --normalize list into buf; returns buf.
+ */
+const char *normalize_describe(uint32_t flags, char *buf, size_t cap);
+/**
+ * Pick the steps of every later normalize call; none until then. Call it
+ * before any worker starts.
+ */
+void normalize_select(uint32_t flags);
+/**
+ * The steps picked by normalize_select.
+ */
+uint32_t normalize_selected(void);
+/**
+ * Set *bound to the most bytes normalizing len bytes writes under the
+ * selected steps; false on overflow. Without nfkc or casefold it is len.
+ */
+[[nodiscard]] bool normalize_bound(size_t len, size_t *bound);
 /**
  * Trim trailing newline and carriage return in-place.
  */
@@ -0,0 +1,42 @@
+// Generated by scripts/gen_unicode_tables.py from Unicode 14.0.0; do not edit.
+#ifndef UNICODE_TABLES_H
+#define UNICODE_TABLES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Properties of one code point. map holds its NFKC, case folding and NFKC
+ * case folding mappings and decomp its canonical decomposition, as indices
+ * into unicode_sequences (a length, then the code points); 0 is none.
+ */
+typedef struct {
+  uint8_t ccc; // canonical combining class
+  uint8_t flags;
+  uint16_t map[3];
+  uint16_t decomp;
+} UnicodeRecord;
+
+enum {
+  UNICODE_WHITE_SPACE = 1,
+  UNICODE_COMPOSES_BACK = 2, // second half of a composition
+};
+
+/** Code points from here on have the all-zero record. */
+static constexpr uint32_t UNICODE_TABLE_LIMIT = 0x2FA20;
+static constexpr unsigned UNICODE_BLOCK_SHIFT = 5;
+/** Mappings grow text at most this many times, in UTF-8 bytes. */
+static constexpr size_t UNICODE_MAX_GROWTH = 3;
+static constexpr size_t UNICODE_COMPOSITION_COUNT = 941;
+
+/** Record block of each 2^UNICODE_BLOCK_SHIFT code points. */
+extern const uint16_t unicode_blocks[];
+/** Record index of each code point, block by block. */
+extern const uint16_t unicode_block_records[];
+extern const UnicodeRecord unicode_records[];
+extern const uint32_t unicode_sequences[];
+/** Sorted first << 21 | second keys of the primary composites. */
+extern const uint64_t unicode_composition_keys[];
+extern const uint32_t unicode_composites[];
+
+#endif
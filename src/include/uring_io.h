@@ -0,0 +1,49 @@
+#ifndef URING_IO_H
+#define URING_IO_H
+
+#include <stddef.h>
+
+#include "utf8.h"
+
+/**
+ * One file of a batched read or write.
+ */
+typedef struct {
+  const char *path;
+  const char8_t *data; // read: owned by the ring; write: bytes to write
+  size_t len;
+  bool ok;
+} UringFile;
+
+/**
+ * io_uring ring that batches the opens, reads, writes and closes of up to
+ * URING_IO_BATCH files per round trip. Owned by one thread.
+ */
+typedef struct UringIo UringIo;
+
+/**
+ * Whether this build and the running kernel support the ring; false when
+ * io_uring is missing, disabled or lacks a needed operation.
+ */
+bool uring_io_available(void);
+/**
+ * Set up a ring; nullptr on failure.
+ */
+[[nodiscard]] UringIo *uring_io_create(void);
+/**
+ * Tear down a ring from uring_io_create.
+ */
+void uring_io_destroy(UringIo *io);
+/**
+ * Read up to URING_IO_BATCH files, each into a buffer of the ring that is
+ * reused by the next call; ok = false after an error message. Compressed
+ * inputs are decompressed into the same buffers.
+ */
+void uring_io_read(UringIo *io, UringFile *files, size_t count);
+/**
+ * Create or truncate up to URING_IO_BATCH files and write data[0, len) to
+ * each; ok = false after an error message.
+ */
+void uring_io_write(UringIo *io, UringFile *files, size_t count);
+
+#endif
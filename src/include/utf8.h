@@ -30,6 +30,12 @@ typedef unsigned char char8_t;
 size_t utf8_decode_advance(const char8_t *bytes, size_t len,
                            uint32_t *out_codepoint, bool *out_invalid);
 
+/**
+ * Encode one scalar value (at most U+10FFFF, not a surrogate) as UTF-8.
+ * @return Number of bytes written to out.
+ */
+size_t utf8_encode(uint32_t codepoint, char8_t out[4]);
+
 /**
  * Decode a UTF-8 buffer into a newly allocated UTF-32 array.
  * Caller owns the returned buffer.
@@ -38,4 +44,20 @@ size_t utf8_decode_advance(const char8_t *bytes, size_t len,
                                       uint32_t **out, size_t *out_len,
                                       size_t *invalid_count);
 
+/**
+ * One implementation of the utf8_decode_buffer loop: decodes len bytes into
+ * out, which has room for len code points, adds the invalid sequences to
+ * *invalid and returns the number of code points.
+ */
+typedef struct {
+  const char *name;
+  size_t (*decode)(const char8_t *input, size_t len, uint32_t *out,
+                   size_t *invalid);
+} Utf8DecodeKernel;
+/**
+ * The utf8_decode_buffer kernels this CPU runs, scalar first; the last one
+ * is the one utf8_decode_buffer dispatches to.
+ */
+size_t utf8_decode_kernels(const Utf8DecodeKernel **kernels);
+
 #endif
@@ -1,6 +1,8 @@
-#define _POSIX_C_SOURCE 200809L
+#define _XOPEN_SOURCE 700
 
 #include <errno.h>
+#include <fcntl.h>
+#include <fnmatch.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,95 +12,103 @@
 #include <unistd.h>
 
 #include "ckdint_compat.h"
+#include "decompress.h"
 #include "io_utils.h"
 #include "utf8.h"
 
-bool read_file_bytes(const char *path, char8_t **out, size_t *out_len) {
-  if (!path || !out || !out_len)
+bool file_view_open(const char *path, FileView *view) {
+  *view = (FileView){.data = (const char8_t *)""};
+  if (!path)
     return false;
 
-  FILE *fp = fopen(path, "rb");
-  if (!fp) {
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
     fprintf(stderr, "Failed to open input file: %s\n", path);
     return false;
   }
-
-  int fd = fileno(fp);
   struct stat st;
-  if (fd < 0 || fstat(fd, &st) != 0) {
+  if (fstat(fd, &st) != 0) {
     fprintf(stderr, "Failed to stat input file: %s\n", path);
-    fclose(fp);
+    close(fd);
     return false;
   }
   if (!S_ISREG(st.st_mode)) {
     fprintf(stderr, "Not a regular file: %s\n", path);
-    fclose(fp);
+    close(fd);
     return false;
   }
   if ((uintmax_t)st.st_size > SIZE_MAX) {
     fprintf(stderr, "Input file too large: %s\n", path);
-    fclose(fp);
+    close(fd);
     return false;
   }
-
   size_t byte_len = (size_t)st.st_size;
-  size_t alloc_size = 0;
-  if (ckd_add(&alloc_size, byte_len, (size_t)1)) {
-    fprintf(stderr, "Input file too large: %s\n", path);
+
+  CompressionKind kind = compression_from_name(path);
+  if (kind != COMPRESSION_NONE) {
+    FILE *fp = fdopen(fd, "rb");
+    if (!fp) {
+      fprintf(stderr, "Failed to open input file: %s\n", path);
+      close(fd);
+      return false;
+    }
+    bool ok = decompress_file(fp, kind, path, byte_len, &view->data,
+                              &view->len);
     fclose(fp);
-    return false;
+    return ok;
   }
-  auto buffer = (char8_t *)calloc(alloc_size, sizeof(char8_t));
-  if (!buffer) {
-    fprintf(stderr, "Failed to allocate text buffer for: %s\n", path);
-    fclose(fp);
-    return false;
+  if (byte_len == 0) {
+    close(fd);
+    return true;
   }
 
-  bool mapped_used = false;
-  void *mapped = MAP_FAILED;
-  if (byte_len > 0) {
-    mapped = mmap(nullptr, byte_len, PROT_READ, MAP_PRIVATE, fd, 0);
-    if (mapped != MAP_FAILED) {
+  void *mapped = mmap(nullptr, byte_len, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (mapped != MAP_FAILED) {
 #if defined(MADV_SEQUENTIAL)
-      madvise(mapped, byte_len, MADV_SEQUENTIAL);
+    madvise(mapped, byte_len, MADV_SEQUENTIAL);
 #endif
-      mapped_used = true;
-      const char8_t *src = (const char8_t *)mapped;
-      for (size_t i = 0; i < byte_len; ++i) {
-        char8_t c = src[i];
-        buffer[i] =
-            (c == (char8_t)'\n' || c == (char8_t)'\r') ? (char8_t)' ' : c;
-      }
-    }
+    close(fd);
+    view->map = mapped;
+    view->data = (const char8_t *)mapped;
+    view->len = byte_len;
+    return true;
   }
 
-  if (!mapped_used) {
-    size_t read_count = fread(buffer, 1, byte_len, fp);
-    if (read_count != byte_len) {
-      fprintf(stderr, "Failed to read full input file: %s\n", path);
-      free(buffer);
-      fclose(fp);
-      return false;
-    }
-    for (size_t i = 0; i < byte_len; ++i) {
-      char8_t c = buffer[i];
-      buffer[i] = (c == (char8_t)'\n' || c == (char8_t)'\r') ? (char8_t)' ' : c;
-    }
+  // Files that cannot be mapped are read into a buffer of their own.
+  auto buffer = (char8_t *)malloc(byte_len);
+  if (!buffer) {
+    fprintf(stderr, "Failed to allocate text buffer for: %s\n", path);
+    close(fd);
+    return false;
   }
-
-  if (mapped != MAP_FAILED) {
-    munmap(mapped, byte_len);
+  size_t done = 0;
+  while (done < byte_len) {
+    ssize_t got = read(fd, buffer + done, byte_len - done);
+    if (got < 0 && errno == EINTR)
+      continue;
+    if (got <= 0)
+      break;
+    done += (size_t)got;
+  }
+  close(fd);
+  if (done != byte_len) {
+    fprintf(stderr, "Failed to read full input file: %s\n", path);
+    free(buffer);
+    return false;
   }
-  fclose(fp);
-
-  buffer[byte_len] = (char8_t)'\0';
-
-  *out = buffer;
-  *out_len = byte_len;
+  view->owned = buffer;
+  view->data = buffer;
+  view->len = byte_len;
   return true;
 }
 
+void file_view_close(FileView *view) {
+  if (view->map)
+    munmap(view->map, view->len);
+  free(view->owned);
+  *view = (FileView){.data = (const char8_t *)""};
+}
+
 bool write_file_bytes(const char *path, const char8_t *data, size_t len) {
   FILE *fp = fopen(path, "wb");
   if (!fp) {
@@ -159,6 +169,30 @@ char *join_path(const char *dir, const char *name) {
   return path;
 }
 
+bool name_matches_mask(const char *mask, const char *name) {
+  if (fnmatch(mask, name, 0) == 0)
+    return true;
+  size_t suffix_len = compression_suffix_len(name);
+  if (suffix_len == 0)
+    return false;
+  char *stripped = strip_compression_suffix(name);
+  bool match = stripped && fnmatch(mask, stripped, 0) == 0;
+  free(stripped);
+  return match;
+}
+
+char *strip_compression_suffix(const char *name) {
+  if (!name)
+    return nullptr;
+  size_t len = strlen(name) - compression_suffix_len(name);
+  auto out = (char *)malloc(len + 1);
+  if (!out)
+    return nullptr;
+  memcpy(out, name, len);
+  out[len] = '\0';
+  return out;
+}
+
 bool is_regular_file(const char *path) {
   struct stat st;
   if (stat(path, &st) != 0) {
@@ -190,3 +224,19 @@ bool ensure_directory(const char *path, bool create) {
   }
   return true;
 }
+
+bool path_within(const char *path, const char *dir) {
+  char *real_path = realpath(path, nullptr);
+  char *real_dir = realpath(dir, nullptr);
+  bool within = false;
+  if (real_path && real_dir) {
+    size_t dir_len = strlen(real_dir);
+    // "/" is the only resolved path that already ends in a separator.
+    within = strncmp(real_path, real_dir, dir_len) == 0 &&
+             (real_path[dir_len] == '\0' || real_path[dir_len] == '/' ||
+              real_dir[dir_len - 1] == '/');
+  }
+  free(real_path);
+  free(real_dir);
+  return within;
+}
@@ -0,0 +1,384 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "jsonl.h"
+
+static constexpr size_t JSONL_MAX_ESCAPED_KEY = 256;
+static constexpr size_t JSONL_READ_CHUNK = 64 * 1'024;
+
+bool jsonl_reader_open(JsonlReader *reader, const char *path) {
+  *reader = (JsonlReader){0};
+  reader->fp = fopen(path, "rb");
+  if (!reader->fp) {
+    fprintf(stderr, "Failed to open input file: %s\n", path);
+    return false;
+  }
+  struct stat st;
+  if (fstat(fileno(reader->fp), &st) == 0 && st.st_size > 0)
+    reader->size = (size_t)st.st_size;
+  CompressionKind kind = compression_from_name(path);
+  if (kind != COMPRESSION_NONE) {
+    reader->stream = decompress_open(reader->fp, kind, path);
+    if (!reader->stream) {
+      jsonl_reader_close(reader);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Append more of the shard after buf[end], first sliding the unread tail to
+// the front and growing the buffer when a record fills it.
+static bool fill(JsonlReader *reader) {
+  if (reader->start > 0) {
+    memmove(reader->buf, reader->buf + reader->start,
+            reader->end - reader->start);
+    reader->end -= reader->start;
+    reader->scan -= reader->start;
+    reader->start = 0;
+  }
+  if (reader->cap - reader->end < JSONL_READ_CHUNK) {
+    size_t next_cap = reader->cap ? reader->cap : JSONL_READ_CHUNK;
+    while (next_cap - reader->end < JSONL_READ_CHUNK) {
+      if (next_cap > SIZE_MAX / 2)
+        return false;
+      next_cap *= 2;
+    }
+    auto next = (char *)realloc(reader->buf, next_cap);
+    if (!next)
+      return false;
+    reader->buf = next;
+    reader->cap = next_cap;
+  }
+  size_t room = reader->cap - reader->end;
+  size_t got = 0;
+  if (reader->stream) {
+    bool failed = false;
+    got = decompress_read(reader->stream, reader->buf + reader->end, room,
+                          &failed);
+    if (failed)
+      return false;
+  } else {
+    got = fread(reader->buf + reader->end, 1, room, reader->fp);
+    if (got < room && ferror(reader->fp))
+      return false;
+  }
+  reader->end += got;
+  reader->eof = got < room;
+  return true;
+}
+
+bool jsonl_reader_next(JsonlReader *reader, const char **line, size_t *len) {
+  for (;;) {
+    char *newline = reader->scan < reader->end
+                        ? memchr(reader->buf + reader->scan, '\n',
+                                 reader->end - reader->scan)
+                        : nullptr;
+    size_t stop = newline ? (size_t)(newline - reader->buf) : reader->end;
+    if (newline || (reader->eof && reader->start < reader->end)) {
+      size_t n = stop - reader->start;
+      *line = reader->buf + reader->start;
+      while (n > 0 && (*line)[n - 1] == '\r')
+        n--;
+      *len = n;
+      reader->start = newline ? stop + 1 : stop;
+      reader->scan = reader->start;
+      return true;
+    }
+    if (reader->eof || reader->failed)
+      return false;
+    reader->scan = reader->end;
+    if (!fill(reader)) {
+      reader->failed = true;
+      return false;
+    }
+  }
+}
+
+void jsonl_reader_close(JsonlReader *reader) {
+  if (!reader)
+    return;
+  decompress_close(reader->stream);
+  if (reader->fp)
+    fclose(reader->fp);
+  free(reader->buf);
+  *reader = (JsonlReader){0};
+}
+
+static inline bool is_json_space(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static size_t skip_space(const char *s, size_t len, size_t at) {
+  while (at < len && is_json_space(s[at]))
+    at++;
+  return at;
+}
+
+// at is just past an opening quote; returns the index of the closing quote
+// or len when the string is unterminated.
+static size_t skip_string(const char *s, size_t len, size_t at,
+                          bool *escaped) {
+  *escaped = false;
+  const char *quote = nullptr;
+  while (at < len) {
+    if (!quote || quote < s + at) {
+      quote = memchr(s + at, '"', len - at);
+      if (!quote)
+        return len;
+    }
+    const char *slash = memchr(s + at, '\\', (size_t)(quote - (s + at)));
+    if (!slash)
+      return (size_t)(quote - s);
+    *escaped = true;
+    at = (size_t)(slash - s) + 2;
+  }
+  return len;
+}
+
+// Skip any JSON value starting at at; returns the index just past it, or len
+// when it runs off the end of the record.
+static size_t skip_value(const char *s, size_t len, size_t at) {
+  bool escaped = false;
+  if (at >= len)
+    return len;
+  if (s[at] == '"') {
+    size_t end = skip_string(s, len, at + 1, &escaped);
+    return end < len ? end + 1 : len;
+  }
+  if (s[at] != '{' && s[at] != '[') {
+    while (at < len && s[at] != ',' && s[at] != '}' && s[at] != ']' &&
+           !is_json_space(s[at])) {
+      at++;
+    }
+    return at;
+  }
+  size_t depth = 0;
+  while (at < len) {
+    char c = s[at];
+    if (c == '"') {
+      at = skip_string(s, len, at + 1, &escaped);
+      if (at >= len)
+        return len;
+    } else if (c == '{' || c == '[') {
+      depth++;
+    } else if (c == '}' || c == ']') {
+      if (--depth == 0)
+        return at + 1;
+    }
+    at++;
+  }
+  return len;
+}
+
+static bool key_matches(const char *raw, size_t raw_len, bool escaped,
+                        const char *field, size_t field_len) {
+  if (!escaped)
+    return raw_len == field_len && memcmp(raw, field, field_len) == 0;
+  char8_t decoded[JSONL_MAX_ESCAPED_KEY];
+  size_t decoded_len = 0;
+  return raw_len <= JSONL_MAX_ESCAPED_KEY &&
+         jsonl_decode_string(raw, raw_len, decoded, &decoded_len) &&
+         decoded_len == field_len && memcmp(decoded, field, field_len) == 0;
+}
+
+JsonlFieldStatus jsonl_find_string_field(const char *line, size_t len,
+                                         const char *field,
+                                         size_t *value_start,
+                                         size_t *value_end) {
+  size_t field_len = strlen(field);
+  size_t at = skip_space(line, len, 0);
+  if (at >= len || line[at] != '{')
+    return JSONL_FIELD_MALFORMED;
+  at = skip_space(line, len, at + 1);
+  if (at < len && line[at] == '}')
+    return JSONL_FIELD_MISSING;
+  while (at < len) {
+    if (line[at] != '"')
+      return JSONL_FIELD_MALFORMED;
+    bool escaped = false;
+    size_t key_end = skip_string(line, len, at + 1, &escaped);
+    if (key_end >= len)
+      return JSONL_FIELD_MALFORMED;
+    bool match = key_matches(line + at + 1, key_end - at - 1, escaped, field,
+                             field_len);
+    at = skip_space(line, len, key_end + 1);
+    if (at >= len || line[at] != ':')
+      return JSONL_FIELD_MALFORMED;
+    at = skip_space(line, len, at + 1);
+    if (at >= len)
+      return JSONL_FIELD_MALFORMED;
+    if (match && line[at] == '"') {
+      size_t end = skip_string(line, len, at + 1, &escaped);
+      if (end >= len)
+        return JSONL_FIELD_MALFORMED;
+      *value_start = at + 1;
+      *value_end = end;
+      return JSONL_FIELD_FOUND;
+    }
+    at = skip_space(line, len, skip_value(line, len, at));
+    if (at >= len)
+      return JSONL_FIELD_MALFORMED;
+    if (line[at] == '}')
+      return JSONL_FIELD_MISSING;
+    if (line[at] != ',')
+      return JSONL_FIELD_MALFORMED;
+    at = skip_space(line, len, at + 1);
+  }
+  return JSONL_FIELD_MALFORMED;
+}
+
+static bool parse_hex4(const char *s, uint32_t *out) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < 4; ++i) {
+    char c = s[i];
+    uint32_t digit = 0;
+    if (c >= '0' && c <= '9')
+      digit = (uint32_t)(c - '0');
+    else if (c >= 'a' && c <= 'f')
+      digit = (uint32_t)(c - 'a' + 10);
+    else if (c >= 'A' && c <= 'F')
+      digit = (uint32_t)(c - 'A' + 10);
+    else
+      return false;
+    value = value << 4 | digit;
+  }
+  *out = value;
+  return true;
+}
+
+static size_t put_utf8(char8_t *out, uint32_t cp) {
+  if (cp < 0x80) {
+    out[0] = (char8_t)cp;
+    return 1;
+  }
+  if (cp < 0x800) {
+    out[0] = (char8_t)(0xC0 | cp >> 6);
+    out[1] = (char8_t)(0x80 | (cp & 0x3F));
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = (char8_t)(0xE0 | cp >> 12);
+    out[1] = (char8_t)(0x80 | (cp >> 6 & 0x3F));
+    out[2] = (char8_t)(0x80 | (cp & 0x3F));
+    return 3;
+  }
+  out[0] = (char8_t)(0xF0 | cp >> 18);
+  out[1] = (char8_t)(0x80 | (cp >> 12 & 0x3F));
+  out[2] = (char8_t)(0x80 | (cp >> 6 & 0x3F));
+  out[3] = (char8_t)(0x80 | (cp & 0x3F));
+  return 4;
+}
+
+bool jsonl_decode_string(const char *src, size_t len, char8_t *out,
+                         size_t *out_len) {
+  size_t pos = 0;
+  size_t at = 0;
+  while (at < len) {
+    const char *slash = memchr(src + at, '\\', len - at);
+    size_t run = slash ? (size_t)(slash - src) - at : len - at;
+    memcpy(out + pos, src + at, run);
+    pos += run;
+    at += run;
+    if (at >= len)
+      break;
+    if (at + 1 >= len)
+      return false;
+    char c = src[at + 1];
+    at += 2;
+    switch (c) {
+    case '"':
+    case '\\':
+    case '/':
+      out[pos++] = (char8_t)c;
+      continue;
+    case 'b':
+      out[pos++] = (char8_t)'\b';
+      continue;
+    case 'f':
+      out[pos++] = (char8_t)'\f';
+      continue;
+    case 'n':
+      out[pos++] = (char8_t)'\n';
+      continue;
+    case 'r':
+      out[pos++] = (char8_t)'\r';
+      continue;
+    case 't':
+      out[pos++] = (char8_t)'\t';
+      continue;
+    case 'u':
+      break;
+    default:
+      return false;
+    }
+    uint32_t cp = 0;
+    if (at + 4 > len || !parse_hex4(src + at, &cp))
+      return false;
+    at += 4;
+    if (cp >= 0xD800 && cp <= 0xDBFF) {
+      uint32_t low = 0;
+      if (at + 6 <= len && src[at] == '\\' && src[at + 1] == 'u' &&
+          parse_hex4(src + at + 2, &low) && low >= 0xDC00 && low <= 0xDFFF) {
+        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+        at += 6;
+      } else {
+        cp = 0xFFFD;
+      }
+    } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+      cp = 0xFFFD;
+    }
+    // Every escape is at least as long as the UTF-8 it decodes to.
+    pos += put_utf8(out + pos, cp);
+  }
+  *out_len = pos;
+  return true;
+}
+
+size_t jsonl_encode_string(const char8_t *src, size_t len, char *out) {
+  static const char HEX[] = "0123456789abcdef";
+  size_t pos = 0;
+  for (size_t i = 0; i < len; ++i) {
+    unsigned char c = (unsigned char)src[i];
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      out[pos++] = (char)c;
+      continue;
+    }
+    out[pos++] = '\\';
+    switch (c) {
+    case '"':
+    case '\\':
+      out[pos++] = (char)c;
+      break;
+    case '\b':
+      out[pos++] = 'b';
+      break;
+    case '\f':
+      out[pos++] = 'f';
+      break;
+    case '\n':
+      out[pos++] = 'n';
+      break;
+    case '\r':
+      out[pos++] = 'r';
+      break;
+    case '\t':
+      out[pos++] = 't';
+      break;
+    default:
+      out[pos++] = 'u';
+      out[pos++] = '0';
+      out[pos++] = '0';
+      out[pos++] = HEX[c >> 4];
+      out[pos++] = HEX[c & 0xF];
+      break;
+    }
+  }
+  return pos;
+}
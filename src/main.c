@@ -1,5 +1,6 @@
 #include <string.h>
 
+#include "bench_kernels.h"
 #include "dedup.h"
 #include "search_mode.h"
 #include "verify_mode.h"
@@ -11,5 +12,8 @@ int main(int argc, char **argv) {
   if (argc >= 2 && strcmp(argv[1], "--verify") == 0) {
     return run_verify(argv[0], argc - 1, argv + 1);
   }
+  if (argc >= 2 && strcmp(argv[1], "--bench-kernels") == 0) {
+    return run_bench_kernels(argv[0], argc - 1, argv + 1);
+  }
   return run_dedup(argv[0], argc, argv);
 }
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ckdint_compat.h"
+#include "config.h"
+#include "io_utils.h"
+#include "manifest.h"
+
+// Parse a size column of decimal digits.
+static bool parse_size(const char *text, size_t len, uint64_t *out) {
+  if (len == 0)
+    return false;
+  uint64_t value = 0;
+  for (size_t i = 0; i < len; ++i) {
+    if (text[i] < '0' || text[i] > '9')
+      return false;
+    if (ckd_mul(&value, value, (uint64_t)10) ||
+        ckd_add(&value, value, (uint64_t)(text[i] - '0')))
+      return false;
+  }
+  *out = value;
+  return true;
+}
+
+// Whether the relative path names something outside the root.
+static bool escapes_root(const char *name, size_t len) {
+  if (len == 0 || name[0] == '/')
+    return true;
+  for (size_t start = 0; start < len;) {
+    const char *slash = memchr(name + start, '/', len - start);
+    size_t end = slash ? (size_t)(slash - name) : len;
+    if (end - start == 2 && name[start] == '.' && name[start + 1] == '.')
+      return true;
+    start = end + 1;
+  }
+  return false;
+}
+
+// Copy name[0, len) into the pool as root/name; the name starts at the
+// returned path plus *prefix_len.
+static char *pool_path(Arena *pool, const char *root, size_t root_len,
+                       const char *name, size_t len, size_t *prefix_len) {
+  bool sep = root_len > 0 && root[root_len - 1] != '/';
+  *prefix_len = root_len + (sep ? 1 : 0);
+  auto path = (char *)arena_alloc(pool, *prefix_len + len + 1);
+  memcpy(path, root, root_len);
+  if (sep)
+    path[root_len] = '/';
+  memcpy(path + *prefix_len, name, len);
+  path[*prefix_len + len] = '\0';
+  return path;
+}
+
+bool manifest_load(const char *path, const char *root, const char *mask,
+                   Manifest *out) {
+  *out = (Manifest){0};
+  FileView view;
+  if (!file_view_open(path, &view)) {
+    fprintf(stderr, "Failed to read manifest: %s\n", path);
+    return false;
+  }
+  const char *text = (const char *)view.data;
+  size_t len = view.len;
+  char delim = memchr(text, '\0', len) ? '\0' : '\n';
+  size_t records = 0;
+  for (size_t i = 0; i < len; ++i) {
+    records += text[i] == delim;
+  }
+  records++; // a last record without a delimiter
+
+  size_t root_len = strlen(root);
+  size_t pool_bytes = 0;
+  if (ckd_mul(&pool_bytes, records, root_len + 16) ||
+      ckd_add(&pool_bytes, pool_bytes, len)) {
+    pool_bytes = DIR_SCAN_POOL_BLOCK;
+  }
+  auto files = (ScanBatch *)calloc(1, sizeof(ScanBatch));
+  if (files) {
+    files->entries = (ScanEntry *)malloc(records * sizeof(ScanEntry));
+    files->pool = arena_create(pool_bytes);
+  }
+  auto sizes = (uint64_t *)malloc(records * sizeof(uint64_t));
+  if (!files || !files->entries || !files->pool || !sizes) {
+    fprintf(stderr, "Failed to allocate manifest: %s\n", path);
+    scan_batch_free(files);
+    free(sizes);
+    file_view_close(&view);
+    return false;
+  }
+
+  bool ok = true;
+  size_t line = 0;
+  for (size_t start = 0; ok && start < len;) {
+    const char *record = text + start;
+    const char *end = memchr(record, delim, len - start);
+    size_t record_len = end ? (size_t)(end - record) : len - start;
+    start += record_len + 1;
+    line++;
+    if (delim == '\n' && record_len > 0 && record[record_len - 1] == '\r')
+      record_len--;
+    if (record_len == 0)
+      continue;
+
+    size_t name_len = record_len;
+    uint64_t size = 0;
+    size_t tab = record_len;
+    while (tab > 0 && record[tab - 1] != '\t')
+      tab--;
+    if (tab > 0) {
+      name_len = tab - 1;
+      if (!parse_size(record + tab, record_len - tab, &size)) {
+        fprintf(stderr, "Invalid size in manifest %s, record %zu\n", path,
+                line);
+        ok = false;
+        break;
+      }
+    }
+    while (name_len >= 2 && record[0] == '.' && record[1] == '/') {
+      record += 2;
+      name_len -= 2;
+    }
+    if (escapes_root(record, name_len)) {
+      fprintf(stderr,
+              "Manifest %s, record %zu: not a path inside the input "
+              "directory: %.*s\n",
+              path, line, (int)name_len, record);
+      ok = false;
+      break;
+    }
+
+    size_t prefix_len = 0;
+    char *file_path =
+        pool_path(files->pool, root, root_len, record, name_len, &prefix_len);
+    const char *name = file_path + prefix_len;
+    const char *base = strrchr(name, '/');
+    if (mask && !name_matches_mask(mask, base ? base + 1 : name))
+      continue;
+    sizes[files->count] = size;
+    files->entries[files->count++] =
+        (ScanEntry){.name = name, .path = file_path};
+  }
+  file_view_close(&view);
+  if (!ok) {
+    scan_batch_free(files);
+    free(sizes);
+    return false;
+  }
+  out->files = files;
+  out->sizes = sizes;
+  return true;
+}
+
+void manifest_free(Manifest *manifest) {
+  scan_batch_free(manifest->files);
+  free(manifest->sizes);
+  *manifest = (Manifest){0};
+}
@@ -0,0 +1,123 @@
+#include <math.h>
+#include <string.h>
+
+#include "config.h"
+#include "minhash.h"
+
+static constexpr uint64_t EMPTY_BIN = UINT64_MAX;
+static constexpr uint64_t BAND_GAMMA = 0x9E3779B97F4A7C15ULL;
+static constexpr uint64_t DENSIFY_SEED = 0xD6E8FEB86659FD93ULL;
+
+static inline uint64_t mix64(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33;
+  x *= 0xC4CEB9FE1A85EC53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+// Map a uniform 64-bit hash onto [0, range) without a division.
+static inline size_t fast_range(uint64_t hash, size_t range) {
+  return (size_t)(((hash >> 32) * (uint64_t)range) >> 32);
+}
+
+bool minhash_init(MinHasher *hasher, size_t shingle_words, size_t permutations,
+                  size_t bands) {
+  if (!hasher)
+    return false;
+  *hasher = (MinHasher){0};
+  if (shingle_words == 0 || shingle_words > MINHASH_MAX_SHINGLE_WORDS ||
+      permutations == 0 || permutations > MINHASH_MAX_PERMUTATIONS ||
+      bands == 0 || permutations % bands != 0) {
+    return false;
+  }
+  hasher->shingle_words = shingle_words;
+  hasher->permutations = permutations;
+  hasher->bands = bands;
+  hasher->rows = permutations / bands;
+  return true;
+}
+
+static inline void signature_add(uint64_t *signature, size_t bins,
+                                 uint64_t shingle) {
+  size_t bin = fast_range(shingle, bins);
+  if (shingle < signature[bin])
+    signature[bin] = shingle;
+}
+
+// Optimal densification (Shrivastava, ICML 2017): every empty bin borrows
+// the value of a bin chosen by its own hash sequence, so two documents fill a
+// given empty bin from the same donor whenever both donors are non-empty.
+static void signature_densify(uint64_t *signature, size_t bins) {
+  bool filled[MINHASH_MAX_PERMUTATIONS];
+  size_t filled_count = 0;
+  for (size_t i = 0; i < bins; ++i) {
+    filled[i] = signature[i] != EMPTY_BIN;
+    filled_count += filled[i];
+  }
+  if (filled_count == 0 || filled_count == bins)
+    return;
+  for (size_t i = 0; i < bins; ++i) {
+    if (filled[i])
+      continue;
+    for (uint64_t attempt = 0;; ++attempt) {
+      size_t donor = fast_range(
+          mix64(DENSIFY_SEED ^ ((uint64_t)i << 32 | attempt)), bins);
+      if (filled[donor]) {
+        signature[i] = signature[donor];
+        break;
+      }
+    }
+  }
+}
+
+void minhash_signature(const MinHasher *hasher, const char8_t *text,
+                       size_t len, uint64_t *signature) {
+  size_t bins = hasher->permutations;
+  for (size_t i = 0; i < bins; ++i) {
+    signature[i] = EMPTY_BIN;
+  }
+  if (!text || len == 0)
+    return;
+
+  // Ring of the start offsets of the last shingle_words words. A shingle is
+  // the contiguous byte range from its first word to the end of its last.
+  size_t starts[MINHASH_MAX_SHINGLE_WORDS];
+  size_t words = 0;
+  size_t pos = 0;
+  while (pos < len) {
+    size_t word_start = pos;
+    const void *space = memchr(text + pos, ' ', len - pos);
+    pos = space ? (size_t)((const char8_t *)space - text) : len;
+    starts[words % hasher->shingle_words] = word_start;
+    words++;
+    if (words >= hasher->shingle_words) {
+      size_t first = starts[words % hasher->shingle_words];
+      signature_add(signature, bins,
+                    hash_bytes_128(text + first, pos - first).lo);
+    }
+    pos++; // skip the separator
+  }
+
+  // Documents shorter than one shingle are hashed whole.
+  if (words < hasher->shingle_words) {
+    signature_add(signature, bins, hash_bytes_128(text, len).lo);
+  }
+  signature_densify(signature, bins);
+}
+
+Hash128 minhash_band_key(const MinHasher *hasher, const uint64_t *signature,
+                         size_t band) {
+  Hash128 key =
+      hash_bytes_128((const unsigned char *)(signature + band * hasher->rows),
+                     hasher->rows * sizeof(uint64_t));
+  key.hi ^= (uint64_t)(band + 1) * BAND_GAMMA;
+  return key;
+}
+
+double minhash_threshold(const MinHasher *hasher) {
+  if (!hasher || hasher->bands == 0 || hasher->rows == 0)
+    return 0.0;
+  return pow(1.0 / (double)hasher->bands, 1.0 / (double)hasher->rows);
+}
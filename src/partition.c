@@ -0,0 +1,228 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ckdint_compat.h"
+#include "io_utils.h"
+#include "partition.h"
+
+static constexpr char PARTITION_MAGIC[8] = {'C', 'D', 'D', 'X',
+                                            'P', 'A', 'R', 'T'};
+static constexpr uint32_t PARTITION_VERSION = 3; // 3: --normalize
+
+static_assert(sizeof(PartitionHeader) % 8 == 0,
+              "winner records must stay 8-byte aligned");
+
+static inline uint64_t mix64(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33;
+  x *= 0xC4CEB9FE1A85EC53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+bool partition_parse(const char *arg, PartitionSpec *spec) {
+  if (!arg || !spec)
+    return false;
+  errno = 0;
+  char *end = nullptr;
+  unsigned long index = strtoul(arg, &end, 10);
+  if (errno != 0 || end == arg || *end != '/')
+    return false;
+  const char *count_arg = end + 1;
+  unsigned long count = strtoul(count_arg, &end, 10);
+  if (errno != 0 || end == count_arg || *end != '\0')
+    return false;
+  if (count == 0 || count > UINT32_MAX || index >= count)
+    return false;
+  *spec = (PartitionSpec){.index = (uint32_t)index, .count = (uint32_t)count};
+  return true;
+}
+
+bool partition_owns(const PartitionSpec *spec, uint64_t key) {
+  if (!spec || spec->count <= 1)
+    return true;
+  uint64_t bucket = ((mix64(key) >> 32) * spec->count) >> 32;
+  return bucket == spec->index;
+}
+
+char *partition_path(const char *dir, uint32_t index, uint32_t count) {
+  char name[64];
+  snprintf(name, sizeof(name), "partition-%u-of-%u.win", index, count);
+  return join_path(dir, name);
+}
+
+bool unit_positions_append(UnitPositionList *list, UnitPosition position) {
+  if (list->count == list->cap) {
+    size_t next_cap = list->cap ? list->cap : 1'024;
+    if (list->cap && ckd_mul(&next_cap, list->cap, (size_t)2))
+      return false;
+    size_t alloc_size = 0;
+    if (ckd_mul(&alloc_size, next_cap, sizeof(UnitPosition)))
+      return false;
+    auto next = (UnitPosition *)realloc(list->items, alloc_size);
+    if (!next)
+      return false;
+    list->items = next;
+    list->cap = next_cap;
+  }
+  list->items[list->count++] = position;
+  return true;
+}
+
+void unit_positions_free(UnitPositionList *list) {
+  if (!list)
+    return;
+  free(list->items);
+  *list = (UnitPositionList){0};
+}
+
+bool partition_write(const char *path, const PartitionLayout *layout,
+                     const PartitionSpec *spec,
+                     const UnitPositionList *winners) {
+  if (!path || !layout || !spec || !winners)
+    return false;
+  size_t path_len = strlen(path);
+  auto tmp_path = (char *)malloc(path_len + sizeof(".tmp"));
+  if (!tmp_path)
+    return false;
+  memcpy(tmp_path, path, path_len);
+  memcpy(tmp_path + path_len, ".tmp", sizeof(".tmp"));
+
+  PartitionHeader header = {.version = PARTITION_VERSION,
+                            .header_size = sizeof(PartitionHeader),
+                            .layout = *layout,
+                            .partition_index = spec->index,
+                            .partition_count = spec->count,
+                            .winner_count = winners->count};
+  memcpy(header.magic, PARTITION_MAGIC, sizeof(PARTITION_MAGIC));
+
+  FILE *fp = fopen(tmp_path, "wb");
+  bool ok = fp && fwrite(&header, sizeof(header), 1, fp) == 1 &&
+            fwrite(winners->items, sizeof(UnitPosition), winners->count, fp) ==
+                winners->count;
+  if (fp && fclose(fp) != 0)
+    ok = false;
+  if (ok && rename(tmp_path, path) != 0)
+    ok = false;
+  if (!ok) {
+    fprintf(stderr, "Failed to write winner list: %s\n", path);
+    if (fp)
+      remove(tmp_path);
+  }
+  free(tmp_path);
+  return ok;
+}
+
+// Append one partition's winners to out after validating its header. The
+// merge hashes no units, so the lists only have to agree with each other on
+// the unit hash: *unit_hash is the first list's, or UINT32_MAX before it.
+static bool partition_read(const char *path, uint32_t index, uint32_t count,
+                           const PartitionLayout *layout, uint32_t *unit_hash,
+                           UnitPositionList *out) {
+  FILE *fp = fopen(path, "rb");
+  if (!fp) {
+    fprintf(stderr, "Missing winner list: %s\n", path);
+    return false;
+  }
+  PartitionHeader header;
+  bool ok = fread(&header, sizeof(header), 1, fp) == 1 &&
+            memcmp(header.magic, PARTITION_MAGIC, sizeof(PARTITION_MAGIC)) ==
+                0 &&
+            header.version == PARTITION_VERSION &&
+            header.header_size == sizeof(PartitionHeader) &&
+            header.partition_index == index &&
+            header.partition_count == count;
+  if (!ok) {
+    fprintf(stderr, "Corrupt or unsupported winner list: %s\n", path);
+    fclose(fp);
+    return false;
+  }
+
+  const char *what = nullptr;
+  const DedupIndexParams *saved = &header.layout.params;
+  if (saved->fingerprint_only != layout->params.fingerprint_only) {
+    what = "key type (--fingerprint-only)";
+  } else if (saved->dedup_mode != layout->params.dedup_mode) {
+    what = "--dedup-mode";
+  } else if (saved->max_compare_len != layout->params.max_compare_len) {
+    what = "--max-length";
+  } else if (saved->normalize != layout->params.normalize) {
+    what = "--normalize";
+  } else if (*unit_hash != UINT32_MAX && saved->unit_hash != *unit_hash) {
+    what = "--hash";
+  } else if (header.layout.file_count != layout->file_count ||
+             header.layout.names_hash != layout->names_hash) {
+    what = "set of input files";
+  }
+  if (what) {
+    fprintf(stderr, "Winner list %s was built with a different %s\n", path,
+            what);
+    fclose(fp);
+    return false;
+  }
+  *unit_hash = saved->unit_hash;
+
+  size_t total = 0;
+  size_t alloc_size = 0;
+  if (header.winner_count > SIZE_MAX ||
+      ckd_add(&total, out->count, (size_t)header.winner_count) ||
+      ckd_mul(&alloc_size, total, sizeof(UnitPosition))) {
+    fclose(fp);
+    return false;
+  }
+  if (total > out->cap) {
+    auto next = (UnitPosition *)realloc(out->items, alloc_size);
+    if (!next) {
+      fclose(fp);
+      return false;
+    }
+    out->items = next;
+    out->cap = total;
+  }
+  size_t wanted = (size_t)header.winner_count;
+  ok = fread(out->items + out->count, sizeof(UnitPosition), wanted, fp) ==
+       wanted;
+  fclose(fp);
+  if (!ok) {
+    fprintf(stderr, "Truncated winner list: %s\n", path);
+    return false;
+  }
+  for (size_t i = 0; i < wanted; ++i) {
+    if (out->items[out->count + i].file >= layout->file_count) {
+      fprintf(stderr, "Corrupt or unsupported winner list: %s\n", path);
+      return false;
+    }
+  }
+  out->count = total;
+  return true;
+}
+
+static int compare_positions(const void *a, const void *b) {
+  const UnitPosition *pa = (const UnitPosition *)a;
+  const UnitPosition *pb = (const UnitPosition *)b;
+  if (pa->file != pb->file)
+    return pa->file < pb->file ? -1 : 1;
+  if (pa->span != pb->span)
+    return pa->span < pb->span ? -1 : 1;
+  return 0;
+}
+
+bool partition_merge(const char *dir, uint32_t count,
+                     const PartitionLayout *layout, UnitPositionList *out) {
+  if (!dir || !layout || !out || count == 0)
+    return false;
+  bool ok = true;
+  uint32_t unit_hash = UINT32_MAX;
+  for (uint32_t i = 0; ok && i < count; ++i) {
+    char *path = partition_path(dir, i, count);
+    ok = path && partition_read(path, i, count, layout, &unit_hash, out);
+    free(path);
+  }
+  // Partitions own disjoint keys, so their winners never share a position.
+  if (ok && count > 1 && out->count > 1)
+    qsort(out->items, out->count, sizeof(UnitPosition), compare_positions);
+  return ok;
+}
@@ -1,6 +1,4 @@
-#include <dirent.h>
 #include <errno.h>
-#include <fnmatch.h>
 #include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -13,6 +11,7 @@
 #include "block_tree.h"
 #include "ckdint_compat.h"
 #include "config.h"
+#include "dir_scan.h"
 #include "hash_pool.h"
 #include "io_utils.h"
 #include "progress.h"
@@ -28,7 +27,8 @@ typedef struct {
 
 static void print_search_help(const char *prog) {
   printf("Usage:\n"
-         "  %s <input_dir> [mask] [--limit N]\n"
+         "  %s <input_dir> [mask] [--limit N] [--recursive]\n"
+         "  --recursive also indexes files in subdirectories\n"
          "  ASM: WAVESORT_USE_ASM=%d HASH_WORKER_USE_ASM=%d "
          "RADIX_SORT_USE_ASM=%d\n"
          "  Author: %s\n"
@@ -184,21 +184,20 @@ static bool index_search_file(SearchFile *file, const char *input_dir,
     return false;
   }
 
-  char8_t *raw_text = nullptr;
-  size_t byte_len = 0;
-  if (!read_file_bytes(file->input_path, &raw_text, &byte_len)) {
+  FileView view;
+  if (!file_view_open(file->input_path, &view)) {
     free_search_file(file);
     return false;
   }
   if (out_bytes)
-    *out_bytes = byte_len;
+    *out_bytes = view.len;
 
   uint32_t *decoded = nullptr;
   size_t decoded_len = 0;
   size_t invalid = 0;
-  if (!utf8_decode_buffer(raw_text, byte_len, &decoded, &decoded_len,
+  if (!utf8_decode_buffer(view.data, view.len, &decoded, &decoded_len,
                           &invalid)) {
-    free(raw_text);
+    file_view_close(&view);
     free_search_file(file);
     return false;
   }
@@ -206,7 +205,7 @@ static bool index_search_file(SearchFile *file, const char *input_dir,
 
   if (decoded_len == 0) {
     free(decoded);
-    free(raw_text);
+    file_view_close(&view);
     free_search_file(file);
     return true;
   }
@@ -217,13 +216,13 @@ static bool index_search_file(SearchFile *file, const char *input_dir,
   if (!append_global_text(global_text, global_len, global_cap, decoded,
                           decoded_len)) {
     free(decoded);
-    free(raw_text);
+    file_view_close(&view);
     free_search_file(file);
     return false;
   }
 
   free(decoded);
-  free(raw_text);
+  file_view_close(&view);
   if (out_added)
     *out_added = true;
   return true;
@@ -433,6 +432,7 @@ int run_search(const char *prog, int argc, char **argv) {
   bool mask_set = false;
   size_t file_limit = SIZE_MAX;
   bool limit_set = false;
+  bool recursive = false;
 
   for (int i = 1; i < argc; ++i) {
     const char *arg = argv[i];
@@ -440,6 +440,10 @@ int run_search(const char *prog, int argc, char **argv) {
       print_search_help(prog);
       return 0;
     }
+    if (strcmp(arg, "--recursive") == 0) {
+      recursive = true;
+      continue;
+    }
     if (strcmp(arg, "--limit") == 0) {
       if (i + 1 >= argc) {
         fprintf(stderr, "Missing value for --limit\n");
@@ -487,41 +491,19 @@ int run_search(const char *prog, int argc, char **argv) {
     return 1;
   }
 
-  size_t matched = 0;
-  DIR *dir = opendir(input_dir);
-  if (!dir) {
-    fprintf(stderr, "Failed to open input directory: %s\n", input_dir);
+  // One sorted scan serves both the count and the indexing pass; --limit
+  // takes the first names in that order.
+  ScanListing listing;
+  size_t errors = 0;
+  if (!dir_scan_collect(input_dir, mask, recursive, &listing, &errors)) {
+    fprintf(stderr, "Failed to scan input directory: %s\n", input_dir);
     return 1;
   }
-
-  struct dirent *entry;
-  while ((entry = readdir(dir)) != nullptr) {
-    const char *name = entry->d_name;
-    if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
-      continue;
-    }
-    if (fnmatch(mask, name, 0) != 0) {
-      continue;
-    }
-    char *input_path = join_path(input_dir, name);
-    if (!input_path) {
-      continue;
-    }
-    bool regular = is_regular_file(input_path);
-    free(input_path);
-    if (!regular) {
-      continue;
-    }
-    matched++;
-    if (limit_set && matched >= file_limit) {
-      break;
-    }
-  }
-
-  closedir(dir);
+  size_t matched = listing.count < file_limit ? listing.count : file_limit;
 
   if (matched == 0) {
     fprintf(stderr, "No files matched %s in %s\n", mask, input_dir);
+    scan_listing_free(&listing);
     return 1;
   }
 
@@ -539,38 +521,9 @@ int run_search(const char *prog, int argc, char **argv) {
   size_t global_cap = 0;
   size_t processed = 0;
   size_t bytes_processed = 0;
-  size_t errors = 0;
-
-  dir = opendir(input_dir);
-  if (!dir) {
-    fprintf(stderr, "Failed to open input directory: %s\n", input_dir);
-    return 1;
-  }
-
-  while ((entry = readdir(dir)) != nullptr) {
-    const char *name = entry->d_name;
-    if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
-      continue;
-    }
-    if (fnmatch(mask, name, 0) != 0) {
-      continue;
-    }
-
-    char *input_path = join_path(input_dir, name);
-    if (!input_path) {
-      errors++;
-      continue;
-    }
-    if (!is_regular_file(input_path)) {
-      free(input_path);
-      continue;
-    }
-    free(input_path);
-
-    if (limit_set && processed >= file_limit) {
-      break;
-    }
 
+  for (size_t i = 0; i < matched; ++i) {
+    const char *name = listing.entries[i].name;
     if (!ensure_search_capacity(&files, &files_cap, files_count + 1)) {
       fprintf(stderr, "Failed to allocate search index.\n");
       errors++;
@@ -593,7 +546,7 @@ int run_search(const char *prog, int argc, char **argv) {
     render_progress(processed, matched, bytes_processed, start_time);
   }
 
-  closedir(dir);
+  scan_listing_free(&listing);
   fprintf(stderr, "\n");
 
   if (files_count == 0 || global_len == 0) {
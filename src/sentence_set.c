@@ -1,7 +1,13 @@
+#include <stdalign.h>
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <string.h>
 #include <threads.h>
 
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 #include "ckdint_compat.h"
 #include "config.h"
 #include "hash_utils.h"
@@ -10,29 +16,55 @@
 typedef struct SentenceArenaBlock {
   uint8_t *data;
   size_t cap;
-  size_t offset;
+  atomic_size_t offset;
   struct SentenceArenaBlock *next;
 } SentenceArenaBlock;
 
-typedef struct SentenceSetShard {
-  uint64_t *hashes;
-  size_t *lengths;
-  char8_t **data;
-  uint8_t *ctrl; // 0xFF = empty, otherwise robin-hood probe distance
+// Text mode entry: payload slots point at one of these inside the arena.
+typedef struct {
+  size_t len;
+  char8_t bytes[];
+} SentenceEntry;
+
+// One open-addressing table generation. hashes[i] == 0 marks an empty slot;
+// a non-zero hash with payloads[i] == 0 is a slot that has been claimed by
+// CAS but whose payload has not been published yet. Ordered sets also keep
+// the smallest claim order seen for each key in owners[i], tagged sets the
+// tag of the insertion that added the key.
+typedef struct {
+  _Atomic uint64_t *hashes;
+  _Atomic uint64_t *payloads;
+  _Atomic uint64_t *owners;
   size_t bucket_count;
-  size_t entry_count;
+} SentenceTable;
+
+typedef struct SentenceSetShard {
+  alignas(64) _Atomic(SentenceTable *) table;
+  atomic_size_t entry_count;
+  atomic_size_t active; // inserters currently probing the table
+  atomic_bool resizing; // set while one thread migrates the table
   SentenceArena arena;
-  mtx_t lock;
-  bool lock_init;
+  bool fingerprint_only;
+  bool owned; // tables carry owners[]
 } SentenceSetShard;
 
 static constexpr size_t MIN_BUCKET_COUNT = 16;
 static constexpr size_t DEFAULT_BLOCK_SIZE = 1024;
 static constexpr size_t AVG_SENTENCE_BYTES = 64;
-static constexpr uint8_t CTRL_EMPTY = 0xFF;
-static constexpr size_t LOAD_FACTOR_NUM = 85;
+static constexpr size_t LOAD_FACTOR_NUM = 70;
 static constexpr size_t LOAD_FACTOR_DEN = 100;
-static constexpr size_t DEFAULT_SHARD_COUNT = 16;
+static constexpr size_t DEFAULT_SHARD_COUNT = 256;
+static constexpr uint64_t EMPTY_HASH = 0;
+static constexpr uint64_t PENDING_PAYLOAD = 0;
+static constexpr uint64_t UNORDERED_CLAIM = UINT64_MAX;
+
+static inline void cpu_relax() {
+#if defined(__SSE2__)
+  _mm_pause();
+#else
+  thrd_yield();
+#endif
+}
 
 static size_t round_up_pow2(size_t value) {
 #if defined(__STDC_VERSION_STDBIT_H__)
@@ -65,339 +97,424 @@ static size_t shard_index(const SentenceSet *set, uint64_t hash) {
   return (size_t)((hash >> HIGH_SHIFT) & set->shard_mask);
 }
 
+// Zero is reserved for empty slots; fold it onto 1.
+static inline uint64_t slot_hash(uint64_t hash) {
+  return hash == EMPTY_HASH ? 1 : hash;
+}
+
+// Zero is reserved for unpublished payloads; fold it onto 1.
+static inline uint64_t slot_fingerprint(uint64_t lo) {
+  return lo == PENDING_PAYLOAD ? 1 : lo;
+}
+
 static void sentence_arena_init(SentenceArena *arena, size_t block_size) {
   if (!arena)
     return;
-  arena->head = nullptr;
+  atomic_init(&arena->head, nullptr);
   arena->block_size = block_size ? block_size : DEFAULT_BLOCK_SIZE;
 }
 
 static void sentence_arena_reset(SentenceArena *arena) {
   if (!arena)
     return;
-  for (SentenceArenaBlock *block = arena->head; block; block = block->next) {
-    block->offset = 0;
+  SentenceArenaBlock *block =
+      atomic_load_explicit(&arena->head, memory_order_relaxed);
+  for (; block; block = block->next) {
+    atomic_store_explicit(&block->offset, 0, memory_order_relaxed);
   }
 }
 
 static void sentence_arena_destroy(SentenceArena *arena) {
   if (!arena)
     return;
-  SentenceArenaBlock *block = arena->head;
+  SentenceArenaBlock *block =
+      atomic_load_explicit(&arena->head, memory_order_relaxed);
   while (block) {
     SentenceArenaBlock *next = block->next;
     free(block->data);
     free(block);
     block = next;
   }
-  arena->head = nullptr;
+  atomic_store_explicit(&arena->head, nullptr, memory_order_relaxed);
   arena->block_size = 0;
 }
 
+// Lock-free bump allocator: threads reserve with fetch_add on the head block
+// and race to CAS a fresh block in when it runs out. The tail of a block that
+// loses such a race is simply abandoned.
 static void *sentence_arena_alloc(SentenceArena *arena, size_t size) {
   if (!arena || size == 0)
     return nullptr;
   size_t aligned = (size + 7) & ~(size_t)7;
-  SentenceArenaBlock *block = arena->head;
-  if (!block || block->offset + aligned > block->cap) {
+  for (;;) {
+    SentenceArenaBlock *block =
+        atomic_load_explicit(&arena->head, memory_order_acquire);
+    if (block && aligned <= block->cap) {
+      size_t offset = atomic_fetch_add_explicit(&block->offset, aligned,
+                                                memory_order_relaxed);
+      if (offset <= block->cap - aligned)
+        return block->data + offset;
+    }
+
     size_t cap = arena->block_size;
     if (cap < aligned)
       cap = aligned;
     auto next = (SentenceArenaBlock *)calloc(1, sizeof(SentenceArenaBlock));
     if (!next)
       return nullptr;
-    next->data = (uint8_t *)calloc(cap, sizeof(uint8_t));
+    next->data = (uint8_t *)malloc(cap);
     if (!next->data) {
       free(next);
       return nullptr;
     }
     next->cap = cap;
-    next->offset = 0;
+    atomic_init(&next->offset, aligned);
     next->next = block;
-    arena->head = next;
-    block = next;
+    if (atomic_compare_exchange_strong_explicit(&arena->head, &block, next,
+                                                memory_order_acq_rel,
+                                                memory_order_acquire)) {
+      return next->data;
+    }
+    free(next->data);
+    free(next);
   }
-  void *ptr = block->data + block->offset;
-  block->offset += aligned;
-  return ptr;
 }
 
-static char8_t *sentence_set_copy_data(SentenceSetShard *shard,
-                                       const char8_t *data, size_t len) {
+static SentenceEntry *sentence_set_copy_entry(SentenceSetShard *shard,
+                                              const char8_t *data,
+                                              size_t len) {
   size_t alloc_size = 0;
-  if (ckd_add(&alloc_size, len, (size_t)1))
+  if (ckd_add(&alloc_size, len, sizeof(SentenceEntry) + 1))
     return nullptr;
-  char8_t *copy = (char8_t *)sentence_arena_alloc(&shard->arena, alloc_size);
-  if (!copy)
+  auto entry = (SentenceEntry *)sentence_arena_alloc(&shard->arena, alloc_size);
+  if (!entry)
     return nullptr;
+  entry->len = len;
   if (len > 0)
-    memcpy(copy, data, len);
-  copy[len] = (char8_t)'\0';
-  return copy;
+    memcpy(entry->bytes, data, len);
+  entry->bytes[len] = (char8_t)'\0';
+  return entry;
+}
+
+static void table_destroy(SentenceTable *table) {
+  if (!table)
+    return;
+  free((void *)table->hashes);
+  free((void *)table->payloads);
+  free((void *)table->owners);
+  free(table);
+}
+
+static SentenceTable *table_create(size_t bucket_count, bool owned) {
+  size_t size = round_up_pow2(bucket_count < MIN_BUCKET_COUNT ? MIN_BUCKET_COUNT
+                                                              : bucket_count);
+  size_t alloc_size = 0;
+  if (ckd_mul(&alloc_size, size, sizeof(uint64_t)))
+    return nullptr;
+  auto table = (SentenceTable *)calloc(1, sizeof(SentenceTable));
+  if (!table)
+    return nullptr;
+  table->hashes = (_Atomic uint64_t *)calloc(1, alloc_size);
+  table->payloads = (_Atomic uint64_t *)calloc(1, alloc_size);
+  if (owned)
+    table->owners = (_Atomic uint64_t *)calloc(1, alloc_size);
+  if (!table->hashes || !table->payloads || (owned && !table->owners)) {
+    table_destroy(table);
+    return nullptr;
+  }
+  table->bucket_count = size;
+  return table;
+}
+
+static size_t table_threshold(const SentenceTable *table) {
+  size_t threshold = table->bucket_count * LOAD_FACTOR_NUM / LOAD_FACTOR_DEN;
+  return threshold == 0 ? 1 : threshold;
 }
 
 static void shard_destroy(SentenceSetShard *shard) {
   if (!shard)
     return;
-  if (shard->lock_init) {
-    mtx_destroy(&shard->lock);
-    shard->lock_init = false;
-  }
   sentence_arena_destroy(&shard->arena);
-  free(shard->hashes);
-  free(shard->lengths);
-  free(shard->data);
-  free(shard->ctrl);
-  shard->hashes = nullptr;
-  shard->lengths = nullptr;
-  shard->data = nullptr;
-  shard->ctrl = nullptr;
-  shard->bucket_count = 0;
-  shard->entry_count = 0;
-}
-
-static bool shard_init(SentenceSetShard *shard, size_t bucket_count) {
+  table_destroy(atomic_load_explicit(&shard->table, memory_order_relaxed));
+  atomic_store_explicit(&shard->table, nullptr, memory_order_relaxed);
+  atomic_store_explicit(&shard->entry_count, 0, memory_order_relaxed);
+}
+
+static bool shard_init(SentenceSetShard *shard, size_t bucket_count,
+                       bool fingerprint_only, bool owned) {
   if (!shard)
     return false;
   sentence_arena_init(&shard->arena, SENTENCE_ARENA_BLOCK_SIZE);
-  size_t size = round_up_pow2(bucket_count < MIN_BUCKET_COUNT ? MIN_BUCKET_COUNT
-                                                              : bucket_count);
-  size_t alloc_hashes = 0;
-  size_t alloc_lengths = 0;
-  size_t alloc_data = 0;
-  size_t alloc_ctrl = 0;
-  if (ckd_mul(&alloc_hashes, size, sizeof(*shard->hashes)))
-    return false;
-  if (ckd_mul(&alloc_lengths, size, sizeof(*shard->lengths)))
-    return false;
-  if (ckd_mul(&alloc_data, size, sizeof(*shard->data)))
-    return false;
-  if (ckd_mul(&alloc_ctrl, size, sizeof(*shard->ctrl)))
-    return false;
-
-  shard->hashes = (uint64_t *)calloc(1, alloc_hashes);
-  shard->lengths = (size_t *)calloc(1, alloc_lengths);
-  shard->data = (char8_t **)calloc(1, alloc_data);
-  shard->ctrl = (uint8_t *)calloc(1, alloc_ctrl);
-  if (!shard->hashes || !shard->lengths || !shard->data || !shard->ctrl) {
-    shard_destroy(shard);
-    return false;
-  }
-  memset(shard->ctrl, CTRL_EMPTY, alloc_ctrl);
-  shard->bucket_count = size;
-  shard->entry_count = 0;
-  shard->lock_init = mtx_init(&shard->lock, mtx_plain) == thrd_success;
-  if (!shard->lock_init) {
-    shard_destroy(shard);
-    return false;
-  }
-  return true;
+  shard->fingerprint_only = fingerprint_only;
+  shard->owned = owned;
+  atomic_init(&shard->entry_count, 0);
+  atomic_init(&shard->active, 0);
+  atomic_init(&shard->resizing, false);
+  SentenceTable *table = table_create(bucket_count, owned);
+  atomic_init(&shard->table, table);
+  return table != nullptr;
 }
 
 static void shard_clear(SentenceSetShard *shard) {
-  if (!shard || shard->bucket_count == 0)
+  SentenceTable *table =
+      shard ? atomic_load_explicit(&shard->table, memory_order_relaxed)
+            : nullptr;
+  if (!table)
     return;
-  memset(shard->ctrl, CTRL_EMPTY, shard->bucket_count * sizeof(uint8_t));
-  shard->entry_count = 0;
+  memset((void *)table->hashes, 0, table->bucket_count * sizeof(uint64_t));
+  memset((void *)table->payloads, 0, table->bucket_count * sizeof(uint64_t));
+  if (table->owners)
+    memset((void *)table->owners, 0, table->bucket_count * sizeof(uint64_t));
+  atomic_store_explicit(&shard->entry_count, 0, memory_order_relaxed);
   sentence_arena_reset(&shard->arena);
 }
 
-static bool rehash_insert(uint64_t hash, size_t len, char8_t *data,
-                          uint64_t *hashes, size_t *lengths, char8_t **items,
-                          uint8_t *ctrl, size_t bucket_count) {
-  size_t idx = hash & (bucket_count - 1);
-  uint8_t dist = 0;
-
-  while (true) {
-    uint8_t slot_ctrl = ctrl[idx];
-    if (slot_ctrl == CTRL_EMPTY) {
-      hashes[idx] = hash;
-      lengths[idx] = len;
-      items[idx] = data;
-      ctrl[idx] = dist;
-      return true;
-    }
-
-    if (hashes[idx] == hash && lengths[idx] == len &&
-        memcmp(items[idx], data, len) == 0) {
-      return true;
+// Announce an inserter; returns the table to probe, or nullptr when a resize
+// is in progress and the caller should retry.
+static SentenceTable *shard_enter(SentenceSetShard *shard) {
+  atomic_fetch_add(&shard->active, 1);
+  if (atomic_load(&shard->resizing)) {
+    atomic_fetch_sub(&shard->active, 1);
+    while (atomic_load_explicit(&shard->resizing, memory_order_acquire)) {
+      cpu_relax();
     }
+    return nullptr;
+  }
+  return atomic_load_explicit(&shard->table, memory_order_acquire);
+}
 
-    if (slot_ctrl < dist) {
-      uint64_t displaced_hash = hashes[idx];
-      size_t displaced_len = lengths[idx];
-      char8_t *displaced_data = items[idx];
-      uint8_t displaced_ctrl = slot_ctrl;
-
-      hashes[idx] = hash;
-      lengths[idx] = len;
-      items[idx] = data;
-      ctrl[idx] = dist;
-
-      hash = displaced_hash;
-      len = displaced_len;
-      data = displaced_data;
-      dist = displaced_ctrl + 1;
-      idx = (idx + 1) & (bucket_count - 1);
-      continue;
-    }
+static void shard_leave(SentenceSetShard *shard) {
+  atomic_fetch_sub_explicit(&shard->active, 1, memory_order_release);
+}
 
-    dist++;
-    idx = (idx + 1) & (bucket_count - 1);
-    if (dist == CTRL_EMPTY) {
-      return false;
+// Migrate the shard to a table with at least min_buckets slots. Only the
+// thread that wins the resizing flag migrates; it waits for in-flight
+// inserters to drain, so migration itself runs without atomics contention.
+static bool shard_grow(SentenceSetShard *shard, size_t min_buckets) {
+  bool expected = false;
+  if (!atomic_compare_exchange_strong(&shard->resizing, &expected, true)) {
+    while (atomic_load_explicit(&shard->resizing, memory_order_acquire)) {
+      cpu_relax();
     }
+    return true;
+  }
+  SentenceTable *current =
+      atomic_load_explicit(&shard->table, memory_order_acquire);
+  if (current->bucket_count >= min_buckets) {
+    atomic_store(&shard->resizing, false);
+    return true;
+  }
+  while (atomic_load(&shard->active) != 0) {
+    cpu_relax();
   }
-}
-
-static bool sentence_set_rehash_shard(SentenceSetShard *shard,
-                                      size_t new_bucket_count) {
-  if (!shard)
-    return false;
-  size_t size =
-      round_up_pow2(new_bucket_count < MIN_BUCKET_COUNT ? MIN_BUCKET_COUNT
-                                                        : new_bucket_count);
-  size_t alloc_hashes = 0;
-  size_t alloc_lengths = 0;
-  size_t alloc_data = 0;
-  size_t alloc_ctrl = 0;
-  if (ckd_mul(&alloc_hashes, size, sizeof(*shard->hashes)))
-    return false;
-  if (ckd_mul(&alloc_lengths, size, sizeof(*shard->lengths)))
-    return false;
-  if (ckd_mul(&alloc_data, size, sizeof(*shard->data)))
-    return false;
-  if (ckd_mul(&alloc_ctrl, size, sizeof(*shard->ctrl)))
-    return false;
 
-  auto new_hashes = (uint64_t *)calloc(1, alloc_hashes);
-  auto new_lengths = (size_t *)calloc(1, alloc_lengths);
-  auto new_data = (char8_t **)calloc(1, alloc_data);
-  auto new_ctrl = (uint8_t *)calloc(1, alloc_ctrl);
-  if (!new_hashes || !new_lengths || !new_data || !new_ctrl) {
-    free(new_hashes);
-    free(new_lengths);
-    free(new_data);
-    free(new_ctrl);
+  SentenceTable *next = table_create(min_buckets, shard->owned);
+  if (!next) {
+    atomic_store(&shard->resizing, false);
     return false;
   }
-  memset(new_ctrl, CTRL_EMPTY, alloc_ctrl);
-
-  for (size_t i = 0; i < shard->bucket_count; ++i) {
-    if (shard->ctrl[i] == CTRL_EMPTY)
+  size_t mask = next->bucket_count - 1;
+  for (size_t i = 0; i < current->bucket_count; ++i) {
+    uint64_t hash =
+        atomic_load_explicit(&current->hashes[i], memory_order_relaxed);
+    if (hash == EMPTY_HASH)
       continue;
-    if (!rehash_insert(shard->hashes[i], shard->lengths[i], shard->data[i],
-                       new_hashes, new_lengths, new_data, new_ctrl, size)) {
-      free(new_hashes);
-      free(new_lengths);
-      free(new_data);
-      free(new_ctrl);
-      return false;
+    uint64_t payload =
+        atomic_load_explicit(&current->payloads[i], memory_order_relaxed);
+    size_t idx = hash & mask;
+    while (atomic_load_explicit(&next->hashes[idx], memory_order_relaxed) !=
+           EMPTY_HASH) {
+      idx = (idx + 1) & mask;
+    }
+    atomic_store_explicit(&next->hashes[idx], hash, memory_order_relaxed);
+    atomic_store_explicit(&next->payloads[idx], payload, memory_order_relaxed);
+    if (next->owners) {
+      atomic_store_explicit(
+          &next->owners[idx],
+          atomic_load_explicit(&current->owners[i], memory_order_relaxed),
+          memory_order_relaxed);
     }
   }
 
-  free(shard->hashes);
-  free(shard->lengths);
-  free(shard->data);
-  free(shard->ctrl);
-
-  shard->hashes = new_hashes;
-  shard->lengths = new_lengths;
-  shard->data = new_data;
-  shard->ctrl = new_ctrl;
-  shard->bucket_count = size;
-  // entry_count unchanged.
+  atomic_store_explicit(&shard->table, next, memory_order_release);
+  table_destroy(current);
+  atomic_store(&shard->resizing, false);
   return true;
 }
 
-[[nodiscard]] static bool
-sentence_set_insert_internal(SentenceSetShard *shard, uint64_t hash,
-                             const char8_t *data, size_t len, bool data_owned,
-                             bool *inserted) {
-  if (!shard || !data || !inserted)
-    return false;
+static bool payload_matches(const SentenceSetShard *shard, uint64_t payload,
+                            uint64_t want_fingerprint, const char8_t *data,
+                            size_t len) {
+  if (shard->fingerprint_only)
+    return payload == want_fingerprint;
+  auto entry = (const SentenceEntry *)(uintptr_t)payload;
+  return entry->len == len && memcmp(entry->bytes, data, len) == 0;
+}
 
-  size_t idx = hash & (shard->bucket_count - 1);
-  uint8_t dist = 0;
-
-  uint64_t cand_hash = hash;
-  size_t cand_len = len;
-  const char8_t *cand_data = data;
-  bool cand_owned = data_owned;
-
-  while (true) {
-    uint8_t ctrl = shard->ctrl[idx];
-    if (ctrl == CTRL_EMPTY) {
-      char8_t *stored =
-          cand_owned ? (char8_t *)cand_data
-                     : sentence_set_copy_data(shard, cand_data, cand_len);
-      if (!stored)
+// Lower owners[idx] to order unless an earlier claim already holds it.
+static void owner_claim(_Atomic uint64_t *owner, uint64_t order) {
+  uint64_t current = atomic_load_explicit(owner, memory_order_relaxed);
+  while (order < current &&
+         !atomic_compare_exchange_weak_explicit(owner, &current, order,
+                                                memory_order_relaxed,
+                                                memory_order_relaxed)) {
+  }
+}
+
+// Insert-or-find on one shard. Slots are claimed with a CAS on the hash word
+// and published by a release store of the payload; concurrent finders that
+// meet a claimed-but-unpublished slot with their hash spin until it lands.
+// A new key's owner starts at order. With first_owner set, a found key's
+// owner is read into it; otherwise the call lowers it to order.
+[[nodiscard]] static bool shard_insert(SentenceSetShard *shard, uint64_t hash,
+                                       uint64_t fingerprint,
+                                       const char8_t *data, size_t len,
+                                       uint64_t order, bool *inserted,
+                                       uint64_t *first_owner) {
+  uint64_t key = slot_hash(hash);
+  uint64_t want_fp = slot_fingerprint(fingerprint);
+  SentenceEntry *spare = nullptr; // copy allocated for a lost claim race
+
+  for (;;) {
+    SentenceTable *table = shard_enter(shard);
+    if (!table)
+      continue;
+    size_t count =
+        atomic_load_explicit(&shard->entry_count, memory_order_relaxed);
+    // Read the table size before leaving: once we leave, a concurrent grower
+    // may free the table.
+    size_t bucket_count = table->bucket_count;
+    if (count + 1 > table_threshold(table)) {
+      shard_leave(shard);
+      size_t next_size = 0;
+      if (ckd_mul(&next_size, bucket_count, (size_t)2) ||
+          !shard_grow(shard, next_size))
         return false;
-      shard->hashes[idx] = cand_hash;
-      shard->lengths[idx] = cand_len;
-      shard->data[idx] = stored;
-      shard->ctrl[idx] = dist;
-      shard->entry_count++;
-      *inserted = true;
-      return true;
+      continue;
     }
 
-    if (shard->hashes[idx] == cand_hash && shard->lengths[idx] == cand_len &&
-        memcmp(shard->data[idx], cand_data, cand_len) == 0) {
-      *inserted = false;
-      return true;
+    size_t mask = bucket_count - 1;
+    size_t idx = key & mask;
+    for (size_t probes = 0; probes < bucket_count; ++probes) {
+      uint64_t slot =
+          atomic_load_explicit(&table->hashes[idx], memory_order_acquire);
+      if (slot == EMPTY_HASH) {
+        uint64_t payload = want_fp;
+        if (!shard->fingerprint_only) {
+          if (!spare)
+            spare = sentence_set_copy_entry(shard, data, len);
+          if (!spare) {
+            shard_leave(shard);
+            return false;
+          }
+          payload = (uint64_t)(uintptr_t)spare;
+        }
+        if (atomic_compare_exchange_strong(&table->hashes[idx], &slot, key)) {
+          if (table->owners) {
+            atomic_store_explicit(&table->owners[idx], order,
+                                  memory_order_relaxed);
+          }
+          atomic_store_explicit(&table->payloads[idx], payload,
+                                memory_order_release);
+          atomic_fetch_add_explicit(&shard->entry_count, 1,
+                                    memory_order_relaxed);
+          shard_leave(shard);
+          *inserted = true;
+          return true;
+        }
+        // Lost the claim; slot now holds another key, examine it below.
+      }
+      if (slot == key) {
+        uint64_t payload;
+        while ((payload = atomic_load_explicit(&table->payloads[idx],
+                                               memory_order_acquire)) ==
+               PENDING_PAYLOAD) {
+          cpu_relax();
+        }
+        if (payload_matches(shard, payload, want_fp, data, len)) {
+          // The owner was stored before the payload was released.
+          if (table->owners && first_owner) {
+            *first_owner = atomic_load_explicit(&table->owners[idx],
+                                                memory_order_relaxed);
+          } else if (table->owners) {
+            owner_claim(&table->owners[idx], order);
+          }
+          shard_leave(shard);
+          *inserted = false;
+          return true;
+        }
+      }
+      idx = (idx + 1) & mask;
     }
 
-    if (ctrl < dist) {
-      uint64_t displaced_hash = shard->hashes[idx];
-      size_t displaced_len = shard->lengths[idx];
-      char8_t *displaced_data = shard->data[idx];
-      uint8_t displaced_ctrl = ctrl;
-
-      char8_t *stored =
-          cand_owned ? (char8_t *)cand_data
-                     : sentence_set_copy_data(shard, cand_data, cand_len);
-      if (!stored)
-        return false;
-      shard->hashes[idx] = cand_hash;
-      shard->lengths[idx] = cand_len;
-      shard->data[idx] = stored;
-      shard->ctrl[idx] = dist;
-
-      cand_hash = displaced_hash;
-      cand_len = displaced_len;
-      cand_data = displaced_data;
-      cand_owned = true;
-      dist = displaced_ctrl + 1;
-      idx = (idx + 1) & (shard->bucket_count - 1);
-      continue;
-    }
+    // Table saturated by concurrent claims past the threshold check.
+    shard_leave(shard);
+    size_t next_size = 0;
+    if (ckd_mul(&next_size, bucket_count, (size_t)2) ||
+        !shard_grow(shard, next_size))
+      return false;
+  }
+}
 
-    dist++;
-    idx = (idx + 1) & (shard->bucket_count - 1);
-    if (dist == CTRL_EMPTY) {
-      size_t next_size = 0;
-      if (ckd_mul(&next_size, shard->bucket_count, (size_t)2))
-        return false;
-      if (!sentence_set_rehash_shard(shard, next_size))
-        return false;
-      return sentence_set_insert_internal(shard, hash, data, len, data_owned,
-                                          inserted);
+// Read the owner of an existing key on an ordered shard.
+static bool shard_owner(SentenceSetShard *shard, uint64_t hash,
+                        uint64_t fingerprint, const char8_t *data, size_t len,
+                        uint64_t *owner) {
+  uint64_t key = slot_hash(hash);
+  uint64_t want_fp = slot_fingerprint(fingerprint);
+  SentenceTable *table;
+  while (!(table = shard_enter(shard))) {
+  }
+  if (!table->owners) {
+    shard_leave(shard);
+    return false;
+  }
+  size_t mask = table->bucket_count - 1;
+  size_t idx = key & mask;
+  bool found = false;
+  for (size_t probes = 0; probes < table->bucket_count; ++probes) {
+    uint64_t slot =
+        atomic_load_explicit(&table->hashes[idx], memory_order_acquire);
+    if (slot == EMPTY_HASH)
+      break;
+    if (slot == key) {
+      uint64_t payload =
+          atomic_load_explicit(&table->payloads[idx], memory_order_acquire);
+      if (payload != PENDING_PAYLOAD &&
+          payload_matches(shard, payload, want_fp, data, len)) {
+        *owner =
+            atomic_load_explicit(&table->owners[idx], memory_order_relaxed);
+        found = true;
+        break;
+      }
     }
+    idx = (idx + 1) & mask;
   }
+  shard_leave(shard);
+  return found;
 }
 
-bool sentence_set_init(SentenceSet *set, size_t bucket_count) {
+static bool sentence_set_init_internal(SentenceSet *set, size_t bucket_count,
+                                       bool fingerprint_only, bool ordered,
+                                       bool tagged) {
   if (!set)
     return false;
   *set = (SentenceSet){0};
   size_t shards = choose_shard_count(bucket_count);
   set->shard_count = shards;
   set->shard_mask = shards - 1;
+  set->fingerprint_only = fingerprint_only;
+  set->ordered = ordered;
+  set->tagged = tagged;
 
-  set->shards = (SentenceSetShard *)calloc(shards, sizeof(SentenceSetShard));
+  size_t alloc_size = 0;
+  if (ckd_mul(&alloc_size, shards, sizeof(SentenceSetShard)))
+    return false;
+  set->shards = (SentenceSetShard *)aligned_alloc(alignof(SentenceSetShard),
+                                                  alloc_size);
   if (!set->shards)
     return false;
+  memset(set->shards, 0, alloc_size);
 
   size_t per_shard = bucket_count / shards;
   if (per_shard < MIN_BUCKET_COUNT)
@@ -405,8 +522,9 @@ bool sentence_set_init(SentenceSet *set, size_t bucket_count) {
   per_shard = round_up_pow2(per_shard);
 
   for (size_t i = 0; i < shards; ++i) {
-    if (!shard_init(&set->shards[i], per_shard)) {
-      for (size_t j = 0; j < i; ++j) {
+    if (!shard_init(&set->shards[i], per_shard, fingerprint_only,
+                    ordered || tagged)) {
+      for (size_t j = 0; j <= i; ++j) {
         shard_destroy(&set->shards[j]);
       }
       free(set->shards);
@@ -417,6 +535,26 @@ bool sentence_set_init(SentenceSet *set, size_t bucket_count) {
   return true;
 }
 
+bool sentence_set_init(SentenceSet *set, size_t bucket_count) {
+  return sentence_set_init_internal(set, bucket_count, false, false, false);
+}
+
+bool sentence_set_init_fingerprint(SentenceSet *set, size_t bucket_count) {
+  return sentence_set_init_internal(set, bucket_count, true, false, false);
+}
+
+bool sentence_set_init_ordered(SentenceSet *set, size_t bucket_count,
+                               bool fingerprint_only) {
+  return sentence_set_init_internal(set, bucket_count, fingerprint_only, true,
+                                    false);
+}
+
+bool sentence_set_init_tagged(SentenceSet *set, size_t bucket_count,
+                              bool fingerprint_only) {
+  return sentence_set_init_internal(set, bucket_count, fingerprint_only, false,
+                                    true);
+}
+
 void sentence_set_destroy(SentenceSet *set) {
   if (!set)
     return;
@@ -429,6 +567,9 @@ void sentence_set_destroy(SentenceSet *set) {
   set->shards = nullptr;
   set->shard_count = 0;
   set->shard_mask = 0;
+  set->fingerprint_only = false;
+  set->ordered = false;
+  set->tagged = false;
 }
 
 void sentence_set_clear(SentenceSet *set) {
@@ -439,6 +580,46 @@ void sentence_set_clear(SentenceSet *set) {
   }
 }
 
+size_t sentence_set_size(const SentenceSet *set) {
+  if (!set || !set->shards)
+    return 0;
+  size_t total = 0;
+  for (size_t i = 0; i < set->shard_count; ++i) {
+    total += atomic_load_explicit(&set->shards[i].entry_count,
+                                  memory_order_relaxed);
+  }
+  return total;
+}
+
+bool sentence_set_for_each(const SentenceSet *set, SentenceSetVisitor visit,
+                           void *ctx) {
+  if (!set || !set->shards || !visit)
+    return true;
+  for (size_t i = 0; i < set->shard_count; ++i) {
+    const SentenceSetShard *shard = &set->shards[i];
+    const SentenceTable *table =
+        atomic_load_explicit(&shard->table, memory_order_acquire);
+    for (size_t slot = 0; slot < table->bucket_count; ++slot) {
+      uint64_t hash =
+          atomic_load_explicit(&table->hashes[slot], memory_order_relaxed);
+      if (hash == EMPTY_HASH)
+        continue;
+      uint64_t payload =
+          atomic_load_explicit(&table->payloads[slot], memory_order_acquire);
+      bool keep_going = false;
+      if (shard->fingerprint_only) {
+        keep_going = visit(ctx, hash, payload, nullptr, 0);
+      } else {
+        auto entry = (const SentenceEntry *)(uintptr_t)payload;
+        keep_going = visit(ctx, hash, 0, entry->bytes, entry->len);
+      }
+      if (!keep_going)
+        return false;
+    }
+  }
+  return true;
+}
+
 void sentence_set_reserve_for_bytes(SentenceSet *set, size_t byte_len) {
   if (!set || !set->shards || set->shard_count == 0)
     return;
@@ -446,47 +627,30 @@ void sentence_set_reserve_for_bytes(SentenceSet *set, size_t byte_len) {
   if (expected < MIN_BUCKET_COUNT)
     expected = MIN_BUCKET_COUNT;
 
-  size_t total_entries = 0;
-  size_t total_buckets = 0;
-  for (size_t i = 0; i < set->shard_count; ++i) {
-    SentenceSetShard *shard = &set->shards[i];
-    if (shard->lock_init)
-      mtx_lock(&shard->lock);
-    total_entries += shard->entry_count;
-    total_buckets += shard->bucket_count;
-    if (shard->lock_init)
-      mtx_unlock(&shard->lock);
-  }
-
   size_t target = 0;
-  if (ckd_add(&target, total_entries, expected)) {
+  if (ckd_add(&target, sentence_set_size(set), expected)) {
     target = SIZE_MAX;
   }
-  size_t needed = 0;
+  size_t per_needed = target / set->shard_count;
   size_t scaled = 0;
-  if (ckd_mul(&scaled, target, (size_t)5)) {
-    needed = SIZE_MAX;
-  } else {
-    needed = scaled / 4;
-  }
-
-  if (needed <= total_buckets)
+  if (ckd_mul(&scaled, per_needed, LOAD_FACTOR_DEN)) {
     return;
-
-  size_t per_needed = needed / set->shard_count;
+  }
+  per_needed = scaled / LOAD_FACTOR_NUM;
   if (per_needed < MIN_BUCKET_COUNT)
     per_needed = MIN_BUCKET_COUNT;
   per_needed = round_up_pow2(per_needed);
 
   for (size_t i = 0; i < set->shard_count; ++i) {
     SentenceSetShard *shard = &set->shards[i];
-    if (shard->lock_init)
-      mtx_lock(&shard->lock);
-    if (per_needed > shard->bucket_count) {
-      (void)sentence_set_rehash_shard(shard, per_needed);
+    const SentenceTable *table = shard_enter(shard);
+    if (!table)
+      continue; // another thread is already growing this shard
+    size_t bucket_count = table->bucket_count;
+    shard_leave(shard);
+    if (per_needed > bucket_count) {
+      (void)shard_grow(shard, per_needed);
     }
-    if (shard->lock_init)
-      mtx_unlock(&shard->lock);
   }
 }
 
@@ -495,37 +659,102 @@ void sentence_set_reserve_for_bytes(SentenceSet *set, size_t byte_len) {
                                               bool *inserted) {
   if (!set || !data || !inserted)
     return false;
+  if (set->fingerprint_only)
+    return false;
   if (!set->shards || set->shard_count == 0) {
     if (!sentence_set_init(set, 1024))
       return false;
   }
 
-  size_t shard_idx = shard_index(set, hash);
-  SentenceSetShard *shard = &set->shards[shard_idx];
+  SentenceSetShard *shard = &set->shards[shard_index(set, hash)];
+  return shard_insert(shard, hash, 0, data, len, UNORDERED_CLAIM, inserted,
+                      nullptr);
+}
 
-  if (shard->lock_init)
-    mtx_lock(&shard->lock);
+[[nodiscard]] bool sentence_set_insert(SentenceSet *set, const char8_t *data,
+                                       size_t len, bool *inserted) {
+  if (set && set->fingerprint_only) {
+    return sentence_set_insert_fingerprint(set, unit_fingerprint(data, len),
+                                           inserted);
+  }
+  uint64_t hash = hash_unit(data, len);
+  return sentence_set_insert_hashed(set, hash, data, len, inserted);
+}
 
-  size_t threshold_num = shard->bucket_count * LOAD_FACTOR_NUM;
-  size_t threshold_den = LOAD_FACTOR_DEN;
-  size_t threshold = threshold_num / threshold_den;
-  if (threshold == 0)
-    threshold = 1;
-  if (shard->entry_count + 1 > threshold) {
-    size_t next_size = shard->bucket_count * 2;
-    (void)sentence_set_rehash_shard(shard, next_size);
+[[nodiscard]] bool sentence_set_insert_fingerprint(SentenceSet *set,
+                                                   Hash128 fingerprint,
+                                                   bool *inserted) {
+  if (!set || !inserted)
+    return false;
+  if (!set->shards || set->shard_count == 0) {
+    if (!sentence_set_init_fingerprint(set, 1024))
+      return false;
   }
+  if (!set->fingerprint_only)
+    return false;
 
-  bool ok =
-      sentence_set_insert_internal(shard, hash, data, len, false, inserted);
+  SentenceSetShard *shard = &set->shards[shard_index(set, fingerprint.hi)];
+  return shard_insert(shard, fingerprint.hi, fingerprint.lo, nullptr, 0,
+                      UNORDERED_CLAIM, inserted, nullptr);
+}
 
-  if (shard->lock_init)
-    mtx_unlock(&shard->lock);
-  return ok;
+[[nodiscard]] bool sentence_set_insert_hashed_tagged(
+    SentenceSet *set, uint64_t hash, const char8_t *data, size_t len,
+    uint64_t tag, bool *inserted, uint64_t *first_tag) {
+  if (!set || !data || !inserted || !first_tag || !set->shards ||
+      !set->tagged || set->fingerprint_only)
+    return false;
+  SentenceSetShard *shard = &set->shards[shard_index(set, hash)];
+  return shard_insert(shard, hash, 0, data, len, tag, inserted, first_tag);
 }
 
-[[nodiscard]] bool sentence_set_insert(SentenceSet *set, const char8_t *data,
-                                       size_t len, bool *inserted) {
-  uint64_t hash = hash_bytes_fnv1a(data, len);
-  return sentence_set_insert_hashed(set, hash, data, len, inserted);
+[[nodiscard]] bool sentence_set_insert_fingerprint_tagged(SentenceSet *set,
+                                                          Hash128 fingerprint,
+                                                          uint64_t tag,
+                                                          bool *inserted,
+                                                          uint64_t *first_tag) {
+  if (!set || !inserted || !first_tag || !set->shards || !set->tagged ||
+      !set->fingerprint_only)
+    return false;
+  SentenceSetShard *shard = &set->shards[shard_index(set, fingerprint.hi)];
+  return shard_insert(shard, fingerprint.hi, fingerprint.lo, nullptr, 0, tag,
+                      inserted, first_tag);
+}
+
+[[nodiscard]] bool sentence_set_claim_hashed(SentenceSet *set, uint64_t hash,
+                                             const char8_t *data, size_t len,
+                                             uint64_t order) {
+  if (!set || !data || !set->shards || !set->ordered || set->fingerprint_only)
+    return false;
+  bool inserted = false;
+  SentenceSetShard *shard = &set->shards[shard_index(set, hash)];
+  return shard_insert(shard, hash, 0, data, len, order, &inserted, nullptr);
+}
+
+[[nodiscard]] bool sentence_set_claim_fingerprint(SentenceSet *set,
+                                                  Hash128 fingerprint,
+                                                  uint64_t order) {
+  if (!set || !set->shards || !set->ordered || !set->fingerprint_only)
+    return false;
+  bool inserted = false;
+  SentenceSetShard *shard = &set->shards[shard_index(set, fingerprint.hi)];
+  return shard_insert(shard, fingerprint.hi, fingerprint.lo, nullptr, 0, order,
+                      &inserted, nullptr);
+}
+
+bool sentence_set_owner_hashed(SentenceSet *set, uint64_t hash,
+                               const char8_t *data, size_t len,
+                               uint64_t *owner) {
+  if (!set || !data || !owner || !set->shards || set->fingerprint_only)
+    return false;
+  SentenceSetShard *shard = &set->shards[shard_index(set, hash)];
+  return shard_owner(shard, hash, 0, data, len, owner);
+}
+
+bool sentence_set_owner_fingerprint(SentenceSet *set, Hash128 fingerprint,
+                                    uint64_t *owner) {
+  if (!set || !owner || !set->shards || !set->fingerprint_only)
+    return false;
+  SentenceSetShard *shard = &set->shards[shard_index(set, fingerprint.hi)];
+  return shard_owner(shard, fingerprint.hi, fingerprint.lo, nullptr, 0, owner);
 }
@@ -400,6 +400,26 @@ SentenceList split_text_to_sentences(const char8_t *restrict text, size_t len) {
   return list;
 }
 
+// The splitter always stops on such a terminator and splits there whatever
+// the sentence start was, so its state right after the whitespace is that
+// of a fresh call.
+size_t find_sentence_cut(const char8_t *text, size_t len, size_t from) {
+  for (size_t i = from; i + 1 < len; ++i) {
+    unsigned char c = (unsigned char)text[i];
+    if ((c != '.' && c != '!' && c != '?') ||
+        (unsigned char)text[i + 1] > 0x20)
+      continue;
+    // A dot after fewer than four letters may end an abbreviation.
+    if (c == '.' && (i < 4 || !is_ascii_alpha(text[i - 1]) ||
+                     !is_ascii_alpha(text[i - 2]) ||
+                     !is_ascii_alpha(text[i - 3]) ||
+                     !is_ascii_alpha(text[i - 4])))
+      continue;
+    return (size_t)(skip_white_space(text + i + 1, text + len) - text);
+  }
+  return len;
+}
+
 /**
  * @brief Frees all memory associated with the sentence list.
  */
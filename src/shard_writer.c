@@ -0,0 +1,279 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "ckdint_compat.h"
+#include "config.h"
+#include "io_utils.h"
+#include "shard_writer.h"
+
+static constexpr char SHARD_MAGIC[8] = {'C', 'D', 'D', 'X',
+                                        'S', 'H', 'R', 'D'};
+static constexpr uint32_t SHARD_VERSION = 1;
+
+static_assert(sizeof(ShardIndexHeader) % 8 == 0,
+              "index entries must stay 8-byte aligned");
+static_assert(sizeof(ShardIndexEntry) == 32, "ShardIndexEntry must be packed");
+
+struct ShardSlot {
+  FILE *fp;
+  char *path;     // of the open shard, for error messages
+  uint32_t shard; // index of the open shard
+  uint64_t offset;
+  ShardIndexEntry *entries; // name_offset points into names
+  size_t entry_count;
+  size_t entry_cap;
+  char *names;
+  size_t names_len;
+  size_t names_cap;
+};
+
+char *shard_path(const char *dir, uint32_t index) {
+  char name[64];
+  snprintf(name, sizeof(name), "%s%05u.bin", SHARD_FILE_PREFIX, index);
+  return join_path(dir, name);
+}
+
+bool shard_set_init(ShardSet *set, const char *dir, size_t shard_size) {
+  *set = (ShardSet){.shard_size = shard_size};
+  atomic_init(&set->next_shard, 0);
+  set->dir = dup_string(dir);
+  if (!set->dir)
+    return false;
+  if (mtx_init(&set->lock, mtx_plain) != thrd_success) {
+    free(set->dir);
+    set->dir = nullptr;
+    return false;
+  }
+  set->lock_init = true;
+  return true;
+}
+
+static bool close_shard(ShardSlot *slot) {
+  if (!slot->fp)
+    return true;
+  bool ok = fclose(slot->fp) == 0;
+  if (!ok)
+    fprintf(stderr, "Failed to close shard file: %s\n", slot->path);
+  slot->fp = nullptr;
+  free(slot->path);
+  slot->path = nullptr;
+  return ok;
+}
+
+static bool open_shard(ShardSet *set, ShardSlot *slot) {
+  if (!close_shard(slot))
+    return false;
+  uint32_t shard =
+      atomic_fetch_add_explicit(&set->next_shard, 1, memory_order_relaxed);
+  slot->path = shard_path(set->dir, shard);
+  slot->fp = slot->path ? fopen(slot->path, "wb") : nullptr;
+  if (!slot->fp) {
+    fprintf(stderr, "Failed to open shard file: %s\n",
+            slot->path ? slot->path : set->dir);
+    free(slot->path);
+    slot->path = nullptr;
+    return false;
+  }
+  slot->shard = shard;
+  slot->offset = 0;
+  return true;
+}
+
+ShardSlot *shard_set_acquire(ShardSet *set) {
+  mtx_lock(&set->lock);
+  ShardSlot *slot = nullptr;
+  if (set->idle_count > 0) {
+    slot = set->idle[--set->idle_count];
+    mtx_unlock(&set->lock);
+    return slot;
+  }
+  if (set->slot_count == set->slot_cap) {
+    size_t next_cap = set->slot_cap ? set->slot_cap * 2 : 16;
+    auto slots =
+        (ShardSlot **)realloc(set->slots, next_cap * sizeof(ShardSlot *));
+    if (slots)
+      set->slots = slots;
+    auto idle =
+        (ShardSlot **)realloc(set->idle, next_cap * sizeof(ShardSlot *));
+    if (idle)
+      set->idle = idle;
+    if (!slots || !idle) {
+      mtx_unlock(&set->lock);
+      fprintf(stderr, "Failed to allocate shard writer.\n");
+      return nullptr;
+    }
+    set->slot_cap = next_cap;
+  }
+  slot = (ShardSlot *)calloc(1, sizeof(ShardSlot));
+  if (slot)
+    set->slots[set->slot_count++] = slot;
+  mtx_unlock(&set->lock);
+  if (!slot)
+    fprintf(stderr, "Failed to allocate shard writer.\n");
+  return slot;
+}
+
+void shard_set_release(ShardSet *set, ShardSlot *slot) {
+  if (!slot)
+    return;
+  mtx_lock(&set->lock);
+  // idle has room for every slot ever created.
+  set->idle[set->idle_count++] = slot;
+  mtx_unlock(&set->lock);
+}
+
+static bool grow(void **items, size_t *cap, size_t needed, size_t item_size) {
+  if (*cap >= needed)
+    return true;
+  size_t next_cap = *cap ? *cap : 1'024;
+  while (next_cap < needed) {
+    if (ckd_mul(&next_cap, next_cap, (size_t)2))
+      return false;
+  }
+  size_t bytes = 0;
+  if (ckd_mul(&bytes, next_cap, item_size))
+    return false;
+  void *next = realloc(*items, bytes);
+  if (!next)
+    return false;
+  *items = next;
+  *cap = next_cap;
+  return true;
+}
+
+bool shard_slot_append(ShardSet *set, ShardSlot *slot, const char *name,
+                       const char8_t *data, size_t len) {
+  size_t name_len = strlen(name);
+  if (name_len > UINT32_MAX ||
+      !grow((void **)&slot->entries, &slot->entry_cap, slot->entry_count + 1,
+            sizeof(ShardIndexEntry)) ||
+      !grow((void **)&slot->names, &slot->names_cap,
+            slot->names_len + name_len, 1)) {
+    fprintf(stderr, "Failed to grow shard index for: %s\n", name);
+    return false;
+  }
+  // Roll over before a document that would overflow a non-empty shard; a
+  // document larger than shard_size gets a shard to itself.
+  if (!slot->fp ||
+      (slot->offset > 0 && slot->offset + len > set->shard_size)) {
+    if (!open_shard(set, slot))
+      return false;
+  }
+  if (len > 0 && fwrite(data, 1, len, slot->fp) != len) {
+    fprintf(stderr, "Failed to write shard file: %s\n", slot->path);
+    // The shard's tail is now unknown; later documents go to a fresh one.
+    close_shard(slot);
+    return false;
+  }
+  memcpy(slot->names + slot->names_len, name, name_len);
+  slot->entries[slot->entry_count++] =
+      (ShardIndexEntry){.name_offset = slot->names_len,
+                        .offset = slot->offset,
+                        .len = len,
+                        .name_len = (uint32_t)name_len,
+                        .shard = slot->shard};
+  slot->names_len += name_len;
+  slot->offset += len;
+  return true;
+}
+
+// Index entry with its name resolved, for sorting across slots.
+typedef struct {
+  const char *name;
+  const ShardIndexEntry *entry;
+} NamedEntry;
+
+static int compare_named(const void *a, const void *b) {
+  const NamedEntry *na = (const NamedEntry *)a;
+  const NamedEntry *nb = (const NamedEntry *)b;
+  size_t la = na->entry->name_len;
+  size_t lb = nb->entry->name_len;
+  int cmp = memcmp(na->name, nb->name, la < lb ? la : lb);
+  if (cmp != 0)
+    return cmp;
+  return la < lb ? -1 : la > lb;
+}
+
+bool shard_set_finish(ShardSet *set, const char *index_path,
+                      size_t *shard_count, size_t *entry_count) {
+  bool ok = true;
+  size_t total = 0;
+  for (size_t i = 0; i < set->slot_count; ++i) {
+    ok &= close_shard(set->slots[i]);
+    total += set->slots[i]->entry_count;
+  }
+  if (!ok)
+    return false;
+  auto named = (NamedEntry *)malloc((total ? total : 1) * sizeof(NamedEntry));
+  if (!named) {
+    fprintf(stderr, "Failed to allocate shard index.\n");
+    return false;
+  }
+  size_t at = 0;
+  for (size_t i = 0; i < set->slot_count; ++i) {
+    const ShardSlot *slot = set->slots[i];
+    for (size_t j = 0; j < slot->entry_count; ++j) {
+      named[at++] =
+          (NamedEntry){.name = slot->names + slot->entries[j].name_offset,
+                       .entry = &slot->entries[j]};
+    }
+  }
+  qsort(named, total, sizeof(NamedEntry), compare_named);
+
+  FILE *fp = fopen(index_path, "wb");
+  if (!fp) {
+    fprintf(stderr, "Failed to open shard index: %s\n", index_path);
+    free(named);
+    return false;
+  }
+  uint64_t names_bytes = 0;
+  for (size_t i = 0; i < total; ++i) {
+    names_bytes += named[i].entry->name_len;
+  }
+  ShardIndexHeader header = {
+      .version = SHARD_VERSION,
+      .header_size = sizeof(ShardIndexHeader),
+      .shard_count = atomic_load_explicit(&set->next_shard,
+                                          memory_order_relaxed),
+      .entry_count = total,
+      .names_bytes = names_bytes};
+  memcpy(header.magic, SHARD_MAGIC, sizeof(SHARD_MAGIC));
+  ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+  uint64_t name_offset = 0;
+  for (size_t i = 0; ok && i < total; ++i) {
+    ShardIndexEntry entry = *named[i].entry;
+    entry.name_offset = name_offset;
+    name_offset += entry.name_len;
+    ok = fwrite(&entry, sizeof(entry), 1, fp) == 1;
+  }
+  for (size_t i = 0; ok && i < total; ++i) {
+    size_t len = named[i].entry->name_len;
+    ok = fwrite(named[i].name, 1, len, fp) == len;
+  }
+  if (fclose(fp) != 0)
+    ok = false;
+  if (!ok)
+    fprintf(stderr, "Failed to write shard index: %s\n", index_path);
+  free(named);
+  *shard_count = header.shard_count;
+  *entry_count = total;
+  return ok;
+}
+
+void shard_set_destroy(ShardSet *set) {
+  if (!set)
+    return;
+  for (size_t i = 0; i < set->slot_count; ++i) {
+    ShardSlot *slot = set->slots[i];
+    close_shard(slot);
+    free(slot->entries);
+    free(slot->names);
+    free(slot);
+  }
+  free(set->slots);
+  free(set->idle);
+  free(set->dir);
+  if (set->lock_init)
+    mtx_destroy(&set->lock);
+  *set = (ShardSet){0};
+}
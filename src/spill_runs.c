@@ -0,0 +1,325 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ckdint_compat.h"
+#include "config.h"
+#include "spill_runs.h"
+
+typedef struct {
+  FILE *fp;
+  SpillRecord *buffer;
+  size_t count;
+  size_t pos;
+  bool done;
+} RunReader;
+
+struct SpillMerger {
+  SpillOrder order;
+  RunReader *readers;
+  size_t reader_count;
+  size_t *heap; // reader indices, min-heap on the current record
+  size_t heap_size;
+};
+
+static int compare_key(const void *a, const void *b) {
+  const SpillRecord *x = a;
+  const SpillRecord *y = b;
+  if (x->hi != y->hi)
+    return x->hi < y->hi ? -1 : 1;
+  if (x->lo != y->lo)
+    return x->lo < y->lo ? -1 : 1;
+  if (x->file != y->file)
+    return x->file < y->file ? -1 : 1;
+  if (x->span != y->span)
+    return x->span < y->span ? -1 : 1;
+  return 0;
+}
+
+static int compare_position(const void *a, const void *b) {
+  const SpillRecord *x = a;
+  const SpillRecord *y = b;
+  if (x->file != y->file)
+    return x->file < y->file ? -1 : 1;
+  if (x->span != y->span)
+    return x->span < y->span ? -1 : 1;
+  return 0;
+}
+
+static int compare_records(SpillOrder order, const SpillRecord *a,
+                           const SpillRecord *b) {
+  return order == SPILL_ORDER_KEY ? compare_key(a, b)
+                                  : compare_position(a, b);
+}
+
+static char *run_path(const SpillStore *store, size_t id) {
+  int len =
+      snprintf(nullptr, 0, "%s/%s-%zu.run", store->dir, store->prefix, id);
+  if (len < 0)
+    return nullptr;
+  auto path = (char *)malloc((size_t)len + 1);
+  if (path)
+    snprintf(path, (size_t)len + 1, "%s/%s-%zu.run", store->dir,
+             store->prefix, id);
+  return path;
+}
+
+static char *copy_string(const char *text) {
+  size_t len = strlen(text) + 1;
+  auto out = (char *)malloc(len);
+  if (out)
+    memcpy(out, text, len);
+  return out;
+}
+
+bool spill_store_init(SpillStore *store, const char *dir, const char *prefix,
+                      SpillOrder order) {
+  if (!store || !dir || !prefix)
+    return false;
+  *store = (SpillStore){.order = order};
+  atomic_init(&store->next_id, 0);
+  store->dir = copy_string(dir);
+  store->prefix = copy_string(prefix);
+  if (!store->dir || !store->prefix) {
+    spill_store_destroy(store);
+    return false;
+  }
+  return true;
+}
+
+static bool store_add_run(SpillStore *store, size_t id) {
+  if (store->run_count == store->run_cap) {
+    size_t next_cap = store->run_cap ? store->run_cap * 2 : 16;
+    size_t alloc_size = 0;
+    if (ckd_mul(&alloc_size, next_cap, sizeof(size_t)))
+      return false;
+    auto next = (size_t *)realloc(store->run_ids, alloc_size);
+    if (!next)
+      return false;
+    store->run_ids = next;
+    store->run_cap = next_cap;
+  }
+  store->run_ids[store->run_count++] = id;
+  return true;
+}
+
+static void remove_run(const SpillStore *store, size_t id) {
+  char *path = run_path(store, id);
+  if (path) {
+    remove(path);
+    free(path);
+  }
+}
+
+// Open a new run file for writing; *id receives its id.
+static FILE *create_run(SpillStore *store, size_t *id) {
+  *id = atomic_fetch_add_explicit(&store->next_id, 1, memory_order_relaxed);
+  char *path = run_path(store, *id);
+  if (!path)
+    return nullptr;
+  FILE *fp = fopen(path, "wb");
+  if (!fp)
+    fprintf(stderr, "Failed to create spill run: %s\n", path);
+  free(path);
+  return fp;
+}
+
+void spill_records_sort(SpillRecord *records, size_t count,
+                        SpillOrder order) {
+  if (count > 1)
+    qsort(records, count, sizeof(SpillRecord),
+          order == SPILL_ORDER_KEY ? compare_key : compare_position);
+}
+
+bool spill_store_write_run(SpillStore *store, SpillRecord *records,
+                           size_t count) {
+  if (!store || (!records && count > 0))
+    return false;
+  if (count == 0)
+    return true;
+  spill_records_sort(records, count, store->order);
+
+  size_t id = 0;
+  FILE *fp = create_run(store, &id);
+  if (!fp)
+    return false;
+  bool ok = fwrite(records, sizeof(SpillRecord), count, fp) == count;
+  ok = fclose(fp) == 0 && ok;
+  if (!ok || !store_add_run(store, id)) {
+    fprintf(stderr, "Failed to write spill run %zu.\n", id);
+    remove_run(store, id);
+    return false;
+  }
+  store->bytes_written += count * sizeof(SpillRecord);
+  return true;
+}
+
+void spill_store_destroy(SpillStore *store) {
+  if (!store)
+    return;
+  if (store->dir && store->prefix) {
+    for (size_t i = 0; i < store->run_count; ++i) {
+      remove_run(store, store->run_ids[i]);
+    }
+  }
+  free(store->run_ids);
+  free(store->dir);
+  free(store->prefix);
+  *store = (SpillStore){0};
+}
+
+static bool reader_fill(RunReader *reader) {
+  reader->count = fread(reader->buffer, sizeof(SpillRecord),
+                        SPILL_READ_RECORDS, reader->fp);
+  reader->pos = 0;
+  if (reader->count == 0) {
+    reader->done = true;
+    return !ferror(reader->fp);
+  }
+  return true;
+}
+
+static const SpillRecord *reader_peek(const RunReader *reader) {
+  return &reader->buffer[reader->pos];
+}
+
+static bool heap_less(const SpillMerger *merger, size_t a, size_t b) {
+  return compare_records(merger->order,
+                         reader_peek(&merger->readers[merger->heap[a]]),
+                         reader_peek(&merger->readers[merger->heap[b]])) < 0;
+}
+
+static void heap_sift_down(SpillMerger *merger, size_t idx) {
+  for (;;) {
+    size_t smallest = idx;
+    size_t left = 2 * idx + 1;
+    size_t right = left + 1;
+    if (left < merger->heap_size && heap_less(merger, left, smallest))
+      smallest = left;
+    if (right < merger->heap_size && heap_less(merger, right, smallest))
+      smallest = right;
+    if (smallest == idx)
+      return;
+    size_t tmp = merger->heap[idx];
+    merger->heap[idx] = merger->heap[smallest];
+    merger->heap[smallest] = tmp;
+    idx = smallest;
+  }
+}
+
+void spill_merge_close(SpillMerger *merger) {
+  if (!merger)
+    return;
+  for (size_t i = 0; i < merger->reader_count; ++i) {
+    if (merger->readers[i].fp)
+      fclose(merger->readers[i].fp);
+    free(merger->readers[i].buffer);
+  }
+  free(merger->readers);
+  free(merger->heap);
+  free(merger);
+}
+
+static SpillMerger *merge_open_ids(const SpillStore *store, const size_t *ids,
+                                   size_t count) {
+  auto merger = (SpillMerger *)calloc(1, sizeof(SpillMerger));
+  if (!merger)
+    return nullptr;
+  merger->order = store->order;
+  merger->readers = (RunReader *)calloc(count ? count : 1, sizeof(RunReader));
+  merger->heap = (size_t *)calloc(count ? count : 1, sizeof(size_t));
+  if (!merger->readers || !merger->heap) {
+    spill_merge_close(merger);
+    return nullptr;
+  }
+  merger->reader_count = count;
+  for (size_t i = 0; i < count; ++i) {
+    RunReader *reader = &merger->readers[i];
+    char *path = run_path(store, ids[i]);
+    reader->fp = path ? fopen(path, "rb") : nullptr;
+    reader->buffer =
+        (SpillRecord *)malloc(SPILL_READ_RECORDS * sizeof(SpillRecord));
+    if (!reader->fp || !reader->buffer || !reader_fill(reader)) {
+      fprintf(stderr, "Failed to open spill run: %s\n",
+              path ? path : "(unknown)");
+      free(path);
+      spill_merge_close(merger);
+      return nullptr;
+    }
+    free(path);
+    if (!reader->done)
+      merger->heap[merger->heap_size++] = i;
+  }
+  for (size_t i = merger->heap_size; i-- > 0;) {
+    heap_sift_down(merger, i);
+  }
+  return merger;
+}
+
+bool spill_merge_next(SpillMerger *merger, SpillRecord *out, bool *has) {
+  *has = false;
+  if (merger->heap_size == 0)
+    return true;
+  RunReader *reader = &merger->readers[merger->heap[0]];
+  *out = *reader_peek(reader);
+  *has = true;
+  if (++reader->pos == reader->count && !reader_fill(reader))
+    return false;
+  if (reader->done) {
+    merger->heap[0] = merger->heap[--merger->heap_size];
+  }
+  heap_sift_down(merger, 0);
+  return true;
+}
+
+// Merge the first `count` runs into one new run appended to the store.
+static bool merge_round(SpillStore *store, size_t count) {
+  SpillMerger *merger = merge_open_ids(store, store->run_ids, count);
+  if (!merger)
+    return false;
+  size_t id = 0;
+  FILE *fp = create_run(store, &id);
+  bool ok = fp != nullptr;
+  SpillRecord *out = ok ? (SpillRecord *)malloc(SPILL_READ_RECORDS *
+                                                sizeof(SpillRecord))
+                        : nullptr;
+  ok = ok && out;
+  size_t pending = 0;
+  for (bool has = true; ok && has;) {
+    ok = spill_merge_next(merger, &out[pending], &has);
+    if (has)
+      pending++;
+    if (ok && (pending == SPILL_READ_RECORDS || (!has && pending > 0))) {
+      ok = fwrite(out, sizeof(SpillRecord), pending, fp) == pending;
+      pending = 0;
+    }
+  }
+  spill_merge_close(merger);
+  free(out);
+  if (fp)
+    ok = fclose(fp) == 0 && ok;
+  if (!ok) {
+    fprintf(stderr, "Failed to merge spill runs.\n");
+    if (fp)
+      remove_run(store, id);
+    return false;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    remove_run(store, store->run_ids[i]);
+  }
+  memmove(store->run_ids, store->run_ids + count,
+          (store->run_count - count) * sizeof(size_t));
+  store->run_count -= count;
+  return store_add_run(store, id);
+}
+
+SpillMerger *spill_merge_open(SpillStore *store) {
+  if (!store)
+    return nullptr;
+  while (store->run_count > SPILL_MERGE_FANIN) {
+    if (!merge_round(store, SPILL_MERGE_FANIN))
+      return nullptr;
+  }
+  return merge_open_ids(store, store->run_ids, store->run_count);
+}
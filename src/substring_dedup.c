@@ -0,0 +1,265 @@
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "config.h"
+#include "substring_dedup.h"
+
+static constexpr size_t SPAN_BINS = (size_t)1 << SUBSTRING_BIN_BITS;
+static constexpr uint64_t M31 = 0x7FFFFFFFULL; // 2^31 - 1
+static constexpr uint64_t B1 = 0x100000001B3ULL;
+static constexpr uint64_t B2 = 1'000'003;
+static constexpr uint64_t B3 = 911'382'323;
+
+static inline uint64_t mix64(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33;
+  x *= 0xC4CEB9FE1A85EC53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+static inline uint64_t mod_m31(uint64_t x) {
+  x = (x & M31) + (x >> 31);
+  x = (x & M31) + (x >> 31);
+  return x >= M31 ? x - M31 : x;
+}
+
+// Pack the two mod-(2^31-1) hashes; together with the wrapping h1 this
+// gives ~126 bits, and the prime moduli are immune to Thue-Morse inputs.
+static inline uint64_t pack_h2(uint64_t a, uint64_t b) { return a << 31 | b; }
+
+static inline size_t window_bin(uint64_t h1, uint64_t h2) {
+  return (size_t)(mix64(h1 ^ mix64(h2)) >> (64 - SUBSTRING_BIN_BITS));
+}
+
+void span_hasher_init(SpanHasher *hasher, size_t min_span) {
+  *hasher = (SpanHasher){.min_span = min_span, .drop1 = 1, .drop2 = 1,
+                         .drop3 = 1};
+  for (size_t i = 1; i < min_span; ++i) {
+    hasher->drop1 *= B1;
+    hasher->drop2 = mod_m31(hasher->drop2 * B2);
+    hasher->drop3 = mod_m31(hasher->drop3 * B3);
+  }
+}
+
+size_t span_hash_windows(const SpanHasher *hasher, const char8_t *text,
+                         size_t len, uint64_t base_pos, uint64_t *histogram,
+                         size_t bin_lo, size_t bin_hi, SpanWindow *out) {
+  size_t span = hasher->min_span;
+  if (span == 0 || len < span)
+    return 0;
+  uint64_t h1 = 0;
+  uint64_t ha = 0;
+  uint64_t hb = 0;
+  for (size_t i = 0; i < span; ++i) {
+    h1 = h1 * B1 + text[i];
+    ha = mod_m31(ha * B2 + text[i]);
+    hb = mod_m31(hb * B3 + text[i]);
+  }
+  size_t written = 0;
+  for (size_t start = 0;; ++start) {
+    uint64_t h2 = pack_h2(ha, hb);
+    size_t bin = window_bin(h1, h2);
+    if (histogram)
+      histogram[bin]++;
+    if (out && bin >= bin_lo && bin < bin_hi) {
+      out[written++] =
+          (SpanWindow){.h1 = h1, .h2 = h2, .pos = base_pos + start};
+    }
+    if (start + span >= len)
+      break;
+    // Slide: drop text[start], append text[start + span].
+    uint64_t out_byte = text[start];
+    uint64_t in_byte = text[start + span];
+    h1 = (h1 - out_byte * hasher->drop1) * B1 + in_byte;
+    ha = mod_m31((ha + M31 - mod_m31(out_byte * hasher->drop2)) * B2 +
+                 in_byte);
+    hb = mod_m31((hb + M31 - mod_m31(out_byte * hasher->drop3)) * B3 +
+                 in_byte);
+  }
+  return written;
+}
+
+size_t span_plan_passes(const uint64_t *histogram, size_t max_windows,
+                        size_t *bounds) {
+  size_t passes = 0;
+  bounds[0] = 0;
+  uint64_t filled = 0;
+  for (size_t bin = 0; bin < SPAN_BINS; ++bin) {
+    if (filled > 0 && filled + histogram[bin] > max_windows) {
+      bounds[++passes] = bin;
+      filled = 0;
+    }
+    filled += histogram[bin];
+  }
+  bounds[++passes] = SPAN_BINS;
+  return passes;
+}
+
+bool span_pass_init(SpanPass *pass, const uint64_t *histogram, size_t bin_lo,
+                    size_t bin_hi) {
+  *pass = (SpanPass){.bin_lo = bin_lo, .bin_hi = bin_hi};
+  size_t bins = bin_hi - bin_lo;
+  pass->bin_offsets = (size_t *)calloc(bins + 1, sizeof(size_t));
+  pass->bin_cursors = (atomic_size_t *)calloc(bins, sizeof(atomic_size_t));
+  if (!pass->bin_offsets || !pass->bin_cursors) {
+    span_pass_destroy(pass);
+    return false;
+  }
+  for (size_t i = 0; i < bins; ++i) {
+    pass->bin_offsets[i + 1] =
+        pass->bin_offsets[i] + (size_t)histogram[bin_lo + i];
+    atomic_init(&pass->bin_cursors[i], pass->bin_offsets[i]);
+  }
+  pass->count = pass->bin_offsets[bins];
+  pass->windows = (SpanWindow *)malloc(
+      (pass->count ? pass->count : 1) * sizeof(SpanWindow));
+  if (!pass->windows) {
+    span_pass_destroy(pass);
+    return false;
+  }
+  return true;
+}
+
+// Reserve run_len slots of one bin; fails if the bin would overflow.
+static bool reserve_run(SpanPass *pass, size_t bin, size_t run_len,
+                        size_t *slot) {
+  *slot = atomic_fetch_add_explicit(&pass->bin_cursors[bin], run_len,
+                                    memory_order_relaxed);
+  return *slot + run_len <= pass->bin_offsets[bin + 1];
+}
+
+bool span_pass_add(SpanPass *pass, const SpanWindow *windows, size_t count,
+                   SpanWindow *scratch) {
+  if (count == 0)
+    return true;
+  // Counting-sort the chunk by bin so each bin takes one reservation.
+  size_t bins = pass->bin_hi - pass->bin_lo;
+  auto starts = (size_t *)calloc(bins + 1, sizeof(size_t));
+  if (!starts) {
+    for (size_t i = 0; i < count; ++i) {
+      size_t bin = window_bin(windows[i].h1, windows[i].h2) - pass->bin_lo;
+      size_t slot = 0;
+      if (!reserve_run(pass, bin, 1, &slot))
+        return false;
+      pass->windows[slot] = windows[i];
+    }
+    return true;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    starts[window_bin(windows[i].h1, windows[i].h2) - pass->bin_lo + 1]++;
+  }
+  for (size_t bin = 0; bin < bins; ++bin) {
+    starts[bin + 1] += starts[bin];
+  }
+  for (size_t i = 0; i < count; ++i) {
+    size_t bin = window_bin(windows[i].h1, windows[i].h2) - pass->bin_lo;
+    scratch[starts[bin]++] = windows[i];
+  }
+  // starts[bin] now holds the end of each bin's run.
+  bool ok = true;
+  size_t run_start = 0;
+  for (size_t bin = 0; ok && bin < bins; ++bin) {
+    size_t run_len = starts[bin] - run_start;
+    size_t slot = 0;
+    if (run_len > 0 && (ok = reserve_run(pass, bin, run_len, &slot))) {
+      memcpy(pass->windows + slot, scratch + run_start,
+             run_len * sizeof(SpanWindow));
+    }
+    run_start = starts[bin];
+  }
+  free(starts);
+  return ok;
+}
+
+bool span_pass_filled(const SpanPass *pass) {
+  for (size_t bin = 0; bin < pass->bin_hi - pass->bin_lo; ++bin) {
+    if (atomic_load_explicit(&pass->bin_cursors[bin], memory_order_relaxed) !=
+        pass->bin_offsets[bin + 1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static int compare_windows(const void *a, const void *b) {
+  const SpanWindow *wa = (const SpanWindow *)a;
+  const SpanWindow *wb = (const SpanWindow *)b;
+  if (wa->h1 != wb->h1)
+    return wa->h1 < wb->h1 ? -1 : 1;
+  if (wa->h2 != wb->h2)
+    return wa->h2 < wb->h2 ? -1 : 1;
+  if (wa->pos != wb->pos)
+    return wa->pos < wb->pos ? -1 : 1;
+  return 0;
+}
+
+typedef struct {
+  SpanPass *pass;
+  _Atomic uint64_t *starts;
+  atomic_size_t next_bin;
+  atomic_size_t repeats;
+} MarkContext;
+
+static int mark_worker(void *arg) {
+  auto ctx = (MarkContext *)arg;
+  SpanPass *pass = ctx->pass;
+  size_t bins = pass->bin_hi - pass->bin_lo;
+  size_t repeats = 0;
+  for (;;) {
+    size_t bin =
+        atomic_fetch_add_explicit(&ctx->next_bin, 1, memory_order_relaxed);
+    if (bin >= bins)
+      break;
+    SpanWindow *begin = pass->windows + pass->bin_offsets[bin];
+    size_t count = pass->bin_offsets[bin + 1] - pass->bin_offsets[bin];
+    if (count < 2)
+      continue;
+    qsort(begin, count, sizeof(SpanWindow), compare_windows);
+    // Within a run of equal hashes the first window is the earliest
+    // occurrence; every later one repeats it.
+    for (size_t i = 1; i < count; ++i) {
+      if (begin[i].h1 != begin[i - 1].h1 || begin[i].h2 != begin[i - 1].h2)
+        continue;
+      uint64_t pos = begin[i].pos;
+      atomic_fetch_or_explicit(&ctx->starts[pos / 64], 1ULL << (pos % 64),
+                               memory_order_relaxed);
+      repeats++;
+    }
+  }
+  atomic_fetch_add_explicit(&ctx->repeats, repeats, memory_order_relaxed);
+  return 0;
+}
+
+size_t span_pass_mark(SpanPass *pass, _Atomic uint64_t *starts,
+                      size_t thread_count) {
+  MarkContext ctx = {.pass = pass, .starts = starts};
+  atomic_init(&ctx.next_bin, 0);
+  atomic_init(&ctx.repeats, 0);
+  if (thread_count == 0)
+    thread_count = 1;
+  auto threads = (thrd_t *)calloc(thread_count, sizeof(thrd_t));
+  size_t launched = 0;
+  for (; threads && launched < thread_count; ++launched) {
+    if (thrd_create(&threads[launched], mark_worker, &ctx) != thrd_success)
+      break;
+  }
+  if (launched == 0)
+    mark_worker(&ctx);
+  for (size_t i = 0; i < launched; ++i) {
+    thrd_join(threads[i], nullptr);
+  }
+  free(threads);
+  return atomic_load_explicit(&ctx.repeats, memory_order_relaxed);
+}
+
+void span_pass_destroy(SpanPass *pass) {
+  if (!pass)
+    return;
+  free(pass->windows);
+  free(pass->bin_offsets);
+  free((void *)pass->bin_cursors);
+  *pass = (SpanPass){0};
+}
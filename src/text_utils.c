@@ -1,23 +1,41 @@
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TEXT_UTILS_X86 1
+#include <immintrin.h>
+#endif
+
+#include <stdalign.h>
+#include <stdio.h>
 #include <string.h>
+#include <threads.h>
 
+#include "ckdint_compat.h"
+#include "hash_utils.h"
 #include "text_utils.h"
+#include "unicode_tables.h"
 
 static inline bool is_ascii_space(unsigned char c) { return c <= 0x20; }
 
-size_t normalize_sentence(const char8_t *data, size_t len, char8_t *out,
-                          size_t out_cap) {
-  size_t start = 0;
-  while (start < len && is_ascii_space((unsigned char)data[start])) {
-    start++;
+// Narrow [*start, *end) to data without its leading and trailing whitespace.
+static void trim_bounds(const char8_t *data, size_t len, size_t *start,
+                        size_t *end) {
+  size_t first = 0;
+  while (first < len && is_ascii_space((unsigned char)data[first])) {
+    first++;
   }
-  size_t end = len;
-  while (end > start && is_ascii_space((unsigned char)data[end - 1])) {
-    end--;
+  size_t last = len;
+  while (last > first && is_ascii_space((unsigned char)data[last - 1])) {
+    last--;
   }
+  *start = first;
+  *end = last;
+}
 
-  size_t out_len = 0;
-  bool in_space = false;
-  for (size_t i = start; i < end; ++i) {
+// Collapse data[i, end) into out after its first out_len bytes; in_space
+// tells whether data[i - 1] was whitespace.
+static size_t collapse_tail(const char8_t *data, size_t i, size_t end,
+                            char8_t *out, size_t out_len, size_t out_cap,
+                            bool in_space) {
+  for (; i < end; ++i) {
     if (is_ascii_space((unsigned char)data[i])) {
       if (!in_space) {
         if (out_len < out_cap)
@@ -33,6 +51,969 @@ size_t normalize_sentence(const char8_t *data, size_t len, char8_t *out,
   return out_len;
 }
 
+static size_t normalize_scalar(const char8_t *data, size_t len, char8_t *out,
+                               size_t out_cap) {
+  size_t start = 0;
+  size_t end = 0;
+  trim_bounds(data, len, &start, &end);
+  return collapse_tail(data, start, end, out, 0, out_cap, false);
+}
+
+static size_t normalize_hash_scalar(const char8_t *data, size_t len,
+                                    char8_t *out, size_t out_cap,
+                                    Hash128 *hash) {
+  size_t out_len = normalize_scalar(data, len, out, out_cap);
+  *hash = unit_fingerprint(out, out_len);
+  return out_len;
+}
+
+static uint32_t normalize_flags; // NormalizeFlags of normalize_select
+
+static constexpr size_t UNICODE_SEGMENT_MAX = 32;
+static constexpr uint32_t HANGUL_S_BASE = 0xAC00;
+static constexpr uint32_t HANGUL_L_BASE = 0x1100;
+static constexpr uint32_t HANGUL_V_BASE = 0x1161;
+static constexpr uint32_t HANGUL_T_BASE = 0x11A7;
+static constexpr uint32_t HANGUL_L_COUNT = 19;
+static constexpr uint32_t HANGUL_V_COUNT = 21;
+static constexpr uint32_t HANGUL_T_COUNT = 28;
+static constexpr uint32_t HANGUL_S_COUNT =
+    HANGUL_L_COUNT * HANGUL_V_COUNT * HANGUL_T_COUNT;
+
+static inline const UnicodeRecord *unicode_record(uint32_t cp) {
+  if (cp >= UNICODE_TABLE_LIMIT)
+    return &unicode_records[0];
+  constexpr uint32_t low = (1u << UNICODE_BLOCK_SHIFT) - 1;
+  uint32_t block = unicode_blocks[cp >> UNICODE_BLOCK_SHIFT];
+  return &unicode_records
+      [unicode_block_records[(block << UNICODE_BLOCK_SHIFT) | (cp & low)]];
+}
+
+// The primary composite of first followed by second, or 0.
+static uint32_t compose_pair(uint32_t first, uint32_t second) {
+  if (first - HANGUL_L_BASE < HANGUL_L_COUNT &&
+      second - HANGUL_V_BASE < HANGUL_V_COUNT) {
+    return HANGUL_S_BASE + ((first - HANGUL_L_BASE) * HANGUL_V_COUNT +
+                            (second - HANGUL_V_BASE)) *
+                               HANGUL_T_COUNT;
+  }
+  if (first - HANGUL_S_BASE < HANGUL_S_COUNT &&
+      (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0 &&
+      second - HANGUL_T_BASE - 1 < HANGUL_T_COUNT - 1) {
+    return first + (second - HANGUL_T_BASE);
+  }
+  uint64_t key = (uint64_t)first << 21 | second;
+  size_t lo = 0;
+  size_t hi = UNICODE_COMPOSITION_COUNT;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (unicode_composition_keys[mid] < key)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo < UNICODE_COMPOSITION_COUNT && unicode_composition_keys[lo] == key
+             ? unicode_composites[lo]
+             : 0;
+}
+
+// Output and composition state of one Unicode normalize call. Spaces are
+// collapsed as they are written; the one a trailing run leaves is cut at
+// the end.
+typedef struct {
+  char8_t *out;
+  size_t out_len;
+  size_t out_cap; // drops to out_len once a code point does not fit
+  bool in_space;  // the output is empty or ends in a collapsed space
+  bool casefold;
+  bool unicode_space;
+  bool compose; // NFKC: hold back a starter for the marks after it
+  int map;      // UnicodeRecord.map slot, or -1
+  // The last starter and the combining marks after it, which are sorted by
+  // class; expanded once the starter was canonically decomposed for them.
+  uint32_t segment[UNICODE_SEGMENT_MAX];
+  uint8_t classes[UNICODE_SEGMENT_MAX];
+  size_t segment_len;
+  bool expanded;
+  bool deferred; // the segment holds a mark that maps to a starter
+} UnicodeNormalizer;
+
+static void unicode_init(UnicodeNormalizer *n, char8_t *out, size_t out_cap) {
+  uint32_t mapped = normalize_flags & (NORMALIZE_NFKC | NORMALIZE_CASEFOLD);
+  *n = (UnicodeNormalizer){
+      .out = out,
+      .out_cap = out_cap,
+      .in_space = true,
+      .casefold = (normalize_flags & NORMALIZE_CASEFOLD) != 0,
+      .unicode_space = (normalize_flags & NORMALIZE_UNICODE_SPACE) != 0,
+      .compose = (normalize_flags & NORMALIZE_NFKC) != 0,
+      .map = (int)mapped - 1};
+}
+
+static inline void unicode_put(UnicodeNormalizer *n, const char8_t *bytes,
+                               size_t count) {
+  if (n->out_cap - n->out_len < count) {
+    n->out_cap = n->out_len;
+    return;
+  }
+  memcpy(n->out + n->out_len, bytes, count);
+  n->out_len += count;
+}
+
+static inline void unicode_emit(UnicodeNormalizer *n, uint32_t cp) {
+  if (cp <= 0x20) {
+    if (!n->in_space)
+      unicode_put(n, (const char8_t *)" ", 1);
+    n->in_space = true;
+    return;
+  }
+  char8_t bytes[4];
+  unicode_put(n, bytes, utf8_encode(cp, bytes));
+  n->in_space = false;
+}
+
+static void compose_push(UnicodeNormalizer *n, uint32_t cp,
+                         const UnicodeRecord *record);
+
+// The mapping of a mark that starts with a starter (U+0345, which case
+// folds to iota), or nullptr. Such marks wait in the segment unmapped, so
+// that they are mapped after canonical ordering, as NFKC case folding does.
+static inline const uint32_t *deferred_mapping(const UnicodeNormalizer *n,
+                                               const UnicodeRecord *record) {
+  if (record->ccc == 0 || n->map < 0 || record->map[n->map] == 0)
+    return nullptr;
+  const uint32_t *seq = &unicode_sequences[record->map[n->map]];
+  return unicode_record(seq[1])->ccc == 0 ? seq : nullptr;
+}
+
+// Push the segment through again with its deferred marks mapped.
+static void resolve_deferred(UnicodeNormalizer *n) {
+  uint32_t held[UNICODE_SEGMENT_MAX];
+  size_t count = n->segment_len;
+  memcpy(held, n->segment, count * sizeof(held[0]));
+  n->segment_len = 0;
+  n->expanded = false;
+  n->deferred = false;
+  for (size_t i = 0; i < count; ++i) {
+    const UnicodeRecord *record = unicode_record(held[i]);
+    const uint32_t *seq = deferred_mapping(n, record);
+    if (!seq) {
+      compose_push(n, held[i], record);
+      continue;
+    }
+    for (size_t k = 0; k < seq[0]; ++k) {
+      compose_push(n, seq[1 + k], unicode_record(seq[1 + k]));
+    }
+  }
+}
+
+// Canonical composition of the segment, in place.
+static void compose_segment(UnicodeNormalizer *n) {
+  if (n->deferred)
+    resolve_deferred(n);
+  if (n->segment_len < 2 || n->classes[0] != 0)
+    return;
+  uint32_t starter = n->segment[0];
+  size_t kept = 1;
+  for (size_t i = 1; i < n->segment_len; ++i) {
+    uint32_t mark = n->segment[i];
+    uint8_t cls = n->classes[i];
+    // A kept mark of the same class blocks; the marks are sorted.
+    if (kept == 1 || n->classes[kept - 1] < cls) {
+      uint32_t composite = 0;
+      if (unicode_record(mark)->flags & UNICODE_COMPOSES_BACK)
+        composite = compose_pair(starter, mark);
+      if (composite != 0) {
+        starter = composite;
+        continue;
+      }
+    }
+    n->segment[kept] = mark;
+    n->classes[kept++] = cls;
+  }
+  n->segment[0] = starter;
+  n->segment_len = kept;
+}
+
+static void emit_segment(UnicodeNormalizer *n) {
+  for (size_t i = 0; i < n->segment_len; ++i) {
+    unicode_emit(n, n->segment[i]);
+  }
+  n->segment_len = 0;
+  n->expanded = false;
+}
+
+static void flush_segment(UnicodeNormalizer *n) {
+  compose_segment(n);
+  emit_segment(n);
+}
+
+// Replace a lone starter by its canonical decomposition, so that a mark
+// arriving after it is ordered among the marks it already has.
+static void expand_starter(UnicodeNormalizer *n) {
+  n->expanded = true;
+  uint16_t decomp = unicode_record(n->segment[0])->decomp;
+  if (decomp == 0)
+    return;
+  const uint32_t *seq = &unicode_sequences[decomp];
+  for (size_t i = 0; i < seq[0]; ++i) {
+    n->segment[i] = seq[1 + i];
+    n->classes[i] = unicode_record(seq[1 + i])->ccc;
+  }
+  n->segment_len = seq[0];
+}
+
+static void compose_push(UnicodeNormalizer *n, uint32_t cp,
+                         const UnicodeRecord *record) {
+  if (record->ccc == 0) {
+    if (n->segment_len > 0 && (record->flags & UNICODE_COMPOSES_BACK)) {
+      compose_segment(n);
+      uint32_t composite = n->segment_len == 1 && n->classes[0] == 0
+                               ? compose_pair(n->segment[0], cp)
+                               : 0;
+      if (composite != 0) {
+        n->segment[0] = composite;
+        n->expanded = false;
+        return;
+      }
+      emit_segment(n);
+    } else {
+      flush_segment(n);
+    }
+    n->segment[0] = cp;
+    n->classes[0] = 0;
+    n->segment_len = 1;
+    return;
+  }
+  if (n->segment_len == 1 && n->classes[0] == 0 && !n->expanded)
+    expand_starter(n);
+  // Past UNICODE_SEGMENT_MAX marks (never in stream-safe text) the rest
+  // start a segment of their own.
+  if (n->segment_len == UNICODE_SEGMENT_MAX)
+    flush_segment(n);
+  size_t at = n->segment_len++;
+  for (; at > 0 && n->classes[at - 1] > record->ccc; --at) {
+    n->segment[at] = n->segment[at - 1];
+    n->classes[at] = n->classes[at - 1];
+  }
+  n->segment[at] = cp;
+  n->classes[at] = record->ccc;
+  if (deferred_mapping(n, record))
+    n->deferred = true;
+}
+
+static inline void unicode_deliver(UnicodeNormalizer *n, uint32_t cp,
+                                   const UnicodeRecord *record) {
+  if (n->compose)
+    compose_push(n, cp, record);
+  else
+    unicode_emit(n, cp);
+}
+
+// Normalize the code point or invalid sequence at bytes[0, len), len > 0;
+// returns the bytes consumed.
+static inline size_t unicode_step(UnicodeNormalizer *n, const char8_t *bytes,
+                                  size_t len) {
+  uint32_t cp = bytes[0];
+  if (cp < 0x80) {
+    if (n->casefold && cp - 'A' < 26)
+      cp += 'a' - 'A';
+    unicode_deliver(n, cp, &unicode_records[0]);
+    return 1;
+  }
+  bool invalid = false;
+  size_t advance = utf8_decode_advance(bytes, len, &cp, &invalid);
+  if (invalid) {
+    if (n->compose)
+      flush_segment(n);
+    unicode_put(n, bytes, advance);
+    n->in_space = false;
+    return advance;
+  }
+  const UnicodeRecord *record = unicode_record(cp);
+  if (n->unicode_space && (record->flags & UNICODE_WHITE_SPACE)) {
+    unicode_deliver(n, ' ', &unicode_records[0]);
+    return advance;
+  }
+  uint16_t map = n->map < 0 ? 0 : record->map[n->map];
+  if (map == 0) {
+    unicode_deliver(n, cp, record);
+    return advance;
+  }
+  if (n->compose && deferred_mapping(n, record)) {
+    compose_push(n, cp, record);
+    return advance;
+  }
+  const uint32_t *seq = &unicode_sequences[map];
+  for (size_t i = 0; i < seq[0]; ++i) {
+    unicode_deliver(n, seq[1 + i], unicode_record(seq[1 + i]));
+  }
+  return advance;
+}
+
+// Whether the code point is a starter that nothing held before it composes
+// with and that unicode-space leaves alone.
+static inline bool unicode_starter(const UnicodeNormalizer *n,
+                                   const UnicodeRecord *record) {
+  uint8_t unstable = UNICODE_COMPOSES_BACK;
+  if (n->unicode_space)
+    unstable |= UNICODE_WHITE_SPACE;
+  return record->ccc == 0 && (record->flags & unstable) == 0;
+}
+
+// For U+0080..U+07FF under the selected steps: the two-byte code point it
+// normalizes to when that is a lone stable starter as well, else 0. Built
+// by normalize_select, so most Latin, Greek and Cyrillic text skips the
+// tables and the composition segment.
+static uint16_t unicode_two_byte[0x800 - 0x80];
+// The same for the vector kernel, one row per pair of lead bytes (0xC2 and
+// 0xC3, 0xC4 and 0xC5, ...): bit (cont & 7) of byte (lead & 1) << 3 |
+// (cont & 0x3F) >> 3 is set when the code point stays as it is.
+static uint8_t unicode_two_byte_kept[16][16];
+
+static void build_two_byte_table(void) {
+  UnicodeNormalizer n;
+  unicode_init(&n, nullptr, 0);
+  memset(unicode_two_byte_kept, 0, sizeof(unicode_two_byte_kept));
+  for (uint32_t cp = 0x80; cp < 0x800; ++cp) {
+    const UnicodeRecord *record = unicode_record(cp);
+    uint32_t to = cp;
+    if (n.map >= 0 && record->map[n.map] != 0) {
+      const uint32_t *seq = &unicode_sequences[record->map[n.map]];
+      to = seq[0] == 1 ? seq[1] : 0;
+    }
+    bool stable = unicode_starter(&n, record) && to >= 0x80 && to < 0x800 &&
+                  unicode_starter(&n, unicode_record(to));
+    unicode_two_byte[cp - 0x80] = stable ? (uint16_t)to : 0;
+    if (stable && to == cp) {
+      uint32_t lead = 0xC0 | cp >> 6;
+      unicode_two_byte_kept[(lead - 0xC0) >> 1][(lead & 1) << 3 |
+                                                (cp & 0x3F) >> 3] |=
+          (uint8_t)(1u << (cp & 7));
+    }
+  }
+}
+
+// Length of the code point at bytes[0, len), len > 0, when it normalizes to
+// a stable starter (up to ASCII case folding and space collapsing), with
+// that starter in *to; 0 for anything unicode_step has to take.
+static inline size_t unicode_stable(const UnicodeNormalizer *n,
+                                    const char8_t *bytes, size_t len,
+                                    uint32_t *to) {
+  if (bytes[0] < 0x80) {
+    *to = bytes[0];
+    return 1;
+  }
+  if (bytes[0] >= 0xC2 && bytes[0] < 0xE0) {
+    if (len < 2 || (bytes[1] & 0xC0) != 0x80)
+      return 0;
+    uint32_t cp = (uint32_t)(bytes[0] & 0x1F) << 6 | (bytes[1] & 0x3F);
+    *to = unicode_two_byte[cp - 0x80];
+    return *to != 0 ? 2 : 0;
+  }
+  bool invalid = false;
+  size_t advance = utf8_decode_advance(bytes, len, to, &invalid);
+  if (invalid)
+    return 0;
+  const UnicodeRecord *record = unicode_record(*to);
+  if (!unicode_starter(n, record) ||
+      (n->map >= 0 && record->map[n->map] != 0))
+    return 0;
+  return advance;
+}
+
+// Write ASCII bytes as unicode_emit would, case folded with casefold.
+static inline void unicode_put_ascii(UnicodeNormalizer *n,
+                                     const char8_t *data, size_t len) {
+  char8_t *out = n->out + n->out_len;
+  size_t room = n->out_cap - n->out_len;
+  size_t written = 0;
+  bool in_space = n->in_space;
+  for (size_t i = 0; i < len; ++i) {
+    char8_t c = data[i];
+    bool space = c <= 0x20;
+    if (space && in_space)
+      continue;
+    in_space = space;
+    if (written == room) {
+      n->out_cap = n->out_len + written;
+      break;
+    }
+    if (space)
+      c = ' ';
+    else if (n->casefold && (unsigned)(c - 'A') < 26)
+      c += 'a' - 'A';
+    out[written++] = c;
+  }
+  n->out_len += written;
+  n->in_space = in_space;
+}
+
+// Write the run of stable code points at data[0, len) that starts before
+// limit; returns its length. With compose, a code point is only written
+// once the one after it is known not to combine with it; otherwise
+// unicode_step takes it and holds it.
+static inline size_t unicode_copy_run(UnicodeNormalizer *n,
+                                      const char8_t *data, size_t len,
+                                      size_t limit) {
+  size_t pos = 0;
+  uint32_t to = 0;
+  size_t advance = len > 0 ? unicode_stable(n, data, len, &to) : 0;
+  if (advance != 0 && n->compose)
+    flush_segment(n);
+  while (advance != 0 && pos < limit) {
+    if (advance == 1) {
+      size_t end = pos + 1;
+      while (end < limit && end < len && data[end] < 0x80)
+        ++end;
+      // With compose the last ASCII byte waits for what follows it.
+      if (n->compose && end < len)
+        --end;
+      if (end > pos) {
+        unicode_put_ascii(n, data + pos, end - pos);
+        pos = end;
+        advance = pos < len ? unicode_stable(n, data + pos, len - pos, &to) : 0;
+        continue;
+      }
+    }
+    size_t next = pos + advance;
+    uint32_t next_to = 0;
+    size_t next_advance =
+        next < len ? unicode_stable(n, data + next, len - next, &next_to) : 0;
+    if (n->compose && next < len && next_advance == 0)
+      break;
+    if (advance == 1) {
+      unicode_put_ascii(n, data + pos, 1);
+    } else if (advance == 2) {
+      char8_t bytes[2] = {(char8_t)(0xC0 | to >> 6),
+                          (char8_t)(0x80 | (to & 0x3F))};
+      unicode_put(n, bytes, 2);
+      n->in_space = false;
+    } else {
+      unicode_put(n, data + pos, advance);
+      n->in_space = false;
+    }
+    pos = next;
+    advance = next_advance;
+    to = next_to;
+  }
+  return pos;
+}
+
+static size_t unicode_finish(UnicodeNormalizer *n) {
+  if (n->compose)
+    flush_segment(n);
+  if (n->in_space && n->out_len > 0 && n->out[n->out_len - 1] == ' ')
+    n->out_len--;
+  return n->out_len;
+}
+
+static size_t normalize_unicode_scalar(const char8_t *data, size_t len,
+                                       char8_t *out, size_t out_cap) {
+  UnicodeNormalizer n;
+  unicode_init(&n, out, out_cap);
+  for (size_t i = 0; i < len;) {
+    i += unicode_copy_run(&n, data + i, len - i, len - i);
+    if (i < len)
+      i += unicode_step(&n, data + i, len - i);
+  }
+  return unicode_finish(&n);
+}
+
+static size_t normalize_hash_unicode_scalar(const char8_t *data, size_t len,
+                                            char8_t *out, size_t out_cap,
+                                            Hash128 *hash) {
+  size_t out_len = normalize_unicode_scalar(data, len, out, out_cap);
+  *hash = unit_fingerprint(out, out_len);
+  return out_len;
+}
+
+#if defined(TEXT_UTILS_X86)
+// pshufb control per 8-bit keep mask: the indices of its set bits in
+// order, then zeroing lanes.
+static uint64_t compact_shuffle[256];
+
+static void build_compact_shuffle(void) {
+  for (unsigned mask = 0; mask < 256; ++mask) {
+    uint64_t control = 0;
+    unsigned lane = 0;
+    for (unsigned bit = 0; bit < 8; ++bit) {
+      if (mask & (1u << bit))
+        control |= (uint64_t)bit << (8 * lane++);
+    }
+    for (; lane < 8; ++lane) {
+      control |= (uint64_t)0x80 << (8 * lane);
+    }
+    compact_shuffle[mask] = control;
+  }
+}
+
+// Append the bytes of block[0, groups * 8) whose keep bit is clear in drop.
+// The caller has already stored the whole block at out, so the groups
+// before the first dropped byte are in place.
+__attribute__((target("avx2,popcnt"))) static size_t
+compact_block(const char8_t *block, size_t groups, uint64_t drop,
+              char8_t *out) {
+  size_t first = (size_t)__builtin_ctzll(drop) / 8;
+  size_t out_len = first * 8;
+  uint64_t keep = ~drop;
+  for (size_t g = first; g < groups; ++g) {
+    auto mask = (uint8_t)(keep >> (8 * g));
+    __m128i bytes = _mm_loadl_epi64((const __m128i *)(block + 8 * g));
+    __m128i control = _mm_loadl_epi64((const __m128i *)&compact_shuffle[mask]);
+    _mm_storel_epi64((__m128i *)(out + out_len),
+                     _mm_shuffle_epi8(bytes, control));
+    out_len += (size_t)__builtin_popcount(mask);
+  }
+  return out_len;
+}
+
+// One 32-byte step: whitespace becomes ' ', and a space that follows
+// another is dropped; *carry says whether the byte before was whitespace.
+// The block is stored whole and then compacted in place, so stores may run
+// 32 bytes past the output; the callers' out_cap >= end - start covers
+// that, as the output never outgrows the input consumed so far.
+__attribute__((target("avx2,popcnt"))) static inline size_t
+collapse_vector32(__m256i v, char8_t *out, uint32_t *carry) {
+  const __m256i space = _mm256_set1_epi8(' ');
+  __m256i is_space = _mm256_cmpeq_epi8(_mm256_min_epu8(v, space), v);
+  auto spaces = (uint32_t)_mm256_movemask_epi8(is_space);
+  uint32_t drop = spaces & ((spaces << 1) | *carry);
+  *carry = spaces >> 31;
+  if (spaces != 0)
+    v = _mm256_blendv_epi8(v, space, is_space);
+  _mm256_storeu_si256((__m256i *)out, v);
+  if (drop == 0)
+    return 32;
+  alignas(32) char8_t block[32];
+  _mm256_store_si256((__m256i *)block, v);
+  return compact_block(block, 4, drop, out);
+}
+
+__attribute__((target("avx2,popcnt"))) static inline size_t
+collapse_block32(const char8_t *data, char8_t *out, uint32_t *carry) {
+  return collapse_vector32(_mm256_loadu_si256((const __m256i *)data), out,
+                           carry);
+}
+
+// The last rem < 32 bytes, padded with letters that are kept as they are
+// and cut off again.
+__attribute__((target("avx2,popcnt"))) static size_t
+collapse_rest32(const char8_t *data, size_t rem, char8_t *out,
+                uint32_t carry) {
+  alignas(32) char8_t block[32];
+  alignas(32) char8_t collapsed[32];
+  memset(block, 'x', sizeof(block));
+  memcpy(block, data, rem);
+  size_t len = collapse_vector32(_mm256_load_si256((const __m256i *)block),
+                                 collapsed, &carry) -
+               (sizeof(block) - rem);
+  memcpy(out, collapsed, len);
+  return len;
+}
+
+// Mix the output blocks completed since *hashed into state. Bytes before
+// out_len are final: later steps only store from out_len on.
+static inline void hash_output(const UnitHash *family, UnitHashState *state,
+                               const char8_t *out, size_t out_len,
+                               size_t *hashed) {
+  size_t count = (out_len - *hashed) / 16;
+  if (count == 0)
+    return;
+  family->blocks(state, out + *hashed, count);
+  *hashed += count * 16;
+}
+
+// Normalize, and with hash set also fingerprint the output as it is
+// produced, while it is still in L1.
+__attribute__((target("avx2,popcnt"), always_inline)) static inline size_t
+normalize_avx2_body(const char8_t *data, size_t len, char8_t *out,
+                    size_t out_cap, Hash128 *hash) {
+  size_t start = 0;
+  size_t end = 0;
+  trim_bounds(data, len, &start, &end);
+  if (out_cap < end - start) {
+    size_t out_len = collapse_tail(data, start, end, out, 0, out_cap, false);
+    if (hash)
+      *hash = unit_fingerprint(out, out_len);
+    return out_len;
+  }
+
+  const UnitHash *family = unit_hash_active();
+  UnitHashState state;
+  if (hash)
+    family->start(&state);
+  size_t hashed = 0;
+  size_t out_len = 0;
+  uint32_t carry = 0;
+  size_t i = start;
+  for (; i + 32 <= end; i += 32) {
+    out_len += collapse_block32(data + i, out + out_len, &carry);
+    if (hash)
+      hash_output(family, &state, out, out_len, &hashed);
+  }
+  if (i < end)
+    out_len += collapse_rest32(data + i, end - i, out + out_len, carry);
+  if (hash) {
+    hash_output(family, &state, out, out_len, &hashed);
+    *hash = family->finish(&state, out + hashed, out_len);
+  }
+  return out_len;
+}
+
+__attribute__((target("avx2,popcnt"))) static size_t
+normalize_avx2(const char8_t *data, size_t len, char8_t *out,
+               size_t out_cap) {
+  return normalize_avx2_body(data, len, out, out_cap, nullptr);
+}
+
+__attribute__((target("avx2,popcnt"))) static size_t
+normalize_hash_avx2(const char8_t *data, size_t len, char8_t *out,
+                    size_t out_cap, Hash128 *hash) {
+  return normalize_avx2_body(data, len, out, out_cap, hash);
+}
+
+// normalize_avx2_body on 64-byte blocks with AVX-512BW mask registers;
+// the remainder takes the AVX2 steps.
+__attribute__((target("avx512f,avx512bw,avx2,popcnt"),
+               always_inline)) static inline size_t
+normalize_avx512_body(const char8_t *data, size_t len, char8_t *out,
+                      size_t out_cap, Hash128 *hash) {
+  size_t start = 0;
+  size_t end = 0;
+  trim_bounds(data, len, &start, &end);
+  if (out_cap < end - start) {
+    size_t out_len = collapse_tail(data, start, end, out, 0, out_cap, false);
+    if (hash)
+      *hash = unit_fingerprint(out, out_len);
+    return out_len;
+  }
+
+  const UnitHash *family = unit_hash_active();
+  UnitHashState state;
+  if (hash)
+    family->start(&state);
+  size_t hashed = 0;
+  const __m512i space = _mm512_set1_epi8(' ');
+  size_t out_len = 0;
+  uint64_t carry = 0;
+  size_t i = start;
+  for (; i + 64 <= end; i += 64) {
+    __m512i v = _mm512_loadu_si512((const void *)(data + i));
+    __mmask64 spaces = _mm512_cmple_epu8_mask(v, space);
+    uint64_t drop = spaces & ((spaces << 1) | carry);
+    carry = spaces >> 63;
+    v = _mm512_mask_blend_epi8(spaces, v, space);
+    _mm512_storeu_si512((void *)(out + out_len), v);
+    if (drop == 0) {
+      out_len += 64;
+    } else {
+      alignas(64) char8_t block[64];
+      _mm512_store_si512((void *)block, v);
+      out_len += compact_block(block, 8, drop, out + out_len);
+    }
+    if (hash)
+      hash_output(family, &state, out, out_len, &hashed);
+  }
+  auto carry32 = (uint32_t)carry;
+  if (i + 32 <= end) {
+    out_len += collapse_block32(data + i, out + out_len, &carry32);
+    i += 32;
+  }
+  if (i < end)
+    out_len += collapse_rest32(data + i, end - i, out + out_len, carry32);
+  if (hash) {
+    hash_output(family, &state, out, out_len, &hashed);
+    *hash = family->finish(&state, out + hashed, out_len);
+  }
+  return out_len;
+}
+
+__attribute__((target("avx512f,avx512bw,avx2,popcnt"))) static size_t
+normalize_avx512(const char8_t *data, size_t len, char8_t *out,
+                 size_t out_cap) {
+  return normalize_avx512_body(data, len, out, out_cap, nullptr);
+}
+
+__attribute__((target("avx512f,avx512bw,avx2,popcnt"))) static size_t
+normalize_hash_avx512(const char8_t *data, size_t len, char8_t *out,
+                      size_t out_cap, Hash128 *hash) {
+  return normalize_avx512_body(data, len, out, out_cap, hash);
+}
+
+// Whether every two-byte code point of v, with leads and continuations at
+// the lead and cont bits, stays as it is under the selected steps. Only
+// blocks whose leads share a row of unicode_two_byte_kept are looked up.
+__attribute__((target("avx2,popcnt"))) static inline bool
+unicode_kept32(__m256i v, char8_t first_lead, uint32_t lead, uint32_t cont) {
+  __m256i row_leads = _mm256_cmpeq_epi8(
+      _mm256_and_si256(v, _mm256_set1_epi8((char)0xFE)),
+      _mm256_set1_epi8((char)(first_lead & 0xFE)));
+  if (((uint32_t)_mm256_movemask_epi8(row_leads) & lead) != lead)
+    return false;
+  __m256i row = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+      (const __m128i *)unicode_two_byte_kept[(first_lead - 0xC0) >> 1]));
+  // The byte before each one, so that a continuation sees its lead.
+  __m256i prev = _mm256_alignr_epi8(
+      v, _mm256_permute2x128_si256(v, v, 0x08), 15);
+  __m256i index = _mm256_or_si256(
+      _mm256_and_si256(_mm256_slli_epi16(prev, 3), _mm256_set1_epi8(8)),
+      _mm256_and_si256(_mm256_srli_epi16(v, 3), _mm256_set1_epi8(7)));
+  __m256i bits = _mm256_shuffle_epi8(row, index);
+  __m256i bit = _mm256_shuffle_epi8(
+      _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0,
+                       0, 0, 1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0,
+                       0, 0, 0, 0),
+      _mm256_and_si256(v, _mm256_set1_epi8(7)));
+  __m256i kept = _mm256_cmpeq_epi8(_mm256_and_si256(bits, bit), bit);
+  return ((uint32_t)_mm256_movemask_epi8(kept) & cont) == cont;
+}
+
+// Normalize the block at data[0, 32) (all of data when shorter) in
+// registers when it holds only ASCII and two-byte stable starters (most
+// Latin, Greek and Cyrillic text): the starters that change are rewritten
+// from unicode_two_byte, which keeps their length, then ASCII is case
+// folded and spaces collapse. A starter cut by the block end is left for
+// the next one. With compose the code point after the block must be stable
+// too, or a mark there could still combine with the block's last letter.
+// Returns the bytes taken, or 0 for the scalar run and step.
+__attribute__((target("avx2,popcnt"))) static inline size_t
+unicode_block32(UnicodeNormalizer *n, const char8_t *data, size_t len) {
+  size_t take = len < 32 ? len : 32;
+  alignas(32) char8_t block[32];
+  __m256i v;
+  if (take == 32) {
+    v = _mm256_loadu_si256((const __m256i *)data);
+  } else {
+    // Padded with letters that are kept as they are and cut off again.
+    memset(block, 'x', sizeof(block));
+    memcpy(block, data, take);
+    v = _mm256_load_si256((const __m256i *)block);
+  }
+  auto high = (uint32_t)_mm256_movemask_epi8(v);
+  if (high != 0) {
+    __m256i lead_offset = _mm256_sub_epi8(v, _mm256_set1_epi8((char)0xC2));
+    auto lead = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+        _mm256_min_epu8(lead_offset, _mm256_set1_epi8(0xDF - 0xC2)),
+        lead_offset));
+    auto cont = (uint32_t)_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(_mm256_and_si256(v, _mm256_set1_epi8((char)0xC0)),
+                          _mm256_set1_epi8((char)0x80)));
+    if ((lead | cont) != high || cont != lead << 1)
+      return 0;
+    if (lead >> (take - 1) & 1) {
+      lead &= ~(1u << --take);
+      if (take == 0)
+        return 0;
+    }
+    _mm256_store_si256((__m256i *)block, v);
+    // Lowercase text needs no rewriting.
+    if (lead != 0 &&
+        unicode_kept32(v, block[__builtin_ctz(lead)], lead, cont))
+      lead = 0;
+    for (; lead != 0; lead &= lead - 1) {
+      size_t at = (size_t)__builtin_ctz(lead);
+      uint32_t cp = (uint32_t)(block[at] & 0x1F) << 6 | (block[at + 1] & 0x3F);
+      uint32_t to = unicode_two_byte[cp - 0x80];
+      if (to == 0)
+        return 0;
+      block[at] = (char8_t)(0xC0 | to >> 6);
+      block[at + 1] = (char8_t)(0x80 | (to & 0x3F));
+    }
+    memset(block + take, 'x', sizeof(block) - take);
+    v = _mm256_load_si256((const __m256i *)block);
+  }
+  uint32_t next = 0;
+  if (n->compose && take < len &&
+      unicode_stable(n, data + take, len - take, &next) == 0)
+    return 0;
+
+  if (n->compose)
+    flush_segment(n);
+  if (n->casefold) {
+    __m256i offset = _mm256_sub_epi8(v, _mm256_set1_epi8('A'));
+    __m256i upper = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(offset, _mm256_set1_epi8(25)), offset);
+    v = _mm256_or_si256(v, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+  }
+  uint32_t carry = n->in_space;
+  n->out_len += collapse_vector32(v, n->out + n->out_len, &carry) -
+                (32 - take);
+  n->in_space = take == 32 ? carry != 0 : data[take - 1] <= 0x20;
+  return take;
+}
+
+// normalize_unicode_scalar with blocks of ASCII and two-byte letters taken
+// 32 bytes at a time. Other text goes through the scalar run and step one
+// block's worth at a time, so a single symbol does not leave the rest of
+// the unit to the scalar path.
+__attribute__((target("avx2,popcnt"))) static size_t
+normalize_unicode_avx2(const char8_t *data, size_t len, char8_t *out,
+                       size_t out_cap) {
+  UnicodeNormalizer n;
+  unicode_init(&n, out, out_cap);
+  size_t i = 0;
+  while (i < len) {
+    if (n.out_cap - n.out_len >= 32) {
+      size_t taken = unicode_block32(&n, data + i, len - i);
+      if (taken != 0) {
+        i += taken;
+        continue;
+      }
+    }
+    size_t run = unicode_copy_run(&n, data + i, len - i, 32);
+    i += run;
+    if (run < 32 && i < len)
+      i += unicode_step(&n, data + i, len - i);
+  }
+  return unicode_finish(&n);
+}
+
+__attribute__((target("avx2,popcnt"))) static size_t
+normalize_hash_unicode_avx2(const char8_t *data, size_t len, char8_t *out,
+                            size_t out_cap, Hash128 *hash) {
+  size_t out_len = normalize_unicode_avx2(data, len, out, out_cap);
+  *hash = unit_fingerprint(out, out_len);
+  return out_len;
+}
+#endif
+
+static NormalizeKernel normalize_available[3];
+static size_t normalize_available_count;
+static NormalizeKernel unicode_available[2];
+static size_t unicode_available_count;
+static once_flag normalize_once = ONCE_FLAG_INIT;
+
+// Runtime dispatch: list what the CPU runs, widest last.
+static void select_normalize_kernels(void) {
+  size_t count = 0;
+  size_t unicode_count = 0;
+  normalize_available[count++] =
+      (NormalizeKernel){.name = "scalar",
+                        .normalize = normalize_scalar,
+                        .normalize_hash = normalize_hash_scalar};
+  unicode_available[unicode_count++] =
+      (NormalizeKernel){.name = "scalar",
+                        .normalize = normalize_unicode_scalar,
+                        .normalize_hash = normalize_hash_unicode_scalar};
+#if defined(TEXT_UTILS_X86)
+  __builtin_cpu_init();
+  build_compact_shuffle();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+    normalize_available[count++] =
+        (NormalizeKernel){.name = "avx2",
+                          .normalize = normalize_avx2,
+                          .normalize_hash = normalize_hash_avx2};
+    unicode_available[unicode_count++] =
+        (NormalizeKernel){.name = "avx2",
+                          .normalize = normalize_unicode_avx2,
+                          .normalize_hash = normalize_hash_unicode_avx2};
+  }
+  if (__builtin_cpu_supports("avx512bw") &&
+      __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+    normalize_available[count++] =
+        (NormalizeKernel){.name = "avx512",
+                          .normalize = normalize_avx512,
+                          .normalize_hash = normalize_hash_avx512};
+  }
+#endif
+  normalize_available_count = count;
+  unicode_available_count = unicode_count;
+}
+
+// The kernel normalize_sentence runs under the selected steps.
+static inline const NormalizeKernel *dispatched_kernel(void) {
+  call_once(&normalize_once, select_normalize_kernels);
+  return normalize_flags != 0
+             ? &unicode_available[unicode_available_count - 1]
+             : &normalize_available[normalize_available_count - 1];
+}
+
+size_t normalize_kernels(const NormalizeKernel **kernels) {
+  call_once(&normalize_once, select_normalize_kernels);
+  if (normalize_flags != 0) {
+    *kernels = unicode_available;
+    return unicode_available_count;
+  }
+  *kernels = normalize_available;
+  return normalize_available_count;
+}
+
+size_t normalize_sentence(const char8_t *data, size_t len, char8_t *out,
+                          size_t out_cap) {
+  return dispatched_kernel()->normalize(data, len, out, out_cap);
+}
+
+size_t normalize_sentence_hashed(const char8_t *data, size_t len,
+                                 char8_t *out, size_t out_cap,
+                                 Hash128 *hash) {
+  return dispatched_kernel()->normalize_hash(data, len, out, out_cap, hash);
+}
+
+static const struct {
+  const char *name;
+  uint32_t flag;
+} normalize_steps[] = {
+    {"nfkc", NORMALIZE_NFKC},
+    {"casefold", NORMALIZE_CASEFOLD},
+    {"unicode-space", NORMALIZE_UNICODE_SPACE},
+};
+static constexpr size_t normalize_step_count =
+    sizeof(normalize_steps) / sizeof(normalize_steps[0]);
+
+bool normalize_parse(const char *list, uint32_t *flags) {
+  *flags = 0;
+  if (strcmp(list, "none") == 0)
+    return true;
+  for (const char *item = list;;) {
+    const char *comma = strchr(item, ',');
+    size_t len = comma ? (size_t)(comma - item) : strlen(item);
+    size_t k = 0;
+    while (k < normalize_step_count &&
+           (strlen(normalize_steps[k].name) != len ||
+            memcmp(normalize_steps[k].name, item, len) != 0)) {
+      k++;
+    }
+    if (k == normalize_step_count)
+      return false;
+    *flags |= normalize_steps[k].flag;
+    if (!comma)
+      return true;
+    item = comma + 1;
+  }
+}
+
+const char *normalize_describe(uint32_t flags, char *buf, size_t cap) {
+  size_t len = 0;
+  buf[0] = '\0';
+  for (size_t k = 0; k < normalize_step_count; ++k) {
+    if ((flags & normalize_steps[k].flag) == 0)
+      continue;
+    int written = snprintf(buf + len, cap - len, "%s%s", len ? "," : "",
+                           normalize_steps[k].name);
+    if (written < 0 || (size_t)written >= cap - len)
+      break;
+    len += (size_t)written;
+  }
+  if (len == 0)
+    snprintf(buf, cap, "none");
+  return buf;
+}
+
+void normalize_select(uint32_t flags) {
+  normalize_flags = flags;
+  build_two_byte_table();
+}
+
+uint32_t normalize_selected(void) { return normalize_flags; }
+
+bool normalize_bound(size_t len, size_t *bound) {
+  size_t growth = normalize_flags & (NORMALIZE_NFKC | NORMALIZE_CASEFOLD)
+                      ? UNICODE_MAX_GROWTH
+                      : 1;
+  return !ckd_mul(bound, len, growth);
+}
+
 void trim_line(char *line) {
   if (!line)
     return;
@@ -0,0 +1,4775 @@
+// Generated by scripts/gen_unicode_tables.py from Unicode 14.0.0; do not edit.
+#include "unicode_tables.h"
+
+const uint16_t unicode_blocks[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 3, 3, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    39, 40, 3, 41, 42, 43, 3, 44, 45, 46, 47, 3, 3, 48, 49, 50, 51, 52, 3, 3, 3,
+    3, 53, 54, 55, 56, 3, 57, 3, 58, 59, 3, 60, 61, 3, 3, 62, 63, 64, 3, 65, 66,
+    3, 3, 67, 68, 3, 3, 62, 69, 3, 3, 70, 71, 3, 3, 67, 72, 3, 3, 67, 73, 3, 3,
+    74, 71, 3, 3, 3, 75, 3, 3, 76, 77, 3, 3, 78, 79, 3, 80, 81, 82, 83, 84, 85,
+    86, 3, 3, 87, 3, 3, 88, 89, 90, 91, 3, 3, 3, 92, 3, 93, 94, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 95, 3, 3, 3, 3, 96, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 1, 3, 3, 3, 97, 98, 3, 3, 3, 3, 99, 3, 3, 3, 3, 3, 3,
+    100, 3, 3, 3, 101, 3, 3, 3, 3, 3, 3, 102, 3, 3, 103, 3, 104, 105, 3, 3, 106,
+    107, 108, 3, 109, 3, 110, 3, 111, 3, 3, 112, 113, 114, 115, 3, 116, 117,
+    118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147,
+    148, 149, 150, 151, 152, 153, 3, 154, 155, 156, 157, 158, 159, 3, 160, 3,
+    161, 3, 3, 3, 3, 3, 3, 3, 3, 3, 162, 163, 164, 165, 166, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 167, 3, 3, 168, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 169, 170, 3, 171, 172, 173, 174, 175, 3, 3, 3, 176, 3, 3, 3, 177, 3, 3,
+    3, 3, 178, 3, 3, 179, 180, 181, 182, 183, 184, 185, 186, 3, 187, 188, 189,
+    190, 191, 192, 193, 194, 3, 195, 196, 197, 198, 3, 3, 3, 199, 200, 201, 202,
+    203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 215, 216, 217, 3, 3, 218, 3, 219, 220, 221, 222,
+    223, 224, 225, 226, 227, 3, 3, 3, 3, 107, 228, 3, 229, 230, 3, 3, 231, 232,
+    3, 3, 3, 3, 3, 3, 233, 234, 235, 3, 3, 236, 237, 238, 239, 3, 68, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 240, 241, 242, 243, 244, 245, 246,
+    247, 248, 249, 250, 251, 252, 253, 254, 3, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275,
+    276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290,
+    291, 292, 293, 294, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 295, 3, 3,
+    3, 3, 3, 3, 3, 296, 3, 3, 3, 297, 3, 3, 3, 3, 298, 299, 3, 3, 3, 300, 301,
+    3, 3, 3, 3, 302, 303, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 304, 305,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 306, 307, 3, 3, 3, 3,
+    3, 308, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 309, 310, 3, 3, 3, 311, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 312, 3, 3, 3, 3, 313, 3, 314, 3, 3, 3, 3, 3, 226,
+    315, 316, 317, 3, 3, 318, 319, 3, 231, 3, 3, 320, 3, 3, 321, 3, 3, 3, 3, 3,
+    322, 3, 323, 71, 324, 3, 3, 3, 3, 3, 3, 325, 3, 3, 326, 327, 3, 3, 3, 3, 3,
+    3, 328, 329, 3, 3, 330, 3, 3, 3, 331, 3, 3, 3, 332, 3, 3, 3, 3, 3, 3, 3,
+    333, 3, 3, 3, 334, 3, 3, 3, 335, 336, 3, 3, 3, 3, 232, 3, 98, 337, 3, 338,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 330, 3, 3, 3, 3, 3, 3, 3, 3, 339, 3,
+    340, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 341, 3, 342, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 343, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 344, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 345, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 346, 347, 348, 349, 350, 3, 3, 3,
+    351, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 352, 353, 354, 355, 356, 357,
+    358, 359, 360, 361, 362, 363, 364, 352, 353, 365, 355, 366, 367, 368, 359,
+    369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 380, 381, 3, 3, 3, 3, 3, 3, 3, 342, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 382, 3, 383, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 384, 3, 385, 386, 387, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 388,
+    389, 390, 391, 392, 393, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 394, 395, 396, 397, 398, 3, 3, 3, 399, 400, 401, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 402, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 403, 404, 405, 406, 407, 408, 409, 410, 411,
+    412, 413, 414, 415, 416, 417, 418, 419,
+};
+
+const uint16_t unicode_block_records[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 29, 0,
+    30, 0, 0, 0, 0, 31, 0, 0, 32, 33, 34, 35, 0, 0, 36, 37, 38, 0, 39, 40, 41,
+    0, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 0, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+    78, 0, 79, 80, 81, 82, 83, 84, 85, 86, 87, 0, 88, 89, 90, 91, 92, 93, 0, 0,
+    94, 95, 96, 97, 98, 0, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+    110, 111, 112, 113, 114, 115, 116, 0, 117, 118, 119, 120, 121, 122, 123,
+    124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 0,
+    138, 139, 140, 141, 142, 143, 144, 145, 146, 0, 147, 148, 149, 150, 151,
+    152, 0, 153, 154, 155, 156, 157, 158, 159, 160, 161, 0, 162, 163, 164, 165,
+    166, 167, 168, 169, 0, 170, 171, 172, 173, 174, 175, 176, 0, 177, 178, 179,
+    180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194,
+    195, 0, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+    209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 0, 220, 221, 0, 222,
+    0, 223, 224, 0, 225, 226, 227, 0, 0, 228, 229, 230, 231, 0, 232, 233, 0,
+    234, 235, 236, 0, 0, 0, 237, 238, 0, 239, 240, 241, 242, 0, 243, 0, 244,
+    245, 0, 246, 0, 0, 247, 0, 248, 249, 250, 251, 252, 253, 0, 254, 0, 255,
+    256, 0, 0, 0, 257, 0, 0, 0, 0, 0, 0, 0, 258, 259, 260, 261, 262, 263, 264,
+    265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+    280, 281, 282, 0, 283, 284, 285, 286, 287, 288, 289, 0, 290, 291, 292, 293,
+    294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323,
+    324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338,
+    339, 340, 341, 342, 343, 344, 0, 345, 346, 347, 0, 348, 0, 349, 0, 350, 351,
+    352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 0, 0, 0, 0, 0,
+    0, 364, 365, 0, 366, 367, 0, 0, 368, 0, 369, 370, 371, 372, 0, 373, 0, 374,
+    0, 375, 0, 376, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 377, 378, 379, 380, 381, 382, 383,
+    384, 385, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 386, 387, 388, 389, 390, 391, 0, 0, 392, 393,
+    394, 395, 396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 397, 397, 397, 397, 397, 398, 397, 397, 397, 397, 397,
+    397, 397, 398, 398, 397, 398, 397, 398, 397, 397, 399, 400, 400, 400, 400,
+    399, 401, 400, 400, 400, 400, 400, 402, 402, 403, 403, 403, 403, 404, 404,
+    400, 400, 400, 400, 403, 403, 400, 403, 403, 400, 400, 405, 405, 405, 405,
+    406, 400, 400, 400, 400, 398, 398, 398, 407, 408, 397, 409, 410, 411, 398,
+    400, 400, 400, 398, 398, 398, 400, 400, 0, 398, 398, 398, 400, 400, 400,
+    400, 398, 399, 400, 400, 398, 412, 413, 413, 412, 413, 413, 412, 398, 398,
+    398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 414, 0, 415, 0, 416,
+    0, 417, 0, 0, 0, 418, 0, 0, 0, 419, 420, 0, 0, 0, 0, 34, 421, 422, 423, 424,
+    425, 426, 0, 427, 0, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
+    439, 440, 441, 442, 443, 444, 445, 446, 447, 0, 448, 449, 450, 451, 452,
+    453, 454, 455, 456, 457, 458, 459, 460, 461, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 448, 0, 0, 0, 0, 0, 0, 0, 462, 463, 464, 465, 466, 467,
+    468, 469, 470, 471, 472, 473, 474, 0, 475, 0, 476, 0, 477, 0, 478, 0, 479,
+    0, 480, 0, 481, 0, 482, 0, 483, 0, 484, 0, 485, 0, 486, 0, 487, 488, 489, 0,
+    490, 491, 0, 492, 0, 493, 494, 0, 0, 495, 496, 497, 498, 499, 500, 501, 502,
+    503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517,
+    518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
+    533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 546, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 547, 548, 0, 549, 0, 0, 0, 550, 0, 0, 0, 0, 551, 552, 553, 0, 554,
+    0, 555, 0, 556, 0, 557, 0, 558, 0, 559, 0, 560, 0, 561, 0, 562, 0, 563, 0,
+    564, 0, 565, 566, 567, 0, 568, 0, 569, 0, 570, 0, 571, 0, 0, 398, 398, 398,
+    398, 398, 0, 0, 572, 0, 573, 0, 574, 0, 575, 0, 576, 0, 577, 0, 578, 0, 579,
+    0, 580, 0, 581, 0, 582, 0, 583, 0, 584, 0, 585, 0, 586, 0, 587, 0, 588, 0,
+    589, 0, 590, 0, 591, 0, 592, 0, 593, 0, 594, 0, 595, 0, 596, 0, 597, 0, 598,
+    0, 599, 600, 601, 602, 0, 603, 0, 604, 0, 605, 0, 606, 0, 607, 0, 0, 608,
+    609, 610, 611, 612, 0, 613, 614, 615, 0, 616, 617, 618, 619, 620, 621, 622,
+    0, 623, 624, 625, 626, 627, 628, 629, 0, 630, 631, 632, 633, 634, 635, 636,
+    637, 638, 639, 640, 641, 642, 0, 643, 644, 645, 0, 646, 0, 647, 0, 648, 0,
+    649, 0, 650, 0, 651, 0, 652, 0, 653, 0, 654, 0, 655, 0, 656, 0, 657, 0, 658,
+    0, 659, 0, 660, 0, 661, 0, 662, 0, 663, 0, 664, 0, 665, 0, 666, 0, 667, 0,
+    668, 0, 669, 0, 670, 0, 671, 0, 0, 672, 673, 674, 675, 676, 677, 678, 679,
+    680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 710, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 400, 398, 398, 398, 398, 400, 398, 398, 398, 711, 400, 398, 398, 398,
+    398, 398, 398, 400, 400, 400, 400, 400, 400, 398, 398, 400, 398, 398, 711,
+    712, 398, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 722, 723, 724,
+    725, 0, 726, 0, 727, 728, 0, 398, 400, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 398, 398, 398, 398, 398, 398, 398, 398, 729, 730, 731, 0, 0,
+    0, 0, 0, 0, 0, 732, 733, 734, 735, 736, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 737,
+    738, 739, 729, 730, 731, 740, 741, 397, 397, 403, 400, 398, 398, 398, 398,
+    398, 400, 398, 398, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    742, 0, 0, 0, 0, 743, 744, 745, 746, 0, 0, 0, 0, 0, 0, 0, 747, 0, 748, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 749, 0, 0, 398, 398, 398, 398,
+    398, 398, 398, 0, 0, 398, 398, 398, 398, 400, 398, 0, 0, 398, 398, 0, 400,
+    398, 398, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 400,
+    398, 398, 400, 398, 398, 400, 400, 400, 398, 400, 400, 398, 400, 398, 398,
+    398, 400, 398, 400, 398, 400, 398, 400, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398,
+    398, 398, 398, 398, 398, 398, 400, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 400, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398,
+    398, 398, 398, 0, 398, 398, 398, 398, 398, 398, 398, 398, 398, 0, 398, 398,
+    398, 0, 398, 398, 398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 400, 400, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 400, 400, 400, 398, 398, 398, 398,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398, 398, 398, 400, 400, 400, 400,
+    400, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    0, 400, 398, 398, 400, 398, 398, 400, 398, 398, 398, 400, 400, 400, 737,
+    738, 739, 398, 398, 398, 400, 398, 398, 400, 400, 398, 398, 398, 398, 398,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 751, 0, 0, 0, 0, 0, 0, 0, 752, 0, 0, 753, 0, 0,
+    0, 0, 0, 0, 0, 754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0,
+    0, 0, 398, 400, 398, 398, 0, 0, 0, 756, 757, 758, 759, 760, 761, 762, 763,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 764, 0, 765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 765, 0, 0, 0, 0, 766, 767, 0, 768, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 769, 0, 0, 770, 0,
+    0, 0, 0, 0, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 771, 772, 773, 0, 0, 774, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 764, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0,
+    0, 0, 0, 0, 765, 765, 0, 0, 0, 0, 775, 776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 765, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 765, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 777, 0, 0, 0, 0, 755, 0, 0, 0, 0,
+    0, 0, 0, 778, 779, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 765, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 765, 765, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 755, 755, 0, 765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 780, 0, 0, 0, 0,
+    765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 781, 0, 0, 0, 0, 765, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 782, 0, 0, 0, 0, 783, 783, 755, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 784, 784, 784, 784, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 785, 0, 0, 0, 0, 786, 786, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 787, 787, 787, 787, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 788, 789, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 790, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 400, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 400, 0, 400, 0, 791, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 792, 0, 0, 0, 0, 0, 0, 0, 0, 0, 793, 0, 0, 0, 0, 794, 0, 0, 0, 0, 795,
+    0, 0, 0, 0, 796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 797, 0, 0, 0, 0, 0, 0,
+    0, 798, 799, 800, 801, 802, 803, 804, 805, 806, 799, 799, 799, 799, 0, 0,
+    799, 807, 398, 398, 755, 0, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 808,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 809, 0, 0, 0, 0, 810, 0, 0, 0, 0, 811, 0, 0, 0,
+    0, 812, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 813, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 765, 0, 0, 0, 0, 0, 0,
+    0, 0, 764, 0, 755, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 814, 815, 816,
+    817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831,
+    832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846,
+    847, 848, 849, 850, 851, 0, 852, 0, 0, 0, 0, 0, 853, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 854, 0, 0, 0, 0, 765, 765, 765, 765,
+    765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765,
+    765, 765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 765, 765,
+    765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765,
+    765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398,
+    398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 855, 856, 857, 858, 859, 860, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 712, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 711, 398, 400, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 398, 400, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398, 398, 398, 398, 398, 398, 0, 0, 400,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398, 398, 398,
+    400, 400, 400, 400, 400, 400, 398, 398, 400, 0, 400, 400, 398, 398, 400,
+    400, 398, 398, 398, 398, 398, 400, 398, 398, 398, 398, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 764, 765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 400, 398, 398, 398, 398, 398, 398,
+    398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755,
+    755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 755, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 764, 0, 0, 0, 0, 0, 0, 0, 0, 516, 518, 528, 531, 532, 532, 540,
+    555, 861, 0, 0, 0, 0, 0, 0, 0, 862, 863, 864, 865, 866, 867, 868, 869, 870,
+    871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885,
+    886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900,
+    901, 902, 903, 904, 0, 0, 905, 906, 907, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 398, 398, 398, 0, 405, 400, 400, 400, 400, 400, 398, 398, 400,
+    400, 400, 400, 398, 0, 405, 405, 405, 405, 405, 405, 405, 0, 0, 0, 0, 400,
+    0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 908, 909, 910, 0, 911, 912, 913, 914, 915, 916, 917,
+    918, 919, 920, 921, 0, 922, 923, 924, 925, 926, 927, 928, 30, 929, 930, 931,
+    932, 933, 934, 935, 936, 937, 938, 0, 939, 940, 941, 38, 942, 943, 944, 945,
+    946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 380, 947, 950,
+    952, 953, 958, 955, 956, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 959, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 960, 961, 962, 963, 937, 964, 965, 966, 967, 968, 969,
+    970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984,
+    985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 398, 398, 400, 398,
+    398, 398, 398, 398, 398, 398, 400, 398, 398, 413, 996, 400, 402, 398, 398,
+    398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 398, 398, 398, 399, 712, 712, 400, 997, 398, 412, 400, 398, 400,
+    998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010,
+    1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022,
+    1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
+    1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046,
+    1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058,
+    1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+    1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082,
+    1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
+    1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106,
+    1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118,
+    1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130,
+    1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142,
+    1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 0, 0, 72,
+    0, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165,
+    1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177,
+    1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189,
+    1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201,
+    1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
+    1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225,
+    1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237,
+    1238, 1239, 1240, 1241, 1242, 1243, 1244, 0, 1245, 0, 1246, 0, 1247, 1248,
+    1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260,
+    1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 0, 0, 1269, 1270, 1271,
+    1272, 1273, 1274, 0, 0, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282,
+    1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294,
+    1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306,
+    1307, 1308, 1309, 1310, 1311, 1312, 0, 0, 1313, 1314, 1315, 1316, 1317,
+    1318, 0, 0, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 0, 1327, 0,
+    1328, 0, 1329, 0, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338,
+    1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350,
+    1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 0, 0, 1361,
+    1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+    1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385,
+    1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397,
+    1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409,
+    1410, 1411, 1412, 1413, 0, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421,
+    1422, 1421, 1423, 1424, 1425, 1426, 1427, 0, 1428, 1429, 1430, 1431, 1432,
+    1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 0, 0, 1442, 1443,
+    1444, 1445, 1446, 1447, 0, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455,
+    1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 421, 1465, 0, 0, 1466,
+    1467, 1468, 0, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 34, 1476, 0, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 0, 0, 0, 0, 0, 0, 1477, 0, 0, 0, 0,
+    0, 1478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1479, 1480, 1481, 0, 1, 1, 0,
+    0, 0, 0, 0, 28, 0, 0, 0, 1482, 1483, 0, 1484, 1485, 0, 0, 0, 0, 1486, 0,
+    1487, 0, 0, 0, 0, 0, 0, 0, 0, 1488, 1489, 1490, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1491, 957, 0, 0, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499,
+    1500, 1501, 1502, 1503, 1491, 37, 32, 33, 1492, 1493, 1494, 1495, 1496,
+    1497, 1498, 1499, 1500, 1501, 1502, 0, 30, 934, 38, 395, 935, 377, 939, 393,
+    940, 1503, 945, 394, 946, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1504, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 405, 405, 398, 398, 398, 398, 405,
+    405, 405, 398, 398, 0, 0, 0, 0, 398, 0, 0, 0, 405, 405, 398, 400, 398, 405,
+    405, 400, 400, 400, 400, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1505, 1506, 1507, 1508, 0, 1509, 1510, 1511, 0, 1512, 938, 915, 915, 915,
+    377, 1513, 916, 916, 919, 393, 0, 921, 1514, 0, 0, 924, 1515, 925, 925, 925,
+    0, 0, 1516, 1517, 1518, 0, 1519, 0, 1520, 0, 1519, 0, 1521, 1522, 910, 1507,
+    0, 934, 912, 1523, 1524, 920, 38, 1525, 1526, 1527, 1528, 957, 0, 1529,
+    1530, 953, 1531, 1532, 1533, 0, 0, 0, 0, 911, 933, 934, 957, 379, 0, 0, 0,
+    0, 0, 0, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544,
+    1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556,
+    1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 957, 1566, 1567, 1568,
+    950, 1569, 1570, 1571, 1572, 395, 1573, 1574, 393, 961, 933, 940, 0, 0, 0,
+    1575, 0, 0, 0, 0, 0, 1576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1577, 1578, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1579, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1580, 1581, 1582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1583, 0, 0, 0, 0, 1584, 0, 0, 1585, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1586, 0, 1587, 0, 0, 0, 0, 0,
+    1588, 1589, 0, 1590, 1591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1592, 0, 0, 1593, 0, 0, 1594, 0, 1595, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1596, 0, 1597, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1598, 1599, 1600, 1601, 1602, 0, 0, 1603, 1604, 0, 0, 1605, 1606, 0, 0, 0,
+    0, 0, 0, 1607, 1608, 0, 0, 1609, 1610, 0, 0, 1611, 1612, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1613, 1614, 1615, 1616, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1617, 1618, 1619, 1620, 0, 0, 0, 0, 0, 0, 1621, 1622, 1623, 1624, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1625, 1626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 37, 32, 33, 1492, 1493, 1494, 1495, 1496, 1497, 1627, 1628, 1629, 1630,
+    1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642,
+    1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654,
+    1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666,
+    1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678,
+    1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690,
+    1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702,
+    1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714,
+    1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726,
+    1727, 1728, 1729, 30, 932, 961, 933, 934, 964, 938, 377, 957, 379, 939, 393,
+    940, 1503, 38, 945, 1730, 380, 394, 946, 947, 950, 384, 395, 385, 991, 1491,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1731, 1732, 1733, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1734, 0, 0, 0, 1735, 1736, 1737, 1738, 1739,
+    1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751,
+    1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763,
+    1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
+    1776, 1777, 1778, 1779, 1780, 1781, 1782, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1783, 0, 1784, 1785, 1786, 0, 0, 1787, 0, 1788, 0, 1789, 0,
+    1790, 1791, 1792, 1793, 0, 1794, 0, 0, 1795, 0, 0, 0, 0, 0, 0, 379, 1796,
+    1797, 1798, 1799, 0, 1800, 0, 1801, 0, 1802, 0, 1803, 0, 1804, 0, 1805, 0,
+    1806, 0, 1807, 0, 1808, 0, 1809, 0, 1810, 0, 1811, 0, 1812, 0, 1813, 0,
+    1814, 0, 1815, 0, 1816, 0, 1817, 0, 1818, 0, 1819, 0, 1820, 0, 1821, 0,
+    1822, 0, 1823, 0, 1824, 0, 1825, 0, 1826, 0, 1827, 0, 1828, 0, 1829, 0,
+    1830, 0, 1831, 0, 1832, 0, 1833, 0, 1834, 0, 1835, 0, 1836, 0, 1837, 0,
+    1838, 0, 1839, 0, 1840, 0, 1841, 0, 1842, 0, 1843, 0, 1844, 0, 1845, 0,
+    1846, 0, 1847, 0, 1848, 0, 0, 0, 0, 0, 0, 0, 0, 1849, 0, 1850, 0, 398, 398,
+    398, 1851, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755,
+    398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1853, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1855, 1856, 1857,
+    1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869,
+    1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881,
+    1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893,
+    1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905,
+    1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917,
+    1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929,
+    1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941,
+    1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953,
+    1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965,
+    1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977,
+    1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989,
+    1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001,
+    2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013,
+    2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025,
+    2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037,
+    2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049,
+    2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061,
+    2062, 2063, 2064, 2065, 2066, 2067, 2068, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 997, 712, 399, 711, 2069,
+    2069, 0, 0, 0, 0, 0, 0, 2070, 0, 1878, 2071, 2072, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2073, 0, 2074, 0, 2075, 0, 2076, 0, 2077, 0,
+    2078, 0, 2079, 0, 2080, 0, 2081, 0, 2082, 0, 2083, 0, 2084, 0, 0, 2085, 0,
+    2086, 0, 2087, 0, 0, 0, 0, 0, 0, 2088, 2089, 0, 2090, 2091, 0, 2092, 2093,
+    0, 2094, 2095, 0, 2096, 2097, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2098, 0, 0, 0, 0, 2099, 2099, 2100, 2101, 0, 2102,
+    2103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2104, 0, 2105, 0, 2106, 0, 2107,
+    0, 2108, 0, 2109, 0, 2110, 0, 2111, 0, 2112, 0, 2113, 0, 2114, 0, 2115, 0,
+    0, 2116, 0, 2117, 0, 2118, 0, 0, 0, 0, 0, 0, 2119, 2120, 0, 2121, 2122, 0,
+    2123, 2124, 0, 2125, 2126, 0, 2127, 2128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2129, 0, 0, 2130, 2131, 2132, 2133, 0, 0,
+    0, 2134, 2135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2136,
+    2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148,
+    2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160,
+    2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172,
+    2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184,
+    2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196,
+    2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208,
+    2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220,
+    2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 0, 0, 0, 1855, 1861,
+    2230, 2231, 2232, 2233, 2234, 2235, 1859, 2236, 2237, 2238, 2239, 1863,
+    2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251,
+    2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263,
+    2264, 2265, 2266, 2267, 2268, 2269, 2270, 0, 2271, 2272, 2273, 2274, 2275,
+    2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287,
+    2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299,
+    2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 1921, 2309, 0, 0, 0,
+    0, 0, 0, 0, 0, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319,
+    2320, 2321, 2322, 2323, 2324, 2325, 2136, 2139, 2142, 2144, 2152, 2153,
+    2156, 2158, 2159, 2161, 2162, 2163, 2164, 2165, 2326, 2327, 2328, 2329,
+    2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341,
+    2342, 0, 1855, 1861, 2230, 2231, 2343, 2344, 2345, 1866, 2346, 1878, 1928,
+    1940, 1939, 1929, 2021, 1886, 1926, 2347, 2348, 2349, 2350, 2351, 2352,
+    2353, 2354, 2355, 2356, 1892, 2357, 2358, 2359, 2360, 2361, 2362, 2363,
+    2364, 2232, 2233, 2234, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372,
+    2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384,
+    2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396,
+    2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408,
+    2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420,
+    2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432,
+    2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444,
+    2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 0, 0, 0, 2454, 0,
+    2455, 2456, 0, 0, 2457, 2458, 2459, 0, 0, 2460, 2461, 2462, 2463, 0, 0,
+    2464, 0, 0, 0, 2465, 0, 0, 0, 2466, 2467, 2468, 0, 0, 0, 2469, 2470, 2471,
+    2472, 2473, 2474, 2475, 2476, 2477, 0, 2478, 0, 0, 2479, 2480, 2481, 0, 0,
+    0, 2482, 0, 2483, 2484, 2485, 2486, 2487, 2488, 0, 2489, 2490, 2491, 2492,
+    2493, 0, 2494, 2495, 2496, 0, 0, 2497, 0, 2498, 0, 0, 2499, 2500, 2501, 0,
+    2502, 2503, 0, 2504, 0, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512,
+    2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524,
+    2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536,
+    2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 0, 2545, 2546, 2547, 2548,
+    2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560,
+    2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572,
+    2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584,
+    2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596,
+    2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608,
+    2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620,
+    2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632,
+    2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644,
+    2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656,
+    2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668,
+    2669, 2670, 2671, 2672, 2673, 0, 2674, 0, 2675, 0, 2676, 0, 2677, 0, 861, 0,
+    2678, 0, 2679, 0, 2680, 0, 2681, 0, 2682, 0, 2683, 0, 2684, 0, 2685, 0,
+    2686, 0, 2687, 0, 2688, 0, 2689, 0, 2690, 0, 2691, 0, 2692, 0, 2693, 0,
+    2694, 0, 0, 398, 0, 0, 0, 0, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 0, 0, 2695, 0, 2696, 0, 2697, 0, 2698, 0, 2699, 0, 2700, 0, 2701, 0,
+    2702, 0, 2703, 0, 2704, 0, 2705, 0, 2706, 0, 2707, 0, 2708, 0, 2709, 2710,
+    398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2711, 0, 2712, 0, 2713, 0, 2714, 0,
+    2715, 0, 2716, 0, 2717, 0, 0, 0, 2718, 0, 2719, 0, 2720, 0, 2721, 0, 2722,
+    0, 2723, 0, 2724, 0, 2725, 0, 2726, 0, 2727, 0, 2728, 0, 2729, 0, 2730, 0,
+    2731, 0, 2732, 0, 2733, 0, 2734, 0, 2735, 0, 2736, 0, 2737, 0, 2738, 0,
+    2739, 0, 2740, 0, 2741, 0, 2742, 0, 2743, 0, 2744, 0, 2745, 0, 2746, 0,
+    2747, 0, 2748, 0, 2749, 0, 0, 0, 0, 0, 0, 0, 0, 2750, 0, 2751, 0, 2752,
+    2753, 0, 2754, 0, 2755, 0, 2756, 0, 2757, 0, 0, 0, 0, 2758, 0, 2759, 0, 0,
+    2760, 0, 2761, 0, 0, 0, 2762, 0, 2763, 0, 2764, 0, 2765, 0, 2766, 0, 2767,
+    0, 2768, 0, 2769, 0, 2770, 0, 2771, 0, 2772, 2773, 2774, 2775, 2776, 0,
+    2777, 2778, 2779, 2780, 2781, 0, 2782, 0, 2783, 0, 2784, 0, 2785, 0, 2786,
+    0, 2787, 0, 2788, 0, 2789, 2790, 2791, 2792, 0, 2793, 0, 0, 0, 0, 0, 0,
+    2794, 0, 0, 0, 0, 0, 2795, 0, 2796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1507, 1523, 1515, 2797, 0, 0, 2798,
+    2799, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398,
+    398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 400, 400, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 398, 398, 400, 0, 0, 398,
+    398, 0, 0, 0, 0, 0, 398, 398, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2800, 2801, 2802, 2803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2804, 0, 0, 0, 0,
+    0, 0, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815,
+    2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827,
+    2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839,
+    2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851,
+    2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863,
+    2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875,
+    2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2013,
+    2887, 2888, 2889, 2890, 2067, 2067, 2891, 2021, 2892, 2893, 2894, 2895,
+    2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907,
+    2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919,
+    2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931,
+    2932, 1979, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942,
+    2943, 2052, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953,
+    2954, 2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965,
+    2966, 2967, 2968, 2969, 2970, 2901, 2971, 2972, 2973, 2974, 2975, 2976,
+    2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988,
+    2989, 2990, 2015, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999,
+    3000, 3001, 3002, 3003, 3004, 3005, 1892, 3006, 3007, 3008, 3009, 3010,
+    3011, 3012, 3013, 1873, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021,
+    3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033,
+    3034, 3035, 2989, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 2973,
+    3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055,
+    3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 2901, 3064, 3065, 3066,
+    3067, 2066, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077,
+    3078, 3079, 2344, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088,
+    2975, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098, 3099,
+    3100, 3101, 2020, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110,
+    3111, 3112, 3113, 3114, 1971, 3115, 3116, 3117, 3118, 3119, 3120, 3121,
+    3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130, 1998, 3131, 2001,
+    3132, 3133, 3134, 0, 0, 3135, 0, 3136, 0, 0, 3137, 3138, 3139, 3140, 3141,
+    3142, 3143, 3144, 3145, 1978, 0, 3146, 0, 3147, 0, 0, 3148, 3149, 0, 0, 0,
+    3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161,
+    3162, 3163, 3164, 3165, 3166, 3167, 1899, 3168, 3169, 3170, 3171, 3172,
+    3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 2349, 3183,
+    3184, 3185, 3186, 2353, 3187, 3188, 3189, 3190, 3191, 3025, 3192, 3193,
+    3194, 3195, 3196, 3197, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204,
+    3205, 3148, 3206, 3207, 3208, 3209, 3210, 3211, 0, 0, 3212, 3213, 3214,
+    3215, 3216, 3217, 3218, 3219, 3162, 3220, 3221, 3222, 3135, 3223, 3224,
+    3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3170, 3235,
+    3171, 3236, 3237, 3238, 3239, 3240, 3136, 2922, 3241, 3242, 1932, 2990,
+    3073, 3243, 3244, 3178, 3245, 3179, 3246, 3247, 3248, 3138, 3249, 3250,
+    3251, 3252, 3253, 3139, 3254, 3255, 3256, 3257, 3258, 3259, 3191, 3260,
+    3261, 3025, 3262, 3195, 3263, 3264, 3265, 3266, 3267, 3200, 3268, 3147,
+    3269, 3201, 2971, 3270, 3202, 3271, 3204, 3272, 3273, 3274, 3275, 3276,
+    3206, 3144, 3277, 3207, 3278, 3208, 3279, 2067, 3280, 3281, 3282, 3283,
+    3284, 3285, 3286, 3287, 3288, 3289, 3290, 0, 0, 0, 0, 0, 0, 3291, 3292,
+    3293, 3294, 3295, 3296, 3296, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3297,
+    3298, 3299, 3300, 3301, 0, 0, 0, 0, 0, 3302, 3303, 3304, 3305, 1525, 1528,
+    3306, 3307, 3308, 3309, 3310, 3311, 1498, 3312, 3313, 3314, 3315, 3316,
+    3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 0, 3325, 3326, 3327, 3328,
+    3329, 0, 3330, 0, 3331, 3332, 0, 3333, 3334, 0, 3335, 3336, 3337, 3338,
+    3339, 3340, 3341, 3342, 3343, 3344, 3345, 3345, 3346, 3346, 3346, 3346,
+    3347, 3347, 3347, 3347, 3348, 3348, 3348, 3348, 3349, 3349, 3349, 3349,
+    3350, 3350, 3350, 3350, 3351, 3351, 3351, 3351, 3352, 3352, 3352, 3352,
+    3353, 3353, 3353, 3353, 3354, 3354, 3354, 3354, 3355, 3355, 3355, 3355,
+    3356, 3356, 3356, 3356, 3357, 3357, 3357, 3357, 3358, 3358, 3359, 3359,
+    3360, 3360, 3361, 3361, 3362, 3362, 3363, 3363, 3364, 3364, 3364, 3364,
+    3365, 3365, 3365, 3365, 3366, 3366, 3366, 3366, 3367, 3367, 3367, 3367,
+    3368, 3368, 3369, 3369, 3369, 3369, 3370, 3370, 3371, 3371, 3371, 3371,
+    3372, 3372, 3372, 3372, 3373, 3373, 3374, 3374, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3375, 3375, 3375, 3375, 3376, 3376, 3377, 3377, 3378, 3378, 745, 3379, 3379,
+    3380, 3380, 3381, 3381, 3382, 3382, 3382, 3382, 3383, 3383, 3384, 3384,
+    3385, 3385, 3386, 3386, 3387, 3387, 3388, 3388, 3389, 3389, 3390, 3390,
+    3390, 3391, 3391, 3391, 3392, 3392, 3392, 3392, 3393, 3394, 3395, 3391,
+    3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405, 3406, 3407,
+    3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419,
+    3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431,
+    3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440, 3441, 3442, 3443,
+    3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455,
+    3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467,
+    3468, 3469, 3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479,
+    3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490, 3491,
+    3492, 3493, 3395, 3494, 3391, 3396, 3495, 3496, 3400, 3497, 3401, 3402,
+    3498, 3499, 3406, 3500, 3407, 3408, 3501, 3502, 3410, 3503, 3411, 3412,
+    3441, 3442, 3445, 3446, 3447, 3451, 3452, 3453, 3454, 3458, 3459, 3460,
+    3504, 3464, 3505, 3506, 3470, 3507, 3471, 3472, 3485, 3508, 3509, 3480,
+    3510, 3481, 3482, 3393, 3394, 3511, 3395, 3512, 3397, 3398, 3399, 3400,
+    3513, 3403, 3404, 3405, 3406, 3514, 3410, 3413, 3414, 3415, 3416, 3417,
+    3419, 3420, 3421, 3422, 3423, 3424, 3515, 3425, 3426, 3427, 3428, 3429,
+    3430, 3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440, 3443, 3444,
+    3448, 3449, 3450, 3451, 3452, 3455, 3456, 3457, 3458, 3516, 3461, 3462,
+    3463, 3464, 3467, 3468, 3469, 3470, 3517, 3473, 3474, 3518, 3477, 3478,
+    3479, 3480, 3519, 3395, 3512, 3400, 3513, 3406, 3514, 3410, 3520, 3423,
+    3521, 3522, 3523, 3451, 3452, 3458, 3470, 3517, 3480, 3519, 3524, 3525,
+    3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3537,
+    3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549,
+    3522, 3550, 3551, 3552, 3553, 3527, 3528, 3529, 3530, 3531, 3532, 3533,
+    3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545,
+    3546, 3547, 3548, 3549, 3522, 3550, 3551, 3552, 3553, 3547, 3548, 3549,
+    3522, 3521, 3523, 3431, 3420, 3421, 3422, 3547, 3548, 3549, 3431, 3432,
+    3554, 3554, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3555,
+    3556, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3562, 3563, 3564, 3565,
+    3566, 3567, 3568, 3568, 3569, 3570, 3570, 3571, 3571, 3572, 3573, 3573,
+    3574, 3575, 3575, 3576, 3576, 3577, 3578, 3578, 3579, 3579, 3580, 3581,
+    3582, 3583, 3583, 3584, 3585, 3586, 3587, 3588, 3588, 3589, 3590, 3591,
+    3592, 3593, 3594, 3594, 3595, 3595, 3596, 3596, 3597, 3598, 3599, 3600,
+    3601, 3602, 3603, 0, 0, 3604, 3605, 3606, 3607, 3608, 3609, 3609, 3610,
+    3611, 3612, 3613, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621,
+    3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633,
+    3634, 3635, 3589, 3591, 3636, 3637, 3638, 3639, 3640, 3641, 3640, 3638,
+    3642, 3643, 3644, 3645, 3646, 3641, 3582, 3572, 3647, 3648, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3649, 3650, 3651, 3652, 3653, 3654, 3655,
+    3656, 3657, 3658, 0, 0, 3659, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3660, 3661, 3662, 3663, 419, 3664, 3665, 3666, 3667, 1481, 0, 0,
+    0, 0, 0, 0, 398, 398, 398, 398, 398, 398, 398, 400, 400, 400, 400, 400, 400,
+    400, 398, 398, 1480, 3668, 3669, 3670, 3670, 1501, 1502, 3671, 3672, 3673,
+    3674, 3675, 3676, 3677, 3678, 1625, 1626, 3679, 3680, 3681, 3682, 0, 0,
+    3683, 3684, 1487, 1487, 1487, 1487, 3670, 3670, 3670, 3660, 3661, 1479, 0,
+    419, 3663, 3665, 3664, 3668, 1501, 1502, 3671, 3672, 3673, 3674, 3685, 3686,
+    3687, 1498, 3688, 3689, 3690, 1500, 0, 3691, 3692, 3693, 3694, 0, 0, 0, 0,
+    3695, 3696, 3697, 0, 3698, 0, 3699, 3700, 3701, 3702, 3703, 3704, 3705,
+    3706, 3707, 3708, 3709, 3710, 3710, 3711, 3711, 3712, 3712, 3713, 3713,
+    3714, 3714, 3714, 3714, 3715, 3715, 3716, 3716, 3716, 3716, 3717, 3717,
+    3718, 3718, 3718, 3718, 3719, 3719, 3719, 3719, 3720, 3720, 3720, 3720,
+    3721, 3721, 3721, 3721, 3722, 3722, 3722, 3722, 3723, 3723, 3724, 3724,
+    3725, 3725, 3726, 3726, 3727, 3727, 3727, 3727, 3728, 3728, 3728, 3728,
+    3729, 3729, 3729, 3729, 3730, 3730, 3730, 3730, 3731, 3731, 3731, 3731,
+    3732, 3732, 3732, 3732, 3733, 3733, 3733, 3733, 3734, 3734, 3734, 3734,
+    3735, 3735, 3735, 3735, 3736, 3736, 3736, 3736, 3737, 3737, 3737, 3737,
+    3738, 3738, 3738, 3738, 3739, 3739, 3739, 3739, 3740, 3740, 3740, 3740,
+    3741, 3741, 3741, 3741, 3742, 3742, 3383, 3383, 3743, 3743, 3743, 3743,
+    3744, 3744, 3745, 3745, 3746, 3746, 3747, 3747, 0, 0, 0, 0, 3664, 3748,
+    3685, 3692, 3693, 3686, 3749, 1501, 1502, 3687, 1498, 3660, 3688, 1479,
+    3750, 1491, 37, 32, 33, 1492, 1493, 1494, 1495, 1496, 1497, 3663, 419, 3689,
+    1500, 3690, 3665, 3694, 3751, 3752, 3753, 3754, 3755, 3756, 3757, 3758,
+    3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770,
+    3771, 3772, 3773, 3774, 3775, 3776, 3683, 3691, 3684, 3777, 3670, 1465, 30,
+    932, 961, 933, 934, 964, 938, 377, 957, 379, 939, 393, 940, 1503, 38, 945,
+    1730, 380, 394, 946, 947, 950, 384, 395, 385, 991, 3671, 3778, 3672, 3779,
+    3780, 3781, 3662, 3679, 3680, 3661, 3782, 2452, 3783, 3784, 3785, 3786,
+    3787, 3788, 3789, 3790, 3791, 3792, 2406, 2407, 2408, 2409, 2410, 2411,
+    2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423,
+    2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435,
+    2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447,
+    2448, 2449, 3793, 3794, 3795, 2187, 2136, 2137, 2138, 2139, 2140, 2141,
+    2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153,
+    2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 0,
+    0, 0, 2166, 2167, 2168, 2169, 2170, 2171, 0, 0, 2172, 2173, 2174, 2175,
+    2176, 2177, 0, 0, 2178, 2179, 2180, 2181, 2182, 2183, 0, 0, 2184, 2185,
+    2186, 0, 0, 0, 3796, 3797, 3798, 31, 3799, 3800, 3801, 0, 3802, 3803, 3804,
+    3805, 3806, 3807, 3808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 400, 0, 0, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398, 398, 398, 0, 0, 0, 0, 0,
+    3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820,
+    3821, 3822, 3823, 3824, 3825, 3826, 3827, 3828, 3829, 3830, 3831, 3832,
+    3833, 3834, 3835, 3836, 3837, 3838, 3839, 3840, 3841, 3842, 3843, 3844,
+    3845, 3846, 3847, 3848, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3849,
+    3850, 3851, 3852, 3853, 3854, 3855, 3856, 3857, 3858, 3859, 3860, 3861,
+    3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870, 3871, 3872, 3873,
+    3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3885, 3886, 3887, 3888, 3889, 3890, 3891, 3892, 3893, 3894, 3895, 0, 3896,
+    3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908,
+    3909, 3910, 0, 3911, 3912, 3913, 3914, 3915, 3916, 3917, 0, 3918, 3919, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3920, 3921, 3922, 3923, 3924, 0, 3925, 3926,
+    3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937, 3938,
+    1513, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947, 3948, 3949,
+    3950, 3951, 3952, 3953, 1730, 3954, 3955, 3956, 3957, 3958, 3959, 3960,
+    3961, 3962, 3963, 3964, 0, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972,
+    3973, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 400, 0, 398, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 405, 400, 0, 0, 0, 0, 755, 0,
+    0, 0, 0, 0, 398, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982,
+    3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994,
+    3995, 3996, 3997, 3998, 3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006,
+    4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018,
+    4019, 4020, 4021, 4022, 4023, 4024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 398, 398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 400,
+    400, 398, 398, 398, 400, 398, 400, 400, 400, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 398, 400, 398, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4025, 0, 4026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4027, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 754, 0, 0, 0, 0, 0, 398, 398, 398, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 755, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 764, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 764, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 764, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 764, 764, 0, 765, 0, 0, 0, 0, 0, 0, 0, 398,
+    398, 398, 398, 398, 398, 398, 0, 0, 0, 398, 398, 398, 398, 398, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 765, 0, 0, 765, 0, 0, 0,
+    0, 755, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 765, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 755, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 764, 0, 0,
+    0, 0, 0, 4028, 4029, 4030, 4031, 4032, 4033, 4034, 4035, 4036, 4037, 4038,
+    4039, 4040, 4041, 4042, 4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050,
+    4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058, 4059, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755,
+    755, 0, 0, 0, 0, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0,
+    0, 764, 0, 755, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 405, 405, 405, 405, 405, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398, 398, 398,
+    398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4060, 4061, 4062, 4063, 4064, 4065,
+    4066, 4067, 4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077,
+    4078, 4079, 4080, 4081, 4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089,
+    4090, 4091, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4092, 4092, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 405, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4093, 4094, 4095, 4096, 4097, 4098, 4099, 791, 791, 405, 405, 405, 0, 0, 0,
+    4100, 791, 791, 791, 791, 791, 0, 0, 0, 0, 0, 0, 0, 0, 400, 400, 400, 400,
+    400, 400, 400, 400, 0, 0, 398, 398, 398, 398, 398, 400, 400, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    398, 398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4101, 4102, 4103,
+    4104, 4105, 4106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 908, 910,
+    1507, 911, 912, 1523, 914, 915, 916, 917, 918, 919, 920, 921, 922, 924,
+    1515, 925, 4107, 926, 927, 1796, 928, 4108, 4109, 1519, 30, 932, 961, 933,
+    934, 964, 938, 377, 957, 379, 939, 393, 940, 1503, 38, 945, 1730, 380, 394,
+    946, 947, 950, 384, 395, 385, 991, 908, 910, 1507, 911, 912, 1523, 914, 915,
+    916, 917, 918, 919, 920, 921, 922, 924, 1515, 925, 4107, 926, 927, 1796,
+    928, 4108, 4109, 1519, 30, 932, 961, 933, 934, 964, 938, 0, 957, 379, 939,
+    393, 940, 1503, 38, 945, 1730, 380, 394, 946, 947, 950, 384, 395, 385, 991,
+    908, 910, 1507, 911, 912, 1523, 914, 915, 916, 917, 918, 919, 920, 921, 922,
+    924, 1515, 925, 4107, 926, 927, 1796, 928, 4108, 4109, 1519, 30, 932, 961,
+    933, 934, 964, 938, 377, 957, 379, 939, 393, 940, 1503, 38, 945, 1730, 380,
+    394, 946, 947, 950, 384, 395, 385, 991, 908, 0, 1507, 911, 0, 0, 914, 0, 0,
+    917, 918, 0, 0, 921, 922, 924, 1515, 0, 4107, 926, 927, 1796, 928, 4108,
+    4109, 1519, 30, 932, 961, 933, 0, 964, 0, 377, 957, 379, 939, 393, 940,
+    1503, 0, 945, 1730, 380, 394, 946, 947, 950, 384, 395, 385, 991, 908, 910,
+    1507, 911, 912, 1523, 914, 915, 916, 917, 918, 919, 920, 921, 922, 924,
+    1515, 925, 4107, 926, 927, 1796, 928, 4108, 4109, 1519, 30, 932, 961, 933,
+    934, 964, 938, 377, 957, 379, 939, 393, 940, 1503, 38, 945, 1730, 380, 394,
+    946, 947, 950, 384, 395, 385, 991, 908, 910, 0, 911, 912, 1523, 914, 0, 0,
+    917, 918, 919, 920, 921, 922, 924, 1515, 0, 4107, 926, 927, 1796, 928, 4108,
+    4109, 0, 30, 932, 961, 933, 934, 964, 938, 377, 957, 379, 939, 393, 940,
+    1503, 38, 945, 1730, 380, 394, 946, 947, 950, 384, 395, 385, 991, 908, 910,
+    0, 911, 912, 1523, 914, 0, 916, 917, 918, 919, 920, 0, 922, 0, 0, 0, 4107,
+    926, 927, 1796, 928, 4108, 4109, 0, 30, 932, 961, 933, 934, 964, 938, 377,
+    957, 379, 939, 393, 940, 1503, 38, 945, 1730, 380, 394, 946, 947, 950, 384,
+    395, 385, 991, 908, 910, 1507, 911, 912, 1523, 914, 915, 916, 917, 918, 919,
+    920, 921, 922, 924, 1515, 925, 4107, 926, 927, 1796, 928, 4108, 4109, 1519,
+    30, 932, 961, 933, 934, 964, 938, 377, 957, 379, 939, 393, 940, 1503, 38,
+    945, 1730, 380, 394, 946, 947, 950, 384, 395, 385, 991, 920, 921, 922, 924,
+    1515, 925, 4107, 926, 927, 1796, 928, 4108, 4109, 1519, 30, 932, 961, 933,
+    934, 964, 938, 377, 957, 379, 939, 393, 940, 1503, 38, 945, 1730, 380, 4109,
+    1519, 30, 932, 961, 933, 934, 964, 938, 377, 957, 379, 939, 393, 940, 1503,
+    38, 945, 1730, 380, 394, 946, 947, 950, 384, 395, 385, 991, 908, 910, 1507,
+    911, 912, 1523, 914, 915, 916, 917, 918, 919, 920, 921, 922, 924, 1515, 925,
+    4107, 926, 927, 1796, 928, 4108, 4109, 1519, 30, 932, 961, 933, 934, 964,
+    938, 377, 957, 379, 939, 393, 940, 1503, 38, 945, 1730, 380, 394, 946, 947,
+    950, 384, 395, 385, 991, 908, 910, 1507, 911, 912, 1523, 914, 915, 916, 917,
+    918, 919, 920, 921, 922, 924, 384, 395, 385, 991, 4110, 4111, 0, 0, 4112,
+    4113, 1531, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123,
+    4124, 4125, 1532, 4126, 4118, 4127, 4128, 470, 4129, 4130, 4131, 4132, 4133,
+    4134, 952, 953, 954, 4135, 4136, 4137, 995, 4138, 4139, 4140, 4141, 4142,
+    4143, 4144, 1530, 958, 489, 4145, 4146, 4147, 955, 956, 4148, 4149, 4150,
+    4135, 995, 4139, 955, 958, 1530, 4112, 4113, 1531, 4114, 4115, 4116, 4117,
+    4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 1532, 4126, 4118, 4127,
+    4128, 470, 4129, 4130, 4131, 4132, 4133, 4134, 952, 953, 954, 4135, 4136,
+    4137, 995, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 1530, 958, 489, 4145,
+    4146, 4147, 955, 956, 4148, 4149, 4150, 4135, 995, 4139, 955, 958, 1530,
+    4112, 4113, 1531, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122,
+    4123, 4124, 4125, 1532, 4126, 4118, 4127, 4128, 470, 4129, 4130, 4131, 4132,
+    4133, 4134, 952, 953, 954, 4135, 4136, 4137, 995, 4138, 4139, 4140, 4141,
+    4142, 4143, 4144, 1530, 958, 489, 4145, 4146, 4147, 955, 956, 4148, 4149,
+    4150, 4135, 995, 4139, 955, 958, 1530, 4112, 4113, 1531, 4114, 4115, 4116,
+    4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 1532, 4126, 4118,
+    4127, 4128, 470, 4129, 4130, 4131, 4132, 4133, 4134, 952, 953, 954, 4135,
+    4136, 4137, 995, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 1530, 958, 489,
+    4145, 4146, 4147, 955, 956, 4148, 4149, 4150, 4135, 995, 4139, 955, 958,
+    1530, 4112, 4113, 1531, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121,
+    4122, 4123, 4124, 4125, 1532, 4126, 4118, 4127, 4128, 470, 4129, 4130, 4131,
+    4132, 4133, 4134, 952, 953, 954, 4135, 4136, 4137, 995, 4138, 4139, 4140,
+    4141, 4142, 4143, 4144, 1530, 958, 489, 4145, 4146, 4147, 955, 956, 4148,
+    4149, 4150, 4135, 995, 4139, 955, 958, 1530, 4151, 4152, 0, 0, 1491, 37, 32,
+    33, 1492, 1493, 1494, 1495, 1496, 1497, 1491, 37, 32, 33, 1492, 1493, 1494,
+    1495, 1496, 1497, 1491, 37, 32, 33, 1492, 1493, 1494, 1495, 1496, 1497,
+    1491, 37, 32, 33, 1492, 1493, 1494, 1495, 1496, 1497, 1491, 37, 32, 33,
+    1492, 1493, 1494, 1495, 1496, 1497, 398, 398, 398, 398, 398, 398, 398, 0,
+    398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 0, 0, 398, 398, 398, 398, 398, 398, 398, 0, 398, 398, 0, 398, 398,
+    398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398,
+    398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 400, 400, 400, 400, 400, 400, 400, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160, 4161, 4162, 4163,
+    4164, 4165, 4166, 4167, 4168, 4169, 4170, 4171, 4172, 4173, 4174, 4175,
+    4176, 4177, 4178, 4179, 4180, 4181, 4182, 4183, 4184, 4185, 4186, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 398, 398, 398, 398, 398, 398, 764, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3715, 3716, 3720, 3723, 0, 3742,
+    3726, 3721, 3731, 3743, 3737, 3738, 3739, 3740, 3727, 3733, 3735, 3729,
+    3736, 3725, 3728, 3718, 3719, 3722, 3724, 3730, 3732, 3734, 4187, 3368,
+    4188, 4189, 0, 3716, 3720, 0, 3741, 0, 0, 3721, 0, 3743, 3737, 3738, 3739,
+    3740, 3727, 3733, 3735, 3729, 3736, 0, 3728, 3718, 3719, 3722, 0, 3730, 0,
+    3734, 0, 0, 0, 0, 0, 0, 3720, 0, 0, 0, 0, 3721, 0, 3743, 0, 3738, 0, 3740,
+    3727, 3733, 0, 3729, 3736, 0, 3728, 0, 0, 3722, 0, 3730, 0, 3734, 0, 3368,
+    0, 4189, 0, 3716, 3720, 0, 3741, 0, 0, 3721, 3731, 3743, 3737, 0, 3739,
+    3740, 3727, 3733, 3735, 3729, 3736, 0, 3728, 3718, 3719, 3722, 0, 3730,
+    3732, 3734, 4187, 0, 4188, 0, 3715, 3716, 3720, 3723, 3741, 3742, 3726,
+    3721, 3731, 3743, 0, 3738, 3739, 3740, 3727, 3733, 3735, 3729, 3736, 3725,
+    3728, 3718, 3719, 3722, 3724, 3730, 3732, 3734, 0, 0, 0, 0, 0, 3716, 3720,
+    3723, 0, 3742, 3726, 3721, 3731, 3743, 0, 3738, 3739, 3740, 3727, 3733,
+    3735, 3729, 3736, 3725, 3728, 3718, 3719, 3722, 3724, 3730, 3732, 3734, 0,
+    0, 0, 0, 4190, 4191, 4192, 4193, 4194, 4195, 4196, 4197, 4198, 4199, 4200,
+    0, 0, 0, 0, 0, 4201, 4202, 4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210,
+    4211, 4212, 4213, 4214, 4215, 4216, 4217, 4218, 4219, 4220, 4221, 4222,
+    4223, 4224, 4225, 4226, 4227, 1507, 925, 4228, 4229, 0, 908, 910, 1507, 911,
+    912, 1523, 914, 915, 916, 917, 918, 919, 920, 921, 922, 924, 1515, 925,
+    4107, 926, 927, 1796, 928, 4108, 4109, 1519, 4230, 2602, 4231, 4232, 4233,
+    4234, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4235, 4236, 4237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4238, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4239, 4240, 2416, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1918, 4241, 4242, 4243, 1861, 4244, 4245, 2238, 4246, 4247,
+    4248, 3063, 4249, 4250, 4251, 4252, 4253, 4254, 1954, 4255, 4256, 4257,
+    4258, 4259, 4260, 1855, 2230, 4261, 2365, 2233, 2366, 4262, 2010, 4263,
+    4264, 4265, 4266, 4267, 2348, 1928, 4268, 4269, 4270, 4271, 0, 0, 0, 0,
+    4272, 4273, 4274, 4275, 4276, 4277, 4278, 4279, 4280, 0, 0, 0, 0, 0, 0, 0,
+    4281, 4282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1491, 37, 32, 33, 1492, 1493, 1494, 1495, 1496,
+    1497, 0, 0, 0, 0, 0, 0, 4283, 4284, 4285, 4286, 4287, 3156, 4288, 4289,
+    4290, 4291, 3157, 4292, 4293, 4294, 3158, 4295, 4296, 4297, 4298, 4299,
+    4300, 4251, 4301, 4302, 4303, 4304, 4305, 3213, 4306, 1871, 4307, 4308,
+    4309, 4310, 4269, 4311, 4312, 3218, 3159, 3160, 3219, 4313, 4314, 2977,
+    4315, 3161, 4316, 4317, 4318, 4319, 4319, 4319, 4320, 4321, 4322, 4323,
+    4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333, 4334, 4335,
+    4336, 4337, 4337, 3221, 4338, 4339, 4340, 4341, 3163, 4342, 4343, 4344,
+    3123, 4345, 4346, 4347, 4348, 4349, 4350, 4351, 4352, 4353, 4354, 4355,
+    4356, 4244, 4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365, 4366,
+    4367, 4368, 4369, 4369, 4370, 4371, 4372, 2973, 4373, 4374, 4375, 4376,
+    4377, 1897, 4378, 4379, 1899, 4380, 4381, 4382, 4383, 4384, 4385, 4386,
+    4387, 4388, 4389, 4390, 4391, 4392, 4393, 4394, 4395, 4396, 4397, 4398,
+    4399, 4400, 2921, 4401, 1909, 4402, 4402, 4403, 4404, 4404, 4405, 4406,
+    4407, 4408, 4409, 4410, 4411, 4412, 4413, 4414, 4415, 4416, 4417, 3168,
+    4418, 4419, 4420, 4421, 3233, 4421, 4422, 3170, 4423, 4424, 4425, 4426,
+    3171, 2894, 4427, 4428, 4429, 4430, 4431, 4432, 4433, 4434, 4435, 4436,
+    4437, 4438, 4439, 4440, 4441, 4442, 4443, 4444, 4445, 4446, 4447, 4448,
+    3172, 4449, 4450, 4451, 4452, 4453, 4454, 3174, 4455, 4456, 4457, 4458,
+    4459, 4460, 4461, 4462, 2922, 3241, 4463, 4464, 4465, 4466, 4467, 4468,
+    4469, 4470, 3175, 4471, 4472, 4473, 4474, 3283, 4475, 4476, 4477, 4478,
+    4479, 4480, 4481, 4482, 4483, 4484, 4485, 4486, 4487, 2990, 4488, 4489,
+    4490, 4491, 4492, 4493, 4494, 4495, 4496, 4497, 4498, 3176, 3073, 4499,
+    4500, 4501, 4502, 4503, 4504, 4505, 4506, 3244, 4507, 4508, 4509, 4510,
+    4511, 4512, 4513, 4514, 3245, 4515, 4516, 4517, 4518, 4519, 4520, 4521,
+    4522, 4523, 4524, 4525, 4526, 3247, 4527, 4528, 4529, 4530, 4531, 4532,
+    4533, 4534, 4535, 4536, 4537, 4537, 4538, 4539, 3249, 4540, 4541, 4542,
+    4543, 4544, 4545, 4546, 2976, 4547, 4548, 4549, 4550, 4551, 4552, 4553,
+    3255, 4554, 4555, 4556, 4557, 4558, 4559, 4559, 3256, 3285, 4560, 4561,
+    4562, 4563, 4564, 2939, 3258, 4565, 4566, 3186, 4567, 4568, 3143, 4569,
+    4570, 3189, 4571, 4572, 4573, 4574, 4574, 4575, 4576, 4577, 4578, 4579,
+    4580, 4581, 4582, 4583, 4584, 4585, 4586, 4587, 4588, 4589, 4590, 4591,
+    4592, 4593, 4594, 4595, 4596, 4597, 4598, 4599, 4600, 4601, 3195, 4602,
+    4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613, 4614,
+    4615, 4616, 4617, 4403, 4618, 4619, 4620, 4621, 4622, 4623, 4624, 4625,
+    4626, 4627, 4628, 4629, 2993, 4630, 4631, 4632, 4633, 4634, 4635, 3198,
+    4636, 4637, 4638, 4639, 4640, 4641, 4642, 4643, 4644, 4645, 4646, 4647,
+    4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655, 2934, 4656, 4657, 4658,
+    4659, 4660, 4661, 3265, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669,
+    1999, 4670, 4671, 4672, 4673, 4674, 4675, 4676, 4677, 4678, 4679, 4680,
+    3270, 3271, 2006, 4681, 4682, 4683, 4684, 4685, 4686, 4687, 4688, 4689,
+    4690, 4691, 4692, 3272, 4693, 4694, 4695, 4696, 4697, 4698, 4699, 4700,
+    4701, 4702, 4703, 4704, 4705, 4706, 4707, 4708, 4709, 4710, 4711, 4712,
+    4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 3278, 3278,
+    4723, 4724, 4725, 4726, 4727, 4728, 4729, 4730, 4731, 4732, 3279, 4733,
+    4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 2054, 4743, 2058,
+    4744, 4745, 4746, 4747, 2063, 4748, 0, 0,
+};
+
+const UnicodeRecord unicode_records[] = {
+    {0, 0, {0, 0, 0}, 0}, {0, 1, {0, 0, 0}, 0}, {0, 0, {0, 1, 1}, 0},
+    {0, 0, {0, 3, 3}, 0}, {0, 0, {0, 5, 5}, 0}, {0, 0, {0, 7, 7}, 0},
+    {0, 0, {0, 9, 9}, 0}, {0, 0, {0, 11, 11}, 0}, {0, 0, {0, 13, 13}, 0},
+    {0, 0, {0, 15, 15}, 0}, {0, 0, {0, 17, 17}, 0}, {0, 0, {0, 19, 19}, 0},
+    {0, 0, {0, 21, 21}, 0}, {0, 0, {0, 23, 23}, 0}, {0, 0, {0, 25, 25}, 0},
+    {0, 0, {0, 27, 27}, 0}, {0, 0, {0, 29, 29}, 0}, {0, 0, {0, 31, 31}, 0},
+    {0, 0, {0, 33, 33}, 0}, {0, 0, {0, 35, 35}, 0}, {0, 0, {0, 37, 37}, 0},
+    {0, 0, {0, 39, 39}, 0}, {0, 0, {0, 41, 41}, 0}, {0, 0, {0, 43, 43}, 0},
+    {0, 0, {0, 45, 45}, 0}, {0, 0, {0, 47, 47}, 0}, {0, 0, {0, 49, 49}, 0},
+    {0, 0, {0, 51, 51}, 0}, {0, 1, {53, 0, 53}, 0}, {0, 0, {55, 0, 55}, 0},
+    {0, 0, {1, 0, 1}, 0}, {0, 0, {58, 0, 58}, 0}, {0, 0, {61, 0, 61}, 0},
+    {0, 0, {63, 0, 63}, 0}, {0, 0, {65, 0, 65}, 0}, {0, 0, {68, 68, 68}, 0},
+    {0, 0, {70, 0, 70}, 0}, {0, 0, {73, 0, 73}, 0}, {0, 0, {29, 0, 29}, 0},
+    {0, 0, {75, 0, 75}, 0}, {0, 0, {79, 0, 79}, 0}, {0, 0, {83, 0, 83}, 0},
+    {0, 0, {0, 87, 87}, 89}, {0, 0, {0, 92, 92}, 94}, {0, 0, {0, 97, 97}, 99},
+    {0, 0, {0, 102, 102}, 104}, {0, 0, {0, 107, 107}, 109},
+    {0, 0, {0, 112, 112}, 114}, {0, 0, {0, 117, 117}, 0},
+    {0, 0, {0, 119, 119}, 121}, {0, 0, {0, 124, 124}, 126},
+    {0, 0, {0, 129, 129}, 131}, {0, 0, {0, 134, 134}, 136},
+    {0, 0, {0, 139, 139}, 141}, {0, 0, {0, 144, 144}, 146},
+    {0, 0, {0, 149, 149}, 151}, {0, 0, {0, 154, 154}, 156},
+    {0, 0, {0, 159, 159}, 161}, {0, 0, {0, 164, 164}, 0},
+    {0, 0, {0, 166, 166}, 168}, {0, 0, {0, 171, 171}, 173},
+    {0, 0, {0, 176, 176}, 178}, {0, 0, {0, 181, 181}, 183},
+    {0, 0, {0, 186, 186}, 188}, {0, 0, {0, 191, 191}, 193},
+    {0, 0, {0, 196, 196}, 0}, {0, 0, {0, 198, 198}, 200},
+    {0, 0, {0, 203, 203}, 205}, {0, 0, {0, 208, 208}, 210},
+    {0, 0, {0, 213, 213}, 215}, {0, 0, {0, 218, 218}, 220},
+    {0, 0, {0, 223, 223}, 0}, {0, 0, {0, 225, 225}, 0}, {0, 0, {0, 0, 0}, 228},
+    {0, 0, {0, 0, 0}, 231}, {0, 0, {0, 0, 0}, 234}, {0, 0, {0, 0, 0}, 237},
+    {0, 0, {0, 0, 0}, 240}, {0, 0, {0, 0, 0}, 243}, {0, 0, {0, 0, 0}, 246},
+    {0, 0, {0, 0, 0}, 249}, {0, 0, {0, 0, 0}, 252}, {0, 0, {0, 0, 0}, 255},
+    {0, 0, {0, 0, 0}, 258}, {0, 0, {0, 0, 0}, 261}, {0, 0, {0, 0, 0}, 264},
+    {0, 0, {0, 0, 0}, 267}, {0, 0, {0, 0, 0}, 270}, {0, 0, {0, 0, 0}, 273},
+    {0, 0, {0, 0, 0}, 276}, {0, 0, {0, 0, 0}, 279}, {0, 0, {0, 0, 0}, 282},
+    {0, 0, {0, 0, 0}, 285}, {0, 0, {0, 0, 0}, 288}, {0, 0, {0, 0, 0}, 291},
+    {0, 0, {0, 0, 0}, 294}, {0, 0, {0, 0, 0}, 297}, {0, 0, {0, 0, 0}, 300},
+    {0, 0, {0, 0, 0}, 303}, {0, 0, {0, 0, 0}, 306}, {0, 0, {0, 309, 309}, 311},
+    {0, 0, {0, 0, 0}, 314}, {0, 0, {0, 317, 317}, 319}, {0, 0, {0, 0, 0}, 322},
+    {0, 0, {0, 325, 325}, 327}, {0, 0, {0, 0, 0}, 330},
+    {0, 0, {0, 333, 333}, 335}, {0, 0, {0, 0, 0}, 338},
+    {0, 0, {0, 341, 341}, 343}, {0, 0, {0, 0, 0}, 346},
+    {0, 0, {0, 349, 349}, 351}, {0, 0, {0, 0, 0}, 354},
+    {0, 0, {0, 357, 357}, 359}, {0, 0, {0, 0, 0}, 362},
+    {0, 0, {0, 365, 365}, 367}, {0, 0, {0, 0, 0}, 370},
+    {0, 0, {0, 373, 373}, 0}, {0, 0, {0, 375, 375}, 377},
+    {0, 0, {0, 0, 0}, 380}, {0, 0, {0, 383, 383}, 385}, {0, 0, {0, 0, 0}, 388},
+    {0, 0, {0, 391, 391}, 393}, {0, 0, {0, 0, 0}, 396},
+    {0, 0, {0, 399, 399}, 401}, {0, 0, {0, 0, 0}, 404},
+    {0, 0, {0, 407, 407}, 409}, {0, 0, {0, 0, 0}, 412},
+    {0, 0, {0, 415, 415}, 417}, {0, 0, {0, 0, 0}, 420},
+    {0, 0, {0, 423, 423}, 425}, {0, 0, {0, 0, 0}, 428},
+    {0, 0, {0, 431, 431}, 433}, {0, 0, {0, 0, 0}, 436},
+    {0, 0, {0, 439, 439}, 441}, {0, 0, {0, 0, 0}, 444},
+    {0, 0, {0, 447, 447}, 449}, {0, 0, {0, 0, 0}, 452},
+    {0, 0, {0, 455, 455}, 0}, {0, 0, {0, 457, 457}, 459},
+    {0, 0, {0, 0, 0}, 462}, {0, 0, {0, 465, 465}, 467}, {0, 0, {0, 0, 0}, 470},
+    {0, 0, {0, 473, 473}, 475}, {0, 0, {0, 0, 0}, 478},
+    {0, 0, {0, 481, 481}, 483}, {0, 0, {0, 0, 0}, 486},
+    {0, 0, {0, 489, 489}, 492}, {0, 0, {495, 498, 500}, 0},
+    {0, 0, {500, 0, 500}, 0}, {0, 0, {0, 503, 503}, 505},
+    {0, 0, {0, 0, 0}, 508}, {0, 0, {0, 511, 511}, 513}, {0, 0, {0, 0, 0}, 516},
+    {0, 0, {0, 519, 519}, 521}, {0, 0, {0, 0, 0}, 524},
+    {0, 0, {0, 527, 527}, 529}, {0, 0, {0, 0, 0}, 532},
+    {0, 0, {0, 535, 535}, 537}, {0, 0, {0, 0, 0}, 540},
+    {0, 0, {543, 546, 548}, 0}, {0, 0, {548, 0, 548}, 0},
+    {0, 0, {0, 551, 551}, 0}, {0, 0, {0, 553, 553}, 555},
+    {0, 0, {0, 0, 0}, 558}, {0, 0, {0, 561, 561}, 563}, {0, 0, {0, 0, 0}, 566},
+    {0, 0, {0, 569, 569}, 571}, {0, 0, {0, 0, 0}, 574},
+    {0, 0, {577, 577, 577}, 0}, {0, 0, {0, 580, 580}, 0},
+    {0, 0, {0, 582, 582}, 584}, {0, 0, {0, 0, 0}, 587},
+    {0, 0, {0, 590, 590}, 592}, {0, 0, {0, 0, 0}, 595},
+    {0, 0, {0, 598, 598}, 600}, {0, 0, {0, 0, 0}, 603},
+    {0, 0, {0, 606, 606}, 0}, {0, 0, {0, 608, 608}, 610},
+    {0, 0, {0, 0, 0}, 613}, {0, 0, {0, 616, 616}, 618}, {0, 0, {0, 0, 0}, 621},
+    {0, 0, {0, 624, 624}, 626}, {0, 0, {0, 0, 0}, 629},
+    {0, 0, {0, 632, 632}, 634}, {0, 0, {0, 0, 0}, 637},
+    {0, 0, {0, 640, 640}, 642}, {0, 0, {0, 0, 0}, 645},
+    {0, 0, {0, 648, 648}, 650}, {0, 0, {0, 0, 0}, 653},
+    {0, 0, {0, 656, 656}, 658}, {0, 0, {0, 0, 0}, 661},
+    {0, 0, {0, 664, 664}, 666}, {0, 0, {0, 0, 0}, 669},
+    {0, 0, {0, 672, 672}, 674}, {0, 0, {0, 0, 0}, 677},
+    {0, 0, {0, 680, 680}, 0}, {0, 0, {0, 682, 682}, 684},
+    {0, 0, {0, 0, 0}, 687}, {0, 0, {0, 690, 690}, 692}, {0, 0, {0, 0, 0}, 695},
+    {0, 0, {0, 698, 698}, 700}, {0, 0, {0, 0, 0}, 703},
+    {0, 0, {0, 706, 706}, 708}, {0, 0, {0, 0, 0}, 711},
+    {0, 0, {0, 714, 714}, 716}, {0, 0, {0, 0, 0}, 719},
+    {0, 0, {0, 722, 722}, 724}, {0, 0, {0, 0, 0}, 727},
+    {0, 0, {0, 730, 730}, 732}, {0, 0, {0, 0, 0}, 735},
+    {0, 0, {0, 738, 738}, 740}, {0, 0, {0, 0, 0}, 743},
+    {0, 0, {0, 746, 746}, 748}, {0, 0, {0, 751, 751}, 753},
+    {0, 0, {0, 0, 0}, 756}, {0, 0, {0, 759, 759}, 761}, {0, 0, {0, 0, 0}, 764},
+    {0, 0, {0, 767, 767}, 769}, {0, 0, {0, 0, 0}, 772}, {0, 0, {37, 37, 37}, 0},
+    {0, 0, {0, 775, 775}, 0}, {0, 0, {0, 777, 777}, 0},
+    {0, 0, {0, 779, 779}, 0}, {0, 0, {0, 781, 781}, 0},
+    {0, 0, {0, 783, 783}, 0}, {0, 0, {0, 785, 785}, 0},
+    {0, 0, {0, 787, 787}, 0}, {0, 0, {0, 789, 789}, 0},
+    {0, 0, {0, 791, 791}, 0}, {0, 0, {0, 793, 793}, 0},
+    {0, 0, {0, 795, 795}, 0}, {0, 0, {0, 797, 797}, 0},
+    {0, 0, {0, 799, 799}, 0}, {0, 0, {0, 801, 801}, 0},
+    {0, 0, {0, 803, 803}, 0}, {0, 0, {0, 805, 805}, 0},
+    {0, 0, {0, 807, 807}, 0}, {0, 0, {0, 809, 809}, 0},
+    {0, 0, {0, 811, 811}, 0}, {0, 0, {0, 813, 813}, 0},
+    {0, 0, {0, 815, 815}, 817}, {0, 0, {0, 0, 0}, 820},
+    {0, 0, {0, 823, 823}, 0}, {0, 0, {0, 825, 825}, 0},
+    {0, 0, {0, 827, 827}, 0}, {0, 0, {0, 829, 829}, 0},
+    {0, 0, {0, 831, 831}, 0}, {0, 0, {0, 833, 833}, 0},
+    {0, 0, {0, 835, 835}, 0}, {0, 0, {0, 837, 837}, 839},
+    {0, 0, {0, 0, 0}, 842}, {0, 0, {0, 845, 845}, 0}, {0, 0, {0, 847, 847}, 0},
+    {0, 0, {0, 849, 849}, 0}, {0, 0, {0, 851, 851}, 0},
+    {0, 0, {0, 853, 853}, 0}, {0, 0, {0, 855, 855}, 0},
+    {0, 0, {0, 857, 857}, 0}, {0, 0, {859, 862, 864}, 0},
+    {0, 0, {867, 862, 864}, 0}, {0, 0, {864, 0, 864}, 0},
+    {0, 0, {870, 873, 875}, 0}, {0, 0, {878, 873, 875}, 0},
+    {0, 0, {875, 0, 875}, 0}, {0, 0, {881, 884, 886}, 0},
+    {0, 0, {889, 884, 886}, 0}, {0, 0, {886, 0, 886}, 0},
+    {0, 0, {0, 892, 892}, 894}, {0, 0, {0, 0, 0}, 897},
+    {0, 0, {0, 900, 900}, 902}, {0, 0, {0, 0, 0}, 905},
+    {0, 0, {0, 908, 908}, 910}, {0, 0, {0, 0, 0}, 913},
+    {0, 0, {0, 916, 916}, 918}, {0, 0, {0, 0, 0}, 921},
+    {0, 0, {0, 924, 924}, 926}, {0, 0, {0, 0, 0}, 930},
+    {0, 0, {0, 934, 934}, 936}, {0, 0, {0, 0, 0}, 940},
+    {0, 0, {0, 944, 944}, 946}, {0, 0, {0, 0, 0}, 950},
+    {0, 0, {0, 954, 954}, 956}, {0, 0, {0, 0, 0}, 960},
+    {0, 0, {0, 964, 964}, 966}, {0, 0, {0, 0, 0}, 970},
+    {0, 0, {0, 974, 974}, 976}, {0, 0, {0, 0, 0}, 980},
+    {0, 0, {0, 984, 984}, 986}, {0, 0, {0, 0, 0}, 989},
+    {0, 0, {0, 992, 992}, 0}, {0, 0, {0, 994, 994}, 996},
+    {0, 0, {0, 0, 0}, 999}, {0, 0, {0, 1002, 1002}, 1004},
+    {0, 0, {0, 0, 0}, 1007}, {0, 0, {0, 1010, 1010}, 1012},
+    {0, 0, {0, 0, 0}, 1015}, {0, 0, {0, 1018, 1018}, 1020},
+    {0, 0, {0, 0, 0}, 1024}, {0, 0, {0, 1028, 1028}, 1030},
+    {0, 0, {0, 0, 0}, 1033}, {0, 0, {0, 1036, 0}, 1036},
+    {0, 0, {1039, 1042, 1044}, 0}, {0, 0, {1047, 1042, 1044}, 0},
+    {0, 0, {1044, 0, 1044}, 0}, {0, 0, {0, 1050, 1050}, 1052},
+    {0, 0, {0, 0, 0}, 1055}, {0, 0, {0, 1058, 1058}, 0},
+    {0, 0, {0, 1060, 1060}, 0}, {0, 0, {0, 1062, 1062}, 1064},
+    {0, 0, {0, 0, 0}, 1067}, {0, 0, {0, 1070, 1070}, 1072},
+    {0, 0, {0, 0, 0}, 1076}, {0, 0, {0, 1080, 1080}, 1082},
+    {0, 0, {0, 0, 0}, 1085}, {0, 0, {0, 1088, 1088}, 1090},
+    {0, 0, {0, 0, 0}, 1093}, {0, 0, {0, 1096, 1096}, 1098},
+    {0, 0, {0, 0, 0}, 1101}, {0, 0, {0, 1104, 1104}, 1106},
+    {0, 0, {0, 0, 0}, 1109}, {0, 0, {0, 1112, 1112}, 1114},
+    {0, 0, {0, 0, 0}, 1117}, {0, 0, {0, 1120, 1120}, 1122},
+    {0, 0, {0, 0, 0}, 1125}, {0, 0, {0, 1128, 1128}, 1130},
+    {0, 0, {0, 0, 0}, 1133}, {0, 0, {0, 1136, 1136}, 1138},
+    {0, 0, {0, 0, 0}, 1141}, {0, 0, {0, 1144, 1144}, 1146},
+    {0, 0, {0, 0, 0}, 1149}, {0, 0, {0, 1152, 1152}, 1154},
+    {0, 0, {0, 0, 0}, 1157}, {0, 0, {0, 1160, 1160}, 1162},
+    {0, 0, {0, 0, 0}, 1165}, {0, 0, {0, 1168, 1168}, 1170},
+    {0, 0, {0, 0, 0}, 1173}, {0, 0, {0, 1176, 1176}, 1178},
+    {0, 0, {0, 0, 0}, 1181}, {0, 0, {0, 1184, 1184}, 1186},
+    {0, 0, {0, 0, 0}, 1189}, {0, 0, {0, 1192, 1192}, 1194},
+    {0, 0, {0, 0, 0}, 1197}, {0, 0, {0, 1200, 1200}, 1202},
+    {0, 0, {0, 0, 0}, 1205}, {0, 0, {0, 1208, 1208}, 0},
+    {0, 0, {0, 1210, 1210}, 1212}, {0, 0, {0, 0, 0}, 1215},
+    {0, 0, {0, 1218, 1218}, 0}, {0, 0, {0, 1220, 1220}, 0},
+    {0, 0, {0, 1222, 1222}, 0}, {0, 0, {0, 1224, 1224}, 1226},
+    {0, 0, {0, 0, 0}, 1229}, {0, 0, {0, 1232, 1232}, 1234},
+    {0, 0, {0, 0, 0}, 1237}, {0, 0, {0, 1240, 1240}, 1242},
+    {0, 0, {0, 0, 0}, 1246}, {0, 0, {0, 1250, 1250}, 1252},
+    {0, 0, {0, 0, 0}, 1256}, {0, 0, {0, 1260, 1260}, 1262},
+    {0, 0, {0, 0, 0}, 1265}, {0, 0, {0, 1268, 1268}, 1270},
+    {0, 0, {0, 0, 0}, 1274}, {0, 0, {0, 1278, 1278}, 1280},
+    {0, 0, {0, 0, 0}, 1283}, {0, 0, {0, 1286, 1286}, 0},
+    {0, 0, {0, 1288, 1288}, 0}, {0, 0, {0, 1290, 1290}, 0},
+    {0, 0, {0, 1292, 1292}, 0}, {0, 0, {0, 1294, 1294}, 0},
+    {0, 0, {0, 1296, 1296}, 0}, {0, 0, {0, 1298, 1298}, 0},
+    {0, 0, {0, 1300, 1300}, 0}, {0, 0, {0, 1302, 1302}, 0},
+    {0, 0, {0, 1304, 1304}, 0}, {0, 0, {0, 1306, 1306}, 0},
+    {0, 0, {0, 1308, 1308}, 0}, {0, 0, {0, 1310, 1310}, 0},
+    {0, 0, {15, 0, 15}, 0}, {0, 0, {1312, 0, 1312}, 0}, {0, 0, {19, 0, 19}, 0},
+    {0, 0, {35, 0, 35}, 0}, {0, 0, {1314, 0, 1314}, 0},
+    {0, 0, {1316, 0, 1316}, 0}, {0, 0, {1318, 0, 1318}, 0},
+    {0, 0, {45, 0, 45}, 0}, {0, 0, {49, 0, 49}, 0}, {0, 0, {1320, 0, 1320}, 0},
+    {0, 0, {1323, 0, 1323}, 0}, {0, 0, {1326, 0, 1326}, 0},
+    {0, 0, {1329, 0, 1329}, 0}, {0, 0, {1332, 0, 1332}, 0},
+    {0, 0, {1335, 0, 1335}, 0}, {0, 0, {801, 0, 801}, 0},
+    {0, 0, {23, 0, 23}, 0}, {0, 0, {37, 0, 37}, 0}, {0, 0, {47, 0, 47}, 0},
+    {0, 0, {1338, 0, 1338}, 0}, {230, 2, {0, 0, 0}, 0}, {230, 0, {0, 0, 0}, 0},
+    {232, 0, {0, 0, 0}, 0}, {220, 0, {0, 0, 0}, 0}, {216, 2, {0, 0, 0}, 0},
+    {202, 0, {0, 0, 0}, 0}, {220, 2, {0, 0, 0}, 0}, {202, 2, {0, 0, 0}, 0},
+    {1, 0, {0, 0, 0}, 0}, {1, 2, {0, 0, 0}, 0}, {230, 0, {1340, 0, 1340}, 0},
+    {230, 0, {1342, 0, 1342}, 0}, {230, 0, {1344, 0, 1344}, 0},
+    {230, 0, {1346, 0, 1346}, 0}, {240, 2, {0, 1349, 1349}, 0},
+    {233, 0, {0, 0, 0}, 0}, {234, 0, {0, 0, 0}, 0}, {0, 0, {0, 1351, 1351}, 0},
+    {0, 0, {0, 1353, 1353}, 0}, {0, 0, {1355, 0, 1355}, 0},
+    {0, 0, {0, 1357, 1357}, 0}, {0, 0, {1359, 0, 1362}, 0},
+    {0, 0, {1365, 0, 1365}, 0}, {0, 0, {0, 1367, 1367}, 0},
+    {0, 0, {1369, 0, 1369}, 1373}, {0, 0, {0, 1376, 1376}, 1378},
+    {0, 0, {1381, 0, 1381}, 0}, {0, 0, {0, 1383, 1383}, 1385},
+    {0, 0, {0, 1388, 1388}, 1390}, {0, 0, {0, 1393, 1393}, 1395},
+    {0, 0, {0, 1398, 1398}, 1400}, {0, 0, {0, 1403, 1403}, 1405},
+    {0, 0, {0, 1408, 1408}, 1410}, {0, 0, {0, 1413, 0}, 1413},
+    {0, 0, {0, 1417, 1417}, 0}, {0, 0, {0, 1419, 1419}, 0},
+    {0, 0, {0, 1421, 1421}, 0}, {0, 0, {0, 1423, 1423}, 0},
+    {0, 0, {0, 1425, 1425}, 0}, {0, 0, {0, 1427, 1427}, 0},
+    {0, 0, {0, 1429, 1429}, 0}, {0, 0, {0, 1431, 1431}, 0},
+    {0, 0, {0, 1349, 1349}, 0}, {0, 0, {0, 1433, 1433}, 0},
+    {0, 0, {0, 1435, 1435}, 0}, {0, 0, {0, 68, 68}, 0},
+    {0, 0, {0, 1437, 1437}, 0}, {0, 0, {0, 1439, 1439}, 0},
+    {0, 0, {0, 1441, 1441}, 0}, {0, 0, {0, 1443, 1443}, 0},
+    {0, 0, {0, 1445, 1445}, 0}, {0, 0, {0, 1447, 1447}, 0},
+    {0, 0, {0, 1449, 1449}, 0}, {0, 0, {0, 1451, 1451}, 0},
+    {0, 0, {0, 1453, 1453}, 0}, {0, 0, {0, 1455, 1455}, 0},
+    {0, 0, {0, 1457, 1457}, 0}, {0, 0, {0, 1459, 1459}, 0},
+    {0, 0, {0, 1461, 1461}, 1463}, {0, 0, {0, 1466, 1466}, 1468},
+    {0, 0, {0, 0, 0}, 1471}, {0, 0, {0, 0, 0}, 1474}, {0, 0, {0, 0, 0}, 1477},
+    {0, 0, {0, 0, 0}, 1480}, {0, 0, {0, 1483, 0}, 1483},
+    {0, 0, {0, 0, 0}, 1487}, {0, 0, {0, 0, 0}, 1490}, {0, 0, {0, 0, 0}, 1493},
+    {0, 0, {0, 0, 0}, 1496}, {0, 0, {0, 0, 0}, 1499},
+    {0, 0, {0, 1502, 1502}, 0}, {0, 0, {1419, 1419, 1419}, 0},
+    {0, 0, {1431, 1431, 1431}, 0}, {0, 0, {1504, 0, 1451}, 0},
+    {0, 0, {1506, 0, 1403}, 1508}, {0, 0, {1511, 0, 1466}, 1513},
+    {0, 0, {1453, 1453, 1453}, 0}, {0, 0, {1443, 1443, 1443}, 0},
+    {0, 0, {0, 1516, 1516}, 0}, {0, 0, {0, 1518, 1518}, 0},
+    {0, 0, {0, 1520, 1520}, 0}, {0, 0, {0, 1522, 1522}, 0},
+    {0, 0, {0, 1524, 1524}, 0}, {0, 0, {0, 1526, 1526}, 0},
+    {0, 0, {0, 1528, 1528}, 0}, {0, 0, {0, 1530, 1530}, 0},
+    {0, 0, {0, 1532, 1532}, 0}, {0, 0, {0, 1534, 1534}, 0},
+    {0, 0, {0, 1536, 1536}, 0}, {0, 0, {0, 1538, 1538}, 0},
+    {0, 0, {1433, 1433, 1433}, 0}, {0, 0, {1445, 1445, 1445}, 0},
+    {0, 0, {1540, 0, 1447}, 0}, {0, 0, {1542, 1431, 1431}, 0},
+    {0, 0, {1425, 1425, 1425}, 0}, {0, 0, {0, 1544, 1544}, 0},
+    {0, 0, {1546, 1548, 1447}, 0}, {0, 0, {0, 1550, 1550}, 0},
+    {0, 0, {0, 1552, 1552}, 0}, {0, 0, {0, 1554, 1554}, 0},
+    {0, 0, {0, 1556, 1556}, 0}, {0, 0, {0, 1558, 1558}, 1560},
+    {0, 0, {0, 1563, 1563}, 1565}, {0, 0, {0, 1568, 1568}, 0},
+    {0, 0, {0, 1570, 1570}, 1572}, {0, 0, {0, 1575, 1575}, 0},
+    {0, 0, {0, 1577, 1577}, 0}, {0, 0, {0, 1579, 1579}, 0},
+    {0, 0, {0, 1581, 1581}, 1583}, {0, 0, {0, 1586, 1586}, 0},
+    {0, 0, {0, 1588, 1588}, 0}, {0, 0, {0, 1590, 1590}, 0},
+    {0, 0, {0, 1592, 1592}, 0}, {0, 0, {0, 1594, 1594}, 1596},
+    {0, 0, {0, 1599, 1599}, 1601}, {0, 0, {0, 1604, 1604}, 1606},
+    {0, 0, {0, 1609, 1609}, 0}, {0, 0, {0, 1611, 1611}, 0},
+    {0, 0, {0, 1613, 1613}, 0}, {0, 0, {0, 1615, 1615}, 0},
+    {0, 0, {0, 1617, 1617}, 0}, {0, 0, {0, 1619, 1619}, 0},
+    {0, 0, {0, 1621, 1621}, 0}, {0, 0, {0, 1623, 1623}, 0},
+    {0, 0, {0, 1625, 1625}, 0}, {0, 0, {0, 1627, 1627}, 0},
+    {0, 0, {0, 1629, 1629}, 1631}, {0, 0, {0, 1634, 1634}, 0},
+    {0, 0, {0, 1636, 1636}, 0}, {0, 0, {0, 1638, 1638}, 0},
+    {0, 0, {0, 1640, 1640}, 0}, {0, 0, {0, 1642, 1642}, 0},
+    {0, 0, {0, 1644, 1644}, 0}, {0, 0, {0, 1646, 1646}, 0},
+    {0, 0, {0, 1648, 1648}, 0}, {0, 0, {0, 1650, 1650}, 0},
+    {0, 0, {0, 1652, 1652}, 0}, {0, 0, {0, 1654, 1654}, 0},
+    {0, 0, {0, 1656, 1656}, 0}, {0, 0, {0, 1658, 1658}, 0},
+    {0, 0, {0, 1660, 1660}, 0}, {0, 0, {0, 1662, 1662}, 0},
+    {0, 0, {0, 1664, 1664}, 0}, {0, 0, {0, 1666, 1666}, 0},
+    {0, 0, {0, 1668, 1668}, 0}, {0, 0, {0, 1670, 1670}, 0},
+    {0, 0, {0, 1672, 1672}, 0}, {0, 0, {0, 1674, 1674}, 0},
+    {0, 0, {0, 1676, 1676}, 0}, {0, 0, {0, 0, 0}, 1678},
+    {0, 0, {0, 0, 0}, 1681}, {0, 0, {0, 0, 0}, 1684}, {0, 0, {0, 0, 0}, 1687},
+    {0, 0, {0, 0, 0}, 1690}, {0, 0, {0, 0, 0}, 1693}, {0, 0, {0, 0, 0}, 1696},
+    {0, 0, {0, 0, 0}, 1699}, {0, 0, {0, 1702, 1702}, 0},
+    {0, 0, {0, 1704, 1704}, 0}, {0, 0, {0, 1706, 1706}, 0},
+    {0, 0, {0, 1708, 1708}, 0}, {0, 0, {0, 1710, 1710}, 0},
+    {0, 0, {0, 1712, 1712}, 0}, {0, 0, {0, 1714, 1714}, 0},
+    {0, 0, {0, 1716, 1716}, 0}, {0, 0, {0, 1718, 1718}, 0},
+    {0, 0, {0, 1720, 1720}, 0}, {0, 0, {0, 1722, 1722}, 0},
+    {0, 0, {0, 1724, 1724}, 1726}, {0, 0, {0, 0, 0}, 1729},
+    {0, 0, {0, 1732, 1732}, 0}, {0, 0, {0, 1734, 1734}, 0},
+    {0, 0, {0, 1736, 1736}, 0}, {0, 0, {0, 1738, 1738}, 0},
+    {0, 0, {0, 1740, 1740}, 0}, {0, 0, {0, 1742, 1742}, 0},
+    {0, 0, {0, 1744, 1744}, 0}, {0, 0, {0, 1746, 1746}, 0},
+    {0, 0, {0, 1748, 1748}, 0}, {0, 0, {0, 1750, 1750}, 0},
+    {0, 0, {0, 1752, 1752}, 0}, {0, 0, {0, 1754, 1754}, 0},
+    {0, 0, {0, 1756, 1756}, 0}, {0, 0, {0, 1758, 1758}, 0},
+    {0, 0, {0, 1760, 1760}, 0}, {0, 0, {0, 1762, 1762}, 0},
+    {0, 0, {0, 1764, 1764}, 0}, {0, 0, {0, 1766, 1766}, 0},
+    {0, 0, {0, 1768, 1768}, 0}, {0, 0, {0, 1770, 1770}, 0},
+    {0, 0, {0, 1772, 1772}, 0}, {0, 0, {0, 1774, 1774}, 0},
+    {0, 0, {0, 1776, 1776}, 0}, {0, 0, {0, 1778, 1778}, 0},
+    {0, 0, {0, 1780, 1780}, 0}, {0, 0, {0, 1782, 1782}, 0},
+    {0, 0, {0, 1784, 1784}, 0}, {0, 0, {0, 1786, 1786}, 0},
+    {0, 0, {0, 1788, 1788}, 0}, {0, 0, {0, 1790, 1790}, 0},
+    {0, 0, {0, 1792, 1792}, 0}, {0, 0, {0, 1794, 1794}, 0},
+    {0, 0, {0, 1796, 1796}, 0}, {0, 0, {0, 1798, 1798}, 1800},
+    {0, 0, {0, 0, 0}, 1803}, {0, 0, {0, 1806, 1806}, 0},
+    {0, 0, {0, 1808, 1808}, 0}, {0, 0, {0, 1810, 1810}, 0},
+    {0, 0, {0, 1812, 1812}, 0}, {0, 0, {0, 1814, 1814}, 0},
+    {0, 0, {0, 1816, 1816}, 0}, {0, 0, {0, 1818, 1818}, 1820},
+    {0, 0, {0, 0, 0}, 1823}, {0, 0, {0, 1826, 1826}, 1828},
+    {0, 0, {0, 0, 0}, 1831}, {0, 0, {0, 1834, 1834}, 0},
+    {0, 0, {0, 1836, 1836}, 1838}, {0, 0, {0, 0, 0}, 1841},
+    {0, 0, {0, 1844, 1844}, 0}, {0, 0, {0, 1846, 1846}, 1848},
+    {0, 0, {0, 0, 0}, 1851}, {0, 0, {0, 1854, 1854}, 1856},
+    {0, 0, {0, 0, 0}, 1859}, {0, 0, {0, 1862, 1862}, 1864},
+    {0, 0, {0, 0, 0}, 1867}, {0, 0, {0, 1870, 1870}, 0},
+    {0, 0, {0, 1872, 1872}, 1874}, {0, 0, {0, 0, 0}, 1877},
+    {0, 0, {0, 1880, 1880}, 1882}, {0, 0, {0, 0, 0}, 1885},
+    {0, 0, {0, 1888, 1888}, 1890}, {0, 0, {0, 0, 0}, 1893},
+    {0, 0, {0, 1896, 1896}, 0}, {0, 0, {0, 1898, 1898}, 1900},
+    {0, 0, {0, 0, 0}, 1903}, {0, 0, {0, 1906, 1906}, 1908},
+    {0, 0, {0, 0, 0}, 1911}, {0, 0, {0, 1914, 1914}, 1916},
+    {0, 0, {0, 0, 0}, 1919}, {0, 0, {0, 1922, 1922}, 1924},
+    {0, 0, {0, 0, 0}, 1927}, {0, 0, {0, 1930, 1930}, 1932},
+    {0, 0, {0, 0, 0}, 1935}, {0, 0, {0, 1938, 1938}, 1940},
+    {0, 0, {0, 0, 0}, 1943}, {0, 0, {0, 1946, 1946}, 0},
+    {0, 0, {0, 1948, 1948}, 1950}, {0, 0, {0, 0, 0}, 1953},
+    {0, 0, {0, 1956, 1956}, 0}, {0, 0, {0, 1958, 1958}, 0},
+    {0, 0, {0, 1960, 1960}, 0}, {0, 0, {0, 1962, 1962}, 0},
+    {0, 0, {0, 1964, 1964}, 0}, {0, 0, {0, 1966, 1966}, 0},
+    {0, 0, {0, 1968, 1968}, 0}, {0, 0, {0, 1970, 1970}, 0},
+    {0, 0, {0, 1972, 1972}, 0}, {0, 0, {0, 1974, 1974}, 0},
+    {0, 0, {0, 1976, 1976}, 0}, {0, 0, {0, 1978, 1978}, 0},
+    {0, 0, {0, 1980, 1980}, 0}, {0, 0, {0, 1982, 1982}, 0},
+    {0, 0, {0, 1984, 1984}, 0}, {0, 0, {0, 1986, 1986}, 0},
+    {0, 0, {0, 1988, 1988}, 0}, {0, 0, {0, 1990, 1990}, 0},
+    {0, 0, {0, 1992, 1992}, 0}, {0, 0, {0, 1994, 1994}, 0},
+    {0, 0, {0, 1996, 1996}, 0}, {0, 0, {0, 1998, 1998}, 0},
+    {0, 0, {0, 2000, 2000}, 0}, {0, 0, {0, 2002, 2002}, 0},
+    {0, 0, {0, 2004, 2004}, 0}, {0, 0, {0, 2006, 2006}, 0},
+    {0, 0, {0, 2008, 2008}, 0}, {0, 0, {0, 2010, 2010}, 0},
+    {0, 0, {0, 2012, 2012}, 0}, {0, 0, {0, 2014, 2014}, 0},
+    {0, 0, {0, 2016, 2016}, 0}, {0, 0, {0, 2018, 2018}, 0},
+    {0, 0, {0, 2020, 2020}, 0}, {0, 0, {0, 2022, 2022}, 0},
+    {0, 0, {0, 2024, 2024}, 0}, {0, 0, {0, 2026, 2026}, 0},
+    {0, 0, {0, 2028, 2028}, 0}, {0, 0, {0, 2030, 2030}, 0},
+    {0, 0, {0, 2032, 2032}, 0}, {0, 0, {0, 2034, 2034}, 0},
+    {0, 0, {0, 2036, 2036}, 0}, {0, 0, {0, 2038, 2038}, 0},
+    {0, 0, {0, 2040, 2040}, 0}, {0, 0, {0, 2042, 2042}, 0},
+    {0, 0, {0, 2044, 2044}, 0}, {0, 0, {0, 2046, 2046}, 0},
+    {0, 0, {0, 2048, 2048}, 0}, {0, 0, {0, 2050, 2050}, 0},
+    {0, 0, {0, 2052, 2052}, 0}, {0, 0, {0, 2054, 2054}, 0},
+    {0, 0, {0, 2056, 2056}, 0}, {0, 0, {0, 2058, 2058}, 0},
+    {0, 0, {0, 2060, 2060}, 0}, {0, 0, {0, 2062, 2062}, 0},
+    {0, 0, {0, 2064, 2064}, 0}, {0, 0, {0, 2066, 2066}, 0},
+    {0, 0, {0, 2068, 2068}, 0}, {0, 0, {0, 2070, 2070}, 0},
+    {0, 0, {0, 2072, 2072}, 0}, {0, 0, {0, 2074, 2074}, 0},
+    {0, 0, {0, 2076, 2076}, 0}, {0, 0, {0, 2078, 2078}, 0},
+    {0, 0, {0, 2080, 2080}, 0}, {0, 0, {0, 2082, 2082}, 0},
+    {0, 0, {0, 2084, 2084}, 0}, {0, 0, {2086, 2086, 2086}, 0},
+    {222, 0, {0, 0, 0}, 0}, {228, 0, {0, 0, 0}, 0}, {10, 0, {0, 0, 0}, 0},
+    {11, 0, {0, 0, 0}, 0}, {12, 0, {0, 0, 0}, 0}, {13, 0, {0, 0, 0}, 0},
+    {14, 0, {0, 0, 0}, 0}, {15, 0, {0, 0, 0}, 0}, {16, 0, {0, 0, 0}, 0},
+    {17, 0, {0, 0, 0}, 0}, {18, 0, {0, 0, 0}, 0}, {19, 0, {0, 0, 0}, 0},
+    {20, 0, {0, 0, 0}, 0}, {21, 0, {0, 0, 0}, 0}, {22, 0, {0, 0, 0}, 0},
+    {23, 0, {0, 0, 0}, 0}, {24, 0, {0, 0, 0}, 0}, {25, 0, {0, 0, 0}, 0},
+    {30, 0, {0, 0, 0}, 0}, {31, 0, {0, 0, 0}, 0}, {32, 0, {0, 0, 0}, 0},
+    {0, 0, {0, 0, 0}, 2089}, {0, 0, {0, 0, 0}, 2092}, {0, 0, {0, 0, 0}, 2095},
+    {0, 0, {0, 0, 0}, 2098}, {0, 0, {0, 0, 0}, 2101}, {27, 0, {0, 0, 0}, 0},
+    {28, 0, {0, 0, 0}, 0}, {29, 0, {0, 0, 0}, 0}, {33, 0, {0, 0, 0}, 0},
+    {34, 0, {0, 0, 0}, 0}, {35, 0, {0, 0, 0}, 0}, {0, 0, {2104, 0, 2104}, 0},
+    {0, 0, {2107, 0, 2107}, 0}, {0, 0, {2110, 0, 2110}, 0},
+    {0, 0, {2113, 0, 2113}, 0}, {0, 0, {0, 0, 0}, 2116},
+    {0, 0, {0, 0, 0}, 2119}, {0, 0, {0, 0, 0}, 2122}, {36, 0, {0, 0, 0}, 0},
+    {0, 0, {0, 0, 0}, 2125}, {0, 0, {0, 0, 0}, 2128}, {0, 0, {0, 0, 0}, 2131},
+    {7, 2, {0, 0, 0}, 0}, {9, 0, {0, 0, 0}, 0}, {0, 0, {2134, 0, 2134}, 2134},
+    {0, 0, {2137, 0, 2137}, 2137}, {0, 0, {2140, 0, 2140}, 2140},
+    {0, 0, {2143, 0, 2143}, 2143}, {0, 0, {2146, 0, 2146}, 2146},
+    {0, 0, {2149, 0, 2149}, 2149}, {0, 0, {2152, 0, 2152}, 2152},
+    {0, 0, {2155, 0, 2155}, 2155}, {7, 0, {0, 0, 0}, 0}, {0, 2, {0, 0, 0}, 0},
+    {0, 0, {2158, 0, 2158}, 2158}, {0, 0, {2161, 0, 2161}, 2161},
+    {0, 0, {2164, 0, 2164}, 2164}, {0, 0, {2167, 0, 2167}, 2167},
+    {0, 0, {2170, 0, 2170}, 2170}, {0, 0, {2173, 0, 2173}, 2173},
+    {0, 0, {2176, 0, 2176}, 2176}, {0, 0, {2179, 0, 2179}, 2179},
+    {0, 0, {2182, 0, 2182}, 2182}, {0, 0, {2185, 0, 2185}, 2185},
+    {0, 0, {2188, 0, 2188}, 2188}, {0, 0, {0, 0, 0}, 2191},
+    {84, 0, {0, 0, 0}, 0}, {91, 2, {0, 0, 0}, 0}, {9, 2, {0, 0, 0}, 0},
+    {0, 0, {0, 0, 0}, 2194}, {0, 0, {2197, 0, 2197}, 0}, {103, 0, {0, 0, 0}, 0},
+    {107, 0, {0, 0, 0}, 0}, {0, 0, {2200, 0, 2200}, 0}, {118, 0, {0, 0, 0}, 0},
+    {122, 0, {0, 0, 0}, 0}, {0, 0, {2203, 0, 2203}, 0},
+    {0, 0, {2206, 0, 2206}, 0}, {0, 0, {2209, 0, 2209}, 0},
+    {216, 0, {0, 0, 0}, 0}, {0, 0, {2211, 0, 2211}, 0},
+    {0, 0, {2214, 0, 2214}, 0}, {0, 0, {2217, 0, 2217}, 0},
+    {0, 0, {2220, 0, 2220}, 0}, {0, 0, {2223, 0, 2223}, 0},
+    {0, 0, {2226, 0, 2226}, 0}, {129, 0, {0, 0, 0}, 0}, {130, 0, {0, 0, 0}, 0},
+    {0, 0, {2229, 0, 2229}, 0}, {132, 0, {0, 0, 0}, 0},
+    {0, 0, {2232, 0, 2232}, 0}, {0, 0, {2235, 0, 2235}, 2235},
+    {0, 0, {2238, 0, 2238}, 0}, {0, 0, {2242, 0, 2242}, 2242},
+    {0, 0, {2245, 0, 2245}, 0}, {0, 0, {2249, 0, 2249}, 0},
+    {0, 0, {2252, 0, 2252}, 0}, {0, 0, {2255, 0, 2255}, 0},
+    {0, 0, {2258, 0, 2258}, 0}, {0, 0, {2261, 0, 2261}, 0},
+    {0, 0, {2264, 0, 2264}, 0}, {0, 0, {2267, 0, 2267}, 0},
+    {0, 0, {0, 2270, 2270}, 0}, {0, 0, {0, 2272, 2272}, 0},
+    {0, 0, {0, 2274, 2274}, 0}, {0, 0, {0, 2276, 2276}, 0},
+    {0, 0, {0, 2278, 2278}, 0}, {0, 0, {0, 2280, 2280}, 0},
+    {0, 0, {0, 2282, 2282}, 0}, {0, 0, {0, 2284, 2284}, 0},
+    {0, 0, {0, 2286, 2286}, 0}, {0, 0, {0, 2288, 2288}, 0},
+    {0, 0, {0, 2290, 2290}, 0}, {0, 0, {0, 2292, 2292}, 0},
+    {0, 0, {0, 2294, 2294}, 0}, {0, 0, {0, 2296, 2296}, 0},
+    {0, 0, {0, 2298, 2298}, 0}, {0, 0, {0, 2300, 2300}, 0},
+    {0, 0, {0, 2302, 2302}, 0}, {0, 0, {0, 2304, 2304}, 0},
+    {0, 0, {0, 2306, 2306}, 0}, {0, 0, {0, 2308, 2308}, 0},
+    {0, 0, {0, 2310, 2310}, 0}, {0, 0, {0, 2312, 2312}, 0},
+    {0, 0, {0, 2314, 2314}, 0}, {0, 0, {0, 2316, 2316}, 0},
+    {0, 0, {0, 2318, 2318}, 0}, {0, 0, {0, 2320, 2320}, 0},
+    {0, 0, {0, 2322, 2322}, 0}, {0, 0, {0, 2324, 2324}, 0},
+    {0, 0, {0, 2326, 2326}, 0}, {0, 0, {0, 2328, 2328}, 0},
+    {0, 0, {0, 2330, 2330}, 0}, {0, 0, {0, 2332, 2332}, 0},
+    {0, 0, {0, 2334, 2334}, 0}, {0, 0, {0, 2336, 2336}, 0},
+    {0, 0, {0, 2338, 2338}, 0}, {0, 0, {0, 2340, 2340}, 0},
+    {0, 0, {0, 2342, 2342}, 0}, {0, 0, {0, 2344, 2344}, 0},
+    {0, 0, {0, 2346, 2346}, 0}, {0, 0, {0, 2348, 2348}, 0},
+    {0, 0, {2350, 0, 2350}, 0}, {0, 0, {0, 2352, 2352}, 0},
+    {0, 0, {0, 2354, 2354}, 0}, {0, 0, {0, 2356, 2356}, 0},
+    {0, 0, {0, 2358, 2358}, 0}, {0, 0, {0, 2360, 2360}, 0},
+    {0, 0, {0, 2362, 2362}, 0}, {0, 0, {0, 2364, 2364}, 0},
+    {0, 0, {0, 2366, 2366}, 0}, {0, 0, {0, 2368, 2368}, 0},
+    {0, 0, {0, 2370, 2370}, 0}, {0, 0, {0, 2372, 2372}, 0},
+    {0, 0, {0, 2374, 2374}, 0}, {0, 0, {0, 2376, 2376}, 0},
+    {0, 0, {0, 2378, 2378}, 0}, {0, 0, {0, 2380, 2380}, 0},
+    {0, 0, {0, 2382, 2382}, 0}, {0, 0, {0, 2384, 2384}, 0},
+    {0, 0, {0, 2386, 2386}, 0}, {0, 0, {0, 2388, 2388}, 0},
+    {0, 0, {0, 2350, 2350}, 0}, {0, 0, {0, 2390, 2390}, 0},
+    {0, 0, {0, 2392, 2392}, 0}, {0, 0, {0, 2394, 2394}, 0},
+    {0, 0, {0, 2396, 2396}, 0}, {0, 0, {0, 2398, 2398}, 0},
+    {0, 0, {0, 2400, 2400}, 0}, {0, 0, {0, 2402, 2402}, 0},
+    {0, 0, {0, 2404, 2404}, 0}, {0, 0, {0, 2406, 2406}, 0},
+    {0, 0, {0, 2408, 2408}, 0}, {0, 0, {0, 2410, 2410}, 0},
+    {0, 0, {0, 2412, 2412}, 0}, {0, 0, {0, 2414, 2414}, 0},
+    {0, 0, {0, 2416, 2416}, 0}, {0, 0, {0, 2418, 2418}, 0},
+    {0, 0, {0, 2420, 2420}, 0}, {0, 0, {0, 2422, 2422}, 0},
+    {0, 0, {0, 2424, 2424}, 0}, {0, 0, {0, 2426, 2426}, 0},
+    {0, 0, {0, 2428, 2428}, 0}, {0, 0, {0, 2430, 2430}, 0},
+    {0, 0, {0, 2432, 2432}, 0}, {0, 0, {0, 2434, 2434}, 0},
+    {0, 0, {0, 2436, 2436}, 0}, {0, 0, {0, 2438, 2438}, 0},
+    {0, 0, {0, 2440, 2440}, 0}, {0, 0, {0, 2442, 2442}, 0},
+    {0, 0, {0, 2444, 2444}, 0}, {0, 0, {0, 2446, 2446}, 0},
+    {0, 0, {0, 2448, 2448}, 0}, {0, 0, {0, 2450, 2450}, 0},
+    {0, 0, {0, 2452, 2452}, 0}, {0, 0, {0, 2454, 2454}, 0},
+    {0, 0, {2456, 0, 1}, 0}, {0, 0, {2458, 0, 117}, 0}, {0, 0, {2460, 0, 3}, 0},
+    {0, 0, {2462, 0, 7}, 0}, {0, 0, {2464, 0, 9}, 0}, {0, 0, {2466, 0, 791}, 0},
+    {0, 0, {2468, 0, 13}, 0}, {0, 0, {2470, 0, 15}, 0},
+    {0, 0, {2472, 0, 17}, 0}, {0, 0, {2474, 0, 19}, 0},
+    {0, 0, {2476, 0, 21}, 0}, {0, 0, {2478, 0, 23}, 0},
+    {0, 0, {2480, 0, 25}, 0}, {0, 0, {2482, 0, 27}, 0},
+    {0, 0, {2484, 0, 29}, 0}, {0, 0, {2486, 0, 1220}, 0},
+    {0, 0, {2488, 0, 31}, 0}, {0, 0, {2490, 0, 35}, 0},
+    {0, 0, {2492, 0, 39}, 0}, {0, 0, {2494, 0, 41}, 0},
+    {0, 0, {2496, 0, 45}, 0}, {0, 0, {2498, 0, 2498}, 0},
+    {0, 0, {2500, 0, 2500}, 0}, {0, 0, {2502, 0, 2502}, 0},
+    {0, 0, {3, 0, 3}, 0}, {0, 0, {7, 0, 7}, 0}, {0, 0, {9, 0, 9}, 0},
+    {0, 0, {793, 0, 793}, 0}, {0, 0, {795, 0, 795}, 0},
+    {0, 0, {2504, 0, 2504}, 0}, {0, 0, {13, 0, 13}, 0}, {0, 0, {21, 0, 21}, 0},
+    {0, 0, {25, 0, 25}, 0}, {0, 0, {580, 0, 580}, 0}, {0, 0, {781, 0, 781}, 0},
+    {0, 0, {2506, 0, 2506}, 0}, {0, 0, {2508, 0, 2508}, 0},
+    {0, 0, {31, 0, 31}, 0}, {0, 0, {39, 0, 39}, 0}, {0, 0, {41, 0, 41}, 0},
+    {0, 0, {2510, 0, 2510}, 0}, {0, 0, {809, 0, 809}, 0},
+    {0, 0, {43, 0, 43}, 0}, {0, 0, {2512, 0, 2512}, 0},
+    {0, 0, {1419, 0, 1419}, 0}, {0, 0, {1421, 0, 1421}, 0},
+    {0, 0, {1423, 0, 1423}, 0}, {0, 0, {1453, 0, 1453}, 0},
+    {0, 0, {1455, 0, 1455}, 0}, {0, 0, {17, 0, 17}, 0},
+    {0, 0, {1445, 0, 1445}, 0}, {0, 0, {1640, 0, 1640}, 0},
+    {0, 0, {2514, 0, 2514}, 0}, {0, 0, {5, 0, 5}, 0},
+    {0, 0, {2516, 0, 2516}, 0}, {0, 0, {164, 0, 164}, 0},
+    {0, 0, {11, 0, 11}, 0}, {0, 0, {2518, 0, 2518}, 0},
+    {0, 0, {2520, 0, 2520}, 0}, {0, 0, {2522, 0, 2522}, 0},
+    {0, 0, {805, 0, 805}, 0}, {0, 0, {803, 0, 803}, 0},
+    {0, 0, {2524, 0, 2524}, 0}, {0, 0, {2526, 0, 2526}, 0},
+    {0, 0, {2528, 0, 2528}, 0}, {0, 0, {2530, 0, 2530}, 0},
+    {0, 0, {2532, 0, 2532}, 0}, {0, 0, {2534, 0, 2534}, 0},
+    {0, 0, {2536, 0, 2536}, 0}, {0, 0, {2538, 0, 2538}, 0},
+    {0, 0, {811, 0, 811}, 0}, {0, 0, {2540, 0, 2540}, 0},
+    {0, 0, {2542, 0, 2542}, 0}, {0, 0, {813, 0, 813}, 0},
+    {0, 0, {2544, 0, 2544}, 0}, {0, 0, {2546, 0, 2546}, 0},
+    {0, 0, {831, 0, 831}, 0}, {0, 0, {2548, 0, 2548}, 0},
+    {0, 0, {1298, 0, 1298}, 0}, {0, 0, {845, 0, 845}, 0},
+    {0, 0, {2550, 0, 2550}, 0}, {0, 0, {847, 0, 847}, 0},
+    {0, 0, {1300, 0, 1300}, 0}, {0, 0, {51, 0, 51}, 0},
+    {0, 0, {2552, 0, 2552}, 0}, {0, 0, {2554, 0, 2554}, 0},
+    {0, 0, {853, 0, 853}, 0}, {0, 0, {1431, 0, 1431}, 0},
+    {214, 0, {0, 0, 0}, 0}, {218, 0, {0, 0, 0}, 0},
+    {0, 0, {0, 2556, 2556}, 2558}, {0, 0, {0, 0, 0}, 2561},
+    {0, 0, {0, 2564, 2564}, 2566}, {0, 0, {0, 0, 0}, 2569},
+    {0, 0, {0, 2572, 2572}, 2574}, {0, 0, {0, 0, 0}, 2577},
+    {0, 0, {0, 2580, 2580}, 2582}, {0, 0, {0, 0, 0}, 2585},
+    {0, 0, {0, 2588, 2588}, 2590}, {0, 0, {0, 0, 0}, 2594},
+    {0, 0, {0, 2598, 2598}, 2600}, {0, 0, {0, 0, 0}, 2603},
+    {0, 0, {0, 2606, 2606}, 2608}, {0, 0, {0, 0, 0}, 2611},
+    {0, 0, {0, 2614, 2614}, 2616}, {0, 0, {0, 0, 0}, 2619},
+    {0, 0, {0, 2622, 2622}, 2624}, {0, 0, {0, 0, 0}, 2627},
+    {0, 0, {0, 2630, 2630}, 2632}, {0, 0, {0, 0, 0}, 2635},
+    {0, 0, {0, 2638, 2638}, 2640}, {0, 0, {0, 0, 0}, 2644},
+    {0, 0, {0, 2648, 2648}, 2650}, {0, 0, {0, 0, 0}, 2654},
+    {0, 0, {0, 2658, 2658}, 2660}, {0, 0, {0, 0, 0}, 2663},
+    {0, 0, {0, 2666, 2666}, 2668}, {0, 0, {0, 0, 0}, 2671},
+    {0, 0, {0, 2674, 2674}, 2676}, {0, 0, {0, 0, 0}, 2680},
+    {0, 0, {0, 2684, 2684}, 2686}, {0, 0, {0, 0, 0}, 2689},
+    {0, 0, {0, 2692, 2692}, 2694}, {0, 0, {0, 0, 0}, 2697},
+    {0, 0, {0, 2700, 2700}, 2702}, {0, 0, {0, 0, 0}, 2705},
+    {0, 0, {0, 2708, 2708}, 2710}, {0, 0, {0, 0, 0}, 2713},
+    {0, 0, {0, 2716, 2716}, 2718}, {0, 0, {0, 0, 0}, 2721},
+    {0, 0, {0, 2724, 2724}, 2726}, {0, 0, {0, 0, 0}, 2729},
+    {0, 0, {0, 2732, 2732}, 2734}, {0, 0, {0, 0, 0}, 2737},
+    {0, 0, {0, 2740, 2740}, 2742}, {0, 0, {0, 0, 0}, 2745},
+    {0, 0, {0, 2748, 2748}, 2750}, {0, 0, {0, 0, 0}, 2754},
+    {0, 0, {0, 2758, 2758}, 2760}, {0, 0, {0, 0, 0}, 2763},
+    {0, 0, {0, 2766, 2766}, 2768}, {0, 0, {0, 0, 0}, 2771},
+    {0, 0, {0, 2774, 2774}, 2776}, {0, 0, {0, 0, 0}, 2779},
+    {0, 0, {0, 2782, 2782}, 2784}, {0, 0, {0, 0, 0}, 2787},
+    {0, 0, {0, 2790, 2790}, 2792}, {0, 0, {0, 0, 0}, 2796},
+    {0, 0, {0, 2800, 2800}, 2802}, {0, 0, {0, 0, 0}, 2805},
+    {0, 0, {0, 2808, 2808}, 2810}, {0, 0, {0, 0, 0}, 2813},
+    {0, 0, {0, 2816, 2816}, 2818}, {0, 0, {0, 0, 0}, 2821},
+    {0, 0, {0, 2824, 2824}, 2826}, {0, 0, {0, 0, 0}, 2829},
+    {0, 0, {0, 2832, 2832}, 2834}, {0, 0, {0, 0, 0}, 2837},
+    {0, 0, {0, 2840, 2840}, 2842}, {0, 0, {0, 0, 0}, 2845},
+    {0, 0, {0, 2848, 2848}, 2850}, {0, 0, {0, 0, 0}, 2853},
+    {0, 0, {0, 2856, 2856}, 2858}, {0, 0, {0, 0, 0}, 2861},
+    {0, 0, {0, 2864, 2864}, 2866}, {0, 0, {0, 0, 0}, 2869},
+    {0, 0, {0, 2872, 2872}, 2874}, {0, 0, {0, 0, 0}, 2878},
+    {0, 0, {0, 2882, 2882}, 2884}, {0, 0, {0, 0, 0}, 2888},
+    {0, 0, {0, 2892, 2892}, 2894}, {0, 0, {0, 0, 0}, 2898},
+    {0, 0, {0, 2902, 2902}, 2904}, {0, 0, {0, 0, 0}, 2908},
+    {0, 0, {0, 2912, 2912}, 2914}, {0, 0, {0, 0, 0}, 2917},
+    {0, 0, {0, 2920, 2920}, 2922}, {0, 0, {0, 0, 0}, 2925},
+    {0, 0, {0, 2928, 2928}, 2930}, {0, 0, {0, 0, 0}, 2933},
+    {0, 0, {0, 2936, 2936}, 2938}, {0, 0, {0, 0, 0}, 2941},
+    {0, 0, {0, 2944, 2944}, 2946}, {0, 0, {0, 0, 0}, 2950},
+    {0, 0, {0, 2954, 2954}, 2956}, {0, 0, {0, 0, 0}, 2959},
+    {0, 0, {0, 2962, 2962}, 2964}, {0, 0, {0, 0, 0}, 2967},
+    {0, 0, {0, 2970, 2970}, 2972}, {0, 0, {0, 0, 0}, 2975},
+    {0, 0, {0, 2978, 2978}, 2980}, {0, 0, {0, 0, 0}, 2984},
+    {0, 0, {0, 2988, 2988}, 2990}, {0, 0, {0, 0, 0}, 2994},
+    {0, 0, {0, 2998, 2998}, 3000}, {0, 0, {0, 0, 0}, 3004},
+    {0, 0, {0, 3008, 3008}, 3010}, {0, 0, {0, 0, 0}, 3013},
+    {0, 0, {0, 3016, 3016}, 3018}, {0, 0, {0, 0, 0}, 3021},
+    {0, 0, {0, 3024, 3024}, 3026}, {0, 0, {0, 0, 0}, 3029},
+    {0, 0, {0, 3032, 3032}, 3034}, {0, 0, {0, 0, 0}, 3037},
+    {0, 0, {0, 3040, 3040}, 3042}, {0, 0, {0, 0, 0}, 3045},
+    {0, 0, {0, 3048, 3048}, 3050}, {0, 0, {0, 0, 0}, 3053},
+    {0, 0, {0, 3056, 3056}, 3058}, {0, 0, {0, 0, 0}, 3061},
+    {0, 0, {0, 3064, 3064}, 3066}, {0, 0, {0, 0, 0}, 3070},
+    {0, 0, {0, 3074, 3074}, 3076}, {0, 0, {0, 0, 0}, 3080},
+    {0, 0, {0, 3084, 3084}, 3086}, {0, 0, {0, 0, 0}, 3089},
+    {0, 0, {0, 3092, 3092}, 3094}, {0, 0, {0, 0, 0}, 3097},
+    {0, 0, {0, 3100, 3100}, 3102}, {0, 0, {0, 0, 0}, 3105},
+    {0, 0, {0, 3108, 3108}, 3110}, {0, 0, {0, 0, 0}, 3113},
+    {0, 0, {0, 3116, 3116}, 3118}, {0, 0, {0, 0, 0}, 3121},
+    {0, 0, {0, 3124, 3124}, 3126}, {0, 0, {0, 0, 0}, 3129},
+    {0, 0, {0, 3132, 3132}, 3134}, {0, 0, {0, 0, 0}, 3137},
+    {0, 0, {0, 3140, 3140}, 3142}, {0, 0, {0, 0, 0}, 3145},
+    {0, 0, {0, 3148, 3148}, 3150}, {0, 0, {0, 0, 0}, 3153},
+    {0, 0, {0, 3156, 3156}, 3158}, {0, 0, {0, 0, 0}, 3161},
+    {0, 0, {0, 3164, 3164}, 3166}, {0, 0, {0, 0, 0}, 3169},
+    {0, 0, {0, 3172, 3172}, 3174}, {0, 0, {0, 0, 0}, 3177},
+    {0, 0, {0, 3180, 3180}, 3182}, {0, 0, {0, 0, 0}, 3185},
+    {0, 0, {0, 3188, 0}, 3188}, {0, 0, {0, 3191, 0}, 3191},
+    {0, 0, {0, 3194, 0}, 3194}, {0, 0, {0, 3197, 0}, 3197},
+    {0, 0, {3200, 3200, 3200}, 0}, {0, 0, {2962, 2962, 2962}, 3203},
+    {0, 0, {0, 3206, 3206}, 3208}, {0, 0, {0, 0, 0}, 3211},
+    {0, 0, {0, 3214, 3214}, 3216}, {0, 0, {0, 0, 0}, 3219},
+    {0, 0, {0, 3222, 3222}, 3224}, {0, 0, {0, 0, 0}, 3228},
+    {0, 0, {0, 3232, 3232}, 3234}, {0, 0, {0, 0, 0}, 3238},
+    {0, 0, {0, 3242, 3242}, 3244}, {0, 0, {0, 0, 0}, 3248},
+    {0, 0, {0, 3252, 3252}, 3254}, {0, 0, {0, 0, 0}, 3258},
+    {0, 0, {0, 3262, 3262}, 3264}, {0, 0, {0, 0, 0}, 3268},
+    {0, 0, {0, 3272, 3272}, 3274}, {0, 0, {0, 0, 0}, 3278},
+    {0, 0, {0, 3282, 3282}, 3284}, {0, 0, {0, 0, 0}, 3288},
+    {0, 0, {0, 3292, 3292}, 3294}, {0, 0, {0, 0, 0}, 3298},
+    {0, 0, {0, 3302, 3302}, 3304}, {0, 0, {0, 0, 0}, 3308},
+    {0, 0, {0, 3312, 3312}, 3314}, {0, 0, {0, 0, 0}, 3318},
+    {0, 0, {0, 3322, 3322}, 3324}, {0, 0, {0, 0, 0}, 3327},
+    {0, 0, {0, 3330, 3330}, 3332}, {0, 0, {0, 0, 0}, 3335},
+    {0, 0, {0, 3338, 3338}, 3340}, {0, 0, {0, 0, 0}, 3343},
+    {0, 0, {0, 3346, 3346}, 3348}, {0, 0, {0, 0, 0}, 3352},
+    {0, 0, {0, 3356, 3356}, 3358}, {0, 0, {0, 0, 0}, 3362},
+    {0, 0, {0, 3366, 3366}, 3368}, {0, 0, {0, 0, 0}, 3372},
+    {0, 0, {0, 3376, 3376}, 3378}, {0, 0, {0, 0, 0}, 3382},
+    {0, 0, {0, 3386, 3386}, 3388}, {0, 0, {0, 0, 0}, 3392},
+    {0, 0, {0, 3396, 3396}, 3398}, {0, 0, {0, 0, 0}, 3401},
+    {0, 0, {0, 3404, 3404}, 3406}, {0, 0, {0, 0, 0}, 3409},
+    {0, 0, {0, 3412, 3412}, 3414}, {0, 0, {0, 0, 0}, 3417},
+    {0, 0, {0, 3420, 3420}, 3422}, {0, 0, {0, 0, 0}, 3425},
+    {0, 0, {0, 3428, 3428}, 3430}, {0, 0, {0, 0, 0}, 3434},
+    {0, 0, {0, 3438, 3438}, 3440}, {0, 0, {0, 0, 0}, 3444},
+    {0, 0, {0, 3448, 3448}, 3450}, {0, 0, {0, 0, 0}, 3454},
+    {0, 0, {0, 3458, 3458}, 3460}, {0, 0, {0, 0, 0}, 3464},
+    {0, 0, {0, 3468, 3468}, 3470}, {0, 0, {0, 0, 0}, 3474},
+    {0, 0, {0, 3478, 3478}, 3480}, {0, 0, {0, 0, 0}, 3484},
+    {0, 0, {0, 3488, 3488}, 3490}, {0, 0, {0, 0, 0}, 3494},
+    {0, 0, {0, 3498, 3498}, 3500}, {0, 0, {0, 0, 0}, 3504},
+    {0, 0, {0, 3508, 3508}, 3510}, {0, 0, {0, 0, 0}, 3514},
+    {0, 0, {0, 3518, 3518}, 3520}, {0, 0, {0, 0, 0}, 3524},
+    {0, 0, {0, 3528, 3528}, 3530}, {0, 0, {0, 0, 0}, 3533},
+    {0, 0, {0, 3536, 3536}, 3538}, {0, 0, {0, 0, 0}, 3541},
+    {0, 0, {0, 3544, 3544}, 3546}, {0, 0, {0, 0, 0}, 3550},
+    {0, 0, {0, 3554, 3554}, 3556}, {0, 0, {0, 0, 0}, 3560},
+    {0, 0, {0, 3564, 3564}, 3566}, {0, 0, {0, 0, 0}, 3570},
+    {0, 0, {0, 3574, 3574}, 3576}, {0, 0, {0, 0, 0}, 3580},
+    {0, 0, {0, 3584, 3584}, 3586}, {0, 0, {0, 0, 0}, 3590},
+    {0, 0, {0, 3594, 3594}, 3596}, {0, 0, {0, 0, 0}, 3599},
+    {0, 0, {0, 3602, 3602}, 3604}, {0, 0, {0, 0, 0}, 3607},
+    {0, 0, {0, 3610, 3610}, 3612}, {0, 0, {0, 0, 0}, 3615},
+    {0, 0, {0, 3618, 3618}, 3620}, {0, 0, {0, 0, 0}, 3623},
+    {0, 0, {0, 3626, 3626}, 0}, {0, 0, {0, 3628, 3628}, 0},
+    {0, 0, {0, 3630, 3630}, 0}, {0, 0, {0, 0, 0}, 3632},
+    {0, 0, {0, 0, 0}, 3635}, {0, 0, {0, 0, 0}, 3638}, {0, 0, {0, 0, 0}, 3642},
+    {0, 0, {0, 0, 0}, 3646}, {0, 0, {0, 0, 0}, 3650}, {0, 0, {0, 0, 0}, 3654},
+    {0, 0, {0, 0, 0}, 3658}, {0, 0, {0, 3662, 3662}, 3664},
+    {0, 0, {0, 3667, 3667}, 3669}, {0, 0, {0, 3672, 3672}, 3674},
+    {0, 0, {0, 3678, 3678}, 3680}, {0, 0, {0, 3684, 3684}, 3686},
+    {0, 0, {0, 3690, 3690}, 3692}, {0, 0, {0, 3696, 3696}, 3698},
+    {0, 0, {0, 3702, 3702}, 3704}, {0, 0, {0, 0, 0}, 3708},
+    {0, 0, {0, 0, 0}, 3711}, {0, 0, {0, 0, 0}, 3714}, {0, 0, {0, 0, 0}, 3718},
+    {0, 0, {0, 0, 0}, 3722}, {0, 0, {0, 0, 0}, 3726},
+    {0, 0, {0, 3730, 3730}, 3732}, {0, 0, {0, 3735, 3735}, 3737},
+    {0, 0, {0, 3740, 3740}, 3742}, {0, 0, {0, 3746, 3746}, 3748},
+    {0, 0, {0, 3752, 3752}, 3754}, {0, 0, {0, 3758, 3758}, 3760},
+    {0, 0, {0, 0, 0}, 3764}, {0, 0, {0, 0, 0}, 3767}, {0, 0, {0, 0, 0}, 3770},
+    {0, 0, {0, 0, 0}, 3774}, {0, 0, {0, 0, 0}, 3778}, {0, 0, {0, 0, 0}, 3782},
+    {0, 0, {0, 0, 0}, 3786}, {0, 0, {0, 0, 0}, 3790},
+    {0, 0, {0, 3794, 3794}, 3796}, {0, 0, {0, 3799, 3799}, 3801},
+    {0, 0, {0, 3804, 3804}, 3806}, {0, 0, {0, 3810, 3810}, 3812},
+    {0, 0, {0, 3816, 3816}, 3818}, {0, 0, {0, 3822, 3822}, 3824},
+    {0, 0, {0, 3828, 3828}, 3830}, {0, 0, {0, 3834, 3834}, 3836},
+    {0, 0, {0, 0, 0}, 3840}, {0, 0, {0, 0, 0}, 3843}, {0, 0, {0, 0, 0}, 3846},
+    {0, 0, {0, 0, 0}, 3850}, {0, 0, {0, 0, 0}, 3854}, {0, 0, {0, 0, 0}, 3858},
+    {0, 0, {0, 0, 0}, 3862}, {0, 0, {0, 0, 0}, 3866},
+    {0, 0, {0, 3870, 3870}, 3872}, {0, 0, {0, 3875, 3875}, 3877},
+    {0, 0, {0, 3880, 3880}, 3882}, {0, 0, {0, 3886, 3886}, 3888},
+    {0, 0, {0, 3892, 3892}, 3894}, {0, 0, {0, 3898, 3898}, 3900},
+    {0, 0, {0, 3904, 3904}, 3906}, {0, 0, {0, 3910, 3910}, 3912},
+    {0, 0, {0, 0, 0}, 3916}, {0, 0, {0, 0, 0}, 3919}, {0, 0, {0, 0, 0}, 3922},
+    {0, 0, {0, 0, 0}, 3926}, {0, 0, {0, 0, 0}, 3930}, {0, 0, {0, 0, 0}, 3934},
+    {0, 0, {0, 3938, 3938}, 3940}, {0, 0, {0, 3943, 3943}, 3945},
+    {0, 0, {0, 3948, 3948}, 3950}, {0, 0, {0, 3954, 3954}, 3956},
+    {0, 0, {0, 3960, 3960}, 3962}, {0, 0, {0, 3966, 3966}, 3968},
+    {0, 0, {0, 3972, 0}, 3972}, {0, 0, {0, 0, 0}, 3975},
+    {0, 0, {0, 3978, 0}, 3978}, {0, 0, {0, 0, 0}, 3982},
+    {0, 0, {0, 3986, 0}, 3986}, {0, 0, {0, 0, 0}, 3990},
+    {0, 0, {0, 3994, 0}, 3994}, {0, 0, {0, 0, 0}, 3998},
+    {0, 0, {0, 4002, 4002}, 4004}, {0, 0, {0, 4007, 4007}, 4009},
+    {0, 0, {0, 4013, 4013}, 4015}, {0, 0, {0, 4019, 4019}, 4021},
+    {0, 0, {0, 0, 0}, 4025}, {0, 0, {0, 0, 0}, 4028}, {0, 0, {0, 0, 0}, 4031},
+    {0, 0, {0, 0, 0}, 4035}, {0, 0, {0, 0, 0}, 4039}, {0, 0, {0, 0, 0}, 4043},
+    {0, 0, {0, 0, 0}, 4047}, {0, 0, {0, 0, 0}, 4051},
+    {0, 0, {0, 4055, 4055}, 4057}, {0, 0, {0, 4060, 4060}, 4062},
+    {0, 0, {0, 4065, 4065}, 4067}, {0, 0, {0, 4071, 4071}, 4073},
+    {0, 0, {0, 4077, 4077}, 4079}, {0, 0, {0, 4083, 4083}, 4085},
+    {0, 0, {0, 4089, 4089}, 4091}, {0, 0, {0, 4095, 4095}, 4097},
+    {0, 0, {0, 0, 0}, 4101}, {0, 0, {1376, 0, 1376}, 1471},
+    {0, 0, {0, 0, 0}, 4104}, {0, 0, {1383, 0, 1383}, 1474},
+    {0, 0, {0, 0, 0}, 4107}, {0, 0, {1388, 0, 1388}, 1477},
+    {0, 0, {0, 0, 0}, 4110}, {0, 0, {1393, 0, 1393}, 1480},
+    {0, 0, {0, 0, 0}, 4113}, {0, 0, {1398, 0, 1398}, 1493},
+    {0, 0, {0, 0, 0}, 4116}, {0, 0, {1403, 0, 1403}, 1496},
+    {0, 0, {0, 0, 0}, 4119}, {0, 0, {1408, 0, 1408}, 1499},
+    {0, 0, {0, 4122, 4125}, 4125}, {0, 0, {0, 4129, 4132}, 4132},
+    {0, 0, {0, 4136, 4139}, 4139}, {0, 0, {0, 4144, 4147}, 4147},
+    {0, 0, {0, 4152, 4155}, 4155}, {0, 0, {0, 4160, 4163}, 4163},
+    {0, 0, {0, 4168, 4171}, 4171}, {0, 0, {0, 4176, 4179}, 4179},
+    {0, 0, {0, 4122, 4125}, 4184}, {0, 0, {0, 4129, 4132}, 4188},
+    {0, 0, {0, 4136, 4139}, 4192}, {0, 0, {0, 4144, 4147}, 4197},
+    {0, 0, {0, 4152, 4155}, 4202}, {0, 0, {0, 4160, 4163}, 4207},
+    {0, 0, {0, 4168, 4171}, 4212}, {0, 0, {0, 4176, 4179}, 4217},
+    {0, 0, {0, 4222, 4225}, 4225}, {0, 0, {0, 4229, 4232}, 4232},
+    {0, 0, {0, 4236, 4239}, 4239}, {0, 0, {0, 4244, 4247}, 4247},
+    {0, 0, {0, 4252, 4255}, 4255}, {0, 0, {0, 4260, 4263}, 4263},
+    {0, 0, {0, 4268, 4271}, 4271}, {0, 0, {0, 4276, 4279}, 4279},
+    {0, 0, {0, 4222, 4225}, 4284}, {0, 0, {0, 4229, 4232}, 4288},
+    {0, 0, {0, 4236, 4239}, 4292}, {0, 0, {0, 4244, 4247}, 4297},
+    {0, 0, {0, 4252, 4255}, 4302}, {0, 0, {0, 4260, 4263}, 4307},
+    {0, 0, {0, 4268, 4271}, 4312}, {0, 0, {0, 4276, 4279}, 4317},
+    {0, 0, {0, 4322, 4325}, 4325}, {0, 0, {0, 4329, 4332}, 4332},
+    {0, 0, {0, 4336, 4339}, 4339}, {0, 0, {0, 4344, 4347}, 4347},
+    {0, 0, {0, 4352, 4355}, 4355}, {0, 0, {0, 4360, 4363}, 4363},
+    {0, 0, {0, 4368, 4371}, 4371}, {0, 0, {0, 4376, 4379}, 4379},
+    {0, 0, {0, 4322, 4325}, 4384}, {0, 0, {0, 4329, 4332}, 4388},
+    {0, 0, {0, 4336, 4339}, 4392}, {0, 0, {0, 4344, 4347}, 4397},
+    {0, 0, {0, 4352, 4355}, 4402}, {0, 0, {0, 4360, 4363}, 4407},
+    {0, 0, {0, 4368, 4371}, 4412}, {0, 0, {0, 4376, 4379}, 4417},
+    {0, 0, {0, 0, 0}, 4422}, {0, 0, {0, 0, 0}, 4425},
+    {0, 0, {0, 4428, 4431}, 4431}, {0, 0, {0, 4435, 4438}, 4438},
+    {0, 0, {0, 4441, 4444}, 4444}, {0, 0, {0, 4448, 0}, 4448},
+    {0, 0, {0, 4451, 4455}, 4455}, {0, 0, {0, 4459, 4459}, 4461},
+    {0, 0, {0, 4464, 4464}, 4466}, {0, 0, {0, 4469, 4469}, 4471},
+    {0, 0, {4474, 4476, 1376}, 1378}, {0, 0, {0, 4435, 4438}, 4478},
+    {0, 0, {4481, 0, 4481}, 0}, {0, 0, {1349, 1349, 1349}, 0},
+    {0, 0, {4484, 0, 4484}, 0}, {0, 0, {4487, 0, 4487}, 4491},
+    {0, 0, {0, 4494, 4497}, 4497}, {0, 0, {0, 4501, 4504}, 4504},
+    {0, 0, {0, 4507, 4510}, 4510}, {0, 0, {0, 4514, 0}, 4514},
+    {0, 0, {0, 4517, 4521}, 4521}, {0, 0, {0, 4525, 4525}, 4527},
+    {0, 0, {4530, 4532, 1383}, 1385}, {0, 0, {0, 4534, 4534}, 4536},
+    {0, 0, {4539, 4541, 1388}, 1390}, {0, 0, {0, 4501, 4504}, 4543},
+    {0, 0, {4546, 0, 4546}, 4550}, {0, 0, {4553, 0, 4553}, 4557},
+    {0, 0, {4560, 0, 4560}, 4564}, {0, 0, {0, 0, 0}, 4567},
+    {0, 0, {0, 0, 0}, 4570}, {0, 0, {0, 4573, 0}, 4573},
+    {0, 0, {4577, 1413, 4577}, 1413}, {0, 0, {0, 4579, 0}, 4579},
+    {0, 0, {0, 4582, 0}, 4582}, {0, 0, {0, 4586, 4586}, 4588},
+    {0, 0, {0, 4591, 4591}, 4593}, {0, 0, {0, 4596, 4596}, 4598},
+    {0, 0, {4601, 4603, 1393}, 1395}, {0, 0, {4605, 0, 4605}, 4609},
+    {0, 0, {4612, 0, 4612}, 4616}, {0, 0, {4619, 0, 4619}, 4623},
+    {0, 0, {0, 0, 0}, 4626}, {0, 0, {0, 0, 0}, 4629},
+    {0, 0, {0, 4632, 0}, 4632}, {0, 0, {4636, 1483, 4636}, 1483},
+    {0, 0, {0, 4638, 0}, 4638}, {0, 0, {0, 0, 0}, 4641},
+    {0, 0, {0, 4644, 0}, 4644}, {0, 0, {0, 4647, 0}, 4647},
+    {0, 0, {0, 4651, 4651}, 4653}, {0, 0, {0, 4656, 4656}, 4658},
+    {0, 0, {0, 4661, 4661}, 4663}, {0, 0, {1506, 4666, 1403}, 1405},
+    {0, 0, {0, 4668, 4668}, 4670}, {0, 0, {4673, 0, 4673}, 4677},
+    {0, 0, {4680, 0, 4680}, 0}, {0, 0, {0, 4682, 4685}, 4685},
+    {0, 0, {0, 4689, 4692}, 4692}, {0, 0, {0, 4695, 4698}, 4698},
+    {0, 0, {0, 4702, 0}, 4702}, {0, 0, {0, 4705, 4709}, 4709},
+    {0, 0, {0, 4713, 4713}, 4715}, {0, 0, {4718, 4720, 1398}, 1400},
+    {0, 0, {0, 4722, 4722}, 4724}, {0, 0, {4727, 4729, 1408}, 1410},
+    {0, 0, {0, 4689, 4692}, 4731}, {0, 0, {4734, 0, 4734}, 0},
+    {0, 0, {4737, 0, 4737}, 0}, {0, 0, {4739, 0, 4739}, 0},
+    {0, 0, {4742, 0, 4742}, 0}, {0, 0, {4744, 0, 4744}, 0},
+    {0, 0, {4747, 0, 4747}, 0}, {0, 0, {4751, 0, 4751}, 0},
+    {0, 0, {4754, 0, 4754}, 0}, {0, 0, {4758, 0, 4758}, 0},
+    {0, 0, {4761, 0, 4761}, 0}, {0, 0, {4765, 0, 4765}, 0},
+    {0, 0, {4768, 0, 4768}, 0}, {0, 0, {4771, 0, 4771}, 0},
+    {0, 0, {4774, 0, 4774}, 0}, {0, 0, {4777, 0, 4777}, 0},
+    {0, 0, {4780, 0, 4780}, 0}, {0, 0, {4782, 0, 4782}, 0},
+    {0, 0, {4784, 0, 4784}, 0}, {0, 0, {4786, 0, 4786}, 0},
+    {0, 0, {4788, 0, 4788}, 0}, {0, 0, {4790, 0, 4790}, 0},
+    {0, 0, {4792, 0, 4792}, 0}, {0, 0, {4794, 0, 4794}, 0},
+    {0, 0, {4796, 0, 4796}, 0}, {0, 0, {4798, 0, 4798}, 0},
+    {0, 0, {4800, 0, 4800}, 0}, {0, 0, {4802, 0, 4802}, 0},
+    {0, 0, {27, 0, 27}, 0}, {0, 0, {4804, 0, 4807}, 0},
+    {0, 0, {4810, 0, 4810}, 0}, {0, 0, {4814, 0, 4814}, 0},
+    {0, 0, {4818, 0, 5}, 0}, {0, 0, {4820, 0, 4823}, 0},
+    {0, 0, {4826, 0, 4826}, 0}, {0, 0, {4830, 0, 4830}, 0},
+    {0, 0, {4834, 0, 795}, 0}, {0, 0, {4836, 0, 4839}, 0},
+    {0, 0, {455, 0, 455}, 0}, {0, 0, {4842, 0, 4845}, 0},
+    {0, 0, {4848, 0, 33}, 0}, {0, 0, {4850, 0, 4853}, 0},
+    {0, 0, {4856, 0, 4860}, 0}, {0, 0, {4864, 0, 4867}, 0},
+    {0, 0, {4870, 0, 51}, 0}, {0, 0, {4872, 1459, 1459}, 0},
+    {0, 0, {2476, 21, 21}, 0}, {0, 0, {4874, 112, 112}, 114},
+    {0, 0, {4876, 0, 11}, 0}, {0, 0, {0, 4878, 4878}, 0},
+    {0, 0, {4880, 0, 4880}, 0}, {0, 0, {4882, 0, 4882}, 0},
+    {0, 0, {4884, 0, 4884}, 0}, {0, 0, {4886, 0, 4886}, 0},
+    {0, 0, {4888, 0, 4892}, 0}, {0, 0, {1443, 0, 1443}, 0},
+    {0, 0, {4896, 0, 1421}, 0}, {0, 0, {4898, 0, 1443}, 0},
+    {0, 0, {4900, 0, 4900}, 0}, {0, 0, {4902, 0, 4902}, 0},
+    {0, 0, {4906, 0, 4906}, 0}, {0, 0, {4910, 0, 4910}, 0},
+    {0, 0, {4915, 0, 4915}, 0}, {0, 0, {4919, 0, 4919}, 0},
+    {0, 0, {4923, 0, 4923}, 0}, {0, 0, {4927, 0, 4927}, 0},
+    {0, 0, {4931, 0, 4931}, 0}, {0, 0, {4935, 0, 4935}, 0},
+    {0, 0, {4939, 0, 4939}, 0}, {0, 0, {4943, 0, 4943}, 0},
+    {0, 0, {4947, 0, 4947}, 0}, {0, 0, {4951, 0, 4951}, 0},
+    {0, 0, {4955, 0, 4955}, 0}, {0, 0, {4959, 0, 4959}, 0},
+    {0, 0, {4963, 0, 4963}, 0}, {0, 0, {2472, 4966, 17}, 0},
+    {0, 0, {4968, 4971, 4973}, 0}, {0, 0, {4976, 4980, 4982}, 0},
+    {0, 0, {4986, 4989, 4991}, 0}, {0, 0, {4994, 4996, 43}, 0},
+    {0, 0, {4998, 5001, 5003}, 0}, {0, 0, {5006, 5010, 5012}, 0},
+    {0, 0, {5016, 5021, 5023}, 0}, {0, 0, {5028, 5031, 5033}, 0},
+    {0, 0, {5036, 5038, 47}, 0}, {0, 0, {5040, 5043, 5045}, 0},
+    {0, 0, {5048, 5052, 5054}, 0}, {0, 0, {2478, 5058, 23}, 0},
+    {0, 0, {4818, 5060, 5}, 0}, {0, 0, {2462, 5062, 7}, 0},
+    {0, 0, {2480, 5064, 25}, 0}, {0, 0, {4973, 0, 4973}, 0},
+    {0, 0, {4982, 0, 4982}, 0}, {0, 0, {4991, 0, 4991}, 0},
+    {0, 0, {5003, 0, 5003}, 0}, {0, 0, {5012, 0, 5012}, 0},
+    {0, 0, {5023, 0, 5023}, 0}, {0, 0, {5033, 0, 5033}, 0},
+    {0, 0, {5045, 0, 5045}, 0}, {0, 0, {5054, 0, 5054}, 0},
+    {0, 0, {0, 5066, 5066}, 0}, {0, 0, {5068, 0, 5068}, 0},
+    {0, 0, {0, 0, 0}, 5072}, {0, 0, {0, 0, 0}, 5075}, {0, 0, {0, 0, 0}, 5078},
+    {0, 0, {0, 0, 0}, 5081}, {0, 0, {0, 0, 0}, 5084}, {0, 0, {0, 0, 0}, 5087},
+    {0, 0, {0, 0, 0}, 5090}, {0, 0, {0, 0, 0}, 5093}, {0, 0, {0, 0, 0}, 5096},
+    {0, 0, {0, 0, 0}, 5099}, {0, 0, {0, 0, 0}, 5102},
+    {0, 0, {5105, 0, 5105}, 0}, {0, 0, {5108, 0, 5108}, 0},
+    {0, 0, {5112, 0, 5112}, 0}, {0, 0, {5115, 0, 5115}, 0},
+    {0, 0, {0, 0, 0}, 5119}, {0, 0, {0, 0, 0}, 5122}, {0, 0, {0, 0, 0}, 5125},
+    {0, 0, {0, 0, 0}, 5128}, {0, 0, {0, 0, 0}, 5131}, {0, 0, {0, 0, 0}, 5134},
+    {0, 0, {0, 0, 0}, 5137}, {0, 0, {0, 0, 0}, 5140}, {0, 0, {0, 0, 0}, 5143},
+    {0, 0, {0, 0, 0}, 5146}, {0, 0, {0, 0, 0}, 5149}, {0, 0, {0, 0, 0}, 5152},
+    {0, 0, {0, 0, 0}, 5155}, {0, 0, {0, 0, 0}, 5158}, {0, 0, {0, 0, 0}, 5161},
+    {0, 0, {0, 0, 0}, 5164}, {0, 0, {0, 0, 0}, 5167}, {0, 0, {0, 0, 0}, 5170},
+    {0, 0, {0, 0, 0}, 5173}, {0, 0, {0, 0, 0}, 5176}, {0, 0, {0, 0, 0}, 5179},
+    {0, 0, {0, 0, 0}, 5182}, {0, 0, {0, 0, 0}, 5185}, {0, 0, {0, 0, 0}, 5188},
+    {0, 0, {0, 0, 0}, 5191}, {0, 0, {0, 0, 0}, 5194}, {0, 0, {0, 0, 0}, 5197},
+    {0, 0, {0, 0, 0}, 5200}, {0, 0, {0, 0, 0}, 5203}, {0, 0, {0, 0, 0}, 5206},
+    {0, 0, {0, 0, 0}, 5209}, {0, 0, {0, 0, 0}, 5212}, {0, 0, {0, 0, 0}, 5215},
+    {0, 0, {5218, 0, 5218}, 0}, {0, 0, {5220, 0, 5220}, 0},
+    {0, 0, {5222, 0, 5222}, 0}, {0, 0, {5225, 0, 5225}, 0},
+    {0, 0, {5228, 0, 5228}, 0}, {0, 0, {5231, 0, 5231}, 0},
+    {0, 0, {5234, 0, 5234}, 0}, {0, 0, {5237, 0, 5237}, 0},
+    {0, 0, {5240, 0, 5240}, 0}, {0, 0, {5243, 0, 5243}, 0},
+    {0, 0, {5246, 0, 5246}, 0}, {0, 0, {5249, 0, 5249}, 0},
+    {0, 0, {5252, 0, 5252}, 0}, {0, 0, {5255, 0, 5255}, 0},
+    {0, 0, {5259, 0, 5259}, 0}, {0, 0, {5263, 0, 5263}, 0},
+    {0, 0, {5267, 0, 5267}, 0}, {0, 0, {5271, 0, 5271}, 0},
+    {0, 0, {5275, 0, 5275}, 0}, {0, 0, {5279, 0, 5279}, 0},
+    {0, 0, {5283, 0, 5283}, 0}, {0, 0, {5287, 0, 5287}, 0},
+    {0, 0, {5291, 0, 5291}, 0}, {0, 0, {5296, 0, 5296}, 0},
+    {0, 0, {5301, 0, 5301}, 0}, {0, 0, {5306, 0, 5306}, 0},
+    {0, 0, {5311, 0, 5311}, 0}, {0, 0, {5316, 0, 5316}, 0},
+    {0, 0, {5321, 0, 5321}, 0}, {0, 0, {5326, 0, 5326}, 0},
+    {0, 0, {5331, 0, 5331}, 0}, {0, 0, {5336, 0, 5336}, 0},
+    {0, 0, {5341, 0, 5341}, 0}, {0, 0, {5346, 0, 5346}, 0},
+    {0, 0, {5349, 0, 5349}, 0}, {0, 0, {5352, 0, 5352}, 0},
+    {0, 0, {5355, 0, 5355}, 0}, {0, 0, {5358, 0, 5358}, 0},
+    {0, 0, {5361, 0, 5361}, 0}, {0, 0, {5364, 0, 5364}, 0},
+    {0, 0, {5367, 0, 5367}, 0}, {0, 0, {5370, 0, 5370}, 0},
+    {0, 0, {5373, 0, 5373}, 0}, {0, 0, {5377, 0, 5377}, 0},
+    {0, 0, {5381, 0, 5381}, 0}, {0, 0, {5385, 0, 5385}, 0},
+    {0, 0, {5389, 0, 5389}, 0}, {0, 0, {5393, 0, 5393}, 0},
+    {0, 0, {5397, 0, 5397}, 0}, {0, 0, {5401, 0, 5401}, 0},
+    {0, 0, {5405, 0, 5405}, 0}, {0, 0, {5409, 0, 5409}, 0},
+    {0, 0, {5413, 0, 5413}, 0}, {0, 0, {5417, 0, 5417}, 0},
+    {0, 0, {5421, 0, 5421}, 0}, {0, 0, {5425, 0, 5425}, 0},
+    {0, 0, {5429, 0, 5429}, 0}, {0, 0, {5433, 0, 5433}, 0},
+    {0, 0, {5437, 0, 5437}, 0}, {0, 0, {5441, 0, 5441}, 0},
+    {0, 0, {5445, 0, 5445}, 0}, {0, 0, {5449, 0, 5449}, 0},
+    {0, 0, {5453, 0, 5453}, 0}, {0, 0, {5457, 0, 5457}, 0},
+    {0, 0, {5461, 0, 5461}, 0}, {0, 0, {5465, 0, 5465}, 0},
+    {0, 0, {5469, 0, 5469}, 0}, {0, 0, {5473, 0, 5473}, 0},
+    {0, 0, {5477, 0, 5477}, 0}, {0, 0, {5481, 0, 5481}, 0},
+    {0, 0, {5485, 0, 5485}, 0}, {0, 0, {5489, 0, 5489}, 0},
+    {0, 0, {5493, 0, 5493}, 0}, {0, 0, {5497, 0, 5497}, 0},
+    {0, 0, {5501, 0, 5501}, 0}, {0, 0, {5505, 0, 5505}, 0},
+    {0, 0, {5509, 0, 5509}, 0}, {0, 0, {5513, 0, 5513}, 0},
+    {0, 0, {5517, 0, 5517}, 0}, {0, 0, {2456, 5521, 1}, 0},
+    {0, 0, {2460, 5523, 3}, 0}, {0, 0, {4818, 5525, 5}, 0},
+    {0, 0, {2462, 5527, 7}, 0}, {0, 0, {2464, 5529, 9}, 0},
+    {0, 0, {4876, 5531, 11}, 0}, {0, 0, {2468, 5533, 13}, 0},
+    {0, 0, {2470, 5535, 15}, 0}, {0, 0, {2472, 5537, 17}, 0},
+    {0, 0, {2474, 5539, 19}, 0}, {0, 0, {2476, 5541, 21}, 0},
+    {0, 0, {2478, 5543, 23}, 0}, {0, 0, {2480, 5545, 25}, 0},
+    {0, 0, {2482, 5547, 27}, 0}, {0, 0, {2484, 5549, 29}, 0},
+    {0, 0, {2488, 5551, 31}, 0}, {0, 0, {4848, 5553, 33}, 0},
+    {0, 0, {2490, 5555, 35}, 0}, {0, 0, {5557, 5559, 37}, 0},
+    {0, 0, {2492, 5561, 39}, 0}, {0, 0, {2494, 5563, 41}, 0},
+    {0, 0, {4994, 5565, 43}, 0}, {0, 0, {2496, 5567, 45}, 0},
+    {0, 0, {5036, 5569, 47}, 0}, {0, 0, {5571, 5573, 49}, 0},
+    {0, 0, {4870, 5575, 51}, 0}, {0, 0, {33, 0, 33}, 0},
+    {0, 0, {5577, 0, 5577}, 0}, {0, 0, {5581, 0, 5581}, 0},
+    {0, 0, {5584, 0, 5584}, 0}, {0, 0, {5588, 0, 5588}, 5588},
+    {0, 0, {0, 5591, 5591}, 0}, {0, 0, {0, 5593, 5593}, 0},
+    {0, 0, {0, 5595, 5595}, 0}, {0, 0, {0, 5597, 5597}, 0},
+    {0, 0, {0, 5599, 5599}, 0}, {0, 0, {0, 5601, 5601}, 0},
+    {0, 0, {0, 5603, 5603}, 0}, {0, 0, {0, 5605, 5605}, 0},
+    {0, 0, {0, 5607, 5607}, 0}, {0, 0, {0, 5609, 5609}, 0},
+    {0, 0, {0, 5611, 5611}, 0}, {0, 0, {0, 5613, 5613}, 0},
+    {0, 0, {0, 5615, 5615}, 0}, {0, 0, {0, 5617, 5617}, 0},
+    {0, 0, {0, 5619, 5619}, 0}, {0, 0, {0, 5621, 5621}, 0},
+    {0, 0, {0, 5623, 5623}, 0}, {0, 0, {0, 5625, 5625}, 0},
+    {0, 0, {0, 5627, 5627}, 0}, {0, 0, {0, 5629, 5629}, 0},
+    {0, 0, {0, 5631, 5631}, 0}, {0, 0, {0, 5633, 5633}, 0},
+    {0, 0, {0, 5635, 5635}, 0}, {0, 0, {0, 5637, 5637}, 0},
+    {0, 0, {0, 5639, 5639}, 0}, {0, 0, {0, 5641, 5641}, 0},
+    {0, 0, {0, 5643, 5643}, 0}, {0, 0, {0, 5645, 5645}, 0},
+    {0, 0, {0, 5647, 5647}, 0}, {0, 0, {0, 5649, 5649}, 0},
+    {0, 0, {0, 5651, 5651}, 0}, {0, 0, {0, 5653, 5653}, 0},
+    {0, 0, {0, 5655, 5655}, 0}, {0, 0, {0, 5657, 5657}, 0},
+    {0, 0, {0, 5659, 5659}, 0}, {0, 0, {0, 5661, 5661}, 0},
+    {0, 0, {0, 5663, 5663}, 0}, {0, 0, {0, 5665, 5665}, 0},
+    {0, 0, {0, 5667, 5667}, 0}, {0, 0, {0, 5669, 5669}, 0},
+    {0, 0, {0, 5671, 5671}, 0}, {0, 0, {0, 5673, 5673}, 0},
+    {0, 0, {0, 5675, 5675}, 0}, {0, 0, {0, 5677, 5677}, 0},
+    {0, 0, {0, 5679, 5679}, 0}, {0, 0, {0, 5681, 5681}, 0},
+    {0, 0, {0, 5683, 5683}, 0}, {0, 0, {0, 5685, 5685}, 0},
+    {0, 0, {0, 5687, 5687}, 0}, {0, 0, {0, 5689, 5689}, 0},
+    {0, 0, {0, 5691, 5691}, 0}, {0, 0, {0, 5693, 5693}, 0},
+    {0, 0, {0, 5695, 5695}, 0}, {0, 0, {0, 5697, 5697}, 0},
+    {0, 0, {0, 5699, 5699}, 0}, {0, 0, {0, 2500, 2500}, 0},
+    {0, 0, {0, 2536, 2536}, 0}, {0, 0, {0, 2498, 2498}, 0},
+    {0, 0, {0, 2514, 2514}, 0}, {0, 0, {0, 5701, 5701}, 0},
+    {0, 0, {0, 5703, 5703}, 0}, {0, 0, {4994, 0, 43}, 0},
+    {0, 0, {0, 5705, 5705}, 0}, {0, 0, {0, 5707, 5707}, 0},
+    {0, 0, {0, 5709, 5709}, 0}, {0, 0, {0, 5711, 5711}, 0},
+    {0, 0, {0, 5713, 5713}, 0}, {0, 0, {0, 5715, 5715}, 0},
+    {0, 0, {0, 5717, 5717}, 0}, {0, 0, {0, 5719, 5719}, 0},
+    {0, 0, {0, 5721, 5721}, 0}, {0, 0, {0, 5723, 5723}, 0},
+    {0, 0, {0, 5725, 5725}, 0}, {0, 0, {0, 5727, 5727}, 0},
+    {0, 0, {0, 5729, 5729}, 0}, {0, 0, {0, 5731, 5731}, 0},
+    {0, 0, {0, 5733, 5733}, 0}, {0, 0, {0, 5735, 5735}, 0},
+    {0, 0, {0, 5737, 5737}, 0}, {0, 0, {0, 5739, 5739}, 0},
+    {0, 0, {0, 5741, 5741}, 0}, {0, 0, {0, 5743, 5743}, 0},
+    {0, 0, {0, 5745, 5745}, 0}, {0, 0, {0, 5747, 5747}, 0},
+    {0, 0, {0, 5749, 5749}, 0}, {0, 0, {0, 5751, 5751}, 0},
+    {0, 0, {0, 5753, 5753}, 0}, {0, 0, {0, 5755, 5755}, 0},
+    {0, 0, {0, 5757, 5757}, 0}, {0, 0, {0, 5759, 5759}, 0},
+    {0, 0, {0, 5761, 5761}, 0}, {0, 0, {0, 5763, 5763}, 0},
+    {0, 0, {0, 5765, 5765}, 0}, {0, 0, {0, 5767, 5767}, 0},
+    {0, 0, {0, 5769, 5769}, 0}, {0, 0, {0, 5771, 5771}, 0},
+    {0, 0, {0, 5773, 5773}, 0}, {0, 0, {0, 5775, 5775}, 0},
+    {0, 0, {0, 5777, 5777}, 0}, {0, 0, {0, 5779, 5779}, 0},
+    {0, 0, {0, 5781, 5781}, 0}, {0, 0, {0, 5783, 5783}, 0},
+    {0, 0, {0, 5785, 5785}, 0}, {0, 0, {0, 5787, 5787}, 0},
+    {0, 0, {0, 5789, 5789}, 0}, {0, 0, {0, 5791, 5791}, 0},
+    {0, 0, {0, 5793, 5793}, 0}, {0, 0, {0, 5795, 5795}, 0},
+    {0, 0, {0, 5797, 5797}, 0}, {0, 0, {0, 5799, 5799}, 0},
+    {0, 0, {0, 5801, 5801}, 0}, {0, 0, {0, 5803, 5803}, 0},
+    {0, 0, {0, 5805, 5805}, 0}, {0, 0, {0, 5807, 5807}, 0},
+    {0, 0, {0, 5809, 5809}, 0}, {0, 0, {0, 5811, 5811}, 0},
+    {0, 0, {0, 5813, 5813}, 0}, {0, 0, {5815, 0, 5815}, 0},
+    {0, 0, {5817, 0, 5817}, 0}, {0, 0, {5819, 0, 5819}, 0},
+    {0, 0, {5821, 0, 5821}, 0}, {0, 0, {5823, 0, 5823}, 0},
+    {0, 0, {5825, 0, 5825}, 0}, {0, 0, {5827, 0, 5827}, 0},
+    {0, 0, {5829, 0, 5829}, 0}, {0, 0, {5831, 0, 5831}, 0},
+    {0, 0, {5833, 0, 5833}, 0}, {0, 0, {5835, 0, 5835}, 0},
+    {0, 0, {5837, 0, 5837}, 0}, {0, 0, {5839, 0, 5839}, 0},
+    {0, 0, {5841, 0, 5841}, 0}, {0, 0, {5843, 0, 5843}, 0},
+    {0, 0, {5845, 0, 5845}, 0}, {0, 0, {5847, 0, 5847}, 0},
+    {0, 0, {5849, 0, 5849}, 0}, {0, 0, {5851, 0, 5851}, 0},
+    {0, 0, {5853, 0, 5853}, 0}, {0, 0, {5855, 0, 5855}, 0},
+    {0, 0, {5857, 0, 5857}, 0}, {0, 0, {5859, 0, 5859}, 0},
+    {0, 0, {5861, 0, 5861}, 0}, {0, 0, {5863, 0, 5863}, 0},
+    {0, 0, {5865, 0, 5865}, 0}, {0, 0, {5867, 0, 5867}, 0},
+    {0, 0, {5869, 0, 5869}, 0}, {0, 0, {5871, 0, 5871}, 0},
+    {0, 0, {5873, 0, 5873}, 0}, {0, 0, {5875, 0, 5875}, 0},
+    {0, 0, {5877, 0, 5877}, 0}, {0, 0, {5879, 0, 5879}, 0},
+    {0, 0, {5881, 0, 5881}, 0}, {0, 0, {5883, 0, 5883}, 0},
+    {0, 0, {5885, 0, 5885}, 0}, {0, 0, {5887, 0, 5887}, 0},
+    {0, 0, {5889, 0, 5889}, 0}, {0, 0, {5891, 0, 5891}, 0},
+    {0, 0, {5893, 0, 5893}, 0}, {0, 0, {5895, 0, 5895}, 0},
+    {0, 0, {5897, 0, 5897}, 0}, {0, 0, {5899, 0, 5899}, 0},
+    {0, 0, {5901, 0, 5901}, 0}, {0, 0, {5903, 0, 5903}, 0},
+    {0, 0, {5905, 0, 5905}, 0}, {0, 0, {5907, 0, 5907}, 0},
+    {0, 0, {5909, 0, 5909}, 0}, {0, 0, {5911, 0, 5911}, 0},
+    {0, 0, {5913, 0, 5913}, 0}, {0, 0, {5915, 0, 5915}, 0},
+    {0, 0, {5917, 0, 5917}, 0}, {0, 0, {5919, 0, 5919}, 0},
+    {0, 0, {5921, 0, 5921}, 0}, {0, 0, {5923, 0, 5923}, 0},
+    {0, 0, {5925, 0, 5925}, 0}, {0, 0, {5927, 0, 5927}, 0},
+    {0, 0, {5929, 0, 5929}, 0}, {0, 0, {5931, 0, 5931}, 0},
+    {0, 0, {5933, 0, 5933}, 0}, {0, 0, {5935, 0, 5935}, 0},
+    {0, 0, {5937, 0, 5937}, 0}, {0, 0, {5939, 0, 5939}, 0},
+    {0, 0, {5941, 0, 5941}, 0}, {0, 0, {5943, 0, 5943}, 0},
+    {0, 0, {5945, 0, 5945}, 0}, {0, 0, {5947, 0, 5947}, 0},
+    {0, 0, {5949, 0, 5949}, 0}, {0, 0, {5951, 0, 5951}, 0},
+    {0, 0, {5953, 0, 5953}, 0}, {0, 0, {5955, 0, 5955}, 0},
+    {0, 0, {5957, 0, 5957}, 0}, {0, 0, {5959, 0, 5959}, 0},
+    {0, 0, {5961, 0, 5961}, 0}, {0, 0, {5963, 0, 5963}, 0},
+    {0, 0, {5965, 0, 5965}, 0}, {0, 0, {5967, 0, 5967}, 0},
+    {0, 0, {5969, 0, 5969}, 0}, {0, 0, {5971, 0, 5971}, 0},
+    {0, 0, {5973, 0, 5973}, 0}, {0, 0, {5975, 0, 5975}, 0},
+    {0, 0, {5977, 0, 5977}, 0}, {0, 0, {5979, 0, 5979}, 0},
+    {0, 0, {5981, 0, 5981}, 0}, {0, 0, {5983, 0, 5983}, 0},
+    {0, 0, {5985, 0, 5985}, 0}, {0, 0, {5987, 0, 5987}, 0},
+    {0, 0, {5989, 0, 5989}, 0}, {0, 0, {5991, 0, 5991}, 0},
+    {0, 0, {5993, 0, 5993}, 0}, {0, 0, {5995, 0, 5995}, 0},
+    {0, 0, {5997, 0, 5997}, 0}, {0, 0, {5999, 0, 5999}, 0},
+    {0, 0, {6001, 0, 6001}, 0}, {0, 0, {6003, 0, 6003}, 0},
+    {0, 0, {6005, 0, 6005}, 0}, {0, 0, {6007, 0, 6007}, 0},
+    {0, 0, {6009, 0, 6009}, 0}, {0, 0, {6011, 0, 6011}, 0},
+    {0, 0, {6013, 0, 6013}, 0}, {0, 0, {6015, 0, 6015}, 0},
+    {0, 0, {6017, 0, 6017}, 0}, {0, 0, {6019, 0, 6019}, 0},
+    {0, 0, {6021, 0, 6021}, 0}, {0, 0, {6023, 0, 6023}, 0},
+    {0, 0, {6025, 0, 6025}, 0}, {0, 0, {6027, 0, 6027}, 0},
+    {0, 0, {6029, 0, 6029}, 0}, {0, 0, {6031, 0, 6031}, 0},
+    {0, 0, {6033, 0, 6033}, 0}, {0, 0, {6035, 0, 6035}, 0},
+    {0, 0, {6037, 0, 6037}, 0}, {0, 0, {6039, 0, 6039}, 0},
+    {0, 0, {6041, 0, 6041}, 0}, {0, 0, {6043, 0, 6043}, 0},
+    {0, 0, {6045, 0, 6045}, 0}, {0, 0, {6047, 0, 6047}, 0},
+    {0, 0, {6049, 0, 6049}, 0}, {0, 0, {6051, 0, 6051}, 0},
+    {0, 0, {6053, 0, 6053}, 0}, {0, 0, {6055, 0, 6055}, 0},
+    {0, 0, {6057, 0, 6057}, 0}, {0, 0, {6059, 0, 6059}, 0},
+    {0, 0, {6061, 0, 6061}, 0}, {0, 0, {6063, 0, 6063}, 0},
+    {0, 0, {6065, 0, 6065}, 0}, {0, 0, {6067, 0, 6067}, 0},
+    {0, 0, {6069, 0, 6069}, 0}, {0, 0, {6071, 0, 6071}, 0},
+    {0, 0, {6073, 0, 6073}, 0}, {0, 0, {6075, 0, 6075}, 0},
+    {0, 0, {6077, 0, 6077}, 0}, {0, 0, {6079, 0, 6079}, 0},
+    {0, 0, {6081, 0, 6081}, 0}, {0, 0, {6083, 0, 6083}, 0},
+    {0, 0, {6085, 0, 6085}, 0}, {0, 0, {6087, 0, 6087}, 0},
+    {0, 0, {6089, 0, 6089}, 0}, {0, 0, {6091, 0, 6091}, 0},
+    {0, 0, {6093, 0, 6093}, 0}, {0, 0, {6095, 0, 6095}, 0},
+    {0, 0, {6097, 0, 6097}, 0}, {0, 0, {6099, 0, 6099}, 0},
+    {0, 0, {6101, 0, 6101}, 0}, {0, 0, {6103, 0, 6103}, 0},
+    {0, 0, {6105, 0, 6105}, 0}, {0, 0, {6107, 0, 6107}, 0},
+    {0, 0, {6109, 0, 6109}, 0}, {0, 0, {6111, 0, 6111}, 0},
+    {0, 0, {6113, 0, 6113}, 0}, {0, 0, {6115, 0, 6115}, 0},
+    {0, 0, {6117, 0, 6117}, 0}, {0, 0, {6119, 0, 6119}, 0},
+    {0, 0, {6121, 0, 6121}, 0}, {0, 0, {6123, 0, 6123}, 0},
+    {0, 0, {6125, 0, 6125}, 0}, {0, 0, {6127, 0, 6127}, 0},
+    {0, 0, {6129, 0, 6129}, 0}, {0, 0, {6131, 0, 6131}, 0},
+    {0, 0, {6133, 0, 6133}, 0}, {0, 0, {6135, 0, 6135}, 0},
+    {0, 0, {6137, 0, 6137}, 0}, {0, 0, {6139, 0, 6139}, 0},
+    {0, 0, {6141, 0, 6141}, 0}, {0, 0, {6143, 0, 6143}, 0},
+    {0, 0, {6145, 0, 6145}, 0}, {0, 0, {6147, 0, 6147}, 0},
+    {0, 0, {6149, 0, 6149}, 0}, {0, 0, {6151, 0, 6151}, 0},
+    {0, 0, {6153, 0, 6153}, 0}, {0, 0, {6155, 0, 6155}, 0},
+    {0, 0, {6157, 0, 6157}, 0}, {0, 0, {6159, 0, 6159}, 0},
+    {0, 0, {6161, 0, 6161}, 0}, {0, 0, {6163, 0, 6163}, 0},
+    {0, 0, {6165, 0, 6165}, 0}, {0, 0, {6167, 0, 6167}, 0},
+    {0, 0, {6169, 0, 6169}, 0}, {0, 0, {6171, 0, 6171}, 0},
+    {0, 0, {6173, 0, 6173}, 0}, {0, 0, {6175, 0, 6175}, 0},
+    {0, 0, {6177, 0, 6177}, 0}, {0, 0, {6179, 0, 6179}, 0},
+    {0, 0, {6181, 0, 6181}, 0}, {0, 0, {6183, 0, 6183}, 0},
+    {0, 0, {6185, 0, 6185}, 0}, {0, 0, {6187, 0, 6187}, 0},
+    {0, 0, {6189, 0, 6189}, 0}, {0, 0, {6191, 0, 6191}, 0},
+    {0, 0, {6193, 0, 6193}, 0}, {0, 0, {6195, 0, 6195}, 0},
+    {0, 0, {6197, 0, 6197}, 0}, {0, 0, {6199, 0, 6199}, 0},
+    {0, 0, {6201, 0, 6201}, 0}, {0, 0, {6203, 0, 6203}, 0},
+    {0, 0, {6205, 0, 6205}, 0}, {0, 0, {6207, 0, 6207}, 0},
+    {0, 0, {6209, 0, 6209}, 0}, {0, 0, {6211, 0, 6211}, 0},
+    {0, 0, {6213, 0, 6213}, 0}, {0, 0, {6215, 0, 6215}, 0},
+    {0, 0, {6217, 0, 6217}, 0}, {0, 0, {6219, 0, 6219}, 0},
+    {0, 0, {6221, 0, 6221}, 0}, {0, 0, {6223, 0, 6223}, 0},
+    {0, 0, {6225, 0, 6225}, 0}, {0, 0, {6227, 0, 6227}, 0},
+    {0, 0, {6229, 0, 6229}, 0}, {0, 0, {6231, 0, 6231}, 0},
+    {0, 0, {6233, 0, 6233}, 0}, {0, 0, {6235, 0, 6235}, 0},
+    {0, 0, {6237, 0, 6237}, 0}, {0, 0, {6239, 0, 6239}, 0},
+    {0, 0, {6241, 0, 6241}, 0}, {0, 0, {6243, 0, 6243}, 0},
+    {0, 0, {6245, 0, 6245}, 0}, {0, 0, {6247, 0, 6247}, 0},
+    {224, 0, {0, 0, 0}, 0}, {0, 0, {6249, 0, 6249}, 0},
+    {0, 0, {6251, 0, 6251}, 0}, {0, 0, {6253, 0, 6253}, 0},
+    {0, 0, {0, 0, 0}, 6255}, {0, 0, {0, 0, 0}, 6258}, {0, 0, {0, 0, 0}, 6261},
+    {0, 0, {0, 0, 0}, 6264}, {0, 0, {0, 0, 0}, 6267}, {0, 0, {0, 0, 0}, 6270},
+    {0, 0, {0, 0, 0}, 6273}, {0, 0, {0, 0, 0}, 6276}, {0, 0, {0, 0, 0}, 6279},
+    {0, 0, {0, 0, 0}, 6282}, {0, 0, {0, 0, 0}, 6285}, {0, 0, {0, 0, 0}, 6288},
+    {0, 0, {0, 0, 0}, 6291}, {0, 0, {0, 0, 0}, 6294}, {0, 0, {0, 0, 0}, 6297},
+    {0, 0, {0, 0, 0}, 6300}, {0, 0, {0, 0, 0}, 6303}, {0, 0, {0, 0, 0}, 6306},
+    {0, 0, {0, 0, 0}, 6309}, {0, 0, {0, 0, 0}, 6312}, {0, 0, {0, 0, 0}, 6315},
+    {0, 0, {0, 0, 0}, 6318}, {0, 0, {0, 0, 0}, 6321}, {0, 0, {0, 0, 0}, 6324},
+    {0, 0, {0, 0, 0}, 6327}, {0, 0, {0, 0, 0}, 6330}, {8, 2, {0, 0, 0}, 0},
+    {0, 0, {6333, 0, 6333}, 0}, {0, 0, {6336, 0, 6336}, 0},
+    {0, 0, {0, 0, 0}, 6339}, {0, 0, {6342, 0, 6342}, 0},
+    {0, 0, {0, 0, 0}, 6345}, {0, 0, {0, 0, 0}, 6348}, {0, 0, {0, 0, 0}, 6351},
+    {0, 0, {0, 0, 0}, 6354}, {0, 0, {0, 0, 0}, 6357}, {0, 0, {0, 0, 0}, 6360},
+    {0, 0, {0, 0, 0}, 6363}, {0, 0, {0, 0, 0}, 6366}, {0, 0, {0, 0, 0}, 6369},
+    {0, 0, {0, 0, 0}, 6372}, {0, 0, {0, 0, 0}, 6375}, {0, 0, {0, 0, 0}, 6378},
+    {0, 0, {0, 0, 0}, 6381}, {0, 0, {0, 0, 0}, 6384}, {0, 0, {0, 0, 0}, 6387},
+    {0, 0, {0, 0, 0}, 6390}, {0, 0, {0, 0, 0}, 6393}, {0, 0, {0, 0, 0}, 6396},
+    {0, 0, {0, 0, 0}, 6399}, {0, 0, {0, 0, 0}, 6402}, {0, 0, {0, 0, 0}, 6405},
+    {0, 0, {0, 0, 0}, 6408}, {0, 0, {0, 0, 0}, 6411}, {0, 0, {0, 0, 0}, 6414},
+    {0, 0, {0, 0, 0}, 6417}, {0, 0, {0, 0, 0}, 6420}, {0, 0, {0, 0, 0}, 6423},
+    {0, 0, {0, 0, 0}, 6426}, {0, 0, {0, 0, 0}, 6429}, {0, 0, {0, 0, 0}, 6432},
+    {0, 0, {0, 0, 0}, 6435}, {0, 0, {6438, 0, 6438}, 0},
+    {0, 0, {6441, 0, 6441}, 0}, {0, 0, {6443, 0, 6443}, 0},
+    {0, 0, {6445, 0, 6445}, 0}, {0, 0, {6447, 0, 6447}, 0},
+    {0, 0, {6449, 0, 6449}, 0}, {0, 0, {6451, 0, 6451}, 0},
+    {0, 0, {6453, 0, 6453}, 0}, {0, 0, {6455, 0, 6455}, 0},
+    {0, 0, {6457, 0, 6457}, 0}, {0, 0, {6459, 0, 6459}, 0},
+    {0, 0, {6461, 0, 6461}, 0}, {0, 0, {6463, 0, 6463}, 0},
+    {0, 0, {6465, 0, 6465}, 0}, {0, 0, {6467, 0, 6467}, 0},
+    {0, 0, {6469, 0, 6469}, 0}, {0, 0, {6471, 0, 6471}, 0},
+    {0, 0, {6473, 0, 6473}, 0}, {0, 0, {6475, 0, 6475}, 0},
+    {0, 0, {6477, 0, 6477}, 0}, {0, 0, {6479, 0, 6479}, 0},
+    {0, 0, {6481, 0, 6481}, 0}, {0, 0, {6483, 0, 6483}, 0},
+    {0, 0, {6485, 0, 6485}, 0}, {0, 0, {6487, 0, 6487}, 0},
+    {0, 0, {6489, 0, 6489}, 0}, {0, 0, {6491, 0, 6491}, 0},
+    {0, 0, {6493, 0, 6493}, 0}, {0, 0, {6495, 0, 6495}, 0},
+    {0, 0, {6497, 0, 6497}, 0}, {0, 0, {6499, 0, 6499}, 0},
+    {0, 0, {6501, 0, 6501}, 0}, {0, 0, {6503, 0, 6503}, 0},
+    {0, 0, {6505, 0, 6505}, 0}, {0, 0, {6507, 0, 6507}, 0},
+    {0, 0, {6509, 0, 6509}, 0}, {0, 0, {6511, 0, 6511}, 0},
+    {0, 0, {6513, 0, 6513}, 0}, {0, 0, {6515, 0, 6515}, 0},
+    {0, 0, {6517, 0, 6517}, 0}, {0, 0, {6519, 0, 6519}, 0},
+    {0, 0, {6521, 0, 6521}, 0}, {0, 0, {6523, 0, 6523}, 0},
+    {0, 0, {6525, 0, 6525}, 0}, {0, 0, {6527, 0, 6527}, 0},
+    {0, 0, {6529, 0, 6529}, 0}, {0, 0, {6531, 0, 6531}, 0},
+    {0, 0, {6533, 0, 6533}, 0}, {0, 0, {6535, 0, 6535}, 0},
+    {0, 0, {6537, 0, 6537}, 0}, {0, 0, {6539, 0, 6539}, 0},
+    {0, 0, {6541, 0, 6541}, 0}, {0, 0, {6543, 0, 6543}, 0},
+    {0, 0, {6545, 0, 6545}, 0}, {0, 0, {6547, 0, 6547}, 0},
+    {0, 0, {6549, 0, 6549}, 0}, {0, 0, {6551, 0, 6551}, 0},
+    {0, 0, {6553, 0, 6553}, 0}, {0, 0, {6555, 0, 6555}, 0},
+    {0, 0, {6557, 0, 6557}, 0}, {0, 0, {6559, 0, 6559}, 0},
+    {0, 0, {6561, 0, 6561}, 0}, {0, 0, {6563, 0, 6563}, 0},
+    {0, 0, {6565, 0, 6565}, 0}, {0, 0, {6567, 0, 6567}, 0},
+    {0, 0, {6569, 0, 6569}, 0}, {0, 0, {6571, 0, 6571}, 0},
+    {0, 0, {6573, 0, 6573}, 0}, {0, 0, {6575, 0, 6575}, 0},
+    {0, 0, {6577, 0, 6577}, 0}, {0, 0, {6579, 0, 6579}, 0},
+    {0, 0, {6581, 0, 6581}, 0}, {0, 0, {6583, 0, 6583}, 0},
+    {0, 0, {6585, 0, 6585}, 0}, {0, 0, {6587, 0, 6587}, 0},
+    {0, 0, {6589, 0, 6589}, 0}, {0, 0, {6591, 0, 6591}, 0},
+    {0, 0, {6593, 0, 6593}, 0}, {0, 0, {6595, 0, 6595}, 0},
+    {0, 0, {6597, 0, 6597}, 0}, {0, 0, {6599, 0, 6599}, 0},
+    {0, 0, {6601, 0, 6601}, 0}, {0, 0, {6603, 0, 6603}, 0},
+    {0, 0, {6605, 0, 6605}, 0}, {0, 0, {6607, 0, 6607}, 0},
+    {0, 0, {6609, 0, 6609}, 0}, {0, 0, {6611, 0, 6611}, 0},
+    {0, 0, {6613, 0, 6613}, 0}, {0, 0, {6615, 0, 6615}, 0},
+    {0, 0, {6617, 0, 6617}, 0}, {0, 0, {6619, 0, 6619}, 0},
+    {0, 0, {6621, 0, 6621}, 0}, {0, 0, {6623, 0, 6623}, 0},
+    {0, 0, {6625, 0, 6625}, 0}, {0, 0, {6627, 0, 6627}, 0},
+    {0, 0, {6629, 0, 6629}, 0}, {0, 0, {6631, 0, 6631}, 0},
+    {0, 0, {6633, 0, 6633}, 0}, {0, 0, {6635, 0, 6635}, 0},
+    {0, 0, {6637, 0, 6637}, 0}, {0, 0, {6639, 0, 6639}, 0},
+    {0, 0, {6641, 0, 6641}, 0}, {0, 0, {6643, 0, 6643}, 0},
+    {0, 0, {6645, 0, 6645}, 0}, {0, 0, {6647, 0, 6647}, 0},
+    {0, 0, {6649, 0, 6649}, 0}, {0, 0, {6653, 0, 6653}, 0},
+    {0, 0, {6657, 0, 6657}, 0}, {0, 0, {6661, 0, 6661}, 0},
+    {0, 0, {6665, 0, 6665}, 0}, {0, 0, {6669, 0, 6669}, 0},
+    {0, 0, {6673, 0, 6673}, 0}, {0, 0, {6677, 0, 6677}, 0},
+    {0, 0, {6681, 0, 6681}, 0}, {0, 0, {6685, 0, 6685}, 0},
+    {0, 0, {6689, 0, 6689}, 0}, {0, 0, {6693, 0, 6693}, 0},
+    {0, 0, {6697, 0, 6697}, 0}, {0, 0, {6701, 0, 6701}, 0},
+    {0, 0, {6705, 0, 6705}, 0}, {0, 0, {6709, 0, 6709}, 0},
+    {0, 0, {6713, 0, 6713}, 0}, {0, 0, {6717, 0, 6717}, 0},
+    {0, 0, {6721, 0, 6721}, 0}, {0, 0, {6725, 0, 6725}, 0},
+    {0, 0, {6729, 0, 6729}, 0}, {0, 0, {6733, 0, 6733}, 0},
+    {0, 0, {6737, 0, 6737}, 0}, {0, 0, {6741, 0, 6741}, 0},
+    {0, 0, {6745, 0, 6745}, 0}, {0, 0, {6749, 0, 6749}, 0},
+    {0, 0, {6753, 0, 6753}, 0}, {0, 0, {6757, 0, 6757}, 0},
+    {0, 0, {6761, 0, 6761}, 0}, {0, 0, {6765, 0, 6765}, 0},
+    {0, 0, {6770, 0, 6770}, 0}, {0, 0, {6775, 0, 6775}, 0},
+    {0, 0, {6779, 0, 6779}, 0}, {0, 0, {6783, 0, 6783}, 0},
+    {0, 0, {6787, 0, 6787}, 0}, {0, 0, {6791, 0, 6791}, 0},
+    {0, 0, {6795, 0, 6795}, 0}, {0, 0, {6799, 0, 6799}, 0},
+    {0, 0, {6803, 0, 6803}, 0}, {0, 0, {6807, 0, 6807}, 0},
+    {0, 0, {6811, 0, 6811}, 0}, {0, 0, {6815, 0, 6815}, 0},
+    {0, 0, {6819, 0, 6819}, 0}, {0, 0, {6823, 0, 6823}, 0},
+    {0, 0, {6827, 0, 6827}, 0}, {0, 0, {6831, 0, 6831}, 0},
+    {0, 0, {6835, 0, 6835}, 0}, {0, 0, {6839, 0, 6839}, 0},
+    {0, 0, {6843, 0, 6843}, 0}, {0, 0, {6847, 0, 6847}, 0},
+    {0, 0, {6851, 0, 6851}, 0}, {0, 0, {6855, 0, 6855}, 0},
+    {0, 0, {6859, 0, 6859}, 0}, {0, 0, {6863, 0, 6863}, 0},
+    {0, 0, {6867, 0, 6867}, 0}, {0, 0, {6871, 0, 6871}, 0},
+    {0, 0, {6875, 0, 6875}, 0}, {0, 0, {6879, 0, 6879}, 0},
+    {0, 0, {6883, 0, 6883}, 0}, {0, 0, {6887, 0, 6887}, 0},
+    {0, 0, {6891, 0, 6891}, 0}, {0, 0, {6895, 0, 6895}, 0},
+    {0, 0, {6899, 0, 6899}, 0}, {0, 0, {6903, 0, 6903}, 0},
+    {0, 0, {6907, 0, 6907}, 0}, {0, 0, {6911, 0, 6911}, 0},
+    {0, 0, {6915, 0, 6915}, 0}, {0, 0, {6919, 0, 6919}, 0},
+    {0, 0, {6921, 0, 6921}, 0}, {0, 0, {6923, 0, 6923}, 0},
+    {0, 0, {6925, 0, 6929}, 0}, {0, 0, {6933, 0, 6933}, 0},
+    {0, 0, {6936, 0, 6936}, 0}, {0, 0, {6939, 0, 6939}, 0},
+    {0, 0, {6942, 0, 6942}, 0}, {0, 0, {6945, 0, 6945}, 0},
+    {0, 0, {6948, 0, 6948}, 0}, {0, 0, {6951, 0, 6951}, 0},
+    {0, 0, {6954, 0, 6954}, 0}, {0, 0, {6957, 0, 6957}, 0},
+    {0, 0, {6960, 0, 6960}, 0}, {0, 0, {6963, 0, 6963}, 0},
+    {0, 0, {6966, 0, 6966}, 0}, {0, 0, {6969, 0, 6969}, 0},
+    {0, 0, {6972, 0, 6972}, 0}, {0, 0, {6975, 0, 6975}, 0},
+    {0, 0, {6978, 0, 6978}, 0}, {0, 0, {6980, 0, 6980}, 0},
+    {0, 0, {6982, 0, 6982}, 0}, {0, 0, {6984, 0, 6984}, 0},
+    {0, 0, {6986, 0, 6986}, 0}, {0, 0, {6988, 0, 6988}, 0},
+    {0, 0, {6990, 0, 6990}, 0}, {0, 0, {6992, 0, 6992}, 0},
+    {0, 0, {6994, 0, 6994}, 0}, {0, 0, {6996, 0, 6996}, 0},
+    {0, 0, {6998, 0, 6998}, 0}, {0, 0, {7000, 0, 7000}, 0},
+    {0, 0, {7002, 0, 7002}, 0}, {0, 0, {7004, 0, 7004}, 0},
+    {0, 0, {7006, 0, 7006}, 0}, {0, 0, {7009, 0, 7009}, 0},
+    {0, 0, {7012, 0, 7012}, 0}, {0, 0, {7014, 0, 7014}, 0},
+    {0, 0, {7016, 0, 7016}, 0}, {0, 0, {7018, 0, 7018}, 0},
+    {0, 0, {7020, 0, 7020}, 0}, {0, 0, {7022, 0, 7022}, 0},
+    {0, 0, {7024, 0, 7024}, 0}, {0, 0, {7026, 0, 7026}, 0},
+    {0, 0, {7028, 0, 7028}, 0}, {0, 0, {7030, 0, 7030}, 0},
+    {0, 0, {7032, 0, 7032}, 0}, {0, 0, {7034, 0, 7034}, 0},
+    {0, 0, {7036, 0, 7036}, 0}, {0, 0, {7038, 0, 7038}, 0},
+    {0, 0, {7040, 0, 7040}, 0}, {0, 0, {7042, 0, 7042}, 0},
+    {0, 0, {7044, 0, 7044}, 0}, {0, 0, {7046, 0, 7046}, 0},
+    {0, 0, {7048, 0, 7048}, 0}, {0, 0, {7050, 0, 7050}, 0},
+    {0, 0, {7052, 0, 7052}, 0}, {0, 0, {7054, 0, 7054}, 0},
+    {0, 0, {7056, 0, 7056}, 0}, {0, 0, {7058, 0, 7058}, 0},
+    {0, 0, {7060, 0, 7060}, 0}, {0, 0, {7062, 0, 7062}, 0},
+    {0, 0, {7064, 0, 7064}, 0}, {0, 0, {7066, 0, 7066}, 0},
+    {0, 0, {7068, 0, 7068}, 0}, {0, 0, {7070, 0, 7070}, 0},
+    {0, 0, {7072, 0, 7072}, 0}, {0, 0, {7074, 0, 7074}, 0},
+    {0, 0, {7076, 0, 7076}, 0}, {0, 0, {7078, 0, 7078}, 0},
+    {0, 0, {7081, 0, 7081}, 0}, {0, 0, {7084, 0, 7084}, 0},
+    {0, 0, {7087, 0, 7087}, 0}, {0, 0, {7090, 0, 7090}, 0},
+    {0, 0, {7093, 0, 7093}, 0}, {0, 0, {7096, 0, 7096}, 0},
+    {0, 0, {7099, 0, 7099}, 0}, {0, 0, {7102, 0, 7102}, 0},
+    {0, 0, {7105, 0, 7105}, 0}, {0, 0, {7108, 0, 7108}, 0},
+    {0, 0, {7111, 0, 7111}, 0}, {0, 0, {7114, 0, 7114}, 0},
+    {0, 0, {7117, 0, 7117}, 0}, {0, 0, {7120, 0, 7120}, 0},
+    {0, 0, {7123, 0, 7123}, 0}, {0, 0, {7126, 0, 7126}, 0},
+    {0, 0, {7129, 0, 7129}, 0}, {0, 0, {7132, 0, 7132}, 0},
+    {0, 0, {7135, 0, 7135}, 0}, {0, 0, {7138, 0, 7138}, 0},
+    {0, 0, {7141, 0, 7141}, 0}, {0, 0, {7144, 0, 7144}, 0},
+    {0, 0, {7147, 0, 7147}, 0}, {0, 0, {7150, 0, 7150}, 0},
+    {0, 0, {7154, 0, 7154}, 0}, {0, 0, {7158, 0, 7158}, 0},
+    {0, 0, {7162, 0, 7165}, 0}, {0, 0, {7168, 0, 7168}, 0},
+    {0, 0, {7172, 0, 7175}, 0}, {0, 0, {7178, 0, 7182}, 0},
+    {0, 0, {7186, 0, 7186}, 0}, {0, 0, {7188, 0, 7188}, 0},
+    {0, 0, {7190, 0, 7190}, 0}, {0, 0, {7192, 0, 7192}, 0},
+    {0, 0, {7194, 0, 7194}, 0}, {0, 0, {7196, 0, 7196}, 0},
+    {0, 0, {7198, 0, 7198}, 0}, {0, 0, {7200, 0, 7200}, 0},
+    {0, 0, {7202, 0, 7202}, 0}, {0, 0, {7204, 0, 7204}, 0},
+    {0, 0, {7206, 0, 7206}, 0}, {0, 0, {7208, 0, 7208}, 0},
+    {0, 0, {7210, 0, 7210}, 0}, {0, 0, {7212, 0, 7212}, 0},
+    {0, 0, {7214, 0, 7214}, 0}, {0, 0, {7216, 0, 7216}, 0},
+    {0, 0, {7218, 0, 7218}, 0}, {0, 0, {7220, 0, 7220}, 0},
+    {0, 0, {7222, 0, 7222}, 0}, {0, 0, {7224, 0, 7224}, 0},
+    {0, 0, {7226, 0, 7226}, 0}, {0, 0, {7228, 0, 7228}, 0},
+    {0, 0, {7230, 0, 7230}, 0}, {0, 0, {7232, 0, 7232}, 0},
+    {0, 0, {7234, 0, 7234}, 0}, {0, 0, {7236, 0, 7236}, 0},
+    {0, 0, {7238, 0, 7238}, 0}, {0, 0, {7240, 0, 7240}, 0},
+    {0, 0, {7242, 0, 7242}, 0}, {0, 0, {7244, 0, 7244}, 0},
+    {0, 0, {7246, 0, 7246}, 0}, {0, 0, {7248, 0, 7248}, 0},
+    {0, 0, {7250, 0, 7250}, 0}, {0, 0, {7252, 0, 7252}, 0},
+    {0, 0, {7254, 0, 7254}, 0}, {0, 0, {7256, 0, 7256}, 0},
+    {0, 0, {7258, 0, 7258}, 0}, {0, 0, {7260, 0, 7260}, 0},
+    {0, 0, {7262, 0, 7262}, 0}, {0, 0, {7264, 0, 7264}, 0},
+    {0, 0, {7266, 0, 7266}, 0}, {0, 0, {7268, 0, 7268}, 0},
+    {0, 0, {7270, 0, 7270}, 0}, {0, 0, {7272, 0, 7272}, 0},
+    {0, 0, {7274, 0, 7274}, 0}, {0, 0, {7276, 0, 7276}, 0},
+    {0, 0, {7278, 0, 7278}, 0}, {0, 0, {7280, 0, 7280}, 0},
+    {0, 0, {7283, 0, 7283}, 0}, {0, 0, {7287, 0, 7287}, 0},
+    {0, 0, {7291, 0, 7291}, 0}, {0, 0, {7295, 0, 7295}, 0},
+    {0, 0, {7299, 0, 7299}, 0}, {0, 0, {7303, 0, 7303}, 0},
+    {0, 0, {7307, 0, 7307}, 0}, {0, 0, {7311, 0, 7311}, 0},
+    {0, 0, {7315, 0, 7315}, 0}, {0, 0, {7318, 0, 7318}, 0},
+    {0, 0, {7322, 0, 7322}, 0}, {0, 0, {7325, 0, 7325}, 0},
+    {0, 0, {7329, 0, 7329}, 0}, {0, 0, {7333, 0, 7333}, 0},
+    {0, 0, {7337, 0, 7337}, 0}, {0, 0, {7341, 0, 7341}, 0},
+    {0, 0, {7345, 0, 7345}, 0}, {0, 0, {7349, 0, 7349}, 0},
+    {0, 0, {7353, 0, 7353}, 0}, {0, 0, {7356, 0, 7356}, 0},
+    {0, 0, {7359, 0, 7359}, 0}, {0, 0, {7362, 0, 7362}, 0},
+    {0, 0, {7365, 0, 7365}, 0}, {0, 0, {7369, 0, 7369}, 0},
+    {0, 0, {7373, 0, 7373}, 0}, {0, 0, {7377, 0, 7377}, 0},
+    {0, 0, {7381, 0, 7381}, 0}, {0, 0, {7384, 0, 7384}, 0},
+    {0, 0, {7387, 0, 7387}, 0}, {0, 0, {7391, 0, 7391}, 0},
+    {0, 0, {7394, 0, 7394}, 0}, {0, 0, {7398, 0, 7398}, 0},
+    {0, 0, {7402, 0, 7402}, 0}, {0, 0, {7406, 0, 7406}, 0},
+    {0, 0, {7410, 0, 7410}, 0}, {0, 0, {7414, 0, 7414}, 0},
+    {0, 0, {7418, 0, 7418}, 0}, {0, 0, {7421, 0, 7421}, 0},
+    {0, 0, {7425, 0, 7425}, 0}, {0, 0, {7429, 0, 7429}, 0},
+    {0, 0, {7433, 0, 7433}, 0}, {0, 0, {7437, 0, 7437}, 0},
+    {0, 0, {7441, 0, 7441}, 0}, {0, 0, {7445, 0, 7445}, 0},
+    {0, 0, {7448, 0, 7448}, 0}, {0, 0, {7451, 0, 7451}, 0},
+    {0, 0, {7455, 0, 7455}, 0}, {0, 0, {7459, 0, 7459}, 0},
+    {0, 0, {7463, 0, 7463}, 0}, {0, 0, {7466, 0, 7466}, 0},
+    {0, 0, {7470, 0, 7470}, 0}, {0, 0, {7473, 0, 7473}, 0},
+    {0, 0, {7477, 0, 7477}, 0}, {0, 0, {7480, 0, 7480}, 0},
+    {0, 0, {7483, 0, 7483}, 0}, {0, 0, {7486, 0, 7486}, 0},
+    {0, 0, {7489, 0, 7489}, 0}, {0, 0, {7492, 0, 7492}, 0},
+    {0, 0, {7495, 0, 7495}, 0}, {0, 0, {7498, 0, 7498}, 0},
+    {0, 0, {7501, 0, 7501}, 0}, {0, 0, {7504, 0, 7504}, 0},
+    {0, 0, {7507, 0, 7507}, 0}, {0, 0, {7511, 0, 7511}, 0},
+    {0, 0, {7515, 0, 7515}, 0}, {0, 0, {7519, 0, 7519}, 0},
+    {0, 0, {7523, 0, 7523}, 0}, {0, 0, {7527, 0, 7527}, 0},
+    {0, 0, {7531, 0, 7531}, 0}, {0, 0, {7535, 0, 7535}, 0},
+    {0, 0, {7539, 0, 7539}, 0}, {0, 0, {7543, 0, 7543}, 0},
+    {0, 0, {7547, 0, 7547}, 0}, {0, 0, {7551, 0, 7551}, 0},
+    {0, 0, {7555, 0, 7555}, 0}, {0, 0, {7559, 0, 7559}, 0},
+    {0, 0, {7563, 0, 7563}, 0}, {0, 0, {7567, 0, 7571}, 0},
+    {0, 0, {7575, 0, 7575}, 0}, {0, 0, {7578, 0, 7581}, 0},
+    {0, 0, {7584, 0, 7584}, 0}, {0, 0, {7588, 0, 7591}, 0},
+    {0, 0, {7594, 0, 7594}, 0}, {0, 0, {7597, 0, 7597}, 0},
+    {0, 0, {7600, 0, 7600}, 0}, {0, 0, {7604, 0, 7604}, 0},
+    {0, 0, {7608, 0, 7611}, 0}, {0, 0, {7614, 0, 7614}, 0},
+    {0, 0, {7617, 0, 7617}, 0}, {0, 0, {7620, 0, 7620}, 0},
+    {0, 0, {7623, 0, 7623}, 0}, {0, 0, {7626, 0, 7629}, 0},
+    {0, 0, {7632, 0, 7635}, 0}, {0, 0, {7638, 0, 7641}, 0},
+    {0, 0, {7644, 0, 7647}, 0}, {0, 0, {7650, 0, 7653}, 0},
+    {0, 0, {7656, 0, 7659}, 0}, {0, 0, {7662, 0, 7665}, 0},
+    {0, 0, {7668, 0, 7671}, 0}, {0, 0, {7674, 0, 7674}, 0},
+    {0, 0, {7678, 0, 7678}, 0}, {0, 0, {7683, 0, 7686}, 0},
+    {0, 0, {7689, 0, 7692}, 0}, {0, 0, {7695, 0, 7698}, 0},
+    {0, 0, {7701, 0, 7701}, 0}, {0, 0, {7704, 0, 7704}, 0},
+    {0, 0, {7707, 0, 7707}, 0}, {0, 0, {7710, 0, 7713}, 0},
+    {0, 0, {7716, 0, 7720}, 0}, {0, 0, {7724, 0, 7728}, 0},
+    {0, 0, {7732, 0, 7736}, 0}, {0, 0, {7740, 0, 7744}, 0},
+    {0, 0, {7748, 0, 7748}, 0}, {0, 0, {7751, 0, 7751}, 0},
+    {0, 0, {7754, 0, 7754}, 0}, {0, 0, {7757, 0, 7757}, 0},
+    {0, 0, {7760, 0, 7760}, 0}, {0, 0, {7763, 0, 7763}, 0},
+    {0, 0, {7766, 0, 7766}, 0}, {0, 0, {7769, 0, 7769}, 0},
+    {0, 0, {7772, 0, 7772}, 0}, {0, 0, {7775, 0, 7775}, 0},
+    {0, 0, {7778, 0, 7778}, 0}, {0, 0, {7782, 0, 7782}, 0},
+    {0, 0, {7786, 0, 7786}, 0}, {0, 0, {7789, 0, 7789}, 0},
+    {0, 0, {7793, 0, 7793}, 0}, {0, 0, {7797, 0, 7797}, 0},
+    {0, 0, {7801, 0, 7801}, 0}, {0, 0, {7804, 0, 7804}, 0},
+    {0, 0, {7808, 0, 7808}, 0}, {0, 0, {7812, 0, 7812}, 0},
+    {0, 0, {7817, 0, 7629}, 0}, {0, 0, {7820, 0, 7824}, 0},
+    {0, 0, {7828, 0, 7832}, 0}, {0, 0, {7836, 0, 7840}, 0},
+    {0, 0, {7844, 0, 7844}, 0}, {0, 0, {7848, 0, 7848}, 0},
+    {0, 0, {7854, 0, 7854}, 0}, {0, 0, {7861, 0, 7861}, 0},
+    {0, 0, {7864, 0, 7864}, 0}, {0, 0, {7867, 0, 7867}, 0},
+    {0, 0, {7870, 0, 7870}, 0}, {0, 0, {7873, 0, 7876}, 0},
+    {0, 0, {7879, 0, 7882}, 0}, {0, 0, {7885, 0, 7888}, 0},
+    {0, 0, {7891, 0, 7894}, 0}, {0, 0, {7897, 0, 7900}, 0},
+    {0, 0, {7903, 0, 7894}, 0}, {0, 0, {7906, 0, 7909}, 0},
+    {0, 0, {7912, 0, 7915}, 0}, {0, 0, {7918, 0, 7921}, 0},
+    {0, 0, {7924, 0, 7927}, 0}, {0, 0, {7930, 0, 7933}, 0},
+    {0, 0, {7936, 0, 7927}, 0}, {0, 0, {7939, 0, 7942}, 0},
+    {0, 0, {7945, 0, 7948}, 0}, {0, 0, {7951, 0, 7951}, 0},
+    {0, 0, {7956, 0, 7959}, 0}, {0, 0, {7962, 0, 7962}, 0},
+    {0, 0, {7965, 0, 7965}, 0}, {0, 0, {7968, 0, 7973}, 0},
+    {0, 0, {7978, 0, 7982}, 0}, {0, 0, {7986, 0, 7989}, 0},
+    {0, 0, {7992, 0, 7995}, 0}, {0, 0, {7998, 0, 7998}, 0},
+    {0, 0, {8001, 0, 8004}, 0}, {0, 0, {8007, 0, 8007}, 0},
+    {0, 0, {8010, 0, 8013}, 0}, {0, 0, {8016, 0, 7775}, 0},
+    {0, 0, {8019, 0, 8019}, 0}, {0, 0, {8022, 0, 8022}, 0},
+    {0, 0, {8025, 0, 8025}, 0}, {0, 0, {8028, 0, 8028}, 0},
+    {0, 0, {8032, 0, 8032}, 0}, {0, 0, {7665, 0, 7665}, 0},
+    {0, 0, {8035, 0, 8035}, 0}, {0, 0, {8039, 0, 8039}, 0},
+    {0, 0, {8043, 0, 8046}, 0}, {0, 0, {8049, 0, 8049}, 0},
+    {0, 0, {8054, 0, 8058}, 0}, {0, 0, {8062, 0, 8065}, 0},
+    {0, 0, {8068, 0, 8068}, 0}, {0, 0, {8071, 0, 8074}, 0},
+    {0, 0, {8077, 0, 8080}, 0}, {0, 0, {8083, 0, 8087}, 0},
+    {0, 0, {8091, 0, 8095}, 0}, {0, 0, {8099, 0, 8099}, 0},
+    {0, 0, {8102, 0, 8102}, 0}, {0, 0, {8105, 0, 8105}, 0},
+    {0, 0, {8108, 0, 8108}, 0}, {0, 0, {8111, 0, 8111}, 0},
+    {0, 0, {8114, 0, 8114}, 0}, {0, 0, {8117, 0, 8117}, 0},
+    {0, 0, {8120, 0, 8120}, 0}, {0, 0, {8123, 0, 8123}, 0},
+    {0, 0, {8126, 0, 8126}, 0}, {0, 0, {8130, 0, 8130}, 0},
+    {0, 0, {8134, 0, 8134}, 0}, {0, 0, {8138, 0, 8138}, 0},
+    {0, 0, {8142, 0, 8142}, 0}, {0, 0, {8146, 0, 8146}, 0},
+    {0, 0, {8150, 0, 8150}, 0}, {0, 0, {8154, 0, 8154}, 0},
+    {0, 0, {8158, 0, 8158}, 0}, {0, 0, {8162, 0, 8162}, 0},
+    {0, 0, {8166, 0, 8166}, 0}, {0, 0, {8170, 0, 8170}, 0},
+    {0, 0, {8174, 0, 8174}, 0}, {0, 0, {8178, 0, 8178}, 0},
+    {0, 0, {8182, 0, 8182}, 0}, {0, 0, {8186, 0, 8186}, 0},
+    {0, 0, {8190, 0, 8190}, 0}, {0, 0, {8194, 0, 8194}, 0},
+    {0, 0, {8198, 0, 8198}, 0}, {0, 0, {8202, 0, 8202}, 0},
+    {0, 0, {8206, 0, 8206}, 0}, {0, 0, {8210, 0, 8210}, 0},
+    {0, 0, {8214, 0, 8214}, 0}, {0, 0, {0, 8218, 8218}, 0},
+    {0, 0, {0, 8220, 8220}, 0}, {0, 0, {0, 8222, 8222}, 0},
+    {0, 0, {0, 8224, 8224}, 0}, {0, 0, {0, 8226, 8226}, 0},
+    {0, 0, {0, 8228, 8228}, 0}, {0, 0, {0, 8230, 8230}, 0},
+    {0, 0, {0, 8232, 8232}, 0}, {0, 0, {0, 8234, 8234}, 0},
+    {0, 0, {0, 8236, 8236}, 0}, {0, 0, {0, 8238, 8238}, 0},
+    {0, 0, {0, 8240, 8240}, 0}, {0, 0, {0, 8242, 8242}, 0},
+    {0, 0, {0, 8244, 8244}, 0}, {0, 0, {0, 8246, 8246}, 0},
+    {0, 0, {0, 8248, 8248}, 0}, {0, 0, {0, 8250, 8250}, 0},
+    {0, 0, {0, 8252, 8252}, 0}, {0, 0, {0, 8254, 8254}, 0},
+    {0, 0, {0, 8256, 8256}, 0}, {0, 0, {0, 8258, 8258}, 0},
+    {0, 0, {0, 8260, 8260}, 0}, {0, 0, {0, 8262, 8262}, 0},
+    {0, 0, {0, 8264, 8264}, 0}, {0, 0, {0, 8266, 8266}, 0},
+    {0, 0, {0, 8268, 8268}, 0}, {0, 0, {0, 8270, 8270}, 0},
+    {0, 0, {0, 8272, 8272}, 0}, {0, 0, {0, 8274, 8274}, 0},
+    {0, 0, {0, 8276, 8276}, 0}, {0, 0, {0, 8278, 8278}, 0},
+    {0, 0, {0, 8280, 8280}, 0}, {0, 0, {0, 8282, 8282}, 0},
+    {0, 0, {0, 8284, 8284}, 0}, {0, 0, {0, 8286, 8286}, 0},
+    {0, 0, {0, 8288, 8288}, 0}, {0, 0, {1666, 0, 1666}, 0},
+    {0, 0, {1670, 0, 1670}, 0}, {0, 0, {0, 8290, 8290}, 0},
+    {0, 0, {0, 8292, 8292}, 0}, {0, 0, {0, 8294, 8294}, 0},
+    {0, 0, {0, 8296, 8296}, 0}, {0, 0, {0, 8298, 8298}, 0},
+    {0, 0, {0, 8300, 8300}, 0}, {0, 0, {0, 8302, 8302}, 0},
+    {0, 0, {0, 8304, 8304}, 0}, {0, 0, {0, 8306, 8306}, 0},
+    {0, 0, {0, 8308, 8308}, 0}, {0, 0, {0, 8310, 8310}, 0},
+    {0, 0, {0, 8312, 8312}, 0}, {0, 0, {0, 8314, 8314}, 0},
+    {0, 0, {0, 8316, 8316}, 0}, {0, 0, {0, 8318, 8318}, 0},
+    {0, 0, {0, 8320, 8320}, 0}, {0, 0, {0, 8322, 8322}, 0},
+    {0, 0, {0, 8324, 8324}, 0}, {0, 0, {0, 8326, 8326}, 0},
+    {0, 0, {0, 8328, 8328}, 0}, {0, 0, {0, 8330, 8330}, 0},
+    {0, 0, {0, 8332, 8332}, 0}, {0, 0, {0, 8334, 8334}, 0},
+    {0, 0, {0, 8336, 8336}, 0}, {0, 0, {0, 8338, 8338}, 0},
+    {0, 0, {0, 8340, 8340}, 0}, {0, 0, {0, 8342, 8342}, 0},
+    {0, 0, {0, 8344, 8344}, 0}, {0, 0, {0, 8346, 8346}, 0},
+    {0, 0, {0, 8348, 8348}, 0}, {0, 0, {0, 8350, 8350}, 0},
+    {0, 0, {0, 8352, 8352}, 0}, {0, 0, {0, 8354, 8354}, 0},
+    {0, 0, {0, 8356, 8356}, 0}, {0, 0, {0, 8358, 8358}, 0},
+    {0, 0, {0, 8360, 8360}, 0}, {0, 0, {0, 8362, 8362}, 0},
+    {0, 0, {0, 8364, 8364}, 0}, {0, 0, {8364, 0, 8364}, 0},
+    {0, 0, {0, 8366, 8366}, 0}, {0, 0, {0, 8368, 8368}, 0},
+    {0, 0, {0, 8370, 8370}, 0}, {0, 0, {0, 8372, 8372}, 0},
+    {0, 0, {0, 8374, 8374}, 0}, {0, 0, {0, 8376, 8376}, 0},
+    {0, 0, {0, 8378, 8378}, 0}, {0, 0, {0, 8380, 8380}, 0},
+    {0, 0, {0, 8382, 8382}, 0}, {0, 0, {0, 2522, 2522}, 0},
+    {0, 0, {0, 8384, 8384}, 0}, {0, 0, {0, 8386, 8386}, 0},
+    {0, 0, {0, 8388, 8388}, 0}, {0, 0, {0, 8390, 8390}, 0},
+    {0, 0, {0, 8392, 8392}, 0}, {0, 0, {0, 8394, 8394}, 0},
+    {0, 0, {0, 8396, 8396}, 0}, {0, 0, {0, 8398, 8398}, 0},
+    {0, 0, {0, 8400, 8400}, 0}, {0, 0, {0, 8402, 8402}, 0},
+    {0, 0, {0, 8404, 8404}, 0}, {0, 0, {0, 8406, 8406}, 0},
+    {0, 0, {0, 1312, 1312}, 0}, {0, 0, {0, 2504, 2504}, 0},
+    {0, 0, {0, 2520, 2520}, 0}, {0, 0, {0, 8408, 8408}, 0},
+    {0, 0, {0, 2524, 2524}, 0}, {0, 0, {0, 8410, 8410}, 0},
+    {0, 0, {0, 8412, 8412}, 0}, {0, 0, {0, 2528, 2528}, 0},
+    {0, 0, {0, 8414, 8414}, 0}, {0, 0, {0, 8416, 8416}, 0},
+    {0, 0, {0, 8418, 8418}, 0}, {0, 0, {0, 8420, 8420}, 0},
+    {0, 0, {0, 8422, 8422}, 0}, {0, 0, {0, 8424, 8424}, 0},
+    {0, 0, {0, 8426, 8426}, 0}, {0, 0, {0, 8428, 8428}, 0},
+    {0, 0, {0, 8430, 8430}, 0}, {0, 0, {0, 8432, 8432}, 0},
+    {0, 0, {0, 2546, 2546}, 0}, {0, 0, {0, 8434, 8434}, 0},
+    {0, 0, {0, 8436, 8436}, 0}, {0, 0, {0, 8438, 8438}, 0},
+    {0, 0, {0, 8440, 8440}, 0}, {0, 0, {0, 8442, 8442}, 0},
+    {0, 0, {0, 8444, 8444}, 0}, {0, 0, {0, 8446, 8446}, 0},
+    {0, 0, {8448, 0, 455}, 0}, {0, 0, {606, 0, 606}, 0},
+    {0, 0, {8294, 0, 8294}, 0}, {0, 0, {8450, 0, 8450}, 0},
+    {0, 0, {5689, 0, 5689}, 0}, {0, 0, {8452, 0, 8452}, 0},
+    {0, 0, {8454, 0, 8454}, 0}, {0, 0, {0, 8456, 8456}, 0},
+    {0, 0, {0, 8458, 8458}, 0}, {0, 0, {0, 8460, 8460}, 0},
+    {0, 0, {0, 8462, 8462}, 0}, {0, 0, {0, 8464, 8464}, 0},
+    {0, 0, {0, 8466, 8466}, 0}, {0, 0, {0, 8468, 8468}, 0},
+    {0, 0, {0, 8470, 8470}, 0}, {0, 0, {0, 8472, 8472}, 0},
+    {0, 0, {0, 8474, 8474}, 0}, {0, 0, {0, 8476, 8476}, 0},
+    {0, 0, {0, 8478, 8478}, 0}, {0, 0, {0, 8480, 8480}, 0},
+    {0, 0, {0, 8482, 8482}, 0}, {0, 0, {0, 8484, 8484}, 0},
+    {0, 0, {0, 8486, 8486}, 0}, {0, 0, {0, 8488, 8488}, 0},
+    {0, 0, {0, 8490, 8490}, 0}, {0, 0, {0, 8492, 8492}, 0},
+    {0, 0, {0, 8494, 8494}, 0}, {0, 0, {0, 8496, 8496}, 0},
+    {0, 0, {0, 8498, 8498}, 0}, {0, 0, {0, 8500, 8500}, 0},
+    {0, 0, {0, 8502, 8502}, 0}, {0, 0, {0, 8504, 8504}, 0},
+    {0, 0, {0, 8506, 8506}, 0}, {0, 0, {0, 8508, 8508}, 0},
+    {0, 0, {0, 8510, 8510}, 0}, {0, 0, {0, 8512, 8512}, 0},
+    {0, 0, {0, 8514, 8514}, 0}, {0, 0, {0, 8516, 8516}, 0},
+    {0, 0, {0, 8518, 8518}, 0}, {0, 0, {0, 8520, 8520}, 0},
+    {0, 0, {0, 8522, 8522}, 0}, {0, 0, {0, 8524, 8524}, 0},
+    {0, 0, {0, 8526, 8526}, 0}, {0, 0, {0, 8528, 8528}, 0},
+    {0, 0, {0, 8530, 8530}, 0}, {0, 0, {0, 8532, 8532}, 0},
+    {0, 0, {0, 8534, 8534}, 0}, {0, 0, {0, 8536, 8536}, 0},
+    {0, 0, {0, 8538, 8538}, 0}, {0, 0, {0, 8540, 8540}, 0},
+    {0, 0, {0, 8542, 8542}, 0}, {0, 0, {0, 8544, 8544}, 0},
+    {0, 0, {0, 8546, 8546}, 0}, {0, 0, {0, 8548, 8548}, 0},
+    {0, 0, {0, 8550, 8550}, 0}, {0, 0, {0, 8552, 8552}, 0},
+    {0, 0, {0, 8554, 8554}, 0}, {0, 0, {0, 8556, 8556}, 0},
+    {0, 0, {0, 8558, 8558}, 0}, {0, 0, {0, 8560, 8560}, 0},
+    {0, 0, {0, 8562, 8562}, 0}, {0, 0, {0, 8564, 8564}, 0},
+    {0, 0, {0, 8566, 8566}, 0}, {0, 0, {0, 8568, 8568}, 0},
+    {0, 0, {0, 8570, 8570}, 0}, {0, 0, {0, 8572, 8572}, 0},
+    {0, 0, {0, 8574, 8574}, 0}, {0, 0, {0, 8576, 8576}, 0},
+    {0, 0, {0, 8578, 8578}, 0}, {0, 0, {0, 8580, 8580}, 0},
+    {0, 0, {0, 8582, 8582}, 0}, {0, 0, {0, 8584, 8584}, 0},
+    {0, 0, {0, 8586, 8586}, 0}, {0, 0, {0, 8588, 8588}, 0},
+    {0, 0, {0, 8590, 8590}, 0}, {0, 0, {0, 8592, 8592}, 0},
+    {0, 0, {0, 8594, 8594}, 0}, {0, 0, {0, 8596, 8596}, 0},
+    {0, 0, {0, 8598, 8598}, 0}, {0, 0, {0, 8600, 8600}, 0},
+    {0, 0, {0, 8602, 8602}, 0}, {0, 0, {0, 8604, 8604}, 0},
+    {0, 0, {0, 8606, 8606}, 0}, {0, 0, {0, 8608, 8608}, 0},
+    {0, 0, {0, 8610, 8610}, 0}, {0, 0, {0, 8612, 8612}, 0},
+    {0, 0, {0, 8614, 8614}, 0}, {0, 0, {8616, 0, 8616}, 0},
+    {0, 0, {8618, 0, 8618}, 0}, {0, 0, {8620, 0, 8620}, 0},
+    {0, 0, {8622, 0, 8622}, 0}, {0, 0, {8624, 0, 8624}, 0},
+    {0, 0, {8626, 0, 8626}, 0}, {0, 0, {8628, 0, 8628}, 0},
+    {0, 0, {8630, 0, 8630}, 0}, {0, 0, {8632, 0, 8632}, 0},
+    {0, 0, {8634, 0, 8634}, 0}, {0, 0, {8636, 0, 8636}, 0},
+    {0, 0, {8638, 0, 8638}, 0}, {0, 0, {8640, 0, 8640}, 0},
+    {0, 0, {8642, 0, 8642}, 0}, {0, 0, {8644, 0, 8644}, 0},
+    {0, 0, {8646, 0, 8646}, 0}, {0, 0, {8648, 0, 8648}, 0},
+    {0, 0, {8650, 0, 8650}, 0}, {0, 0, {8652, 0, 8652}, 0},
+    {0, 0, {8654, 0, 8654}, 0}, {0, 0, {8656, 0, 8656}, 0},
+    {0, 0, {8658, 0, 8658}, 0}, {0, 0, {8660, 0, 8660}, 0},
+    {0, 0, {8662, 0, 8662}, 0}, {0, 0, {8664, 0, 8664}, 0},
+    {0, 0, {8666, 0, 8666}, 0}, {0, 0, {8668, 0, 8668}, 0},
+    {0, 0, {8670, 0, 8670}, 0}, {0, 0, {8672, 0, 8672}, 0},
+    {0, 0, {8674, 0, 8674}, 0}, {0, 0, {8676, 0, 8676}, 0},
+    {0, 0, {8678, 0, 8678}, 0}, {0, 0, {8680, 0, 8680}, 0},
+    {0, 0, {8682, 0, 8682}, 0}, {0, 0, {8684, 0, 8684}, 0},
+    {0, 0, {8686, 0, 8686}, 0}, {0, 0, {8688, 0, 8688}, 0},
+    {0, 0, {8690, 0, 8690}, 0}, {0, 0, {8692, 0, 8692}, 0},
+    {0, 0, {8694, 0, 8694}, 0}, {0, 0, {8696, 0, 8696}, 0},
+    {0, 0, {8698, 0, 8698}, 0}, {0, 0, {8700, 0, 8700}, 0},
+    {0, 0, {8702, 0, 8702}, 0}, {0, 0, {8704, 0, 8704}, 0},
+    {0, 0, {8706, 0, 8706}, 0}, {0, 0, {8708, 0, 8708}, 0},
+    {0, 0, {8710, 0, 8710}, 0}, {0, 0, {8712, 0, 8712}, 0},
+    {0, 0, {8714, 0, 8714}, 0}, {0, 0, {8716, 0, 8716}, 0},
+    {0, 0, {8718, 0, 8718}, 0}, {0, 0, {8720, 0, 8720}, 0},
+    {0, 0, {8722, 0, 8722}, 0}, {0, 0, {8724, 0, 8724}, 0},
+    {0, 0, {8726, 0, 8726}, 0}, {0, 0, {8728, 0, 8728}, 0},
+    {0, 0, {8730, 0, 8730}, 0}, {0, 0, {8732, 0, 8732}, 0},
+    {0, 0, {8734, 0, 8734}, 0}, {0, 0, {8736, 0, 8736}, 0},
+    {0, 0, {8738, 0, 8738}, 0}, {0, 0, {8740, 0, 8740}, 0},
+    {0, 0, {8742, 0, 8742}, 0}, {0, 0, {8744, 0, 8744}, 0},
+    {0, 0, {8746, 0, 8746}, 0}, {0, 0, {8748, 0, 8748}, 0},
+    {0, 0, {8750, 0, 8750}, 0}, {0, 0, {8752, 0, 8752}, 0},
+    {0, 0, {8754, 0, 8754}, 0}, {0, 0, {8756, 0, 8756}, 0},
+    {0, 0, {8758, 0, 8758}, 0}, {0, 0, {8760, 0, 8760}, 0},
+    {0, 0, {8762, 0, 8762}, 0}, {0, 0, {8764, 0, 8764}, 0},
+    {0, 0, {8766, 0, 8766}, 0}, {0, 0, {8768, 0, 8768}, 0},
+    {0, 0, {8770, 0, 8770}, 0}, {0, 0, {8772, 0, 8772}, 0},
+    {0, 0, {8774, 0, 8774}, 0}, {0, 0, {8776, 0, 8776}, 0},
+    {0, 0, {8778, 0, 8778}, 0}, {0, 0, {8780, 0, 8780}, 0},
+    {0, 0, {8782, 0, 8782}, 0}, {0, 0, {8784, 0, 8784}, 0},
+    {0, 0, {8786, 0, 8786}, 0}, {0, 0, {8788, 0, 8788}, 0},
+    {0, 0, {8790, 0, 8790}, 0}, {0, 0, {8792, 0, 8792}, 0},
+    {0, 0, {8794, 0, 8794}, 0}, {0, 0, {8796, 0, 8796}, 0},
+    {0, 0, {8798, 0, 8798}, 0}, {0, 0, {8800, 0, 8800}, 0},
+    {0, 0, {8802, 0, 8802}, 0}, {0, 0, {8804, 0, 8804}, 0},
+    {0, 0, {8806, 0, 8806}, 0}, {0, 0, {8808, 0, 8808}, 0},
+    {0, 0, {8810, 0, 8810}, 0}, {0, 0, {8812, 0, 8812}, 0},
+    {0, 0, {8814, 0, 8814}, 0}, {0, 0, {8816, 0, 8816}, 0},
+    {0, 0, {8818, 0, 8818}, 0}, {0, 0, {8820, 0, 8820}, 0},
+    {0, 0, {8822, 0, 8822}, 0}, {0, 0, {8824, 0, 8824}, 0},
+    {0, 0, {8826, 0, 8826}, 0}, {0, 0, {8828, 0, 8828}, 0},
+    {0, 0, {8830, 0, 8830}, 0}, {0, 0, {8832, 0, 8832}, 0},
+    {0, 0, {8834, 0, 8834}, 0}, {0, 0, {8836, 0, 8836}, 0},
+    {0, 0, {8838, 0, 8838}, 0}, {0, 0, {8840, 0, 8840}, 0},
+    {0, 0, {8842, 0, 8842}, 0}, {0, 0, {8844, 0, 8844}, 0},
+    {0, 0, {8846, 0, 8846}, 0}, {0, 0, {8848, 0, 8848}, 0},
+    {0, 0, {8850, 0, 8850}, 0}, {0, 0, {8852, 0, 8852}, 0},
+    {0, 0, {8854, 0, 8854}, 0}, {0, 0, {8856, 0, 8856}, 0},
+    {0, 0, {8858, 0, 8858}, 0}, {0, 0, {8860, 0, 8860}, 0},
+    {0, 0, {8862, 0, 8862}, 0}, {0, 0, {8864, 0, 8864}, 0},
+    {0, 0, {8866, 0, 8866}, 0}, {0, 0, {8868, 0, 8868}, 0},
+    {0, 0, {8870, 0, 8870}, 0}, {0, 0, {8872, 0, 8872}, 0},
+    {0, 0, {8874, 0, 8874}, 0}, {0, 0, {8876, 0, 8876}, 0},
+    {0, 0, {8878, 0, 8878}, 0}, {0, 0, {8880, 0, 8880}, 0},
+    {0, 0, {8882, 0, 8882}, 0}, {0, 0, {8884, 0, 8884}, 0},
+    {0, 0, {8886, 0, 8886}, 0}, {0, 0, {8888, 0, 8888}, 0},
+    {0, 0, {8890, 0, 8890}, 0}, {0, 0, {8892, 0, 8892}, 0},
+    {0, 0, {8894, 0, 8894}, 0}, {0, 0, {8896, 0, 8896}, 0},
+    {0, 0, {8898, 0, 8898}, 0}, {0, 0, {8900, 0, 8900}, 0},
+    {0, 0, {8902, 0, 8902}, 0}, {0, 0, {8904, 0, 8904}, 0},
+    {0, 0, {8906, 0, 8906}, 0}, {0, 0, {8908, 0, 8908}, 0},
+    {0, 0, {8910, 0, 8910}, 0}, {0, 0, {8912, 0, 8912}, 0},
+    {0, 0, {8914, 0, 8914}, 0}, {0, 0, {8916, 0, 8916}, 0},
+    {0, 0, {8918, 0, 8918}, 0}, {0, 0, {8920, 0, 8920}, 0},
+    {0, 0, {8922, 0, 8922}, 0}, {0, 0, {8924, 0, 8924}, 0},
+    {0, 0, {8926, 0, 8926}, 0}, {0, 0, {8928, 0, 8928}, 0},
+    {0, 0, {8930, 0, 8930}, 0}, {0, 0, {8932, 0, 8932}, 0},
+    {0, 0, {8934, 0, 8934}, 0}, {0, 0, {8936, 0, 8936}, 0},
+    {0, 0, {8938, 0, 8938}, 0}, {0, 0, {8940, 0, 8940}, 0},
+    {0, 0, {8942, 0, 8942}, 0}, {0, 0, {8944, 0, 8944}, 0},
+    {0, 0, {8946, 0, 8946}, 0}, {0, 0, {8948, 0, 8948}, 0},
+    {0, 0, {8950, 0, 8950}, 0}, {0, 0, {8952, 0, 8952}, 0},
+    {0, 0, {8954, 0, 8954}, 0}, {0, 0, {8956, 0, 8956}, 0},
+    {0, 0, {8958, 0, 8958}, 0}, {0, 0, {8960, 0, 8960}, 0},
+    {0, 0, {8962, 0, 8962}, 0}, {0, 0, {8964, 0, 8964}, 0},
+    {0, 0, {8966, 0, 8966}, 0}, {0, 0, {8968, 0, 8968}, 0},
+    {0, 0, {8970, 0, 8970}, 0}, {0, 0, {8972, 0, 8972}, 0},
+    {0, 0, {8974, 0, 8974}, 0}, {0, 0, {8976, 0, 8976}, 0},
+    {0, 0, {8978, 0, 8978}, 0}, {0, 0, {8980, 0, 8980}, 0},
+    {0, 0, {8982, 0, 8982}, 0}, {0, 0, {8984, 0, 8984}, 0},
+    {0, 0, {8986, 0, 8986}, 0}, {0, 0, {8988, 0, 8988}, 0},
+    {0, 0, {8990, 0, 8990}, 0}, {0, 0, {8992, 0, 8992}, 0},
+    {0, 0, {8994, 0, 8994}, 0}, {0, 0, {8996, 0, 8996}, 0},
+    {0, 0, {8998, 0, 8998}, 0}, {0, 0, {9000, 0, 9000}, 0},
+    {0, 0, {9002, 0, 9002}, 0}, {0, 0, {9004, 0, 9004}, 0},
+    {0, 0, {9006, 0, 9006}, 0}, {0, 0, {9008, 0, 9008}, 0},
+    {0, 0, {9010, 0, 9010}, 0}, {0, 0, {9012, 0, 9012}, 0},
+    {0, 0, {9014, 0, 9014}, 0}, {0, 0, {9016, 0, 9016}, 0},
+    {0, 0, {9018, 0, 9018}, 0}, {0, 0, {9020, 0, 9020}, 0},
+    {0, 0, {9022, 0, 9022}, 0}, {0, 0, {9024, 0, 9024}, 0},
+    {0, 0, {9026, 0, 9026}, 0}, {0, 0, {9028, 0, 9028}, 0},
+    {0, 0, {9030, 0, 9030}, 0}, {0, 0, {9032, 0, 9032}, 0},
+    {0, 0, {9034, 0, 9034}, 0}, {0, 0, {9036, 0, 9036}, 0},
+    {0, 0, {9038, 0, 9038}, 0}, {0, 0, {9040, 0, 9040}, 0},
+    {0, 0, {9042, 0, 9042}, 0}, {0, 0, {9044, 0, 9044}, 0},
+    {0, 0, {9046, 0, 9046}, 0}, {0, 0, {9048, 0, 9048}, 0},
+    {0, 0, {9050, 0, 9050}, 0}, {0, 0, {9052, 0, 9052}, 0},
+    {0, 0, {9054, 0, 9054}, 0}, {0, 0, {9056, 0, 9056}, 0},
+    {0, 0, {9058, 0, 9058}, 0}, {0, 0, {9060, 0, 9060}, 0},
+    {0, 0, {9062, 0, 9062}, 0}, {0, 0, {9064, 0, 9064}, 0},
+    {0, 0, {9066, 0, 9066}, 0}, {0, 0, {9068, 0, 9068}, 0},
+    {0, 0, {9070, 0, 9070}, 0}, {0, 0, {9072, 0, 9072}, 0},
+    {0, 0, {9074, 0, 9074}, 0}, {0, 0, {9076, 0, 9076}, 0},
+    {0, 0, {9078, 0, 9078}, 0}, {0, 0, {9080, 0, 9080}, 0},
+    {0, 0, {9082, 0, 9082}, 0}, {0, 0, {9084, 0, 9084}, 0},
+    {0, 0, {9086, 0, 9086}, 0}, {0, 0, {9088, 0, 9088}, 0},
+    {0, 0, {9090, 0, 9090}, 0}, {0, 0, {9092, 0, 9092}, 0},
+    {0, 0, {9094, 0, 9094}, 0}, {0, 0, {9096, 0, 9096}, 0},
+    {0, 0, {9098, 0, 9098}, 0}, {0, 0, {9100, 0, 9100}, 0},
+    {0, 0, {9102, 0, 9102}, 0}, {0, 0, {9104, 0, 9104}, 0},
+    {0, 0, {9106, 0, 9106}, 0}, {0, 0, {9108, 0, 9108}, 0},
+    {0, 0, {9110, 0, 9110}, 0}, {0, 0, {9112, 0, 9112}, 0},
+    {0, 0, {9114, 0, 9114}, 0}, {0, 0, {9116, 0, 9116}, 0},
+    {0, 0, {9118, 0, 9118}, 0}, {0, 0, {9120, 0, 9120}, 0},
+    {0, 0, {9122, 0, 9122}, 0}, {0, 0, {9124, 0, 9124}, 0},
+    {0, 0, {9126, 0, 9126}, 0}, {0, 0, {9128, 0, 9128}, 0},
+    {0, 0, {9130, 0, 9130}, 0}, {0, 0, {9132, 0, 9132}, 0},
+    {0, 0, {9134, 0, 9134}, 0}, {0, 0, {9136, 0, 9136}, 0},
+    {0, 0, {9138, 0, 9138}, 0}, {0, 0, {9140, 0, 9140}, 0},
+    {0, 0, {9142, 0, 9142}, 0}, {0, 0, {9144, 0, 9144}, 0},
+    {0, 0, {9146, 0, 9146}, 0}, {0, 0, {9148, 0, 9148}, 0},
+    {0, 0, {9150, 0, 9150}, 0}, {0, 0, {9152, 0, 9152}, 0},
+    {0, 0, {9154, 0, 9154}, 0}, {0, 0, {9156, 0, 9156}, 0},
+    {0, 0, {9158, 0, 9158}, 0}, {0, 0, {9160, 0, 9160}, 0},
+    {0, 0, {9162, 0, 9162}, 0}, {0, 0, {9164, 0, 9164}, 0},
+    {0, 0, {9166, 0, 9166}, 0}, {0, 0, {9168, 0, 9168}, 0},
+    {0, 0, {9170, 0, 9170}, 0}, {0, 0, {9172, 0, 9172}, 0},
+    {0, 0, {9174, 0, 9174}, 0}, {0, 0, {9176, 0, 9176}, 0},
+    {0, 0, {9178, 0, 9178}, 0}, {0, 0, {9180, 0, 9180}, 0},
+    {0, 0, {9182, 0, 9182}, 0}, {0, 0, {9184, 0, 9184}, 0},
+    {0, 0, {9186, 0, 9186}, 0}, {0, 0, {9188, 0, 9188}, 0},
+    {0, 0, {9190, 0, 9190}, 0}, {0, 0, {9192, 0, 9192}, 0},
+    {0, 0, {9194, 0, 9194}, 0}, {0, 0, {9196, 0, 9196}, 0},
+    {0, 0, {9198, 0, 9198}, 0}, {0, 0, {9200, 0, 9200}, 0},
+    {0, 0, {9202, 0, 9202}, 0}, {0, 0, {9204, 0, 9204}, 0},
+    {0, 0, {9206, 0, 9206}, 0}, {0, 0, {9208, 0, 9208}, 0},
+    {0, 0, {9210, 0, 9210}, 0}, {0, 0, {9212, 0, 9212}, 0},
+    {0, 0, {9214, 0, 9214}, 0}, {0, 0, {9216, 0, 9216}, 0},
+    {0, 0, {9218, 0, 9218}, 0}, {0, 0, {9220, 0, 9220}, 0},
+    {0, 0, {9222, 0, 9222}, 0}, {0, 0, {9224, 0, 9224}, 0},
+    {0, 0, {9226, 0, 9226}, 0}, {0, 0, {9228, 0, 9228}, 0},
+    {0, 0, {9230, 0, 9230}, 0}, {0, 0, {9232, 0, 9232}, 0},
+    {0, 0, {9234, 0, 9234}, 0}, {0, 0, {9236, 0, 9236}, 0},
+    {0, 0, {9238, 0, 9238}, 0}, {0, 0, {9240, 0, 9240}, 0},
+    {0, 0, {9242, 0, 9242}, 0}, {0, 0, {9244, 0, 9244}, 0},
+    {0, 0, {9246, 0, 9246}, 0}, {0, 0, {9248, 0, 9248}, 0},
+    {0, 0, {9250, 0, 9250}, 0}, {0, 0, {9252, 0, 9252}, 0},
+    {0, 0, {9254, 0, 9254}, 0}, {0, 0, {9256, 0, 9256}, 0},
+    {0, 0, {9258, 0, 9258}, 0}, {0, 0, {9260, 0, 9260}, 0},
+    {0, 0, {9262, 0, 9262}, 0}, {0, 0, {9264, 0, 9264}, 0},
+    {0, 0, {9266, 0, 9266}, 0}, {0, 0, {9268, 0, 9268}, 0},
+    {0, 0, {9270, 0, 9270}, 0}, {0, 0, {9272, 0, 9272}, 0},
+    {0, 0, {9274, 0, 9274}, 0}, {0, 0, {9276, 0, 9276}, 0},
+    {0, 0, {9278, 0, 9278}, 0}, {0, 0, {9280, 0, 9280}, 0},
+    {0, 0, {9282, 0, 9282}, 0}, {0, 0, {9284, 0, 9284}, 0},
+    {0, 0, {9286, 0, 9286}, 0}, {0, 0, {9288, 0, 9288}, 0},
+    {0, 0, {9290, 0, 9290}, 0}, {0, 0, {9292, 0, 9292}, 0},
+    {0, 0, {9294, 0, 9294}, 0}, {0, 0, {9296, 0, 9296}, 0},
+    {0, 0, {9298, 0, 9298}, 0}, {0, 0, {9300, 0, 9300}, 0},
+    {0, 0, {9302, 0, 9302}, 0}, {0, 0, {9304, 0, 9304}, 0},
+    {0, 0, {9306, 0, 9306}, 0}, {0, 0, {9308, 0, 9308}, 0},
+    {0, 0, {9310, 0, 9310}, 0}, {0, 0, {9312, 0, 9312}, 0},
+    {0, 0, {9314, 0, 9314}, 0}, {0, 0, {9316, 0, 9316}, 0},
+    {0, 0, {9318, 0, 9318}, 0}, {0, 0, {9320, 0, 9320}, 0},
+    {0, 0, {9322, 0, 9322}, 0}, {0, 0, {9324, 0, 9324}, 0},
+    {0, 0, {9326, 0, 9326}, 0}, {0, 0, {9328, 0, 9328}, 0},
+    {0, 0, {9330, 0, 9330}, 0}, {0, 0, {9332, 0, 9332}, 0},
+    {0, 0, {9334, 0, 9334}, 0}, {0, 0, {9336, 0, 9336}, 0},
+    {0, 0, {9338, 0, 9338}, 0}, {0, 0, {9340, 0, 9340}, 0},
+    {0, 0, {9342, 0, 9342}, 0}, {0, 0, {9344, 0, 9344}, 0},
+    {0, 0, {9346, 0, 9346}, 0}, {0, 0, {9348, 0, 9348}, 0},
+    {0, 0, {9350, 0, 9350}, 0}, {0, 0, {9352, 0, 9352}, 0},
+    {0, 0, {9354, 0, 9354}, 0}, {0, 0, {9356, 0, 9356}, 0},
+    {0, 0, {9358, 0, 9358}, 0}, {0, 0, {9360, 0, 9360}, 0},
+    {0, 0, {9362, 0, 9362}, 0}, {0, 0, {9364, 0, 9364}, 0},
+    {0, 0, {9366, 0, 9366}, 0}, {0, 0, {9368, 0, 9368}, 0},
+    {0, 0, {9370, 0, 9370}, 0}, {0, 0, {9372, 0, 9372}, 0},
+    {0, 0, {9374, 0, 9374}, 0}, {0, 0, {9376, 0, 9376}, 0},
+    {0, 0, {9378, 0, 9378}, 0}, {0, 0, {9380, 0, 9380}, 0},
+    {0, 0, {9382, 0, 9382}, 0}, {0, 0, {9384, 0, 9384}, 0},
+    {0, 0, {9386, 0, 9386}, 0}, {0, 0, {9388, 0, 9388}, 0},
+    {0, 0, {9390, 0, 9390}, 0}, {0, 0, {9392, 0, 9392}, 0},
+    {0, 0, {9394, 0, 9394}, 0}, {0, 0, {9396, 0, 9396}, 0},
+    {0, 0, {9398, 0, 9398}, 0}, {0, 0, {9400, 0, 9400}, 0},
+    {0, 0, {9402, 0, 9402}, 0}, {0, 0, {9404, 0, 9404}, 0},
+    {0, 0, {9406, 0, 9406}, 0}, {0, 0, {9408, 0, 9408}, 0},
+    {0, 0, {9410, 0, 9410}, 0}, {0, 0, {9412, 0, 9412}, 0},
+    {0, 0, {9414, 0, 9414}, 0}, {0, 0, {9416, 0, 9416}, 0},
+    {0, 0, {9418, 0, 9418}, 0}, {0, 0, {9420, 0, 9420}, 0},
+    {0, 0, {9422, 0, 9422}, 0}, {0, 0, {9424, 0, 9424}, 0},
+    {0, 0, {9426, 0, 9426}, 0}, {0, 0, {9428, 9428, 9428}, 0},
+    {0, 0, {9431, 9431, 9431}, 0}, {0, 0, {9434, 9434, 9434}, 0},
+    {0, 0, {9437, 9437, 9437}, 0}, {0, 0, {9441, 9441, 9441}, 0},
+    {0, 0, {9445, 9445, 9445}, 0}, {0, 0, {9448, 9448, 9448}, 0},
+    {0, 0, {9451, 9451, 9451}, 0}, {0, 0, {9454, 9454, 9454}, 0},
+    {0, 0, {9457, 9457, 9457}, 0}, {0, 0, {9460, 9460, 9460}, 0},
+    {0, 0, {9463, 0, 9463}, 9463}, {26, 0, {0, 0, 0}, 0},
+    {0, 0, {9466, 0, 9466}, 9466}, {0, 0, {9469, 0, 9469}, 0},
+    {0, 0, {9471, 0, 9471}, 0}, {0, 0, {9473, 0, 9473}, 0},
+    {0, 0, {9475, 0, 9475}, 0}, {0, 0, {9477, 0, 9477}, 0},
+    {0, 0, {9479, 0, 9479}, 0}, {0, 0, {9481, 0, 9481}, 0},
+    {0, 0, {9483, 0, 9483}, 9483}, {0, 0, {9486, 0, 9486}, 9486},
+    {0, 0, {9489, 0, 9489}, 9489}, {0, 0, {9493, 0, 9493}, 9493},
+    {0, 0, {9497, 0, 9497}, 9497}, {0, 0, {9500, 0, 9500}, 9500},
+    {0, 0, {9503, 0, 9503}, 9503}, {0, 0, {9506, 0, 9506}, 9506},
+    {0, 0, {9509, 0, 9509}, 9509}, {0, 0, {9512, 0, 9512}, 9512},
+    {0, 0, {9515, 0, 9515}, 9515}, {0, 0, {9518, 0, 9518}, 9518},
+    {0, 0, {9521, 0, 9521}, 9521}, {0, 0, {9524, 0, 9524}, 9524},
+    {0, 0, {9527, 0, 9527}, 9527}, {0, 0, {9530, 0, 9530}, 9530},
+    {0, 0, {9533, 0, 9533}, 9533}, {0, 0, {9536, 0, 9536}, 9536},
+    {0, 0, {9539, 0, 9539}, 9539}, {0, 0, {9542, 0, 9542}, 9542},
+    {0, 0, {9545, 0, 9545}, 9545}, {0, 0, {9548, 0, 9548}, 9548},
+    {0, 0, {9551, 0, 9551}, 9551}, {0, 0, {9554, 0, 9554}, 9554},
+    {0, 0, {9557, 0, 9557}, 9557}, {0, 0, {9560, 0, 9560}, 9560},
+    {0, 0, {9563, 0, 9563}, 9563}, {0, 0, {9566, 0, 9566}, 9566},
+    {0, 0, {9569, 0, 9569}, 9569}, {0, 0, {9572, 0, 9572}, 9572},
+    {0, 0, {9575, 0, 9575}, 9575}, {0, 0, {9578, 0, 9578}, 9578},
+    {0, 0, {9581, 0, 9581}, 0}, {0, 0, {9584, 0, 9584}, 0},
+    {0, 0, {9586, 0, 9586}, 0}, {0, 0, {9588, 0, 9588}, 0},
+    {0, 0, {9590, 0, 9590}, 0}, {0, 0, {9592, 0, 9592}, 0},
+    {0, 0, {9594, 0, 9594}, 0}, {0, 0, {9596, 0, 9596}, 0},
+    {0, 0, {9598, 0, 9598}, 0}, {0, 0, {9600, 0, 9600}, 0},
+    {0, 0, {9602, 0, 9602}, 0}, {0, 0, {9604, 0, 9604}, 0},
+    {0, 0, {9606, 0, 9606}, 0}, {0, 0, {9608, 0, 9608}, 0},
+    {0, 0, {9610, 0, 9610}, 0}, {0, 0, {9612, 0, 9612}, 0},
+    {0, 0, {9614, 0, 9614}, 0}, {0, 0, {9616, 0, 9616}, 0},
+    {0, 0, {9618, 0, 9618}, 0}, {0, 0, {9620, 0, 9620}, 0},
+    {0, 0, {9622, 0, 9622}, 0}, {0, 0, {9624, 0, 9624}, 0},
+    {0, 0, {9626, 0, 9626}, 0}, {0, 0, {9628, 0, 9628}, 0},
+    {0, 0, {9630, 0, 9630}, 0}, {0, 0, {9632, 0, 9632}, 0},
+    {0, 0, {9634, 0, 9634}, 0}, {0, 0, {9636, 0, 9636}, 0},
+    {0, 0, {9638, 0, 9638}, 0}, {0, 0, {9640, 0, 9640}, 0},
+    {0, 0, {9642, 0, 9642}, 0}, {0, 0, {9644, 0, 9644}, 0},
+    {0, 0, {9646, 0, 9646}, 0}, {0, 0, {9648, 0, 9648}, 0},
+    {0, 0, {9650, 0, 9650}, 0}, {0, 0, {9652, 0, 9652}, 0},
+    {0, 0, {9654, 0, 9654}, 0}, {0, 0, {9656, 0, 9656}, 0},
+    {0, 0, {9658, 0, 9658}, 0}, {0, 0, {9660, 0, 9660}, 0},
+    {0, 0, {9662, 0, 9662}, 0}, {0, 0, {9665, 0, 9665}, 0},
+    {0, 0, {9668, 0, 9668}, 0}, {0, 0, {9671, 0, 9671}, 0},
+    {0, 0, {9674, 0, 9674}, 0}, {0, 0, {9677, 0, 9677}, 0},
+    {0, 0, {9680, 0, 9680}, 0}, {0, 0, {9683, 0, 9683}, 0},
+    {0, 0, {9686, 0, 9686}, 0}, {0, 0, {9688, 0, 9688}, 0},
+    {0, 0, {9691, 0, 9691}, 0}, {0, 0, {9694, 0, 9694}, 0},
+    {0, 0, {9697, 0, 9697}, 0}, {0, 0, {9700, 0, 9700}, 0},
+    {0, 0, {9703, 0, 9703}, 0}, {0, 0, {9706, 0, 9706}, 0},
+    {0, 0, {9709, 0, 9709}, 0}, {0, 0, {9712, 0, 9712}, 0},
+    {0, 0, {9715, 0, 9715}, 0}, {0, 0, {9718, 0, 9718}, 0},
+    {0, 0, {9721, 0, 9721}, 0}, {0, 0, {9724, 0, 9724}, 0},
+    {0, 0, {9727, 0, 9727}, 0}, {0, 0, {9730, 0, 9730}, 0},
+    {0, 0, {9733, 0, 9733}, 0}, {0, 0, {9736, 0, 9736}, 0},
+    {0, 0, {9739, 0, 9739}, 0}, {0, 0, {9742, 0, 9742}, 0},
+    {0, 0, {9745, 0, 9745}, 0}, {0, 0, {9748, 0, 9748}, 0},
+    {0, 0, {9751, 0, 9751}, 0}, {0, 0, {9754, 0, 9754}, 0},
+    {0, 0, {9757, 0, 9757}, 0}, {0, 0, {9760, 0, 9760}, 0},
+    {0, 0, {9763, 0, 9763}, 0}, {0, 0, {9766, 0, 9766}, 0},
+    {0, 0, {9769, 0, 9769}, 0}, {0, 0, {9772, 0, 9772}, 0},
+    {0, 0, {9775, 0, 9775}, 0}, {0, 0, {9778, 0, 9778}, 0},
+    {0, 0, {9781, 0, 9781}, 0}, {0, 0, {9784, 0, 9784}, 0},
+    {0, 0, {9787, 0, 9787}, 0}, {0, 0, {9790, 0, 9790}, 0},
+    {0, 0, {9793, 0, 9793}, 0}, {0, 0, {9796, 0, 9796}, 0},
+    {0, 0, {9799, 0, 9799}, 0}, {0, 0, {9802, 0, 9802}, 0},
+    {0, 0, {9805, 0, 9805}, 0}, {0, 0, {9808, 0, 9808}, 0},
+    {0, 0, {9811, 0, 9811}, 0}, {0, 0, {9814, 0, 9814}, 0},
+    {0, 0, {9817, 0, 9817}, 0}, {0, 0, {9820, 0, 9820}, 0},
+    {0, 0, {9823, 0, 9823}, 0}, {0, 0, {9826, 0, 9826}, 0},
+    {0, 0, {9829, 0, 9829}, 0}, {0, 0, {9832, 0, 9832}, 0},
+    {0, 0, {9835, 0, 9835}, 0}, {0, 0, {9838, 0, 9838}, 0},
+    {0, 0, {9841, 0, 9841}, 0}, {0, 0, {9844, 0, 9844}, 0},
+    {0, 0, {9847, 0, 9847}, 0}, {0, 0, {9850, 0, 9850}, 0},
+    {0, 0, {9853, 0, 9853}, 0}, {0, 0, {9856, 0, 9856}, 0},
+    {0, 0, {9859, 0, 9859}, 0}, {0, 0, {9862, 0, 9862}, 0},
+    {0, 0, {9865, 0, 9865}, 0}, {0, 0, {9868, 0, 9868}, 0},
+    {0, 0, {9871, 0, 9871}, 0}, {0, 0, {9874, 0, 9874}, 0},
+    {0, 0, {9877, 0, 9877}, 0}, {0, 0, {9880, 0, 9880}, 0},
+    {0, 0, {9883, 0, 9883}, 0}, {0, 0, {9886, 0, 9886}, 0},
+    {0, 0, {9889, 0, 9889}, 0}, {0, 0, {9892, 0, 9892}, 0},
+    {0, 0, {9895, 0, 9895}, 0}, {0, 0, {9898, 0, 9898}, 0},
+    {0, 0, {9901, 0, 9901}, 0}, {0, 0, {9904, 0, 9904}, 0},
+    {0, 0, {9907, 0, 9907}, 0}, {0, 0, {9910, 0, 9910}, 0},
+    {0, 0, {9913, 0, 9913}, 0}, {0, 0, {9916, 0, 9916}, 0},
+    {0, 0, {9919, 0, 9919}, 0}, {0, 0, {9922, 0, 9922}, 0},
+    {0, 0, {9925, 0, 9925}, 0}, {0, 0, {9928, 0, 9928}, 0},
+    {0, 0, {9931, 0, 9931}, 0}, {0, 0, {9934, 0, 9934}, 0},
+    {0, 0, {9937, 0, 9937}, 0}, {0, 0, {9940, 0, 9940}, 0},
+    {0, 0, {9943, 0, 9943}, 0}, {0, 0, {9946, 0, 9946}, 0},
+    {0, 0, {9949, 0, 9949}, 0}, {0, 0, {9952, 0, 9952}, 0},
+    {0, 0, {9955, 0, 9955}, 0}, {0, 0, {9958, 0, 9958}, 0},
+    {0, 0, {9961, 0, 9961}, 0}, {0, 0, {9964, 0, 9964}, 0},
+    {0, 0, {9967, 0, 9967}, 0}, {0, 0, {9971, 0, 9971}, 0},
+    {0, 0, {9975, 0, 9975}, 0}, {0, 0, {9979, 0, 9979}, 0},
+    {0, 0, {9983, 0, 9983}, 0}, {0, 0, {9987, 0, 9987}, 0},
+    {0, 0, {9991, 0, 9991}, 0}, {0, 0, {9994, 0, 9994}, 0},
+    {0, 0, {9997, 0, 9997}, 0}, {0, 0, {10000, 0, 10000}, 0},
+    {0, 0, {10003, 0, 10003}, 0}, {0, 0, {10006, 0, 10006}, 0},
+    {0, 0, {10009, 0, 10009}, 0}, {0, 0, {10012, 0, 10012}, 0},
+    {0, 0, {10015, 0, 10015}, 0}, {0, 0, {10018, 0, 10018}, 0},
+    {0, 0, {10021, 0, 10021}, 0}, {0, 0, {10024, 0, 10024}, 0},
+    {0, 0, {10027, 0, 10027}, 0}, {0, 0, {10030, 0, 10030}, 0},
+    {0, 0, {10033, 0, 10033}, 0}, {0, 0, {10036, 0, 10036}, 0},
+    {0, 0, {10039, 0, 10039}, 0}, {0, 0, {10042, 0, 10042}, 0},
+    {0, 0, {10045, 0, 10045}, 0}, {0, 0, {10048, 0, 10048}, 0},
+    {0, 0, {10051, 0, 10051}, 0}, {0, 0, {10054, 0, 10054}, 0},
+    {0, 0, {10057, 0, 10057}, 0}, {0, 0, {10060, 0, 10060}, 0},
+    {0, 0, {10063, 0, 10063}, 0}, {0, 0, {10066, 0, 10066}, 0},
+    {0, 0, {10069, 0, 10069}, 0}, {0, 0, {10072, 0, 10072}, 0},
+    {0, 0, {10075, 0, 10075}, 0}, {0, 0, {10078, 0, 10078}, 0},
+    {0, 0, {10081, 0, 10081}, 0}, {0, 0, {10084, 0, 10084}, 0},
+    {0, 0, {10087, 0, 10087}, 0}, {0, 0, {10091, 0, 10091}, 0},
+    {0, 0, {10095, 0, 10095}, 0}, {0, 0, {10099, 0, 10099}, 0},
+    {0, 0, {10102, 0, 10102}, 0}, {0, 0, {10105, 0, 10105}, 0},
+    {0, 0, {10108, 0, 10108}, 0}, {0, 0, {10111, 0, 10111}, 0},
+    {0, 0, {10114, 0, 10114}, 0}, {0, 0, {10117, 0, 10117}, 0},
+    {0, 0, {10120, 0, 10120}, 0}, {0, 0, {10123, 0, 10123}, 0},
+    {0, 0, {10126, 0, 10126}, 0}, {0, 0, {10129, 0, 10129}, 0},
+    {0, 0, {10132, 0, 10132}, 0}, {0, 0, {10135, 0, 10135}, 0},
+    {0, 0, {10138, 0, 10138}, 0}, {0, 0, {10141, 0, 10141}, 0},
+    {0, 0, {10144, 0, 10144}, 0}, {0, 0, {10147, 0, 10147}, 0},
+    {0, 0, {10150, 0, 10150}, 0}, {0, 0, {10153, 0, 10153}, 0},
+    {0, 0, {10156, 0, 10156}, 0}, {0, 0, {10159, 0, 10159}, 0},
+    {0, 0, {10162, 0, 10162}, 0}, {0, 0, {10165, 0, 10165}, 0},
+    {0, 0, {10168, 0, 10168}, 0}, {0, 0, {10171, 0, 10171}, 0},
+    {0, 0, {10174, 0, 10174}, 0}, {0, 0, {10177, 0, 10177}, 0},
+    {0, 0, {10180, 0, 10180}, 0}, {0, 0, {10183, 0, 10183}, 0},
+    {0, 0, {10187, 0, 10187}, 0}, {0, 0, {10191, 0, 10191}, 0},
+    {0, 0, {10195, 0, 10195}, 0}, {0, 0, {10199, 0, 10199}, 0},
+    {0, 0, {10203, 0, 10203}, 0}, {0, 0, {10207, 0, 10207}, 0},
+    {0, 0, {10211, 0, 10211}, 0}, {0, 0, {10215, 0, 10215}, 0},
+    {0, 0, {10219, 0, 10219}, 0}, {0, 0, {10223, 0, 10223}, 0},
+    {0, 0, {10227, 0, 10227}, 0}, {0, 0, {10231, 0, 10231}, 0},
+    {0, 0, {10235, 0, 10235}, 0}, {0, 0, {10239, 0, 10239}, 0},
+    {0, 0, {10243, 0, 10243}, 0}, {0, 0, {10247, 0, 10247}, 0},
+    {0, 0, {10251, 0, 10251}, 0}, {0, 0, {10255, 0, 10255}, 0},
+    {0, 0, {10259, 0, 10259}, 0}, {0, 0, {10263, 0, 10263}, 0},
+    {0, 0, {10267, 0, 10267}, 0}, {0, 0, {10271, 0, 10271}, 0},
+    {0, 0, {10275, 0, 10275}, 0}, {0, 0, {10279, 0, 10279}, 0},
+    {0, 0, {10283, 0, 10283}, 0}, {0, 0, {10287, 0, 10287}, 0},
+    {0, 0, {10291, 0, 10291}, 0}, {0, 0, {10295, 0, 10295}, 0},
+    {0, 0, {10299, 0, 10299}, 0}, {0, 0, {10303, 0, 10303}, 0},
+    {0, 0, {10307, 0, 10307}, 0}, {0, 0, {10311, 0, 10311}, 0},
+    {0, 0, {10315, 0, 10315}, 0}, {0, 0, {10319, 0, 10319}, 0},
+    {0, 0, {10323, 0, 10323}, 0}, {0, 0, {10327, 0, 10327}, 0},
+    {0, 0, {10331, 0, 10331}, 0}, {0, 0, {10335, 0, 10335}, 0},
+    {0, 0, {10339, 0, 10339}, 0}, {0, 0, {10343, 0, 10343}, 0},
+    {0, 0, {10347, 0, 10347}, 0}, {0, 0, {10351, 0, 10351}, 0},
+    {0, 0, {10355, 0, 10355}, 0}, {0, 0, {10359, 0, 10359}, 0},
+    {0, 0, {10363, 0, 10363}, 0}, {0, 0, {10367, 0, 10367}, 0},
+    {0, 0, {10371, 0, 10371}, 0}, {0, 0, {10375, 0, 10375}, 0},
+    {0, 0, {10379, 0, 10379}, 0}, {0, 0, {10383, 0, 10383}, 0},
+    {0, 0, {10387, 0, 10387}, 0}, {0, 0, {10391, 0, 10391}, 0},
+    {0, 0, {10395, 0, 10395}, 0}, {0, 0, {10399, 0, 10399}, 0},
+    {0, 0, {10403, 0, 10403}, 0}, {0, 0, {10407, 0, 10407}, 0},
+    {0, 0, {10411, 0, 10411}, 0}, {0, 0, {10415, 0, 10415}, 0},
+    {0, 0, {10419, 0, 10419}, 0}, {0, 0, {10423, 0, 10423}, 0},
+    {0, 0, {10427, 0, 10427}, 0}, {0, 0, {10431, 0, 10431}, 0},
+    {0, 0, {10435, 0, 10435}, 0}, {0, 0, {10439, 0, 10439}, 0},
+    {0, 0, {10443, 0, 10443}, 0}, {0, 0, {10447, 0, 10447}, 0},
+    {0, 0, {10451, 0, 10451}, 0}, {0, 0, {10455, 0, 10455}, 0},
+    {0, 0, {10459, 0, 10459}, 0}, {0, 0, {10463, 0, 10463}, 0},
+    {0, 0, {10467, 0, 10467}, 0}, {0, 0, {10471, 0, 10471}, 0},
+    {0, 0, {10475, 0, 10475}, 0}, {0, 0, {10479, 0, 10479}, 0},
+    {0, 0, {10483, 0, 10483}, 0}, {0, 0, {10487, 0, 10487}, 0},
+    {0, 0, {10491, 0, 10491}, 0}, {0, 0, {10495, 0, 10495}, 0},
+    {0, 0, {10499, 0, 10499}, 0}, {0, 0, {10503, 0, 10503}, 0},
+    {0, 0, {10507, 0, 10507}, 0}, {0, 0, {10511, 0, 10511}, 0},
+    {0, 0, {10515, 0, 10515}, 0}, {0, 0, {10519, 0, 10519}, 0},
+    {0, 0, {10523, 0, 10523}, 0}, {0, 0, {10527, 0, 10527}, 0},
+    {0, 0, {10531, 0, 10531}, 0}, {0, 0, {10535, 0, 10535}, 0},
+    {0, 0, {10539, 0, 10539}, 0}, {0, 0, {10543, 0, 10543}, 0},
+    {0, 0, {10547, 0, 10547}, 0}, {0, 0, {10551, 0, 10551}, 0},
+    {0, 0, {10555, 0, 10555}, 0}, {0, 0, {10559, 0, 10559}, 0},
+    {0, 0, {10563, 0, 10563}, 0}, {0, 0, {10567, 0, 10567}, 0},
+    {0, 0, {10572, 0, 10572}, 0}, {0, 0, {10577, 0, 10577}, 0},
+    {0, 0, {10582, 0, 10582}, 0}, {0, 0, {10587, 0, 10587}, 0},
+    {0, 0, {10592, 0, 10592}, 0}, {0, 0, {10597, 0, 10597}, 0},
+    {0, 0, {10602, 0, 10602}, 0}, {0, 0, {10606, 0, 10606}, 0},
+    {0, 0, {10611, 0, 10611}, 0}, {0, 0, {10613, 0, 10613}, 0},
+    {0, 0, {10615, 0, 10615}, 0}, {0, 0, {10617, 0, 10617}, 0},
+    {0, 0, {10619, 0, 10619}, 0}, {0, 0, {10621, 0, 10621}, 0},
+    {0, 0, {10623, 0, 10623}, 0}, {0, 0, {10625, 0, 10625}, 0},
+    {0, 0, {10627, 0, 10627}, 0}, {0, 0, {10629, 0, 10629}, 0},
+    {0, 0, {10631, 0, 10631}, 0}, {0, 0, {10633, 0, 10633}, 0},
+    {0, 0, {10635, 0, 10635}, 0}, {0, 0, {10637, 0, 10637}, 0},
+    {0, 0, {10639, 0, 10639}, 0}, {0, 0, {10641, 0, 10641}, 0},
+    {0, 0, {10643, 0, 10643}, 0}, {0, 0, {10645, 0, 10645}, 0},
+    {0, 0, {10647, 0, 10647}, 0}, {0, 0, {10649, 0, 10649}, 0},
+    {0, 0, {10651, 0, 10651}, 0}, {0, 0, {10653, 0, 10653}, 0},
+    {0, 0, {10655, 0, 10655}, 0}, {0, 0, {10657, 0, 10657}, 0},
+    {0, 0, {10659, 0, 10659}, 0}, {0, 0, {10661, 0, 10661}, 0},
+    {0, 0, {10663, 0, 10663}, 0}, {0, 0, {10665, 0, 10665}, 0},
+    {0, 0, {10667, 0, 10667}, 0}, {0, 0, {10669, 0, 10669}, 0},
+    {0, 0, {10671, 0, 10671}, 0}, {0, 0, {10673, 0, 10673}, 0},
+    {0, 0, {10675, 0, 10675}, 0}, {0, 0, {10677, 0, 10677}, 0},
+    {0, 0, {10679, 0, 10679}, 0}, {0, 0, {10681, 0, 10681}, 0},
+    {0, 0, {10684, 0, 10684}, 0}, {0, 0, {10687, 0, 10687}, 0},
+    {0, 0, {10690, 0, 10690}, 0}, {0, 0, {10693, 0, 10693}, 0},
+    {0, 0, {10696, 0, 10696}, 0}, {0, 0, {10699, 0, 10699}, 0},
+    {0, 0, {10702, 0, 10702}, 0}, {0, 0, {10705, 0, 10705}, 0},
+    {0, 0, {10708, 0, 10708}, 0}, {0, 0, {10711, 0, 10711}, 0},
+    {0, 0, {10714, 0, 10714}, 0}, {0, 0, {10717, 0, 10717}, 0},
+    {0, 0, {10720, 0, 10720}, 0}, {0, 0, {10723, 0, 10723}, 0},
+    {0, 0, {10725, 0, 10725}, 0}, {0, 0, {10727, 0, 10727}, 0},
+    {0, 0, {10729, 0, 10729}, 0}, {0, 0, {10731, 0, 10731}, 0},
+    {0, 0, {10733, 0, 10733}, 0}, {0, 0, {10735, 0, 10735}, 0},
+    {0, 0, {10737, 0, 10737}, 0}, {0, 0, {10739, 0, 10739}, 0},
+    {0, 0, {10741, 0, 10741}, 0}, {0, 0, {10743, 0, 10743}, 0},
+    {0, 0, {10745, 0, 10745}, 0}, {0, 0, {10747, 0, 10747}, 0},
+    {0, 0, {10749, 0, 10749}, 0}, {0, 0, {10751, 0, 10751}, 0},
+    {0, 0, {10753, 0, 10753}, 0}, {0, 0, {10755, 0, 10755}, 0},
+    {0, 0, {10757, 0, 10757}, 0}, {0, 0, {10759, 0, 10759}, 0},
+    {0, 0, {10761, 0, 10761}, 0}, {0, 0, {10763, 0, 10763}, 0},
+    {0, 0, {10765, 0, 10765}, 0}, {0, 0, {10767, 0, 10767}, 0},
+    {0, 0, {10769, 0, 10769}, 0}, {0, 0, {10771, 0, 10771}, 0},
+    {0, 0, {10773, 0, 10773}, 0}, {0, 0, {10775, 0, 10775}, 0},
+    {0, 0, {10777, 0, 10777}, 0}, {0, 0, {10779, 0, 10779}, 0},
+    {0, 0, {10781, 0, 10781}, 0}, {0, 0, {10783, 0, 10783}, 0},
+    {0, 0, {10785, 0, 10785}, 0}, {0, 0, {10787, 0, 10787}, 0},
+    {0, 0, {10789, 0, 10789}, 0}, {0, 0, {10791, 0, 10791}, 0},
+    {0, 0, {10793, 0, 10793}, 0}, {0, 0, {10796, 0, 10796}, 0},
+    {0, 0, {10799, 0, 10799}, 0}, {0, 0, {10802, 0, 10802}, 0},
+    {0, 0, {10805, 0, 10805}, 0}, {0, 0, {10807, 0, 10807}, 0},
+    {0, 0, {10809, 0, 10809}, 0}, {0, 0, {2456, 10811, 1}, 0},
+    {0, 0, {2460, 10813, 3}, 0}, {0, 0, {4818, 10815, 5}, 0},
+    {0, 0, {2462, 10817, 7}, 0}, {0, 0, {2464, 10819, 9}, 0},
+    {0, 0, {4876, 10821, 11}, 0}, {0, 0, {2468, 10823, 13}, 0},
+    {0, 0, {2470, 10825, 15}, 0}, {0, 0, {2472, 10827, 17}, 0},
+    {0, 0, {2474, 10829, 19}, 0}, {0, 0, {2476, 10831, 21}, 0},
+    {0, 0, {2478, 10833, 23}, 0}, {0, 0, {2480, 10835, 25}, 0},
+    {0, 0, {2482, 10837, 27}, 0}, {0, 0, {2484, 10839, 29}, 0},
+    {0, 0, {2488, 10841, 31}, 0}, {0, 0, {4848, 10843, 33}, 0},
+    {0, 0, {2490, 10845, 35}, 0}, {0, 0, {5557, 10847, 37}, 0},
+    {0, 0, {2492, 10849, 39}, 0}, {0, 0, {2494, 10851, 41}, 0},
+    {0, 0, {4994, 10853, 43}, 0}, {0, 0, {2496, 10855, 45}, 0},
+    {0, 0, {5036, 10857, 47}, 0}, {0, 0, {5571, 10859, 49}, 0},
+    {0, 0, {4870, 10861, 51}, 0}, {0, 0, {10863, 0, 10863}, 0},
+    {0, 0, {10865, 0, 10865}, 0}, {0, 0, {10867, 0, 10867}, 0},
+    {0, 0, {10869, 0, 10869}, 0}, {0, 0, {10871, 0, 10871}, 0},
+    {0, 0, {10873, 0, 10873}, 0}, {0, 0, {10875, 0, 10875}, 0},
+    {0, 0, {10877, 0, 10877}, 0}, {0, 0, {10879, 0, 10879}, 0},
+    {0, 0, {10881, 0, 10881}, 0}, {0, 0, {10883, 0, 10883}, 0},
+    {0, 0, {10885, 0, 10885}, 0}, {0, 0, {10887, 0, 10887}, 0},
+    {0, 0, {10889, 0, 10889}, 0}, {0, 0, {10891, 0, 10891}, 0},
+    {0, 0, {10893, 0, 10893}, 0}, {0, 0, {10895, 0, 10895}, 0},
+    {0, 0, {10897, 0, 10897}, 0}, {0, 0, {10899, 0, 10899}, 0},
+    {0, 0, {10901, 0, 10901}, 0}, {0, 0, {10903, 0, 10903}, 0},
+    {0, 0, {10905, 0, 10905}, 0}, {0, 0, {10907, 0, 10907}, 0},
+    {0, 0, {10909, 0, 10909}, 0}, {0, 0, {10911, 0, 10911}, 0},
+    {0, 0, {10913, 0, 10913}, 0}, {0, 0, {10915, 0, 10915}, 0},
+    {0, 0, {10917, 0, 10917}, 0}, {0, 0, {10919, 0, 10919}, 0},
+    {0, 0, {10921, 0, 10921}, 0}, {0, 0, {10923, 0, 10923}, 0},
+    {0, 0, {10925, 0, 10925}, 0}, {0, 0, {0, 10927, 10927}, 0},
+    {0, 0, {0, 10929, 10929}, 0}, {0, 0, {0, 10931, 10931}, 0},
+    {0, 0, {0, 10933, 10933}, 0}, {0, 0, {0, 10935, 10935}, 0},
+    {0, 0, {0, 10937, 10937}, 0}, {0, 0, {0, 10939, 10939}, 0},
+    {0, 0, {0, 10941, 10941}, 0}, {0, 0, {0, 10943, 10943}, 0},
+    {0, 0, {0, 10945, 10945}, 0}, {0, 0, {0, 10947, 10947}, 0},
+    {0, 0, {0, 10949, 10949}, 0}, {0, 0, {0, 10951, 10951}, 0},
+    {0, 0, {0, 10953, 10953}, 0}, {0, 0, {0, 10955, 10955}, 0},
+    {0, 0, {0, 10957, 10957}, 0}, {0, 0, {0, 10959, 10959}, 0},
+    {0, 0, {0, 10961, 10961}, 0}, {0, 0, {0, 10963, 10963}, 0},
+    {0, 0, {0, 10965, 10965}, 0}, {0, 0, {0, 10967, 10967}, 0},
+    {0, 0, {0, 10969, 10969}, 0}, {0, 0, {0, 10971, 10971}, 0},
+    {0, 0, {0, 10973, 10973}, 0}, {0, 0, {0, 10975, 10975}, 0},
+    {0, 0, {0, 10977, 10977}, 0}, {0, 0, {0, 10979, 10979}, 0},
+    {0, 0, {0, 10981, 10981}, 0}, {0, 0, {0, 10983, 10983}, 0},
+    {0, 0, {0, 10985, 10985}, 0}, {0, 0, {0, 10987, 10987}, 0},
+    {0, 0, {0, 10989, 10989}, 0}, {0, 0, {0, 10991, 10991}, 0},
+    {0, 0, {0, 10993, 10993}, 0}, {0, 0, {0, 10995, 10995}, 0},
+    {0, 0, {0, 10997, 10997}, 0}, {0, 0, {0, 10999, 10999}, 0},
+    {0, 0, {0, 11001, 11001}, 0}, {0, 0, {0, 11003, 11003}, 0},
+    {0, 0, {0, 11005, 11005}, 0}, {0, 0, {0, 11007, 11007}, 0},
+    {0, 0, {0, 11009, 11009}, 0}, {0, 0, {0, 11011, 11011}, 0},
+    {0, 0, {0, 11013, 11013}, 0}, {0, 0, {0, 11015, 11015}, 0},
+    {0, 0, {0, 11017, 11017}, 0}, {0, 0, {0, 11019, 11019}, 0},
+    {0, 0, {0, 11021, 11021}, 0}, {0, 0, {0, 11023, 11023}, 0},
+    {0, 0, {0, 11025, 11025}, 0}, {0, 0, {0, 11027, 11027}, 0},
+    {0, 0, {0, 11029, 11029}, 0}, {0, 0, {0, 11031, 11031}, 0},
+    {0, 0, {0, 11033, 11033}, 0}, {0, 0, {0, 11035, 11035}, 0},
+    {0, 0, {0, 11037, 11037}, 0}, {0, 0, {0, 11039, 11039}, 0},
+    {0, 0, {0, 11041, 11041}, 0}, {0, 0, {0, 11043, 11043}, 0},
+    {0, 0, {0, 11045, 11045}, 0}, {0, 0, {0, 11047, 11047}, 0},
+    {0, 0, {0, 11049, 11049}, 0}, {0, 0, {0, 11051, 11051}, 0},
+    {0, 0, {0, 11053, 11053}, 0}, {0, 0, {0, 11055, 11055}, 0},
+    {0, 0, {0, 11057, 11057}, 0}, {0, 0, {0, 11059, 11059}, 0},
+    {0, 0, {0, 11061, 11061}, 0}, {0, 0, {0, 11063, 11063}, 0},
+    {0, 0, {0, 11065, 11065}, 0}, {0, 0, {0, 11067, 11067}, 0},
+    {0, 0, {0, 11069, 11069}, 0}, {0, 0, {0, 11071, 11071}, 0},
+    {0, 0, {0, 11073, 11073}, 0}, {0, 0, {0, 11075, 11075}, 0},
+    {0, 0, {0, 11077, 11077}, 0}, {0, 0, {0, 11079, 11079}, 0},
+    {0, 0, {0, 11081, 11081}, 0}, {0, 0, {0, 11083, 11083}, 0},
+    {0, 0, {0, 11085, 11085}, 0}, {0, 0, {0, 11087, 11087}, 0},
+    {0, 0, {0, 11089, 11089}, 0}, {0, 0, {0, 11091, 11091}, 0},
+    {0, 0, {0, 11093, 11093}, 0}, {0, 0, {0, 11095, 11095}, 0},
+    {0, 0, {0, 11097, 11097}, 0}, {0, 0, {0, 11099, 11099}, 0},
+    {0, 0, {0, 11101, 11101}, 0}, {0, 0, {0, 11103, 11103}, 0},
+    {0, 0, {0, 11105, 11105}, 0}, {0, 0, {0, 11107, 11107}, 0},
+    {0, 0, {0, 11109, 11109}, 0}, {0, 0, {0, 11111, 11111}, 0},
+    {0, 0, {0, 11113, 11113}, 0}, {0, 0, {0, 11115, 11115}, 0},
+    {0, 0, {0, 11117, 11117}, 0}, {0, 0, {0, 11119, 11119}, 0},
+    {0, 0, {0, 11121, 11121}, 0}, {0, 0, {0, 11123, 11123}, 0},
+    {0, 0, {0, 11125, 11125}, 0}, {0, 0, {0, 11127, 11127}, 0},
+    {0, 0, {0, 11129, 11129}, 0}, {0, 0, {0, 11131, 11131}, 0},
+    {0, 0, {0, 11133, 11133}, 0}, {0, 0, {0, 11135, 11135}, 0},
+    {0, 0, {0, 11137, 11137}, 0}, {0, 0, {0, 11139, 11139}, 0},
+    {0, 0, {0, 11141, 11141}, 0}, {0, 0, {0, 11143, 11143}, 0},
+    {0, 0, {0, 11145, 11145}, 0}, {0, 0, {0, 11147, 11147}, 0},
+    {0, 0, {11149, 0, 11149}, 0}, {0, 0, {11151, 0, 11151}, 0},
+    {0, 0, {117, 0, 117}, 0}, {0, 0, {11153, 0, 11153}, 0},
+    {0, 0, {775, 0, 775}, 0}, {0, 0, {11155, 0, 11155}, 0},
+    {0, 0, {11157, 0, 11157}, 0}, {0, 0, {11159, 0, 11159}, 0},
+    {0, 0, {11161, 0, 11161}, 0}, {0, 0, {785, 0, 785}, 0},
+    {0, 0, {787, 0, 787}, 0}, {0, 0, {11163, 0, 11163}, 0},
+    {0, 0, {11165, 0, 11165}, 0}, {0, 0, {11167, 0, 11167}, 0},
+    {0, 0, {11169, 0, 11169}, 0}, {0, 0, {11171, 0, 11171}, 0},
+    {0, 0, {11173, 0, 11173}, 0}, {0, 0, {799, 0, 799}, 0},
+    {0, 0, {11175, 0, 11175}, 0}, {0, 0, {11177, 0, 11177}, 0},
+    {0, 0, {11179, 0, 11179}, 0}, {0, 0, {11181, 0, 11181}, 0},
+    {0, 0, {11183, 0, 11183}, 0}, {0, 0, {11185, 0, 11185}, 0},
+    {0, 0, {8408, 0, 8408}, 0}, {0, 0, {11187, 0, 11187}, 0},
+    {0, 0, {11189, 0, 11189}, 0}, {0, 0, {11191, 0, 11191}, 0},
+    {0, 0, {11193, 0, 11193}, 0}, {0, 0, {11195, 0, 11195}, 0},
+    {0, 0, {11197, 0, 11197}, 0}, {0, 0, {196, 0, 196}, 0},
+    {0, 0, {11199, 0, 11199}, 0}, {0, 0, {11201, 0, 11201}, 0},
+    {0, 0, {11203, 0, 11203}, 0}, {0, 0, {11205, 0, 11205}, 0},
+    {0, 0, {5693, 0, 5693}, 0}, {0, 0, {11207, 0, 11207}, 0},
+    {0, 0, {827, 0, 827}, 0}, {0, 0, {11209, 0, 11209}, 0},
+    {0, 0, {11211, 0, 11211}, 0}, {0, 0, {11213, 0, 11213}, 0},
+    {0, 0, {11215, 0, 11215}, 0}, {0, 0, {835, 0, 835}, 0},
+    {0, 0, {11217, 0, 11217}, 0}, {0, 0, {11219, 0, 11219}, 0},
+    {0, 0, {11221, 0, 11221}, 0}, {0, 0, {11223, 0, 11223}, 0},
+    {0, 0, {11225, 0, 11225}, 0}, {0, 0, {11227, 0, 11227}, 0},
+    {0, 0, {11229, 0, 11229}, 0}, {0, 0, {11231, 0, 11231}, 0},
+    {0, 0, {11233, 0, 11233}, 0}, {0, 0, {11235, 0, 11235}, 0},
+    {0, 0, {0, 11237, 11237}, 0}, {0, 0, {0, 11239, 11239}, 0},
+    {0, 0, {0, 11241, 11241}, 0}, {0, 0, {0, 11243, 11243}, 0},
+    {0, 0, {0, 11245, 11245}, 0}, {0, 0, {0, 11247, 11247}, 0},
+    {0, 0, {0, 11249, 11249}, 0}, {0, 0, {0, 11251, 11251}, 0},
+    {0, 0, {0, 11253, 11253}, 0}, {0, 0, {0, 11255, 11255}, 0},
+    {0, 0, {0, 11257, 11257}, 0}, {0, 0, {0, 11259, 11259}, 0},
+    {0, 0, {0, 11261, 11261}, 0}, {0, 0, {0, 11263, 11263}, 0},
+    {0, 0, {0, 11265, 11265}, 0}, {0, 0, {0, 11267, 11267}, 0},
+    {0, 0, {0, 11269, 11269}, 0}, {0, 0, {0, 11271, 11271}, 0},
+    {0, 0, {0, 11273, 11273}, 0}, {0, 0, {0, 11275, 11275}, 0},
+    {0, 0, {0, 11277, 11277}, 0}, {0, 0, {0, 11279, 11279}, 0},
+    {0, 0, {0, 11281, 11281}, 0}, {0, 0, {0, 11283, 11283}, 0},
+    {0, 0, {0, 11285, 11285}, 0}, {0, 0, {0, 11287, 11287}, 0},
+    {0, 0, {0, 11289, 11289}, 0}, {0, 0, {0, 11291, 11291}, 0},
+    {0, 0, {0, 11293, 11293}, 0}, {0, 0, {0, 11295, 11295}, 0},
+    {0, 0, {0, 11297, 11297}, 0}, {0, 0, {0, 11299, 11299}, 0},
+    {0, 0, {0, 11301, 11301}, 0}, {0, 0, {0, 11303, 11303}, 0},
+    {0, 0, {0, 11305, 11305}, 0}, {0, 0, {0, 11307, 11307}, 0},
+    {0, 0, {0, 11309, 11309}, 0}, {0, 0, {0, 11311, 11311}, 0},
+    {0, 0, {0, 11313, 11313}, 0}, {0, 0, {0, 11315, 11315}, 0},
+    {0, 0, {0, 11317, 11317}, 0}, {0, 0, {0, 11319, 11319}, 0},
+    {0, 0, {0, 11321, 11321}, 0}, {0, 0, {0, 11323, 11323}, 0},
+    {0, 0, {0, 11325, 11325}, 0}, {0, 0, {0, 11327, 11327}, 0},
+    {0, 0, {0, 11329, 11329}, 0}, {0, 0, {0, 11331, 11331}, 0},
+    {0, 0, {0, 11333, 11333}, 0}, {0, 0, {0, 11335, 11335}, 0},
+    {0, 0, {0, 11337, 11337}, 0}, {0, 0, {0, 0, 0}, 11339},
+    {0, 0, {0, 0, 0}, 11342}, {0, 0, {0, 0, 0}, 11345},
+    {0, 0, {0, 11348, 11348}, 0}, {0, 0, {0, 11350, 11350}, 0},
+    {0, 0, {0, 11352, 11352}, 0}, {0, 0, {0, 11354, 11354}, 0},
+    {0, 0, {0, 11356, 11356}, 0}, {0, 0, {0, 11358, 11358}, 0},
+    {0, 0, {0, 11360, 11360}, 0}, {0, 0, {0, 11362, 11362}, 0},
+    {0, 0, {0, 11364, 11364}, 0}, {0, 0, {0, 11366, 11366}, 0},
+    {0, 0, {0, 11368, 11368}, 0}, {0, 0, {0, 11370, 11370}, 0},
+    {0, 0, {0, 11372, 11372}, 0}, {0, 0, {0, 11374, 11374}, 0},
+    {0, 0, {0, 11376, 11376}, 0}, {0, 0, {0, 11378, 11378}, 0},
+    {0, 0, {0, 11380, 11380}, 0}, {0, 0, {0, 11382, 11382}, 0},
+    {0, 0, {0, 11384, 11384}, 0}, {0, 0, {0, 11386, 11386}, 0},
+    {0, 0, {0, 11388, 11388}, 0}, {0, 0, {0, 11390, 11390}, 0},
+    {0, 0, {0, 11392, 11392}, 0}, {0, 0, {0, 11394, 11394}, 0},
+    {0, 0, {0, 11396, 11396}, 0}, {0, 0, {0, 11398, 11398}, 0},
+    {0, 0, {0, 11400, 11400}, 0}, {0, 0, {0, 11402, 11402}, 0},
+    {0, 0, {0, 11404, 11404}, 0}, {0, 0, {0, 11406, 11406}, 0},
+    {0, 0, {0, 11408, 11408}, 0}, {0, 0, {0, 11410, 11410}, 0},
+    {0, 0, {0, 11412, 11412}, 0}, {0, 0, {0, 11414, 11414}, 0},
+    {0, 0, {0, 11416, 11416}, 0}, {0, 0, {0, 11418, 11418}, 0},
+    {0, 0, {0, 11420, 11420}, 0}, {0, 0, {0, 11422, 11422}, 0},
+    {0, 0, {0, 11424, 11424}, 0}, {0, 0, {0, 11426, 11426}, 0},
+    {0, 0, {0, 11428, 11428}, 0}, {0, 0, {0, 11430, 11430}, 0},
+    {0, 0, {0, 11432, 11432}, 0}, {0, 0, {0, 11434, 11434}, 0},
+    {0, 0, {0, 11436, 11436}, 0}, {0, 0, {0, 11438, 11438}, 0},
+    {0, 0, {0, 11440, 11440}, 0}, {0, 0, {0, 11442, 11442}, 0},
+    {0, 0, {0, 11444, 11444}, 0}, {0, 0, {0, 11446, 11446}, 0},
+    {0, 0, {0, 11448, 11448}, 0}, {0, 0, {0, 11450, 11450}, 0},
+    {0, 0, {0, 11452, 11452}, 0}, {0, 0, {0, 11454, 11454}, 0},
+    {0, 0, {0, 11456, 11456}, 0}, {0, 0, {0, 11458, 11458}, 0},
+    {0, 0, {0, 11460, 11460}, 0}, {0, 0, {0, 11462, 11462}, 0},
+    {0, 0, {0, 11464, 11464}, 0}, {0, 0, {0, 11466, 11466}, 0},
+    {0, 0, {0, 11468, 11468}, 0}, {0, 0, {0, 11470, 11470}, 0},
+    {0, 0, {0, 11472, 11472}, 0}, {0, 0, {0, 11474, 11474}, 0},
+    {6, 0, {0, 0, 0}, 0}, {0, 0, {11476, 0, 11476}, 11476},
+    {0, 0, {11479, 0, 11479}, 11479}, {0, 0, {11482, 0, 11482}, 11482},
+    {0, 0, {11486, 0, 11486}, 11486}, {0, 0, {11490, 0, 11490}, 11490},
+    {0, 0, {11494, 0, 11494}, 11494}, {0, 0, {11498, 0, 11498}, 11498},
+    {226, 0, {0, 0, 0}, 0}, {0, 0, {11502, 0, 11502}, 11502},
+    {0, 0, {11505, 0, 11505}, 11505}, {0, 0, {11508, 0, 11508}, 11508},
+    {0, 0, {11512, 0, 11512}, 11512}, {0, 0, {11516, 0, 11516}, 11516},
+    {0, 0, {11520, 0, 11520}, 11520}, {0, 0, {5557, 0, 37}, 0},
+    {0, 0, {5036, 0, 47}, 0}, {0, 0, {5571, 0, 49}, 0},
+    {0, 0, {11524, 0, 11524}, 0}, {0, 0, {11526, 0, 11526}, 0},
+    {0, 0, {11528, 0, 1417}, 0}, {0, 0, {11530, 0, 1419}, 0},
+    {0, 0, {11532, 0, 1423}, 0}, {0, 0, {11534, 0, 1425}, 0},
+    {0, 0, {11536, 0, 1427}, 0}, {0, 0, {11538, 0, 1429}, 0},
+    {0, 0, {1542, 0, 1431}, 0}, {0, 0, {11540, 0, 1349}, 0},
+    {0, 0, {11542, 0, 1433}, 0}, {0, 0, {11544, 0, 1435}, 0},
+    {0, 0, {11546, 0, 68}, 0}, {0, 0, {11548, 0, 1437}, 0},
+    {0, 0, {11550, 0, 1439}, 0}, {0, 0, {11552, 0, 1441}, 0},
+    {0, 0, {11554, 0, 1445}, 0}, {0, 0, {1546, 0, 1447}, 0},
+    {0, 0, {11556, 0, 1449}, 0}, {0, 0, {11558, 0, 1453}, 0},
+    {0, 0, {11560, 0, 1455}, 0}, {0, 0, {11562, 0, 1457}, 0},
+    {0, 0, {4872, 0, 1459}, 0}, {0, 0, {11564, 0, 11564}, 0},
+    {0, 0, {1417, 0, 1417}, 0}, {0, 0, {1425, 0, 1425}, 0},
+    {0, 0, {1427, 0, 1427}, 0}, {0, 0, {1429, 0, 1429}, 0},
+    {0, 0, {1349, 0, 1349}, 0}, {0, 0, {1433, 0, 1433}, 0},
+    {0, 0, {1435, 0, 1435}, 0}, {0, 0, {68, 0, 68}, 0},
+    {0, 0, {1437, 0, 1437}, 0}, {0, 0, {1439, 0, 1439}, 0},
+    {0, 0, {1441, 0, 1441}, 0}, {0, 0, {1447, 0, 1447}, 0},
+    {0, 0, {1449, 0, 1449}, 0}, {0, 0, {1451, 0, 1451}, 0},
+    {0, 0, {1457, 0, 1457}, 0}, {0, 0, {1459, 0, 1459}, 0},
+    {0, 0, {11566, 0, 11566}, 0}, {0, 0, {11568, 0, 1520}, 0},
+    {0, 0, {1520, 0, 1520}, 0}, {0, 0, {0, 11570, 11570}, 0},
+    {0, 0, {0, 11572, 11572}, 0}, {0, 0, {0, 11574, 11574}, 0},
+    {0, 0, {0, 11576, 11576}, 0}, {0, 0, {0, 11578, 11578}, 0},
+    {0, 0, {0, 11580, 11580}, 0}, {0, 0, {0, 11582, 11582}, 0},
+    {0, 0, {0, 11584, 11584}, 0}, {0, 0, {0, 11586, 11586}, 0},
+    {0, 0, {0, 11588, 11588}, 0}, {0, 0, {0, 11590, 11590}, 0},
+    {0, 0, {0, 11592, 11592}, 0}, {0, 0, {0, 11594, 11594}, 0},
+    {0, 0, {0, 11596, 11596}, 0}, {0, 0, {0, 11598, 11598}, 0},
+    {0, 0, {0, 11600, 11600}, 0}, {0, 0, {0, 11602, 11602}, 0},
+    {0, 0, {0, 11604, 11604}, 0}, {0, 0, {0, 11606, 11606}, 0},
+    {0, 0, {0, 11608, 11608}, 0}, {0, 0, {0, 11610, 11610}, 0},
+    {0, 0, {0, 11612, 11612}, 0}, {0, 0, {0, 11614, 11614}, 0},
+    {0, 0, {0, 11616, 11616}, 0}, {0, 0, {0, 11618, 11618}, 0},
+    {0, 0, {0, 11620, 11620}, 0}, {0, 0, {0, 11622, 11622}, 0},
+    {0, 0, {0, 11624, 11624}, 0}, {0, 0, {0, 11626, 11626}, 0},
+    {0, 0, {0, 11628, 11628}, 0}, {0, 0, {0, 11630, 11630}, 0},
+    {0, 0, {0, 11632, 11632}, 0}, {0, 0, {0, 11634, 11634}, 0},
+    {0, 0, {0, 11636, 11636}, 0}, {0, 0, {11638, 0, 11638}, 0},
+    {0, 0, {11640, 0, 11640}, 0}, {0, 0, {11642, 0, 11642}, 0},
+    {0, 0, {11644, 0, 11644}, 0}, {0, 0, {11647, 0, 11647}, 0},
+    {0, 0, {11650, 0, 11650}, 0}, {0, 0, {11653, 0, 11653}, 0},
+    {0, 0, {11656, 0, 11656}, 0}, {0, 0, {11659, 0, 11659}, 0},
+    {0, 0, {11662, 0, 11662}, 0}, {0, 0, {11665, 0, 11665}, 0},
+    {0, 0, {11668, 0, 11668}, 0}, {0, 0, {11671, 0, 11671}, 0},
+    {0, 0, {11674, 0, 11674}, 0}, {0, 0, {11677, 0, 5417}, 0},
+    {0, 0, {11681, 0, 5421}, 0}, {0, 0, {11685, 0, 5425}, 0},
+    {0, 0, {11689, 0, 5429}, 0}, {0, 0, {11693, 0, 5433}, 0},
+    {0, 0, {11697, 0, 5437}, 0}, {0, 0, {11701, 0, 5441}, 0},
+    {0, 0, {11705, 0, 5445}, 0}, {0, 0, {11709, 0, 5449}, 0},
+    {0, 0, {11713, 0, 5453}, 0}, {0, 0, {11717, 0, 5457}, 0},
+    {0, 0, {11721, 0, 5461}, 0}, {0, 0, {11725, 0, 5465}, 0},
+    {0, 0, {11729, 0, 5469}, 0}, {0, 0, {11733, 0, 5473}, 0},
+    {0, 0, {11737, 0, 5477}, 0}, {0, 0, {11741, 0, 5481}, 0},
+    {0, 0, {11745, 0, 5485}, 0}, {0, 0, {11749, 0, 5489}, 0},
+    {0, 0, {11753, 0, 5493}, 0}, {0, 0, {11757, 0, 5497}, 0},
+    {0, 0, {11761, 0, 5501}, 0}, {0, 0, {11765, 0, 5505}, 0},
+    {0, 0, {11769, 0, 5509}, 0}, {0, 0, {11773, 0, 5513}, 0},
+    {0, 0, {11777, 0, 5517}, 0}, {0, 0, {11781, 0, 11785}, 0},
+    {0, 0, {11789, 0, 7965}, 0}, {0, 0, {11792, 0, 11795}, 0},
+    {0, 0, {11798, 0, 11801}, 0}, {0, 0, {11804, 0, 11807}, 0},
+    {0, 0, {11810, 0, 225}, 0}, {0, 0, {11813, 0, 11817}, 0},
+    {0, 0, {11821, 0, 11824}, 0}, {0, 0, {11827, 0, 11830}, 0},
+    {0, 0, {11833, 0, 11836}, 0}, {0, 0, {11839, 0, 11842}, 0},
+    {0, 0, {11845, 0, 11848}, 0}, {0, 0, {11851, 0, 11851}, 0},
+    {0, 0, {11854, 0, 11854}, 0}, {0, 0, {11857, 0, 11857}, 0},
+    {0, 0, {11859, 0, 11859}, 0}, {0, 0, {11861, 0, 11861}, 0},
+    {0, 0, {11863, 0, 11863}, 0}, {0, 0, {11865, 0, 11865}, 0},
+    {0, 0, {11867, 0, 11867}, 0}, {0, 0, {11869, 0, 11869}, 0},
+    {0, 0, {11871, 0, 11871}, 0}, {0, 0, {11873, 0, 11873}, 0},
+    {0, 0, {11875, 0, 11875}, 0}, {0, 0, {11877, 0, 11877}, 0},
+    {0, 0, {11879, 0, 11879}, 0}, {0, 0, {11881, 0, 11881}, 0},
+    {0, 0, {11883, 0, 11883}, 0}, {0, 0, {11885, 0, 11885}, 0},
+    {0, 0, {11887, 0, 11887}, 0}, {0, 0, {11889, 0, 11889}, 0},
+    {0, 0, {11891, 0, 11891}, 0}, {0, 0, {11893, 0, 11893}, 0},
+    {0, 0, {11895, 0, 11895}, 0}, {0, 0, {11897, 0, 11897}, 0},
+    {0, 0, {11899, 0, 11899}, 0}, {0, 0, {11901, 0, 11901}, 0},
+    {0, 0, {11903, 0, 11903}, 0}, {0, 0, {11905, 0, 11905}, 0},
+    {0, 0, {11907, 0, 11907}, 0}, {0, 0, {11909, 0, 11909}, 0},
+    {0, 0, {11911, 0, 11911}, 0}, {0, 0, {11913, 0, 11913}, 0},
+    {0, 0, {11915, 0, 11915}, 0}, {0, 0, {11917, 0, 11917}, 0},
+    {0, 0, {11919, 0, 11919}, 0}, {0, 0, {11923, 0, 11923}, 0},
+    {0, 0, {11927, 0, 11927}, 0}, {0, 0, {11931, 0, 11931}, 0},
+    {0, 0, {11935, 0, 11935}, 0}, {0, 0, {11939, 0, 11939}, 0},
+    {0, 0, {11943, 0, 11943}, 0}, {0, 0, {11947, 0, 11947}, 0},
+    {0, 0, {11951, 0, 11951}, 0}, {0, 0, {11955, 0, 11955}, 0},
+    {0, 0, {11957, 0, 11957}, 0}, {0, 0, {11959, 0, 11959}, 0},
+    {0, 0, {11961, 0, 11961}, 0}, {0, 0, {11963, 0, 11963}, 0},
+    {0, 0, {11965, 0, 11965}, 0}, {0, 0, {11967, 0, 11967}, 0},
+    {0, 0, {11969, 0, 11969}, 0}, {0, 0, {11971, 0, 11971}, 0},
+    {0, 0, {11973, 0, 11973}, 0}, {0, 0, {11975, 0, 11975}, 0},
+    {0, 0, {11977, 0, 11977}, 0}, {0, 0, {11979, 0, 11979}, 0},
+    {0, 0, {11981, 0, 11981}, 0}, {0, 0, {11983, 0, 11983}, 0},
+    {0, 0, {11985, 0, 11985}, 0}, {0, 0, {11987, 0, 11987}, 0},
+    {0, 0, {11989, 0, 11989}, 0}, {0, 0, {11991, 0, 11991}, 0},
+    {0, 0, {11993, 0, 11993}, 0}, {0, 0, {11995, 0, 11995}, 0},
+    {0, 0, {11997, 0, 11997}, 0}, {0, 0, {11999, 0, 11999}, 0},
+    {0, 0, {12001, 0, 12001}, 0}, {0, 0, {12003, 0, 12003}, 0},
+    {0, 0, {12005, 0, 12005}, 0}, {0, 0, {12007, 0, 12007}, 0},
+    {0, 0, {12009, 0, 12009}, 0}, {0, 0, {12011, 0, 12011}, 0},
+    {0, 0, {12013, 0, 12013}, 0}, {0, 0, {12015, 0, 12015}, 0},
+    {0, 0, {12017, 0, 12017}, 0}, {0, 0, {12019, 0, 12019}, 0},
+    {0, 0, {12021, 0, 12021}, 0}, {0, 0, {12023, 0, 12023}, 0},
+    {0, 0, {12025, 0, 12025}, 0}, {0, 0, {12027, 0, 12027}, 0},
+    {0, 0, {12029, 0, 12029}, 0}, {0, 0, {12031, 0, 12031}, 0},
+    {0, 0, {12033, 0, 12033}, 0}, {0, 0, {12035, 0, 12035}, 0},
+    {0, 0, {12037, 0, 12037}, 0}, {0, 0, {12039, 0, 12039}, 0},
+    {0, 0, {12041, 0, 12041}, 0}, {0, 0, {12043, 0, 12043}, 0},
+    {0, 0, {12045, 0, 12045}, 0}, {0, 0, {12047, 0, 12047}, 0},
+    {0, 0, {12049, 0, 12049}, 0}, {0, 0, {12051, 0, 12051}, 0},
+    {0, 0, {12053, 0, 12053}, 0}, {0, 0, {12055, 0, 12055}, 0},
+    {0, 0, {12057, 0, 12057}, 0}, {0, 0, {12059, 0, 12059}, 0},
+    {0, 0, {12061, 0, 12061}, 0}, {0, 0, {12063, 0, 12063}, 0},
+    {0, 0, {12065, 0, 12065}, 0}, {0, 0, {12067, 0, 12067}, 0},
+    {0, 0, {12069, 0, 12069}, 0}, {0, 0, {12071, 0, 12071}, 0},
+    {0, 0, {12073, 0, 12073}, 0}, {0, 0, {12075, 0, 12075}, 0},
+    {0, 0, {12077, 0, 12077}, 0}, {0, 0, {12079, 0, 12079}, 0},
+    {0, 0, {12081, 0, 12081}, 0}, {0, 0, {12083, 0, 12083}, 0},
+    {0, 0, {12085, 0, 12085}, 0}, {0, 0, {12087, 0, 12087}, 0},
+    {0, 0, {12089, 0, 12089}, 0}, {0, 0, {12091, 0, 12091}, 0},
+    {0, 0, {12093, 0, 12093}, 0}, {0, 0, {12095, 0, 12095}, 0},
+    {0, 0, {12097, 0, 12097}, 0}, {0, 0, {12099, 0, 12099}, 0},
+    {0, 0, {12101, 0, 12101}, 0}, {0, 0, {12103, 0, 12103}, 0},
+    {0, 0, {12105, 0, 12105}, 0}, {0, 0, {12107, 0, 12107}, 0},
+    {0, 0, {12109, 0, 12109}, 0}, {0, 0, {12111, 0, 12111}, 0},
+    {0, 0, {12113, 0, 12113}, 0}, {0, 0, {12115, 0, 12115}, 0},
+    {0, 0, {12117, 0, 12117}, 0}, {0, 0, {12119, 0, 12119}, 0},
+    {0, 0, {12121, 0, 12121}, 0}, {0, 0, {12123, 0, 12123}, 0},
+    {0, 0, {12125, 0, 12125}, 0}, {0, 0, {12127, 0, 12127}, 0},
+    {0, 0, {12129, 0, 12129}, 0}, {0, 0, {12131, 0, 12131}, 0},
+    {0, 0, {12133, 0, 12133}, 0}, {0, 0, {12135, 0, 12135}, 0},
+    {0, 0, {12137, 0, 12137}, 0}, {0, 0, {12139, 0, 12139}, 0},
+    {0, 0, {12141, 0, 12141}, 0}, {0, 0, {12143, 0, 12143}, 0},
+    {0, 0, {12145, 0, 12145}, 0}, {0, 0, {12147, 0, 12147}, 0},
+    {0, 0, {12149, 0, 12149}, 0}, {0, 0, {12151, 0, 12151}, 0},
+    {0, 0, {12153, 0, 12153}, 0}, {0, 0, {12155, 0, 12155}, 0},
+    {0, 0, {12157, 0, 12157}, 0}, {0, 0, {12159, 0, 12159}, 0},
+    {0, 0, {12161, 0, 12161}, 0}, {0, 0, {12163, 0, 12163}, 0},
+    {0, 0, {12165, 0, 12165}, 0}, {0, 0, {12167, 0, 12167}, 0},
+    {0, 0, {12169, 0, 12169}, 0}, {0, 0, {12171, 0, 12171}, 0},
+    {0, 0, {12173, 0, 12173}, 0}, {0, 0, {12175, 0, 12175}, 0},
+    {0, 0, {12177, 0, 12177}, 0}, {0, 0, {12179, 0, 12179}, 0},
+    {0, 0, {12181, 0, 12181}, 0}, {0, 0, {12183, 0, 12183}, 0},
+    {0, 0, {12185, 0, 12185}, 0}, {0, 0, {12187, 0, 12187}, 0},
+    {0, 0, {12189, 0, 12189}, 0}, {0, 0, {12191, 0, 12191}, 0},
+    {0, 0, {12193, 0, 12193}, 0}, {0, 0, {12195, 0, 12195}, 0},
+    {0, 0, {12197, 0, 12197}, 0}, {0, 0, {12199, 0, 12199}, 0},
+    {0, 0, {12201, 0, 12201}, 0}, {0, 0, {12203, 0, 12203}, 0},
+    {0, 0, {12205, 0, 12205}, 0}, {0, 0, {12207, 0, 12207}, 0},
+    {0, 0, {12209, 0, 12209}, 0}, {0, 0, {12211, 0, 12211}, 0},
+    {0, 0, {12213, 0, 12213}, 0}, {0, 0, {12215, 0, 12215}, 0},
+    {0, 0, {12217, 0, 12217}, 0}, {0, 0, {12219, 0, 12219}, 0},
+    {0, 0, {12221, 0, 12221}, 0}, {0, 0, {12223, 0, 12223}, 0},
+    {0, 0, {12225, 0, 12225}, 0}, {0, 0, {12227, 0, 12227}, 0},
+    {0, 0, {12229, 0, 12229}, 0}, {0, 0, {12231, 0, 12231}, 0},
+    {0, 0, {12233, 0, 12233}, 0}, {0, 0, {12235, 0, 12235}, 0},
+    {0, 0, {12237, 0, 12237}, 0}, {0, 0, {12239, 0, 12239}, 0},
+    {0, 0, {12241, 0, 12241}, 0}, {0, 0, {12243, 0, 12243}, 0},
+    {0, 0, {12245, 0, 12245}, 0}, {0, 0, {12247, 0, 12247}, 0},
+    {0, 0, {12249, 0, 12249}, 0}, {0, 0, {12251, 0, 12251}, 0},
+    {0, 0, {12253, 0, 12253}, 0}, {0, 0, {12255, 0, 12255}, 0},
+    {0, 0, {12257, 0, 12257}, 0}, {0, 0, {12259, 0, 12259}, 0},
+    {0, 0, {12261, 0, 12261}, 0}, {0, 0, {12263, 0, 12263}, 0},
+    {0, 0, {12265, 0, 12265}, 0}, {0, 0, {12267, 0, 12267}, 0},
+    {0, 0, {12269, 0, 12269}, 0}, {0, 0, {12271, 0, 12271}, 0},
+    {0, 0, {12273, 0, 12273}, 0}, {0, 0, {12275, 0, 12275}, 0},
+    {0, 0, {12277, 0, 12277}, 0}, {0, 0, {12279, 0, 12279}, 0},
+    {0, 0, {12281, 0, 12281}, 0}, {0, 0, {12283, 0, 12283}, 0},
+    {0, 0, {12285, 0, 12285}, 0}, {0, 0, {12287, 0, 12287}, 0},
+    {0, 0, {12289, 0, 12289}, 0}, {0, 0, {12291, 0, 12291}, 0},
+    {0, 0, {12293, 0, 12293}, 0}, {0, 0, {12295, 0, 12295}, 0},
+    {0, 0, {12297, 0, 12297}, 0}, {0, 0, {12299, 0, 12299}, 0},
+    {0, 0, {12301, 0, 12301}, 0}, {0, 0, {12303, 0, 12303}, 0},
+    {0, 0, {12305, 0, 12305}, 0}, {0, 0, {12307, 0, 12307}, 0},
+    {0, 0, {12309, 0, 12309}, 0}, {0, 0, {12311, 0, 12311}, 0},
+    {0, 0, {12313, 0, 12313}, 0}, {0, 0, {12315, 0, 12315}, 0},
+    {0, 0, {12317, 0, 12317}, 0}, {0, 0, {12319, 0, 12319}, 0},
+    {0, 0, {12321, 0, 12321}, 0}, {0, 0, {12323, 0, 12323}, 0},
+    {0, 0, {12325, 0, 12325}, 0}, {0, 0, {12327, 0, 12327}, 0},
+    {0, 0, {12329, 0, 12329}, 0}, {0, 0, {12331, 0, 12331}, 0},
+    {0, 0, {12333, 0, 12333}, 0}, {0, 0, {12335, 0, 12335}, 0},
+    {0, 0, {12337, 0, 12337}, 0}, {0, 0, {12339, 0, 12339}, 0},
+    {0, 0, {12341, 0, 12341}, 0}, {0, 0, {12343, 0, 12343}, 0},
+    {0, 0, {12345, 0, 12345}, 0}, {0, 0, {12347, 0, 12347}, 0},
+    {0, 0, {12349, 0, 12349}, 0}, {0, 0, {12351, 0, 12351}, 0},
+    {0, 0, {12353, 0, 12353}, 0}, {0, 0, {12355, 0, 12355}, 0},
+    {0, 0, {12357, 0, 12357}, 0}, {0, 0, {12359, 0, 12359}, 0},
+    {0, 0, {12361, 0, 12361}, 0}, {0, 0, {12363, 0, 12363}, 0},
+    {0, 0, {12365, 0, 12365}, 0}, {0, 0, {12367, 0, 12367}, 0},
+    {0, 0, {12369, 0, 12369}, 0}, {0, 0, {12371, 0, 12371}, 0},
+    {0, 0, {12373, 0, 12373}, 0}, {0, 0, {12375, 0, 12375}, 0},
+    {0, 0, {12377, 0, 12377}, 0}, {0, 0, {12379, 0, 12379}, 0},
+    {0, 0, {12381, 0, 12381}, 0}, {0, 0, {12383, 0, 12383}, 0},
+    {0, 0, {12385, 0, 12385}, 0}, {0, 0, {12387, 0, 12387}, 0},
+    {0, 0, {12389, 0, 12389}, 0}, {0, 0, {12391, 0, 12391}, 0},
+    {0, 0, {12393, 0, 12393}, 0}, {0, 0, {12395, 0, 12395}, 0},
+    {0, 0, {12397, 0, 12397}, 0}, {0, 0, {12399, 0, 12399}, 0},
+    {0, 0, {12401, 0, 12401}, 0}, {0, 0, {12403, 0, 12403}, 0},
+    {0, 0, {12405, 0, 12405}, 0}, {0, 0, {12407, 0, 12407}, 0},
+    {0, 0, {12409, 0, 12409}, 0}, {0, 0, {12411, 0, 12411}, 0},
+    {0, 0, {12413, 0, 12413}, 0}, {0, 0, {12415, 0, 12415}, 0},
+    {0, 0, {12417, 0, 12417}, 0}, {0, 0, {12419, 0, 12419}, 0},
+    {0, 0, {12421, 0, 12421}, 0}, {0, 0, {12423, 0, 12423}, 0},
+    {0, 0, {12425, 0, 12425}, 0}, {0, 0, {12427, 0, 12427}, 0},
+    {0, 0, {12429, 0, 12429}, 0}, {0, 0, {12431, 0, 12431}, 0},
+    {0, 0, {12433, 0, 12433}, 0}, {0, 0, {12435, 0, 12435}, 0},
+    {0, 0, {12437, 0, 12437}, 0}, {0, 0, {12439, 0, 12439}, 0},
+    {0, 0, {12441, 0, 12441}, 0}, {0, 0, {12443, 0, 12443}, 0},
+    {0, 0, {12445, 0, 12445}, 0}, {0, 0, {12447, 0, 12447}, 0},
+    {0, 0, {12449, 0, 12449}, 0}, {0, 0, {12451, 0, 12451}, 0},
+    {0, 0, {12453, 0, 12453}, 0}, {0, 0, {12455, 0, 12455}, 0},
+    {0, 0, {12457, 0, 12457}, 0}, {0, 0, {12459, 0, 12459}, 0},
+    {0, 0, {12461, 0, 12461}, 0}, {0, 0, {12463, 0, 12463}, 0},
+    {0, 0, {12465, 0, 12465}, 0}, {0, 0, {12467, 0, 12467}, 0},
+    {0, 0, {12469, 0, 12469}, 0}, {0, 0, {12471, 0, 12471}, 0},
+    {0, 0, {12473, 0, 12473}, 0}, {0, 0, {12475, 0, 12475}, 0},
+    {0, 0, {12477, 0, 12477}, 0}, {0, 0, {12479, 0, 12479}, 0},
+    {0, 0, {12481, 0, 12481}, 0}, {0, 0, {12483, 0, 12483}, 0},
+    {0, 0, {12485, 0, 12485}, 0}, {0, 0, {12487, 0, 12487}, 0},
+    {0, 0, {12489, 0, 12489}, 0}, {0, 0, {12491, 0, 12491}, 0},
+    {0, 0, {12493, 0, 12493}, 0}, {0, 0, {12495, 0, 12495}, 0},
+    {0, 0, {12497, 0, 12497}, 0}, {0, 0, {12499, 0, 12499}, 0},
+    {0, 0, {12501, 0, 12501}, 0}, {0, 0, {12503, 0, 12503}, 0},
+    {0, 0, {12505, 0, 12505}, 0}, {0, 0, {12507, 0, 12507}, 0},
+    {0, 0, {12509, 0, 12509}, 0}, {0, 0, {12511, 0, 12511}, 0},
+    {0, 0, {12513, 0, 12513}, 0}, {0, 0, {12515, 0, 12515}, 0},
+    {0, 0, {12517, 0, 12517}, 0}, {0, 0, {12519, 0, 12519}, 0},
+    {0, 0, {12521, 0, 12521}, 0}, {0, 0, {12523, 0, 12523}, 0},
+    {0, 0, {12525, 0, 12525}, 0}, {0, 0, {12527, 0, 12527}, 0},
+    {0, 0, {12529, 0, 12529}, 0}, {0, 0, {12531, 0, 12531}, 0},
+    {0, 0, {12533, 0, 12533}, 0}, {0, 0, {12535, 0, 12535}, 0},
+    {0, 0, {12537, 0, 12537}, 0}, {0, 0, {12539, 0, 12539}, 0},
+    {0, 0, {12541, 0, 12541}, 0}, {0, 0, {12543, 0, 12543}, 0},
+    {0, 0, {12545, 0, 12545}, 0}, {0, 0, {12547, 0, 12547}, 0},
+    {0, 0, {12549, 0, 12549}, 0}, {0, 0, {12551, 0, 12551}, 0},
+    {0, 0, {12553, 0, 12553}, 0}, {0, 0, {12555, 0, 12555}, 0},
+    {0, 0, {12557, 0, 12557}, 0}, {0, 0, {12559, 0, 12559}, 0},
+    {0, 0, {12561, 0, 12561}, 0}, {0, 0, {12563, 0, 12563}, 0},
+    {0, 0, {12565, 0, 12565}, 0}, {0, 0, {12567, 0, 12567}, 0},
+    {0, 0, {12569, 0, 12569}, 0}, {0, 0, {12571, 0, 12571}, 0},
+    {0, 0, {12573, 0, 12573}, 0}, {0, 0, {12575, 0, 12575}, 0},
+    {0, 0, {12577, 0, 12577}, 0}, {0, 0, {12579, 0, 12579}, 0},
+    {0, 0, {12581, 0, 12581}, 0}, {0, 0, {12583, 0, 12583}, 0},
+    {0, 0, {12585, 0, 12585}, 0}, {0, 0, {12587, 0, 12587}, 0},
+    {0, 0, {12589, 0, 12589}, 0}, {0, 0, {12591, 0, 12591}, 0},
+    {0, 0, {12593, 0, 12593}, 0}, {0, 0, {12595, 0, 12595}, 0},
+    {0, 0, {12597, 0, 12597}, 0}, {0, 0, {12599, 0, 12599}, 0},
+    {0, 0, {12601, 0, 12601}, 0}, {0, 0, {12603, 0, 12603}, 0},
+    {0, 0, {12605, 0, 12605}, 0}, {0, 0, {12607, 0, 12607}, 0},
+    {0, 0, {12609, 0, 12609}, 0}, {0, 0, {12611, 0, 12611}, 0},
+    {0, 0, {12613, 0, 12613}, 0}, {0, 0, {12615, 0, 12615}, 0},
+    {0, 0, {12617, 0, 12617}, 0}, {0, 0, {12619, 0, 12619}, 0},
+    {0, 0, {12621, 0, 12621}, 0}, {0, 0, {12623, 0, 12623}, 0},
+    {0, 0, {12625, 0, 12625}, 0}, {0, 0, {12627, 0, 12627}, 0},
+    {0, 0, {12629, 0, 12629}, 0}, {0, 0, {12631, 0, 12631}, 0},
+    {0, 0, {12633, 0, 12633}, 0}, {0, 0, {12635, 0, 12635}, 0},
+    {0, 0, {12637, 0, 12637}, 0}, {0, 0, {12639, 0, 12639}, 0},
+    {0, 0, {12641, 0, 12641}, 0}, {0, 0, {12643, 0, 12643}, 0},
+    {0, 0, {12645, 0, 12645}, 0}, {0, 0, {12647, 0, 12647}, 0},
+    {0, 0, {12649, 0, 12649}, 0}, {0, 0, {12651, 0, 12651}, 0},
+    {0, 0, {12653, 0, 12653}, 0}, {0, 0, {12655, 0, 12655}, 0},
+    {0, 0, {12657, 0, 12657}, 0}, {0, 0, {12659, 0, 12659}, 0},
+    {0, 0, {12661, 0, 12661}, 0}, {0, 0, {12663, 0, 12663}, 0},
+    {0, 0, {12665, 0, 12665}, 0}, {0, 0, {12667, 0, 12667}, 0},
+    {0, 0, {12669, 0, 12669}, 0}, {0, 0, {12671, 0, 12671}, 0},
+    {0, 0, {12673, 0, 12673}, 0}, {0, 0, {12675, 0, 12675}, 0},
+    {0, 0, {12677, 0, 12677}, 0}, {0, 0, {12679, 0, 12679}, 0},
+    {0, 0, {12681, 0, 12681}, 0}, {0, 0, {12683, 0, 12683}, 0},
+    {0, 0, {12685, 0, 12685}, 0}, {0, 0, {12687, 0, 12687}, 0},
+    {0, 0, {12689, 0, 12689}, 0}, {0, 0, {12691, 0, 12691}, 0},
+    {0, 0, {12693, 0, 12693}, 0}, {0, 0, {12695, 0, 12695}, 0},
+    {0, 0, {12697, 0, 12697}, 0}, {0, 0, {12699, 0, 12699}, 0},
+    {0, 0, {12701, 0, 12701}, 0}, {0, 0, {12703, 0, 12703}, 0},
+    {0, 0, {12705, 0, 12705}, 0}, {0, 0, {12707, 0, 12707}, 0},
+    {0, 0, {12709, 0, 12709}, 0}, {0, 0, {12711, 0, 12711}, 0},
+    {0, 0, {12713, 0, 12713}, 0}, {0, 0, {12715, 0, 12715}, 0},
+    {0, 0, {12717, 0, 12717}, 0}, {0, 0, {12719, 0, 12719}, 0},
+    {0, 0, {12721, 0, 12721}, 0}, {0, 0, {12723, 0, 12723}, 0},
+    {0, 0, {12725, 0, 12725}, 0}, {0, 0, {12727, 0, 12727}, 0},
+    {0, 0, {12729, 0, 12729}, 0}, {0, 0, {12731, 0, 12731}, 0},
+    {0, 0, {12733, 0, 12733}, 0}, {0, 0, {12735, 0, 12735}, 0},
+    {0, 0, {12737, 0, 12737}, 0}, {0, 0, {12739, 0, 12739}, 0},
+    {0, 0, {12741, 0, 12741}, 0}, {0, 0, {12743, 0, 12743}, 0},
+    {0, 0, {12745, 0, 12745}, 0}, {0, 0, {12747, 0, 12747}, 0},
+    {0, 0, {12749, 0, 12749}, 0}, {0, 0, {12751, 0, 12751}, 0},
+    {0, 0, {12753, 0, 12753}, 0}, {0, 0, {12755, 0, 12755}, 0},
+    {0, 0, {12757, 0, 12757}, 0}, {0, 0, {12759, 0, 12759}, 0},
+    {0, 0, {12761, 0, 12761}, 0}, {0, 0, {12763, 0, 12763}, 0},
+    {0, 0, {12765, 0, 12765}, 0}, {0, 0, {12767, 0, 12767}, 0},
+    {0, 0, {12769, 0, 12769}, 0}, {0, 0, {12771, 0, 12771}, 0},
+    {0, 0, {12773, 0, 12773}, 0}, {0, 0, {12775, 0, 12775}, 0},
+    {0, 0, {12777, 0, 12777}, 0}, {0, 0, {12779, 0, 12779}, 0},
+    {0, 0, {12781, 0, 12781}, 0}, {0, 0, {12783, 0, 12783}, 0},
+    {0, 0, {12785, 0, 12785}, 0}, {0, 0, {12787, 0, 12787}, 0},
+    {0, 0, {12789, 0, 12789}, 0}, {0, 0, {12791, 0, 12791}, 0},
+    {0, 0, {12793, 0, 12793}, 0}, {0, 0, {12795, 0, 12795}, 0},
+    {0, 0, {12797, 0, 12797}, 0}, {0, 0, {12799, 0, 12799}, 0},
+    {0, 0, {12801, 0, 12801}, 0}, {0, 0, {12803, 0, 12803}, 0},
+    {0, 0, {12805, 0, 12805}, 0}, {0, 0, {12807, 0, 12807}, 0},
+    {0, 0, {12809, 0, 12809}, 0}, {0, 0, {12811, 0, 12811}, 0},
+    {0, 0, {12813, 0, 12813}, 0}, {0, 0, {12815, 0, 12815}, 0},
+    {0, 0, {12817, 0, 12817}, 0}, {0, 0, {12819, 0, 12819}, 0},
+    {0, 0, {12821, 0, 12821}, 0}, {0, 0, {12823, 0, 12823}, 0},
+    {0, 0, {12825, 0, 12825}, 0}, {0, 0, {12827, 0, 12827}, 0},
+    {0, 0, {12829, 0, 12829}, 0}, {0, 0, {12831, 0, 12831}, 0},
+    {0, 0, {12833, 0, 12833}, 0}, {0, 0, {12835, 0, 12835}, 0},
+    {0, 0, {12837, 0, 12837}, 0}, {0, 0, {12839, 0, 12839}, 0},
+    {0, 0, {12841, 0, 12841}, 0}, {0, 0, {12843, 0, 12843}, 0},
+    {0, 0, {12845, 0, 12845}, 0}, {0, 0, {12847, 0, 12847}, 0},
+    {0, 0, {12849, 0, 12849}, 0}, {0, 0, {12851, 0, 12851}, 0},
+    {0, 0, {12853, 0, 12853}, 0}, {0, 0, {12855, 0, 12855}, 0},
+    {0, 0, {12857, 0, 12857}, 0}, {0, 0, {12859, 0, 12859}, 0},
+    {0, 0, {12861, 0, 12861}, 0}, {0, 0, {12863, 0, 12863}, 0},
+    {0, 0, {12865, 0, 12865}, 0}, {0, 0, {12867, 0, 12867}, 0},
+    {0, 0, {12869, 0, 12869}, 0}, {0, 0, {12871, 0, 12871}, 0},
+    {0, 0, {12873, 0, 12873}, 0}, {0, 0, {12875, 0, 12875}, 0},
+    {0, 0, {12877, 0, 12877}, 0}, {0, 0, {12879, 0, 12879}, 0},
+    {0, 0, {12881, 0, 12881}, 0}, {0, 0, {12883, 0, 12883}, 0},
+    {0, 0, {12885, 0, 12885}, 0}, {0, 0, {12887, 0, 12887}, 0},
+    {0, 0, {12889, 0, 12889}, 0},
+};
+
+const uint32_t unicode_sequences[] = {
+    0x0, 0x1, 0x61, 0x1, 0x62, 0x1, 0x63, 0x1, 0x64, 0x1, 0x65, 0x1, 0x66, 0x1,
+    0x67, 0x1, 0x68, 0x1, 0x69, 0x1, 0x6A, 0x1, 0x6B, 0x1, 0x6C, 0x1, 0x6D, 0x1,
+    0x6E, 0x1, 0x6F, 0x1, 0x70, 0x1, 0x71, 0x1, 0x72, 0x1, 0x73, 0x1, 0x74, 0x1,
+    0x75, 0x1, 0x76, 0x1, 0x77, 0x1, 0x78, 0x1, 0x79, 0x1, 0x7A, 0x1, 0x20, 0x2,
+    0x20, 0x308, 0x2, 0x20, 0x304, 0x1, 0x32, 0x1, 0x33, 0x2, 0x20, 0x301, 0x1,
+    0x3BC, 0x2, 0x20, 0x327, 0x1, 0x31, 0x3, 0x31, 0x2044, 0x34, 0x3, 0x31,
+    0x2044, 0x32, 0x3, 0x33, 0x2044, 0x34, 0x1, 0xE0, 0x2, 0x41, 0x300, 0x1,
+    0xE1, 0x2, 0x41, 0x301, 0x1, 0xE2, 0x2, 0x41, 0x302, 0x1, 0xE3, 0x2, 0x41,
+    0x303, 0x1, 0xE4, 0x2, 0x41, 0x308, 0x1, 0xE5, 0x2, 0x41, 0x30A, 0x1, 0xE6,
+    0x1, 0xE7, 0x2, 0x43, 0x327, 0x1, 0xE8, 0x2, 0x45, 0x300, 0x1, 0xE9, 0x2,
+    0x45, 0x301, 0x1, 0xEA, 0x2, 0x45, 0x302, 0x1, 0xEB, 0x2, 0x45, 0x308, 0x1,
+    0xEC, 0x2, 0x49, 0x300, 0x1, 0xED, 0x2, 0x49, 0x301, 0x1, 0xEE, 0x2, 0x49,
+    0x302, 0x1, 0xEF, 0x2, 0x49, 0x308, 0x1, 0xF0, 0x1, 0xF1, 0x2, 0x4E, 0x303,
+    0x1, 0xF2, 0x2, 0x4F, 0x300, 0x1, 0xF3, 0x2, 0x4F, 0x301, 0x1, 0xF4, 0x2,
+    0x4F, 0x302, 0x1, 0xF5, 0x2, 0x4F, 0x303, 0x1, 0xF6, 0x2, 0x4F, 0x308, 0x1,
+    0xF8, 0x1, 0xF9, 0x2, 0x55, 0x300, 0x1, 0xFA, 0x2, 0x55, 0x301, 0x1, 0xFB,
+    0x2, 0x55, 0x302, 0x1, 0xFC, 0x2, 0x55, 0x308, 0x1, 0xFD, 0x2, 0x59, 0x301,
+    0x1, 0xFE, 0x2, 0x73, 0x73, 0x2, 0x61, 0x300, 0x2, 0x61, 0x301, 0x2, 0x61,
+    0x302, 0x2, 0x61, 0x303, 0x2, 0x61, 0x308, 0x2, 0x61, 0x30A, 0x2, 0x63,
+    0x327, 0x2, 0x65, 0x300, 0x2, 0x65, 0x301, 0x2, 0x65, 0x302, 0x2, 0x65,
+    0x308, 0x2, 0x69, 0x300, 0x2, 0x69, 0x301, 0x2, 0x69, 0x302, 0x2, 0x69,
+    0x308, 0x2, 0x6E, 0x303, 0x2, 0x6F, 0x300, 0x2, 0x6F, 0x301, 0x2, 0x6F,
+    0x302, 0x2, 0x6F, 0x303, 0x2, 0x6F, 0x308, 0x2, 0x75, 0x300, 0x2, 0x75,
+    0x301, 0x2, 0x75, 0x302, 0x2, 0x75, 0x308, 0x2, 0x79, 0x301, 0x2, 0x79,
+    0x308, 0x1, 0x101, 0x2, 0x41, 0x304, 0x2, 0x61, 0x304, 0x1, 0x103, 0x2,
+    0x41, 0x306, 0x2, 0x61, 0x306, 0x1, 0x105, 0x2, 0x41, 0x328, 0x2, 0x61,
+    0x328, 0x1, 0x107, 0x2, 0x43, 0x301, 0x2, 0x63, 0x301, 0x1, 0x109, 0x2,
+    0x43, 0x302, 0x2, 0x63, 0x302, 0x1, 0x10B, 0x2, 0x43, 0x307, 0x2, 0x63,
+    0x307, 0x1, 0x10D, 0x2, 0x43, 0x30C, 0x2, 0x63, 0x30C, 0x1, 0x10F, 0x2,
+    0x44, 0x30C, 0x2, 0x64, 0x30C, 0x1, 0x111, 0x1, 0x113, 0x2, 0x45, 0x304,
+    0x2, 0x65, 0x304, 0x1, 0x115, 0x2, 0x45, 0x306, 0x2, 0x65, 0x306, 0x1,
+    0x117, 0x2, 0x45, 0x307, 0x2, 0x65, 0x307, 0x1, 0x119, 0x2, 0x45, 0x328,
+    0x2, 0x65, 0x328, 0x1, 0x11B, 0x2, 0x45, 0x30C, 0x2, 0x65, 0x30C, 0x1,
+    0x11D, 0x2, 0x47, 0x302, 0x2, 0x67, 0x302, 0x1, 0x11F, 0x2, 0x47, 0x306,
+    0x2, 0x67, 0x306, 0x1, 0x121, 0x2, 0x47, 0x307, 0x2, 0x67, 0x307, 0x1,
+    0x123, 0x2, 0x47, 0x327, 0x2, 0x67, 0x327, 0x1, 0x125, 0x2, 0x48, 0x302,
+    0x2, 0x68, 0x302, 0x1, 0x127, 0x1, 0x129, 0x2, 0x49, 0x303, 0x2, 0x69,
+    0x303, 0x1, 0x12B, 0x2, 0x49, 0x304, 0x2, 0x69, 0x304, 0x1, 0x12D, 0x2,
+    0x49, 0x306, 0x2, 0x69, 0x306, 0x1, 0x12F, 0x2, 0x49, 0x328, 0x2, 0x69,
+    0x328, 0x2, 0x69, 0x307, 0x2, 0x49, 0x307, 0x2, 0x49, 0x4A, 0x1, 0x133, 0x2,
+    0x69, 0x6A, 0x1, 0x135, 0x2, 0x4A, 0x302, 0x2, 0x6A, 0x302, 0x1, 0x137, 0x2,
+    0x4B, 0x327, 0x2, 0x6B, 0x327, 0x1, 0x13A, 0x2, 0x4C, 0x301, 0x2, 0x6C,
+    0x301, 0x1, 0x13C, 0x2, 0x4C, 0x327, 0x2, 0x6C, 0x327, 0x1, 0x13E, 0x2,
+    0x4C, 0x30C, 0x2, 0x6C, 0x30C, 0x2, 0x4C, 0xB7, 0x1, 0x140, 0x2, 0x6C, 0xB7,
+    0x1, 0x142, 0x1, 0x144, 0x2, 0x4E, 0x301, 0x2, 0x6E, 0x301, 0x1, 0x146, 0x2,
+    0x4E, 0x327, 0x2, 0x6E, 0x327, 0x1, 0x148, 0x2, 0x4E, 0x30C, 0x2, 0x6E,
+    0x30C, 0x2, 0x2BC, 0x6E, 0x1, 0x14B, 0x1, 0x14D, 0x2, 0x4F, 0x304, 0x2,
+    0x6F, 0x304, 0x1, 0x14F, 0x2, 0x4F, 0x306, 0x2, 0x6F, 0x306, 0x1, 0x151,
+    0x2, 0x4F, 0x30B, 0x2, 0x6F, 0x30B, 0x1, 0x153, 0x1, 0x155, 0x2, 0x52,
+    0x301, 0x2, 0x72, 0x301, 0x1, 0x157, 0x2, 0x52, 0x327, 0x2, 0x72, 0x327,
+    0x1, 0x159, 0x2, 0x52, 0x30C, 0x2, 0x72, 0x30C, 0x1, 0x15B, 0x2, 0x53,
+    0x301, 0x2, 0x73, 0x301, 0x1, 0x15D, 0x2, 0x53, 0x302, 0x2, 0x73, 0x302,
+    0x1, 0x15F, 0x2, 0x53, 0x327, 0x2, 0x73, 0x327, 0x1, 0x161, 0x2, 0x53,
+    0x30C, 0x2, 0x73, 0x30C, 0x1, 0x163, 0x2, 0x54, 0x327, 0x2, 0x74, 0x327,
+    0x1, 0x165, 0x2, 0x54, 0x30C, 0x2, 0x74, 0x30C, 0x1, 0x167, 0x1, 0x169, 0x2,
+    0x55, 0x303, 0x2, 0x75, 0x303, 0x1, 0x16B, 0x2, 0x55, 0x304, 0x2, 0x75,
+    0x304, 0x1, 0x16D, 0x2, 0x55, 0x306, 0x2, 0x75, 0x306, 0x1, 0x16F, 0x2,
+    0x55, 0x30A, 0x2, 0x75, 0x30A, 0x1, 0x171, 0x2, 0x55, 0x30B, 0x2, 0x75,
+    0x30B, 0x1, 0x173, 0x2, 0x55, 0x328, 0x2, 0x75, 0x328, 0x1, 0x175, 0x2,
+    0x57, 0x302, 0x2, 0x77, 0x302, 0x1, 0x177, 0x2, 0x59, 0x302, 0x2, 0x79,
+    0x302, 0x1, 0xFF, 0x2, 0x59, 0x308, 0x1, 0x17A, 0x2, 0x5A, 0x301, 0x2, 0x7A,
+    0x301, 0x1, 0x17C, 0x2, 0x5A, 0x307, 0x2, 0x7A, 0x307, 0x1, 0x17E, 0x2,
+    0x5A, 0x30C, 0x2, 0x7A, 0x30C, 0x1, 0x253, 0x1, 0x183, 0x1, 0x185, 0x1,
+    0x254, 0x1, 0x188, 0x1, 0x256, 0x1, 0x257, 0x1, 0x18C, 0x1, 0x1DD, 0x1,
+    0x259, 0x1, 0x25B, 0x1, 0x192, 0x1, 0x260, 0x1, 0x263, 0x1, 0x269, 0x1,
+    0x268, 0x1, 0x199, 0x1, 0x26F, 0x1, 0x272, 0x1, 0x275, 0x1, 0x1A1, 0x2,
+    0x4F, 0x31B, 0x2, 0x6F, 0x31B, 0x1, 0x1A3, 0x1, 0x1A5, 0x1, 0x280, 0x1,
+    0x1A8, 0x1, 0x283, 0x1, 0x1AD, 0x1, 0x288, 0x1, 0x1B0, 0x2, 0x55, 0x31B,
+    0x2, 0x75, 0x31B, 0x1, 0x28A, 0x1, 0x28B, 0x1, 0x1B4, 0x1, 0x1B6, 0x1,
+    0x292, 0x1, 0x1B9, 0x1, 0x1BD, 0x2, 0x44, 0x17D, 0x1, 0x1C6, 0x2, 0x64,
+    0x17E, 0x2, 0x44, 0x17E, 0x2, 0x4C, 0x4A, 0x1, 0x1C9, 0x2, 0x6C, 0x6A, 0x2,
+    0x4C, 0x6A, 0x2, 0x4E, 0x4A, 0x1, 0x1CC, 0x2, 0x6E, 0x6A, 0x2, 0x4E, 0x6A,
+    0x1, 0x1CE, 0x2, 0x41, 0x30C, 0x2, 0x61, 0x30C, 0x1, 0x1D0, 0x2, 0x49,
+    0x30C, 0x2, 0x69, 0x30C, 0x1, 0x1D2, 0x2, 0x4F, 0x30C, 0x2, 0x6F, 0x30C,
+    0x1, 0x1D4, 0x2, 0x55, 0x30C, 0x2, 0x75, 0x30C, 0x1, 0x1D6, 0x3, 0x55,
+    0x308, 0x304, 0x3, 0x75, 0x308, 0x304, 0x1, 0x1D8, 0x3, 0x55, 0x308, 0x301,
+    0x3, 0x75, 0x308, 0x301, 0x1, 0x1DA, 0x3, 0x55, 0x308, 0x30C, 0x3, 0x75,
+    0x308, 0x30C, 0x1, 0x1DC, 0x3, 0x55, 0x308, 0x300, 0x3, 0x75, 0x308, 0x300,
+    0x1, 0x1DF, 0x3, 0x41, 0x308, 0x304, 0x3, 0x61, 0x308, 0x304, 0x1, 0x1E1,
+    0x3, 0x41, 0x307, 0x304, 0x3, 0x61, 0x307, 0x304, 0x1, 0x1E3, 0x2, 0xC6,
+    0x304, 0x2, 0xE6, 0x304, 0x1, 0x1E5, 0x1, 0x1E7, 0x2, 0x47, 0x30C, 0x2,
+    0x67, 0x30C, 0x1, 0x1E9, 0x2, 0x4B, 0x30C, 0x2, 0x6B, 0x30C, 0x1, 0x1EB,
+    0x2, 0x4F, 0x328, 0x2, 0x6F, 0x328, 0x1, 0x1ED, 0x3, 0x4F, 0x328, 0x304,
+    0x3, 0x6F, 0x328, 0x304, 0x1, 0x1EF, 0x2, 0x1B7, 0x30C, 0x2, 0x292, 0x30C,
+    0x2, 0x6A, 0x30C, 0x2, 0x44, 0x5A, 0x1, 0x1F3, 0x2, 0x64, 0x7A, 0x2, 0x44,
+    0x7A, 0x1, 0x1F5, 0x2, 0x47, 0x301, 0x2, 0x67, 0x301, 0x1, 0x195, 0x1,
+    0x1BF, 0x1, 0x1F9, 0x2, 0x4E, 0x300, 0x2, 0x6E, 0x300, 0x1, 0x1FB, 0x3,
+    0x41, 0x30A, 0x301, 0x3, 0x61, 0x30A, 0x301, 0x1, 0x1FD, 0x2, 0xC6, 0x301,
+    0x2, 0xE6, 0x301, 0x1, 0x1FF, 0x2, 0xD8, 0x301, 0x2, 0xF8, 0x301, 0x1,
+    0x201, 0x2, 0x41, 0x30F, 0x2, 0x61, 0x30F, 0x1, 0x203, 0x2, 0x41, 0x311,
+    0x2, 0x61, 0x311, 0x1, 0x205, 0x2, 0x45, 0x30F, 0x2, 0x65, 0x30F, 0x1,
+    0x207, 0x2, 0x45, 0x311, 0x2, 0x65, 0x311, 0x1, 0x209, 0x2, 0x49, 0x30F,
+    0x2, 0x69, 0x30F, 0x1, 0x20B, 0x2, 0x49, 0x311, 0x2, 0x69, 0x311, 0x1,
+    0x20D, 0x2, 0x4F, 0x30F, 0x2, 0x6F, 0x30F, 0x1, 0x20F, 0x2, 0x4F, 0x311,
+    0x2, 0x6F, 0x311, 0x1, 0x211, 0x2, 0x52, 0x30F, 0x2, 0x72, 0x30F, 0x1,
+    0x213, 0x2, 0x52, 0x311, 0x2, 0x72, 0x311, 0x1, 0x215, 0x2, 0x55, 0x30F,
+    0x2, 0x75, 0x30F, 0x1, 0x217, 0x2, 0x55, 0x311, 0x2, 0x75, 0x311, 0x1,
+    0x219, 0x2, 0x53, 0x326, 0x2, 0x73, 0x326, 0x1, 0x21B, 0x2, 0x54, 0x326,
+    0x2, 0x74, 0x326, 0x1, 0x21D, 0x1, 0x21F, 0x2, 0x48, 0x30C, 0x2, 0x68,
+    0x30C, 0x1, 0x19E, 0x1, 0x223, 0x1, 0x225, 0x1, 0x227, 0x2, 0x41, 0x307,
+    0x2, 0x61, 0x307, 0x1, 0x229, 0x2, 0x45, 0x327, 0x2, 0x65, 0x327, 0x1,
+    0x22B, 0x3, 0x4F, 0x308, 0x304, 0x3, 0x6F, 0x308, 0x304, 0x1, 0x22D, 0x3,
+    0x4F, 0x303, 0x304, 0x3, 0x6F, 0x303, 0x304, 0x1, 0x22F, 0x2, 0x4F, 0x307,
+    0x2, 0x6F, 0x307, 0x1, 0x231, 0x3, 0x4F, 0x307, 0x304, 0x3, 0x6F, 0x307,
+    0x304, 0x1, 0x233, 0x2, 0x59, 0x304, 0x2, 0x79, 0x304, 0x1, 0x2C65, 0x1,
+    0x23C, 0x1, 0x19A, 0x1, 0x2C66, 0x1, 0x242, 0x1, 0x180, 0x1, 0x289, 0x1,
+    0x28C, 0x1, 0x247, 0x1, 0x249, 0x1, 0x24B, 0x1, 0x24D, 0x1, 0x24F, 0x1,
+    0x266, 0x1, 0x279, 0x1, 0x27B, 0x1, 0x281, 0x2, 0x20, 0x306, 0x2, 0x20,
+    0x307, 0x2, 0x20, 0x30A, 0x2, 0x20, 0x328, 0x2, 0x20, 0x303, 0x2, 0x20,
+    0x30B, 0x1, 0x295, 0x1, 0x300, 0x1, 0x301, 0x1, 0x313, 0x2, 0x308, 0x301,
+    0x1, 0x3B9, 0x1, 0x371, 0x1, 0x373, 0x1, 0x2B9, 0x1, 0x377, 0x2, 0x20,
+    0x345, 0x2, 0x20, 0x3B9, 0x1, 0x3B, 0x1, 0x3F3, 0x3, 0x20, 0x308, 0x301,
+    0x2, 0xA8, 0x301, 0x1, 0x3AC, 0x2, 0x391, 0x301, 0x1, 0xB7, 0x1, 0x3AD, 0x2,
+    0x395, 0x301, 0x1, 0x3AE, 0x2, 0x397, 0x301, 0x1, 0x3AF, 0x2, 0x399, 0x301,
+    0x1, 0x3CC, 0x2, 0x39F, 0x301, 0x1, 0x3CD, 0x2, 0x3A5, 0x301, 0x1, 0x3CE,
+    0x2, 0x3A9, 0x301, 0x3, 0x3B9, 0x308, 0x301, 0x1, 0x3B1, 0x1, 0x3B2, 0x1,
+    0x3B3, 0x1, 0x3B4, 0x1, 0x3B5, 0x1, 0x3B6, 0x1, 0x3B7, 0x1, 0x3B8, 0x1,
+    0x3BA, 0x1, 0x3BB, 0x1, 0x3BD, 0x1, 0x3BE, 0x1, 0x3BF, 0x1, 0x3C0, 0x1,
+    0x3C1, 0x1, 0x3C3, 0x1, 0x3C4, 0x1, 0x3C5, 0x1, 0x3C6, 0x1, 0x3C7, 0x1,
+    0x3C8, 0x1, 0x3C9, 0x1, 0x3CA, 0x2, 0x399, 0x308, 0x1, 0x3CB, 0x2, 0x3A5,
+    0x308, 0x2, 0x3B1, 0x301, 0x2, 0x3B5, 0x301, 0x2, 0x3B7, 0x301, 0x2, 0x3B9,
+    0x301, 0x3, 0x3C5, 0x308, 0x301, 0x2, 0x3B9, 0x308, 0x2, 0x3C5, 0x308, 0x2,
+    0x3BF, 0x301, 0x2, 0x3C5, 0x301, 0x2, 0x3C9, 0x301, 0x1, 0x3D7, 0x1, 0x3A5,
+    0x1, 0x38E, 0x2, 0x3D2, 0x301, 0x1, 0x3AB, 0x2, 0x3D2, 0x308, 0x1, 0x3D9,
+    0x1, 0x3DB, 0x1, 0x3DD, 0x1, 0x3DF, 0x1, 0x3E1, 0x1, 0x3E3, 0x1, 0x3E5, 0x1,
+    0x3E7, 0x1, 0x3E9, 0x1, 0x3EB, 0x1, 0x3ED, 0x1, 0x3EF, 0x1, 0x3C2, 0x1,
+    0x398, 0x1, 0x3F8, 0x1, 0x3A3, 0x1, 0x3F2, 0x1, 0x3FB, 0x1, 0x37B, 0x1,
+    0x37C, 0x1, 0x37D, 0x1, 0x450, 0x2, 0x415, 0x300, 0x1, 0x451, 0x2, 0x415,
+    0x308, 0x1, 0x452, 0x1, 0x453, 0x2, 0x413, 0x301, 0x1, 0x454, 0x1, 0x455,
+    0x1, 0x456, 0x1, 0x457, 0x2, 0x406, 0x308, 0x1, 0x458, 0x1, 0x459, 0x1,
+    0x45A, 0x1, 0x45B, 0x1, 0x45C, 0x2, 0x41A, 0x301, 0x1, 0x45D, 0x2, 0x418,
+    0x300, 0x1, 0x45E, 0x2, 0x423, 0x306, 0x1, 0x45F, 0x1, 0x430, 0x1, 0x431,
+    0x1, 0x432, 0x1, 0x433, 0x1, 0x434, 0x1, 0x435, 0x1, 0x436, 0x1, 0x437, 0x1,
+    0x438, 0x1, 0x439, 0x2, 0x418, 0x306, 0x1, 0x43A, 0x1, 0x43B, 0x1, 0x43C,
+    0x1, 0x43D, 0x1, 0x43E, 0x1, 0x43F, 0x1, 0x440, 0x1, 0x441, 0x1, 0x442, 0x1,
+    0x443, 0x1, 0x444, 0x1, 0x445, 0x1, 0x446, 0x1, 0x447, 0x1, 0x448, 0x1,
+    0x449, 0x1, 0x44A, 0x1, 0x44B, 0x1, 0x44C, 0x1, 0x44D, 0x1, 0x44E, 0x1,
+    0x44F, 0x2, 0x438, 0x306, 0x2, 0x435, 0x300, 0x2, 0x435, 0x308, 0x2, 0x433,
+    0x301, 0x2, 0x456, 0x308, 0x2, 0x43A, 0x301, 0x2, 0x438, 0x300, 0x2, 0x443,
+    0x306, 0x1, 0x461, 0x1, 0x463, 0x1, 0x465, 0x1, 0x467, 0x1, 0x469, 0x1,
+    0x46B, 0x1, 0x46D, 0x1, 0x46F, 0x1, 0x471, 0x1, 0x473, 0x1, 0x475, 0x1,
+    0x477, 0x2, 0x474, 0x30F, 0x2, 0x475, 0x30F, 0x1, 0x479, 0x1, 0x47B, 0x1,
+    0x47D, 0x1, 0x47F, 0x1, 0x481, 0x1, 0x48B, 0x1, 0x48D, 0x1, 0x48F, 0x1,
+    0x491, 0x1, 0x493, 0x1, 0x495, 0x1, 0x497, 0x1, 0x499, 0x1, 0x49B, 0x1,
+    0x49D, 0x1, 0x49F, 0x1, 0x4A1, 0x1, 0x4A3, 0x1, 0x4A5, 0x1, 0x4A7, 0x1,
+    0x4A9, 0x1, 0x4AB, 0x1, 0x4AD, 0x1, 0x4AF, 0x1, 0x4B1, 0x1, 0x4B3, 0x1,
+    0x4B5, 0x1, 0x4B7, 0x1, 0x4B9, 0x1, 0x4BB, 0x1, 0x4BD, 0x1, 0x4BF, 0x1,
+    0x4CF, 0x1, 0x4C2, 0x2, 0x416, 0x306, 0x2, 0x436, 0x306, 0x1, 0x4C4, 0x1,
+    0x4C6, 0x1, 0x4C8, 0x1, 0x4CA, 0x1, 0x4CC, 0x1, 0x4CE, 0x1, 0x4D1, 0x2,
+    0x410, 0x306, 0x2, 0x430, 0x306, 0x1, 0x4D3, 0x2, 0x410, 0x308, 0x2, 0x430,
+    0x308, 0x1, 0x4D5, 0x1, 0x4D7, 0x2, 0x415, 0x306, 0x2, 0x435, 0x306, 0x1,
+    0x4D9, 0x1, 0x4DB, 0x2, 0x4D8, 0x308, 0x2, 0x4D9, 0x308, 0x1, 0x4DD, 0x2,
+    0x416, 0x308, 0x2, 0x436, 0x308, 0x1, 0x4DF, 0x2, 0x417, 0x308, 0x2, 0x437,
+    0x308, 0x1, 0x4E1, 0x1, 0x4E3, 0x2, 0x418, 0x304, 0x2, 0x438, 0x304, 0x1,
+    0x4E5, 0x2, 0x418, 0x308, 0x2, 0x438, 0x308, 0x1, 0x4E7, 0x2, 0x41E, 0x308,
+    0x2, 0x43E, 0x308, 0x1, 0x4E9, 0x1, 0x4EB, 0x2, 0x4E8, 0x308, 0x2, 0x4E9,
+    0x308, 0x1, 0x4ED, 0x2, 0x42D, 0x308, 0x2, 0x44D, 0x308, 0x1, 0x4EF, 0x2,
+    0x423, 0x304, 0x2, 0x443, 0x304, 0x1, 0x4F1, 0x2, 0x423, 0x308, 0x2, 0x443,
+    0x308, 0x1, 0x4F3, 0x2, 0x423, 0x30B, 0x2, 0x443, 0x30B, 0x1, 0x4F5, 0x2,
+    0x427, 0x308, 0x2, 0x447, 0x308, 0x1, 0x4F7, 0x1, 0x4F9, 0x2, 0x42B, 0x308,
+    0x2, 0x44B, 0x308, 0x1, 0x4FB, 0x1, 0x4FD, 0x1, 0x4FF, 0x1, 0x501, 0x1,
+    0x503, 0x1, 0x505, 0x1, 0x507, 0x1, 0x509, 0x1, 0x50B, 0x1, 0x50D, 0x1,
+    0x50F, 0x1, 0x511, 0x1, 0x513, 0x1, 0x515, 0x1, 0x517, 0x1, 0x519, 0x1,
+    0x51B, 0x1, 0x51D, 0x1, 0x51F, 0x1, 0x521, 0x1, 0x523, 0x1, 0x525, 0x1,
+    0x527, 0x1, 0x529, 0x1, 0x52B, 0x1, 0x52D, 0x1, 0x52F, 0x1, 0x561, 0x1,
+    0x562, 0x1, 0x563, 0x1, 0x564, 0x1, 0x565, 0x1, 0x566, 0x1, 0x567, 0x1,
+    0x568, 0x1, 0x569, 0x1, 0x56A, 0x1, 0x56B, 0x1, 0x56C, 0x1, 0x56D, 0x1,
+    0x56E, 0x1, 0x56F, 0x1, 0x570, 0x1, 0x571, 0x1, 0x572, 0x1, 0x573, 0x1,
+    0x574, 0x1, 0x575, 0x1, 0x576, 0x1, 0x577, 0x1, 0x578, 0x1, 0x579, 0x1,
+    0x57A, 0x1, 0x57B, 0x1, 0x57C, 0x1, 0x57D, 0x1, 0x57E, 0x1, 0x57F, 0x1,
+    0x580, 0x1, 0x581, 0x1, 0x582, 0x1, 0x583, 0x1, 0x584, 0x1, 0x585, 0x1,
+    0x586, 0x2, 0x565, 0x582, 0x2, 0x627, 0x653, 0x2, 0x627, 0x654, 0x2, 0x648,
+    0x654, 0x2, 0x627, 0x655, 0x2, 0x64A, 0x654, 0x2, 0x627, 0x674, 0x2, 0x648,
+    0x674, 0x2, 0x6C7, 0x674, 0x2, 0x64A, 0x674, 0x2, 0x6D5, 0x654, 0x2, 0x6C1,
+    0x654, 0x2, 0x6D2, 0x654, 0x2, 0x928, 0x93C, 0x2, 0x930, 0x93C, 0x2, 0x933,
+    0x93C, 0x2, 0x915, 0x93C, 0x2, 0x916, 0x93C, 0x2, 0x917, 0x93C, 0x2, 0x91C,
+    0x93C, 0x2, 0x921, 0x93C, 0x2, 0x922, 0x93C, 0x2, 0x92B, 0x93C, 0x2, 0x92F,
+    0x93C, 0x2, 0x9A1, 0x9BC, 0x2, 0x9A2, 0x9BC, 0x2, 0x9AF, 0x9BC, 0x2, 0xA32,
+    0xA3C, 0x2, 0xA38, 0xA3C, 0x2, 0xA16, 0xA3C, 0x2, 0xA17, 0xA3C, 0x2, 0xA1C,
+    0xA3C, 0x2, 0xA2B, 0xA3C, 0x2, 0xB21, 0xB3C, 0x2, 0xB22, 0xB3C, 0x2, 0xC46,
+    0xC56, 0x2, 0xDD9, 0xDCA, 0x2, 0xE4D, 0xE32, 0x2, 0xECD, 0xEB2, 0x2, 0xEAB,
+    0xE99, 0x2, 0xEAB, 0xEA1, 0x1, 0xF0B, 0x2, 0xF42, 0xFB7, 0x2, 0xF4C, 0xFB7,
+    0x2, 0xF51, 0xFB7, 0x2, 0xF56, 0xFB7, 0x2, 0xF5B, 0xFB7, 0x2, 0xF40, 0xFB5,
+    0x2, 0xF71, 0xF72, 0x2, 0xF71, 0xF74, 0x2, 0xFB2, 0xF80, 0x3, 0xFB2, 0xF71,
+    0xF80, 0x2, 0xFB3, 0xF80, 0x3, 0xFB3, 0xF71, 0xF80, 0x2, 0xF71, 0xF80, 0x2,
+    0xF92, 0xFB7, 0x2, 0xF9C, 0xFB7, 0x2, 0xFA1, 0xFB7, 0x2, 0xFA6, 0xFB7, 0x2,
+    0xFAB, 0xFB7, 0x2, 0xF90, 0xFB5, 0x1, 0x2D00, 0x1, 0x2D01, 0x1, 0x2D02, 0x1,
+    0x2D03, 0x1, 0x2D04, 0x1, 0x2D05, 0x1, 0x2D06, 0x1, 0x2D07, 0x1, 0x2D08,
+    0x1, 0x2D09, 0x1, 0x2D0A, 0x1, 0x2D0B, 0x1, 0x2D0C, 0x1, 0x2D0D, 0x1,
+    0x2D0E, 0x1, 0x2D0F, 0x1, 0x2D10, 0x1, 0x2D11, 0x1, 0x2D12, 0x1, 0x2D13,
+    0x1, 0x2D14, 0x1, 0x2D15, 0x1, 0x2D16, 0x1, 0x2D17, 0x1, 0x2D18, 0x1,
+    0x2D19, 0x1, 0x2D1A, 0x1, 0x2D1B, 0x1, 0x2D1C, 0x1, 0x2D1D, 0x1, 0x2D1E,
+    0x1, 0x2D1F, 0x1, 0x2D20, 0x1, 0x2D21, 0x1, 0x2D22, 0x1, 0x2D23, 0x1,
+    0x2D24, 0x1, 0x2D25, 0x1, 0x2D27, 0x1, 0x2D2D, 0x1, 0x10DC, 0x1, 0x13F0,
+    0x1, 0x13F1, 0x1, 0x13F2, 0x1, 0x13F3, 0x1, 0x13F4, 0x1, 0x13F5, 0x1,
+    0xA64B, 0x1, 0x10D0, 0x1, 0x10D1, 0x1, 0x10D2, 0x1, 0x10D3, 0x1, 0x10D4,
+    0x1, 0x10D5, 0x1, 0x10D6, 0x1, 0x10D7, 0x1, 0x10D8, 0x1, 0x10D9, 0x1,
+    0x10DA, 0x1, 0x10DB, 0x1, 0x10DD, 0x1, 0x10DE, 0x1, 0x10DF, 0x1, 0x10E0,
+    0x1, 0x10E1, 0x1, 0x10E2, 0x1, 0x10E3, 0x1, 0x10E4, 0x1, 0x10E5, 0x1,
+    0x10E6, 0x1, 0x10E7, 0x1, 0x10E8, 0x1, 0x10E9, 0x1, 0x10EA, 0x1, 0x10EB,
+    0x1, 0x10EC, 0x1, 0x10ED, 0x1, 0x10EE, 0x1, 0x10EF, 0x1, 0x10F0, 0x1,
+    0x10F1, 0x1, 0x10F2, 0x1, 0x10F3, 0x1, 0x10F4, 0x1, 0x10F5, 0x1, 0x10F6,
+    0x1, 0x10F7, 0x1, 0x10F8, 0x1, 0x10F9, 0x1, 0x10FA, 0x1, 0x10FD, 0x1,
+    0x10FE, 0x1, 0x10FF, 0x1, 0x41, 0x1, 0xC6, 0x1, 0x42, 0x1, 0x44, 0x1, 0x45,
+    0x1, 0x18E, 0x1, 0x47, 0x1, 0x48, 0x1, 0x49, 0x1, 0x4A, 0x1, 0x4B, 0x1,
+    0x4C, 0x1, 0x4D, 0x1, 0x4E, 0x1, 0x4F, 0x1, 0x222, 0x1, 0x50, 0x1, 0x52,
+    0x1, 0x54, 0x1, 0x55, 0x1, 0x57, 0x1, 0x250, 0x1, 0x251, 0x1, 0x1D02, 0x1,
+    0x25C, 0x1, 0x1D16, 0x1, 0x1D17, 0x1, 0x1D1D, 0x1, 0x1D25, 0x1, 0x252, 0x1,
+    0x255, 0x1, 0x25F, 0x1, 0x261, 0x1, 0x265, 0x1, 0x26A, 0x1, 0x1D7B, 0x1,
+    0x29D, 0x1, 0x26D, 0x1, 0x1D85, 0x1, 0x29F, 0x1, 0x271, 0x1, 0x270, 0x1,
+    0x273, 0x1, 0x274, 0x1, 0x278, 0x1, 0x282, 0x1, 0x1AB, 0x1, 0x1D1C, 0x1,
+    0x290, 0x1, 0x291, 0x1, 0x1E01, 0x2, 0x41, 0x325, 0x2, 0x61, 0x325, 0x1,
+    0x1E03, 0x2, 0x42, 0x307, 0x2, 0x62, 0x307, 0x1, 0x1E05, 0x2, 0x42, 0x323,
+    0x2, 0x62, 0x323, 0x1, 0x1E07, 0x2, 0x42, 0x331, 0x2, 0x62, 0x331, 0x1,
+    0x1E09, 0x3, 0x43, 0x327, 0x301, 0x3, 0x63, 0x327, 0x301, 0x1, 0x1E0B, 0x2,
+    0x44, 0x307, 0x2, 0x64, 0x307, 0x1, 0x1E0D, 0x2, 0x44, 0x323, 0x2, 0x64,
+    0x323, 0x1, 0x1E0F, 0x2, 0x44, 0x331, 0x2, 0x64, 0x331, 0x1, 0x1E11, 0x2,
+    0x44, 0x327, 0x2, 0x64, 0x327, 0x1, 0x1E13, 0x2, 0x44, 0x32D, 0x2, 0x64,
+    0x32D, 0x1, 0x1E15, 0x3, 0x45, 0x304, 0x300, 0x3, 0x65, 0x304, 0x300, 0x1,
+    0x1E17, 0x3, 0x45, 0x304, 0x301, 0x3, 0x65, 0x304, 0x301, 0x1, 0x1E19, 0x2,
+    0x45, 0x32D, 0x2, 0x65, 0x32D, 0x1, 0x1E1B, 0x2, 0x45, 0x330, 0x2, 0x65,
+    0x330, 0x1, 0x1E1D, 0x3, 0x45, 0x327, 0x306, 0x3, 0x65, 0x327, 0x306, 0x1,
+    0x1E1F, 0x2, 0x46, 0x307, 0x2, 0x66, 0x307, 0x1, 0x1E21, 0x2, 0x47, 0x304,
+    0x2, 0x67, 0x304, 0x1, 0x1E23, 0x2, 0x48, 0x307, 0x2, 0x68, 0x307, 0x1,
+    0x1E25, 0x2, 0x48, 0x323, 0x2, 0x68, 0x323, 0x1, 0x1E27, 0x2, 0x48, 0x308,
+    0x2, 0x68, 0x308, 0x1, 0x1E29, 0x2, 0x48, 0x327, 0x2, 0x68, 0x327, 0x1,
+    0x1E2B, 0x2, 0x48, 0x32E, 0x2, 0x68, 0x32E, 0x1, 0x1E2D, 0x2, 0x49, 0x330,
+    0x2, 0x69, 0x330, 0x1, 0x1E2F, 0x3, 0x49, 0x308, 0x301, 0x3, 0x69, 0x308,
+    0x301, 0x1, 0x1E31, 0x2, 0x4B, 0x301, 0x2, 0x6B, 0x301, 0x1, 0x1E33, 0x2,
+    0x4B, 0x323, 0x2, 0x6B, 0x323, 0x1, 0x1E35, 0x2, 0x4B, 0x331, 0x2, 0x6B,
+    0x331, 0x1, 0x1E37, 0x2, 0x4C, 0x323, 0x2, 0x6C, 0x323, 0x1, 0x1E39, 0x3,
+    0x4C, 0x323, 0x304, 0x3, 0x6C, 0x323, 0x304, 0x1, 0x1E3B, 0x2, 0x4C, 0x331,
+    0x2, 0x6C, 0x331, 0x1, 0x1E3D, 0x2, 0x4C, 0x32D, 0x2, 0x6C, 0x32D, 0x1,
+    0x1E3F, 0x2, 0x4D, 0x301, 0x2, 0x6D, 0x301, 0x1, 0x1E41, 0x2, 0x4D, 0x307,
+    0x2, 0x6D, 0x307, 0x1, 0x1E43, 0x2, 0x4D, 0x323, 0x2, 0x6D, 0x323, 0x1,
+    0x1E45, 0x2, 0x4E, 0x307, 0x2, 0x6E, 0x307, 0x1, 0x1E47, 0x2, 0x4E, 0x323,
+    0x2, 0x6E, 0x323, 0x1, 0x1E49, 0x2, 0x4E, 0x331, 0x2, 0x6E, 0x331, 0x1,
+    0x1E4B, 0x2, 0x4E, 0x32D, 0x2, 0x6E, 0x32D, 0x1, 0x1E4D, 0x3, 0x4F, 0x303,
+    0x301, 0x3, 0x6F, 0x303, 0x301, 0x1, 0x1E4F, 0x3, 0x4F, 0x303, 0x308, 0x3,
+    0x6F, 0x303, 0x308, 0x1, 0x1E51, 0x3, 0x4F, 0x304, 0x300, 0x3, 0x6F, 0x304,
+    0x300, 0x1, 0x1E53, 0x3, 0x4F, 0x304, 0x301, 0x3, 0x6F, 0x304, 0x301, 0x1,
+    0x1E55, 0x2, 0x50, 0x301, 0x2, 0x70, 0x301, 0x1, 0x1E57, 0x2, 0x50, 0x307,
+    0x2, 0x70, 0x307, 0x1, 0x1E59, 0x2, 0x52, 0x307, 0x2, 0x72, 0x307, 0x1,
+    0x1E5B, 0x2, 0x52, 0x323, 0x2, 0x72, 0x323, 0x1, 0x1E5D, 0x3, 0x52, 0x323,
+    0x304, 0x3, 0x72, 0x323, 0x304, 0x1, 0x1E5F, 0x2, 0x52, 0x331, 0x2, 0x72,
+    0x331, 0x1, 0x1E61, 0x2, 0x53, 0x307, 0x2, 0x73, 0x307, 0x1, 0x1E63, 0x2,
+    0x53, 0x323, 0x2, 0x73, 0x323, 0x1, 0x1E65, 0x3, 0x53, 0x301, 0x307, 0x3,
+    0x73, 0x301, 0x307, 0x1, 0x1E67, 0x3, 0x53, 0x30C, 0x307, 0x3, 0x73, 0x30C,
+    0x307, 0x1, 0x1E69, 0x3, 0x53, 0x323, 0x307, 0x3, 0x73, 0x323, 0x307, 0x1,
+    0x1E6B, 0x2, 0x54, 0x307, 0x2, 0x74, 0x307, 0x1, 0x1E6D, 0x2, 0x54, 0x323,
+    0x2, 0x74, 0x323, 0x1, 0x1E6F, 0x2, 0x54, 0x331, 0x2, 0x74, 0x331, 0x1,
+    0x1E71, 0x2, 0x54, 0x32D, 0x2, 0x74, 0x32D, 0x1, 0x1E73, 0x2, 0x55, 0x324,
+    0x2, 0x75, 0x324, 0x1, 0x1E75, 0x2, 0x55, 0x330, 0x2, 0x75, 0x330, 0x1,
+    0x1E77, 0x2, 0x55, 0x32D, 0x2, 0x75, 0x32D, 0x1, 0x1E79, 0x3, 0x55, 0x303,
+    0x301, 0x3, 0x75, 0x303, 0x301, 0x1, 0x1E7B, 0x3, 0x55, 0x304, 0x308, 0x3,
+    0x75, 0x304, 0x308, 0x1, 0x1E7D, 0x2, 0x56, 0x303, 0x2, 0x76, 0x303, 0x1,
+    0x1E7F, 0x2, 0x56, 0x323, 0x2, 0x76, 0x323, 0x1, 0x1E81, 0x2, 0x57, 0x300,
+    0x2, 0x77, 0x300, 0x1, 0x1E83, 0x2, 0x57, 0x301, 0x2, 0x77, 0x301, 0x1,
+    0x1E85, 0x2, 0x57, 0x308, 0x2, 0x77, 0x308, 0x1, 0x1E87, 0x2, 0x57, 0x307,
+    0x2, 0x77, 0x307, 0x1, 0x1E89, 0x2, 0x57, 0x323, 0x2, 0x77, 0x323, 0x1,
+    0x1E8B, 0x2, 0x58, 0x307, 0x2, 0x78, 0x307, 0x1, 0x1E8D, 0x2, 0x58, 0x308,
+    0x2, 0x78, 0x308, 0x1, 0x1E8F, 0x2, 0x59, 0x307, 0x2, 0x79, 0x307, 0x1,
+    0x1E91, 0x2, 0x5A, 0x302, 0x2, 0x7A, 0x302, 0x1, 0x1E93, 0x2, 0x5A, 0x323,
+    0x2, 0x7A, 0x323, 0x1, 0x1E95, 0x2, 0x5A, 0x331, 0x2, 0x7A, 0x331, 0x2,
+    0x68, 0x331, 0x2, 0x74, 0x308, 0x2, 0x77, 0x30A, 0x2, 0x79, 0x30A, 0x2,
+    0x61, 0x2BE, 0x2, 0x17F, 0x307, 0x1, 0x1EA1, 0x2, 0x41, 0x323, 0x2, 0x61,
+    0x323, 0x1, 0x1EA3, 0x2, 0x41, 0x309, 0x2, 0x61, 0x309, 0x1, 0x1EA5, 0x3,
+    0x41, 0x302, 0x301, 0x3, 0x61, 0x302, 0x301, 0x1, 0x1EA7, 0x3, 0x41, 0x302,
+    0x300, 0x3, 0x61, 0x302, 0x300, 0x1, 0x1EA9, 0x3, 0x41, 0x302, 0x309, 0x3,
+    0x61, 0x302, 0x309, 0x1, 0x1EAB, 0x3, 0x41, 0x302, 0x303, 0x3, 0x61, 0x302,
+    0x303, 0x1, 0x1EAD, 0x3, 0x41, 0x323, 0x302, 0x3, 0x61, 0x323, 0x302, 0x1,
+    0x1EAF, 0x3, 0x41, 0x306, 0x301, 0x3, 0x61, 0x306, 0x301, 0x1, 0x1EB1, 0x3,
+    0x41, 0x306, 0x300, 0x3, 0x61, 0x306, 0x300, 0x1, 0x1EB3, 0x3, 0x41, 0x306,
+    0x309, 0x3, 0x61, 0x306, 0x309, 0x1, 0x1EB5, 0x3, 0x41, 0x306, 0x303, 0x3,
+    0x61, 0x306, 0x303, 0x1, 0x1EB7, 0x3, 0x41, 0x323, 0x306, 0x3, 0x61, 0x323,
+    0x306, 0x1, 0x1EB9, 0x2, 0x45, 0x323, 0x2, 0x65, 0x323, 0x1, 0x1EBB, 0x2,
+    0x45, 0x309, 0x2, 0x65, 0x309, 0x1, 0x1EBD, 0x2, 0x45, 0x303, 0x2, 0x65,
+    0x303, 0x1, 0x1EBF, 0x3, 0x45, 0x302, 0x301, 0x3, 0x65, 0x302, 0x301, 0x1,
+    0x1EC1, 0x3, 0x45, 0x302, 0x300, 0x3, 0x65, 0x302, 0x300, 0x1, 0x1EC3, 0x3,
+    0x45, 0x302, 0x309, 0x3, 0x65, 0x302, 0x309, 0x1, 0x1EC5, 0x3, 0x45, 0x302,
+    0x303, 0x3, 0x65, 0x302, 0x303, 0x1, 0x1EC7, 0x3, 0x45, 0x323, 0x302, 0x3,
+    0x65, 0x323, 0x302, 0x1, 0x1EC9, 0x2, 0x49, 0x309, 0x2, 0x69, 0x309, 0x1,
+    0x1ECB, 0x2, 0x49, 0x323, 0x2, 0x69, 0x323, 0x1, 0x1ECD, 0x2, 0x4F, 0x323,
+    0x2, 0x6F, 0x323, 0x1, 0x1ECF, 0x2, 0x4F, 0x309, 0x2, 0x6F, 0x309, 0x1,
+    0x1ED1, 0x3, 0x4F, 0x302, 0x301, 0x3, 0x6F, 0x302, 0x301, 0x1, 0x1ED3, 0x3,
+    0x4F, 0x302, 0x300, 0x3, 0x6F, 0x302, 0x300, 0x1, 0x1ED5, 0x3, 0x4F, 0x302,
+    0x309, 0x3, 0x6F, 0x302, 0x309, 0x1, 0x1ED7, 0x3, 0x4F, 0x302, 0x303, 0x3,
+    0x6F, 0x302, 0x303, 0x1, 0x1ED9, 0x3, 0x4F, 0x323, 0x302, 0x3, 0x6F, 0x323,
+    0x302, 0x1, 0x1EDB, 0x3, 0x4F, 0x31B, 0x301, 0x3, 0x6F, 0x31B, 0x301, 0x1,
+    0x1EDD, 0x3, 0x4F, 0x31B, 0x300, 0x3, 0x6F, 0x31B, 0x300, 0x1, 0x1EDF, 0x3,
+    0x4F, 0x31B, 0x309, 0x3, 0x6F, 0x31B, 0x309, 0x1, 0x1EE1, 0x3, 0x4F, 0x31B,
+    0x303, 0x3, 0x6F, 0x31B, 0x303, 0x1, 0x1EE3, 0x3, 0x4F, 0x31B, 0x323, 0x3,
+    0x6F, 0x31B, 0x323, 0x1, 0x1EE5, 0x2, 0x55, 0x323, 0x2, 0x75, 0x323, 0x1,
+    0x1EE7, 0x2, 0x55, 0x309, 0x2, 0x75, 0x309, 0x1, 0x1EE9, 0x3, 0x55, 0x31B,
+    0x301, 0x3, 0x75, 0x31B, 0x301, 0x1, 0x1EEB, 0x3, 0x55, 0x31B, 0x300, 0x3,
+    0x75, 0x31B, 0x300, 0x1, 0x1EED, 0x3, 0x55, 0x31B, 0x309, 0x3, 0x75, 0x31B,
+    0x309, 0x1, 0x1EEF, 0x3, 0x55, 0x31B, 0x303, 0x3, 0x75, 0x31B, 0x303, 0x1,
+    0x1EF1, 0x3, 0x55, 0x31B, 0x323, 0x3, 0x75, 0x31B, 0x323, 0x1, 0x1EF3, 0x2,
+    0x59, 0x300, 0x2, 0x79, 0x300, 0x1, 0x1EF5, 0x2, 0x59, 0x323, 0x2, 0x79,
+    0x323, 0x1, 0x1EF7, 0x2, 0x59, 0x309, 0x2, 0x79, 0x309, 0x1, 0x1EF9, 0x2,
+    0x59, 0x303, 0x2, 0x79, 0x303, 0x1, 0x1EFB, 0x1, 0x1EFD, 0x1, 0x1EFF, 0x2,
+    0x3B1, 0x313, 0x2, 0x3B1, 0x314, 0x3, 0x3B1, 0x313, 0x300, 0x3, 0x3B1,
+    0x314, 0x300, 0x3, 0x3B1, 0x313, 0x301, 0x3, 0x3B1, 0x314, 0x301, 0x3,
+    0x3B1, 0x313, 0x342, 0x3, 0x3B1, 0x314, 0x342, 0x1, 0x1F00, 0x2, 0x391,
+    0x313, 0x1, 0x1F01, 0x2, 0x391, 0x314, 0x1, 0x1F02, 0x3, 0x391, 0x313,
+    0x300, 0x1, 0x1F03, 0x3, 0x391, 0x314, 0x300, 0x1, 0x1F04, 0x3, 0x391,
+    0x313, 0x301, 0x1, 0x1F05, 0x3, 0x391, 0x314, 0x301, 0x1, 0x1F06, 0x3,
+    0x391, 0x313, 0x342, 0x1, 0x1F07, 0x3, 0x391, 0x314, 0x342, 0x2, 0x3B5,
+    0x313, 0x2, 0x3B5, 0x314, 0x3, 0x3B5, 0x313, 0x300, 0x3, 0x3B5, 0x314,
+    0x300, 0x3, 0x3B5, 0x313, 0x301, 0x3, 0x3B5, 0x314, 0x301, 0x1, 0x1F10, 0x2,
+    0x395, 0x313, 0x1, 0x1F11, 0x2, 0x395, 0x314, 0x1, 0x1F12, 0x3, 0x395,
+    0x313, 0x300, 0x1, 0x1F13, 0x3, 0x395, 0x314, 0x300, 0x1, 0x1F14, 0x3,
+    0x395, 0x313, 0x301, 0x1, 0x1F15, 0x3, 0x395, 0x314, 0x301, 0x2, 0x3B7,
+    0x313, 0x2, 0x3B7, 0x314, 0x3, 0x3B7, 0x313, 0x300, 0x3, 0x3B7, 0x314,
+    0x300, 0x3, 0x3B7, 0x313, 0x301, 0x3, 0x3B7, 0x314, 0x301, 0x3, 0x3B7,
+    0x313, 0x342, 0x3, 0x3B7, 0x314, 0x342, 0x1, 0x1F20, 0x2, 0x397, 0x313, 0x1,
+    0x1F21, 0x2, 0x397, 0x314, 0x1, 0x1F22, 0x3, 0x397, 0x313, 0x300, 0x1,
+    0x1F23, 0x3, 0x397, 0x314, 0x300, 0x1, 0x1F24, 0x3, 0x397, 0x313, 0x301,
+    0x1, 0x1F25, 0x3, 0x397, 0x314, 0x301, 0x1, 0x1F26, 0x3, 0x397, 0x313,
+    0x342, 0x1, 0x1F27, 0x3, 0x397, 0x314, 0x342, 0x2, 0x3B9, 0x313, 0x2, 0x3B9,
+    0x314, 0x3, 0x3B9, 0x313, 0x300, 0x3, 0x3B9, 0x314, 0x300, 0x3, 0x3B9,
+    0x313, 0x301, 0x3, 0x3B9, 0x314, 0x301, 0x3, 0x3B9, 0x313, 0x342, 0x3,
+    0x3B9, 0x314, 0x342, 0x1, 0x1F30, 0x2, 0x399, 0x313, 0x1, 0x1F31, 0x2,
+    0x399, 0x314, 0x1, 0x1F32, 0x3, 0x399, 0x313, 0x300, 0x1, 0x1F33, 0x3,
+    0x399, 0x314, 0x300, 0x1, 0x1F34, 0x3, 0x399, 0x313, 0x301, 0x1, 0x1F35,
+    0x3, 0x399, 0x314, 0x301, 0x1, 0x1F36, 0x3, 0x399, 0x313, 0x342, 0x1,
+    0x1F37, 0x3, 0x399, 0x314, 0x342, 0x2, 0x3BF, 0x313, 0x2, 0x3BF, 0x314, 0x3,
+    0x3BF, 0x313, 0x300, 0x3, 0x3BF, 0x314, 0x300, 0x3, 0x3BF, 0x313, 0x301,
+    0x3, 0x3BF, 0x314, 0x301, 0x1, 0x1F40, 0x2, 0x39F, 0x313, 0x1, 0x1F41, 0x2,
+    0x39F, 0x314, 0x1, 0x1F42, 0x3, 0x39F, 0x313, 0x300, 0x1, 0x1F43, 0x3,
+    0x39F, 0x314, 0x300, 0x1, 0x1F44, 0x3, 0x39F, 0x313, 0x301, 0x1, 0x1F45,
+    0x3, 0x39F, 0x314, 0x301, 0x2, 0x3C5, 0x313, 0x2, 0x3C5, 0x314, 0x3, 0x3C5,
+    0x313, 0x300, 0x3, 0x3C5, 0x314, 0x300, 0x3, 0x3C5, 0x313, 0x301, 0x3,
+    0x3C5, 0x314, 0x301, 0x3, 0x3C5, 0x313, 0x342, 0x3, 0x3C5, 0x314, 0x342,
+    0x1, 0x1F51, 0x2, 0x3A5, 0x314, 0x1, 0x1F53, 0x3, 0x3A5, 0x314, 0x300, 0x1,
+    0x1F55, 0x3, 0x3A5, 0x314, 0x301, 0x1, 0x1F57, 0x3, 0x3A5, 0x314, 0x342,
+    0x2, 0x3C9, 0x313, 0x2, 0x3C9, 0x314, 0x3, 0x3C9, 0x313, 0x300, 0x3, 0x3C9,
+    0x314, 0x300, 0x3, 0x3C9, 0x313, 0x301, 0x3, 0x3C9, 0x314, 0x301, 0x3,
+    0x3C9, 0x313, 0x342, 0x3, 0x3C9, 0x314, 0x342, 0x1, 0x1F60, 0x2, 0x3A9,
+    0x313, 0x1, 0x1F61, 0x2, 0x3A9, 0x314, 0x1, 0x1F62, 0x3, 0x3A9, 0x313,
+    0x300, 0x1, 0x1F63, 0x3, 0x3A9, 0x314, 0x300, 0x1, 0x1F64, 0x3, 0x3A9,
+    0x313, 0x301, 0x1, 0x1F65, 0x3, 0x3A9, 0x314, 0x301, 0x1, 0x1F66, 0x3,
+    0x3A9, 0x313, 0x342, 0x1, 0x1F67, 0x3, 0x3A9, 0x314, 0x342, 0x2, 0x3B1,
+    0x300, 0x2, 0x3B5, 0x300, 0x2, 0x3B7, 0x300, 0x2, 0x3B9, 0x300, 0x2, 0x3BF,
+    0x300, 0x2, 0x3C5, 0x300, 0x2, 0x3C9, 0x300, 0x2, 0x1F00, 0x3B9, 0x3, 0x3B1,
+    0x313, 0x345, 0x2, 0x1F01, 0x3B9, 0x3, 0x3B1, 0x314, 0x345, 0x2, 0x1F02,
+    0x3B9, 0x4, 0x3B1, 0x313, 0x300, 0x345, 0x2, 0x1F03, 0x3B9, 0x4, 0x3B1,
+    0x314, 0x300, 0x345, 0x2, 0x1F04, 0x3B9, 0x4, 0x3B1, 0x313, 0x301, 0x345,
+    0x2, 0x1F05, 0x3B9, 0x4, 0x3B1, 0x314, 0x301, 0x345, 0x2, 0x1F06, 0x3B9,
+    0x4, 0x3B1, 0x313, 0x342, 0x345, 0x2, 0x1F07, 0x3B9, 0x4, 0x3B1, 0x314,
+    0x342, 0x345, 0x3, 0x391, 0x313, 0x345, 0x3, 0x391, 0x314, 0x345, 0x4,
+    0x391, 0x313, 0x300, 0x345, 0x4, 0x391, 0x314, 0x300, 0x345, 0x4, 0x391,
+    0x313, 0x301, 0x345, 0x4, 0x391, 0x314, 0x301, 0x345, 0x4, 0x391, 0x313,
+    0x342, 0x345, 0x4, 0x391, 0x314, 0x342, 0x345, 0x2, 0x1F20, 0x3B9, 0x3,
+    0x3B7, 0x313, 0x345, 0x2, 0x1F21, 0x3B9, 0x3, 0x3B7, 0x314, 0x345, 0x2,
+    0x1F22, 0x3B9, 0x4, 0x3B7, 0x313, 0x300, 0x345, 0x2, 0x1F23, 0x3B9, 0x4,
+    0x3B7, 0x314, 0x300, 0x345, 0x2, 0x1F24, 0x3B9, 0x4, 0x3B7, 0x313, 0x301,
+    0x345, 0x2, 0x1F25, 0x3B9, 0x4, 0x3B7, 0x314, 0x301, 0x345, 0x2, 0x1F26,
+    0x3B9, 0x4, 0x3B7, 0x313, 0x342, 0x345, 0x2, 0x1F27, 0x3B9, 0x4, 0x3B7,
+    0x314, 0x342, 0x345, 0x3, 0x397, 0x313, 0x345, 0x3, 0x397, 0x314, 0x345,
+    0x4, 0x397, 0x313, 0x300, 0x345, 0x4, 0x397, 0x314, 0x300, 0x345, 0x4,
+    0x397, 0x313, 0x301, 0x345, 0x4, 0x397, 0x314, 0x301, 0x345, 0x4, 0x397,
+    0x313, 0x342, 0x345, 0x4, 0x397, 0x314, 0x342, 0x345, 0x2, 0x1F60, 0x3B9,
+    0x3, 0x3C9, 0x313, 0x345, 0x2, 0x1F61, 0x3B9, 0x3, 0x3C9, 0x314, 0x345, 0x2,
+    0x1F62, 0x3B9, 0x4, 0x3C9, 0x313, 0x300, 0x345, 0x2, 0x1F63, 0x3B9, 0x4,
+    0x3C9, 0x314, 0x300, 0x345, 0x2, 0x1F64, 0x3B9, 0x4, 0x3C9, 0x313, 0x301,
+    0x345, 0x2, 0x1F65, 0x3B9, 0x4, 0x3C9, 0x314, 0x301, 0x345, 0x2, 0x1F66,
+    0x3B9, 0x4, 0x3C9, 0x313, 0x342, 0x345, 0x2, 0x1F67, 0x3B9, 0x4, 0x3C9,
+    0x314, 0x342, 0x345, 0x3, 0x3A9, 0x313, 0x345, 0x3, 0x3A9, 0x314, 0x345,
+    0x4, 0x3A9, 0x313, 0x300, 0x345, 0x4, 0x3A9, 0x314, 0x300, 0x345, 0x4,
+    0x3A9, 0x313, 0x301, 0x345, 0x4, 0x3A9, 0x314, 0x301, 0x345, 0x4, 0x3A9,
+    0x313, 0x342, 0x345, 0x4, 0x3A9, 0x314, 0x342, 0x345, 0x2, 0x3B1, 0x306,
+    0x2, 0x3B1, 0x304, 0x2, 0x1F70, 0x3B9, 0x3, 0x3B1, 0x300, 0x345, 0x2, 0x3B1,
+    0x3B9, 0x2, 0x3B1, 0x345, 0x2, 0x3AC, 0x3B9, 0x3, 0x3B1, 0x301, 0x345, 0x2,
+    0x3B1, 0x342, 0x3, 0x3B1, 0x342, 0x3B9, 0x3, 0x3B1, 0x342, 0x345, 0x1,
+    0x1FB0, 0x2, 0x391, 0x306, 0x1, 0x1FB1, 0x2, 0x391, 0x304, 0x1, 0x1F70, 0x2,
+    0x391, 0x300, 0x1, 0x386, 0x1, 0x1F71, 0x2, 0x391, 0x345, 0x2, 0x20, 0x313,
+    0x2, 0x20, 0x342, 0x3, 0x20, 0x308, 0x342, 0x2, 0xA8, 0x342, 0x2, 0x1F74,
+    0x3B9, 0x3, 0x3B7, 0x300, 0x345, 0x2, 0x3B7, 0x3B9, 0x2, 0x3B7, 0x345, 0x2,
+    0x3AE, 0x3B9, 0x3, 0x3B7, 0x301, 0x345, 0x2, 0x3B7, 0x342, 0x3, 0x3B7,
+    0x342, 0x3B9, 0x3, 0x3B7, 0x342, 0x345, 0x1, 0x1F72, 0x2, 0x395, 0x300, 0x1,
+    0x388, 0x1, 0x1F73, 0x1, 0x1F74, 0x2, 0x397, 0x300, 0x1, 0x389, 0x1, 0x1F75,
+    0x2, 0x397, 0x345, 0x3, 0x20, 0x313, 0x300, 0x2, 0x1FBF, 0x300, 0x3, 0x20,
+    0x313, 0x301, 0x2, 0x1FBF, 0x301, 0x3, 0x20, 0x313, 0x342, 0x2, 0x1FBF,
+    0x342, 0x2, 0x3B9, 0x306, 0x2, 0x3B9, 0x304, 0x3, 0x3B9, 0x308, 0x300, 0x1,
+    0x390, 0x2, 0x3B9, 0x342, 0x3, 0x3B9, 0x308, 0x342, 0x1, 0x1FD0, 0x2, 0x399,
+    0x306, 0x1, 0x1FD1, 0x2, 0x399, 0x304, 0x1, 0x1F76, 0x2, 0x399, 0x300, 0x1,
+    0x38A, 0x1, 0x1F77, 0x3, 0x20, 0x314, 0x300, 0x2, 0x1FFE, 0x300, 0x3, 0x20,
+    0x314, 0x301, 0x2, 0x1FFE, 0x301, 0x3, 0x20, 0x314, 0x342, 0x2, 0x1FFE,
+    0x342, 0x2, 0x3C5, 0x306, 0x2, 0x3C5, 0x304, 0x3, 0x3C5, 0x308, 0x300, 0x1,
+    0x3B0, 0x2, 0x3C1, 0x313, 0x2, 0x3C1, 0x314, 0x2, 0x3C5, 0x342, 0x3, 0x3C5,
+    0x308, 0x342, 0x1, 0x1FE0, 0x2, 0x3A5, 0x306, 0x1, 0x1FE1, 0x2, 0x3A5,
+    0x304, 0x1, 0x1F7A, 0x2, 0x3A5, 0x300, 0x1, 0x1F7B, 0x1, 0x1FE5, 0x2, 0x3A1,
+    0x314, 0x3, 0x20, 0x308, 0x300, 0x2, 0xA8, 0x300, 0x1, 0x60, 0x2, 0x1F7C,
+    0x3B9, 0x3, 0x3C9, 0x300, 0x345, 0x2, 0x3C9, 0x3B9, 0x2, 0x3C9, 0x345, 0x2,
+    0x3CE, 0x3B9, 0x3, 0x3C9, 0x301, 0x345, 0x2, 0x3C9, 0x342, 0x3, 0x3C9,
+    0x342, 0x3B9, 0x3, 0x3C9, 0x342, 0x345, 0x1, 0x1F78, 0x2, 0x39F, 0x300, 0x1,
+    0x38C, 0x1, 0x1F79, 0x1, 0x1F7C, 0x2, 0x3A9, 0x300, 0x1, 0x38F, 0x1, 0x1F7D,
+    0x2, 0x3A9, 0x345, 0x2, 0x20, 0x314, 0x1, 0x2010, 0x2, 0x20, 0x333, 0x1,
+    0x2E, 0x2, 0x2E, 0x2E, 0x3, 0x2E, 0x2E, 0x2E, 0x2, 0x2032, 0x2032, 0x3,
+    0x2032, 0x2032, 0x2032, 0x2, 0x2035, 0x2035, 0x3, 0x2035, 0x2035, 0x2035,
+    0x2, 0x21, 0x21, 0x2, 0x20, 0x305, 0x2, 0x3F, 0x3F, 0x2, 0x3F, 0x21, 0x2,
+    0x21, 0x3F, 0x1, 0x30, 0x1, 0x34, 0x1, 0x35, 0x1, 0x36, 0x1, 0x37, 0x1,
+    0x38, 0x1, 0x39, 0x1, 0x2B, 0x1, 0x2212, 0x1, 0x3D, 0x1, 0x28, 0x1, 0x29,
+    0x2, 0x52, 0x73, 0x2, 0x72, 0x73, 0x3, 0x61, 0x2F, 0x63, 0x3, 0x61, 0x2F,
+    0x73, 0x1, 0x43, 0x2, 0xB0, 0x43, 0x2, 0xB0, 0x63, 0x3, 0x63, 0x2F, 0x6F,
+    0x3, 0x63, 0x2F, 0x75, 0x1, 0x190, 0x2, 0xB0, 0x46, 0x2, 0xB0, 0x66, 0x2,
+    0x4E, 0x6F, 0x2, 0x6E, 0x6F, 0x1, 0x51, 0x2, 0x53, 0x4D, 0x2, 0x73, 0x6D,
+    0x3, 0x54, 0x45, 0x4C, 0x3, 0x74, 0x65, 0x6C, 0x2, 0x54, 0x4D, 0x2, 0x74,
+    0x6D, 0x1, 0x5A, 0x1, 0x3A9, 0x1, 0xC5, 0x1, 0x46, 0x1, 0x214E, 0x1, 0x5D0,
+    0x1, 0x5D1, 0x1, 0x5D2, 0x1, 0x5D3, 0x3, 0x46, 0x41, 0x58, 0x3, 0x66, 0x61,
+    0x78, 0x1, 0x393, 0x1, 0x3A0, 0x1, 0x2211, 0x3, 0x31, 0x2044, 0x37, 0x3,
+    0x31, 0x2044, 0x39, 0x4, 0x31, 0x2044, 0x31, 0x30, 0x3, 0x31, 0x2044, 0x33,
+    0x3, 0x32, 0x2044, 0x33, 0x3, 0x31, 0x2044, 0x35, 0x3, 0x32, 0x2044, 0x35,
+    0x3, 0x33, 0x2044, 0x35, 0x3, 0x34, 0x2044, 0x35, 0x3, 0x31, 0x2044, 0x36,
+    0x3, 0x35, 0x2044, 0x36, 0x3, 0x31, 0x2044, 0x38, 0x3, 0x33, 0x2044, 0x38,
+    0x3, 0x35, 0x2044, 0x38, 0x3, 0x37, 0x2044, 0x38, 0x2, 0x31, 0x2044, 0x1,
+    0x2170, 0x2, 0x49, 0x49, 0x1, 0x2171, 0x2, 0x69, 0x69, 0x3, 0x49, 0x49,
+    0x49, 0x1, 0x2172, 0x3, 0x69, 0x69, 0x69, 0x2, 0x49, 0x56, 0x1, 0x2173, 0x2,
+    0x69, 0x76, 0x1, 0x56, 0x1, 0x2174, 0x2, 0x56, 0x49, 0x1, 0x2175, 0x2, 0x76,
+    0x69, 0x3, 0x56, 0x49, 0x49, 0x1, 0x2176, 0x3, 0x76, 0x69, 0x69, 0x4, 0x56,
+    0x49, 0x49, 0x49, 0x1, 0x2177, 0x4, 0x76, 0x69, 0x69, 0x69, 0x2, 0x49, 0x58,
+    0x1, 0x2178, 0x2, 0x69, 0x78, 0x1, 0x58, 0x1, 0x2179, 0x2, 0x58, 0x49, 0x1,
+    0x217A, 0x2, 0x78, 0x69, 0x3, 0x58, 0x49, 0x49, 0x1, 0x217B, 0x3, 0x78,
+    0x69, 0x69, 0x1, 0x217C, 0x1, 0x217D, 0x1, 0x217E, 0x1, 0x217F, 0x1, 0x2184,
+    0x3, 0x30, 0x2044, 0x33, 0x2, 0x2190, 0x338, 0x2, 0x2192, 0x338, 0x2,
+    0x2194, 0x338, 0x2, 0x21D0, 0x338, 0x2, 0x21D4, 0x338, 0x2, 0x21D2, 0x338,
+    0x2, 0x2203, 0x338, 0x2, 0x2208, 0x338, 0x2, 0x220B, 0x338, 0x2, 0x2223,
+    0x338, 0x2, 0x2225, 0x338, 0x2, 0x222B, 0x222B, 0x3, 0x222B, 0x222B, 0x222B,
+    0x2, 0x222E, 0x222E, 0x3, 0x222E, 0x222E, 0x222E, 0x2, 0x223C, 0x338, 0x2,
+    0x2243, 0x338, 0x2, 0x2245, 0x338, 0x2, 0x2248, 0x338, 0x2, 0x3D, 0x338,
+    0x2, 0x2261, 0x338, 0x2, 0x224D, 0x338, 0x2, 0x3C, 0x338, 0x2, 0x3E, 0x338,
+    0x2, 0x2264, 0x338, 0x2, 0x2265, 0x338, 0x2, 0x2272, 0x338, 0x2, 0x2273,
+    0x338, 0x2, 0x2276, 0x338, 0x2, 0x2277, 0x338, 0x2, 0x227A, 0x338, 0x2,
+    0x227B, 0x338, 0x2, 0x2282, 0x338, 0x2, 0x2283, 0x338, 0x2, 0x2286, 0x338,
+    0x2, 0x2287, 0x338, 0x2, 0x22A2, 0x338, 0x2, 0x22A8, 0x338, 0x2, 0x22A9,
+    0x338, 0x2, 0x22AB, 0x338, 0x2, 0x227C, 0x338, 0x2, 0x227D, 0x338, 0x2,
+    0x2291, 0x338, 0x2, 0x2292, 0x338, 0x2, 0x22B2, 0x338, 0x2, 0x22B3, 0x338,
+    0x2, 0x22B4, 0x338, 0x2, 0x22B5, 0x338, 0x1, 0x3008, 0x1, 0x3009, 0x2, 0x31,
+    0x30, 0x2, 0x31, 0x31, 0x2, 0x31, 0x32, 0x2, 0x31, 0x33, 0x2, 0x31, 0x34,
+    0x2, 0x31, 0x35, 0x2, 0x31, 0x36, 0x2, 0x31, 0x37, 0x2, 0x31, 0x38, 0x2,
+    0x31, 0x39, 0x2, 0x32, 0x30, 0x3, 0x28, 0x31, 0x29, 0x3, 0x28, 0x32, 0x29,
+    0x3, 0x28, 0x33, 0x29, 0x3, 0x28, 0x34, 0x29, 0x3, 0x28, 0x35, 0x29, 0x3,
+    0x28, 0x36, 0x29, 0x3, 0x28, 0x37, 0x29, 0x3, 0x28, 0x38, 0x29, 0x3, 0x28,
+    0x39, 0x29, 0x4, 0x28, 0x31, 0x30, 0x29, 0x4, 0x28, 0x31, 0x31, 0x29, 0x4,
+    0x28, 0x31, 0x32, 0x29, 0x4, 0x28, 0x31, 0x33, 0x29, 0x4, 0x28, 0x31, 0x34,
+    0x29, 0x4, 0x28, 0x31, 0x35, 0x29, 0x4, 0x28, 0x31, 0x36, 0x29, 0x4, 0x28,
+    0x31, 0x37, 0x29, 0x4, 0x28, 0x31, 0x38, 0x29, 0x4, 0x28, 0x31, 0x39, 0x29,
+    0x4, 0x28, 0x32, 0x30, 0x29, 0x2, 0x31, 0x2E, 0x2, 0x32, 0x2E, 0x2, 0x33,
+    0x2E, 0x2, 0x34, 0x2E, 0x2, 0x35, 0x2E, 0x2, 0x36, 0x2E, 0x2, 0x37, 0x2E,
+    0x2, 0x38, 0x2E, 0x2, 0x39, 0x2E, 0x3, 0x31, 0x30, 0x2E, 0x3, 0x31, 0x31,
+    0x2E, 0x3, 0x31, 0x32, 0x2E, 0x3, 0x31, 0x33, 0x2E, 0x3, 0x31, 0x34, 0x2E,
+    0x3, 0x31, 0x35, 0x2E, 0x3, 0x31, 0x36, 0x2E, 0x3, 0x31, 0x37, 0x2E, 0x3,
+    0x31, 0x38, 0x2E, 0x3, 0x31, 0x39, 0x2E, 0x3, 0x32, 0x30, 0x2E, 0x3, 0x28,
+    0x61, 0x29, 0x3, 0x28, 0x62, 0x29, 0x3, 0x28, 0x63, 0x29, 0x3, 0x28, 0x64,
+    0x29, 0x3, 0x28, 0x65, 0x29, 0x3, 0x28, 0x66, 0x29, 0x3, 0x28, 0x67, 0x29,
+    0x3, 0x28, 0x68, 0x29, 0x3, 0x28, 0x69, 0x29, 0x3, 0x28, 0x6A, 0x29, 0x3,
+    0x28, 0x6B, 0x29, 0x3, 0x28, 0x6C, 0x29, 0x3, 0x28, 0x6D, 0x29, 0x3, 0x28,
+    0x6E, 0x29, 0x3, 0x28, 0x6F, 0x29, 0x3, 0x28, 0x70, 0x29, 0x3, 0x28, 0x71,
+    0x29, 0x3, 0x28, 0x72, 0x29, 0x3, 0x28, 0x73, 0x29, 0x3, 0x28, 0x74, 0x29,
+    0x3, 0x28, 0x75, 0x29, 0x3, 0x28, 0x76, 0x29, 0x3, 0x28, 0x77, 0x29, 0x3,
+    0x28, 0x78, 0x29, 0x3, 0x28, 0x79, 0x29, 0x3, 0x28, 0x7A, 0x29, 0x1, 0x24D0,
+    0x1, 0x24D1, 0x1, 0x24D2, 0x1, 0x24D3, 0x1, 0x24D4, 0x1, 0x24D5, 0x1,
+    0x24D6, 0x1, 0x24D7, 0x1, 0x24D8, 0x1, 0x24D9, 0x1, 0x24DA, 0x1, 0x24DB,
+    0x1, 0x24DC, 0x1, 0x24DD, 0x1, 0x24DE, 0x1, 0x24DF, 0x1, 0x24E0, 0x1,
+    0x24E1, 0x1, 0x53, 0x1, 0x24E2, 0x1, 0x24E3, 0x1, 0x24E4, 0x1, 0x24E5, 0x1,
+    0x24E6, 0x1, 0x24E7, 0x1, 0x59, 0x1, 0x24E8, 0x1, 0x24E9, 0x3, 0x3A, 0x3A,
+    0x3D, 0x2, 0x3D, 0x3D, 0x3, 0x3D, 0x3D, 0x3D, 0x2, 0x2ADD, 0x338, 0x1,
+    0x2C30, 0x1, 0x2C31, 0x1, 0x2C32, 0x1, 0x2C33, 0x1, 0x2C34, 0x1, 0x2C35,
+    0x1, 0x2C36, 0x1, 0x2C37, 0x1, 0x2C38, 0x1, 0x2C39, 0x1, 0x2C3A, 0x1,
+    0x2C3B, 0x1, 0x2C3C, 0x1, 0x2C3D, 0x1, 0x2C3E, 0x1, 0x2C3F, 0x1, 0x2C40,
+    0x1, 0x2C41, 0x1, 0x2C42, 0x1, 0x2C43, 0x1, 0x2C44, 0x1, 0x2C45, 0x1,
+    0x2C46, 0x1, 0x2C47, 0x1, 0x2C48, 0x1, 0x2C49, 0x1, 0x2C4A, 0x1, 0x2C4B,
+    0x1, 0x2C4C, 0x1, 0x2C4D, 0x1, 0x2C4E, 0x1, 0x2C4F, 0x1, 0x2C50, 0x1,
+    0x2C51, 0x1, 0x2C52, 0x1, 0x2C53, 0x1, 0x2C54, 0x1, 0x2C55, 0x1, 0x2C56,
+    0x1, 0x2C57, 0x1, 0x2C58, 0x1, 0x2C59, 0x1, 0x2C5A, 0x1, 0x2C5B, 0x1,
+    0x2C5C, 0x1, 0x2C5D, 0x1, 0x2C5E, 0x1, 0x2C5F, 0x1, 0x2C61, 0x1, 0x26B, 0x1,
+    0x1D7D, 0x1, 0x27D, 0x1, 0x2C68, 0x1, 0x2C6A, 0x1, 0x2C6C, 0x1, 0x2C73, 0x1,
+    0x2C76, 0x1, 0x23F, 0x1, 0x240, 0x1, 0x2C81, 0x1, 0x2C83, 0x1, 0x2C85, 0x1,
+    0x2C87, 0x1, 0x2C89, 0x1, 0x2C8B, 0x1, 0x2C8D, 0x1, 0x2C8F, 0x1, 0x2C91,
+    0x1, 0x2C93, 0x1, 0x2C95, 0x1, 0x2C97, 0x1, 0x2C99, 0x1, 0x2C9B, 0x1,
+    0x2C9D, 0x1, 0x2C9F, 0x1, 0x2CA1, 0x1, 0x2CA3, 0x1, 0x2CA5, 0x1, 0x2CA7,
+    0x1, 0x2CA9, 0x1, 0x2CAB, 0x1, 0x2CAD, 0x1, 0x2CAF, 0x1, 0x2CB1, 0x1,
+    0x2CB3, 0x1, 0x2CB5, 0x1, 0x2CB7, 0x1, 0x2CB9, 0x1, 0x2CBB, 0x1, 0x2CBD,
+    0x1, 0x2CBF, 0x1, 0x2CC1, 0x1, 0x2CC3, 0x1, 0x2CC5, 0x1, 0x2CC7, 0x1,
+    0x2CC9, 0x1, 0x2CCB, 0x1, 0x2CCD, 0x1, 0x2CCF, 0x1, 0x2CD1, 0x1, 0x2CD3,
+    0x1, 0x2CD5, 0x1, 0x2CD7, 0x1, 0x2CD9, 0x1, 0x2CDB, 0x1, 0x2CDD, 0x1,
+    0x2CDF, 0x1, 0x2CE1, 0x1, 0x2CE3, 0x1, 0x2CEC, 0x1, 0x2CEE, 0x1, 0x2CF3,
+    0x1, 0x2D61, 0x1, 0x6BCD, 0x1, 0x9F9F, 0x1, 0x4E00, 0x1, 0x4E28, 0x1,
+    0x4E36, 0x1, 0x4E3F, 0x1, 0x4E59, 0x1, 0x4E85, 0x1, 0x4E8C, 0x1, 0x4EA0,
+    0x1, 0x4EBA, 0x1, 0x513F, 0x1, 0x5165, 0x1, 0x516B, 0x1, 0x5182, 0x1,
+    0x5196, 0x1, 0x51AB, 0x1, 0x51E0, 0x1, 0x51F5, 0x1, 0x5200, 0x1, 0x529B,
+    0x1, 0x52F9, 0x1, 0x5315, 0x1, 0x531A, 0x1, 0x5338, 0x1, 0x5341, 0x1,
+    0x535C, 0x1, 0x5369, 0x1, 0x5382, 0x1, 0x53B6, 0x1, 0x53C8, 0x1, 0x53E3,
+    0x1, 0x56D7, 0x1, 0x571F, 0x1, 0x58EB, 0x1, 0x5902, 0x1, 0x590A, 0x1,
+    0x5915, 0x1, 0x5927, 0x1, 0x5973, 0x1, 0x5B50, 0x1, 0x5B80, 0x1, 0x5BF8,
+    0x1, 0x5C0F, 0x1, 0x5C22, 0x1, 0x5C38, 0x1, 0x5C6E, 0x1, 0x5C71, 0x1,
+    0x5DDB, 0x1, 0x5DE5, 0x1, 0x5DF1, 0x1, 0x5DFE, 0x1, 0x5E72, 0x1, 0x5E7A,
+    0x1, 0x5E7F, 0x1, 0x5EF4, 0x1, 0x5EFE, 0x1, 0x5F0B, 0x1, 0x5F13, 0x1,
+    0x5F50, 0x1, 0x5F61, 0x1, 0x5F73, 0x1, 0x5FC3, 0x1, 0x6208, 0x1, 0x6236,
+    0x1, 0x624B, 0x1, 0x652F, 0x1, 0x6534, 0x1, 0x6587, 0x1, 0x6597, 0x1,
+    0x65A4, 0x1, 0x65B9, 0x1, 0x65E0, 0x1, 0x65E5, 0x1, 0x66F0, 0x1, 0x6708,
+    0x1, 0x6728, 0x1, 0x6B20, 0x1, 0x6B62, 0x1, 0x6B79, 0x1, 0x6BB3, 0x1,
+    0x6BCB, 0x1, 0x6BD4, 0x1, 0x6BDB, 0x1, 0x6C0F, 0x1, 0x6C14, 0x1, 0x6C34,
+    0x1, 0x706B, 0x1, 0x722A, 0x1, 0x7236, 0x1, 0x723B, 0x1, 0x723F, 0x1,
+    0x7247, 0x1, 0x7259, 0x1, 0x725B, 0x1, 0x72AC, 0x1, 0x7384, 0x1, 0x7389,
+    0x1, 0x74DC, 0x1, 0x74E6, 0x1, 0x7518, 0x1, 0x751F, 0x1, 0x7528, 0x1,
+    0x7530, 0x1, 0x758B, 0x1, 0x7592, 0x1, 0x7676, 0x1, 0x767D, 0x1, 0x76AE,
+    0x1, 0x76BF, 0x1, 0x76EE, 0x1, 0x77DB, 0x1, 0x77E2, 0x1, 0x77F3, 0x1,
+    0x793A, 0x1, 0x79B8, 0x1, 0x79BE, 0x1, 0x7A74, 0x1, 0x7ACB, 0x1, 0x7AF9,
+    0x1, 0x7C73, 0x1, 0x7CF8, 0x1, 0x7F36, 0x1, 0x7F51, 0x1, 0x7F8A, 0x1,
+    0x7FBD, 0x1, 0x8001, 0x1, 0x800C, 0x1, 0x8012, 0x1, 0x8033, 0x1, 0x807F,
+    0x1, 0x8089, 0x1, 0x81E3, 0x1, 0x81EA, 0x1, 0x81F3, 0x1, 0x81FC, 0x1,
+    0x820C, 0x1, 0x821B, 0x1, 0x821F, 0x1, 0x826E, 0x1, 0x8272, 0x1, 0x8278,
+    0x1, 0x864D, 0x1, 0x866B, 0x1, 0x8840, 0x1, 0x884C, 0x1, 0x8863, 0x1,
+    0x897E, 0x1, 0x898B, 0x1, 0x89D2, 0x1, 0x8A00, 0x1, 0x8C37, 0x1, 0x8C46,
+    0x1, 0x8C55, 0x1, 0x8C78, 0x1, 0x8C9D, 0x1, 0x8D64, 0x1, 0x8D70, 0x1,
+    0x8DB3, 0x1, 0x8EAB, 0x1, 0x8ECA, 0x1, 0x8F9B, 0x1, 0x8FB0, 0x1, 0x8FB5,
+    0x1, 0x9091, 0x1, 0x9149, 0x1, 0x91C6, 0x1, 0x91CC, 0x1, 0x91D1, 0x1,
+    0x9577, 0x1, 0x9580, 0x1, 0x961C, 0x1, 0x96B6, 0x1, 0x96B9, 0x1, 0x96E8,
+    0x1, 0x9751, 0x1, 0x975E, 0x1, 0x9762, 0x1, 0x9769, 0x1, 0x97CB, 0x1,
+    0x97ED, 0x1, 0x97F3, 0x1, 0x9801, 0x1, 0x98A8, 0x1, 0x98DB, 0x1, 0x98DF,
+    0x1, 0x9996, 0x1, 0x9999, 0x1, 0x99AC, 0x1, 0x9AA8, 0x1, 0x9AD8, 0x1,
+    0x9ADF, 0x1, 0x9B25, 0x1, 0x9B2F, 0x1, 0x9B32, 0x1, 0x9B3C, 0x1, 0x9B5A,
+    0x1, 0x9CE5, 0x1, 0x9E75, 0x1, 0x9E7F, 0x1, 0x9EA5, 0x1, 0x9EBB, 0x1,
+    0x9EC3, 0x1, 0x9ECD, 0x1, 0x9ED1, 0x1, 0x9EF9, 0x1, 0x9EFD, 0x1, 0x9F0E,
+    0x1, 0x9F13, 0x1, 0x9F20, 0x1, 0x9F3B, 0x1, 0x9F4A, 0x1, 0x9F52, 0x1,
+    0x9F8D, 0x1, 0x9F9C, 0x1, 0x9FA0, 0x1, 0x3012, 0x1, 0x5344, 0x1, 0x5345,
+    0x2, 0x304B, 0x3099, 0x2, 0x304D, 0x3099, 0x2, 0x304F, 0x3099, 0x2, 0x3051,
+    0x3099, 0x2, 0x3053, 0x3099, 0x2, 0x3055, 0x3099, 0x2, 0x3057, 0x3099, 0x2,
+    0x3059, 0x3099, 0x2, 0x305B, 0x3099, 0x2, 0x305D, 0x3099, 0x2, 0x305F,
+    0x3099, 0x2, 0x3061, 0x3099, 0x2, 0x3064, 0x3099, 0x2, 0x3066, 0x3099, 0x2,
+    0x3068, 0x3099, 0x2, 0x306F, 0x3099, 0x2, 0x306F, 0x309A, 0x2, 0x3072,
+    0x3099, 0x2, 0x3072, 0x309A, 0x2, 0x3075, 0x3099, 0x2, 0x3075, 0x309A, 0x2,
+    0x3078, 0x3099, 0x2, 0x3078, 0x309A, 0x2, 0x307B, 0x3099, 0x2, 0x307B,
+    0x309A, 0x2, 0x3046, 0x3099, 0x2, 0x20, 0x3099, 0x2, 0x20, 0x309A, 0x2,
+    0x309D, 0x3099, 0x2, 0x3088, 0x308A, 0x2, 0x30AB, 0x3099, 0x2, 0x30AD,
+    0x3099, 0x2, 0x30AF, 0x3099, 0x2, 0x30B1, 0x3099, 0x2, 0x30B3, 0x3099, 0x2,
+    0x30B5, 0x3099, 0x2, 0x30B7, 0x3099, 0x2, 0x30B9, 0x3099, 0x2, 0x30BB,
+    0x3099, 0x2, 0x30BD, 0x3099, 0x2, 0x30BF, 0x3099, 0x2, 0x30C1, 0x3099, 0x2,
+    0x30C4, 0x3099, 0x2, 0x30C6, 0x3099, 0x2, 0x30C8, 0x3099, 0x2, 0x30CF,
+    0x3099, 0x2, 0x30CF, 0x309A, 0x2, 0x30D2, 0x3099, 0x2, 0x30D2, 0x309A, 0x2,
+    0x30D5, 0x3099, 0x2, 0x30D5, 0x309A, 0x2, 0x30D8, 0x3099, 0x2, 0x30D8,
+    0x309A, 0x2, 0x30DB, 0x3099, 0x2, 0x30DB, 0x309A, 0x2, 0x30A6, 0x3099, 0x2,
+    0x30EF, 0x3099, 0x2, 0x30F0, 0x3099, 0x2, 0x30F1, 0x3099, 0x2, 0x30F2,
+    0x3099, 0x2, 0x30FD, 0x3099, 0x2, 0x30B3, 0x30C8, 0x1, 0x1100, 0x1, 0x1101,
+    0x1, 0x11AA, 0x1, 0x1102, 0x1, 0x11AC, 0x1, 0x11AD, 0x1, 0x1103, 0x1,
+    0x1104, 0x1, 0x1105, 0x1, 0x11B0, 0x1, 0x11B1, 0x1, 0x11B2, 0x1, 0x11B3,
+    0x1, 0x11B4, 0x1, 0x11B5, 0x1, 0x111A, 0x1, 0x1106, 0x1, 0x1107, 0x1,
+    0x1108, 0x1, 0x1121, 0x1, 0x1109, 0x1, 0x110A, 0x1, 0x110B, 0x1, 0x110C,
+    0x1, 0x110D, 0x1, 0x110E, 0x1, 0x110F, 0x1, 0x1110, 0x1, 0x1111, 0x1,
+    0x1112, 0x1, 0x1161, 0x1, 0x1162, 0x1, 0x1163, 0x1, 0x1164, 0x1, 0x1165,
+    0x1, 0x1166, 0x1, 0x1167, 0x1, 0x1168, 0x1, 0x1169, 0x1, 0x116A, 0x1,
+    0x116B, 0x1, 0x116C, 0x1, 0x116D, 0x1, 0x116E, 0x1, 0x116F, 0x1, 0x1170,
+    0x1, 0x1171, 0x1, 0x1172, 0x1, 0x1173, 0x1, 0x1174, 0x1, 0x1175, 0x1,
+    0x1160, 0x1, 0x1114, 0x1, 0x1115, 0x1, 0x11C7, 0x1, 0x11C8, 0x1, 0x11CC,
+    0x1, 0x11CE, 0x1, 0x11D3, 0x1, 0x11D7, 0x1, 0x11D9, 0x1, 0x111C, 0x1,
+    0x11DD, 0x1, 0x11DF, 0x1, 0x111D, 0x1, 0x111E, 0x1, 0x1120, 0x1, 0x1122,
+    0x1, 0x1123, 0x1, 0x1127, 0x1, 0x1129, 0x1, 0x112B, 0x1, 0x112C, 0x1,
+    0x112D, 0x1, 0x112E, 0x1, 0x112F, 0x1, 0x1132, 0x1, 0x1136, 0x1, 0x1140,
+    0x1, 0x1147, 0x1, 0x114C, 0x1, 0x11F1, 0x1, 0x11F2, 0x1, 0x1157, 0x1,
+    0x1158, 0x1, 0x1159, 0x1, 0x1184, 0x1, 0x1185, 0x1, 0x1188, 0x1, 0x1191,
+    0x1, 0x1192, 0x1, 0x1194, 0x1, 0x119E, 0x1, 0x11A1, 0x1, 0x4E09, 0x1,
+    0x56DB, 0x1, 0x4E0A, 0x1, 0x4E2D, 0x1, 0x4E0B, 0x1, 0x7532, 0x1, 0x4E19,
+    0x1, 0x4E01, 0x1, 0x5929, 0x1, 0x5730, 0x3, 0x28, 0x1100, 0x29, 0x3, 0x28,
+    0x1102, 0x29, 0x3, 0x28, 0x1103, 0x29, 0x3, 0x28, 0x1105, 0x29, 0x3, 0x28,
+    0x1106, 0x29, 0x3, 0x28, 0x1107, 0x29, 0x3, 0x28, 0x1109, 0x29, 0x3, 0x28,
+    0x110B, 0x29, 0x3, 0x28, 0x110C, 0x29, 0x3, 0x28, 0x110E, 0x29, 0x3, 0x28,
+    0x110F, 0x29, 0x3, 0x28, 0x1110, 0x29, 0x3, 0x28, 0x1111, 0x29, 0x3, 0x28,
+    0x1112, 0x29, 0x3, 0x28, 0xAC00, 0x29, 0x3, 0x28, 0xB098, 0x29, 0x3, 0x28,
+    0xB2E4, 0x29, 0x3, 0x28, 0xB77C, 0x29, 0x3, 0x28, 0xB9C8, 0x29, 0x3, 0x28,
+    0xBC14, 0x29, 0x3, 0x28, 0xC0AC, 0x29, 0x3, 0x28, 0xC544, 0x29, 0x3, 0x28,
+    0xC790, 0x29, 0x3, 0x28, 0xCC28, 0x29, 0x3, 0x28, 0xCE74, 0x29, 0x3, 0x28,
+    0xD0C0, 0x29, 0x3, 0x28, 0xD30C, 0x29, 0x3, 0x28, 0xD558, 0x29, 0x3, 0x28,
+    0xC8FC, 0x29, 0x4, 0x28, 0xC624, 0xC804, 0x29, 0x4, 0x28, 0xC624, 0xD6C4,
+    0x29, 0x3, 0x28, 0x4E00, 0x29, 0x3, 0x28, 0x4E8C, 0x29, 0x3, 0x28, 0x4E09,
+    0x29, 0x3, 0x28, 0x56DB, 0x29, 0x3, 0x28, 0x4E94, 0x29, 0x3, 0x28, 0x516D,
+    0x29, 0x3, 0x28, 0x4E03, 0x29, 0x3, 0x28, 0x516B, 0x29, 0x3, 0x28, 0x4E5D,
+    0x29, 0x3, 0x28, 0x5341, 0x29, 0x3, 0x28, 0x6708, 0x29, 0x3, 0x28, 0x706B,
+    0x29, 0x3, 0x28, 0x6C34, 0x29, 0x3, 0x28, 0x6728, 0x29, 0x3, 0x28, 0x91D1,
+    0x29, 0x3, 0x28, 0x571F, 0x29, 0x3, 0x28, 0x65E5, 0x29, 0x3, 0x28, 0x682A,
+    0x29, 0x3, 0x28, 0x6709, 0x29, 0x3, 0x28, 0x793E, 0x29, 0x3, 0x28, 0x540D,
+    0x29, 0x3, 0x28, 0x7279, 0x29, 0x3, 0x28, 0x8CA1, 0x29, 0x3, 0x28, 0x795D,
+    0x29, 0x3, 0x28, 0x52B4, 0x29, 0x3, 0x28, 0x4EE3, 0x29, 0x3, 0x28, 0x547C,
+    0x29, 0x3, 0x28, 0x5B66, 0x29, 0x3, 0x28, 0x76E3, 0x29, 0x3, 0x28, 0x4F01,
+    0x29, 0x3, 0x28, 0x8CC7, 0x29, 0x3, 0x28, 0x5354, 0x29, 0x3, 0x28, 0x796D,
+    0x29, 0x3, 0x28, 0x4F11, 0x29, 0x3, 0x28, 0x81EA, 0x29, 0x3, 0x28, 0x81F3,
+    0x29, 0x1, 0x554F, 0x1, 0x5E7C, 0x1, 0x7B8F, 0x3, 0x50, 0x54, 0x45, 0x3,
+    0x70, 0x74, 0x65, 0x2, 0x32, 0x31, 0x2, 0x32, 0x32, 0x2, 0x32, 0x33, 0x2,
+    0x32, 0x34, 0x2, 0x32, 0x35, 0x2, 0x32, 0x36, 0x2, 0x32, 0x37, 0x2, 0x32,
+    0x38, 0x2, 0x32, 0x39, 0x2, 0x33, 0x30, 0x2, 0x33, 0x31, 0x2, 0x33, 0x32,
+    0x2, 0x33, 0x33, 0x2, 0x33, 0x34, 0x2, 0x33, 0x35, 0x1, 0xAC00, 0x1, 0xB098,
+    0x1, 0xB2E4, 0x1, 0xB77C, 0x1, 0xB9C8, 0x1, 0xBC14, 0x1, 0xC0AC, 0x1,
+    0xC544, 0x1, 0xC790, 0x1, 0xCC28, 0x1, 0xCE74, 0x1, 0xD0C0, 0x1, 0xD30C,
+    0x1, 0xD558, 0x2, 0xCC38, 0xACE0, 0x2, 0xC8FC, 0xC758, 0x1, 0xC6B0, 0x1,
+    0x4E94, 0x1, 0x516D, 0x1, 0x4E03, 0x1, 0x4E5D, 0x1, 0x682A, 0x1, 0x6709,
+    0x1, 0x793E, 0x1, 0x540D, 0x1, 0x7279, 0x1, 0x8CA1, 0x1, 0x795D, 0x1,
+    0x52B4, 0x1, 0x79D8, 0x1, 0x7537, 0x1, 0x9069, 0x1, 0x512A, 0x1, 0x5370,
+    0x1, 0x6CE8, 0x1, 0x9805, 0x1, 0x4F11, 0x1, 0x5199, 0x1, 0x6B63, 0x1,
+    0x5DE6, 0x1, 0x53F3, 0x1, 0x533B, 0x1, 0x5B97, 0x1, 0x5B66, 0x1, 0x76E3,
+    0x1, 0x4F01, 0x1, 0x8CC7, 0x1, 0x5354, 0x1, 0x591C, 0x2, 0x33, 0x36, 0x2,
+    0x33, 0x37, 0x2, 0x33, 0x38, 0x2, 0x33, 0x39, 0x2, 0x34, 0x30, 0x2, 0x34,
+    0x31, 0x2, 0x34, 0x32, 0x2, 0x34, 0x33, 0x2, 0x34, 0x34, 0x2, 0x34, 0x35,
+    0x2, 0x34, 0x36, 0x2, 0x34, 0x37, 0x2, 0x34, 0x38, 0x2, 0x34, 0x39, 0x2,
+    0x35, 0x30, 0x2, 0x31, 0x6708, 0x2, 0x32, 0x6708, 0x2, 0x33, 0x6708, 0x2,
+    0x34, 0x6708, 0x2, 0x35, 0x6708, 0x2, 0x36, 0x6708, 0x2, 0x37, 0x6708, 0x2,
+    0x38, 0x6708, 0x2, 0x39, 0x6708, 0x3, 0x31, 0x30, 0x6708, 0x3, 0x31, 0x31,
+    0x6708, 0x3, 0x31, 0x32, 0x6708, 0x2, 0x48, 0x67, 0x2, 0x68, 0x67, 0x3,
+    0x65, 0x72, 0x67, 0x2, 0x65, 0x56, 0x2, 0x65, 0x76, 0x3, 0x4C, 0x54, 0x44,
+    0x3, 0x6C, 0x74, 0x64, 0x1, 0x30A2, 0x1, 0x30A4, 0x1, 0x30A6, 0x1, 0x30A8,
+    0x1, 0x30AA, 0x1, 0x30AB, 0x1, 0x30AD, 0x1, 0x30AF, 0x1, 0x30B1, 0x1,
+    0x30B3, 0x1, 0x30B5, 0x1, 0x30B7, 0x1, 0x30B9, 0x1, 0x30BB, 0x1, 0x30BD,
+    0x1, 0x30BF, 0x1, 0x30C1, 0x1, 0x30C4, 0x1, 0x30C6, 0x1, 0x30C8, 0x1,
+    0x30CA, 0x1, 0x30CB, 0x1, 0x30CC, 0x1, 0x30CD, 0x1, 0x30CE, 0x1, 0x30CF,
+    0x1, 0x30D2, 0x1, 0x30D5, 0x1, 0x30D8, 0x1, 0x30DB, 0x1, 0x30DE, 0x1,
+    0x30DF, 0x1, 0x30E0, 0x1, 0x30E1, 0x1, 0x30E2, 0x1, 0x30E4, 0x1, 0x30E6,
+    0x1, 0x30E8, 0x1, 0x30E9, 0x1, 0x30EA, 0x1, 0x30EB, 0x1, 0x30EC, 0x1,
+    0x30ED, 0x1, 0x30EF, 0x1, 0x30F0, 0x1, 0x30F1, 0x1, 0x30F2, 0x2, 0x4EE4,
+    0x548C, 0x3, 0x30A2, 0x30FC, 0x30EB, 0x3, 0x30A4, 0x30F3, 0x30C1, 0x3,
+    0x30A6, 0x30A9, 0x30F3, 0x3, 0x30AA, 0x30F3, 0x30B9, 0x3, 0x30AA, 0x30FC,
+    0x30E0, 0x3, 0x30AB, 0x30A4, 0x30EA, 0x3, 0x30AC, 0x30ED, 0x30F3, 0x3,
+    0x30AC, 0x30F3, 0x30DE, 0x2, 0x30AE, 0x30AC, 0x3, 0x30AE, 0x30CB, 0x30FC,
+    0x2, 0x30AD, 0x30ED, 0x3, 0x30B0, 0x30E9, 0x30E0, 0x3, 0x30B1, 0x30FC,
+    0x30B9, 0x3, 0x30B3, 0x30EB, 0x30CA, 0x3, 0x30B3, 0x30FC, 0x30DD, 0x3,
+    0x30BB, 0x30F3, 0x30C1, 0x3, 0x30BB, 0x30F3, 0x30C8, 0x3, 0x30C0, 0x30FC,
+    0x30B9, 0x2, 0x30C7, 0x30B7, 0x2, 0x30C9, 0x30EB, 0x2, 0x30C8, 0x30F3, 0x2,
+    0x30CA, 0x30CE, 0x3, 0x30CE, 0x30C3, 0x30C8, 0x3, 0x30CF, 0x30A4, 0x30C4,
+    0x3, 0x30D1, 0x30FC, 0x30C4, 0x3, 0x30D4, 0x30AF, 0x30EB, 0x2, 0x30D4,
+    0x30B3, 0x2, 0x30D3, 0x30EB, 0x3, 0x30D5, 0x30E9, 0x30F3, 0x2, 0x30DA,
+    0x30BD, 0x3, 0x30DA, 0x30CB, 0x30D2, 0x3, 0x30D8, 0x30EB, 0x30C4, 0x3,
+    0x30DA, 0x30F3, 0x30B9, 0x3, 0x30DA, 0x30FC, 0x30B8, 0x3, 0x30D9, 0x30FC,
+    0x30BF, 0x3, 0x30DC, 0x30EB, 0x30C8, 0x2, 0x30DB, 0x30F3, 0x3, 0x30DD,
+    0x30F3, 0x30C9, 0x3, 0x30DB, 0x30FC, 0x30EB, 0x3, 0x30DB, 0x30FC, 0x30F3,
+    0x3, 0x30DE, 0x30A4, 0x30EB, 0x3, 0x30DE, 0x30C3, 0x30CF, 0x3, 0x30DE,
+    0x30EB, 0x30AF, 0x2, 0x30DF, 0x30EA, 0x2, 0x30E1, 0x30AC, 0x3, 0x30E4,
+    0x30FC, 0x30C9, 0x3, 0x30E4, 0x30FC, 0x30EB, 0x3, 0x30E6, 0x30A2, 0x30F3,
+    0x2, 0x30EA, 0x30E9, 0x3, 0x30EB, 0x30D4, 0x30FC, 0x2, 0x30EC, 0x30E0, 0x3,
+    0x30EF, 0x30C3, 0x30C8, 0x2, 0x30, 0x70B9, 0x2, 0x31, 0x70B9, 0x2, 0x32,
+    0x70B9, 0x2, 0x33, 0x70B9, 0x2, 0x34, 0x70B9, 0x2, 0x35, 0x70B9, 0x2, 0x36,
+    0x70B9, 0x2, 0x37, 0x70B9, 0x2, 0x38, 0x70B9, 0x2, 0x39, 0x70B9, 0x3, 0x31,
+    0x30, 0x70B9, 0x3, 0x31, 0x31, 0x70B9, 0x3, 0x31, 0x32, 0x70B9, 0x3, 0x31,
+    0x33, 0x70B9, 0x3, 0x31, 0x34, 0x70B9, 0x3, 0x31, 0x35, 0x70B9, 0x3, 0x31,
+    0x36, 0x70B9, 0x3, 0x31, 0x37, 0x70B9, 0x3, 0x31, 0x38, 0x70B9, 0x3, 0x31,
+    0x39, 0x70B9, 0x3, 0x32, 0x30, 0x70B9, 0x3, 0x32, 0x31, 0x70B9, 0x3, 0x32,
+    0x32, 0x70B9, 0x3, 0x32, 0x33, 0x70B9, 0x3, 0x32, 0x34, 0x70B9, 0x3, 0x68,
+    0x50, 0x61, 0x3, 0x68, 0x70, 0x61, 0x2, 0x64, 0x61, 0x2, 0x41, 0x55, 0x2,
+    0x61, 0x75, 0x3, 0x62, 0x61, 0x72, 0x2, 0x6F, 0x56, 0x2, 0x6F, 0x76, 0x2,
+    0x70, 0x63, 0x2, 0x64, 0x6D, 0x3, 0x64, 0x6D, 0x32, 0x3, 0x64, 0x6D, 0x33,
+    0x2, 0x49, 0x55, 0x2, 0x69, 0x75, 0x2, 0x5E73, 0x6210, 0x2, 0x662D, 0x548C,
+    0x2, 0x5927, 0x6B63, 0x2, 0x660E, 0x6CBB, 0x2, 0x70, 0x41, 0x2, 0x70, 0x61,
+    0x2, 0x6E, 0x41, 0x2, 0x6E, 0x61, 0x2, 0x3BC, 0x41, 0x2, 0x3BC, 0x61, 0x2,
+    0x6D, 0x41, 0x2, 0x6D, 0x61, 0x2, 0x6B, 0x41, 0x2, 0x6B, 0x61, 0x2, 0x4B,
+    0x42, 0x2, 0x6B, 0x62, 0x2, 0x4D, 0x42, 0x2, 0x6D, 0x62, 0x2, 0x47, 0x42,
+    0x2, 0x67, 0x62, 0x3, 0x63, 0x61, 0x6C, 0x4, 0x6B, 0x63, 0x61, 0x6C, 0x2,
+    0x70, 0x46, 0x2, 0x70, 0x66, 0x2, 0x6E, 0x46, 0x2, 0x6E, 0x66, 0x2, 0x3BC,
+    0x46, 0x2, 0x3BC, 0x66, 0x2, 0x3BC, 0x67, 0x2, 0x6D, 0x67, 0x2, 0x6B, 0x67,
+    0x2, 0x48, 0x7A, 0x2, 0x68, 0x7A, 0x3, 0x6B, 0x48, 0x7A, 0x3, 0x6B, 0x68,
+    0x7A, 0x3, 0x4D, 0x48, 0x7A, 0x3, 0x6D, 0x68, 0x7A, 0x3, 0x47, 0x48, 0x7A,
+    0x3, 0x67, 0x68, 0x7A, 0x3, 0x54, 0x48, 0x7A, 0x3, 0x74, 0x68, 0x7A, 0x2,
+    0x3BC, 0x6C, 0x2, 0x6D, 0x6C, 0x2, 0x64, 0x6C, 0x2, 0x6B, 0x6C, 0x2, 0x66,
+    0x6D, 0x2, 0x6E, 0x6D, 0x2, 0x3BC, 0x6D, 0x2, 0x6D, 0x6D, 0x2, 0x63, 0x6D,
+    0x2, 0x6B, 0x6D, 0x3, 0x6D, 0x6D, 0x32, 0x3, 0x63, 0x6D, 0x32, 0x2, 0x6D,
+    0x32, 0x3, 0x6B, 0x6D, 0x32, 0x3, 0x6D, 0x6D, 0x33, 0x3, 0x63, 0x6D, 0x33,
+    0x2, 0x6D, 0x33, 0x3, 0x6B, 0x6D, 0x33, 0x3, 0x6D, 0x2215, 0x73, 0x4, 0x6D,
+    0x2215, 0x73, 0x32, 0x2, 0x50, 0x61, 0x3, 0x6B, 0x50, 0x61, 0x3, 0x6B, 0x70,
+    0x61, 0x3, 0x4D, 0x50, 0x61, 0x3, 0x6D, 0x70, 0x61, 0x3, 0x47, 0x50, 0x61,
+    0x3, 0x67, 0x70, 0x61, 0x3, 0x72, 0x61, 0x64, 0x5, 0x72, 0x61, 0x64, 0x2215,
+    0x73, 0x6, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x32, 0x2, 0x70, 0x73, 0x2, 0x6E,
+    0x73, 0x2, 0x3BC, 0x73, 0x2, 0x6D, 0x73, 0x2, 0x70, 0x56, 0x2, 0x70, 0x76,
+    0x2, 0x6E, 0x56, 0x2, 0x6E, 0x76, 0x2, 0x3BC, 0x56, 0x2, 0x3BC, 0x76, 0x2,
+    0x6D, 0x56, 0x2, 0x6D, 0x76, 0x2, 0x6B, 0x56, 0x2, 0x6B, 0x76, 0x2, 0x4D,
+    0x56, 0x2, 0x70, 0x57, 0x2, 0x70, 0x77, 0x2, 0x6E, 0x57, 0x2, 0x6E, 0x77,
+    0x2, 0x3BC, 0x57, 0x2, 0x3BC, 0x77, 0x2, 0x6D, 0x57, 0x2, 0x6D, 0x77, 0x2,
+    0x6B, 0x57, 0x2, 0x6B, 0x77, 0x2, 0x4D, 0x57, 0x2, 0x6B, 0x3A9, 0x2, 0x6B,
+    0x3C9, 0x2, 0x4D, 0x3A9, 0x2, 0x6D, 0x3C9, 0x4, 0x61, 0x2E, 0x6D, 0x2E, 0x2,
+    0x42, 0x71, 0x2, 0x62, 0x71, 0x2, 0x63, 0x63, 0x2, 0x63, 0x64, 0x4, 0x43,
+    0x2215, 0x6B, 0x67, 0x4, 0x63, 0x2215, 0x6B, 0x67, 0x3, 0x43, 0x6F, 0x2E,
+    0x3, 0x63, 0x6F, 0x2E, 0x2, 0x64, 0x42, 0x2, 0x64, 0x62, 0x2, 0x47, 0x79,
+    0x2, 0x67, 0x79, 0x2, 0x68, 0x61, 0x2, 0x48, 0x50, 0x2, 0x68, 0x70, 0x2,
+    0x69, 0x6E, 0x2, 0x4B, 0x4B, 0x2, 0x6B, 0x6B, 0x2, 0x4B, 0x4D, 0x2, 0x6B,
+    0x74, 0x2, 0x6C, 0x6D, 0x2, 0x6C, 0x6E, 0x3, 0x6C, 0x6F, 0x67, 0x2, 0x6C,
+    0x78, 0x3, 0x6D, 0x69, 0x6C, 0x3, 0x6D, 0x6F, 0x6C, 0x2, 0x50, 0x48, 0x2,
+    0x70, 0x68, 0x4, 0x70, 0x2E, 0x6D, 0x2E, 0x3, 0x50, 0x50, 0x4D, 0x3, 0x70,
+    0x70, 0x6D, 0x2, 0x50, 0x52, 0x2, 0x70, 0x72, 0x2, 0x73, 0x72, 0x2, 0x53,
+    0x76, 0x2, 0x73, 0x76, 0x2, 0x57, 0x62, 0x2, 0x77, 0x62, 0x3, 0x56, 0x2215,
+    0x6D, 0x3, 0x76, 0x2215, 0x6D, 0x3, 0x41, 0x2215, 0x6D, 0x3, 0x61, 0x2215,
+    0x6D, 0x2, 0x31, 0x65E5, 0x2, 0x32, 0x65E5, 0x2, 0x33, 0x65E5, 0x2, 0x34,
+    0x65E5, 0x2, 0x35, 0x65E5, 0x2, 0x36, 0x65E5, 0x2, 0x37, 0x65E5, 0x2, 0x38,
+    0x65E5, 0x2, 0x39, 0x65E5, 0x3, 0x31, 0x30, 0x65E5, 0x3, 0x31, 0x31, 0x65E5,
+    0x3, 0x31, 0x32, 0x65E5, 0x3, 0x31, 0x33, 0x65E5, 0x3, 0x31, 0x34, 0x65E5,
+    0x3, 0x31, 0x35, 0x65E5, 0x3, 0x31, 0x36, 0x65E5, 0x3, 0x31, 0x37, 0x65E5,
+    0x3, 0x31, 0x38, 0x65E5, 0x3, 0x31, 0x39, 0x65E5, 0x3, 0x32, 0x30, 0x65E5,
+    0x3, 0x32, 0x31, 0x65E5, 0x3, 0x32, 0x32, 0x65E5, 0x3, 0x32, 0x33, 0x65E5,
+    0x3, 0x32, 0x34, 0x65E5, 0x3, 0x32, 0x35, 0x65E5, 0x3, 0x32, 0x36, 0x65E5,
+    0x3, 0x32, 0x37, 0x65E5, 0x3, 0x32, 0x38, 0x65E5, 0x3, 0x32, 0x39, 0x65E5,
+    0x3, 0x33, 0x30, 0x65E5, 0x3, 0x33, 0x31, 0x65E5, 0x3, 0x67, 0x61, 0x6C,
+    0x1, 0xA641, 0x1, 0xA643, 0x1, 0xA645, 0x1, 0xA647, 0x1, 0xA649, 0x1,
+    0xA64D, 0x1, 0xA64F, 0x1, 0xA651, 0x1, 0xA653, 0x1, 0xA655, 0x1, 0xA657,
+    0x1, 0xA659, 0x1, 0xA65B, 0x1, 0xA65D, 0x1, 0xA65F, 0x1, 0xA661, 0x1,
+    0xA663, 0x1, 0xA665, 0x1, 0xA667, 0x1, 0xA669, 0x1, 0xA66B, 0x1, 0xA66D,
+    0x1, 0xA681, 0x1, 0xA683, 0x1, 0xA685, 0x1, 0xA687, 0x1, 0xA689, 0x1,
+    0xA68B, 0x1, 0xA68D, 0x1, 0xA68F, 0x1, 0xA691, 0x1, 0xA693, 0x1, 0xA695,
+    0x1, 0xA697, 0x1, 0xA699, 0x1, 0xA69B, 0x1, 0xA723, 0x1, 0xA725, 0x1,
+    0xA727, 0x1, 0xA729, 0x1, 0xA72B, 0x1, 0xA72D, 0x1, 0xA72F, 0x1, 0xA733,
+    0x1, 0xA735, 0x1, 0xA737, 0x1, 0xA739, 0x1, 0xA73B, 0x1, 0xA73D, 0x1,
+    0xA73F, 0x1, 0xA741, 0x1, 0xA743, 0x1, 0xA745, 0x1, 0xA747, 0x1, 0xA749,
+    0x1, 0xA74B, 0x1, 0xA74D, 0x1, 0xA74F, 0x1, 0xA751, 0x1, 0xA753, 0x1,
+    0xA755, 0x1, 0xA757, 0x1, 0xA759, 0x1, 0xA75B, 0x1, 0xA75D, 0x1, 0xA75F,
+    0x1, 0xA761, 0x1, 0xA763, 0x1, 0xA765, 0x1, 0xA767, 0x1, 0xA769, 0x1,
+    0xA76B, 0x1, 0xA76D, 0x1, 0xA76F, 0x1, 0xA77A, 0x1, 0xA77C, 0x1, 0x1D79,
+    0x1, 0xA77F, 0x1, 0xA781, 0x1, 0xA783, 0x1, 0xA785, 0x1, 0xA787, 0x1,
+    0xA78C, 0x1, 0xA791, 0x1, 0xA793, 0x1, 0xA797, 0x1, 0xA799, 0x1, 0xA79B,
+    0x1, 0xA79D, 0x1, 0xA79F, 0x1, 0xA7A1, 0x1, 0xA7A3, 0x1, 0xA7A5, 0x1,
+    0xA7A7, 0x1, 0xA7A9, 0x1, 0x26C, 0x1, 0x29E, 0x1, 0x287, 0x1, 0xAB53, 0x1,
+    0xA7B5, 0x1, 0xA7B7, 0x1, 0xA7B9, 0x1, 0xA7BB, 0x1, 0xA7BD, 0x1, 0xA7BF,
+    0x1, 0xA7C1, 0x1, 0xA7C3, 0x1, 0xA794, 0x1, 0x1D8E, 0x1, 0xA7C8, 0x1,
+    0xA7CA, 0x1, 0xA7D1, 0x1, 0xA7D7, 0x1, 0xA7D9, 0x1, 0xA7F6, 0x1, 0x126, 0x1,
+    0xAB37, 0x1, 0xAB52, 0x1, 0x28D, 0x1, 0x13A0, 0x1, 0x13A1, 0x1, 0x13A2, 0x1,
+    0x13A3, 0x1, 0x13A4, 0x1, 0x13A5, 0x1, 0x13A6, 0x1, 0x13A7, 0x1, 0x13A8,
+    0x1, 0x13A9, 0x1, 0x13AA, 0x1, 0x13AB, 0x1, 0x13AC, 0x1, 0x13AD, 0x1,
+    0x13AE, 0x1, 0x13AF, 0x1, 0x13B0, 0x1, 0x13B1, 0x1, 0x13B2, 0x1, 0x13B3,
+    0x1, 0x13B4, 0x1, 0x13B5, 0x1, 0x13B6, 0x1, 0x13B7, 0x1, 0x13B8, 0x1,
+    0x13B9, 0x1, 0x13BA, 0x1, 0x13BB, 0x1, 0x13BC, 0x1, 0x13BD, 0x1, 0x13BE,
+    0x1, 0x13BF, 0x1, 0x13C0, 0x1, 0x13C1, 0x1, 0x13C2, 0x1, 0x13C3, 0x1,
+    0x13C4, 0x1, 0x13C5, 0x1, 0x13C6, 0x1, 0x13C7, 0x1, 0x13C8, 0x1, 0x13C9,
+    0x1, 0x13CA, 0x1, 0x13CB, 0x1, 0x13CC, 0x1, 0x13CD, 0x1, 0x13CE, 0x1,
+    0x13CF, 0x1, 0x13D0, 0x1, 0x13D1, 0x1, 0x13D2, 0x1, 0x13D3, 0x1, 0x13D4,
+    0x1, 0x13D5, 0x1, 0x13D6, 0x1, 0x13D7, 0x1, 0x13D8, 0x1, 0x13D9, 0x1,
+    0x13DA, 0x1, 0x13DB, 0x1, 0x13DC, 0x1, 0x13DD, 0x1, 0x13DE, 0x1, 0x13DF,
+    0x1, 0x13E0, 0x1, 0x13E1, 0x1, 0x13E2, 0x1, 0x13E3, 0x1, 0x13E4, 0x1,
+    0x13E5, 0x1, 0x13E6, 0x1, 0x13E7, 0x1, 0x13E8, 0x1, 0x13E9, 0x1, 0x13EA,
+    0x1, 0x13EB, 0x1, 0x13EC, 0x1, 0x13ED, 0x1, 0x13EE, 0x1, 0x13EF, 0x1,
+    0x8C48, 0x1, 0x66F4, 0x1, 0x8CC8, 0x1, 0x6ED1, 0x1, 0x4E32, 0x1, 0x53E5,
+    0x1, 0x5951, 0x1, 0x5587, 0x1, 0x5948, 0x1, 0x61F6, 0x1, 0x7669, 0x1,
+    0x7F85, 0x1, 0x863F, 0x1, 0x87BA, 0x1, 0x88F8, 0x1, 0x908F, 0x1, 0x6A02,
+    0x1, 0x6D1B, 0x1, 0x70D9, 0x1, 0x73DE, 0x1, 0x843D, 0x1, 0x916A, 0x1,
+    0x99F1, 0x1, 0x4E82, 0x1, 0x5375, 0x1, 0x6B04, 0x1, 0x721B, 0x1, 0x862D,
+    0x1, 0x9E1E, 0x1, 0x5D50, 0x1, 0x6FEB, 0x1, 0x85CD, 0x1, 0x8964, 0x1,
+    0x62C9, 0x1, 0x81D8, 0x1, 0x881F, 0x1, 0x5ECA, 0x1, 0x6717, 0x1, 0x6D6A,
+    0x1, 0x72FC, 0x1, 0x90CE, 0x1, 0x4F86, 0x1, 0x51B7, 0x1, 0x52DE, 0x1,
+    0x64C4, 0x1, 0x6AD3, 0x1, 0x7210, 0x1, 0x76E7, 0x1, 0x8606, 0x1, 0x865C,
+    0x1, 0x8DEF, 0x1, 0x9732, 0x1, 0x9B6F, 0x1, 0x9DFA, 0x1, 0x788C, 0x1,
+    0x797F, 0x1, 0x7DA0, 0x1, 0x83C9, 0x1, 0x9304, 0x1, 0x8AD6, 0x1, 0x58DF,
+    0x1, 0x5F04, 0x1, 0x7C60, 0x1, 0x807E, 0x1, 0x7262, 0x1, 0x78CA, 0x1,
+    0x8CC2, 0x1, 0x96F7, 0x1, 0x58D8, 0x1, 0x5C62, 0x1, 0x6A13, 0x1, 0x6DDA,
+    0x1, 0x6F0F, 0x1, 0x7D2F, 0x1, 0x7E37, 0x1, 0x964B, 0x1, 0x52D2, 0x1,
+    0x808B, 0x1, 0x51DC, 0x1, 0x51CC, 0x1, 0x7A1C, 0x1, 0x7DBE, 0x1, 0x83F1,
+    0x1, 0x9675, 0x1, 0x8B80, 0x1, 0x62CF, 0x1, 0x8AFE, 0x1, 0x4E39, 0x1,
+    0x5BE7, 0x1, 0x6012, 0x1, 0x7387, 0x1, 0x7570, 0x1, 0x5317, 0x1, 0x78FB,
+    0x1, 0x4FBF, 0x1, 0x5FA9, 0x1, 0x4E0D, 0x1, 0x6CCC, 0x1, 0x6578, 0x1,
+    0x7D22, 0x1, 0x53C3, 0x1, 0x585E, 0x1, 0x7701, 0x1, 0x8449, 0x1, 0x8AAA,
+    0x1, 0x6BBA, 0x1, 0x6C88, 0x1, 0x62FE, 0x1, 0x82E5, 0x1, 0x63A0, 0x1,
+    0x7565, 0x1, 0x4EAE, 0x1, 0x5169, 0x1, 0x51C9, 0x1, 0x6881, 0x1, 0x7CE7,
+    0x1, 0x826F, 0x1, 0x8AD2, 0x1, 0x91CF, 0x1, 0x52F5, 0x1, 0x5442, 0x1,
+    0x5EEC, 0x1, 0x65C5, 0x1, 0x6FFE, 0x1, 0x792A, 0x1, 0x95AD, 0x1, 0x9A6A,
+    0x1, 0x9E97, 0x1, 0x9ECE, 0x1, 0x66C6, 0x1, 0x6B77, 0x1, 0x8F62, 0x1,
+    0x5E74, 0x1, 0x6190, 0x1, 0x6200, 0x1, 0x649A, 0x1, 0x6F23, 0x1, 0x7149,
+    0x1, 0x7489, 0x1, 0x79CA, 0x1, 0x7DF4, 0x1, 0x806F, 0x1, 0x8F26, 0x1,
+    0x84EE, 0x1, 0x9023, 0x1, 0x934A, 0x1, 0x5217, 0x1, 0x52A3, 0x1, 0x54BD,
+    0x1, 0x70C8, 0x1, 0x88C2, 0x1, 0x5EC9, 0x1, 0x5FF5, 0x1, 0x637B, 0x1,
+    0x6BAE, 0x1, 0x7C3E, 0x1, 0x7375, 0x1, 0x4EE4, 0x1, 0x56F9, 0x1, 0x5DBA,
+    0x1, 0x601C, 0x1, 0x73B2, 0x1, 0x7469, 0x1, 0x7F9A, 0x1, 0x8046, 0x1,
+    0x9234, 0x1, 0x96F6, 0x1, 0x9748, 0x1, 0x9818, 0x1, 0x4F8B, 0x1, 0x79AE,
+    0x1, 0x91B4, 0x1, 0x96B8, 0x1, 0x60E1, 0x1, 0x4E86, 0x1, 0x50DA, 0x1,
+    0x5BEE, 0x1, 0x5C3F, 0x1, 0x6599, 0x1, 0x71CE, 0x1, 0x7642, 0x1, 0x84FC,
+    0x1, 0x907C, 0x1, 0x6688, 0x1, 0x962E, 0x1, 0x5289, 0x1, 0x677B, 0x1,
+    0x67F3, 0x1, 0x6D41, 0x1, 0x6E9C, 0x1, 0x7409, 0x1, 0x7559, 0x1, 0x786B,
+    0x1, 0x7D10, 0x1, 0x985E, 0x1, 0x622E, 0x1, 0x9678, 0x1, 0x502B, 0x1,
+    0x5D19, 0x1, 0x6DEA, 0x1, 0x8F2A, 0x1, 0x5F8B, 0x1, 0x6144, 0x1, 0x6817,
+    0x1, 0x9686, 0x1, 0x5229, 0x1, 0x540F, 0x1, 0x5C65, 0x1, 0x6613, 0x1,
+    0x674E, 0x1, 0x68A8, 0x1, 0x6CE5, 0x1, 0x7406, 0x1, 0x75E2, 0x1, 0x7F79,
+    0x1, 0x88CF, 0x1, 0x88E1, 0x1, 0x96E2, 0x1, 0x533F, 0x1, 0x6EBA, 0x1,
+    0x541D, 0x1, 0x71D0, 0x1, 0x7498, 0x1, 0x85FA, 0x1, 0x96A3, 0x1, 0x9C57,
+    0x1, 0x9E9F, 0x1, 0x6797, 0x1, 0x6DCB, 0x1, 0x81E8, 0x1, 0x7B20, 0x1,
+    0x7C92, 0x1, 0x72C0, 0x1, 0x7099, 0x1, 0x8B58, 0x1, 0x4EC0, 0x1, 0x8336,
+    0x1, 0x523A, 0x1, 0x5207, 0x1, 0x5EA6, 0x1, 0x62D3, 0x1, 0x7CD6, 0x1,
+    0x5B85, 0x1, 0x6D1E, 0x1, 0x66B4, 0x1, 0x8F3B, 0x1, 0x964D, 0x1, 0x5ED3,
+    0x1, 0x5140, 0x1, 0x55C0, 0x1, 0x585A, 0x1, 0x6674, 0x1, 0x51DE, 0x1,
+    0x732A, 0x1, 0x76CA, 0x1, 0x793C, 0x1, 0x795E, 0x1, 0x7965, 0x1, 0x798F,
+    0x1, 0x9756, 0x1, 0x7CBE, 0x1, 0x8612, 0x1, 0x8AF8, 0x1, 0x9038, 0x1,
+    0x90FD, 0x1, 0x98EF, 0x1, 0x98FC, 0x1, 0x9928, 0x1, 0x9DB4, 0x1, 0x90DE,
+    0x1, 0x96B7, 0x1, 0x4FAE, 0x1, 0x50E7, 0x1, 0x514D, 0x1, 0x52C9, 0x1,
+    0x52E4, 0x1, 0x5351, 0x1, 0x559D, 0x1, 0x5606, 0x1, 0x5668, 0x1, 0x5840,
+    0x1, 0x58A8, 0x1, 0x5C64, 0x1, 0x6094, 0x1, 0x6168, 0x1, 0x618E, 0x1,
+    0x61F2, 0x1, 0x654F, 0x1, 0x65E2, 0x1, 0x6691, 0x1, 0x6885, 0x1, 0x6D77,
+    0x1, 0x6E1A, 0x1, 0x6F22, 0x1, 0x716E, 0x1, 0x722B, 0x1, 0x7422, 0x1,
+    0x7891, 0x1, 0x7949, 0x1, 0x7948, 0x1, 0x7950, 0x1, 0x7956, 0x1, 0x798D,
+    0x1, 0x798E, 0x1, 0x7A40, 0x1, 0x7A81, 0x1, 0x7BC0, 0x1, 0x7E09, 0x1,
+    0x7E41, 0x1, 0x7F72, 0x1, 0x8005, 0x1, 0x81ED, 0x1, 0x8279, 0x1, 0x8457,
+    0x1, 0x8910, 0x1, 0x8996, 0x1, 0x8B01, 0x1, 0x8B39, 0x1, 0x8CD3, 0x1,
+    0x8D08, 0x1, 0x8FB6, 0x1, 0x96E3, 0x1, 0x97FF, 0x1, 0x983B, 0x1, 0x6075,
+    0x1, 0x242EE, 0x1, 0x8218, 0x1, 0x4E26, 0x1, 0x51B5, 0x1, 0x5168, 0x1,
+    0x4F80, 0x1, 0x5145, 0x1, 0x5180, 0x1, 0x52C7, 0x1, 0x52FA, 0x1, 0x5555,
+    0x1, 0x5599, 0x1, 0x55E2, 0x1, 0x58B3, 0x1, 0x5944, 0x1, 0x5954, 0x1,
+    0x5A62, 0x1, 0x5B28, 0x1, 0x5ED2, 0x1, 0x5ED9, 0x1, 0x5F69, 0x1, 0x5FAD,
+    0x1, 0x60D8, 0x1, 0x614E, 0x1, 0x6108, 0x1, 0x6160, 0x1, 0x6234, 0x1,
+    0x63C4, 0x1, 0x641C, 0x1, 0x6452, 0x1, 0x6556, 0x1, 0x671B, 0x1, 0x6756,
+    0x1, 0x6EDB, 0x1, 0x6ECB, 0x1, 0x701E, 0x1, 0x77A7, 0x1, 0x7235, 0x1,
+    0x72AF, 0x1, 0x7471, 0x1, 0x7506, 0x1, 0x753B, 0x1, 0x761D, 0x1, 0x761F,
+    0x1, 0x76DB, 0x1, 0x76F4, 0x1, 0x774A, 0x1, 0x7740, 0x1, 0x78CC, 0x1,
+    0x7AB1, 0x1, 0x7C7B, 0x1, 0x7D5B, 0x1, 0x7F3E, 0x1, 0x8352, 0x1, 0x83EF,
+    0x1, 0x8779, 0x1, 0x8941, 0x1, 0x8986, 0x1, 0x8ABF, 0x1, 0x8ACB, 0x1,
+    0x8AED, 0x1, 0x8B8A, 0x1, 0x8F38, 0x1, 0x9072, 0x1, 0x9199, 0x1, 0x9276,
+    0x1, 0x967C, 0x1, 0x97DB, 0x1, 0x980B, 0x1, 0x9B12, 0x1, 0x2284A, 0x1,
+    0x22844, 0x1, 0x233D5, 0x1, 0x3B9D, 0x1, 0x4018, 0x1, 0x4039, 0x1, 0x25249,
+    0x1, 0x25CD0, 0x1, 0x27ED3, 0x1, 0x9F43, 0x1, 0x9F8E, 0x2, 0x66, 0x66, 0x2,
+    0x66, 0x69, 0x2, 0x66, 0x6C, 0x3, 0x66, 0x66, 0x69, 0x3, 0x66, 0x66, 0x6C,
+    0x2, 0x73, 0x74, 0x2, 0x574, 0x576, 0x2, 0x574, 0x565, 0x2, 0x574, 0x56B,
+    0x2, 0x57E, 0x576, 0x2, 0x574, 0x56D, 0x2, 0x5D9, 0x5B4, 0x2, 0x5F2, 0x5B7,
+    0x1, 0x5E2, 0x1, 0x5D4, 0x1, 0x5DB, 0x1, 0x5DC, 0x1, 0x5DD, 0x1, 0x5E8, 0x1,
+    0x5EA, 0x2, 0x5E9, 0x5C1, 0x2, 0x5E9, 0x5C2, 0x3, 0x5E9, 0x5BC, 0x5C1, 0x3,
+    0x5E9, 0x5BC, 0x5C2, 0x2, 0x5D0, 0x5B7, 0x2, 0x5D0, 0x5B8, 0x2, 0x5D0,
+    0x5BC, 0x2, 0x5D1, 0x5BC, 0x2, 0x5D2, 0x5BC, 0x2, 0x5D3, 0x5BC, 0x2, 0x5D4,
+    0x5BC, 0x2, 0x5D5, 0x5BC, 0x2, 0x5D6, 0x5BC, 0x2, 0x5D8, 0x5BC, 0x2, 0x5D9,
+    0x5BC, 0x2, 0x5DA, 0x5BC, 0x2, 0x5DB, 0x5BC, 0x2, 0x5DC, 0x5BC, 0x2, 0x5DE,
+    0x5BC, 0x2, 0x5E0, 0x5BC, 0x2, 0x5E1, 0x5BC, 0x2, 0x5E3, 0x5BC, 0x2, 0x5E4,
+    0x5BC, 0x2, 0x5E6, 0x5BC, 0x2, 0x5E7, 0x5BC, 0x2, 0x5E8, 0x5BC, 0x2, 0x5E9,
+    0x5BC, 0x2, 0x5EA, 0x5BC, 0x2, 0x5D5, 0x5B9, 0x2, 0x5D1, 0x5BF, 0x2, 0x5DB,
+    0x5BF, 0x2, 0x5E4, 0x5BF, 0x2, 0x5D0, 0x5DC, 0x1, 0x671, 0x1, 0x67B, 0x1,
+    0x67E, 0x1, 0x680, 0x1, 0x67A, 0x1, 0x67F, 0x1, 0x679, 0x1, 0x6A4, 0x1,
+    0x6A6, 0x1, 0x684, 0x1, 0x683, 0x1, 0x686, 0x1, 0x687, 0x1, 0x68D, 0x1,
+    0x68C, 0x1, 0x68E, 0x1, 0x688, 0x1, 0x698, 0x1, 0x691, 0x1, 0x6A9, 0x1,
+    0x6AF, 0x1, 0x6B3, 0x1, 0x6B1, 0x1, 0x6BA, 0x1, 0x6BB, 0x1, 0x6C0, 0x1,
+    0x6C1, 0x1, 0x6BE, 0x1, 0x6D2, 0x1, 0x6D3, 0x1, 0x6AD, 0x1, 0x6C7, 0x1,
+    0x6C6, 0x1, 0x6C8, 0x1, 0x6CB, 0x1, 0x6C5, 0x1, 0x6C9, 0x1, 0x6D0, 0x1,
+    0x649, 0x2, 0x626, 0x627, 0x2, 0x626, 0x6D5, 0x2, 0x626, 0x648, 0x2, 0x626,
+    0x6C7, 0x2, 0x626, 0x6C6, 0x2, 0x626, 0x6C8, 0x2, 0x626, 0x6D0, 0x2, 0x626,
+    0x649, 0x1, 0x6CC, 0x2, 0x626, 0x62C, 0x2, 0x626, 0x62D, 0x2, 0x626, 0x645,
+    0x2, 0x626, 0x64A, 0x2, 0x628, 0x62C, 0x2, 0x628, 0x62D, 0x2, 0x628, 0x62E,
+    0x2, 0x628, 0x645, 0x2, 0x628, 0x649, 0x2, 0x628, 0x64A, 0x2, 0x62A, 0x62C,
+    0x2, 0x62A, 0x62D, 0x2, 0x62A, 0x62E, 0x2, 0x62A, 0x645, 0x2, 0x62A, 0x649,
+    0x2, 0x62A, 0x64A, 0x2, 0x62B, 0x62C, 0x2, 0x62B, 0x645, 0x2, 0x62B, 0x649,
+    0x2, 0x62B, 0x64A, 0x2, 0x62C, 0x62D, 0x2, 0x62C, 0x645, 0x2, 0x62D, 0x62C,
+    0x2, 0x62D, 0x645, 0x2, 0x62E, 0x62C, 0x2, 0x62E, 0x62D, 0x2, 0x62E, 0x645,
+    0x2, 0x633, 0x62C, 0x2, 0x633, 0x62D, 0x2, 0x633, 0x62E, 0x2, 0x633, 0x645,
+    0x2, 0x635, 0x62D, 0x2, 0x635, 0x645, 0x2, 0x636, 0x62C, 0x2, 0x636, 0x62D,
+    0x2, 0x636, 0x62E, 0x2, 0x636, 0x645, 0x2, 0x637, 0x62D, 0x2, 0x637, 0x645,
+    0x2, 0x638, 0x645, 0x2, 0x639, 0x62C, 0x2, 0x639, 0x645, 0x2, 0x63A, 0x62C,
+    0x2, 0x63A, 0x645, 0x2, 0x641, 0x62C, 0x2, 0x641, 0x62D, 0x2, 0x641, 0x62E,
+    0x2, 0x641, 0x645, 0x2, 0x641, 0x649, 0x2, 0x641, 0x64A, 0x2, 0x642, 0x62D,
+    0x2, 0x642, 0x645, 0x2, 0x642, 0x649, 0x2, 0x642, 0x64A, 0x2, 0x643, 0x627,
+    0x2, 0x643, 0x62C, 0x2, 0x643, 0x62D, 0x2, 0x643, 0x62E, 0x2, 0x643, 0x644,
+    0x2, 0x643, 0x645, 0x2, 0x643, 0x649, 0x2, 0x643, 0x64A, 0x2, 0x644, 0x62C,
+    0x2, 0x644, 0x62D, 0x2, 0x644, 0x62E, 0x2, 0x644, 0x645, 0x2, 0x644, 0x649,
+    0x2, 0x644, 0x64A, 0x2, 0x645, 0x62C, 0x2, 0x645, 0x62D, 0x2, 0x645, 0x62E,
+    0x2, 0x645, 0x645, 0x2, 0x645, 0x649, 0x2, 0x645, 0x64A, 0x2, 0x646, 0x62C,
+    0x2, 0x646, 0x62D, 0x2, 0x646, 0x62E, 0x2, 0x646, 0x645, 0x2, 0x646, 0x649,
+    0x2, 0x646, 0x64A, 0x2, 0x647, 0x62C, 0x2, 0x647, 0x645, 0x2, 0x647, 0x649,
+    0x2, 0x647, 0x64A, 0x2, 0x64A, 0x62C, 0x2, 0x64A, 0x62D, 0x2, 0x64A, 0x62E,
+    0x2, 0x64A, 0x645, 0x2, 0x64A, 0x649, 0x2, 0x64A, 0x64A, 0x2, 0x630, 0x670,
+    0x2, 0x631, 0x670, 0x2, 0x649, 0x670, 0x3, 0x20, 0x64C, 0x651, 0x3, 0x20,
+    0x64D, 0x651, 0x3, 0x20, 0x64E, 0x651, 0x3, 0x20, 0x64F, 0x651, 0x3, 0x20,
+    0x650, 0x651, 0x3, 0x20, 0x651, 0x670, 0x2, 0x626, 0x631, 0x2, 0x626, 0x632,
+    0x2, 0x626, 0x646, 0x2, 0x628, 0x631, 0x2, 0x628, 0x632, 0x2, 0x628, 0x646,
+    0x2, 0x62A, 0x631, 0x2, 0x62A, 0x632, 0x2, 0x62A, 0x646, 0x2, 0x62B, 0x631,
+    0x2, 0x62B, 0x632, 0x2, 0x62B, 0x646, 0x2, 0x645, 0x627, 0x2, 0x646, 0x631,
+    0x2, 0x646, 0x632, 0x2, 0x646, 0x646, 0x2, 0x64A, 0x631, 0x2, 0x64A, 0x632,
+    0x2, 0x64A, 0x646, 0x2, 0x626, 0x62E, 0x2, 0x626, 0x647, 0x2, 0x628, 0x647,
+    0x2, 0x62A, 0x647, 0x2, 0x635, 0x62E, 0x2, 0x644, 0x647, 0x2, 0x646, 0x647,
+    0x2, 0x647, 0x670, 0x2, 0x64A, 0x647, 0x2, 0x62B, 0x647, 0x2, 0x633, 0x647,
+    0x2, 0x634, 0x645, 0x2, 0x634, 0x647, 0x3, 0x640, 0x64E, 0x651, 0x3, 0x640,
+    0x64F, 0x651, 0x3, 0x640, 0x650, 0x651, 0x2, 0x637, 0x649, 0x2, 0x637,
+    0x64A, 0x2, 0x639, 0x649, 0x2, 0x639, 0x64A, 0x2, 0x63A, 0x649, 0x2, 0x63A,
+    0x64A, 0x2, 0x633, 0x649, 0x2, 0x633, 0x64A, 0x2, 0x634, 0x649, 0x2, 0x634,
+    0x64A, 0x2, 0x62D, 0x649, 0x2, 0x62D, 0x64A, 0x2, 0x62C, 0x649, 0x2, 0x62C,
+    0x64A, 0x2, 0x62E, 0x649, 0x2, 0x62E, 0x64A, 0x2, 0x635, 0x649, 0x2, 0x635,
+    0x64A, 0x2, 0x636, 0x649, 0x2, 0x636, 0x64A, 0x2, 0x634, 0x62C, 0x2, 0x634,
+    0x62D, 0x2, 0x634, 0x62E, 0x2, 0x634, 0x631, 0x2, 0x633, 0x631, 0x2, 0x635,
+    0x631, 0x2, 0x636, 0x631, 0x2, 0x627, 0x64B, 0x3, 0x62A, 0x62C, 0x645, 0x3,
+    0x62A, 0x62D, 0x62C, 0x3, 0x62A, 0x62D, 0x645, 0x3, 0x62A, 0x62E, 0x645,
+    0x3, 0x62A, 0x645, 0x62C, 0x3, 0x62A, 0x645, 0x62D, 0x3, 0x62A, 0x645,
+    0x62E, 0x3, 0x62C, 0x645, 0x62D, 0x3, 0x62D, 0x645, 0x64A, 0x3, 0x62D,
+    0x645, 0x649, 0x3, 0x633, 0x62D, 0x62C, 0x3, 0x633, 0x62C, 0x62D, 0x3,
+    0x633, 0x62C, 0x649, 0x3, 0x633, 0x645, 0x62D, 0x3, 0x633, 0x645, 0x62C,
+    0x3, 0x633, 0x645, 0x645, 0x3, 0x635, 0x62D, 0x62D, 0x3, 0x635, 0x645,
+    0x645, 0x3, 0x634, 0x62D, 0x645, 0x3, 0x634, 0x62C, 0x64A, 0x3, 0x634,
+    0x645, 0x62E, 0x3, 0x634, 0x645, 0x645, 0x3, 0x636, 0x62D, 0x649, 0x3,
+    0x636, 0x62E, 0x645, 0x3, 0x637, 0x645, 0x62D, 0x3, 0x637, 0x645, 0x645,
+    0x3, 0x637, 0x645, 0x64A, 0x3, 0x639, 0x62C, 0x645, 0x3, 0x639, 0x645,
+    0x645, 0x3, 0x639, 0x645, 0x649, 0x3, 0x63A, 0x645, 0x645, 0x3, 0x63A,
+    0x645, 0x64A, 0x3, 0x63A, 0x645, 0x649, 0x3, 0x641, 0x62E, 0x645, 0x3,
+    0x642, 0x645, 0x62D, 0x3, 0x642, 0x645, 0x645, 0x3, 0x644, 0x62D, 0x645,
+    0x3, 0x644, 0x62D, 0x64A, 0x3, 0x644, 0x62D, 0x649, 0x3, 0x644, 0x62C,
+    0x62C, 0x3, 0x644, 0x62E, 0x645, 0x3, 0x644, 0x645, 0x62D, 0x3, 0x645,
+    0x62D, 0x62C, 0x3, 0x645, 0x62D, 0x645, 0x3, 0x645, 0x62D, 0x64A, 0x3,
+    0x645, 0x62C, 0x62D, 0x3, 0x645, 0x62C, 0x645, 0x3, 0x645, 0x62E, 0x62C,
+    0x3, 0x645, 0x62E, 0x645, 0x3, 0x645, 0x62C, 0x62E, 0x3, 0x647, 0x645,
+    0x62C, 0x3, 0x647, 0x645, 0x645, 0x3, 0x646, 0x62D, 0x645, 0x3, 0x646,
+    0x62D, 0x649, 0x3, 0x646, 0x62C, 0x645, 0x3, 0x646, 0x62C, 0x649, 0x3,
+    0x646, 0x645, 0x64A, 0x3, 0x646, 0x645, 0x649, 0x3, 0x64A, 0x645, 0x645,
+    0x3, 0x628, 0x62E, 0x64A, 0x3, 0x62A, 0x62C, 0x64A, 0x3, 0x62A, 0x62C,
+    0x649, 0x3, 0x62A, 0x62E, 0x64A, 0x3, 0x62A, 0x62E, 0x649, 0x3, 0x62A,
+    0x645, 0x64A, 0x3, 0x62A, 0x645, 0x649, 0x3, 0x62C, 0x645, 0x64A, 0x3,
+    0x62C, 0x62D, 0x649, 0x3, 0x62C, 0x645, 0x649, 0x3, 0x633, 0x62E, 0x649,
+    0x3, 0x635, 0x62D, 0x64A, 0x3, 0x634, 0x62D, 0x64A, 0x3, 0x636, 0x62D,
+    0x64A, 0x3, 0x644, 0x62C, 0x64A, 0x3, 0x644, 0x645, 0x64A, 0x3, 0x64A,
+    0x62D, 0x64A, 0x3, 0x64A, 0x62C, 0x64A, 0x3, 0x64A, 0x645, 0x64A, 0x3,
+    0x645, 0x645, 0x64A, 0x3, 0x642, 0x645, 0x64A, 0x3, 0x646, 0x62D, 0x64A,
+    0x3, 0x639, 0x645, 0x64A, 0x3, 0x643, 0x645, 0x64A, 0x3, 0x646, 0x62C,
+    0x62D, 0x3, 0x645, 0x62E, 0x64A, 0x3, 0x644, 0x62C, 0x645, 0x3, 0x643,
+    0x645, 0x645, 0x3, 0x62C, 0x62D, 0x64A, 0x3, 0x62D, 0x62C, 0x64A, 0x3,
+    0x645, 0x62C, 0x64A, 0x3, 0x641, 0x645, 0x64A, 0x3, 0x628, 0x62D, 0x64A,
+    0x3, 0x633, 0x62E, 0x64A, 0x3, 0x646, 0x62C, 0x64A, 0x3, 0x635, 0x644,
+    0x6D2, 0x3, 0x642, 0x644, 0x6D2, 0x4, 0x627, 0x644, 0x644, 0x647, 0x4,
+    0x627, 0x643, 0x628, 0x631, 0x4, 0x645, 0x62D, 0x645, 0x62F, 0x4, 0x635,
+    0x644, 0x639, 0x645, 0x4, 0x631, 0x633, 0x648, 0x644, 0x4, 0x639, 0x644,
+    0x64A, 0x647, 0x4, 0x648, 0x633, 0x644, 0x645, 0x3, 0x635, 0x644, 0x649,
+    0x4, 0x631, 0x6CC, 0x627, 0x644, 0x1, 0x2C, 0x1, 0x3001, 0x1, 0x3002, 0x1,
+    0x3A, 0x1, 0x21, 0x1, 0x3F, 0x1, 0x3016, 0x1, 0x3017, 0x1, 0x2014, 0x1,
+    0x2013, 0x1, 0x5F, 0x1, 0x7B, 0x1, 0x7D, 0x1, 0x3014, 0x1, 0x3015, 0x1,
+    0x3010, 0x1, 0x3011, 0x1, 0x300A, 0x1, 0x300B, 0x1, 0x300C, 0x1, 0x300D,
+    0x1, 0x300E, 0x1, 0x300F, 0x1, 0x5B, 0x1, 0x5D, 0x1, 0x23, 0x1, 0x26, 0x1,
+    0x2A, 0x1, 0x2D, 0x1, 0x3C, 0x1, 0x3E, 0x1, 0x5C, 0x1, 0x24, 0x1, 0x25, 0x1,
+    0x40, 0x2, 0x20, 0x64B, 0x2, 0x640, 0x64B, 0x2, 0x20, 0x64C, 0x2, 0x20,
+    0x64D, 0x2, 0x20, 0x64E, 0x2, 0x640, 0x64E, 0x2, 0x20, 0x64F, 0x2, 0x640,
+    0x64F, 0x2, 0x20, 0x650, 0x2, 0x640, 0x650, 0x2, 0x20, 0x651, 0x2, 0x640,
+    0x651, 0x2, 0x20, 0x652, 0x2, 0x640, 0x652, 0x1, 0x621, 0x1, 0x622, 0x1,
+    0x623, 0x1, 0x624, 0x1, 0x625, 0x1, 0x626, 0x1, 0x627, 0x1, 0x628, 0x1,
+    0x629, 0x1, 0x62A, 0x1, 0x62B, 0x1, 0x62C, 0x1, 0x62D, 0x1, 0x62E, 0x1,
+    0x62F, 0x1, 0x630, 0x1, 0x631, 0x1, 0x632, 0x1, 0x633, 0x1, 0x634, 0x1,
+    0x635, 0x1, 0x636, 0x1, 0x637, 0x1, 0x638, 0x1, 0x639, 0x1, 0x63A, 0x1,
+    0x641, 0x1, 0x642, 0x1, 0x643, 0x1, 0x644, 0x1, 0x645, 0x1, 0x646, 0x1,
+    0x647, 0x1, 0x648, 0x1, 0x64A, 0x2, 0x644, 0x622, 0x2, 0x644, 0x623, 0x2,
+    0x644, 0x625, 0x2, 0x644, 0x627, 0x1, 0x22, 0x1, 0x27, 0x1, 0x2F, 0x1,
+    0xFF41, 0x1, 0xFF42, 0x1, 0xFF43, 0x1, 0xFF44, 0x1, 0xFF45, 0x1, 0xFF46,
+    0x1, 0xFF47, 0x1, 0xFF48, 0x1, 0xFF49, 0x1, 0xFF4A, 0x1, 0xFF4B, 0x1,
+    0xFF4C, 0x1, 0xFF4D, 0x1, 0xFF4E, 0x1, 0xFF4F, 0x1, 0xFF50, 0x1, 0xFF51,
+    0x1, 0xFF52, 0x1, 0xFF53, 0x1, 0xFF54, 0x1, 0xFF55, 0x1, 0xFF56, 0x1,
+    0xFF57, 0x1, 0xFF58, 0x1, 0xFF59, 0x1, 0xFF5A, 0x1, 0x5E, 0x1, 0x7C, 0x1,
+    0x7E, 0x1, 0x2985, 0x1, 0x2986, 0x1, 0x30FB, 0x1, 0x30A1, 0x1, 0x30A3, 0x1,
+    0x30A5, 0x1, 0x30A7, 0x1, 0x30A9, 0x1, 0x30E3, 0x1, 0x30E5, 0x1, 0x30E7,
+    0x1, 0x30C3, 0x1, 0x30FC, 0x1, 0x30F3, 0x1, 0x3099, 0x1, 0x309A, 0x1, 0xA2,
+    0x1, 0xA3, 0x1, 0xAC, 0x1, 0xA6, 0x1, 0xA5, 0x1, 0x20A9, 0x1, 0x2502, 0x1,
+    0x2190, 0x1, 0x2191, 0x1, 0x2192, 0x1, 0x2193, 0x1, 0x25A0, 0x1, 0x25CB,
+    0x1, 0x10428, 0x1, 0x10429, 0x1, 0x1042A, 0x1, 0x1042B, 0x1, 0x1042C, 0x1,
+    0x1042D, 0x1, 0x1042E, 0x1, 0x1042F, 0x1, 0x10430, 0x1, 0x10431, 0x1,
+    0x10432, 0x1, 0x10433, 0x1, 0x10434, 0x1, 0x10435, 0x1, 0x10436, 0x1,
+    0x10437, 0x1, 0x10438, 0x1, 0x10439, 0x1, 0x1043A, 0x1, 0x1043B, 0x1,
+    0x1043C, 0x1, 0x1043D, 0x1, 0x1043E, 0x1, 0x1043F, 0x1, 0x10440, 0x1,
+    0x10441, 0x1, 0x10442, 0x1, 0x10443, 0x1, 0x10444, 0x1, 0x10445, 0x1,
+    0x10446, 0x1, 0x10447, 0x1, 0x10448, 0x1, 0x10449, 0x1, 0x1044A, 0x1,
+    0x1044B, 0x1, 0x1044C, 0x1, 0x1044D, 0x1, 0x1044E, 0x1, 0x1044F, 0x1,
+    0x104D8, 0x1, 0x104D9, 0x1, 0x104DA, 0x1, 0x104DB, 0x1, 0x104DC, 0x1,
+    0x104DD, 0x1, 0x104DE, 0x1, 0x104DF, 0x1, 0x104E0, 0x1, 0x104E1, 0x1,
+    0x104E2, 0x1, 0x104E3, 0x1, 0x104E4, 0x1, 0x104E5, 0x1, 0x104E6, 0x1,
+    0x104E7, 0x1, 0x104E8, 0x1, 0x104E9, 0x1, 0x104EA, 0x1, 0x104EB, 0x1,
+    0x104EC, 0x1, 0x104ED, 0x1, 0x104EE, 0x1, 0x104EF, 0x1, 0x104F0, 0x1,
+    0x104F1, 0x1, 0x104F2, 0x1, 0x104F3, 0x1, 0x104F4, 0x1, 0x104F5, 0x1,
+    0x104F6, 0x1, 0x104F7, 0x1, 0x104F8, 0x1, 0x104F9, 0x1, 0x104FA, 0x1,
+    0x104FB, 0x1, 0x10597, 0x1, 0x10598, 0x1, 0x10599, 0x1, 0x1059A, 0x1,
+    0x1059B, 0x1, 0x1059C, 0x1, 0x1059D, 0x1, 0x1059E, 0x1, 0x1059F, 0x1,
+    0x105A0, 0x1, 0x105A1, 0x1, 0x105A3, 0x1, 0x105A4, 0x1, 0x105A5, 0x1,
+    0x105A6, 0x1, 0x105A7, 0x1, 0x105A8, 0x1, 0x105A9, 0x1, 0x105AA, 0x1,
+    0x105AB, 0x1, 0x105AC, 0x1, 0x105AD, 0x1, 0x105AE, 0x1, 0x105AF, 0x1,
+    0x105B0, 0x1, 0x105B1, 0x1, 0x105B3, 0x1, 0x105B4, 0x1, 0x105B5, 0x1,
+    0x105B6, 0x1, 0x105B7, 0x1, 0x105B8, 0x1, 0x105B9, 0x1, 0x105BB, 0x1,
+    0x105BC, 0x1, 0x2D0, 0x1, 0x2D1, 0x1, 0x299, 0x1, 0x2A3, 0x1, 0xAB66, 0x1,
+    0x2A5, 0x1, 0x2A4, 0x1, 0x1D91, 0x1, 0x258, 0x1, 0x25E, 0x1, 0x2A9, 0x1,
+    0x264, 0x1, 0x262, 0x1, 0x29B, 0x1, 0x29C, 0x1, 0x267, 0x1, 0x284, 0x1,
+    0x2AA, 0x1, 0x2AB, 0x1, 0x1DF04, 0x1, 0xA78E, 0x1, 0x26E, 0x1, 0x1DF05, 0x1,
+    0x28E, 0x1, 0x1DF06, 0x1, 0x276, 0x1, 0x277, 0x1, 0x27A, 0x1, 0x1DF08, 0x1,
+    0x27E, 0x1, 0x2A8, 0x1, 0x2A6, 0x1, 0xAB67, 0x1, 0x2A7, 0x1, 0x2C71, 0x1,
+    0x28F, 0x1, 0x2A1, 0x1, 0x2A2, 0x1, 0x298, 0x1, 0x1C0, 0x1, 0x1C1, 0x1,
+    0x1C2, 0x1, 0x1DF0A, 0x1, 0x1DF1E, 0x1, 0x10CC0, 0x1, 0x10CC1, 0x1, 0x10CC2,
+    0x1, 0x10CC3, 0x1, 0x10CC4, 0x1, 0x10CC5, 0x1, 0x10CC6, 0x1, 0x10CC7, 0x1,
+    0x10CC8, 0x1, 0x10CC9, 0x1, 0x10CCA, 0x1, 0x10CCB, 0x1, 0x10CCC, 0x1,
+    0x10CCD, 0x1, 0x10CCE, 0x1, 0x10CCF, 0x1, 0x10CD0, 0x1, 0x10CD1, 0x1,
+    0x10CD2, 0x1, 0x10CD3, 0x1, 0x10CD4, 0x1, 0x10CD5, 0x1, 0x10CD6, 0x1,
+    0x10CD7, 0x1, 0x10CD8, 0x1, 0x10CD9, 0x1, 0x10CDA, 0x1, 0x10CDB, 0x1,
+    0x10CDC, 0x1, 0x10CDD, 0x1, 0x10CDE, 0x1, 0x10CDF, 0x1, 0x10CE0, 0x1,
+    0x10CE1, 0x1, 0x10CE2, 0x1, 0x10CE3, 0x1, 0x10CE4, 0x1, 0x10CE5, 0x1,
+    0x10CE6, 0x1, 0x10CE7, 0x1, 0x10CE8, 0x1, 0x10CE9, 0x1, 0x10CEA, 0x1,
+    0x10CEB, 0x1, 0x10CEC, 0x1, 0x10CED, 0x1, 0x10CEE, 0x1, 0x10CEF, 0x1,
+    0x10CF0, 0x1, 0x10CF1, 0x1, 0x10CF2, 0x2, 0x11099, 0x110BA, 0x2, 0x1109B,
+    0x110BA, 0x2, 0x110A5, 0x110BA, 0x1, 0x118C0, 0x1, 0x118C1, 0x1, 0x118C2,
+    0x1, 0x118C3, 0x1, 0x118C4, 0x1, 0x118C5, 0x1, 0x118C6, 0x1, 0x118C7, 0x1,
+    0x118C8, 0x1, 0x118C9, 0x1, 0x118CA, 0x1, 0x118CB, 0x1, 0x118CC, 0x1,
+    0x118CD, 0x1, 0x118CE, 0x1, 0x118CF, 0x1, 0x118D0, 0x1, 0x118D1, 0x1,
+    0x118D2, 0x1, 0x118D3, 0x1, 0x118D4, 0x1, 0x118D5, 0x1, 0x118D6, 0x1,
+    0x118D7, 0x1, 0x118D8, 0x1, 0x118D9, 0x1, 0x118DA, 0x1, 0x118DB, 0x1,
+    0x118DC, 0x1, 0x118DD, 0x1, 0x118DE, 0x1, 0x118DF, 0x1, 0x16E60, 0x1,
+    0x16E61, 0x1, 0x16E62, 0x1, 0x16E63, 0x1, 0x16E64, 0x1, 0x16E65, 0x1,
+    0x16E66, 0x1, 0x16E67, 0x1, 0x16E68, 0x1, 0x16E69, 0x1, 0x16E6A, 0x1,
+    0x16E6B, 0x1, 0x16E6C, 0x1, 0x16E6D, 0x1, 0x16E6E, 0x1, 0x16E6F, 0x1,
+    0x16E70, 0x1, 0x16E71, 0x1, 0x16E72, 0x1, 0x16E73, 0x1, 0x16E74, 0x1,
+    0x16E75, 0x1, 0x16E76, 0x1, 0x16E77, 0x1, 0x16E78, 0x1, 0x16E79, 0x1,
+    0x16E7A, 0x1, 0x16E7B, 0x1, 0x16E7C, 0x1, 0x16E7D, 0x1, 0x16E7E, 0x1,
+    0x16E7F, 0x2, 0x1D157, 0x1D165, 0x2, 0x1D158, 0x1D165, 0x3, 0x1D158,
+    0x1D165, 0x1D16E, 0x3, 0x1D158, 0x1D165, 0x1D16F, 0x3, 0x1D158, 0x1D165,
+    0x1D170, 0x3, 0x1D158, 0x1D165, 0x1D171, 0x3, 0x1D158, 0x1D165, 0x1D172,
+    0x2, 0x1D1B9, 0x1D165, 0x2, 0x1D1BA, 0x1D165, 0x3, 0x1D1B9, 0x1D165,
+    0x1D16E, 0x3, 0x1D1BA, 0x1D165, 0x1D16E, 0x3, 0x1D1B9, 0x1D165, 0x1D16F,
+    0x3, 0x1D1BA, 0x1D165, 0x1D16F, 0x1, 0x131, 0x1, 0x237, 0x1, 0x391, 0x1,
+    0x392, 0x1, 0x394, 0x1, 0x395, 0x1, 0x396, 0x1, 0x397, 0x1, 0x399, 0x1,
+    0x39A, 0x1, 0x39B, 0x1, 0x39C, 0x1, 0x39D, 0x1, 0x39E, 0x1, 0x39F, 0x1,
+    0x3A1, 0x1, 0x3A4, 0x1, 0x3A6, 0x1, 0x3A7, 0x1, 0x3A8, 0x1, 0x2207, 0x1,
+    0x2202, 0x1, 0x3DC, 0x1, 0x1E922, 0x1, 0x1E923, 0x1, 0x1E924, 0x1, 0x1E925,
+    0x1, 0x1E926, 0x1, 0x1E927, 0x1, 0x1E928, 0x1, 0x1E929, 0x1, 0x1E92A, 0x1,
+    0x1E92B, 0x1, 0x1E92C, 0x1, 0x1E92D, 0x1, 0x1E92E, 0x1, 0x1E92F, 0x1,
+    0x1E930, 0x1, 0x1E931, 0x1, 0x1E932, 0x1, 0x1E933, 0x1, 0x1E934, 0x1,
+    0x1E935, 0x1, 0x1E936, 0x1, 0x1E937, 0x1, 0x1E938, 0x1, 0x1E939, 0x1,
+    0x1E93A, 0x1, 0x1E93B, 0x1, 0x1E93C, 0x1, 0x1E93D, 0x1, 0x1E93E, 0x1,
+    0x1E93F, 0x1, 0x1E940, 0x1, 0x1E941, 0x1, 0x1E942, 0x1, 0x1E943, 0x1, 0x66E,
+    0x1, 0x6A1, 0x1, 0x66F, 0x2, 0x30, 0x2E, 0x2, 0x30, 0x2C, 0x2, 0x31, 0x2C,
+    0x2, 0x32, 0x2C, 0x2, 0x33, 0x2C, 0x2, 0x34, 0x2C, 0x2, 0x35, 0x2C, 0x2,
+    0x36, 0x2C, 0x2, 0x37, 0x2C, 0x2, 0x38, 0x2C, 0x2, 0x39, 0x2C, 0x3, 0x28,
+    0x41, 0x29, 0x3, 0x28, 0x42, 0x29, 0x3, 0x28, 0x43, 0x29, 0x3, 0x28, 0x44,
+    0x29, 0x3, 0x28, 0x45, 0x29, 0x3, 0x28, 0x46, 0x29, 0x3, 0x28, 0x47, 0x29,
+    0x3, 0x28, 0x48, 0x29, 0x3, 0x28, 0x49, 0x29, 0x3, 0x28, 0x4A, 0x29, 0x3,
+    0x28, 0x4B, 0x29, 0x3, 0x28, 0x4C, 0x29, 0x3, 0x28, 0x4D, 0x29, 0x3, 0x28,
+    0x4E, 0x29, 0x3, 0x28, 0x4F, 0x29, 0x3, 0x28, 0x50, 0x29, 0x3, 0x28, 0x51,
+    0x29, 0x3, 0x28, 0x52, 0x29, 0x3, 0x28, 0x53, 0x29, 0x3, 0x28, 0x54, 0x29,
+    0x3, 0x28, 0x55, 0x29, 0x3, 0x28, 0x56, 0x29, 0x3, 0x28, 0x57, 0x29, 0x3,
+    0x28, 0x58, 0x29, 0x3, 0x28, 0x59, 0x29, 0x3, 0x28, 0x5A, 0x29, 0x3, 0x3014,
+    0x53, 0x3015, 0x3, 0x3014, 0x73, 0x3015, 0x2, 0x43, 0x44, 0x2, 0x57, 0x5A,
+    0x2, 0x77, 0x7A, 0x2, 0x48, 0x56, 0x2, 0x68, 0x76, 0x2, 0x53, 0x44, 0x2,
+    0x73, 0x64, 0x2, 0x53, 0x53, 0x3, 0x50, 0x50, 0x56, 0x3, 0x70, 0x70, 0x76,
+    0x2, 0x57, 0x43, 0x2, 0x77, 0x63, 0x2, 0x4D, 0x43, 0x2, 0x6D, 0x63, 0x2,
+    0x4D, 0x44, 0x2, 0x6D, 0x64, 0x2, 0x4D, 0x52, 0x2, 0x6D, 0x72, 0x2, 0x44,
+    0x4A, 0x2, 0x64, 0x6A, 0x2, 0x307B, 0x304B, 0x2, 0x30B3, 0x30B3, 0x1,
+    0x5B57, 0x1, 0x53CC, 0x1, 0x30C7, 0x1, 0x591A, 0x1, 0x89E3, 0x1, 0x4EA4,
+    0x1, 0x6620, 0x1, 0x7121, 0x1, 0x524D, 0x1, 0x5F8C, 0x1, 0x518D, 0x1,
+    0x65B0, 0x1, 0x521D, 0x1, 0x7D42, 0x1, 0x8CA9, 0x1, 0x58F0, 0x1, 0x5439,
+    0x1, 0x6F14, 0x1, 0x6295, 0x1, 0x6355, 0x1, 0x904A, 0x1, 0x6307, 0x1,
+    0x6253, 0x1, 0x7981, 0x1, 0x7A7A, 0x1, 0x5408, 0x1, 0x6E80, 0x1, 0x7533,
+    0x1, 0x5272, 0x1, 0x55B6, 0x1, 0x914D, 0x3, 0x3014, 0x672C, 0x3015, 0x3,
+    0x3014, 0x4E09, 0x3015, 0x3, 0x3014, 0x4E8C, 0x3015, 0x3, 0x3014, 0x5B89,
+    0x3015, 0x3, 0x3014, 0x70B9, 0x3015, 0x3, 0x3014, 0x6253, 0x3015, 0x3,
+    0x3014, 0x76D7, 0x3015, 0x3, 0x3014, 0x52DD, 0x3015, 0x3, 0x3014, 0x6557,
+    0x3015, 0x1, 0x5F97, 0x1, 0x53EF, 0x1, 0x4E3D, 0x1, 0x4E38, 0x1, 0x4E41,
+    0x1, 0x20122, 0x1, 0x4F60, 0x1, 0x4FBB, 0x1, 0x5002, 0x1, 0x507A, 0x1,
+    0x5099, 0x1, 0x50CF, 0x1, 0x349E, 0x1, 0x2063A, 0x1, 0x5154, 0x1, 0x5164,
+    0x1, 0x5177, 0x1, 0x2051C, 0x1, 0x34B9, 0x1, 0x5167, 0x1, 0x2054B, 0x1,
+    0x5197, 0x1, 0x51A4, 0x1, 0x4ECC, 0x1, 0x51AC, 0x1, 0x291DF, 0x1, 0x5203,
+    0x1, 0x34DF, 0x1, 0x523B, 0x1, 0x5246, 0x1, 0x5277, 0x1, 0x3515, 0x1,
+    0x5305, 0x1, 0x5306, 0x1, 0x5349, 0x1, 0x535A, 0x1, 0x5373, 0x1, 0x537D,
+    0x1, 0x537F, 0x1, 0x20A2C, 0x1, 0x7070, 0x1, 0x53CA, 0x1, 0x53DF, 0x1,
+    0x20B63, 0x1, 0x53EB, 0x1, 0x53F1, 0x1, 0x5406, 0x1, 0x549E, 0x1, 0x5438,
+    0x1, 0x5448, 0x1, 0x5468, 0x1, 0x54A2, 0x1, 0x54F6, 0x1, 0x5510, 0x1,
+    0x5553, 0x1, 0x5563, 0x1, 0x5584, 0x1, 0x55AB, 0x1, 0x55B3, 0x1, 0x55C2,
+    0x1, 0x5716, 0x1, 0x5717, 0x1, 0x5651, 0x1, 0x5674, 0x1, 0x58EE, 0x1,
+    0x57CE, 0x1, 0x57F4, 0x1, 0x580D, 0x1, 0x578B, 0x1, 0x5832, 0x1, 0x5831,
+    0x1, 0x58AC, 0x1, 0x214E4, 0x1, 0x58F2, 0x1, 0x58F7, 0x1, 0x5906, 0x1,
+    0x5922, 0x1, 0x5962, 0x1, 0x216A8, 0x1, 0x216EA, 0x1, 0x59EC, 0x1, 0x5A1B,
+    0x1, 0x5A27, 0x1, 0x59D8, 0x1, 0x5A66, 0x1, 0x36EE, 0x1, 0x36FC, 0x1,
+    0x5B08, 0x1, 0x5B3E, 0x1, 0x219C8, 0x1, 0x5BC3, 0x1, 0x5BD8, 0x1, 0x5BF3,
+    0x1, 0x21B18, 0x1, 0x5BFF, 0x1, 0x5C06, 0x1, 0x5F53, 0x1, 0x3781, 0x1,
+    0x5C60, 0x1, 0x5CC0, 0x1, 0x5C8D, 0x1, 0x21DE4, 0x1, 0x5D43, 0x1, 0x21DE6,
+    0x1, 0x5D6E, 0x1, 0x5D6B, 0x1, 0x5D7C, 0x1, 0x5DE1, 0x1, 0x5DE2, 0x1,
+    0x382F, 0x1, 0x5DFD, 0x1, 0x5E28, 0x1, 0x5E3D, 0x1, 0x5E69, 0x1, 0x3862,
+    0x1, 0x22183, 0x1, 0x387C, 0x1, 0x5EB0, 0x1, 0x5EB3, 0x1, 0x5EB6, 0x1,
+    0x2A392, 0x1, 0x22331, 0x1, 0x8201, 0x1, 0x5F22, 0x1, 0x38C7, 0x1, 0x232B8,
+    0x1, 0x261DA, 0x1, 0x5F62, 0x1, 0x5F6B, 0x1, 0x38E3, 0x1, 0x5F9A, 0x1,
+    0x5FCD, 0x1, 0x5FD7, 0x1, 0x5FF9, 0x1, 0x6081, 0x1, 0x393A, 0x1, 0x391C,
+    0x1, 0x226D4, 0x1, 0x60C7, 0x1, 0x6148, 0x1, 0x614C, 0x1, 0x617A, 0x1,
+    0x61B2, 0x1, 0x61A4, 0x1, 0x61AF, 0x1, 0x61DE, 0x1, 0x6210, 0x1, 0x621B,
+    0x1, 0x625D, 0x1, 0x62B1, 0x1, 0x62D4, 0x1, 0x6350, 0x1, 0x22B0C, 0x1,
+    0x633D, 0x1, 0x62FC, 0x1, 0x6368, 0x1, 0x6383, 0x1, 0x63E4, 0x1, 0x22BF1,
+    0x1, 0x6422, 0x1, 0x63C5, 0x1, 0x63A9, 0x1, 0x3A2E, 0x1, 0x6469, 0x1,
+    0x647E, 0x1, 0x649D, 0x1, 0x6477, 0x1, 0x3A6C, 0x1, 0x656C, 0x1, 0x2300A,
+    0x1, 0x65E3, 0x1, 0x66F8, 0x1, 0x6649, 0x1, 0x3B19, 0x1, 0x3B08, 0x1,
+    0x3AE4, 0x1, 0x5192, 0x1, 0x5195, 0x1, 0x6700, 0x1, 0x669C, 0x1, 0x80AD,
+    0x1, 0x43D9, 0x1, 0x6721, 0x1, 0x675E, 0x1, 0x6753, 0x1, 0x233C3, 0x1,
+    0x3B49, 0x1, 0x67FA, 0x1, 0x6785, 0x1, 0x6852, 0x1, 0x2346D, 0x1, 0x688E,
+    0x1, 0x681F, 0x1, 0x6914, 0x1, 0x6942, 0x1, 0x69A3, 0x1, 0x69EA, 0x1,
+    0x6AA8, 0x1, 0x236A3, 0x1, 0x6ADB, 0x1, 0x3C18, 0x1, 0x6B21, 0x1, 0x238A7,
+    0x1, 0x6B54, 0x1, 0x3C4E, 0x1, 0x6B72, 0x1, 0x6B9F, 0x1, 0x6BBB, 0x1,
+    0x23A8D, 0x1, 0x21D0B, 0x1, 0x23AFA, 0x1, 0x6C4E, 0x1, 0x23CBC, 0x1, 0x6CBF,
+    0x1, 0x6CCD, 0x1, 0x6C67, 0x1, 0x6D16, 0x1, 0x6D3E, 0x1, 0x6D69, 0x1,
+    0x6D78, 0x1, 0x6D85, 0x1, 0x23D1E, 0x1, 0x6D34, 0x1, 0x6E2F, 0x1, 0x6E6E,
+    0x1, 0x3D33, 0x1, 0x6EC7, 0x1, 0x23ED1, 0x1, 0x6DF9, 0x1, 0x6F6E, 0x1,
+    0x23F5E, 0x1, 0x23F8E, 0x1, 0x6FC6, 0x1, 0x7039, 0x1, 0x701B, 0x1, 0x3D96,
+    0x1, 0x704A, 0x1, 0x707D, 0x1, 0x7077, 0x1, 0x70AD, 0x1, 0x20525, 0x1,
+    0x7145, 0x1, 0x24263, 0x1, 0x719C, 0x1, 0x243AB, 0x1, 0x7228, 0x1, 0x7250,
+    0x1, 0x24608, 0x1, 0x7280, 0x1, 0x7295, 0x1, 0x24735, 0x1, 0x24814, 0x1,
+    0x737A, 0x1, 0x738B, 0x1, 0x3EAC, 0x1, 0x73A5, 0x1, 0x3EB8, 0x1, 0x7447,
+    0x1, 0x745C, 0x1, 0x7485, 0x1, 0x74CA, 0x1, 0x3F1B, 0x1, 0x7524, 0x1,
+    0x24C36, 0x1, 0x753E, 0x1, 0x24C92, 0x1, 0x2219F, 0x1, 0x7610, 0x1, 0x24FA1,
+    0x1, 0x24FB8, 0x1, 0x25044, 0x1, 0x3FFC, 0x1, 0x4008, 0x1, 0x250F3, 0x1,
+    0x250F2, 0x1, 0x25119, 0x1, 0x25133, 0x1, 0x771E, 0x1, 0x771F, 0x1, 0x778B,
+    0x1, 0x4046, 0x1, 0x4096, 0x1, 0x2541D, 0x1, 0x784E, 0x1, 0x40E3, 0x1,
+    0x25626, 0x1, 0x2569A, 0x1, 0x256C5, 0x1, 0x79EB, 0x1, 0x412F, 0x1, 0x7A4A,
+    0x1, 0x7A4F, 0x1, 0x2597C, 0x1, 0x25AA7, 0x1, 0x7AEE, 0x1, 0x4202, 0x1,
+    0x25BAB, 0x1, 0x7BC6, 0x1, 0x7BC9, 0x1, 0x4227, 0x1, 0x25C80, 0x1, 0x7CD2,
+    0x1, 0x42A0, 0x1, 0x7CE8, 0x1, 0x7CE3, 0x1, 0x7D00, 0x1, 0x25F86, 0x1,
+    0x7D63, 0x1, 0x4301, 0x1, 0x7DC7, 0x1, 0x7E02, 0x1, 0x7E45, 0x1, 0x4334,
+    0x1, 0x26228, 0x1, 0x26247, 0x1, 0x4359, 0x1, 0x262D9, 0x1, 0x7F7A, 0x1,
+    0x2633E, 0x1, 0x7F95, 0x1, 0x7FFA, 0x1, 0x264DA, 0x1, 0x26523, 0x1, 0x8060,
+    0x1, 0x265A8, 0x1, 0x8070, 0x1, 0x2335F, 0x1, 0x43D5, 0x1, 0x80B2, 0x1,
+    0x8103, 0x1, 0x440B, 0x1, 0x813E, 0x1, 0x5AB5, 0x1, 0x267A7, 0x1, 0x267B5,
+    0x1, 0x23393, 0x1, 0x2339C, 0x1, 0x8204, 0x1, 0x8F9E, 0x1, 0x446B, 0x1,
+    0x8291, 0x1, 0x828B, 0x1, 0x829D, 0x1, 0x52B3, 0x1, 0x82B1, 0x1, 0x82B3,
+    0x1, 0x82BD, 0x1, 0x82E6, 0x1, 0x26B3C, 0x1, 0x831D, 0x1, 0x8363, 0x1,
+    0x83AD, 0x1, 0x8323, 0x1, 0x83BD, 0x1, 0x83E7, 0x1, 0x8353, 0x1, 0x83CA,
+    0x1, 0x83CC, 0x1, 0x83DC, 0x1, 0x26C36, 0x1, 0x26D6B, 0x1, 0x26CD5, 0x1,
+    0x452B, 0x1, 0x84F1, 0x1, 0x84F3, 0x1, 0x8516, 0x1, 0x273CA, 0x1, 0x8564,
+    0x1, 0x26F2C, 0x1, 0x455D, 0x1, 0x4561, 0x1, 0x26FB1, 0x1, 0x270D2, 0x1,
+    0x456B, 0x1, 0x8650, 0x1, 0x8667, 0x1, 0x8669, 0x1, 0x86A9, 0x1, 0x8688,
+    0x1, 0x870E, 0x1, 0x86E2, 0x1, 0x8728, 0x1, 0x876B, 0x1, 0x8786, 0x1,
+    0x45D7, 0x1, 0x87E1, 0x1, 0x8801, 0x1, 0x45F9, 0x1, 0x8860, 0x1, 0x27667,
+    0x1, 0x88D7, 0x1, 0x88DE, 0x1, 0x4635, 0x1, 0x88FA, 0x1, 0x34BB, 0x1,
+    0x278AE, 0x1, 0x27966, 0x1, 0x46BE, 0x1, 0x46C7, 0x1, 0x8AA0, 0x1, 0x27CA8,
+    0x1, 0x8CAB, 0x1, 0x8CC1, 0x1, 0x8D1B, 0x1, 0x8D77, 0x1, 0x27F2F, 0x1,
+    0x20804, 0x1, 0x8DCB, 0x1, 0x8DBC, 0x1, 0x8DF0, 0x1, 0x208DE, 0x1, 0x8ED4,
+    0x1, 0x285D2, 0x1, 0x285ED, 0x1, 0x9094, 0x1, 0x90F1, 0x1, 0x9111, 0x1,
+    0x2872E, 0x1, 0x911B, 0x1, 0x9238, 0x1, 0x92D7, 0x1, 0x92D8, 0x1, 0x927C,
+    0x1, 0x93F9, 0x1, 0x9415, 0x1, 0x28BFA, 0x1, 0x958B, 0x1, 0x4995, 0x1,
+    0x95B7, 0x1, 0x28D77, 0x1, 0x49E6, 0x1, 0x96C3, 0x1, 0x5DB2, 0x1, 0x9723,
+    0x1, 0x29145, 0x1, 0x2921A, 0x1, 0x4A6E, 0x1, 0x4A76, 0x1, 0x97E0, 0x1,
+    0x2940A, 0x1, 0x4AB2, 0x1, 0x29496, 0x1, 0x9829, 0x1, 0x295B6, 0x1, 0x98E2,
+    0x1, 0x4B33, 0x1, 0x9929, 0x1, 0x99A7, 0x1, 0x99C2, 0x1, 0x99FE, 0x1,
+    0x4BCE, 0x1, 0x29B30, 0x1, 0x9C40, 0x1, 0x9CFD, 0x1, 0x4CCE, 0x1, 0x4CED,
+    0x1, 0x9D67, 0x1, 0x2A0CE, 0x1, 0x4CF8, 0x1, 0x2A105, 0x1, 0x2A20E, 0x1,
+    0x2A291, 0x1, 0x4D56, 0x1, 0x9EFE, 0x1, 0x9F05, 0x1, 0x9F0F, 0x1, 0x9F16,
+    0x1, 0x2A600,
+};
+
+const uint64_t unicode_composition_keys[] = {
+    0x7800338, 0x7A00338, 0x7C00338, 0x8200300, 0x8200301, 0x8200302, 0x8200303,
+    0x8200304, 0x8200306, 0x8200307, 0x8200308, 0x8200309, 0x820030A, 0x820030C,
+    0x820030F, 0x8200311, 0x8200323, 0x8200325, 0x8200328, 0x8400307, 0x8400323,
+    0x8400331, 0x8600301, 0x8600302, 0x8600307, 0x860030C, 0x8600327, 0x8800307,
+    0x880030C, 0x8800323, 0x8800327, 0x880032D, 0x8800331, 0x8A00300, 0x8A00301,
+    0x8A00302, 0x8A00303, 0x8A00304, 0x8A00306, 0x8A00307, 0x8A00308, 0x8A00309,
+    0x8A0030C, 0x8A0030F, 0x8A00311, 0x8A00323, 0x8A00327, 0x8A00328, 0x8A0032D,
+    0x8A00330, 0x8C00307, 0x8E00301, 0x8E00302, 0x8E00304, 0x8E00306, 0x8E00307,
+    0x8E0030C, 0x8E00327, 0x9000302, 0x9000307, 0x9000308, 0x900030C, 0x9000323,
+    0x9000327, 0x900032E, 0x9200300, 0x9200301, 0x9200302, 0x9200303, 0x9200304,
+    0x9200306, 0x9200307, 0x9200308, 0x9200309, 0x920030C, 0x920030F, 0x9200311,
+    0x9200323, 0x9200328, 0x9200330, 0x9400302, 0x9600301, 0x960030C, 0x9600323,
+    0x9600327, 0x9600331, 0x9800301, 0x980030C, 0x9800323, 0x9800327, 0x980032D,
+    0x9800331, 0x9A00301, 0x9A00307, 0x9A00323, 0x9C00300, 0x9C00301, 0x9C00303,
+    0x9C00307, 0x9C0030C, 0x9C00323, 0x9C00327, 0x9C0032D, 0x9C00331, 0x9E00300,
+    0x9E00301, 0x9E00302, 0x9E00303, 0x9E00304, 0x9E00306, 0x9E00307, 0x9E00308,
+    0x9E00309, 0x9E0030B, 0x9E0030C, 0x9E0030F, 0x9E00311, 0x9E0031B, 0x9E00323,
+    0x9E00328, 0xA000301, 0xA000307, 0xA400301, 0xA400307, 0xA40030C, 0xA40030F,
+    0xA400311, 0xA400323, 0xA400327, 0xA400331, 0xA600301, 0xA600302, 0xA600307,
+    0xA60030C, 0xA600323, 0xA600326, 0xA600327, 0xA800307, 0xA80030C, 0xA800323,
+    0xA800326, 0xA800327, 0xA80032D, 0xA800331, 0xAA00300, 0xAA00301, 0xAA00302,
+    0xAA00303, 0xAA00304, 0xAA00306, 0xAA00308, 0xAA00309, 0xAA0030A, 0xAA0030B,
+    0xAA0030C, 0xAA0030F, 0xAA00311, 0xAA0031B, 0xAA00323, 0xAA00324, 0xAA00328,
+    0xAA0032D, 0xAA00330, 0xAC00303, 0xAC00323, 0xAE00300, 0xAE00301, 0xAE00302,
+    0xAE00307, 0xAE00308, 0xAE00323, 0xB000307, 0xB000308, 0xB200300, 0xB200301,
+    0xB200302, 0xB200303, 0xB200304, 0xB200307, 0xB200308, 0xB200309, 0xB200323,
+    0xB400301, 0xB400302, 0xB400307, 0xB40030C, 0xB400323, 0xB400331, 0xC200300,
+    0xC200301, 0xC200302, 0xC200303, 0xC200304, 0xC200306, 0xC200307, 0xC200308,
+    0xC200309, 0xC20030A, 0xC20030C, 0xC20030F, 0xC200311, 0xC200323, 0xC200325,
+    0xC200328, 0xC400307, 0xC400323, 0xC400331, 0xC600301, 0xC600302, 0xC600307,
+    0xC60030C, 0xC600327, 0xC800307, 0xC80030C, 0xC800323, 0xC800327, 0xC80032D,
+    0xC800331, 0xCA00300, 0xCA00301, 0xCA00302, 0xCA00303, 0xCA00304, 0xCA00306,
+    0xCA00307, 0xCA00308, 0xCA00309, 0xCA0030C, 0xCA0030F, 0xCA00311, 0xCA00323,
+    0xCA00327, 0xCA00328, 0xCA0032D, 0xCA00330, 0xCC00307, 0xCE00301, 0xCE00302,
+    0xCE00304, 0xCE00306, 0xCE00307, 0xCE0030C, 0xCE00327, 0xD000302, 0xD000307,
+    0xD000308, 0xD00030C, 0xD000323, 0xD000327, 0xD00032E, 0xD000331, 0xD200300,
+    0xD200301, 0xD200302, 0xD200303, 0xD200304, 0xD200306, 0xD200308, 0xD200309,
+    0xD20030C, 0xD20030F, 0xD200311, 0xD200323, 0xD200328, 0xD200330, 0xD400302,
+    0xD40030C, 0xD600301, 0xD60030C, 0xD600323, 0xD600327, 0xD600331, 0xD800301,
+    0xD80030C, 0xD800323, 0xD800327, 0xD80032D, 0xD800331, 0xDA00301, 0xDA00307,
+    0xDA00323, 0xDC00300, 0xDC00301, 0xDC00303, 0xDC00307, 0xDC0030C, 0xDC00323,
+    0xDC00327, 0xDC0032D, 0xDC00331, 0xDE00300, 0xDE00301, 0xDE00302, 0xDE00303,
+    0xDE00304, 0xDE00306, 0xDE00307, 0xDE00308, 0xDE00309, 0xDE0030B, 0xDE0030C,
+    0xDE0030F, 0xDE00311, 0xDE0031B, 0xDE00323, 0xDE00328, 0xE000301, 0xE000307,
+    0xE400301, 0xE400307, 0xE40030C, 0xE40030F, 0xE400311, 0xE400323, 0xE400327,
+    0xE400331, 0xE600301, 0xE600302, 0xE600307, 0xE60030C, 0xE600323, 0xE600326,
+    0xE600327, 0xE800307, 0xE800308, 0xE80030C, 0xE800323, 0xE800326, 0xE800327,
+    0xE80032D, 0xE800331, 0xEA00300, 0xEA00301, 0xEA00302, 0xEA00303, 0xEA00304,
+    0xEA00306, 0xEA00308, 0xEA00309, 0xEA0030A, 0xEA0030B, 0xEA0030C, 0xEA0030F,
+    0xEA00311, 0xEA0031B, 0xEA00323, 0xEA00324, 0xEA00328, 0xEA0032D, 0xEA00330,
+    0xEC00303, 0xEC00323, 0xEE00300, 0xEE00301, 0xEE00302, 0xEE00307, 0xEE00308,
+    0xEE0030A, 0xEE00323, 0xF000307, 0xF000308, 0xF200300, 0xF200301, 0xF200302,
+    0xF200303, 0xF200304, 0xF200307, 0xF200308, 0xF200309, 0xF20030A, 0xF200323,
+    0xF400301, 0xF400302, 0xF400307, 0xF40030C, 0xF400323, 0xF400331,
+    0x15000300, 0x15000301, 0x15000342, 0x18400300, 0x18400301, 0x18400303,
+    0x18400309, 0x18800304, 0x18A00301, 0x18C00301, 0x18C00304, 0x18E00301,
+    0x19400300, 0x19400301, 0x19400303, 0x19400309, 0x19E00301, 0x1A800300,
+    0x1A800301, 0x1A800303, 0x1A800309, 0x1AA00301, 0x1AA00304, 0x1AA00308,
+    0x1AC00304, 0x1B000301, 0x1B800300, 0x1B800301, 0x1B800304, 0x1B80030C,
+    0x1C400300, 0x1C400301, 0x1C400303, 0x1C400309, 0x1C800304, 0x1CA00301,
+    0x1CC00301, 0x1CC00304, 0x1CE00301, 0x1D400300, 0x1D400301, 0x1D400303,
+    0x1D400309, 0x1DE00301, 0x1E800300, 0x1E800301, 0x1E800303, 0x1E800309,
+    0x1EA00301, 0x1EA00304, 0x1EA00308, 0x1EC00304, 0x1F000301, 0x1F800300,
+    0x1F800301, 0x1F800304, 0x1F80030C, 0x20400300, 0x20400301, 0x20400303,
+    0x20400309, 0x20600300, 0x20600301, 0x20600303, 0x20600309, 0x22400300,
+    0x22400301, 0x22600300, 0x22600301, 0x29800300, 0x29800301, 0x29A00300,
+    0x29A00301, 0x2B400307, 0x2B600307, 0x2C000307, 0x2C200307, 0x2D000301,
+    0x2D200301, 0x2D400308, 0x2D600308, 0x2FE00307, 0x34000300, 0x34000301,
+    0x34000303, 0x34000309, 0x34000323, 0x34200300, 0x34200301, 0x34200303,
+    0x34200309, 0x34200323, 0x35E00300, 0x35E00301, 0x35E00303, 0x35E00309,
+    0x35E00323, 0x36000300, 0x36000301, 0x36000303, 0x36000309, 0x36000323,
+    0x36E0030C, 0x3D400304, 0x3D600304, 0x44C00304, 0x44E00304, 0x45000306,
+    0x45200306, 0x45C00304, 0x45E00304, 0x5240030C, 0x72200300, 0x72200301,
+    0x72200304, 0x72200306, 0x72200313, 0x72200314, 0x72200345, 0x72A00300,
+    0x72A00301, 0x72A00313, 0x72A00314, 0x72E00300, 0x72E00301, 0x72E00313,
+    0x72E00314, 0x72E00345, 0x73200300, 0x73200301, 0x73200304, 0x73200306,
+    0x73200308, 0x73200313, 0x73200314, 0x73E00300, 0x73E00301, 0x73E00313,
+    0x73E00314, 0x74200314, 0x74A00300, 0x74A00301, 0x74A00304, 0x74A00306,
+    0x74A00308, 0x74A00314, 0x75200300, 0x75200301, 0x75200313, 0x75200314,
+    0x75200345, 0x75800345, 0x75C00345, 0x76200300, 0x76200301, 0x76200304,
+    0x76200306, 0x76200313, 0x76200314, 0x76200342, 0x76200345, 0x76A00300,
+    0x76A00301, 0x76A00313, 0x76A00314, 0x76E00300, 0x76E00301, 0x76E00313,
+    0x76E00314, 0x76E00342, 0x76E00345, 0x77200300, 0x77200301, 0x77200304,
+    0x77200306, 0x77200308, 0x77200313, 0x77200314, 0x77200342, 0x77E00300,
+    0x77E00301, 0x77E00313, 0x77E00314, 0x78200313, 0x78200314, 0x78A00300,
+    0x78A00301, 0x78A00304, 0x78A00306, 0x78A00308, 0x78A00313, 0x78A00314,
+    0x78A00342, 0x79200300, 0x79200301, 0x79200313, 0x79200314, 0x79200342,
+    0x79200345, 0x79400300, 0x79400301, 0x79400342, 0x79600300, 0x79600301,
+    0x79600342, 0x79C00345, 0x7A400301, 0x7A400308, 0x80C00308, 0x82000306,
+    0x82000308, 0x82600301, 0x82A00300, 0x82A00306, 0x82A00308, 0x82C00306,
+    0x82C00308, 0x82E00308, 0x83000300, 0x83000304, 0x83000306, 0x83000308,
+    0x83400301, 0x83C00308, 0x84600304, 0x84600306, 0x84600308, 0x8460030B,
+    0x84E00308, 0x85600308, 0x85A00308, 0x86000306, 0x86000308, 0x86600301,
+    0x86A00300, 0x86A00306, 0x86A00308, 0x86C00306, 0x86C00308, 0x86E00308,
+    0x87000300, 0x87000304, 0x87000306, 0x87000308, 0x87400301, 0x87C00308,
+    0x88600304, 0x88600306, 0x88600308, 0x8860030B, 0x88E00308, 0x89600308,
+    0x89A00308, 0x8AC00308, 0x8E80030F, 0x8EA0030F, 0x9B000308, 0x9B200308,
+    0x9D000308, 0x9D200308, 0xC4E00653, 0xC4E00654, 0xC4E00655, 0xC9000654,
+    0xC9400654, 0xD8200654, 0xDA400654, 0xDAA00654, 0x12500093C, 0x12600093C,
+    0x12660093C, 0x138E009BE, 0x138E009D7, 0x168E00B3E, 0x168E00B56,
+    0x168E00B57, 0x172400BD7, 0x178C00BBE, 0x178C00BD7, 0x178E00BBE,
+    0x188C00C56, 0x197E00CD5, 0x198C00CC2, 0x198C00CD5, 0x198C00CD6,
+    0x199400CD5, 0x1A8C00D3E, 0x1A8C00D57, 0x1A8E00D3E, 0x1BB200DCA,
+    0x1BB200DCF, 0x1BB200DDF, 0x1BB800DCA, 0x204A0102E, 0x360A01B35,
+    0x360E01B35, 0x361201B35, 0x361601B35, 0x361A01B35, 0x362201B35,
+    0x367401B35, 0x367801B35, 0x367C01B35, 0x367E01B35, 0x368401B35,
+    0x3C6C00304, 0x3C6E00304, 0x3CB400304, 0x3CB600304, 0x3CC400307,
+    0x3CC600307, 0x3D4000302, 0x3D4000306, 0x3D4200302, 0x3D4200306,
+    0x3D7000302, 0x3D7200302, 0x3D9800302, 0x3D9A00302, 0x3E0000300,
+    0x3E0000301, 0x3E0000342, 0x3E0000345, 0x3E0200300, 0x3E0200301,
+    0x3E0200342, 0x3E0200345, 0x3E0400345, 0x3E0600345, 0x3E0800345,
+    0x3E0A00345, 0x3E0C00345, 0x3E0E00345, 0x3E1000300, 0x3E1000301,
+    0x3E1000342, 0x3E1000345, 0x3E1200300, 0x3E1200301, 0x3E1200342,
+    0x3E1200345, 0x3E1400345, 0x3E1600345, 0x3E1800345, 0x3E1A00345,
+    0x3E1C00345, 0x3E1E00345, 0x3E2000300, 0x3E2000301, 0x3E2200300,
+    0x3E2200301, 0x3E3000300, 0x3E3000301, 0x3E3200300, 0x3E3200301,
+    0x3E4000300, 0x3E4000301, 0x3E4000342, 0x3E4000345, 0x3E4200300,
+    0x3E4200301, 0x3E4200342, 0x3E4200345, 0x3E4400345, 0x3E4600345,
+    0x3E4800345, 0x3E4A00345, 0x3E4C00345, 0x3E4E00345, 0x3E5000300,
+    0x3E5000301, 0x3E5000342, 0x3E5000345, 0x3E5200300, 0x3E5200301,
+    0x3E5200342, 0x3E5200345, 0x3E5400345, 0x3E5600345, 0x3E5800345,
+    0x3E5A00345, 0x3E5C00345, 0x3E5E00345, 0x3E6000300, 0x3E6000301,
+    0x3E6000342, 0x3E6200300, 0x3E6200301, 0x3E6200342, 0x3E7000300,
+    0x3E7000301, 0x3E7000342, 0x3E7200300, 0x3E7200301, 0x3E7200342,
+    0x3E8000300, 0x3E8000301, 0x3E8200300, 0x3E8200301, 0x3E9000300,
+    0x3E9000301, 0x3E9200300, 0x3E9200301, 0x3EA000300, 0x3EA000301,
+    0x3EA000342, 0x3EA200300, 0x3EA200301, 0x3EA200342, 0x3EB200300,
+    0x3EB200301, 0x3EB200342, 0x3EC000300, 0x3EC000301, 0x3EC000342,
+    0x3EC000345, 0x3EC200300, 0x3EC200301, 0x3EC200342, 0x3EC200345,
+    0x3EC400345, 0x3EC600345, 0x3EC800345, 0x3ECA00345, 0x3ECC00345,
+    0x3ECE00345, 0x3ED000300, 0x3ED000301, 0x3ED000342, 0x3ED000345,
+    0x3ED200300, 0x3ED200301, 0x3ED200342, 0x3ED200345, 0x3ED400345,
+    0x3ED600345, 0x3ED800345, 0x3EDA00345, 0x3EDC00345, 0x3EDE00345,
+    0x3EE000345, 0x3EE800345, 0x3EF800345, 0x3F6C00345, 0x3F7E00300,
+    0x3F7E00301, 0x3F7E00342, 0x3F8C00345, 0x3FEC00345, 0x3FFC00300,
+    0x3FFC00301, 0x3FFC00342, 0x432000338, 0x432400338, 0x432800338,
+    0x43A000338, 0x43A400338, 0x43A800338, 0x440600338, 0x441000338,
+    0x441600338, 0x444600338, 0x444A00338, 0x447800338, 0x448600338,
+    0x448A00338, 0x449000338, 0x449A00338, 0x44C200338, 0x44C800338,
+    0x44CA00338, 0x44E400338, 0x44E600338, 0x44EC00338, 0x44EE00338,
+    0x44F400338, 0x44F600338, 0x44F800338, 0x44FA00338, 0x450400338,
+    0x450600338, 0x450C00338, 0x450E00338, 0x452200338, 0x452400338,
+    0x454400338, 0x455000338, 0x455200338, 0x455600338, 0x456400338,
+    0x456600338, 0x456800338, 0x456A00338, 0x608C03099, 0x609603099,
+    0x609A03099, 0x609E03099, 0x60A203099, 0x60A603099, 0x60AA03099,
+    0x60AE03099, 0x60B203099, 0x60B603099, 0x60BA03099, 0x60BE03099,
+    0x60C203099, 0x60C803099, 0x60CC03099, 0x60D003099, 0x60DE03099,
+    0x60DE0309A, 0x60E403099, 0x60E40309A, 0x60EA03099, 0x60EA0309A,
+    0x60F003099, 0x60F00309A, 0x60F603099, 0x60F60309A, 0x613A03099,
+    0x614C03099, 0x615603099, 0x615A03099, 0x615E03099, 0x616203099,
+    0x616603099, 0x616A03099, 0x616E03099, 0x617203099, 0x617603099,
+    0x617A03099, 0x617E03099, 0x618203099, 0x618803099, 0x618C03099,
+    0x619003099, 0x619E03099, 0x619E0309A, 0x61A403099, 0x61A40309A,
+    0x61AA03099, 0x61AA0309A, 0x61B003099, 0x61B00309A, 0x61B603099,
+    0x61B60309A, 0x61DE03099, 0x61E003099, 0x61E203099, 0x61E403099,
+    0x61FA03099, 0x22132110BA, 0x22136110BA, 0x2214A110BA, 0x2226211127,
+    0x2226411127, 0x2268E1133E, 0x2268E11357, 0x22972114B0, 0x22972114BA,
+    0x22972114BD, 0x22B70115AF, 0x22B72115AF, 0x2326A11930,
+};
+
+const uint32_t unicode_composites[] = {
+    0x226E, 0x2260, 0x226F, 0xC0, 0xC1, 0xC2, 0xC3, 0x100, 0x102, 0x226, 0xC4,
+    0x1EA2, 0xC5, 0x1CD, 0x200, 0x202, 0x1EA0, 0x1E00, 0x104, 0x1E02, 0x1E04,
+    0x1E06, 0x106, 0x108, 0x10A, 0x10C, 0xC7, 0x1E0A, 0x10E, 0x1E0C, 0x1E10,
+    0x1E12, 0x1E0E, 0xC8, 0xC9, 0xCA, 0x1EBC, 0x112, 0x114, 0x116, 0xCB, 0x1EBA,
+    0x11A, 0x204, 0x206, 0x1EB8, 0x228, 0x118, 0x1E18, 0x1E1A, 0x1E1E, 0x1F4,
+    0x11C, 0x1E20, 0x11E, 0x120, 0x1E6, 0x122, 0x124, 0x1E22, 0x1E26, 0x21E,
+    0x1E24, 0x1E28, 0x1E2A, 0xCC, 0xCD, 0xCE, 0x128, 0x12A, 0x12C, 0x130, 0xCF,
+    0x1EC8, 0x1CF, 0x208, 0x20A, 0x1ECA, 0x12E, 0x1E2C, 0x134, 0x1E30, 0x1E8,
+    0x1E32, 0x136, 0x1E34, 0x139, 0x13D, 0x1E36, 0x13B, 0x1E3C, 0x1E3A, 0x1E3E,
+    0x1E40, 0x1E42, 0x1F8, 0x143, 0xD1, 0x1E44, 0x147, 0x1E46, 0x145, 0x1E4A,
+    0x1E48, 0xD2, 0xD3, 0xD4, 0xD5, 0x14C, 0x14E, 0x22E, 0xD6, 0x1ECE, 0x150,
+    0x1D1, 0x20C, 0x20E, 0x1A0, 0x1ECC, 0x1EA, 0x1E54, 0x1E56, 0x154, 0x1E58,
+    0x158, 0x210, 0x212, 0x1E5A, 0x156, 0x1E5E, 0x15A, 0x15C, 0x1E60, 0x160,
+    0x1E62, 0x218, 0x15E, 0x1E6A, 0x164, 0x1E6C, 0x21A, 0x162, 0x1E70, 0x1E6E,
+    0xD9, 0xDA, 0xDB, 0x168, 0x16A, 0x16C, 0xDC, 0x1EE6, 0x16E, 0x170, 0x1D3,
+    0x214, 0x216, 0x1AF, 0x1EE4, 0x1E72, 0x172, 0x1E76, 0x1E74, 0x1E7C, 0x1E7E,
+    0x1E80, 0x1E82, 0x174, 0x1E86, 0x1E84, 0x1E88, 0x1E8A, 0x1E8C, 0x1EF2, 0xDD,
+    0x176, 0x1EF8, 0x232, 0x1E8E, 0x178, 0x1EF6, 0x1EF4, 0x179, 0x1E90, 0x17B,
+    0x17D, 0x1E92, 0x1E94, 0xE0, 0xE1, 0xE2, 0xE3, 0x101, 0x103, 0x227, 0xE4,
+    0x1EA3, 0xE5, 0x1CE, 0x201, 0x203, 0x1EA1, 0x1E01, 0x105, 0x1E03, 0x1E05,
+    0x1E07, 0x107, 0x109, 0x10B, 0x10D, 0xE7, 0x1E0B, 0x10F, 0x1E0D, 0x1E11,
+    0x1E13, 0x1E0F, 0xE8, 0xE9, 0xEA, 0x1EBD, 0x113, 0x115, 0x117, 0xEB, 0x1EBB,
+    0x11B, 0x205, 0x207, 0x1EB9, 0x229, 0x119, 0x1E19, 0x1E1B, 0x1E1F, 0x1F5,
+    0x11D, 0x1E21, 0x11F, 0x121, 0x1E7, 0x123, 0x125, 0x1E23, 0x1E27, 0x21F,
+    0x1E25, 0x1E29, 0x1E2B, 0x1E96, 0xEC, 0xED, 0xEE, 0x129, 0x12B, 0x12D, 0xEF,
+    0x1EC9, 0x1D0, 0x209, 0x20B, 0x1ECB, 0x12F, 0x1E2D, 0x135, 0x1F0, 0x1E31,
+    0x1E9, 0x1E33, 0x137, 0x1E35, 0x13A, 0x13E, 0x1E37, 0x13C, 0x1E3D, 0x1E3B,
+    0x1E3F, 0x1E41, 0x1E43, 0x1F9, 0x144, 0xF1, 0x1E45, 0x148, 0x1E47, 0x146,
+    0x1E4B, 0x1E49, 0xF2, 0xF3, 0xF4, 0xF5, 0x14D, 0x14F, 0x22F, 0xF6, 0x1ECF,
+    0x151, 0x1D2, 0x20D, 0x20F, 0x1A1, 0x1ECD, 0x1EB, 0x1E55, 0x1E57, 0x155,
+    0x1E59, 0x159, 0x211, 0x213, 0x1E5B, 0x157, 0x1E5F, 0x15B, 0x15D, 0x1E61,
+    0x161, 0x1E63, 0x219, 0x15F, 0x1E6B, 0x1E97, 0x165, 0x1E6D, 0x21B, 0x163,
+    0x1E71, 0x1E6F, 0xF9, 0xFA, 0xFB, 0x169, 0x16B, 0x16D, 0xFC, 0x1EE7, 0x16F,
+    0x171, 0x1D4, 0x215, 0x217, 0x1B0, 0x1EE5, 0x1E73, 0x173, 0x1E77, 0x1E75,
+    0x1E7D, 0x1E7F, 0x1E81, 0x1E83, 0x175, 0x1E87, 0x1E85, 0x1E98, 0x1E89,
+    0x1E8B, 0x1E8D, 0x1EF3, 0xFD, 0x177, 0x1EF9, 0x233, 0x1E8F, 0xFF, 0x1EF7,
+    0x1E99, 0x1EF5, 0x17A, 0x1E91, 0x17C, 0x17E, 0x1E93, 0x1E95, 0x1FED, 0x385,
+    0x1FC1, 0x1EA6, 0x1EA4, 0x1EAA, 0x1EA8, 0x1DE, 0x1FA, 0x1FC, 0x1E2, 0x1E08,
+    0x1EC0, 0x1EBE, 0x1EC4, 0x1EC2, 0x1E2E, 0x1ED2, 0x1ED0, 0x1ED6, 0x1ED4,
+    0x1E4C, 0x22C, 0x1E4E, 0x22A, 0x1FE, 0x1DB, 0x1D7, 0x1D5, 0x1D9, 0x1EA7,
+    0x1EA5, 0x1EAB, 0x1EA9, 0x1DF, 0x1FB, 0x1FD, 0x1E3, 0x1E09, 0x1EC1, 0x1EBF,
+    0x1EC5, 0x1EC3, 0x1E2F, 0x1ED3, 0x1ED1, 0x1ED7, 0x1ED5, 0x1E4D, 0x22D,
+    0x1E4F, 0x22B, 0x1FF, 0x1DC, 0x1D8, 0x1D6, 0x1DA, 0x1EB0, 0x1EAE, 0x1EB4,
+    0x1EB2, 0x1EB1, 0x1EAF, 0x1EB5, 0x1EB3, 0x1E14, 0x1E16, 0x1E15, 0x1E17,
+    0x1E50, 0x1E52, 0x1E51, 0x1E53, 0x1E64, 0x1E65, 0x1E66, 0x1E67, 0x1E78,
+    0x1E79, 0x1E7A, 0x1E7B, 0x1E9B, 0x1EDC, 0x1EDA, 0x1EE0, 0x1EDE, 0x1EE2,
+    0x1EDD, 0x1EDB, 0x1EE1, 0x1EDF, 0x1EE3, 0x1EEA, 0x1EE8, 0x1EEE, 0x1EEC,
+    0x1EF0, 0x1EEB, 0x1EE9, 0x1EEF, 0x1EED, 0x1EF1, 0x1EE, 0x1EC, 0x1ED, 0x1E0,
+    0x1E1, 0x1E1C, 0x1E1D, 0x230, 0x231, 0x1EF, 0x1FBA, 0x386, 0x1FB9, 0x1FB8,
+    0x1F08, 0x1F09, 0x1FBC, 0x1FC8, 0x388, 0x1F18, 0x1F19, 0x1FCA, 0x389,
+    0x1F28, 0x1F29, 0x1FCC, 0x1FDA, 0x38A, 0x1FD9, 0x1FD8, 0x3AA, 0x1F38,
+    0x1F39, 0x1FF8, 0x38C, 0x1F48, 0x1F49, 0x1FEC, 0x1FEA, 0x38E, 0x1FE9,
+    0x1FE8, 0x3AB, 0x1F59, 0x1FFA, 0x38F, 0x1F68, 0x1F69, 0x1FFC, 0x1FB4,
+    0x1FC4, 0x1F70, 0x3AC, 0x1FB1, 0x1FB0, 0x1F00, 0x1F01, 0x1FB6, 0x1FB3,
+    0x1F72, 0x3AD, 0x1F10, 0x1F11, 0x1F74, 0x3AE, 0x1F20, 0x1F21, 0x1FC6,
+    0x1FC3, 0x1F76, 0x3AF, 0x1FD1, 0x1FD0, 0x3CA, 0x1F30, 0x1F31, 0x1FD6,
+    0x1F78, 0x3CC, 0x1F40, 0x1F41, 0x1FE4, 0x1FE5, 0x1F7A, 0x3CD, 0x1FE1,
+    0x1FE0, 0x3CB, 0x1F50, 0x1F51, 0x1FE6, 0x1F7C, 0x3CE, 0x1F60, 0x1F61,
+    0x1FF6, 0x1FF3, 0x1FD2, 0x390, 0x1FD7, 0x1FE2, 0x3B0, 0x1FE7, 0x1FF4, 0x3D3,
+    0x3D4, 0x407, 0x4D0, 0x4D2, 0x403, 0x400, 0x4D6, 0x401, 0x4C1, 0x4DC, 0x4DE,
+    0x40D, 0x4E2, 0x419, 0x4E4, 0x40C, 0x4E6, 0x4EE, 0x40E, 0x4F0, 0x4F2, 0x4F4,
+    0x4F8, 0x4EC, 0x4D1, 0x4D3, 0x453, 0x450, 0x4D7, 0x451, 0x4C2, 0x4DD, 0x4DF,
+    0x45D, 0x4E3, 0x439, 0x4E5, 0x45C, 0x4E7, 0x4EF, 0x45E, 0x4F1, 0x4F3, 0x4F5,
+    0x4F9, 0x4ED, 0x457, 0x476, 0x477, 0x4DA, 0x4DB, 0x4EA, 0x4EB, 0x622, 0x623,
+    0x625, 0x624, 0x626, 0x6C2, 0x6D3, 0x6C0, 0x929, 0x931, 0x934, 0x9CB, 0x9CC,
+    0xB4B, 0xB48, 0xB4C, 0xB94, 0xBCA, 0xBCC, 0xBCB, 0xC48, 0xCC0, 0xCCA, 0xCC7,
+    0xCC8, 0xCCB, 0xD4A, 0xD4C, 0xD4B, 0xDDA, 0xDDC, 0xDDE, 0xDDD, 0x1026,
+    0x1B06, 0x1B08, 0x1B0A, 0x1B0C, 0x1B0E, 0x1B12, 0x1B3B, 0x1B3D, 0x1B40,
+    0x1B41, 0x1B43, 0x1E38, 0x1E39, 0x1E5C, 0x1E5D, 0x1E68, 0x1E69, 0x1EAC,
+    0x1EB6, 0x1EAD, 0x1EB7, 0x1EC6, 0x1EC7, 0x1ED8, 0x1ED9, 0x1F02, 0x1F04,
+    0x1F06, 0x1F80, 0x1F03, 0x1F05, 0x1F07, 0x1F81, 0x1F82, 0x1F83, 0x1F84,
+    0x1F85, 0x1F86, 0x1F87, 0x1F0A, 0x1F0C, 0x1F0E, 0x1F88, 0x1F0B, 0x1F0D,
+    0x1F0F, 0x1F89, 0x1F8A, 0x1F8B, 0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x1F12,
+    0x1F14, 0x1F13, 0x1F15, 0x1F1A, 0x1F1C, 0x1F1B, 0x1F1D, 0x1F22, 0x1F24,
+    0x1F26, 0x1F90, 0x1F23, 0x1F25, 0x1F27, 0x1F91, 0x1F92, 0x1F93, 0x1F94,
+    0x1F95, 0x1F96, 0x1F97, 0x1F2A, 0x1F2C, 0x1F2E, 0x1F98, 0x1F2B, 0x1F2D,
+    0x1F2F, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x1F32,
+    0x1F34, 0x1F36, 0x1F33, 0x1F35, 0x1F37, 0x1F3A, 0x1F3C, 0x1F3E, 0x1F3B,
+    0x1F3D, 0x1F3F, 0x1F42, 0x1F44, 0x1F43, 0x1F45, 0x1F4A, 0x1F4C, 0x1F4B,
+    0x1F4D, 0x1F52, 0x1F54, 0x1F56, 0x1F53, 0x1F55, 0x1F57, 0x1F5B, 0x1F5D,
+    0x1F5F, 0x1F62, 0x1F64, 0x1F66, 0x1FA0, 0x1F63, 0x1F65, 0x1F67, 0x1FA1,
+    0x1FA2, 0x1FA3, 0x1FA4, 0x1FA5, 0x1FA6, 0x1FA7, 0x1F6A, 0x1F6C, 0x1F6E,
+    0x1FA8, 0x1F6B, 0x1F6D, 0x1F6F, 0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD,
+    0x1FAE, 0x1FAF, 0x1FB2, 0x1FC2, 0x1FF2, 0x1FB7, 0x1FCD, 0x1FCE, 0x1FCF,
+    0x1FC7, 0x1FF7, 0x1FDD, 0x1FDE, 0x1FDF, 0x219A, 0x219B, 0x21AE, 0x21CD,
+    0x21CF, 0x21CE, 0x2204, 0x2209, 0x220C, 0x2224, 0x2226, 0x2241, 0x2244,
+    0x2247, 0x2249, 0x226D, 0x2262, 0x2270, 0x2271, 0x2274, 0x2275, 0x2278,
+    0x2279, 0x2280, 0x2281, 0x22E0, 0x22E1, 0x2284, 0x2285, 0x2288, 0x2289,
+    0x22E2, 0x22E3, 0x22AC, 0x22AD, 0x22AE, 0x22AF, 0x22EA, 0x22EB, 0x22EC,
+    0x22ED, 0x3094, 0x304C, 0x304E, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058,
+    0x305A, 0x305C, 0x305E, 0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070,
+    0x3071, 0x3073, 0x3074, 0x3076, 0x3077, 0x3079, 0x307A, 0x307C, 0x307D,
+    0x309E, 0x30F4, 0x30AC, 0x30AE, 0x30B0, 0x30B2, 0x30B4, 0x30B6, 0x30B8,
+    0x30BA, 0x30BC, 0x30BE, 0x30C0, 0x30C2, 0x30C5, 0x30C7, 0x30C9, 0x30D0,
+    0x30D1, 0x30D3, 0x30D4, 0x30D6, 0x30D7, 0x30D9, 0x30DA, 0x30DC, 0x30DD,
+    0x30F7, 0x30F8, 0x30F9, 0x30FA, 0x30FE, 0x1109A, 0x1109C, 0x110AB, 0x1112E,
+    0x1112F, 0x1134B, 0x1134C, 0x114BC, 0x114BB, 0x114BE, 0x115BA, 0x115BB,
+    0x11938,
+};
@@ -0,0 +1,424 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef HAVE_IO_URING
+#define HAVE_IO_URING 0
+#endif
+
+#if HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <linux/stat.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#include "config.h"
+#include "decompress.h"
+#include "io_utils.h"
+#include "uring_io.h"
+
+#if HAVE_IO_URING
+
+// Every file takes at most two entries per round.
+constexpr unsigned URING_IO_ENTRIES = 2 * URING_IO_BATCH;
+// Larger transfers skip the ring: one read or write moves at most this much.
+constexpr size_t URING_IO_MAX_TRANSFER = INT32_MAX;
+
+struct UringIo {
+  int fd;
+  void *ring; // submission and completion rings share one mapping
+  size_t ring_size;
+  struct io_uring_sqe *sqes;
+  size_t sqes_size;
+  _Atomic uint32_t *sq_tail;
+  uint32_t sq_mask;
+  _Atomic uint32_t *cq_head;
+  _Atomic uint32_t *cq_tail;
+  uint32_t cq_mask;
+  struct io_uring_cqe *cqes;
+  uint32_t queued; // entries filled since the last submit
+  struct statx stats[URING_IO_BATCH];
+  int fds[URING_IO_BATCH];
+  char8_t *buffers[URING_IO_BATCH]; // read slots; they only ever grow
+  size_t buffer_caps[URING_IO_BATCH];
+};
+
+static int ring_setup(unsigned entries, struct io_uring_params *params) {
+  return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int ring_enter(int fd, unsigned submit, unsigned wait) {
+  return (int)syscall(__NR_io_uring_enter, fd, submit, wait,
+                      IORING_ENTER_GETEVENTS, nullptr, 0);
+}
+
+UringIo *uring_io_create(void) {
+  struct io_uring_params params = {0};
+  int fd = ring_setup(URING_IO_ENTRIES, &params);
+  if (fd < 0)
+    return nullptr;
+  auto io = (UringIo *)calloc(1, sizeof(UringIo));
+  if (!io || !(params.features & IORING_FEAT_SINGLE_MMAP)) {
+    free(io);
+    close(fd);
+    return nullptr;
+  }
+  io->fd = fd;
+  size_t sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  size_t cq_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  io->ring_size = sq_size > cq_size ? sq_size : cq_size;
+  io->ring = mmap(nullptr, io->ring_size, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  io->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  io->sqes = (struct io_uring_sqe *)mmap(nullptr, io->sqes_size,
+                                         PROT_READ | PROT_WRITE,
+                                         MAP_SHARED | MAP_POPULATE, fd,
+                                         IORING_OFF_SQES);
+  if (io->ring == MAP_FAILED || io->sqes == MAP_FAILED) {
+    uring_io_destroy(io);
+    return nullptr;
+  }
+  auto base = (char *)io->ring;
+  io->sq_tail = (_Atomic uint32_t *)(base + params.sq_off.tail);
+  io->sq_mask = *(uint32_t *)(base + params.sq_off.ring_mask);
+  io->cq_head = (_Atomic uint32_t *)(base + params.cq_off.head);
+  io->cq_tail = (_Atomic uint32_t *)(base + params.cq_off.tail);
+  io->cq_mask = *(uint32_t *)(base + params.cq_off.ring_mask);
+  io->cqes = (struct io_uring_cqe *)(base + params.cq_off.cqes);
+  // Slot i of the ring always names entry i.
+  auto array = (uint32_t *)(base + params.sq_off.array);
+  for (uint32_t i = 0; i < params.sq_entries; ++i) {
+    array[i] = i;
+  }
+  return io;
+}
+
+void uring_io_destroy(UringIo *io) {
+  if (!io)
+    return;
+  if (io->ring && io->ring != MAP_FAILED)
+    munmap(io->ring, io->ring_size);
+  if (io->sqes && io->sqes != MAP_FAILED)
+    munmap(io->sqes, io->sqes_size);
+  for (size_t i = 0; i < URING_IO_BATCH; ++i) {
+    free(io->buffers[i]);
+  }
+  close(io->fd);
+  free(io);
+}
+
+bool uring_io_available(void) {
+  UringIo *io = uring_io_create();
+  if (!io)
+    return false;
+  constexpr unsigned probe_ops = 256;
+  auto probe = (struct io_uring_probe *)calloc(
+      1, sizeof(struct io_uring_probe) +
+             probe_ops * sizeof(struct io_uring_probe_op));
+  bool ok = probe && syscall(__NR_io_uring_register, io->fd,
+                             IORING_REGISTER_PROBE, probe, probe_ops) == 0;
+  const unsigned needed[] = {IORING_OP_OPENAT, IORING_OP_STATX,
+                             IORING_OP_READ, IORING_OP_WRITE,
+                             IORING_OP_CLOSE};
+  for (size_t i = 0; ok && i < sizeof(needed) / sizeof(needed[0]); ++i) {
+    ok = needed[i] <= probe->last_op &&
+         (probe->ops[needed[i]].flags & IO_URING_OP_SUPPORTED);
+  }
+  free(probe);
+  uring_io_destroy(io);
+  return ok;
+}
+
+static struct io_uring_sqe *next_sqe(UringIo *io, uint8_t opcode, int fd,
+                                     uint64_t user_data) {
+  uint32_t tail =
+      atomic_load_explicit(io->sq_tail, memory_order_relaxed) + io->queued++;
+  struct io_uring_sqe *sqe = &io->sqes[tail & io->sq_mask];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->fd = fd;
+  sqe->user_data = user_data;
+  return sqe;
+}
+
+// Submit the queued entries and wait for their completions; results are
+// indexed by user_data.
+static bool ring_run(UringIo *io, int32_t *results) {
+  uint32_t submit = io->queued;
+  uint32_t expected = submit;
+  io->queued = 0;
+  uint32_t tail = atomic_load_explicit(io->sq_tail, memory_order_relaxed);
+  atomic_store_explicit(io->sq_tail, tail + submit, memory_order_release);
+  uint32_t done = 0;
+  for (;;) {
+    uint32_t head = atomic_load_explicit(io->cq_head, memory_order_relaxed);
+    uint32_t ready = atomic_load_explicit(io->cq_tail, memory_order_acquire);
+    for (; head != ready; ++head, ++done) {
+      const struct io_uring_cqe *cqe = &io->cqes[head & io->cq_mask];
+      results[cqe->user_data] = cqe->res;
+    }
+    atomic_store_explicit(io->cq_head, head, memory_order_release);
+    if (submit == 0 && done >= expected)
+      return true;
+    int ret = ring_enter(io->fd, submit, done < expected ? 1 : 0);
+    if (ret < 0) {
+      if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+        continue;
+      fprintf(stderr, "io_uring submission failed: %s\n", strerror(errno));
+      return false;
+    }
+    submit -= (uint32_t)ret;
+  }
+}
+
+// Grow read slot i to hold len bytes.
+static bool reserve_slot(UringIo *io, size_t i, size_t len) {
+  if (io->buffer_caps[i] >= len)
+    return true;
+  auto next = (char8_t *)realloc(io->buffers[i], len);
+  if (!next)
+    return false;
+  io->buffers[i] = next;
+  io->buffer_caps[i] = len;
+  return true;
+}
+
+// Decompress into the thread's buffer, then copy into slot i: the other
+// files of the batch would reuse the thread's buffer before this one is
+// processed.
+static bool read_compressed(UringIo *io, size_t i, UringFile *file) {
+  FileView view;
+  if (!file_view_open(file->path, &view))
+    return false;
+  bool ok = reserve_slot(io, i, view.len);
+  if (!ok) {
+    fprintf(stderr, "Failed to allocate text buffer for: %s\n", file->path);
+  } else if (view.len > 0) {
+    memcpy(io->buffers[i], view.data, view.len);
+    file->data = io->buffers[i];
+    file->len = view.len;
+  }
+  file_view_close(&view);
+  return ok;
+}
+
+// Finish a transfer the ring left short, from offset done on.
+static bool pread_rest(int fd, char8_t *buf, size_t len, size_t done) {
+  while (done < len) {
+    ssize_t got = pread(fd, buf + done, len - done, (off_t)done);
+    if (got < 0 && errno == EINTR)
+      continue;
+    if (got <= 0)
+      return false;
+    done += (size_t)got;
+  }
+  return true;
+}
+
+static bool pwrite_rest(int fd, const char8_t *buf, size_t len, size_t done) {
+  while (done < len) {
+    ssize_t put = pwrite(fd, buf + done, len - done, (off_t)done);
+    if (put < 0 && errno == EINTR)
+      continue;
+    if (put < 0)
+      return false;
+    done += (size_t)put;
+  }
+  return true;
+}
+
+// Open every input and stat it by path in one round trip, then read each
+// one with its close linked behind the read. A short or failed read breaks
+// the link, leaving the descriptor open for the synchronous remainder; files
+// too large for one read are read synchronously from the start.
+void uring_io_read(UringIo *io, UringFile *files, size_t count) {
+  int32_t results[URING_IO_ENTRIES];
+  bool pending[URING_IO_BATCH] = {0};
+  for (size_t i = 0; i < count; ++i) {
+    UringFile *file = &files[i];
+    *file = (UringFile){.path = file->path, .data = (const char8_t *)""};
+    if (compression_from_name(file->path) != COMPRESSION_NONE) {
+      file->ok = read_compressed(io, i, file);
+      continue;
+    }
+    struct io_uring_sqe *sqe =
+        next_sqe(io, IORING_OP_OPENAT, AT_FDCWD, 2 * i);
+    sqe->addr = (uintptr_t)file->path;
+    sqe->open_flags = O_RDONLY | O_CLOEXEC;
+    sqe = next_sqe(io, IORING_OP_STATX, AT_FDCWD, 2 * i + 1);
+    sqe->addr = (uintptr_t)file->path;
+    sqe->len = STATX_TYPE | STATX_SIZE;
+    sqe->off = (uintptr_t)&io->stats[i];
+    pending[i] = true;
+  }
+  if (io->queued == 0)
+    return;
+  if (!ring_run(io, results))
+    return;
+
+  for (size_t i = 0; i < count; ++i) {
+    if (!pending[i])
+      continue;
+    UringFile *file = &files[i];
+    pending[i] = false;
+    int fd = results[2 * i];
+    if (fd < 0) {
+      fprintf(stderr, "Failed to open input file: %s\n", file->path);
+      continue;
+    }
+    const struct statx *st = &io->stats[i];
+    if (results[2 * i + 1] < 0) {
+      fprintf(stderr, "Failed to stat input file: %s\n", file->path);
+      close(fd);
+      continue;
+    }
+    if (!S_ISREG(st->stx_mode)) {
+      fprintf(stderr, "Not a regular file: %s\n", file->path);
+      close(fd);
+      continue;
+    }
+    if ((uintmax_t)st->stx_size > SIZE_MAX ||
+        !reserve_slot(io, i, (size_t)st->stx_size)) {
+      fprintf(stderr, "Failed to allocate text buffer for: %s\n", file->path);
+      close(fd);
+      continue;
+    }
+    file->len = (size_t)st->stx_size;
+    if (file->len > 0)
+      file->data = io->buffers[i];
+    if (file->len > URING_IO_MAX_TRANSFER) {
+      results[2 * i] = 0;
+      results[2 * i + 1] = -ECANCELED;
+    } else {
+      if (file->len > 0) {
+        struct io_uring_sqe *sqe = next_sqe(io, IORING_OP_READ, fd, 2 * i);
+        sqe->addr = (uintptr_t)io->buffers[i];
+        sqe->len = (uint32_t)file->len;
+        sqe->flags = IOSQE_IO_LINK;
+      } else {
+        results[2 * i] = 0;
+      }
+      next_sqe(io, IORING_OP_CLOSE, fd, 2 * i + 1);
+    }
+    io->fds[i] = fd;
+    pending[i] = true;
+  }
+  if (io->queued > 0 && !ring_run(io, results))
+    return;
+
+  for (size_t i = 0; i < count; ++i) {
+    if (!pending[i])
+      continue;
+    UringFile *file = &files[i];
+    int fd = io->fds[i];
+    bool ok = results[2 * i] >= 0 &&
+              pread_rest(fd, io->buffers[i], file->len,
+                         (size_t)results[2 * i]);
+    if (results[2 * i + 1] == -ECANCELED)
+      close(fd);
+    if (!ok) {
+      fprintf(stderr, "Failed to read full input file: %s\n", file->path);
+      continue;
+    }
+    file->ok = true;
+  }
+}
+
+// Create every output in one round trip, then write each one with its
+// close linked behind the write.
+void uring_io_write(UringIo *io, UringFile *files, size_t count) {
+  int32_t results[URING_IO_ENTRIES];
+  bool pending[URING_IO_BATCH] = {0};
+  for (size_t i = 0; i < count; ++i) {
+    UringFile *file = &files[i];
+    file->ok = false;
+    if (file->len > URING_IO_MAX_TRANSFER) {
+      file->ok = write_file_bytes(file->path, file->data, file->len);
+      continue;
+    }
+    struct io_uring_sqe *sqe = next_sqe(io, IORING_OP_OPENAT, AT_FDCWD, i);
+    sqe->addr = (uintptr_t)file->path;
+    sqe->open_flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+    sqe->len = 0666;
+    pending[i] = true;
+  }
+  if (io->queued == 0 || !ring_run(io, results))
+    return;
+
+  for (size_t i = 0; i < count; ++i) {
+    if (!pending[i])
+      continue;
+    pending[i] = false;
+    int fd = results[i];
+    if (fd < 0) {
+      fprintf(stderr, "Failed to open output file: %s\n", files[i].path);
+      continue;
+    }
+    if (files[i].len > 0) {
+      struct io_uring_sqe *sqe = next_sqe(io, IORING_OP_WRITE, fd, 2 * i);
+      sqe->addr = (uintptr_t)files[i].data;
+      sqe->len = (uint32_t)files[i].len;
+      sqe->flags = IOSQE_IO_LINK;
+    } else {
+      results[2 * i] = 0;
+    }
+    next_sqe(io, IORING_OP_CLOSE, fd, 2 * i + 1);
+    io->fds[i] = fd;
+    pending[i] = true;
+  }
+  if (io->queued == 0 || !ring_run(io, results))
+    return;
+
+  for (size_t i = 0; i < count; ++i) {
+    if (!pending[i])
+      continue;
+    UringFile *file = &files[i];
+    int fd = io->fds[i];
+    bool written = results[2 * i] >= 0 &&
+                   pwrite_rest(fd, file->data, file->len,
+                               (size_t)results[2 * i]);
+    int closed = results[2 * i + 1];
+    if (closed == -ECANCELED)
+      closed = close(fd) == 0 ? 0 : -errno;
+    if (!written) {
+      fprintf(stderr, "Failed to write full output file: %s\n", file->path);
+    } else if (closed < 0) {
+      fprintf(stderr, "Failed to close output file: %s\n", file->path);
+    } else {
+      file->ok = true;
+    }
+  }
+}
+
+#else
+
+bool uring_io_available(void) { return false; }
+
+UringIo *uring_io_create(void) { return nullptr; }
+
+void uring_io_destroy(UringIo *io) { (void)io; }
+
+// Without io_uring there is never a ring to pass in.
+void uring_io_read(UringIo *io, UringFile *files, size_t count) {
+  (void)io;
+  (void)files;
+  (void)count;
+}
+
+void uring_io_write(UringIo *io, UringFile *files, size_t count) {
+  (void)io;
+  (void)files;
+  (void)count;
+}
+
+#endif
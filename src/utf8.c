@@ -1,4 +1,10 @@
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define UTF8_X86 1
+#include <immintrin.h>
+#endif
+
 #include <stdlib.h>
+#include <threads.h>
 
 #include "utf8.h"
 
@@ -57,6 +63,189 @@ size_t utf8_decode_advance(const char8_t *bytes, size_t len,
   return advance;
 }
 
+size_t utf8_encode(uint32_t codepoint, char8_t out[4]) {
+  if (codepoint < 0x80) {
+    out[0] = (char8_t)codepoint;
+    return 1;
+  }
+  if (codepoint < 0x800) {
+    out[0] = (char8_t)(0xC0 | (codepoint >> 6));
+    out[1] = (char8_t)(0x80 | (codepoint & 0x3F));
+    return 2;
+  }
+  if (codepoint < 0x10000) {
+    out[0] = (char8_t)(0xE0 | (codepoint >> 12));
+    out[1] = (char8_t)(0x80 | ((codepoint >> 6) & 0x3F));
+    out[2] = (char8_t)(0x80 | (codepoint & 0x3F));
+    return 3;
+  }
+  out[0] = (char8_t)(0xF0 | (codepoint >> 18));
+  out[1] = (char8_t)(0x80 | ((codepoint >> 12) & 0x3F));
+  out[2] = (char8_t)(0x80 | ((codepoint >> 6) & 0x3F));
+  out[3] = (char8_t)(0x80 | (codepoint & 0x3F));
+  return 4;
+}
+
+// One code point of bytes[0, len), len > 0, into *out; returns the bytes
+// consumed.
+static inline size_t decode_step(const char8_t *bytes, size_t len,
+                                 uint32_t *out, size_t *invalid) {
+  bool invalid_codepoint = false;
+  size_t advance = utf8_decode_advance(bytes, len, out, &invalid_codepoint);
+  if (invalid_codepoint)
+    (*invalid)++;
+  return advance;
+}
+
+static size_t decode_scalar(const char8_t *input, size_t len, uint32_t *out,
+                            size_t *invalid) {
+  size_t i = 0;
+  size_t count = 0;
+  while (i < len) {
+    i += decode_step(input + i, len - i, out + count, invalid);
+    count++;
+  }
+  return count;
+}
+
+#if defined(UTF8_X86)
+// pshufb control per 8-bit keep mask over eight 16-bit lanes: the byte
+// pairs of the kept lanes in order, then zeroing lanes.
+static uint8_t compact16_shuffle[256][16];
+
+static void build_compact16_shuffle(void) {
+  for (unsigned mask = 0; mask < 256; ++mask) {
+    unsigned lane = 0;
+    for (unsigned bit = 0; bit < 8; ++bit) {
+      if (mask & (1u << bit)) {
+        compact16_shuffle[mask][2 * lane] = (uint8_t)(2 * bit);
+        compact16_shuffle[mask][2 * lane + 1] = (uint8_t)(2 * bit + 1);
+        lane++;
+      }
+    }
+    for (; lane < 8; ++lane) {
+      compact16_shuffle[mask][2 * lane] = 0x80;
+      compact16_shuffle[mask][2 * lane + 1] = 0x80;
+    }
+  }
+}
+
+// Widen 32 ASCII bytes to code points.
+__attribute__((target("avx2"))) static inline void
+expand_ascii32(__m256i v, uint32_t *out) {
+  __m128i lo = _mm256_castsi256_si128(v);
+  __m128i hi = _mm256_extracti128_si256(v, 1);
+  _mm256_storeu_si256((__m256i *)out, _mm256_cvtepu8_epi32(lo));
+  _mm256_storeu_si256((__m256i *)(out + 8),
+                      _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+  _mm256_storeu_si256((__m256i *)(out + 16), _mm256_cvtepu8_epi32(hi));
+  _mm256_storeu_si256((__m256i *)(out + 24),
+                      _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+}
+
+// Decode the 16 bytes at bytes when they are ASCII and valid two-byte
+// sequences (C2..DF plus a continuation byte), the last of which may end
+// in bytes[16]; returns the bytes consumed, or 0 when the window needs the
+// scalar decoder. Stores up to 16 code points at out + *count.
+__attribute__((target("avx2,popcnt"))) static inline size_t
+decode_two_byte16(const char8_t *bytes, uint32_t *out, size_t *count) {
+  __m128i x = _mm_loadu_si128((const __m128i *)bytes);
+  __m128i next = _mm_loadu_si128((const __m128i *)(bytes + 1));
+  __m128i is_cont = _mm_cmpeq_epi8(_mm_and_si128(x, _mm_set1_epi8(-0x40)),
+                                   _mm_set1_epi8(-0x80));
+  __m128i is_lead = _mm_andnot_si128(
+      _mm_cmpeq_epi8(_mm_and_si128(x, _mm_set1_epi8(-0x02)),
+                     _mm_set1_epi8(-0x40)), // C0 and C1 are overlong
+      _mm_cmpeq_epi8(_mm_and_si128(x, _mm_set1_epi8(-0x20)),
+                     _mm_set1_epi8(-0x40)));
+  auto ascii = (uint32_t)_mm_movemask_epi8(x) ^ 0xFFFFu;
+  auto cont = (uint32_t)_mm_movemask_epi8(is_cont);
+  auto lead = (uint32_t)_mm_movemask_epi8(is_lead);
+  uint32_t last_lead = lead >> 15;
+  if ((ascii | lead | cont) != 0xFFFFu || cont != ((lead << 1) & 0xFFFFu) ||
+      (last_lead && (bytes[16] & 0xC0) != 0x80))
+    return 0;
+
+  __m256i wide = _mm256_cvtepu8_epi16(x);
+  __m256i wide_next = _mm256_cvtepu8_epi16(next);
+  __m256i pair = _mm256_or_si256(
+      _mm256_slli_epi16(_mm256_and_si256(wide, _mm256_set1_epi16(0x1F)), 6),
+      _mm256_and_si256(wide_next, _mm256_set1_epi16(0x3F)));
+  __m256i value =
+      _mm256_blendv_epi8(wide, pair, _mm256_cvtepi8_epi16(is_lead));
+  uint32_t keep = ~cont & 0xFFFFu;
+  __m128i lo = _mm_shuffle_epi8(
+      _mm256_castsi256_si128(value),
+      _mm_loadu_si128((const __m128i *)compact16_shuffle[keep & 0xFF]));
+  __m128i hi = _mm_shuffle_epi8(
+      _mm256_extracti128_si256(value, 1),
+      _mm_loadu_si128((const __m128i *)compact16_shuffle[keep >> 8]));
+  _mm256_storeu_si256((__m256i *)(out + *count), _mm256_cvtepu16_epi32(lo));
+  *count += (size_t)__builtin_popcount(keep & 0xFF);
+  _mm256_storeu_si256((__m256i *)(out + *count), _mm256_cvtepu16_epi32(hi));
+  *count += (size_t)__builtin_popcount(keep >> 8);
+  return 16 + last_lead;
+}
+
+// ASCII runs expand 32 bytes at a time and Latin, Greek, Cyrillic and the
+// like 16 at a time; windows with longer sequences or anything invalid
+// take the scalar steps, so the output and invalid count are the scalar
+// ones. The vector steps never store past the input consumed so far plus
+// 32, which the loop bound keeps inside out[0, len).
+__attribute__((target("avx2,popcnt"))) static size_t
+decode_avx2(const char8_t *input, size_t len, uint32_t *out,
+            size_t *invalid) {
+  size_t i = 0;
+  size_t count = 0;
+  // One byte beyond the window, for a two-byte sequence ending there.
+  while (len - i > 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(input + i));
+    if (_mm256_movemask_epi8(v) == 0) {
+      expand_ascii32(v, out + count);
+      i += 32;
+      count += 32;
+      continue;
+    }
+    size_t used = decode_two_byte16(input + i, out, &count);
+    if (used != 0) {
+      i += used;
+      continue;
+    }
+    // Finish the sequence that straddles the window end as well.
+    for (size_t stop = i + 16; i < stop; count++) {
+      i += decode_step(input + i, len - i, out + count, invalid);
+    }
+  }
+  return count + decode_scalar(input + i, len - i, out + count, invalid);
+}
+#endif
+
+static Utf8DecodeKernel decode_available[2];
+static size_t decode_available_count;
+static once_flag decode_once = ONCE_FLAG_INIT;
+
+// Runtime dispatch: list what the CPU runs, widest last.
+static void select_decode_kernels(void) {
+  size_t count = 0;
+  decode_available[count++] =
+      (Utf8DecodeKernel){.name = "scalar", .decode = decode_scalar};
+#if defined(UTF8_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+    build_compact16_shuffle();
+    decode_available[count++] =
+        (Utf8DecodeKernel){.name = "avx2", .decode = decode_avx2};
+  }
+#endif
+  decode_available_count = count;
+}
+
+size_t utf8_decode_kernels(const Utf8DecodeKernel **kernels) {
+  call_once(&decode_once, select_decode_kernels);
+  *kernels = decode_available;
+  return decode_available_count;
+}
+
 [[nodiscard]] bool utf8_decode_buffer(const char8_t *input, size_t len,
                                       uint32_t **out, size_t *out_len,
                                       size_t *invalid_count) {
@@ -75,23 +264,10 @@ size_t utf8_decode_advance(const char8_t *bytes, size_t len,
   if (!buffer)
     return false;
 
-  const uint8_t *bytes = (const uint8_t *)input;
-  size_t i = 0;
-  size_t count = 0;
+  call_once(&decode_once, select_decode_kernels);
   size_t invalid = 0;
-
-  while (i < len) {
-    uint32_t codepoint = 0;
-    bool invalid_codepoint = false;
-    size_t advance =
-        utf8_decode_advance(bytes + i, len - i, &codepoint, &invalid_codepoint);
-    if (advance == 0)
-      break;
-    if (invalid_codepoint)
-      invalid++;
-    buffer[count++] = codepoint;
-    i += advance;
-  }
+  size_t count = decode_available[decode_available_count - 1].decode(
+      input, len, buffer, &invalid);
 
   *out = buffer;
   *out_len = count;
@@ -1,12 +1,11 @@
-#include <dirent.h>
 #include <errno.h>
-#include <fnmatch.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "ckdint_compat.h"
 #include "config.h"
+#include "dir_scan.h"
 #include "io_utils.h"
 #include "progress.h"
 #include "sentence_set.h"
@@ -26,8 +25,9 @@ typedef enum {
 
 static void print_verify_help(const char *prog) {
   printf("Usage:\n  %s --verify <dedup_dir> [mask] [--dedup-mode "
-         "<sentence|line|paragraph|document>] [--max-length N]\n"
+         "<sentence|line|paragraph|document>] [--max-length N] [--recursive]\n"
          "  --max-length defaults to %zu symbols (0 is unlimited)\n"
+         "  --recursive also checks files in subdirectories\n"
          "  ASM: WAVESORT_USE_ASM=%d HASH_WORKER_USE_ASM=%d "
          "RADIX_SORT_USE_ASM=%d\n"
          "  Author: %s\n"
@@ -180,10 +180,12 @@ static bool split_text_to_paragraphs(const char8_t *text, size_t len,
       pos++;
     }
     size_t line_end = pos;
-    while (pos < len &&
-           (text[pos] == (char8_t)'\n' || text[pos] == (char8_t)'\r')) {
+    // One terminator per line (\r\n counts once), so an empty line between
+    // paragraphs is seen as a blank line.
+    if (pos < len && text[pos] == (char8_t)'\r')
+      pos++;
+    if (pos < len && text[pos] == (char8_t)'\n')
       pos++;
-    }
     bool line_blank = !has_non_space(text, line_start, line_end);
     if (line_blank) {
       if (paragraph_start < line_start &&
@@ -374,6 +376,7 @@ int run_verify(const char *prog, int argc, char **argv) {
   bool mask_set = false;
   DedupMode dedup_mode = DEDUP_MODE_SENTENCE;
   size_t max_compare_len = DEFAULT_MAX_COMPARE_LENGTH;
+  bool recursive = false;
 
   for (int i = 1; i < argc; ++i) {
     const char *arg = argv[i];
@@ -381,6 +384,10 @@ int run_verify(const char *prog, int argc, char **argv) {
       print_verify_help(prog);
       return 0;
     }
+    if (strcmp(arg, "--recursive") == 0) {
+      recursive = true;
+      continue;
+    }
     if (strcmp(arg, "--max-length") == 0) {
       if (i + 1 >= argc) {
         fprintf(stderr, "Missing value for --max-length\n");
@@ -458,93 +465,41 @@ int run_verify(const char *prog, int argc, char **argv) {
   size_t bytes_processed = 0;
   size_t processed = 0;
 
-  DIR *dir = opendir(input_dir);
-  if (!dir) {
-    fprintf(stderr, "Failed to open input directory: %s\n", input_dir);
-    sentence_set_destroy(&seen);
-    return 1;
-  }
-
-  struct dirent *entry;
-  while ((entry = readdir(dir)) != nullptr) {
-    const char *name = entry->d_name;
-    if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
-      continue;
-    }
-    if (fnmatch(mask, name, 0) != 0) {
-      continue;
-    }
-
-    char *input_path = join_path(input_dir, name);
-    if (!input_path) {
-      fprintf(stderr, "Failed to allocate input path for: %s\n", name);
-      errors++;
-      continue;
-    }
-    if (!is_regular_file(input_path)) {
-      free(input_path);
-      continue;
-    }
-
-    matched++;
-    free(input_path);
-  }
-
-  closedir(dir);
-  dir = opendir(input_dir);
-  if (!dir) {
-    fprintf(stderr, "Failed to open input directory: %s\n", input_dir);
+  // One scan lists and classifies every file; matched is its length.
+  ScanListing listing;
+  if (!dir_scan_collect(input_dir, mask, recursive, &listing, &errors)) {
+    fprintf(stderr, "Failed to scan input directory: %s\n", input_dir);
     sentence_set_destroy(&seen);
     return 1;
   }
+  matched = listing.count;
 
-  while ((entry = readdir(dir)) != nullptr) {
-    const char *name = entry->d_name;
-    if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
-      continue;
-    }
-    if (fnmatch(mask, name, 0) != 0) {
-      continue;
-    }
-
-    char *input_path = join_path(input_dir, name);
-    if (!input_path) {
-      fprintf(stderr, "Failed to allocate input path for: %s\n", name);
-      errors++;
-      continue;
-    }
-    if (!is_regular_file(input_path)) {
-      free(input_path);
-      continue;
-    }
-
-    char8_t *raw_text = nullptr;
-    size_t byte_len = 0;
-    if (!read_file_bytes(input_path, &raw_text, &byte_len)) {
+  for (size_t i = 0; i < matched; ++i) {
+    const char *name = listing.entries[i].name;
+    FileView view;
+    if (!file_view_open(listing.entries[i].path, &view)) {
       errors++;
-      free(input_path);
       processed++;
       render_progress(processed, matched, bytes_processed, start_time);
       continue;
     }
 
-    sentence_set_reserve_for_bytes(&seen, byte_len);
-    if (!verify_with_mode(dedup_mode, raw_text, byte_len, max_compare_len,
+    sentence_set_reserve_for_bytes(&seen, view.len);
+    if (!verify_with_mode(dedup_mode, view.data, view.len, max_compare_len,
                           &seen, &units_checked, &duplicate_units, name)) {
       fprintf(stderr, "Failed to verify %s-level duplicates for: %s\n",
               dedup_mode_name(dedup_mode), name);
       errors++;
     }
 
-    free(raw_text);
-    free(input_path);
     files_checked++;
-    bytes_processed += byte_len;
+    bytes_processed += view.len;
+    file_view_close(&view);
     processed++;
     render_progress(processed, matched, bytes_processed, start_time);
   }
 
-  closedir(dir);
+  scan_listing_free(&listing);
   sentence_set_destroy(&seen);
 
   double elapsed = now_seconds() - start_time;
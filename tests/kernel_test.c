@@ -0,0 +1,376 @@
+// Differential test of the SIMD kernels against their scalar versions:
+// normalize_sentence (plain, hashed under every unit hash, and with the
+// --normalize steps), the unit hash families and utf8_decode_buffer. Run by
+// ctest; exits non-zero on the first kernel that disagrees.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hash_utils.h"
+#include "text_utils.h"
+#include "unicode_tables.h"
+#include "utf8.h"
+
+static constexpr size_t TEST_INPUT_BYTES = 4 * 1'024 * 1'024;
+static constexpr size_t TEST_MIN_UNIT = 16;
+static constexpr size_t TEST_MAX_UNIT = 256;
+static constexpr size_t TEST_EDGE_CASES = 200'000;
+static constexpr size_t TEST_EDGE_MAX_LEN = 200;
+static constexpr size_t TEST_HASH_EDGE_CASES = 20'000;
+static constexpr size_t TEST_HASH_EDGE_MAX_LEN = 4'096;
+
+// Synthetic corpus cut into dedup-sized units.
+typedef struct {
+  char8_t *text;
+  size_t len;
+  size_t *offsets; // unit i is text[offsets[i], offsets[i + 1])
+  size_t unit_count;
+} TestInput;
+
+static uint64_t next_random(uint64_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+// Words of Latin, Latin-1 and Cyrillic letters of either case separated
+// mostly by single spaces, with the occasional run of mixed whitespace and
+// line break.
+static void fill_text(char8_t *text, size_t len, uint64_t *rng) {
+  static const char *const separators[] = {" ",  " ",  " ",    " ",  " ",
+                                           " ",  " ",  "  ",   "\n", "\t ",
+                                           ". ", ", ", "\r\n", " \n\n "};
+  constexpr size_t separator_count =
+      sizeof(separators) / sizeof(separators[0]);
+  size_t pos = 0;
+  while (pos < len) {
+    uint64_t r = next_random(rng);
+    size_t letters = 1 + r % 10;
+    bool cyrillic = (r >> 8) % 5 == 0;
+    for (size_t i = 0; i < letters && pos < len; ++i) {
+      uint64_t letter = next_random(rng);
+      uint32_t cp = (cyrillic ? 0x400 : 0xC0) + letter % 0x60;
+      if ((cyrillic || letter % 8 == 0) && pos + 1 < len) {
+        text[pos++] = (char8_t)(0xC0 | cp >> 6);
+        text[pos++] = (char8_t)(0x80 | (cp & 0x3F));
+      } else {
+        text[pos++] = (char8_t)((letter % 4 == 0 ? 'A' : 'a') + letter % 26);
+      }
+    }
+    const char *sep = separators[(r >> 40) % separator_count];
+    for (; *sep && pos < len; ++sep) {
+      text[pos++] = (char8_t)*sep;
+    }
+  }
+}
+
+static bool make_input(size_t bytes, TestInput *input) {
+  *input = (TestInput){0};
+  size_t max_units = bytes / TEST_MIN_UNIT + 2;
+  input->text = (char8_t *)malloc(bytes);
+  input->offsets = (size_t *)malloc(max_units * sizeof(size_t));
+  if (!input->text || !input->offsets) {
+    free(input->text);
+    free(input->offsets);
+    return false;
+  }
+  uint64_t rng = 0x9E3779B97F4A7C15ull;
+  fill_text(input->text, bytes, &rng);
+  input->len = bytes;
+  size_t count = 0;
+  input->offsets[0] = 0;
+  for (size_t pos = 0; pos < bytes; count++) {
+    size_t unit = TEST_MIN_UNIT +
+                  next_random(&rng) % (TEST_MAX_UNIT - TEST_MIN_UNIT + 1);
+    pos = unit < bytes - pos ? pos + unit : bytes;
+    input->offsets[count + 1] = pos;
+  }
+  input->unit_count = count;
+  return true;
+}
+
+static void free_input(TestInput *input) {
+  free(input->text);
+  free(input->offsets);
+  *input = (TestInput){0};
+}
+
+// Whether kernel matches scalar on one input: the same output, and with
+// hashed set the same fingerprint as unit_fingerprint of it.
+static bool same_normalize(const NormalizeKernel *scalar,
+                           const NormalizeKernel *kernel, bool hashed,
+                           const char8_t *text, size_t len, size_t cap,
+                           char8_t *want, char8_t *got) {
+  size_t want_len = scalar->normalize(text, len, want, cap);
+  if (!hashed) {
+    size_t got_len = kernel->normalize(text, len, got, cap);
+    return want_len == got_len && memcmp(want, got, want_len) == 0;
+  }
+  Hash128 hash = {0};
+  size_t got_len = kernel->normalize_hash(text, len, got, cap, &hash);
+  Hash128 want_hash = unit_fingerprint(want, want_len);
+  return want_len == got_len && memcmp(want, got, want_len) == 0 &&
+         hash.hi == want_hash.hi && hash.lo == want_hash.lo;
+}
+
+// Pieces of the short strings when --normalize steps are on: marks that
+// reorder and compose, Hangul jamo, ligatures, case folds and Unicode
+// spaces, mixed with ASCII and a stray lead byte.
+static const char *const unicode_pieces[] = {
+    "A",        " ",        "\t",       "e",        "\xCC\x81", "\xCC\xA3",
+    "\xCD\x85", "\xCE\xB1", "\xC3\x9F", "\xD0",     "\xEF\xAC\x81",
+    "\xE1\x84\x80", "\xE1\x85\xA1", "\xEA\xB0\x80", "\xE2\x80\x83",
+    "\xC2\xA0", "\xE2\x84\xAB", "\xE3\x8C\x80", "\xD0\x96", "\xC3\x89"};
+
+// Append random pieces to text while they fit in max_len; returns the length.
+static size_t fill_unicode(char8_t *text, size_t max_len, uint64_t *rng) {
+  constexpr size_t piece_count =
+      sizeof(unicode_pieces) / sizeof(unicode_pieces[0]);
+  size_t len = 0;
+  for (;;) {
+    const char *piece = unicode_pieces[next_random(rng) % piece_count];
+    size_t piece_len = strlen(piece);
+    if (piece_len > max_len - len)
+      return len;
+    memcpy(text + len, piece, piece_len);
+    len += piece_len;
+  }
+}
+
+// Differential check of one kernel against the scalar one: the corpus units,
+// then short whitespace-heavy strings with and without room for the output
+// (strings of Unicode pieces when --normalize steps are on).
+static bool check_normalize(const NormalizeKernel *scalar,
+                            const NormalizeKernel *kernel, bool hashed,
+                            const TestInput *input, char8_t *want,
+                            char8_t *got) {
+  const char *what =
+      hashed ? "normalize_sentence_hashed" : "normalize_sentence";
+  for (size_t i = 0; i < input->unit_count; ++i) {
+    const char8_t *unit = input->text + input->offsets[i];
+    size_t len = input->offsets[i + 1] - input->offsets[i];
+    if (!same_normalize(scalar, kernel, hashed, unit, len, len, want, got)) {
+      fprintf(stderr, "%s %s differs from scalar on unit %zu\n", what,
+              kernel->name, i);
+      return false;
+    }
+  }
+
+  static const char8_t alphabet[] = {' ', ' ', '\t', '\n', 0x00, 0x1F, 0x20,
+                                     0x21, 'a', 'b', 0x7F, 0x80, 0xD0, 0xFF};
+  char8_t text[TEST_EDGE_MAX_LEN];
+  uint64_t rng = 0xD1B54A32D192ED03ull;
+  for (size_t c = 0; c < TEST_EDGE_CASES; ++c) {
+    uint64_t r = next_random(&rng);
+    size_t len = r % (TEST_EDGE_MAX_LEN + 1);
+    if (normalize_selected() != 0) {
+      len = fill_unicode(text, len, &rng);
+    } else {
+      for (size_t i = 0; i < len; ++i) {
+        text[i] = alphabet[next_random(&rng) % sizeof(alphabet)];
+      }
+    }
+    // Every eighth case leaves too little room for the output.
+    size_t cap = (r >> 32) % 8 == 0 ? (r >> 40) % (len + 1) : len;
+    if (!same_normalize(scalar, kernel, hashed, text, len, cap, want, got)) {
+      fprintf(stderr,
+              "%s %s differs from scalar on a %zu-byte string with %zu "
+              "bytes of room\n",
+              what, kernel->name, len, cap);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Every normalize kernel against the scalar one for the selected steps,
+// plain and fused with the active unit hash.
+static bool test_normalize(const TestInput *input, bool hashed) {
+  const NormalizeKernel *kernels = nullptr;
+  size_t count = normalize_kernels(&kernels);
+  // Unicode steps may grow a unit up to UNICODE_MAX_GROWTH times.
+  size_t scratch = TEST_MAX_UNIT > TEST_EDGE_MAX_LEN ? TEST_MAX_UNIT
+                                                     : TEST_EDGE_MAX_LEN;
+  scratch *= UNICODE_MAX_GROWTH;
+  auto want = (char8_t *)malloc(scratch);
+  auto got = (char8_t *)malloc(scratch);
+  bool ok = want && got;
+  if (!ok)
+    fprintf(stderr, "Failed to allocate test buffers.\n");
+  for (size_t k = hashed ? 0 : 1; ok && k < count; ++k) {
+    ok = check_normalize(&kernels[0], &kernels[k], hashed, input, want, got);
+  }
+  free(want);
+  free(got);
+  return ok;
+}
+
+// Whether impl matches the portable implementation of its family on one
+// input, hashed in one call and streamed in uneven runs of blocks.
+static bool same_unit_hash(const UnitHash *portable, const UnitHash *impl,
+                           const unsigned char *data, size_t len,
+                           uint64_t *rng) {
+  Hash128 want = portable->hash(data, len);
+  Hash128 got = impl->hash(data, len);
+  UnitHashState state;
+  impl->start(&state);
+  size_t blocks = len / 16;
+  for (size_t done = 0; done < blocks;) {
+    size_t step = 1 + next_random(rng) % 5;
+    if (step > blocks - done)
+      step = blocks - done;
+    impl->blocks(&state, data + done * 16, step);
+    done += step;
+  }
+  Hash128 streamed = impl->finish(&state, data + blocks * 16, len);
+  return got.hi == want.hi && got.lo == want.lo && streamed.hi == want.hi &&
+         streamed.lo == want.lo;
+}
+
+// Differential check of one unit hash against its family's portable
+// version: the corpus units, then random bytes long enough to cross the
+// periodic lane scrambles. The portable version checks its own streaming.
+static bool check_unit_hash(const UnitHash *portable, const UnitHash *impl,
+                            const TestInput *input) {
+  uint64_t rng = 0xD1B54A32D192ED03ull;
+  for (size_t i = 0; i < input->unit_count; ++i) {
+    const unsigned char *unit = input->text + input->offsets[i];
+    size_t len = input->offsets[i + 1] - input->offsets[i];
+    if (!same_unit_hash(portable, impl, unit, len, &rng)) {
+      fprintf(stderr, "unit hash %s/%s differs from %s on unit %zu\n",
+              impl->name, impl->impl, portable->impl, i);
+      return false;
+    }
+  }
+
+  unsigned char bytes[TEST_HASH_EDGE_MAX_LEN];
+  for (size_t c = 0; c < TEST_HASH_EDGE_CASES; ++c) {
+    size_t len = next_random(&rng) % (TEST_HASH_EDGE_MAX_LEN + 1);
+    for (size_t i = 0; i < len; ++i) {
+      bytes[i] = (unsigned char)next_random(&rng);
+    }
+    if (!same_unit_hash(portable, impl, bytes, len, &rng)) {
+      fprintf(stderr, "unit hash %s/%s differs from %s on %zu random bytes\n",
+              impl->name, impl->impl, portable->impl, len);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether kernel decodes one input to the same code points and invalid
+// count as scalar.
+static bool same_decode(const Utf8DecodeKernel *scalar,
+                        const Utf8DecodeKernel *kernel, const char8_t *text,
+                        size_t len, uint32_t *want, uint32_t *got) {
+  size_t want_invalid = 0;
+  size_t got_invalid = 0;
+  size_t want_len = scalar->decode(text, len, want, &want_invalid);
+  size_t got_len = kernel->decode(text, len, got, &got_invalid);
+  return want_len == got_len && want_invalid == got_invalid &&
+         memcmp(want, got, want_len * sizeof(uint32_t)) == 0;
+}
+
+// Differential check of one decoder against the scalar one: the corpus
+// units, then strings of valid, overlong, surrogate, out-of-range,
+// truncated and stray bytes, including an encoded U+FFFD, which counts as
+// invalid.
+static bool check_decode(const Utf8DecodeKernel *scalar,
+                         const Utf8DecodeKernel *kernel,
+                         const TestInput *input, uint32_t *want,
+                         uint32_t *got) {
+  for (size_t i = 0; i < input->unit_count; ++i) {
+    const char8_t *unit = input->text + input->offsets[i];
+    size_t len = input->offsets[i + 1] - input->offsets[i];
+    if (!same_decode(scalar, kernel, unit, len, want, got)) {
+      fprintf(stderr, "utf8_decode_buffer %s differs from scalar on unit %zu\n",
+              kernel->name, i);
+      return false;
+    }
+  }
+
+  static const char *const pieces[] = {
+      "a", "a", "a", " ", "\xD0\xB0", "\xD0\xB0", "\xC2\x80", "\xDF\xBF",
+      "\xC0\xAF", "\xC1\xBF", "\xC2", "\x80", "\xBF", "\xE0\xA0\x80",
+      "\xE0\x9F\xBF", "\xED\x9F\xBF", "\xED\xA0\x80", "\xEF\xBF\xBD",
+      "\xE2\x82", "\xF0\x90\x80\x80", "\xF0\x8F\xBF\xBF",
+      "\xF4\x8F\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80", "\xFF"};
+  constexpr size_t piece_count = sizeof(pieces) / sizeof(pieces[0]);
+  char8_t text[TEST_EDGE_MAX_LEN];
+  uint64_t rng = 0xD1B54A32D192ED03ull;
+  for (size_t c = 0; c < TEST_EDGE_CASES; ++c) {
+    size_t len = next_random(&rng) % (TEST_EDGE_MAX_LEN + 1);
+    // Mostly one piece repeated, so some windows stay on the vector paths.
+    const char *common = pieces[next_random(&rng) % piece_count];
+    for (size_t i = 0; i < len;) {
+      uint64_t r = next_random(&rng);
+      const char *piece = r % 4 == 0 ? pieces[(r >> 8) % piece_count] : common;
+      for (; *piece && i < len; ++piece) {
+        text[i++] = (char8_t)*piece;
+      }
+    }
+    if (!same_decode(scalar, kernel, text, len, want, got)) {
+      fprintf(stderr,
+              "utf8_decode_buffer %s differs from scalar on a %zu-byte "
+              "string\n",
+              kernel->name, len);
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool test_decode(const TestInput *input) {
+  const Utf8DecodeKernel *kernels = nullptr;
+  size_t count = utf8_decode_kernels(&kernels);
+  auto want = (uint32_t *)malloc(TEST_MAX_UNIT * sizeof(uint32_t));
+  auto got = (uint32_t *)malloc(TEST_MAX_UNIT * sizeof(uint32_t));
+  bool ok = want && got;
+  if (!ok)
+    fprintf(stderr, "Failed to allocate test buffers.\n");
+  for (size_t k = 1; ok && k < count; ++k) {
+    ok = check_decode(&kernels[0], &kernels[k], input, want, got);
+  }
+  free(want);
+  free(got);
+  return ok;
+}
+
+int main(void) {
+  TestInput input;
+  if (!make_input(TEST_INPUT_BYTES, &input)) {
+    fprintf(stderr, "Failed to allocate test text.\n");
+    return 1;
+  }
+  bool ok = test_normalize(&input, false);
+
+  // The fused kernels under every unit hash this CPU runs.
+  const UnitHash *hashes = nullptr;
+  size_t hash_count = unit_hash_impls(&hashes);
+  const UnitHash *portable = nullptr;
+  for (size_t k = 0; ok && k < hash_count; ++k) {
+    if (!portable || portable->id != hashes[k].id)
+      portable = &hashes[k];
+    ok = check_unit_hash(portable, &hashes[k], &input);
+    unit_hash_select(&hashes[k]);
+    ok = ok && test_normalize(&input, true);
+  }
+  unit_hash_select(unit_hash_auto(false, false));
+
+  // Each --normalize step alone, then all of them.
+  static const uint32_t steps[] = {
+      NORMALIZE_NFKC, NORMALIZE_CASEFOLD, NORMALIZE_UNICODE_SPACE,
+      NORMALIZE_NFKC | NORMALIZE_CASEFOLD | NORMALIZE_UNICODE_SPACE};
+  for (size_t s = 0; ok && s < sizeof(steps) / sizeof(steps[0]); ++s) {
+    normalize_select(steps[s]);
+    ok = test_normalize(&input, false) && test_normalize(&input, true);
+  }
+  normalize_select(0);
+
+  ok = ok && test_decode(&input);
+  free_input(&input);
+  printf("%s\n", ok ? "kernel_test: ok" : "kernel_test: FAILED");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,47 @@
+# Paragraph mode end to end: an empty line (\n\n or \r\n\r\n) and a
+# whitespace-only line both end a paragraph, so the second paragraph of each
+# first file is a duplicate of the one-paragraph file after it.
+# Run with -DCORPUS_DEDUP=<binary> -DWORK_DIR=<scratch dir>.
+
+file(REMOVE_RECURSE "${WORK_DIR}")
+set(input "${WORK_DIR}/in")
+set(output "${WORK_DIR}/out")
+file(MAKE_DIRECTORY "${input}")
+
+string(ASCII 13 cr)
+file(WRITE "${input}/a.txt" "Alpha one.\n\nBeta two.\n")
+file(WRITE "${input}/b.txt" "Beta two.\n")
+file(WRITE "${input}/c.txt" "Gamma three.${cr}\n${cr}\nDelta four.${cr}\n")
+file(WRITE "${input}/d.txt" "Delta four.\n")
+file(WRITE "${input}/e.txt" "Epsilon five.\n \t\nZeta six.\n")
+file(WRITE "${input}/f.txt" "Zeta six.\n")
+
+# --verify exits 1 when it finds duplicates.
+function(run_checked label exit_code expected)
+  execute_process(COMMAND ${ARGN} RESULT_VARIABLE result
+                  OUTPUT_VARIABLE stdout ERROR_VARIABLE stderr)
+  if(NOT result EQUAL exit_code)
+    message(FATAL_ERROR "${label} failed (${result}):\n${stdout}${stderr}")
+  endif()
+  string(FIND "${stdout}" "${expected}" found)
+  if(found EQUAL -1)
+    message(FATAL_ERROR "${label}: expected \"${expected}\" in:\n${stdout}")
+  endif()
+endfunction()
+
+run_checked("dedup" 0 "unique paragraphs 6, duplicate paragraphs 3"
+            "${CORPUS_DEDUP}" "${input}" "${output}"
+            --dedup-mode paragraph --deterministic)
+run_checked("verify" 1 "paragraphs 9, duplicates 3"
+            "${CORPUS_DEDUP}" --verify "${input}" --dedup-mode paragraph)
+
+foreach(name a c e)
+  if(NOT EXISTS "${output}/${name}.txt")
+    message(FATAL_ERROR "missing output ${name}.txt")
+  endif()
+endforeach()
+foreach(name b d f)
+  if(EXISTS "${output}/${name}.txt")
+    message(FATAL_ERROR "${name}.txt should be empty after dedup")
+  endif()
+endforeach()